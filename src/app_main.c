@@ -21,6 +21,7 @@
 #include <os_io_seproxyhal.h>
 
 #include "ui.h"
+#include "common/common.h"
 
 #if defined(HAVE_BAGL)
 extern enum UI_STATE uiState;
@@ -64,10 +65,12 @@ unsigned char io_event(unsigned char channel __attribute__((unused))) {
     // can't have more than one tag in the reply, not supported yet.
     switch (G_io_seproxyhal_spi_buffer[0]) {
         case SEPROXYHAL_TAG_FINGER_EVENT:
+            device_root_key_activity();
             UX_FINGER_EVENT(G_io_seproxyhal_spi_buffer);
             break;
 #if !defined(HAVE_NBGL)
         case SEPROXYHAL_TAG_BUTTON_PUSH_EVENT:  // for Nano S
+            device_root_key_activity();
             UX_BUTTON_PUSH_EVENT(G_io_seproxyhal_spi_buffer);
             break;
 #endif
@@ -77,9 +80,7 @@ unsigned char io_event(unsigned char channel __attribute__((unused))) {
                 (os_seph_features() & SEPROXYHAL_TAG_SESSION_START_EVENT_FEATURE_SCREEN_BIG)) {
                 UX_REDISPLAY();
             } else {
-                if (G_bolos_ux_context.processing == PROCESSING_COMPARE_RECOVERY_PHRASE) {
-                    UX_DISPLAYED_EVENT(compare_recovery_phrase_and_display_result(););
-                } else if (G_bolos_ux_context.processing == PROCESSING_GENERATE_SSKR) {
+                if (G_bolos_ux_context.processing == PROCESSING_GENERATE_SSKR) {
                     UX_DISPLAYED_EVENT(generate_sskr(););
                 } else {
                     UX_DISPLAYED_EVENT();
@@ -93,6 +94,11 @@ unsigned char io_event(unsigned char channel __attribute__((unused))) {
             break;
 
         case SEPROXYHAL_TAG_TICKER_EVENT:
+            device_root_key_ticker();
+#if defined(HAVE_BAGL)
+            // run the pending recovery phrase comparison a few PBKDF2 rounds at a time
+            compare_recovery_phrase_ticker();
+#endif
             UX_TICKER_EVENT(G_io_seproxyhal_spi_buffer, {
                 // default retrig very soon (will be overridden during
                 // stepper_prepro)
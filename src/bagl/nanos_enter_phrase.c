@@ -105,10 +105,6 @@ const bagl_element_t screen_onboarding_restore_word_select_elements[] = {
 
 void screen_onboarding_restore_word_display_auto_complete(void);
 
-extern const ux_flow_step_t *const ux_bip39_match_flow;
-extern const ux_flow_step_t *const ux_sskr_match_flow;
-extern const ux_flow_step_t *const ux_bip39_nomatch_flow;
-extern const ux_flow_step_t *const ux_sskr_nomatch_flow;
 extern const ux_flow_step_t *const ux_bip39_invalid_flow;
 extern const ux_flow_step_t *const ux_sskr_invalid_flow;
 extern const ux_flow_step_t *const ux_restore_flow;
@@ -139,6 +135,8 @@ unsigned int screen_onboarding_restore_word_select_button(unsigned int button_ma
 const bagl_element_t *screen_onboarding_restore_word_keyboard_callback(unsigned int event,
                                                                        unsigned int value);
 
+void screen_onboarding_restore_word_validate(void);
+
 void screen_onboarding_restore_word_display_auto_complete(void) {
     unsigned int auto_complete_count = (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39
                                             ? bolos_ux_bip39_get_word_next_letters_starting_with(
@@ -158,9 +156,10 @@ void screen_onboarding_restore_word_display_auto_complete(void) {
         // element in the list for the word start letter, else keep the order */
         // recompute alphabet and set the number of elements in the keyboard
         auto_complete_count +
-            (strlen(G_ux.string_buffer + 16)
+            ((strlen(G_ux.string_buffer + 16) || G_bolos_ux_context.onboarding_word_undoable)
                  ? 1
-                 : 0) /* backspace if already a stem entered, else no backspace */,
+                 : 0) /* backspace if a stem is already entered or the previous word can be
+                         undone, else no backspace */,
         screen_onboarding_restore_word_keyboard_callback);
     // append the special backspace to allow for easier dispatch in the keyboard callback
     ((unsigned char *) (G_ux.string_buffer + 32))[auto_complete_count] = '\b';
@@ -187,12 +186,26 @@ const bagl_element_t *screen_onboarding_restore_word_keyboard_callback(unsigned
                 if (strlen(G_ux.string_buffer + 16)) {
                     G_ux.string_buffer[16 + strlen(G_ux.string_buffer + 16) - 1] = 0;
                     screen_onboarding_restore_word_display_auto_complete();
+                } else if (G_bolos_ux_context.onboarding_word_undoable) {
+                    screen_onboarding_restore_word_undo();
                 }
             } else {
+                // the previous word can no longer be undone
+                G_bolos_ux_context.onboarding_word_undoable = 0;
                 // validate next letter of the word
                 G_ux.string_buffer[16 + strlen(G_ux.string_buffer + 16)] =
                     G_ux.string_buffer[32 + G_bolos_ux_context.hslider3_current];
 
+                // the stem identifies the word, which is committed right away: it can still be
+                // undone with the backspace of the next word
+                G_bolos_ux_context.onboarding_index = screen_onboarding_restore_word_auto_commit();
+                if (G_bolos_ux_context.onboarding_index < BIP39_WORDLIST_COUNT) {
+                    G_bolos_ux_context.hslider3_current = 0;
+                    G_bolos_ux_context.onboarding_word_undoable = 1;
+                    screen_onboarding_restore_word_validate();
+                    return NULL;
+                }
+
                 // continue displaying until less than X words matches the stem
                 G_bolos_ux_context.onboarding_words_checked =
                     G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39
@@ -306,7 +319,8 @@ const bagl_element_t *screen_onboarding_restore_word_before_element_display_call
             // display matching word from the slider's current index
             (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39)
                 ? bolos_ux_bip39_idx_strcpy(
-                      G_bolos_ux_context.onboarding_index + G_bolos_ux_context.hslider3_current,
+                      bolos_ux_bip39_offered_word_idx(G_bolos_ux_context.onboarding_index +
+                                                      G_bolos_ux_context.hslider3_current),
                       (unsigned char *) G_ux.string_buffer)
                 : bolos_ux_sskr_idx_strcpy(
                       G_bolos_ux_context.onboarding_index + G_bolos_ux_context.hslider3_current,
@@ -349,27 +363,17 @@ const bagl_element_t *screen_onboarding_restore_word_before_element_display_call
     return element;
 }
 
-void compare_recovery_phrase_and_display_result(void) {
-    G_bolos_ux_context.processing = PROCESSING_COMPLETE;
-    io_seproxyhal_general_status();
-
-    if (compare_recovery_phrase()) {
-        (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39)
-            ? ux_flow_init(0, &ux_bip39_match_flow, NULL)
-            : ux_flow_init(0, &ux_sskr_match_flow, NULL);
-    } else {
-        (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39)
-            ? ux_flow_init(0, &ux_bip39_nomatch_flow, NULL)
-            : ux_flow_init(0, &ux_sskr_nomatch_flow, NULL);
-    }
-}
-
 void screen_onboarding_restore_word_validate(void) {
     if (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39) {
-        bolos_ux_bip39_idx_strcpy(
-            G_bolos_ux_context.onboarding_index + G_bolos_ux_context.hslider3_current,
-            (unsigned char *) (G_bolos_ux_context.words_buffer +
-                               G_bolos_ux_context.words_buffer_length));
+        const unsigned int index = bolos_ux_bip39_offered_word_idx(
+            G_bolos_ux_context.onboarding_index + G_bolos_ux_context.hslider3_current);
+        // the checksum is verified on the packed indexes, the text is kept for display
+        bolos_ux_bip39_entropy_word_set(G_bolos_ux_context.bip39_entropy,
+                                        G_bolos_ux_context.onboarding_step,
+                                        index);
+        bolos_ux_bip39_idx_strcpy(index,
+                                  (unsigned char *) (G_bolos_ux_context.words_buffer +
+                                                     G_bolos_ux_context.words_buffer_length));
         G_bolos_ux_context.words_buffer_length = strlen(G_bolos_ux_context.words_buffer);
     } else if (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_SSKR) {
         G_bolos_ux_context.sskr_words_buffer[G_bolos_ux_context.sskr_words_buffer_length] =
@@ -434,21 +438,18 @@ void screen_onboarding_restore_word_validate(void) {
                     (unsigned char *) G_bolos_ux_context.words_buffer,
                     G_bolos_ux_context.words_buffer_length);
             } else {
-                valid =
-                    bolos_ux_bip39_mnemonic_check((unsigned char *) G_bolos_ux_context.words_buffer,
-                                                  G_bolos_ux_context.words_buffer_length);
+                valid = bolos_ux_bip39_entropy_check(G_bolos_ux_context.bip39_entropy,
+                                                     G_bolos_ux_context.onboarding_kind);
             }
 #else
-            valid = bolos_ux_bip39_mnemonic_check((unsigned char *) G_bolos_ux_context.words_buffer,
-                                                  G_bolos_ux_context.words_buffer_length);
+            valid = bolos_ux_bip39_entropy_check(G_bolos_ux_context.bip39_entropy,
+                                                 G_bolos_ux_context.onboarding_kind);
 #endif
             if (!valid) {
                 ux_flow_init(0, &ux_bip39_invalid_flow, NULL);
             } else {
-                // alright, the recovery phrase looks ok, finish onboarding
-                // Display processing warning to user
-                screen_processing_init();
-                G_bolos_ux_context.processing = PROCESSING_COMPARE_RECOVERY_PHRASE;
+                // alright, the recovery phrase looks ok, compare it to onboarded seed
+                screen_compare_recovery_phrase_init();
             }
         } else {
             // add a space before next word
@@ -478,10 +479,8 @@ void screen_onboarding_restore_word_validate(void) {
                 if (!valid) {
                     ux_flow_init(0, &ux_sskr_invalid_flow, NULL);
                 } else {
-                    // alright, the recovery phrase looks ok, finish onboarding
-                    // Display processing warning to user
-                    screen_processing_init();
-                    G_bolos_ux_context.processing = PROCESSING_COMPARE_RECOVERY_PHRASE;
+                    // alright, the recovery phrase looks ok, compare it to onboarded seed
+                    screen_compare_recovery_phrase_init();
                 }
             }
         } else {
@@ -580,8 +579,22 @@ void screen_onboarding_restore_word_init(unsigned int firstWord) {
 
         // flush the words first
         memzero(G_bolos_ux_context.words_buffer, G_bolos_ux_context.words_buffer_length);
+        memzero(G_bolos_ux_context.bip39_entropy, sizeof(G_bolos_ux_context.bip39_entropy));
         G_bolos_ux_context.words_buffer_length = 0;
         G_bolos_ux_context.sskr_words_buffer_length = 0;
+        G_bolos_ux_context.onboarding_word_undoable = 0;
+    }
+
+    // the final BIP39 word is only picked among the ones giving a valid checksum
+    if (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39 &&
+#ifdef HAVE_ELECTRUM
+        G_bolos_ux_context.onboarding_algorithm != BOLOS_UX_ONBOARDING_ALGORITHM_ELECTRUM &&
+#endif
+        G_bolos_ux_context.onboarding_step + 1 == G_bolos_ux_context.onboarding_kind) {
+        bolos_ux_bip39_final_word_filter_set(G_bolos_ux_context.bip39_entropy,
+                                             G_bolos_ux_context.onboarding_kind);
+    } else {
+        bolos_ux_bip39_final_word_filter_set(NULL, 0);
     }
 
     memzero(G_ux.string_buffer, sizeof(G_ux.string_buffer));
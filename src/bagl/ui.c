@@ -33,6 +33,62 @@ void screen_onboarding_bip39_restore_init(void) {
     screen_onboarding_restore_word_init(RESTORE_WORD_ACTION_FIRST_WORD);
 }
 
+#if !defined(TARGET_NANOS)
+// the wordlist of the phrase, typed without its accents, and for an English one the wallet which
+// generated it: Electrum standard seeds use that wordlist with their own checksum and seed
+enum {
+    BIP39_WORDLIST_ENGLISH_ITEM,
+    BIP39_WORDLIST_FRENCH_ITEM,
+#ifdef HAVE_ELECTRUM
+    BIP39_WORDLIST_ELECTRUM_ITEM,
+#endif
+    BIP39_WORDLIST_BACK_ITEM,
+};
+
+const char* const bip39_wordlist_values[] = {
+    [BIP39_WORDLIST_ENGLISH_ITEM] = "BIP39 English",
+    [BIP39_WORDLIST_FRENCH_ITEM] = "BIP39 French",
+#ifdef HAVE_ELECTRUM
+    [BIP39_WORDLIST_ELECTRUM_ITEM] = "Electrum",
+#endif
+    [BIP39_WORDLIST_BACK_ITEM] = "Back",
+};
+
+const char* bip39_wordlist_getter(unsigned int idx) {
+    if (idx < ARRAYLEN(bip39_wordlist_values)) {
+        return bip39_wordlist_values[idx];
+    }
+    return NULL;
+}
+
+void bip39_wordlist_selector(unsigned int idx) {
+    if (idx >= BIP39_WORDLIST_BACK_ITEM) {
+        ui_idle_init();
+        return;
+    }
+#ifdef HAVE_ELECTRUM
+    G_bolos_ux_context.onboarding_algorithm = idx == BIP39_WORDLIST_ELECTRUM_ITEM
+                                                  ? BOLOS_UX_ONBOARDING_ALGORITHM_ELECTRUM
+                                                  : BOLOS_UX_ONBOARDING_ALGORITHM_BIP39;
+#endif
+    bolos_ux_bip39_wordlist_set(idx == BIP39_WORDLIST_FRENCH_ITEM ? BIP39_LANGUAGE_FRENCH
+                                                                  : BIP39_LANGUAGE_ENGLISH);
+    screen_onboarding_bip39_restore_init();
+}
+
+UX_STEP_NOCB(ux_bip39_wordlist_instruction_step,
+             nnn,
+             {
+                 "Select the wordlist",
+                 "of your",
+                 "Recovery Sheet",
+             });
+
+UX_STEP_MENULIST(ux_bip39_wordlist_menu_step, bip39_wordlist_getter, bip39_wordlist_selector);
+
+UX_FLOW(ux_bip39_wordlist_flow, &ux_bip39_wordlist_instruction_step, &ux_bip39_wordlist_menu_step);
+#endif  // !defined(TARGET_NANOS)
+
 const char* const number_of_bip39_words_values[] = {
     "12 words",
     "18 words",
@@ -59,7 +115,11 @@ void number_of_bip39_words_selector(unsigned int idx) {
             G_bolos_ux_context.onboarding_kind = BIP39_MNEMONIC_SIZE_24;
             goto word_init;
         word_init:
+#if !defined(TARGET_NANOS)
+            ux_flow_init(0, ux_bip39_wordlist_flow, NULL);
+#else
             screen_onboarding_bip39_restore_init();
+#endif
             break;
         default:
             ui_idle_init();
@@ -137,7 +197,7 @@ UX_STEP_NOCB(ux_idle_flow_3_step,
              });
 UX_STEP_VALID(ux_idle_flow_4_step,
               pb,
-              os_sched_exit(-1),
+              clean_exit(-1),
               {
                   &C_icon_dashboard_x,
                   "Quit",
@@ -148,15 +208,25 @@ UX_FLOW(ux_idle_flow,
         &ux_idle_flow_3_step,
         &ux_idle_flow_4_step);
 
-void ui_idle_init(void) {
+// drop the backup being checked and its pending comparison
+static void ui_reset(void) {
     uiState = UI_IDLE;
 
+    compare_recovery_phrase_cancel();
+    bolos_ux_bip39_final_word_filter_set(NULL, 0);
+    bolos_ux_bip39_wordlist_set(BIP39_LANGUAGE_ENGLISH);
+    G_bolos_ux_context.onboarding_step = 0;
     memzero(G_bolos_ux_context.words_buffer, sizeof(G_bolos_ux_context.words_buffer));
+    memzero(G_bolos_ux_context.bip39_entropy, sizeof(G_bolos_ux_context.bip39_entropy));
     memzero(G_bolos_ux_context.string_buffer, sizeof(G_bolos_ux_context.string_buffer));
     memzero(G_bolos_ux_context.sskr_words_buffer, G_bolos_ux_context.sskr_words_buffer_length);
     G_bolos_ux_context.words_buffer_length = 0;
     G_bolos_ux_context.sskr_words_buffer_length = 0;
     G_bolos_ux_context.sskr_share_index = 0;
+}
+
+void ui_idle_init(void) {
+    ui_reset();
 
     // reserve a display stack slot if none yet
     if (G_ux.stack_count == 0) {
@@ -165,4 +235,23 @@ void ui_idle_init(void) {
     ux_flow_init(0, ux_idle_flow, NULL);
 }
 
+//////////////////////////////////////////////////////////////////////
+
+// the selection of the backup of the same kind as the one just checked, following the tally
+UX_FLOW(ux_bip39_check_another_flow,
+        &ux_check_tally_step,
+        &ux_bip39_instruction_step,
+        &ux_bip39_menu_step);
+
+UX_FLOW(ux_sskr_check_another_flow, &ux_check_tally_step, &ux_sskr_instruction_step);
+
+void screen_check_another_init(void) {
+    ui_reset();
+    if (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39) {
+        ux_flow_init(0, ux_bip39_check_another_flow, NULL);
+    } else {
+        ux_flow_init(0, ux_sskr_check_another_flow, NULL);
+    }
+}
+
 #endif
@@ -15,6 +15,7 @@
  *  limitations under the License.
  ********************************************************************************/
 
+#include "constants.h"
 #include "ux_nano.h"
 
 #if defined(HAVE_BAGL)
@@ -22,7 +23,11 @@
 bolos_ux_context_t G_bolos_ux_context;
 
 void clean_exit(bolos_task_status_t exit_code) {
+    compare_recovery_phrase_cancel();
+    device_root_key_clear();
+    bolos_ux_bip39_final_word_filter_set(NULL, 0);
     memzero(G_bolos_ux_context.words_buffer, sizeof(G_bolos_ux_context.words_buffer));
+    memzero(G_bolos_ux_context.bip39_entropy, sizeof(G_bolos_ux_context.bip39_entropy));
     memzero(G_bolos_ux_context.string_buffer, sizeof(G_bolos_ux_context.string_buffer));
     memzero(G_bolos_ux_context.sskr_words_buffer, G_bolos_ux_context.sskr_words_buffer_length);
     G_bolos_ux_context.words_buffer_length = 0;
@@ -136,6 +141,36 @@ void bolos_ux_hslider3_previous(void) {
     }
 }
 
+unsigned int screen_onboarding_restore_word_auto_commit(void) {
+    const char *stem = G_ux.string_buffer + 16;
+
+    // only BIP39 words are identified by their first letters, the final one is still confirmed as
+    // the phrase is then checked
+    if (G_bolos_ux_context.onboarding_type != ONBOARDING_TYPE_BIP39 ||
+        G_bolos_ux_context.onboarding_step + 1 >= G_bolos_ux_context.onboarding_kind) {
+        return BIP39_WORDLIST_COUNT;
+    }
+    return bolos_ux_bip39_get_unique_word_idx_starting_with((const unsigned char *) stem,
+                                                            strlen(stem));
+}
+
+void screen_onboarding_restore_word_undo(void) {
+    G_bolos_ux_context.onboarding_word_undoable = 0;
+    if (G_bolos_ux_context.onboarding_step == 0) {
+        return;
+    }
+    // remove the space following the word and the word itself, keeping the previous space
+    do {
+        G_bolos_ux_context.words_buffer[--G_bolos_ux_context.words_buffer_length] = 0;
+    } while (G_bolos_ux_context.words_buffer_length &&
+             G_bolos_ux_context.words_buffer[G_bolos_ux_context.words_buffer_length - 1] != ' ');
+    G_bolos_ux_context.onboarding_step--;
+    bolos_ux_bip39_entropy_word_set(G_bolos_ux_context.bip39_entropy,
+                                    G_bolos_ux_context.onboarding_step,
+                                    0);
+    screen_onboarding_restore_word_init(RESTORE_WORD_ACTION_REENTER_WORD);
+}
+
 UX_STEP_CB(ux_restore_step_1, nn, screen_onboarding_restore_word_display_auto_complete();
            , {"Enter", G_ux.string_buffer});
 
@@ -160,15 +195,50 @@ UX_FLOW(ux_bip39_invalid_flow,
         &ux_bip39_invalid_step_3,
         &ux_return_step);
 
+// checks compared to the device's seed since the app was started, for the backups to be checked
+// back to back
+static struct {
+    unsigned int checked;
+    unsigned int matched;
+    char text[24];
+} check_tally;
+
+UX_STEP_NOCB(ux_check_tally_step, nn, {"Checked so far", check_tally.text});
+UX_STEP_VALID(ux_check_another_step,
+              pb,
+              screen_check_another_init(),
+              {&C_icon_back_x, "Check another"});
+
 UX_STEP_NOCB(ux_bip39_nomatch_step_1, pbb, {&C_icon_warning, "BIP39 Phrase", "doesn't match"});
 
-UX_FLOW(ux_bip39_nomatch_flow, &ux_bip39_nomatch_step_1, &ux_return_step);
+UX_FLOW(ux_bip39_nomatch_flow,
+        &ux_bip39_nomatch_step_1,
+        &ux_check_tally_step,
+        &ux_check_another_step);
 
 UX_STEP_NOCB(ux_bip39_match_step_1, pbb, {&C_icon_validate_14, "BIP39 Phrase", "is correct"});
 UX_STEP_CB(ux_bip39_recover_step_1, pbb, set_sskr_descriptor_values();
            , {&SSKR_ICON, "Generate", "SSKR phrases"});
 
-UX_FLOW(ux_bip39_match_flow, &ux_bip39_match_step_1, &ux_quit_step, &ux_bip39_recover_step_1);
+UX_FLOW(ux_bip39_match_flow,
+        &ux_bip39_match_step_1,
+        &ux_check_tally_step,
+        &ux_check_another_step,
+        &ux_quit_step,
+        &ux_bip39_recover_step_1);
+
+#ifdef HAVE_ELECTRUM
+// an Electrum seed is not derived from the entropy of its words: no SSKR shares are offered for it
+UX_STEP_NOCB(ux_electrum_match_step_1,
+             pbb,
+             {&C_icon_validate_14, "Electrum Phrase", "is correct"});
+
+UX_FLOW(ux_electrum_match_flow,
+        &ux_electrum_match_step_1,
+        &ux_check_tally_step,
+        &ux_check_another_step,
+        &ux_quit_step);
+#endif
 
 UX_STEP_NOCB(ux_sskr_invalid_step_1, pbb, {&C_icon_crossmark, "SSKR Recovery", "phrase invalid"});
 UX_STEP_VALID(ux_sskr_invalid_step_3, pb, screen_onboarding_sskr_restore_init();
@@ -186,7 +256,105 @@ UX_STEP_NOCB(ux_sskr_match_step_1, pbb, {&C_icon_validate_14, "SSKR Phrase", "is
 
 UX_STEP_CB(ux_sskr_recover_step_1, pbb, recover_bip39();, {&BIP39_ICON, "Recover", "BIP39 phrase"});
 
-UX_FLOW(ux_sskr_nomatch_flow, &ux_sskr_nomatch_step_1, &ux_quit_step, &ux_sskr_recover_step_1);
+UX_FLOW(ux_sskr_nomatch_flow,
+        &ux_sskr_nomatch_step_1,
+        &ux_check_tally_step,
+        &ux_check_another_step,
+        &ux_quit_step,
+        &ux_sskr_recover_step_1);
+
+UX_FLOW(ux_sskr_match_flow,
+        &ux_sskr_match_step_1,
+        &ux_check_tally_step,
+        &ux_check_another_step,
+        &ux_quit_step,
+        &ux_sskr_recover_step_1);
+
+static void compare_recovery_phrase_abort(void) {
+    compare_recovery_phrase_cancel();
+    ui_idle_init();
+}
+
+// progress of the recovery phrase comparison, both buttons cancel it
+UX_STEP_CB(ux_compare_step,
+           pnn,
+           compare_recovery_phrase_abort(),
+           {&C_icon_loader, G_bolos_ux_context.string_buffer, "Both buttons: cancel"});
+
+UX_FLOW(ux_compare_flow, &ux_compare_step);
+
+static void compare_recovery_phrase_display_result(bool match) {
+    check_tally.checked++;
+    check_tally.matched += match;
+    SPRINTF(check_tally.text, "%d, %d matching", check_tally.checked, check_tally.matched);
 
-UX_FLOW(ux_sskr_match_flow, &ux_sskr_match_step_1, &ux_quit_step, &ux_sskr_recover_step_1);
+    if (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39) {
+#ifdef HAVE_ELECTRUM
+        if (match &&
+            G_bolos_ux_context.onboarding_algorithm == BOLOS_UX_ONBOARDING_ALGORITHM_ELECTRUM) {
+            ux_flow_init(0, ux_electrum_match_flow, NULL);
+            return;
+        }
+#endif
+        if (match) {
+            ux_flow_init(0, ux_bip39_match_flow, NULL);
+        } else {
+            memzero(G_bolos_ux_context.words_buffer, G_bolos_ux_context.words_buffer_length);
+            ux_flow_init(0, ux_bip39_nomatch_flow, NULL);
+        }
+    } else {
+        ux_flow_init(0, match ? ux_sskr_match_flow : ux_sskr_nomatch_flow, NULL);
+    }
+}
+
+void screen_compare_recovery_phrase_init(void) {
+    if (!compare_recovery_phrase_start()) {
+        compare_recovery_phrase_display_result(false);
+        return;
+    }
+    SPRINTF(G_bolos_ux_context.string_buffer, "Processing 0%%");
+    ux_flow_init(0, ux_compare_flow, NULL);
+}
+
+#if !defined(TARGET_NANOS)
+// speculative seed derivation while the final BIP39 word is being entered
+static void compare_recovery_phrase_idle(void) {
+    const unsigned char *prefix = (const unsigned char *) G_ux.string_buffer + 16;
+
+    if (G_bolos_ux_context.onboarding_type != ONBOARDING_TYPE_BIP39 ||
+        G_bolos_ux_context.onboarding_step + 1 != G_bolos_ux_context.onboarding_kind) {
+        return;
+    }
+#ifdef HAVE_ELECTRUM
+    if (G_bolos_ux_context.onboarding_algorithm == BOLOS_UX_ONBOARDING_ALGORITHM_ELECTRUM) {
+        return;
+    }
+#endif
+    // the first offered word matching the stem typed so far is the likeliest
+    compare_recovery_phrase_speculate(
+        G_bolos_ux_context.bip39_entropy,
+        G_bolos_ux_context.onboarding_kind,
+        bolos_ux_bip39_offered_word_idx(bolos_ux_bip39_get_word_idx_starting_with(
+            prefix,
+            strnlen((const char *) prefix, BIP39_WORDLIST_WORD_LETTERS))));
+}
+#endif
+
+void compare_recovery_phrase_ticker(void) {
+    uint8_t progress;
+
+    if (!compare_recovery_phrase_pending()) {
+#if !defined(TARGET_NANOS)
+        compare_recovery_phrase_idle();
+#endif
+        return;
+    }
+    progress = compare_recovery_phrase_step();
+    if (progress < 100) {
+        SPRINTF(G_bolos_ux_context.string_buffer, "Processing %d%%", progress);
+        UX_REDISPLAY();
+        return;
+    }
+    compare_recovery_phrase_display_result(compare_recovery_phrase_finish());
+}
 #endif  // defined(HAVE_BAGL)
@@ -20,6 +20,7 @@
 #include <ux.h>
 #include "ui.h"
 #include "../common/common.h"
+#include "../common/bip39/seed_rom_variables.h"
 
 #if defined(HAVE_BAGL)
 
@@ -35,6 +36,11 @@ void screen_onboarding_bip39_restore_init(void);
 void screen_onboarding_sskr_restore_init(void);
 void screen_onboarding_restore_word_init(unsigned int action);
 void screen_onboarding_restore_word_display_auto_complete(void);
+// index of the single word matching the stem, committed without being selected from the slider,
+// or BIP39_WORDLIST_COUNT (the same trie query as the auto-commit of the NBGL keyboard)
+unsigned int screen_onboarding_restore_word_auto_commit(void);
+// remove the last word committed, to enter it again
+void screen_onboarding_restore_word_undo(void);
 
 // bolos ux context (not mandatory if redesigning a bolos ux)
 typedef struct bolos_ux_context {
@@ -54,6 +60,9 @@ typedef struct bolos_ux_context {
     unsigned int onboarding_step;
     unsigned int onboarding_index;
     unsigned int onboarding_words_checked;
+    // set when a word was committed as soon as its stem matched it alone, until a letter of the
+    // next word is entered: the backspace then undoes it
+    unsigned int onboarding_word_undoable;
 
     unsigned int words_buffer_length;
 
@@ -61,6 +70,9 @@ typedef struct bolos_ux_context {
 #define WORDS_BUFFER_MAX_SIZE_B 257
     char words_buffer[WORDS_BUFFER_MAX_SIZE_B];
 
+    // 11-bit indexes of the BIP39 words entered so far, packed as in the decoded mnemonic
+    unsigned char bip39_entropy[BIP39_ENTROPY_MAX_LENGTH];
+
     // after an int to make sure it's aligned
 #define BOLOS_APP_ICON_SIZE_B (9 + 32)
     char string_buffer[MAX(
@@ -117,15 +129,24 @@ void recover_bip39(void);
 
 void clean_exit(bolos_task_status_t exit_code);
 
+// display the progress of the recovery phrase comparison, which is then run from the ticker
+// events by compare_recovery_phrase_ticker until its result is displayed
+void screen_compare_recovery_phrase_init(void);
+void compare_recovery_phrase_ticker(void);
+
+// running tally of the checks, shown on the results and when checking another backup
+extern const ux_flow_step_t ux_check_tally_step;
+// check another backup of the kind just checked, from the selection of its number of words (BIP39)
+// or the entry of its first share (SSKR)
+void screen_check_another_init(void);
+
 #if defined(TARGET_NANOS)
-#define BIP39_ICON                         C_bip39_nanos
-#define SSKR_ICON                          C_sskr_nanos
-#define PROCESSING_COMPLETE                0
-#define PROCESSING_COMPARE_RECOVERY_PHRASE 1
-#define PROCESSING_GENERATE_SSKR           2
+#define BIP39_ICON               C_bip39_nanos
+#define SSKR_ICON                C_sskr_nanos
+#define PROCESSING_COMPLETE      0
+#define PROCESSING_GENERATE_SSKR 2
 
 extern const bagl_element_t screen_onboarding_word_list_elements[9];
-void compare_recovery_phrase_and_display_result(void);
 void generate_sskr(void);
 void screen_processing_init(void);
 #else
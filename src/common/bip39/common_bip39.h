@@ -17,8 +17,17 @@
 
 #pragma once
 
+#include <stdbool.h>
+
 // BIP39 helpers
 #include "./seed_rom_variables.h"
+#include "./pbkdf2_sha512.h"
+
+// select the wordlist of the phrases (BIP39_LANGUAGE_*), return 0 if it is not compiled in: the
+// words are typed, displayed and decoded by their ASCII-folded letters, the entropy helpers below
+// rebuilding the NFKD text of the phrase for PBKDF2
+unsigned int bolos_ux_bip39_wordlist_set(unsigned int language);
+unsigned int bolos_ux_bip39_wordlist_get(void);
 
 // convert mnemonic phrase to bits return 0 if mnemonic is invalid
 unsigned int bolos_ux_bip39_mnemonic_decode(const unsigned char *mnemonic,
@@ -37,12 +46,83 @@ unsigned int bolos_ux_bip39_mnemonic_check(const unsigned char *mnemonic,
                                            unsigned int mnemonic_length);
 
 // passphrase will be prefixed with "MNEMONIC" from BIP39, the passphrase content shall start @ 8
+// (the mnemonic is the NFKD text of the phrase)
 void bolos_ux_bip39_mnemonic_to_seed(const unsigned char *mnemonic,
                                      const unsigned int mnemonic_length,
                                      unsigned char *seed /*, unsigned char *workBuffer*/);
 
+// init the PBKDF2 context of a seed derivation, run by pbkdf2_sha512_step until its end and then
+// output by pbkdf2_sha512_final: the phrase is no longer needed once the context is initialized
+cx_err_t bolos_ux_bip39_mnemonic_to_seed_start(pbkdf2_sha512_t *ctx,
+                                               const unsigned char *mnemonic,
+                                               unsigned int mnemonic_length);
+
+// the entropy buffer holds the 11-bit word indexes packed big-endian, as decoded from a mnemonic:
+// entropy bytes followed by the checksum bits (BIP39_ENTROPY_MAX_LENGTH bytes at most)
+void bolos_ux_bip39_entropy_word_set(unsigned char *entropy,
+                                     unsigned int word_number,
+                                     unsigned int index);
+unsigned int bolos_ux_bip39_entropy_word_get(const unsigned char *entropy,
+                                             unsigned int word_number);
+
+// compute the checksum bits following the entropy of a word_count long mnemonic
+void bolos_ux_bip39_entropy_checksum_set(unsigned char *entropy, unsigned int word_count);
+
+// whether the checksum bits of the entropy buffer are valid or not
+unsigned int bolos_ux_bip39_entropy_check(const unsigned char *entropy, unsigned int word_count);
+
+// number of final words giving a valid checksum to the first word_count - 1 words (0 if the
+// word count is invalid), and the n-th of them: the candidates are in increasing index order
+unsigned int bolos_ux_bip39_final_word_candidate_count(unsigned int word_count);
+unsigned int bolos_ux_bip39_final_word_candidate(const unsigned char *entropy,
+                                                 unsigned int word_count,
+                                                 unsigned int n);
+
+// whether the word b may have been entered instead of a: it shares the first 3 letters of a (the
+// 4th letter being the one telling apart the words of a same family) or is one letter away from it
+// (one letter replaced, added or removed). The family is that of the 3-letter stem because the
+// first 4 letters identify a BIP39 word, so that a 4-letter family would only hold the word itself.
+// A word has 2.6 near words on average and 13 at most ("can"): the 24 words of a phrase give 63
+// substitutions on average and 312 at most, 1 in 2^CS of them having a valid checksum.
+bool bolos_ux_bip39_words_near(unsigned int a, unsigned int b);
+// the n-th near word of a word, or BIP39_WORDLIST_COUNT if none: the near words are the results of
+// the slots 0 to BIP39_NEAR_WORD_SLOTS - 1, each one once, the first BIP39_NEAR_WORD_STEM_SLOTS
+// holding the words of the same stem, the others the words one letter away within the stem
+unsigned int bolos_ux_bip39_near_word(unsigned int index, unsigned int n);
+
+// convert the entropy buffer to a mnemonic phrase, return its length or 0 if it does not fit
+unsigned int bolos_ux_bip39_entropy_to_mnemonic(const unsigned char *entropy,
+                                                unsigned int word_count,
+                                                unsigned char *out,
+                                                size_t out_len);
+
+// same as bolos_ux_bip39_mnemonic_to_seed, the phrase is only transiently rebuilt for PBKDF2
+void bolos_ux_bip39_entropy_to_seed(const unsigned char *entropy,
+                                    unsigned int word_count,
+                                    unsigned char *seed);
+cx_err_t bolos_ux_bip39_entropy_to_seed_start(pbkdf2_sha512_t *ctx,
+                                              const unsigned char *entropy,
+                                              unsigned int word_count);
+
+// restrict the words offered by the prefix helpers below (counts, next letters, candidates) to the
+// final words giving a valid checksum to the first word_count - 1 words of the entropy buffer, a
+// word_count of 0 offering the whole wordlist again (always offered on Nano S, which lacks the RAM)
+void bolos_ux_bip39_final_word_filter_set(const unsigned char *entropy, unsigned int word_count);
+// word index at a position among the offered words, as returned by
+// bolos_ux_bip39_get_word_idx_starting_with (the position is the index when no filter is set)
+unsigned int bolos_ux_bip39_offered_word_idx(unsigned int position);
+
+// set [first, last) to the range of the words starting with the prefix, empty if none
+void bolos_ux_bip39_get_word_range_starting_with(const unsigned char *prefix,
+                                                 const unsigned int prefixlength,
+                                                 unsigned int *first,
+                                                 unsigned int *last);
 unsigned int bolos_ux_bip39_get_word_idx_starting_with(const unsigned char *prefix,
                                                        const unsigned int prefixlength);
+// same as bolos_ux_bip39_get_word_idx_starting_with when a single offered word starts with the
+// prefix, else BIP39_WORDLIST_COUNT: answered in a few trie nodes, without counting the words
+unsigned int bolos_ux_bip39_get_unique_word_idx_starting_with(const unsigned char *prefix,
+                                                              const unsigned int prefixlength);
 unsigned int bolos_ux_bip39_idx_strcpy(const unsigned int index, unsigned char *buffer);
 unsigned int bolos_ux_bip39_get_word_count_starting_with(const unsigned char *prefix,
                                                          const unsigned int prefixlength);
@@ -61,11 +141,17 @@ uint32_t bolos_ux_bip39_get_keyboard_mask(const unsigned char *prefix,
 
 #ifdef HAVE_ELECTRUM
 
+// generate a 12-word mnemonic of the given version, return its length or 0 if it does not fit
 unsigned int bolos_ux_electrum_new_bip39_mnemonic(unsigned int version,
                                                   unsigned char *out,
                                                   unsigned int out_length);
+// whether the mnemonic has the given version or not
 unsigned int bolos_ux_electrum_bip39_mnemonic_check(unsigned int version,
                                                     unsigned char *mnemonic,
                                                     unsigned int mnemonic_length);
+// same as bolos_ux_bip39_mnemonic_to_seed_start for an Electrum seed
+cx_err_t bolos_ux_electrum_mnemonic_to_seed_start(pbkdf2_sha512_t *ctx,
+                                                  const unsigned char *mnemonic,
+                                                  unsigned int mnemonic_length);
 
 #endif
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <os.h>
+#include <cx.h>
+
+#include "../common.h"
+#include "./pbkdf2_sha512.h"
+
+cx_err_t hmac_sha512_key_init(hmac_sha512_key_t *key, const uint8_t *secret, size_t secret_length) {
+    uint8_t block[PBKDF2_SHA512_BLOCK_LENGTH] = {0};
+    cx_err_t error = CX_OK;
+
+    if (secret_length > PBKDF2_SHA512_BLOCK_LENGTH) {
+        cx_hash_sha512(secret, secret_length, block, PBKDF2_SHA512_LENGTH);
+    } else {
+        memcpy(block, secret, secret_length);
+    }
+
+    for (size_t i = 0; i < PBKDF2_SHA512_BLOCK_LENGTH; i++) {
+        block[i] ^= 0x36;
+    }
+    CX_CHECK(cx_sha512_init_no_throw(&key->inner));
+    CX_CHECK(cx_hash_no_throw(&key->inner.header, 0, block, PBKDF2_SHA512_BLOCK_LENGTH, NULL, 0));
+    for (size_t i = 0; i < PBKDF2_SHA512_BLOCK_LENGTH; i++) {
+        block[i] ^= 0x36 ^ 0x5C;
+    }
+    CX_CHECK(cx_sha512_init_no_throw(&key->outer));
+    CX_CHECK(cx_hash_no_throw(&key->outer.header, 0, block, PBKDF2_SHA512_BLOCK_LENGTH, NULL, 0));
+
+end:
+    memzero(block, sizeof(block));
+    if (error != CX_OK) {
+        memzero(key, sizeof(*key));
+    }
+    return error;
+}
+
+// the midstates are copied in a scratch state and finalized
+cx_err_t hmac_sha512_keyed(const hmac_sha512_key_t *key,
+                           const uint8_t *message,
+                           size_t message_length,
+                           uint8_t mac[PBKDF2_SHA512_LENGTH]) {
+    cx_sha512_t scratch;
+    cx_err_t error = CX_OK;
+
+    memcpy(&scratch, &key->inner, sizeof(scratch));
+    CX_CHECK(cx_hash_no_throw(&scratch.header,
+                              CX_LAST,
+                              message,
+                              message_length,
+                              mac,
+                              PBKDF2_SHA512_LENGTH));
+    memcpy(&scratch, &key->outer, sizeof(scratch));
+    CX_CHECK(cx_hash_no_throw(&scratch.header,
+                              CX_LAST,
+                              mac,
+                              PBKDF2_SHA512_LENGTH,
+                              mac,
+                              PBKDF2_SHA512_LENGTH));
+
+end:
+    memzero(&scratch, sizeof(scratch));
+    return error;
+}
+
+cx_err_t pbkdf2_sha512_init(pbkdf2_sha512_t *ctx,
+                            const uint8_t *password,
+                            size_t password_length,
+                            const uint8_t *salt,
+                            size_t salt_length,
+                            uint32_t iterations) {
+    // the output is a single block, its index being INT(1)
+    static const uint8_t block_index[4] = {0, 0, 0, 1};
+    cx_sha512_t scratch;
+    cx_err_t error = CX_OK;
+
+    memzero(ctx, sizeof(*ctx));
+    if (iterations == 0) {
+        return CX_INVALID_PARAMETER;
+    }
+    CX_CHECK(hmac_sha512_key_init(&ctx->key, password, password_length));
+
+    // U_1 = HMAC(key, salt || INT(1))
+    memcpy(&scratch, &ctx->key.inner, sizeof(scratch));
+    CX_CHECK(cx_hash_no_throw(&scratch.header, 0, salt, salt_length, NULL, 0));
+    CX_CHECK(cx_hash_no_throw(&scratch.header,
+                              CX_LAST,
+                              block_index,
+                              sizeof(block_index),
+                              ctx->u,
+                              PBKDF2_SHA512_LENGTH));
+    memcpy(&scratch, &ctx->key.outer, sizeof(scratch));
+    CX_CHECK(cx_hash_no_throw(&scratch.header,
+                              CX_LAST,
+                              ctx->u,
+                              PBKDF2_SHA512_LENGTH,
+                              ctx->u,
+                              PBKDF2_SHA512_LENGTH));
+    memcpy(ctx->t, ctx->u, PBKDF2_SHA512_LENGTH);
+    ctx->iterations = iterations;
+    ctx->rounds_left = iterations - 1;
+
+end:
+    memzero(&scratch, sizeof(scratch));
+    if (error != CX_OK) {
+        memzero(ctx, sizeof(*ctx));
+    }
+    return error;
+}
+
+cx_err_t pbkdf2_sha512_step(pbkdf2_sha512_t *ctx, uint32_t max_rounds) {
+    cx_err_t error = CX_OK;
+
+    while (ctx->rounds_left > 0 && max_rounds-- > 0) {
+        // U_i = HMAC(key, U_i-1)
+        CX_CHECK(hmac_sha512_keyed(&ctx->key, ctx->u, PBKDF2_SHA512_LENGTH, ctx->u));
+        for (size_t i = 0; i < PBKDF2_SHA512_LENGTH; i++) {
+            ctx->t[i] ^= ctx->u[i];
+        }
+        ctx->rounds_left--;
+    }
+
+end:
+    if (error != CX_OK) {
+        memzero(ctx, sizeof(*ctx));
+    }
+    return error;
+}
+
+cx_err_t pbkdf2_sha512_final(pbkdf2_sha512_t *ctx, uint8_t *out, size_t out_length) {
+    cx_err_t error = CX_OK;
+
+    if (ctx->iterations == 0 || ctx->rounds_left > 0 || out_length > PBKDF2_SHA512_LENGTH) {
+        error = CX_INVALID_PARAMETER;
+    } else {
+        memcpy(out, ctx->t, out_length);
+    }
+    memzero(ctx, sizeof(*ctx));
+    return error;
+}
+
+cx_err_t pbkdf2_sha512(const uint8_t *password,
+                       size_t password_length,
+                       const uint8_t *salt,
+                       size_t salt_length,
+                       uint32_t iterations,
+                       uint8_t *out,
+                       size_t out_length) {
+    pbkdf2_sha512_t ctx;
+    cx_err_t error = CX_OK;
+
+    CX_CHECK(pbkdf2_sha512_init(&ctx, password, password_length, salt, salt_length, iterations));
+    CX_CHECK(pbkdf2_sha512_step(&ctx, iterations));
+    CX_CHECK(pbkdf2_sha512_final(&ctx, out, out_length));
+
+end:
+    memzero(&ctx, sizeof(ctx));
+    return error;
+}
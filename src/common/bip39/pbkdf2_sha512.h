@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <cx.h>
+
+#define PBKDF2_SHA512_LENGTH 64
+// longer passwords are hashed into a PBKDF2_SHA512_LENGTH key first
+#define PBKDF2_SHA512_BLOCK_LENGTH 128
+
+// HMAC-SHA512 key schedule: the key is absorbed once in the inner and outer SHA-512 states, which
+// are then copied for each message, saving the 2 compressions of re-keying the HMAC.
+typedef struct hmac_sha512_key_s {
+    cx_sha512_t inner;  // state after absorbing key ^ ipad
+    cx_sha512_t outer;  // state after absorbing key ^ opad
+} hmac_sha512_key_t;
+
+cx_err_t hmac_sha512_key_init(hmac_sha512_key_t *key, const uint8_t *secret, size_t secret_length);
+
+// mac may be the message
+cx_err_t hmac_sha512_keyed(const hmac_sha512_key_t *key,
+                           const uint8_t *message,
+                           size_t message_length,
+                           uint8_t mac[PBKDF2_SHA512_LENGTH]);
+
+// PBKDF2-HMAC-SHA512 limited to a single output block, as needed for BIP39 and Electrum seeds.
+//
+// A round costs 2 SHA-512 compressions thanks to the key schedule of the password.
+// The derivation may be run at once or a few rounds at a time, the context holding all the
+// intermediate state (zeroed by pbkdf2_sha512_final). It is kept small enough to live in a
+// static between two ticker events, the scratch state being on the stack of each round.
+typedef struct pbkdf2_sha512_s {
+    hmac_sha512_key_t key;
+    uint8_t u[PBKDF2_SHA512_LENGTH];  // U_i
+    uint8_t t[PBKDF2_SHA512_LENGTH];  // U_1 ^ ... ^ U_i
+    uint32_t iterations;
+    uint32_t rounds_left;
+} pbkdf2_sha512_t;
+
+// compute the keys midstates and U_1, leaving iterations - 1 rounds to run
+cx_err_t pbkdf2_sha512_init(pbkdf2_sha512_t *ctx,
+                            const uint8_t *password,
+                            size_t password_length,
+                            const uint8_t *salt,
+                            size_t salt_length,
+                            uint32_t iterations);
+
+// run at most max_rounds of the remaining rounds
+cx_err_t pbkdf2_sha512_step(pbkdf2_sha512_t *ctx, uint32_t max_rounds);
+
+// output the derived key once all rounds have been run, and zero the context
+cx_err_t pbkdf2_sha512_final(pbkdf2_sha512_t *ctx, uint8_t *out, size_t out_length);
+
+// init, run every round and final at once
+cx_err_t pbkdf2_sha512(const uint8_t *password,
+                       size_t password_length,
+                       const uint8_t *salt,
+                       size_t salt_length,
+                       uint32_t iterations,
+                       uint8_t *out,
+                       size_t out_length);
@@ -19,7 +19,144 @@
 #include <cx.h>
 
 #include "../common.h"
+#include "../bits11.h"
+#include "../wordlist.h"
 #include "./seed_rom_variables.h"
+#include "./pbkdf2_sha512.h"
+
+// the wordlist of the phrases, selected by bolos_ux_bip39_wordlist_set
+static unsigned int bip39_language = BIP39_LANGUAGE_ENGLISH;
+
+static const bip39_wordlist_t* bip39_wordlist(void) {
+    return (const bip39_wordlist_t*) PIC(&BIP39_WORDLISTS[bip39_language]);
+}
+
+unsigned int bolos_ux_bip39_wordlist_set(unsigned int language) {
+    if (language >= BIP39_LANGUAGE_COUNT) {
+        return false;
+    }
+    bip39_language = language;
+    return true;
+}
+
+unsigned int bolos_ux_bip39_wordlist_get(void) {
+    return bip39_language;
+}
+
+static const unsigned char* bip39_words(void) {
+    return (const unsigned char*) PIC(bip39_wordlist()->words);
+}
+
+// packed word of the wordlist, see seed_rom_variables.c for the layout
+static uint64_t bip39_packed_word_key(const unsigned char* words, unsigned int index) {
+    const unsigned char* entry = words + BIP39_WORDLIST_STRIDE * index;
+    uint64_t key = 0;
+    for (unsigned int i = 0; i < BIP39_WORDLIST_STRIDE; i++) {
+        key = (key << 8) | entry[i];
+    }
+    return key;
+}
+
+static uint64_t bip39_word_key(unsigned int index) {
+    return bip39_packed_word_key(bip39_words(), index);
+}
+
+// letter at the given position of a packed word, 0 past its end
+static unsigned char bip39_key_letter(uint64_t key, unsigned int position) {
+    const unsigned int code =
+        (key >> (BIP39_WORDLIST_LETTER_BITS * (BIP39_WORDLIST_WORD_LETTERS - 1 - position))) &
+        0x1F;
+    return code == 0 ? 0 : 'a' + code - 1;
+}
+
+static unsigned int bip39_word_length(unsigned int index) {
+    const uint64_t key = bip39_word_key(index);
+    unsigned int length = 0;
+    while (length < BIP39_WORDLIST_WORD_LETTERS && bip39_key_letter(key, length) != 0) {
+        length++;
+    }
+    return length;
+}
+
+// write the letters of the word, without the trailing '\0', return its length
+static unsigned int bip39_word_copy(unsigned int index, unsigned char* buffer) {
+    const uint64_t key = bip39_word_key(index);
+    unsigned int length = 0;
+    while (length < BIP39_WORDLIST_WORD_LETTERS && bip39_key_letter(key, length) != 0) {
+        buffer[length] = bip39_key_letter(key, length);
+        length++;
+    }
+    return length;
+}
+
+// position of the first combining mark of the word in the sorted marks of the wordlist
+static unsigned int bip39_word_first_mark(const unsigned int* marks,
+                                          unsigned int count,
+                                          unsigned int index) {
+    unsigned int first = 0;
+    while (first < count) {
+        const unsigned int middle = first + (count - first) / 2;
+        if (marks[middle] < BIP39_WORDLIST_MARK(index, 0, 0x300)) {
+            first = middle + 1;
+        } else {
+            count = middle;
+        }
+    }
+    return first;
+}
+
+// write the NFKD text of the word, each letter being followed by its combining marks (UTF-8),
+// return its length
+static unsigned int bip39_word_text(unsigned int index,
+                                    unsigned char buffer[BIP39_WORD_TEXT_MAX_LENGTH]) {
+    const bip39_wordlist_t* wordlist = bip39_wordlist();
+    const unsigned int* marks = (const unsigned int*) PIC(wordlist->marks);
+    const uint64_t key = bip39_word_key(index);
+    unsigned int m = bip39_word_first_mark(marks, wordlist->marks_count, index);
+    unsigned int length = 0;
+
+    for (unsigned int position = 0;
+         position < BIP39_WORDLIST_WORD_LETTERS && bip39_key_letter(key, position) != 0;
+         position++) {
+        buffer[length++] = bip39_key_letter(key, position);
+        while (m < wordlist->marks_count &&
+               (marks[m] >> 8) == (BIP39_WORDLIST_MARK(index, position, 0x300) >> 8) &&
+               length + 2 <= BIP39_WORD_TEXT_MAX_LENGTH) {
+            const unsigned int code = 0x300 + (marks[m] & 0xFF);
+            buffer[length++] = 0xC0 | (code >> 6);
+            buffer[length++] = 0x80 | (code & 0x3F);
+            m++;
+        }
+    }
+    return length;
+}
+
+// constant-time lookup of a zero-padded word: it is packed like the wordlist entries, which
+// are then compared as 40-bit integers, the matching index being selected without branching.
+// Returns BIP39_WORDLIST_COUNT if not found.
+static unsigned int bip39_word_lookup(const unsigned char word[BIP39_WORDLIST_WORD_LETTERS]) {
+    uint64_t key = 0;
+    uint64_t invalid = 0;
+    uint64_t found = BIP39_WORDLIST_COUNT;
+    const unsigned char* words = bip39_words();
+
+    for (unsigned int j = 0; j < BIP39_WORDLIST_WORD_LETTERS; j++) {
+        const unsigned int code = word[j] == 0 ? 0 : (unsigned int) (word[j] - 'a') + 1;
+        invalid |= code > 26;
+        key = (key << BIP39_WORDLIST_LETTER_BITS) | (code & 0x1F);
+    }
+    // out of the 40 bits of any entry, so that nothing matches
+    key |= invalid << (BIP39_WORDLIST_WORD_LETTERS * BIP39_WORDLIST_LETTER_BITS);
+
+    for (uint64_t k = 0; k < BIP39_WORDLIST_COUNT; k++) {
+        const uint64_t diff = bip39_packed_word_key(words, k) ^ key;
+        // all ones when diff is 0, else 0
+        const uint64_t match = ((diff | (0 - diff)) >> 63) - 1;
+        found = (found & ~match) | (k & match);
+    }
+    key = 0;
+    return (unsigned int) found;
+}
 
 // separated function to lower the stack usage when jumping into pbkdf algorithm
 unsigned int bolos_ux_bip39_mnemonic_to_seed_hash_length128(unsigned char* mnemonic,
@@ -32,6 +169,40 @@ unsigned int bolos_ux_bip39_mnemonic_to_seed_hash_length128(unsigned char* mnemo
     return mnemonic_length;
 }
 
+// the mnemonic buffer is used as scratch space (hashed in place when too long), it is no longer
+// needed once the PBKDF2 context is initialized
+static cx_err_t bip39_mnemonic_buffer_to_seed_start(pbkdf2_sha512_t* ctx,
+                                                    unsigned char* mnemonic,
+                                                    unsigned int mnemonic_length) {
+    unsigned char passphrase[BIP39_MNEMONIC_LENGTH + 4];
+    mnemonic_length = bolos_ux_bip39_mnemonic_to_seed_hash_length128(mnemonic, mnemonic_length);
+    memcpy(passphrase, BIP39_MNEMONIC, BIP39_MNEMONIC_LENGTH);
+    return pbkdf2_sha512_init(ctx,
+                              mnemonic,
+                              mnemonic_length,
+                              passphrase,
+                              BIP39_MNEMONIC_LENGTH,
+                              BIP39_PBKDF2_ROUNDS);
+}
+
+static void bip39_mnemonic_buffer_to_seed(unsigned char* mnemonic,
+                                          unsigned int mnemonic_length,
+                                          unsigned char* seed) {
+    pbkdf2_sha512_t ctx;
+    cx_err_t error = CX_OK;
+
+    CX_CHECK(bip39_mnemonic_buffer_to_seed_start(&ctx, mnemonic, mnemonic_length));
+    CX_CHECK(pbkdf2_sha512_step(&ctx, BIP39_PBKDF2_ROUNDS));
+    CX_CHECK(pbkdf2_sha512_final(&ctx, seed, 64));
+
+end:
+    memzero(&ctx, sizeof(ctx));
+    if (error != CX_OK) {
+        memzero(seed, 64);
+    }
+    PRINTF("BIP39 seed:\n %.*H\n", 64, seed);
+}
+
 void bolos_ux_bip39_mnemonic_to_seed(unsigned char* mnemonic,
                                      unsigned int mnemonic_length,
                                      unsigned char* seed) {
@@ -39,29 +210,240 @@ void bolos_ux_bip39_mnemonic_to_seed(unsigned char* mnemonic,
     // It will be zeroed later if not needed
     unsigned char mnemonic_hash[257];
     memcpy(mnemonic_hash, mnemonic, mnemonic_length);
-    unsigned char passphrase[BIP39_MNEMONIC_LENGTH + 4];
-    mnemonic_length =
-        bolos_ux_bip39_mnemonic_to_seed_hash_length128(mnemonic_hash, mnemonic_length);
-    memcpy(passphrase, BIP39_MNEMONIC, BIP39_MNEMONIC_LENGTH);
-    cx_pbkdf2_sha512(mnemonic_hash,
-                     mnemonic_length,
-                     passphrase,
-                     BIP39_MNEMONIC_LENGTH,
-                     BIP39_PBKDF2_ROUNDS,
-                     seed,
-                     64);
+    bip39_mnemonic_buffer_to_seed(mnemonic_hash, mnemonic_length, seed);
     memzero(mnemonic_hash, sizeof(mnemonic_hash));
-    PRINTF("BIP39 seed:\n %.*H\n", 64, seed);
+}
+
+cx_err_t bolos_ux_bip39_mnemonic_to_seed_start(pbkdf2_sha512_t* ctx,
+                                               const unsigned char* mnemonic,
+                                               unsigned int mnemonic_length) {
+    unsigned char mnemonic_hash[257];
+    cx_err_t error;
+
+    if (mnemonic_length > sizeof(mnemonic_hash)) {
+        return CX_INVALID_PARAMETER;
+    }
+    memcpy(mnemonic_hash, mnemonic, mnemonic_length);
+    error = bip39_mnemonic_buffer_to_seed_start(ctx, mnemonic_hash, mnemonic_length);
+    memzero(mnemonic_hash, sizeof(mnemonic_hash));
+    return error;
+}
+
+// checksum mask of the last entropy byte: one checksum bit every 3 words
+static unsigned char bip39_checksum_mask(unsigned int word_count) {
+    return (unsigned char) (0xFF << (8 - word_count / 3));
+}
+
+static bool bip39_word_count_valid(unsigned int word_count) {
+    return word_count >= 12 && word_count <= 24 && word_count % 3 == 0;
+}
+
+void bolos_ux_bip39_entropy_word_set(unsigned char* entropy,
+                                     unsigned int word_number,
+                                     unsigned int index) {
+    bits11_set(entropy, word_number, index);
+}
+
+unsigned int bolos_ux_bip39_entropy_word_get(const unsigned char* entropy,
+                                             unsigned int word_number) {
+    return bits11_get(entropy, word_number);
+}
+
+void bolos_ux_bip39_entropy_checksum_set(unsigned char* entropy, unsigned int word_count) {
+    unsigned char hash[32];
+    const unsigned char mask = bip39_checksum_mask(word_count);
+
+    cx_hash_sha256(entropy, word_count * 4 / 3, hash, 32);
+    entropy[word_count * 4 / 3] = (entropy[word_count * 4 / 3] & ~mask) | (hash[0] & mask);
+    memzero(hash, sizeof(hash));
+}
+
+unsigned int bolos_ux_bip39_entropy_check(const unsigned char* entropy, unsigned int word_count) {
+    unsigned char hash[32];
+    unsigned char mask;
+    unsigned int valid;
+
+    if (!bip39_word_count_valid(word_count)) {
+        return 0;
+    }
+    mask = bip39_checksum_mask(word_count);
+    cx_hash_sha256(entropy, word_count * 4 / 3, hash, 32);
+    valid = (hash[0] & mask) == (entropy[word_count * 4 / 3] & mask);
+    memzero(hash, sizeof(hash));
+    return valid;
+}
+
+unsigned int bolos_ux_bip39_final_word_candidate_count(unsigned int word_count) {
+    if (!bip39_word_count_valid(word_count)) {
+        return 0;
+    }
+    // the final word holds the last entropy bits followed by the checksum bits
+    return 1u << (11 - word_count / 3);
+}
+
+unsigned int bolos_ux_bip39_final_word_candidate(const unsigned char* entropy,
+                                                 unsigned int word_count,
+                                                 unsigned int n) {
+    unsigned char buffer[BIP39_ENTROPY_MAX_LENGTH] = {0};
+    unsigned int index;
+
+    memcpy(buffer, entropy, BITS11_LENGTH(word_count));
+    bits11_set(buffer, word_count - 1, n << (word_count / 3));
+    bolos_ux_bip39_entropy_checksum_set(buffer, word_count);
+    index = bits11_get(buffer, word_count - 1);
+    memzero(buffer, sizeof(buffer));
+    return index;
+}
+
+bool bolos_ux_bip39_words_near(unsigned int a, unsigned int b) {
+    unsigned char word_a[BIP39_WORDLIST_WORD_LETTERS];
+    unsigned char word_b[BIP39_WORDLIST_WORD_LETTERS];
+    unsigned int end_a, end_b, start = 0;
+
+    if (a == b || a >= BIP39_WORDLIST_COUNT || b >= BIP39_WORDLIST_COUNT) {
+        return false;
+    }
+    end_a = bip39_word_copy(a, word_a);
+    end_b = bip39_word_copy(b, word_b);
+
+    // the shortest BIP39 words have 3 letters
+    if (memcmp(word_a, word_b, 3) == 0) {
+        return true;
+    }
+    // one letter away if at most one letter of each is left once their common prefix and suffix
+    // are skipped
+    while (start < end_a && start < end_b && word_a[start] == word_b[start]) {
+        start++;
+    }
+    while (end_a > start && end_b > start && word_a[end_a - 1] == word_b[end_b - 1]) {
+        end_a--;
+        end_b--;
+    }
+    return end_a - start <= 1 && end_b - start <= 1;
+}
+
+unsigned int bolos_ux_bip39_entropy_to_mnemonic(const unsigned char* entropy,
+                                                unsigned int word_count,
+                                                unsigned char* out,
+                                                size_t out_len) {
+    uint16_t indexes[24];
+    unsigned int i, idx, word_len;
+    unsigned int offset = 0;
+
+    if (!bip39_word_count_valid(word_count)) {
+        return 0;
+    }
+    bits11_unpack(entropy, 0, indexes, word_count);
+    for (i = 0; i < word_count; i++) {
+        idx = indexes[i];
+        word_len = bip39_word_length(idx);
+        if ((offset + word_len) > out_len) {
+            memzero(indexes, sizeof(indexes));
+            memzero(out, out_len);
+            return 0;
+        }
+        offset += bip39_word_copy(idx, out + offset);
+        if (i < word_count - 1) {
+            if (offset >= out_len) {
+                memzero(indexes, sizeof(indexes));
+                memzero(out, out_len);
+                return 0;
+            }
+            out[offset++] = ' ';
+        }
+    }
+    memzero(indexes, sizeof(indexes));
+    return offset;
+}
+
+// PBKDF2 password of the phrase: its NFKD text when it fits the HMAC block, else the hash of the
+// text, which is then streamed a word at a time instead of being rebuilt whole on the stack. The
+// words are separated by spaces in every language, NFKD turning the ideographic space of the
+// Japanese phrases into one.
+static cx_err_t bip39_entropy_to_password(const unsigned char* entropy,
+                                          unsigned int word_count,
+                                          unsigned char password[PBKDF2_SHA512_BLOCK_LENGTH],
+                                          unsigned int* password_length) {
+    // a space followed by the word
+    unsigned char word[1 + BIP39_WORD_TEXT_MAX_LENGTH];
+    unsigned int i, word_length, length = 0;
+    cx_sha512_t hash;
+    cx_err_t error = CX_OK;
+
+    *password_length = 0;
+    if (!bip39_word_count_valid(word_count)) {
+        return CX_INVALID_PARAMETER;
+    }
+    for (i = 0; i < word_count; i++) {
+        length += bip39_word_text(bits11_get(entropy, i), word);
+    }
+    length += word_count - 1;
+    if (length > PBKDF2_SHA512_BLOCK_LENGTH) {
+        CX_CHECK(cx_sha512_init_no_throw(&hash));
+    }
+    for (i = 0; i < word_count; i++) {
+        word_length = 0;
+        if (i > 0) {
+            word[word_length++] = ' ';
+        }
+        word_length += bip39_word_text(bits11_get(entropy, i), word + word_length);
+        if (length > PBKDF2_SHA512_BLOCK_LENGTH) {
+            CX_CHECK(cx_hash_no_throw(&hash.header, 0, word, word_length, NULL, 0));
+        } else {
+            memcpy(password + *password_length, word, word_length);
+            *password_length += word_length;
+        }
+    }
+    if (length > PBKDF2_SHA512_BLOCK_LENGTH) {
+        CX_CHECK(cx_hash_no_throw(&hash.header, CX_LAST, NULL, 0, password, PBKDF2_SHA512_LENGTH));
+        *password_length = PBKDF2_SHA512_LENGTH;
+    }
+
+end:
+    memzero(word, sizeof(word));
+    memzero(&hash, sizeof(hash));
+    if (error != CX_OK) {
+        memzero(password, PBKDF2_SHA512_BLOCK_LENGTH);
+        *password_length = 0;
+    }
+    return error;
+}
+
+void bolos_ux_bip39_entropy_to_seed(const unsigned char* entropy,
+                                    unsigned int word_count,
+                                    unsigned char* seed) {
+    // PBKDF2 is the only consumer of the text form, which lives on the stack meanwhile
+    unsigned char password[PBKDF2_SHA512_BLOCK_LENGTH];
+    unsigned int password_length;
+
+    if (bip39_entropy_to_password(entropy, word_count, password, &password_length) != CX_OK) {
+        memzero(seed, 64);
+        return;
+    }
+    bip39_mnemonic_buffer_to_seed(password, password_length, seed);
+    memzero(password, sizeof(password));
+}
+
+cx_err_t bolos_ux_bip39_entropy_to_seed_start(pbkdf2_sha512_t* ctx,
+                                              const unsigned char* entropy,
+                                              unsigned int word_count) {
+    unsigned char password[PBKDF2_SHA512_BLOCK_LENGTH];
+    unsigned int password_length;
+    cx_err_t error = bip39_entropy_to_password(entropy, word_count, password, &password_length);
+
+    if (error == CX_OK) {
+        error = bip39_mnemonic_buffer_to_seed_start(ctx, password, password_length);
+    }
+    memzero(password, sizeof(password));
+    return error;
 }
 
 unsigned int bolos_ux_bip39_mnemonic_decode(unsigned char* mnemonic,
                                             unsigned int mnemonic_length,
                                             unsigned char* bits,
                                             unsigned int bitslength) {
+    uint16_t indexes[24];
     unsigned int i, n = 0;
-    unsigned int bi;
-    unsigned char buffer[32];
-    unsigned char mask;
 
     PRINTF("BIP39 mnemonic phrase:\n %.*s\n", mnemonic_length, mnemonic);
 
@@ -71,69 +453,41 @@ unsigned int bolos_ux_bip39_mnemonic_decode(unsigned char* mnemonic,
         }
     }
     n++;
-    if (n != 12 && n != 18 && n != 24) {
+    if ((n != 12 && n != 18 && n != 24) || bitslength < BITS11_LENGTH(n)) {
         return 0;
     }
     memzero(bits, bitslength);
     i = 0;
-    bi = 0;
+    n = 0;
     while (i < mnemonic_length) {
-        unsigned char current_word[10];
-        unsigned int current_word_size = 0;
-        unsigned int j, k, ki;
+        unsigned char current_word[BIP39_WORDLIST_WORD_LETTERS] = {0};
+        unsigned int j, k;
         j = 0;
         while (i < mnemonic_length && mnemonic[i] != ' ') {
             if (j >= sizeof(current_word)) {
-                memzero(bits, bitslength);
+                memzero(current_word, sizeof(current_word));
+                memzero(indexes, sizeof(indexes));
                 return 0;
             }
             current_word[j] = mnemonic[i];
-            current_word_size = j;
             i++;
             j++;
         }
         if (i < mnemonic_length) {
             i++;
         }
-        current_word_size++;
-        for (k = 0; k < BIP39_WORDLIST_OFFSETS_LENGTH - 1; k++) {
-            if ((os_secure_memcmp(current_word,
-                                  (void*) (BIP39_WORDLIST + BIP39_WORDLIST_OFFSETS[k]),
-                                  current_word_size) == 0) &&
-                ((unsigned int) (BIP39_WORDLIST_OFFSETS[k + 1] - BIP39_WORDLIST_OFFSETS[k]) ==
-                 current_word_size)) {
-                for (ki = 0; ki < 11; ki++) {
-                    if (k & (1 << (10 - ki))) {
-                        bits[bi / 8] |= 1 << (7 - (bi % 8));
-                    }
-                    bi++;
-                }
-                break;
-            }
-        }
-        if (k == (unsigned int) (BIP39_WORDLIST_OFFSETS_LENGTH - 1)) {
-            memzero(bits, bitslength);
+        k = bip39_word_lookup(current_word);
+        memzero(current_word, sizeof(current_word));
+        if (k == BIP39_WORDLIST_COUNT || n == 24) {
+            memzero(indexes, sizeof(indexes));
             return 0;
         }
+        indexes[n++] = k;
     }
-    if (bi != n * 11) {
-        memzero(bits, bitslength);
-        return 0;
-    }
+    bits11_pack(indexes, n, bits);
+    memzero(indexes, sizeof(indexes));
 
-    cx_hash_sha256(bits, n * 4 / 3, buffer, 32);
-    switch (n) {
-        case 12:
-            mask = 0xF0;
-            break;
-        case 18:
-            mask = 0xFC;
-            break;
-        default:
-            mask = 0xFF;
-            break;
-    }
-    if ((buffer[0] & mask) != (bits[n * 4 / 3] & mask)) {
+    if (!bolos_ux_bip39_entropy_check(bits, n)) {
         memzero(bits, bitslength);
         return 0;
     }
@@ -150,38 +504,12 @@ unsigned int bolos_ux_bip39_mnemonic_encode(const uint8_t* seed,
     if (seed_len % 4 || seed_len < 16 || seed_len > 32) {
         return 0;
     }
-    uint8_t bits[32 + 1];
-    cx_hash_sha256(seed, seed_len, bits, 32);
-
-    // checksum
-    bits[seed_len] = bits[0];
-    // data
+    uint8_t bits[BIP39_ENTROPY_MAX_LENGTH] = {0};
     memcpy(bits, seed, seed_len);
+    bolos_ux_bip39_entropy_checksum_set(bits, seed_len * 3 / 4);
 
-    unsigned int i, j, idx;
-    unsigned int offset = 0;
-    for (i = 0; i < (seed_len * 3 / 4); i++) {
-        uint8_t word_len;
-        idx = 0;
-        for (j = 0; j < 11; j++) {
-            idx <<= 1;
-            idx += (bits[(i * 11 + j) / 8] & (1 << (7 - ((i * 11 + j) % 8)))) != 0;
-        }
-        word_len = BIP39_WORDLIST_OFFSETS[idx + 1] - BIP39_WORDLIST_OFFSETS[idx];
-        if ((offset + word_len) > out_len) {
-            memzero(bits, sizeof(bits));
-            return 0;
-        }
-        memcpy(out + offset, BIP39_WORDLIST + BIP39_WORDLIST_OFFSETS[idx], word_len);
-        offset += word_len;
-        if (offset > out_len) {
-            memzero(bits, sizeof(bits));
-            return 0;
-        }
-        if (i < (seed_len * 3 / 4) - 1) {
-            out[offset++] = ' ';
-        }
-    }
+    unsigned int offset =
+        bolos_ux_bip39_entropy_to_mnemonic(bits, seed_len * 3 / 4, (unsigned char*) out, out_len);
     memzero(bits, sizeof(bits));
 
     PRINTF("BIP39 encoded mnemonic:\n %.*s\n", offset, out);
@@ -189,22 +517,21 @@ unsigned int bolos_ux_bip39_mnemonic_encode(const uint8_t* seed,
 }
 
 unsigned int bolos_ux_bip39_mnemonic_check(unsigned char* mnemonic, unsigned int mnemonic_length) {
-    unsigned char bits[32 + 1];
+    unsigned char bits[BIP39_ENTROPY_MAX_LENGTH];
 
-    if (bolos_ux_bip39_mnemonic_decode(mnemonic, mnemonic_length, bits, 32 + 1) != 1) {
-        memzero(bits, 32 + 1);
+    if (bolos_ux_bip39_mnemonic_decode(mnemonic, mnemonic_length, bits, sizeof(bits)) != 1) {
+        memzero(bits, sizeof(bits));
         return 0;
     }
-    memzero(bits, 32 + 1);
+    memzero(bits, sizeof(bits));
 
     // alright mnemonic is ok
     return 1;
 }
 
 unsigned int bolos_ux_bip39_idx_strcpy(unsigned int index, unsigned char* buffer) {
-    if (index < BIP39_WORDLIST_OFFSETS_LENGTH - 1 && buffer) {
-        size_t word_length = BIP39_WORDLIST_OFFSETS[index + 1] - BIP39_WORDLIST_OFFSETS[index];
-        memcpy(buffer, BIP39_WORDLIST + BIP39_WORDLIST_OFFSETS[index], word_length);
+    if (index < BIP39_WORDLIST_COUNT && buffer) {
+        size_t word_length = bip39_word_copy(index, buffer);
         buffer[word_length] = 0;  // EOS
         return word_length;
     }
@@ -213,83 +540,280 @@ unsigned int bolos_ux_bip39_idx_strcpy(unsigned int index, unsigned char* buffer
     return 0;
 }
 
-unsigned int bolos_ux_bip39_get_word_idx_starting_with(const unsigned char* prefix,
-                                                       const unsigned int prefixlength) {
-    unsigned int i;
-    for (i = 0; i < BIP39_WORDLIST_OFFSETS_LENGTH - 1; i++) {
-        unsigned int j = 0;
-        while (j < (unsigned int) (BIP39_WORDLIST_OFFSETS[i + 1] - BIP39_WORDLIST_OFFSETS[i]) &&
-               j < prefixlength && BIP39_WORDLIST[BIP39_WORDLIST_OFFSETS[i] + j] == prefix[j]) {
-            j++;
+#if defined(TARGET_NANOS)
+// no RAM left on Nano S for the checksum-valid final words: the whole wordlist is always offered
+void bolos_ux_bip39_final_word_filter_set(const unsigned char* entropy, unsigned int word_count) {
+    UNUSED(entropy);
+    UNUSED(word_count);
+}
+
+unsigned int bolos_ux_bip39_offered_word_idx(unsigned int position) {
+    return position;
+}
+
+static bool bip39_word_filter_active(void) {
+    return false;
+}
+
+static void bip39_offered_range(unsigned int* first, unsigned int* last) {
+    UNUSED(first);
+    UNUSED(last);
+}
+#else
+// when set, the words offered by the prefix helpers are restricted to the checksum-valid final
+// words: positions then index this sorted list instead of the wordlist
+static struct {
+    uint16_t words[BIP39_FINAL_WORD_MAX_CANDIDATES];
+    unsigned int count;
+} bip39_word_filter;
+
+void bolos_ux_bip39_final_word_filter_set(const unsigned char* entropy, unsigned int word_count) {
+    const unsigned int count = bolos_ux_bip39_final_word_candidate_count(word_count);
+
+    memzero(&bip39_word_filter, sizeof(bip39_word_filter));
+    for (unsigned int n = 0; n < count; n++) {
+        bip39_word_filter.words[n] = bolos_ux_bip39_final_word_candidate(entropy, word_count, n);
+    }
+    bip39_word_filter.count = count;
+}
+
+unsigned int bolos_ux_bip39_offered_word_idx(unsigned int position) {
+    if (bip39_word_filter.count == 0) {
+        return position;
+    }
+    return position < bip39_word_filter.count ? bip39_word_filter.words[position]
+                                              : BIP39_WORDLIST_COUNT;
+}
+
+static bool bip39_word_filter_active(void) {
+    return bip39_word_filter.count > 0;
+}
+
+// turn a range of word indexes into the range of positions of the offered words
+static void bip39_offered_range(unsigned int* first, unsigned int* last) {
+    unsigned int f = 0, l;
+
+    if (bip39_word_filter.count == 0) {
+        return;
+    }
+    while (f < bip39_word_filter.count && bip39_word_filter.words[f] < *first) {
+        f++;
+    }
+    l = f;
+    while (l < bip39_word_filter.count && bip39_word_filter.words[l] < *last) {
+        l++;
+    }
+    *first = f;
+    *last = l;
+}
+#endif
+
+// narrow a prefix lookup to the words sharing its first (two) letters, using the generated
+// prefix index of the wordlist. An empty range means nothing can match.
+static void bip39_get_prefix_bucket(const unsigned char* prefix,
+                                    const unsigned int prefixlength,
+                                    unsigned int* start,
+                                    unsigned int* end) {
+    const unsigned short* prefix_index =
+        (const unsigned short*) PIC(bip39_wordlist()->prefix_index);
+    unsigned int first, second;
+
+    *start = 0;
+    *end = BIP39_WORDLIST_COUNT;
+    if (prefixlength == 0) {
+        return;
+    }
+    first = (unsigned int) (prefix[0] - 'a');
+    if (first >= 26) {
+        *end = 0;
+        return;
+    }
+    if (prefixlength == 1) {
+        *start = prefix_index[first * 26];
+        *end = prefix_index[(first + 1) * 26];
+        return;
+    }
+    second = (unsigned int) (prefix[1] - 'a');
+    if (second >= 26) {
+        *end = 0;
+        return;
+    }
+    *start = prefix_index[first * 26 + second];
+    *end = prefix_index[first * 26 + second + 1];
+}
+
+static int bip39_compare_prefix(unsigned int index,
+                                const unsigned char* prefix,
+                                size_t prefix_length) {
+    const uint64_t key = bip39_word_key(index);
+    for (size_t j = 0; j < prefix_length; j++) {
+        if (j == BIP39_WORDLIST_WORD_LETTERS) {
+            return -1;
         }
-        if (j == prefixlength) {
-            return i;
+        // zero padding sorts before any letter
+        const unsigned char letter = bip39_key_letter(key, j);
+        if (letter != prefix[j]) {
+            return letter < prefix[j] ? -1 : 1;
         }
     }
+    return 0;
+}
+
+void bolos_ux_bip39_get_word_range_starting_with(const unsigned char* prefix,
+                                                 const unsigned int prefixlength,
+                                                 unsigned int* first,
+                                                 unsigned int* last) {
+    bip39_get_prefix_bucket(prefix, prefixlength, first, last);
+    if (prefixlength > 2) {
+        wordlist_prefix_range(bip39_compare_prefix, prefix, prefixlength, first, last);
+    }
+}
+
+// the near words of a word are enumerated without scanning the list: the ones of its stem are a
+// range of the list, and a letter replaced, added or removed past the stem keeps it, so that only
+// the edits of the stem letters are looked up
+#define BIP39_STEM_LENGTH 3
+#define BIP39_STEM_EDITS  ((BIP39_NEAR_WORD_SLOTS - BIP39_NEAR_WORD_STEM_SLOTS) / BIP39_STEM_LENGTH)
+
+unsigned int bolos_ux_bip39_near_word(unsigned int index, unsigned int n) {
+    unsigned char word[BIP39_WORDLIST_WORD_LETTERS + 1] = {0};
+    unsigned char edit[BIP39_WORDLIST_WORD_LETTERS + 2] = {0};
+    unsigned int length, edit_length, first, last;
+
+    if (index >= BIP39_WORDLIST_COUNT || n >= BIP39_NEAR_WORD_SLOTS) {
+        return BIP39_WORDLIST_COUNT;
+    }
+    length = bip39_word_copy(index, word);
+
+    if (n < BIP39_NEAR_WORD_STEM_SLOTS) {
+        bolos_ux_bip39_get_word_range_starting_with(word, BIP39_STEM_LENGTH, &first, &last);
+        return first + n < last && first + n != index ? first + n : BIP39_WORDLIST_COUNT;
+    }
+
+    // 26 replacements, 26 insertions and a removal at each letter of the stem, the edits giving
+    // the same word twice (a doubled letter) being skipped
+    n -= BIP39_NEAR_WORD_STEM_SLOTS;
+    const unsigned int position = n / BIP39_STEM_EDITS;
+    const unsigned int edit_kind = n % BIP39_STEM_EDITS;
+    const unsigned char letter = 'a' + edit_kind % 26;
+
+    memcpy(edit, word, position);
+    if (edit_kind < 26) {
+        if (letter == word[position]) {
+            return BIP39_WORDLIST_COUNT;
+        }
+        memcpy(edit + position, word + position, length - position);
+        edit[position] = letter;
+        edit_length = length;
+    } else if (edit_kind < 2 * 26) {
+        if (length == BIP39_WORDLIST_WORD_LETTERS ||
+            (position > 0 && letter == word[position - 1])) {
+            return BIP39_WORDLIST_COUNT;
+        }
+        edit[position] = letter;
+        memcpy(edit + position + 1, word + position, length - position);
+        edit_length = length + 1;
+    } else {
+        if (position > 0 && word[position] == word[position - 1]) {
+            return BIP39_WORDLIST_COUNT;
+        }
+        memcpy(edit + position, word + position + 1, length - position - 1);
+        edit_length = length - 1;
+    }
+    // the words of the stem are enumerated above
+    if (memcmp(edit, word, BIP39_STEM_LENGTH) == 0) {
+        return BIP39_WORDLIST_COUNT;
+    }
+    // the edit is a word if it is the first (shortest) one it starts
+    bolos_ux_bip39_get_word_range_starting_with(edit, edit_length, &first, &last);
+    if (first < last && bip39_word_length(first) == edit_length) {
+        return first;
+    }
+    return BIP39_WORDLIST_COUNT;
+}
+
+unsigned int bolos_ux_bip39_get_word_idx_starting_with(const unsigned char* prefix,
+                                                       const unsigned int prefixlength) {
+    unsigned int first, last;
+    bolos_ux_bip39_get_word_range_starting_with(prefix, prefixlength, &first, &last);
+    bip39_offered_range(&first, &last);
+    if (first < last) {
+        return first;
+    }
     // no match, sry
-    return BIP39_WORDLIST_OFFSETS_LENGTH;
+    return BIP39_WORDLIST_COUNT;
 }
 
 unsigned int bolos_ux_bip39_get_word_count_starting_with(const unsigned char* prefix,
                                                          const unsigned int prefixlength) {
-    unsigned int i;
-    unsigned int count = 0;
-    for (i = 0; i < BIP39_WORDLIST_OFFSETS_LENGTH - 1; i++) {
-        unsigned int j = 0;
-        while (j < (unsigned int) (BIP39_WORDLIST_OFFSETS[i + 1] - BIP39_WORDLIST_OFFSETS[i]) &&
-               j < prefixlength && BIP39_WORDLIST[BIP39_WORDLIST_OFFSETS[i] + j] == prefix[j]) {
-            j++;
-        }
-        if (j == prefixlength) {
-            count++;
+    unsigned int first, last;
+    bolos_ux_bip39_get_word_range_starting_with(prefix, prefixlength, &first, &last);
+    bip39_offered_range(&first, &last);
+    // return number of matched word starting with the given prefix
+    return last - first;
+}
+
+unsigned int bolos_ux_bip39_get_unique_word_idx_starting_with(const unsigned char* prefix,
+                                                              const unsigned int prefixlength) {
+    uint32_t next_letters;
+
+    if (bip39_word_filter_active()) {
+        return bolos_ux_bip39_get_word_count_starting_with(prefix, prefixlength) == 1
+                   ? bolos_ux_bip39_get_word_idx_starting_with(prefix, prefixlength)
+                   : BIP39_WORDLIST_COUNT;
+    }
+    // the trie only has nodes for the prefixes shared by several words, the walk stops at the
+    // 4th letter at most as it identifies a word
+    if (wordlist_trie_walk(PIC(bip39_wordlist()->trie), prefix, prefixlength, &next_letters) !=
+        WORDLIST_TRIE_SINGLE_WORD) {
+        return BIP39_WORDLIST_COUNT;
+    }
+    // at most one word left, which may not match the letters past the last node
+    return bolos_ux_bip39_get_word_idx_starting_with(prefix, prefixlength);
+}
+
+// mask of the letters which may follow the prefix ('a' is bit 0)
+static uint32_t bip39_get_word_next_letters_mask(const unsigned char* prefix,
+                                                 const unsigned int prefixlength) {
+    uint32_t next_letters = 0;
+
+    if (bip39_word_filter_active()) {
+        // few offered words: their letters are read directly
+        unsigned int first, last;
+        bolos_ux_bip39_get_word_range_starting_with(prefix, prefixlength, &first, &last);
+        bip39_offered_range(&first, &last);
+        for (unsigned int i = first; i < last; i++) {
+            const unsigned int index = bolos_ux_bip39_offered_word_idx(i);
+            if (prefixlength < bip39_word_length(index)) {
+                next_letters |= 1 << (bip39_key_letter(bip39_word_key(index), prefixlength) - 'a');
+            }
         }
-        // don't seek till the end, abort when the prefix is not matched anymore
-        else if (count > 0) {
-            break;
+        return next_letters;
+    }
+    switch (wordlist_trie_walk(PIC(bip39_wordlist()->trie), prefix, prefixlength, &next_letters)) {
+        case WORDLIST_TRIE_NODE:
+            return next_letters;
+        case WORDLIST_TRIE_SINGLE_WORD: {
+            // out of the trie, the single matching word gives the next letter
+            const unsigned int i = bolos_ux_bip39_get_word_idx_starting_with(prefix, prefixlength);
+            if (i < BIP39_WORDLIST_COUNT && prefixlength < bip39_word_length(i)) {
+                return 1 << (bip39_key_letter(bip39_word_key(i), prefixlength) - 'a');
+            }
+            return 0;
         }
+        default:
+            return 0;
     }
-    // return number of matched word starting with the given prefix
-    return count;
 }
 
 // allocate at most 26 letters for next possibilities
-// algorithm considers the bip39 words are alphabetically ordered in the wordlist
 unsigned int bolos_ux_bip39_get_word_next_letters_starting_with(
     const unsigned char* prefix,
     const unsigned int prefixlength,
     unsigned char* next_letters_buffer) {
-    unsigned int i;
-    unsigned int letter_count = 0;
-    for (i = 0; i < BIP39_WORDLIST_OFFSETS_LENGTH - 1; i++) {
-        unsigned int j = 0;
-        while (j < (unsigned int) (BIP39_WORDLIST_OFFSETS[i + 1] - BIP39_WORDLIST_OFFSETS[i]) &&
-               j < prefixlength && BIP39_WORDLIST[BIP39_WORDLIST_OFFSETS[i] + j] == prefix[j]) {
-            j++;
-        }
-        if (j == prefixlength) {
-            if (j < (unsigned int) (BIP39_WORDLIST_OFFSETS[i + 1] - BIP39_WORDLIST_OFFSETS[i])) {
-                // j is inc during previous loop, don't touch it
-                unsigned char next_letter = BIP39_WORDLIST[BIP39_WORDLIST_OFFSETS[i] + j];
-                // add the first next_letter inconditionnally
-                if (letter_count == 0) {
-                    next_letters_buffer[0] = next_letter;
-                    letter_count = 1;
-                }
-                // the next_letter is different
-                else if (next_letters_buffer[0] != next_letter) {
-                    next_letters_buffer++;
-                    next_letters_buffer[0] = next_letter;
-                    letter_count++;
-                }
-            }
-        }
-        // don't seek till the end, abort when the prefix is not matched anymore
-        else if (letter_count > 0) {
-            break;
-        }
-    }
-    // return number of matched word starting with the given prefix
-    return letter_count;
+    // return number of letters following the given prefix
+    return wordlist_letters_from_mask(bip39_get_word_next_letters_mask(prefix, prefixlength),
+                                      next_letters_buffer);
 }
 
 #if defined(HAVE_NBGL)
@@ -299,25 +823,17 @@ size_t bolos_ux_bip39_fill_with_candidates(const unsigned char* startingChars,
                                            const size_t startingCharsLength,
                                            char wordCandidatesBuffer[],
                                            const char* wordIndexorBuffer[]) {
-    PRINTF("Calculating nb of words starting with '%s' (size is '%d')\n",
-           startingChars,
-           startingCharsLength);
-    const size_t nbMatchingWords =
-        MIN(bolos_ux_bip39_get_word_count_starting_with(startingChars, startingCharsLength),
-            NB_MAX_SUGGESTION_BUTTONS);
-    PRINTF("'%d' words start with '%s'\n", nbMatchingWords, startingChars);
-    if (nbMatchingWords == 0) {
-        return 0;
-    }
-    size_t matchingWordIndex =
-        bolos_ux_bip39_get_word_idx_starting_with(startingChars, startingCharsLength);
+    unsigned int first, last;
+    bolos_ux_bip39_get_word_range_starting_with(startingChars, startingCharsLength, &first, &last);
+    bip39_offered_range(&first, &last);
+    const size_t nbMatchingWords = MIN(last - first, NB_MAX_SUGGESTION_BUTTONS);
+    PRINTF("'%d' words start with '%s'\n", last - first, startingChars);
+    // flash words are not NUL-terminated, copy them next to each other in the candidates buffer
     size_t offset = 0;
     for (size_t i = 0; i < nbMatchingWords; i++) {
         unsigned char* const wordDest = (unsigned char*) (&wordCandidatesBuffer[0] + offset);
-        const size_t wordSize = bolos_ux_bip39_idx_strcpy(matchingWordIndex, wordDest);
-        matchingWordIndex++;
-        *(wordDest + wordSize) = '\0';
-        offset += wordSize + 1;  // + trailing '\0' size
+        const unsigned int index = bolos_ux_bip39_offered_word_idx(first + i);
+        offset += bolos_ux_bip39_idx_strcpy(index, wordDest) + 1;  // + trailing '\0' size
         wordIndexorBuffer[i] = (char*) wordDest;
     }
     return nbMatchingWords;
@@ -325,20 +841,7 @@ size_t bolos_ux_bip39_fill_with_candidates(const unsigned char* startingChars,
 
 uint32_t bolos_ux_bip39_get_keyboard_mask(const unsigned char* prefix,
                                           const unsigned int prefixLength) {
-    uint32_t existing_mask = 1 << 28;  // Starting with the 'return' keypad activated
-    unsigned char next_letters[ALPHABET_LENGTH] = {0};
     PRINTF("Looking for letter candidates following '%s'\n", prefix);
-    const size_t nb_letters =
-        bolos_ux_bip39_get_word_next_letters_starting_with(prefix, prefixLength, next_letters);
-    next_letters[nb_letters] = '\0';
-    PRINTF("Next letters are in: %s\n", next_letters);
-    for (int i = 0; i < ALPHABET_LENGTH; i++) {
-        for (size_t j = 0; j < nb_letters; j++) {
-            if (KBD_LETTERS[i] == next_letters[j]) {
-                existing_mask += 1 << i;
-            }
-        }
-    }
-    return (-1 ^ existing_mask);
+    return wordlist_keyboard_mask(bip39_get_word_next_letters_mask(prefix, prefixLength));
 }
 #endif
@@ -15,753 +15,4659 @@
  *  limitations under the License.
  ********************************************************************************/
 
+#include <os.h>
+
+#include "./seed_rom_variables.h"
+
+// Generated by tools/wordlists/gen_wordlists.py: each word is packed in BIP39_WORDLIST_STRIDE
+// bytes, big-endian, 5 bits per letter: 'a' is 1, 'z' is 26 and the unused trailing letters are 0,
+// so that packed words sort as their text.
 unsigned char const BIP39_WORDLIST[] = {
-    'a', 'b', 'a', 'n', 'd', 'o', 'n', 'a', 'b', 'i', 'l', 'i', 't', 'y', 'a', 'b', 'l', 'e', 'a',
-    'b', 'o', 'u', 't', 'a', 'b', 'o', 'v', 'e', 'a', 'b', 's', 'e', 'n', 't', 'a', 'b', 's', 'o',
-    'r', 'b', 'a', 'b', 's', 't', 'r', 'a', 'c', 't', 'a', 'b', 's', 'u', 'r', 'd', 'a', 'b', 'u',
-    's', 'e', 'a', 'c', 'c', 'e', 's', 's', 'a', 'c', 'c', 'i', 'd', 'e', 'n', 't', 'a', 'c', 'c',
-    'o', 'u', 'n', 't', 'a', 'c', 'c', 'u', 's', 'e', 'a', 'c', 'h', 'i', 'e', 'v', 'e', 'a', 'c',
-    'i', 'd', 'a', 'c', 'o', 'u', 's', 't', 'i', 'c', 'a', 'c', 'q', 'u', 'i', 'r', 'e', 'a', 'c',
-    'r', 'o', 's', 's', 'a', 'c', 't', 'a', 'c', 't', 'i', 'o', 'n', 'a', 'c', 't', 'o', 'r', 'a',
-    'c', 't', 'r', 'e', 's', 's', 'a', 'c', 't', 'u', 'a', 'l', 'a', 'd', 'a', 'p', 't', 'a', 'd',
-    'd', 'a', 'd', 'd', 'i', 'c', 't', 'a', 'd', 'd', 'r', 'e', 's', 's', 'a', 'd', 'j', 'u', 's',
-    't', 'a', 'd', 'm', 'i', 't', 'a', 'd', 'u', 'l', 't', 'a', 'd', 'v', 'a', 'n', 'c', 'e', 'a',
-    'd', 'v', 'i', 'c', 'e', 'a', 'e', 'r', 'o', 'b', 'i', 'c', 'a', 'f', 'f', 'a', 'i', 'r', 'a',
-    'f', 'f', 'o', 'r', 'd', 'a', 'f', 'r', 'a', 'i', 'd', 'a', 'g', 'a', 'i', 'n', 'a', 'g', 'e',
-    'a', 'g', 'e', 'n', 't', 'a', 'g', 'r', 'e', 'e', 'a', 'h', 'e', 'a', 'd', 'a', 'i', 'm', 'a',
-    'i', 'r', 'a', 'i', 'r', 'p', 'o', 'r', 't', 'a', 'i', 's', 'l', 'e', 'a', 'l', 'a', 'r', 'm',
-    'a', 'l', 'b', 'u', 'm', 'a', 'l', 'c', 'o', 'h', 'o', 'l', 'a', 'l', 'e', 'r', 't', 'a', 'l',
-    'i', 'e', 'n', 'a', 'l', 'l', 'a', 'l', 'l', 'e', 'y', 'a', 'l', 'l', 'o', 'w', 'a', 'l', 'm',
-    'o', 's', 't', 'a', 'l', 'o', 'n', 'e', 'a', 'l', 'p', 'h', 'a', 'a', 'l', 'r', 'e', 'a', 'd',
-    'y', 'a', 'l', 's', 'o', 'a', 'l', 't', 'e', 'r', 'a', 'l', 'w', 'a', 'y', 's', 'a', 'm', 'a',
-    't', 'e', 'u', 'r', 'a', 'm', 'a', 'z', 'i', 'n', 'g', 'a', 'm', 'o', 'n', 'g', 'a', 'm', 'o',
-    'u', 'n', 't', 'a', 'm', 'u', 's', 'e', 'd', 'a', 'n', 'a', 'l', 'y', 's', 't', 'a', 'n', 'c',
-    'h', 'o', 'r', 'a', 'n', 'c', 'i', 'e', 'n', 't', 'a', 'n', 'g', 'e', 'r', 'a', 'n', 'g', 'l',
-    'e', 'a', 'n', 'g', 'r', 'y', 'a', 'n', 'i', 'm', 'a', 'l', 'a', 'n', 'k', 'l', 'e', 'a', 'n',
-    'n', 'o', 'u', 'n', 'c', 'e', 'a', 'n', 'n', 'u', 'a', 'l', 'a', 'n', 'o', 't', 'h', 'e', 'r',
-    'a', 'n', 's', 'w', 'e', 'r', 'a', 'n', 't', 'e', 'n', 'n', 'a', 'a', 'n', 't', 'i', 'q', 'u',
-    'e', 'a', 'n', 'x', 'i', 'e', 't', 'y', 'a', 'n', 'y', 'a', 'p', 'a', 'r', 't', 'a', 'p', 'o',
-    'l', 'o', 'g', 'y', 'a', 'p', 'p', 'e', 'a', 'r', 'a', 'p', 'p', 'l', 'e', 'a', 'p', 'p', 'r',
-    'o', 'v', 'e', 'a', 'p', 'r', 'i', 'l', 'a', 'r', 'c', 'h', 'a', 'r', 'c', 't', 'i', 'c', 'a',
-    'r', 'e', 'a', 'a', 'r', 'e', 'n', 'a', 'a', 'r', 'g', 'u', 'e', 'a', 'r', 'm', 'a', 'r', 'm',
-    'e', 'd', 'a', 'r', 'm', 'o', 'r', 'a', 'r', 'm', 'y', 'a', 'r', 'o', 'u', 'n', 'd', 'a', 'r',
-    'r', 'a', 'n', 'g', 'e', 'a', 'r', 'r', 'e', 's', 't', 'a', 'r', 'r', 'i', 'v', 'e', 'a', 'r',
-    'r', 'o', 'w', 'a', 'r', 't', 'a', 'r', 't', 'e', 'f', 'a', 'c', 't', 'a', 'r', 't', 'i', 's',
-    't', 'a', 'r', 't', 'w', 'o', 'r', 'k', 'a', 's', 'k', 'a', 's', 'p', 'e', 'c', 't', 'a', 's',
-    's', 'a', 'u', 'l', 't', 'a', 's', 's', 'e', 't', 'a', 's', 's', 'i', 's', 't', 'a', 's', 's',
-    'u', 'm', 'e', 'a', 's', 't', 'h', 'm', 'a', 'a', 't', 'h', 'l', 'e', 't', 'e', 'a', 't', 'o',
-    'm', 'a', 't', 't', 'a', 'c', 'k', 'a', 't', 't', 'e', 'n', 'd', 'a', 't', 't', 'i', 't', 'u',
-    'd', 'e', 'a', 't', 't', 'r', 'a', 'c', 't', 'a', 'u', 'c', 't', 'i', 'o', 'n', 'a', 'u', 'd',
-    'i', 't', 'a', 'u', 'g', 'u', 's', 't', 'a', 'u', 'n', 't', 'a', 'u', 't', 'h', 'o', 'r', 'a',
-    'u', 't', 'o', 'a', 'u', 't', 'u', 'm', 'n', 'a', 'v', 'e', 'r', 'a', 'g', 'e', 'a', 'v', 'o',
-    'c', 'a', 'd', 'o', 'a', 'v', 'o', 'i', 'd', 'a', 'w', 'a', 'k', 'e', 'a', 'w', 'a', 'r', 'e',
-    'a', 'w', 'a', 'y', 'a', 'w', 'e', 's', 'o', 'm', 'e', 'a', 'w', 'f', 'u', 'l', 'a', 'w', 'k',
-    'w', 'a', 'r', 'd', 'a', 'x', 'i', 's', 'b', 'a', 'b', 'y', 'b', 'a', 'c', 'h', 'e', 'l', 'o',
-    'r', 'b', 'a', 'c', 'o', 'n', 'b', 'a', 'd', 'g', 'e', 'b', 'a', 'g', 'b', 'a', 'l', 'a', 'n',
-    'c', 'e', 'b', 'a', 'l', 'c', 'o', 'n', 'y', 'b', 'a', 'l', 'l', 'b', 'a', 'm', 'b', 'o', 'o',
-    'b', 'a', 'n', 'a', 'n', 'a', 'b', 'a', 'n', 'n', 'e', 'r', 'b', 'a', 'r', 'b', 'a', 'r', 'e',
-    'l', 'y', 'b', 'a', 'r', 'g', 'a', 'i', 'n', 'b', 'a', 'r', 'r', 'e', 'l', 'b', 'a', 's', 'e',
-    'b', 'a', 's', 'i', 'c', 'b', 'a', 's', 'k', 'e', 't', 'b', 'a', 't', 't', 'l', 'e', 'b', 'e',
-    'a', 'c', 'h', 'b', 'e', 'a', 'n', 'b', 'e', 'a', 'u', 't', 'y', 'b', 'e', 'c', 'a', 'u', 's',
-    'e', 'b', 'e', 'c', 'o', 'm', 'e', 'b', 'e', 'e', 'f', 'b', 'e', 'f', 'o', 'r', 'e', 'b', 'e',
-    'g', 'i', 'n', 'b', 'e', 'h', 'a', 'v', 'e', 'b', 'e', 'h', 'i', 'n', 'd', 'b', 'e', 'l', 'i',
-    'e', 'v', 'e', 'b', 'e', 'l', 'o', 'w', 'b', 'e', 'l', 't', 'b', 'e', 'n', 'c', 'h', 'b', 'e',
-    'n', 'e', 'f', 'i', 't', 'b', 'e', 's', 't', 'b', 'e', 't', 'r', 'a', 'y', 'b', 'e', 't', 't',
-    'e', 'r', 'b', 'e', 't', 'w', 'e', 'e', 'n', 'b', 'e', 'y', 'o', 'n', 'd', 'b', 'i', 'c', 'y',
-    'c', 'l', 'e', 'b', 'i', 'd', 'b', 'i', 'k', 'e', 'b', 'i', 'n', 'd', 'b', 'i', 'o', 'l', 'o',
-    'g', 'y', 'b', 'i', 'r', 'd', 'b', 'i', 'r', 't', 'h', 'b', 'i', 't', 't', 'e', 'r', 'b', 'l',
-    'a', 'c', 'k', 'b', 'l', 'a', 'd', 'e', 'b', 'l', 'a', 'm', 'e', 'b', 'l', 'a', 'n', 'k', 'e',
-    't', 'b', 'l', 'a', 's', 't', 'b', 'l', 'e', 'a', 'k', 'b', 'l', 'e', 's', 's', 'b', 'l', 'i',
-    'n', 'd', 'b', 'l', 'o', 'o', 'd', 'b', 'l', 'o', 's', 's', 'o', 'm', 'b', 'l', 'o', 'u', 's',
-    'e', 'b', 'l', 'u', 'e', 'b', 'l', 'u', 'r', 'b', 'l', 'u', 's', 'h', 'b', 'o', 'a', 'r', 'd',
-    'b', 'o', 'a', 't', 'b', 'o', 'd', 'y', 'b', 'o', 'i', 'l', 'b', 'o', 'm', 'b', 'b', 'o', 'n',
-    'e', 'b', 'o', 'n', 'u', 's', 'b', 'o', 'o', 'k', 'b', 'o', 'o', 's', 't', 'b', 'o', 'r', 'd',
-    'e', 'r', 'b', 'o', 'r', 'i', 'n', 'g', 'b', 'o', 'r', 'r', 'o', 'w', 'b', 'o', 's', 's', 'b',
-    'o', 't', 't', 'o', 'm', 'b', 'o', 'u', 'n', 'c', 'e', 'b', 'o', 'x', 'b', 'o', 'y', 'b', 'r',
-    'a', 'c', 'k', 'e', 't', 'b', 'r', 'a', 'i', 'n', 'b', 'r', 'a', 'n', 'd', 'b', 'r', 'a', 's',
-    's', 'b', 'r', 'a', 'v', 'e', 'b', 'r', 'e', 'a', 'd', 'b', 'r', 'e', 'e', 'z', 'e', 'b', 'r',
-    'i', 'c', 'k', 'b', 'r', 'i', 'd', 'g', 'e', 'b', 'r', 'i', 'e', 'f', 'b', 'r', 'i', 'g', 'h',
-    't', 'b', 'r', 'i', 'n', 'g', 'b', 'r', 'i', 's', 'k', 'b', 'r', 'o', 'c', 'c', 'o', 'l', 'i',
-    'b', 'r', 'o', 'k', 'e', 'n', 'b', 'r', 'o', 'n', 'z', 'e', 'b', 'r', 'o', 'o', 'm', 'b', 'r',
-    'o', 't', 'h', 'e', 'r', 'b', 'r', 'o', 'w', 'n', 'b', 'r', 'u', 's', 'h', 'b', 'u', 'b', 'b',
-    'l', 'e', 'b', 'u', 'd', 'd', 'y', 'b', 'u', 'd', 'g', 'e', 't', 'b', 'u', 'f', 'f', 'a', 'l',
-    'o', 'b', 'u', 'i', 'l', 'd', 'b', 'u', 'l', 'b', 'b', 'u', 'l', 'k', 'b', 'u', 'l', 'l', 'e',
-    't', 'b', 'u', 'n', 'd', 'l', 'e', 'b', 'u', 'n', 'k', 'e', 'r', 'b', 'u', 'r', 'd', 'e', 'n',
-    'b', 'u', 'r', 'g', 'e', 'r', 'b', 'u', 'r', 's', 't', 'b', 'u', 's', 'b', 'u', 's', 'i', 'n',
-    'e', 's', 's', 'b', 'u', 's', 'y', 'b', 'u', 't', 't', 'e', 'r', 'b', 'u', 'y', 'e', 'r', 'b',
-    'u', 'z', 'z', 'c', 'a', 'b', 'b', 'a', 'g', 'e', 'c', 'a', 'b', 'i', 'n', 'c', 'a', 'b', 'l',
-    'e', 'c', 'a', 'c', 't', 'u', 's', 'c', 'a', 'g', 'e', 'c', 'a', 'k', 'e', 'c', 'a', 'l', 'l',
-    'c', 'a', 'l', 'm', 'c', 'a', 'm', 'e', 'r', 'a', 'c', 'a', 'm', 'p', 'c', 'a', 'n', 'c', 'a',
-    'n', 'a', 'l', 'c', 'a', 'n', 'c', 'e', 'l', 'c', 'a', 'n', 'd', 'y', 'c', 'a', 'n', 'n', 'o',
-    'n', 'c', 'a', 'n', 'o', 'e', 'c', 'a', 'n', 'v', 'a', 's', 'c', 'a', 'n', 'y', 'o', 'n', 'c',
-    'a', 'p', 'a', 'b', 'l', 'e', 'c', 'a', 'p', 'i', 't', 'a', 'l', 'c', 'a', 'p', 't', 'a', 'i',
-    'n', 'c', 'a', 'r', 'c', 'a', 'r', 'b', 'o', 'n', 'c', 'a', 'r', 'd', 'c', 'a', 'r', 'g', 'o',
-    'c', 'a', 'r', 'p', 'e', 't', 'c', 'a', 'r', 'r', 'y', 'c', 'a', 'r', 't', 'c', 'a', 's', 'e',
-    'c', 'a', 's', 'h', 'c', 'a', 's', 'i', 'n', 'o', 'c', 'a', 's', 't', 'l', 'e', 'c', 'a', 's',
-    'u', 'a', 'l', 'c', 'a', 't', 'c', 'a', 't', 'a', 'l', 'o', 'g', 'c', 'a', 't', 'c', 'h', 'c',
-    'a', 't', 'e', 'g', 'o', 'r', 'y', 'c', 'a', 't', 't', 'l', 'e', 'c', 'a', 'u', 'g', 'h', 't',
-    'c', 'a', 'u', 's', 'e', 'c', 'a', 'u', 't', 'i', 'o', 'n', 'c', 'a', 'v', 'e', 'c', 'e', 'i',
-    'l', 'i', 'n', 'g', 'c', 'e', 'l', 'e', 'r', 'y', 'c', 'e', 'm', 'e', 'n', 't', 'c', 'e', 'n',
-    's', 'u', 's', 'c', 'e', 'n', 't', 'u', 'r', 'y', 'c', 'e', 'r', 'e', 'a', 'l', 'c', 'e', 'r',
-    't', 'a', 'i', 'n', 'c', 'h', 'a', 'i', 'r', 'c', 'h', 'a', 'l', 'k', 'c', 'h', 'a', 'm', 'p',
-    'i', 'o', 'n', 'c', 'h', 'a', 'n', 'g', 'e', 'c', 'h', 'a', 'o', 's', 'c', 'h', 'a', 'p', 't',
-    'e', 'r', 'c', 'h', 'a', 'r', 'g', 'e', 'c', 'h', 'a', 's', 'e', 'c', 'h', 'a', 't', 'c', 'h',
-    'e', 'a', 'p', 'c', 'h', 'e', 'c', 'k', 'c', 'h', 'e', 'e', 's', 'e', 'c', 'h', 'e', 'f', 'c',
-    'h', 'e', 'r', 'r', 'y', 'c', 'h', 'e', 's', 't', 'c', 'h', 'i', 'c', 'k', 'e', 'n', 'c', 'h',
-    'i', 'e', 'f', 'c', 'h', 'i', 'l', 'd', 'c', 'h', 'i', 'm', 'n', 'e', 'y', 'c', 'h', 'o', 'i',
-    'c', 'e', 'c', 'h', 'o', 'o', 's', 'e', 'c', 'h', 'r', 'o', 'n', 'i', 'c', 'c', 'h', 'u', 'c',
-    'k', 'l', 'e', 'c', 'h', 'u', 'n', 'k', 'c', 'h', 'u', 'r', 'n', 'c', 'i', 'g', 'a', 'r', 'c',
-    'i', 'n', 'n', 'a', 'm', 'o', 'n', 'c', 'i', 'r', 'c', 'l', 'e', 'c', 'i', 't', 'i', 'z', 'e',
-    'n', 'c', 'i', 't', 'y', 'c', 'i', 'v', 'i', 'l', 'c', 'l', 'a', 'i', 'm', 'c', 'l', 'a', 'p',
-    'c', 'l', 'a', 'r', 'i', 'f', 'y', 'c', 'l', 'a', 'w', 'c', 'l', 'a', 'y', 'c', 'l', 'e', 'a',
-    'n', 'c', 'l', 'e', 'r', 'k', 'c', 'l', 'e', 'v', 'e', 'r', 'c', 'l', 'i', 'c', 'k', 'c', 'l',
-    'i', 'e', 'n', 't', 'c', 'l', 'i', 'f', 'f', 'c', 'l', 'i', 'm', 'b', 'c', 'l', 'i', 'n', 'i',
-    'c', 'c', 'l', 'i', 'p', 'c', 'l', 'o', 'c', 'k', 'c', 'l', 'o', 'g', 'c', 'l', 'o', 's', 'e',
-    'c', 'l', 'o', 't', 'h', 'c', 'l', 'o', 'u', 'd', 'c', 'l', 'o', 'w', 'n', 'c', 'l', 'u', 'b',
-    'c', 'l', 'u', 'm', 'p', 'c', 'l', 'u', 's', 't', 'e', 'r', 'c', 'l', 'u', 't', 'c', 'h', 'c',
-    'o', 'a', 'c', 'h', 'c', 'o', 'a', 's', 't', 'c', 'o', 'c', 'o', 'n', 'u', 't', 'c', 'o', 'd',
-    'e', 'c', 'o', 'f', 'f', 'e', 'e', 'c', 'o', 'i', 'l', 'c', 'o', 'i', 'n', 'c', 'o', 'l', 'l',
-    'e', 'c', 't', 'c', 'o', 'l', 'o', 'r', 'c', 'o', 'l', 'u', 'm', 'n', 'c', 'o', 'm', 'b', 'i',
-    'n', 'e', 'c', 'o', 'm', 'e', 'c', 'o', 'm', 'f', 'o', 'r', 't', 'c', 'o', 'm', 'i', 'c', 'c',
-    'o', 'm', 'm', 'o', 'n', 'c', 'o', 'm', 'p', 'a', 'n', 'y', 'c', 'o', 'n', 'c', 'e', 'r', 't',
-    'c', 'o', 'n', 'd', 'u', 'c', 't', 'c', 'o', 'n', 'f', 'i', 'r', 'm', 'c', 'o', 'n', 'g', 'r',
-    'e', 's', 's', 'c', 'o', 'n', 'n', 'e', 'c', 't', 'c', 'o', 'n', 's', 'i', 'd', 'e', 'r', 'c',
-    'o', 'n', 't', 'r', 'o', 'l', 'c', 'o', 'n', 'v', 'i', 'n', 'c', 'e', 'c', 'o', 'o', 'k', 'c',
-    'o', 'o', 'l', 'c', 'o', 'p', 'p', 'e', 'r', 'c', 'o', 'p', 'y', 'c', 'o', 'r', 'a', 'l', 'c',
-    'o', 'r', 'e', 'c', 'o', 'r', 'n', 'c', 'o', 'r', 'r', 'e', 'c', 't', 'c', 'o', 's', 't', 'c',
-    'o', 't', 't', 'o', 'n', 'c', 'o', 'u', 'c', 'h', 'c', 'o', 'u', 'n', 't', 'r', 'y', 'c', 'o',
-    'u', 'p', 'l', 'e', 'c', 'o', 'u', 'r', 's', 'e', 'c', 'o', 'u', 's', 'i', 'n', 'c', 'o', 'v',
-    'e', 'r', 'c', 'o', 'y', 'o', 't', 'e', 'c', 'r', 'a', 'c', 'k', 'c', 'r', 'a', 'd', 'l', 'e',
-    'c', 'r', 'a', 'f', 't', 'c', 'r', 'a', 'm', 'c', 'r', 'a', 'n', 'e', 'c', 'r', 'a', 's', 'h',
-    'c', 'r', 'a', 't', 'e', 'r', 'c', 'r', 'a', 'w', 'l', 'c', 'r', 'a', 'z', 'y', 'c', 'r', 'e',
-    'a', 'm', 'c', 'r', 'e', 'd', 'i', 't', 'c', 'r', 'e', 'e', 'k', 'c', 'r', 'e', 'w', 'c', 'r',
-    'i', 'c', 'k', 'e', 't', 'c', 'r', 'i', 'm', 'e', 'c', 'r', 'i', 's', 'p', 'c', 'r', 'i', 't',
-    'i', 'c', 'c', 'r', 'o', 'p', 'c', 'r', 'o', 's', 's', 'c', 'r', 'o', 'u', 'c', 'h', 'c', 'r',
-    'o', 'w', 'd', 'c', 'r', 'u', 'c', 'i', 'a', 'l', 'c', 'r', 'u', 'e', 'l', 'c', 'r', 'u', 'i',
-    's', 'e', 'c', 'r', 'u', 'm', 'b', 'l', 'e', 'c', 'r', 'u', 'n', 'c', 'h', 'c', 'r', 'u', 's',
-    'h', 'c', 'r', 'y', 'c', 'r', 'y', 's', 't', 'a', 'l', 'c', 'u', 'b', 'e', 'c', 'u', 'l', 't',
-    'u', 'r', 'e', 'c', 'u', 'p', 'c', 'u', 'p', 'b', 'o', 'a', 'r', 'd', 'c', 'u', 'r', 'i', 'o',
-    'u', 's', 'c', 'u', 'r', 'r', 'e', 'n', 't', 'c', 'u', 'r', 't', 'a', 'i', 'n', 'c', 'u', 'r',
-    'v', 'e', 'c', 'u', 's', 'h', 'i', 'o', 'n', 'c', 'u', 's', 't', 'o', 'm', 'c', 'u', 't', 'e',
-    'c', 'y', 'c', 'l', 'e', 'd', 'a', 'd', 'd', 'a', 'm', 'a', 'g', 'e', 'd', 'a', 'm', 'p', 'd',
-    'a', 'n', 'c', 'e', 'd', 'a', 'n', 'g', 'e', 'r', 'd', 'a', 'r', 'i', 'n', 'g', 'd', 'a', 's',
-    'h', 'd', 'a', 'u', 'g', 'h', 't', 'e', 'r', 'd', 'a', 'w', 'n', 'd', 'a', 'y', 'd', 'e', 'a',
-    'l', 'd', 'e', 'b', 'a', 't', 'e', 'd', 'e', 'b', 'r', 'i', 's', 'd', 'e', 'c', 'a', 'd', 'e',
-    'd', 'e', 'c', 'e', 'm', 'b', 'e', 'r', 'd', 'e', 'c', 'i', 'd', 'e', 'd', 'e', 'c', 'l', 'i',
-    'n', 'e', 'd', 'e', 'c', 'o', 'r', 'a', 't', 'e', 'd', 'e', 'c', 'r', 'e', 'a', 's', 'e', 'd',
-    'e', 'e', 'r', 'd', 'e', 'f', 'e', 'n', 's', 'e', 'd', 'e', 'f', 'i', 'n', 'e', 'd', 'e', 'f',
-    'y', 'd', 'e', 'g', 'r', 'e', 'e', 'd', 'e', 'l', 'a', 'y', 'd', 'e', 'l', 'i', 'v', 'e', 'r',
-    'd', 'e', 'm', 'a', 'n', 'd', 'd', 'e', 'm', 'i', 's', 'e', 'd', 'e', 'n', 'i', 'a', 'l', 'd',
-    'e', 'n', 't', 'i', 's', 't', 'd', 'e', 'n', 'y', 'd', 'e', 'p', 'a', 'r', 't', 'd', 'e', 'p',
-    'e', 'n', 'd', 'd', 'e', 'p', 'o', 's', 'i', 't', 'd', 'e', 'p', 't', 'h', 'd', 'e', 'p', 'u',
-    't', 'y', 'd', 'e', 'r', 'i', 'v', 'e', 'd', 'e', 's', 'c', 'r', 'i', 'b', 'e', 'd', 'e', 's',
-    'e', 'r', 't', 'd', 'e', 's', 'i', 'g', 'n', 'd', 'e', 's', 'k', 'd', 'e', 's', 'p', 'a', 'i',
-    'r', 'd', 'e', 's', 't', 'r', 'o', 'y', 'd', 'e', 't', 'a', 'i', 'l', 'd', 'e', 't', 'e', 'c',
-    't', 'd', 'e', 'v', 'e', 'l', 'o', 'p', 'd', 'e', 'v', 'i', 'c', 'e', 'd', 'e', 'v', 'o', 't',
-    'e', 'd', 'i', 'a', 'g', 'r', 'a', 'm', 'd', 'i', 'a', 'l', 'd', 'i', 'a', 'm', 'o', 'n', 'd',
-    'd', 'i', 'a', 'r', 'y', 'd', 'i', 'c', 'e', 'd', 'i', 'e', 's', 'e', 'l', 'd', 'i', 'e', 't',
-    'd', 'i', 'f', 'f', 'e', 'r', 'd', 'i', 'g', 'i', 't', 'a', 'l', 'd', 'i', 'g', 'n', 'i', 't',
-    'y', 'd', 'i', 'l', 'e', 'm', 'm', 'a', 'd', 'i', 'n', 'n', 'e', 'r', 'd', 'i', 'n', 'o', 's',
-    'a', 'u', 'r', 'd', 'i', 'r', 'e', 'c', 't', 'd', 'i', 'r', 't', 'd', 'i', 's', 'a', 'g', 'r',
-    'e', 'e', 'd', 'i', 's', 'c', 'o', 'v', 'e', 'r', 'd', 'i', 's', 'e', 'a', 's', 'e', 'd', 'i',
-    's', 'h', 'd', 'i', 's', 'm', 'i', 's', 's', 'd', 'i', 's', 'o', 'r', 'd', 'e', 'r', 'd', 'i',
-    's', 'p', 'l', 'a', 'y', 'd', 'i', 's', 't', 'a', 'n', 'c', 'e', 'd', 'i', 'v', 'e', 'r', 't',
-    'd', 'i', 'v', 'i', 'd', 'e', 'd', 'i', 'v', 'o', 'r', 'c', 'e', 'd', 'i', 'z', 'z', 'y', 'd',
-    'o', 'c', 't', 'o', 'r', 'd', 'o', 'c', 'u', 'm', 'e', 'n', 't', 'd', 'o', 'g', 'd', 'o', 'l',
-    'l', 'd', 'o', 'l', 'p', 'h', 'i', 'n', 'd', 'o', 'm', 'a', 'i', 'n', 'd', 'o', 'n', 'a', 't',
-    'e', 'd', 'o', 'n', 'k', 'e', 'y', 'd', 'o', 'n', 'o', 'r', 'd', 'o', 'o', 'r', 'd', 'o', 's',
-    'e', 'd', 'o', 'u', 'b', 'l', 'e', 'd', 'o', 'v', 'e', 'd', 'r', 'a', 'f', 't', 'd', 'r', 'a',
-    'g', 'o', 'n', 'd', 'r', 'a', 'm', 'a', 'd', 'r', 'a', 's', 't', 'i', 'c', 'd', 'r', 'a', 'w',
-    'd', 'r', 'e', 'a', 'm', 'd', 'r', 'e', 's', 's', 'd', 'r', 'i', 'f', 't', 'd', 'r', 'i', 'l',
-    'l', 'd', 'r', 'i', 'n', 'k', 'd', 'r', 'i', 'p', 'd', 'r', 'i', 'v', 'e', 'd', 'r', 'o', 'p',
-    'd', 'r', 'u', 'm', 'd', 'r', 'y', 'd', 'u', 'c', 'k', 'd', 'u', 'm', 'b', 'd', 'u', 'n', 'e',
-    'd', 'u', 'r', 'i', 'n', 'g', 'd', 'u', 's', 't', 'd', 'u', 't', 'c', 'h', 'd', 'u', 't', 'y',
-    'd', 'w', 'a', 'r', 'f', 'd', 'y', 'n', 'a', 'm', 'i', 'c', 'e', 'a', 'g', 'e', 'r', 'e', 'a',
-    'g', 'l', 'e', 'e', 'a', 'r', 'l', 'y', 'e', 'a', 'r', 'n', 'e', 'a', 'r', 't', 'h', 'e', 'a',
-    's', 'i', 'l', 'y', 'e', 'a', 's', 't', 'e', 'a', 's', 'y', 'e', 'c', 'h', 'o', 'e', 'c', 'o',
-    'l', 'o', 'g', 'y', 'e', 'c', 'o', 'n', 'o', 'm', 'y', 'e', 'd', 'g', 'e', 'e', 'd', 'i', 't',
-    'e', 'd', 'u', 'c', 'a', 't', 'e', 'e', 'f', 'f', 'o', 'r', 't', 'e', 'g', 'g', 'e', 'i', 'g',
-    'h', 't', 'e', 'i', 't', 'h', 'e', 'r', 'e', 'l', 'b', 'o', 'w', 'e', 'l', 'd', 'e', 'r', 'e',
-    'l', 'e', 'c', 't', 'r', 'i', 'c', 'e', 'l', 'e', 'g', 'a', 'n', 't', 'e', 'l', 'e', 'm', 'e',
-    'n', 't', 'e', 'l', 'e', 'p', 'h', 'a', 'n', 't', 'e', 'l', 'e', 'v', 'a', 't', 'o', 'r', 'e',
-    'l', 'i', 't', 'e', 'e', 'l', 's', 'e', 'e', 'm', 'b', 'a', 'r', 'k', 'e', 'm', 'b', 'o', 'd',
-    'y', 'e', 'm', 'b', 'r', 'a', 'c', 'e', 'e', 'm', 'e', 'r', 'g', 'e', 'e', 'm', 'o', 't', 'i',
-    'o', 'n', 'e', 'm', 'p', 'l', 'o', 'y', 'e', 'm', 'p', 'o', 'w', 'e', 'r', 'e', 'm', 'p', 't',
-    'y', 'e', 'n', 'a', 'b', 'l', 'e', 'e', 'n', 'a', 'c', 't', 'e', 'n', 'd', 'e', 'n', 'd', 'l',
-    'e', 's', 's', 'e', 'n', 'd', 'o', 'r', 's', 'e', 'e', 'n', 'e', 'm', 'y', 'e', 'n', 'e', 'r',
-    'g', 'y', 'e', 'n', 'f', 'o', 'r', 'c', 'e', 'e', 'n', 'g', 'a', 'g', 'e', 'e', 'n', 'g', 'i',
-    'n', 'e', 'e', 'n', 'h', 'a', 'n', 'c', 'e', 'e', 'n', 'j', 'o', 'y', 'e', 'n', 'l', 'i', 's',
-    't', 'e', 'n', 'o', 'u', 'g', 'h', 'e', 'n', 'r', 'i', 'c', 'h', 'e', 'n', 'r', 'o', 'l', 'l',
-    'e', 'n', 's', 'u', 'r', 'e', 'e', 'n', 't', 'e', 'r', 'e', 'n', 't', 'i', 'r', 'e', 'e', 'n',
-    't', 'r', 'y', 'e', 'n', 'v', 'e', 'l', 'o', 'p', 'e', 'e', 'p', 'i', 's', 'o', 'd', 'e', 'e',
-    'q', 'u', 'a', 'l', 'e', 'q', 'u', 'i', 'p', 'e', 'r', 'a', 'e', 'r', 'a', 's', 'e', 'e', 'r',
-    'o', 'd', 'e', 'e', 'r', 'o', 's', 'i', 'o', 'n', 'e', 'r', 'r', 'o', 'r', 'e', 'r', 'u', 'p',
-    't', 'e', 's', 'c', 'a', 'p', 'e', 'e', 's', 's', 'a', 'y', 'e', 's', 's', 'e', 'n', 'c', 'e',
-    'e', 's', 't', 'a', 't', 'e', 'e', 't', 'e', 'r', 'n', 'a', 'l', 'e', 't', 'h', 'i', 'c', 's',
-    'e', 'v', 'i', 'd', 'e', 'n', 'c', 'e', 'e', 'v', 'i', 'l', 'e', 'v', 'o', 'k', 'e', 'e', 'v',
-    'o', 'l', 'v', 'e', 'e', 'x', 'a', 'c', 't', 'e', 'x', 'a', 'm', 'p', 'l', 'e', 'e', 'x', 'c',
-    'e', 's', 's', 'e', 'x', 'c', 'h', 'a', 'n', 'g', 'e', 'e', 'x', 'c', 'i', 't', 'e', 'e', 'x',
-    'c', 'l', 'u', 'd', 'e', 'e', 'x', 'c', 'u', 's', 'e', 'e', 'x', 'e', 'c', 'u', 't', 'e', 'e',
-    'x', 'e', 'r', 'c', 'i', 's', 'e', 'e', 'x', 'h', 'a', 'u', 's', 't', 'e', 'x', 'h', 'i', 'b',
-    'i', 't', 'e', 'x', 'i', 'l', 'e', 'e', 'x', 'i', 's', 't', 'e', 'x', 'i', 't', 'e', 'x', 'o',
-    't', 'i', 'c', 'e', 'x', 'p', 'a', 'n', 'd', 'e', 'x', 'p', 'e', 'c', 't', 'e', 'x', 'p', 'i',
-    'r', 'e', 'e', 'x', 'p', 'l', 'a', 'i', 'n', 'e', 'x', 'p', 'o', 's', 'e', 'e', 'x', 'p', 'r',
-    'e', 's', 's', 'e', 'x', 't', 'e', 'n', 'd', 'e', 'x', 't', 'r', 'a', 'e', 'y', 'e', 'e', 'y',
-    'e', 'b', 'r', 'o', 'w', 'f', 'a', 'b', 'r', 'i', 'c', 'f', 'a', 'c', 'e', 'f', 'a', 'c', 'u',
-    'l', 't', 'y', 'f', 'a', 'd', 'e', 'f', 'a', 'i', 'n', 't', 'f', 'a', 'i', 't', 'h', 'f', 'a',
-    'l', 'l', 'f', 'a', 'l', 's', 'e', 'f', 'a', 'm', 'e', 'f', 'a', 'm', 'i', 'l', 'y', 'f', 'a',
-    'm', 'o', 'u', 's', 'f', 'a', 'n', 'f', 'a', 'n', 'c', 'y', 'f', 'a', 'n', 't', 'a', 's', 'y',
-    'f', 'a', 'r', 'm', 'f', 'a', 's', 'h', 'i', 'o', 'n', 'f', 'a', 't', 'f', 'a', 't', 'a', 'l',
-    'f', 'a', 't', 'h', 'e', 'r', 'f', 'a', 't', 'i', 'g', 'u', 'e', 'f', 'a', 'u', 'l', 't', 'f',
-    'a', 'v', 'o', 'r', 'i', 't', 'e', 'f', 'e', 'a', 't', 'u', 'r', 'e', 'f', 'e', 'b', 'r', 'u',
-    'a', 'r', 'y', 'f', 'e', 'd', 'e', 'r', 'a', 'l', 'f', 'e', 'e', 'f', 'e', 'e', 'd', 'f', 'e',
-    'e', 'l', 'f', 'e', 'm', 'a', 'l', 'e', 'f', 'e', 'n', 'c', 'e', 'f', 'e', 's', 't', 'i', 'v',
-    'a', 'l', 'f', 'e', 't', 'c', 'h', 'f', 'e', 'v', 'e', 'r', 'f', 'e', 'w', 'f', 'i', 'b', 'e',
-    'r', 'f', 'i', 'c', 't', 'i', 'o', 'n', 'f', 'i', 'e', 'l', 'd', 'f', 'i', 'g', 'u', 'r', 'e',
-    'f', 'i', 'l', 'e', 'f', 'i', 'l', 'm', 'f', 'i', 'l', 't', 'e', 'r', 'f', 'i', 'n', 'a', 'l',
-    'f', 'i', 'n', 'd', 'f', 'i', 'n', 'e', 'f', 'i', 'n', 'g', 'e', 'r', 'f', 'i', 'n', 'i', 's',
-    'h', 'f', 'i', 'r', 'e', 'f', 'i', 'r', 'm', 'f', 'i', 'r', 's', 't', 'f', 'i', 's', 'c', 'a',
-    'l', 'f', 'i', 's', 'h', 'f', 'i', 't', 'f', 'i', 't', 'n', 'e', 's', 's', 'f', 'i', 'x', 'f',
-    'l', 'a', 'g', 'f', 'l', 'a', 'm', 'e', 'f', 'l', 'a', 's', 'h', 'f', 'l', 'a', 't', 'f', 'l',
-    'a', 'v', 'o', 'r', 'f', 'l', 'e', 'e', 'f', 'l', 'i', 'g', 'h', 't', 'f', 'l', 'i', 'p', 'f',
-    'l', 'o', 'a', 't', 'f', 'l', 'o', 'c', 'k', 'f', 'l', 'o', 'o', 'r', 'f', 'l', 'o', 'w', 'e',
-    'r', 'f', 'l', 'u', 'i', 'd', 'f', 'l', 'u', 's', 'h', 'f', 'l', 'y', 'f', 'o', 'a', 'm', 'f',
-    'o', 'c', 'u', 's', 'f', 'o', 'g', 'f', 'o', 'i', 'l', 'f', 'o', 'l', 'd', 'f', 'o', 'l', 'l',
-    'o', 'w', 'f', 'o', 'o', 'd', 'f', 'o', 'o', 't', 'f', 'o', 'r', 'c', 'e', 'f', 'o', 'r', 'e',
-    's', 't', 'f', 'o', 'r', 'g', 'e', 't', 'f', 'o', 'r', 'k', 'f', 'o', 'r', 't', 'u', 'n', 'e',
-    'f', 'o', 'r', 'u', 'm', 'f', 'o', 'r', 'w', 'a', 'r', 'd', 'f', 'o', 's', 's', 'i', 'l', 'f',
-    'o', 's', 't', 'e', 'r', 'f', 'o', 'u', 'n', 'd', 'f', 'o', 'x', 'f', 'r', 'a', 'g', 'i', 'l',
-    'e', 'f', 'r', 'a', 'm', 'e', 'f', 'r', 'e', 'q', 'u', 'e', 'n', 't', 'f', 'r', 'e', 's', 'h',
-    'f', 'r', 'i', 'e', 'n', 'd', 'f', 'r', 'i', 'n', 'g', 'e', 'f', 'r', 'o', 'g', 'f', 'r', 'o',
-    'n', 't', 'f', 'r', 'o', 's', 't', 'f', 'r', 'o', 'w', 'n', 'f', 'r', 'o', 'z', 'e', 'n', 'f',
-    'r', 'u', 'i', 't', 'f', 'u', 'e', 'l', 'f', 'u', 'n', 'f', 'u', 'n', 'n', 'y', 'f', 'u', 'r',
-    'n', 'a', 'c', 'e', 'f', 'u', 'r', 'y', 'f', 'u', 't', 'u', 'r', 'e', 'g', 'a', 'd', 'g', 'e',
-    't', 'g', 'a', 'i', 'n', 'g', 'a', 'l', 'a', 'x', 'y', 'g', 'a', 'l', 'l', 'e', 'r', 'y', 'g',
-    'a', 'm', 'e', 'g', 'a', 'p', 'g', 'a', 'r', 'a', 'g', 'e', 'g', 'a', 'r', 'b', 'a', 'g', 'e',
-    'g', 'a', 'r', 'd', 'e', 'n', 'g', 'a', 'r', 'l', 'i', 'c', 'g', 'a', 'r', 'm', 'e', 'n', 't',
-    'g', 'a', 's', 'g', 'a', 's', 'p', 'g', 'a', 't', 'e', 'g', 'a', 't', 'h', 'e', 'r', 'g', 'a',
-    'u', 'g', 'e', 'g', 'a', 'z', 'e', 'g', 'e', 'n', 'e', 'r', 'a', 'l', 'g', 'e', 'n', 'i', 'u',
-    's', 'g', 'e', 'n', 'r', 'e', 'g', 'e', 'n', 't', 'l', 'e', 'g', 'e', 'n', 'u', 'i', 'n', 'e',
-    'g', 'e', 's', 't', 'u', 'r', 'e', 'g', 'h', 'o', 's', 't', 'g', 'i', 'a', 'n', 't', 'g', 'i',
-    'f', 't', 'g', 'i', 'g', 'g', 'l', 'e', 'g', 'i', 'n', 'g', 'e', 'r', 'g', 'i', 'r', 'a', 'f',
-    'f', 'e', 'g', 'i', 'r', 'l', 'g', 'i', 'v', 'e', 'g', 'l', 'a', 'd', 'g', 'l', 'a', 'n', 'c',
-    'e', 'g', 'l', 'a', 'r', 'e', 'g', 'l', 'a', 's', 's', 'g', 'l', 'i', 'd', 'e', 'g', 'l', 'i',
-    'm', 'p', 's', 'e', 'g', 'l', 'o', 'b', 'e', 'g', 'l', 'o', 'o', 'm', 'g', 'l', 'o', 'r', 'y',
-    'g', 'l', 'o', 'v', 'e', 'g', 'l', 'o', 'w', 'g', 'l', 'u', 'e', 'g', 'o', 'a', 't', 'g', 'o',
-    'd', 'd', 'e', 's', 's', 'g', 'o', 'l', 'd', 'g', 'o', 'o', 'd', 'g', 'o', 'o', 's', 'e', 'g',
-    'o', 'r', 'i', 'l', 'l', 'a', 'g', 'o', 's', 'p', 'e', 'l', 'g', 'o', 's', 's', 'i', 'p', 'g',
-    'o', 'v', 'e', 'r', 'n', 'g', 'o', 'w', 'n', 'g', 'r', 'a', 'b', 'g', 'r', 'a', 'c', 'e', 'g',
-    'r', 'a', 'i', 'n', 'g', 'r', 'a', 'n', 't', 'g', 'r', 'a', 'p', 'e', 'g', 'r', 'a', 's', 's',
-    'g', 'r', 'a', 'v', 'i', 't', 'y', 'g', 'r', 'e', 'a', 't', 'g', 'r', 'e', 'e', 'n', 'g', 'r',
-    'i', 'd', 'g', 'r', 'i', 'e', 'f', 'g', 'r', 'i', 't', 'g', 'r', 'o', 'c', 'e', 'r', 'y', 'g',
-    'r', 'o', 'u', 'p', 'g', 'r', 'o', 'w', 'g', 'r', 'u', 'n', 't', 'g', 'u', 'a', 'r', 'd', 'g',
-    'u', 'e', 's', 's', 'g', 'u', 'i', 'd', 'e', 'g', 'u', 'i', 'l', 't', 'g', 'u', 'i', 't', 'a',
-    'r', 'g', 'u', 'n', 'g', 'y', 'm', 'h', 'a', 'b', 'i', 't', 'h', 'a', 'i', 'r', 'h', 'a', 'l',
-    'f', 'h', 'a', 'm', 'm', 'e', 'r', 'h', 'a', 'm', 's', 't', 'e', 'r', 'h', 'a', 'n', 'd', 'h',
-    'a', 'p', 'p', 'y', 'h', 'a', 'r', 'b', 'o', 'r', 'h', 'a', 'r', 'd', 'h', 'a', 'r', 's', 'h',
-    'h', 'a', 'r', 'v', 'e', 's', 't', 'h', 'a', 't', 'h', 'a', 'v', 'e', 'h', 'a', 'w', 'k', 'h',
-    'a', 'z', 'a', 'r', 'd', 'h', 'e', 'a', 'd', 'h', 'e', 'a', 'l', 't', 'h', 'h', 'e', 'a', 'r',
-    't', 'h', 'e', 'a', 'v', 'y', 'h', 'e', 'd', 'g', 'e', 'h', 'o', 'g', 'h', 'e', 'i', 'g', 'h',
-    't', 'h', 'e', 'l', 'l', 'o', 'h', 'e', 'l', 'm', 'e', 't', 'h', 'e', 'l', 'p', 'h', 'e', 'n',
-    'h', 'e', 'r', 'o', 'h', 'i', 'd', 'd', 'e', 'n', 'h', 'i', 'g', 'h', 'h', 'i', 'l', 'l', 'h',
-    'i', 'n', 't', 'h', 'i', 'p', 'h', 'i', 'r', 'e', 'h', 'i', 's', 't', 'o', 'r', 'y', 'h', 'o',
-    'b', 'b', 'y', 'h', 'o', 'c', 'k', 'e', 'y', 'h', 'o', 'l', 'd', 'h', 'o', 'l', 'e', 'h', 'o',
-    'l', 'i', 'd', 'a', 'y', 'h', 'o', 'l', 'l', 'o', 'w', 'h', 'o', 'm', 'e', 'h', 'o', 'n', 'e',
-    'y', 'h', 'o', 'o', 'd', 'h', 'o', 'p', 'e', 'h', 'o', 'r', 'n', 'h', 'o', 'r', 'r', 'o', 'r',
-    'h', 'o', 'r', 's', 'e', 'h', 'o', 's', 'p', 'i', 't', 'a', 'l', 'h', 'o', 's', 't', 'h', 'o',
-    't', 'e', 'l', 'h', 'o', 'u', 'r', 'h', 'o', 'v', 'e', 'r', 'h', 'u', 'b', 'h', 'u', 'g', 'e',
-    'h', 'u', 'm', 'a', 'n', 'h', 'u', 'm', 'b', 'l', 'e', 'h', 'u', 'm', 'o', 'r', 'h', 'u', 'n',
-    'd', 'r', 'e', 'd', 'h', 'u', 'n', 'g', 'r', 'y', 'h', 'u', 'n', 't', 'h', 'u', 'r', 'd', 'l',
-    'e', 'h', 'u', 'r', 'r', 'y', 'h', 'u', 'r', 't', 'h', 'u', 's', 'b', 'a', 'n', 'd', 'h', 'y',
-    'b', 'r', 'i', 'd', 'i', 'c', 'e', 'i', 'c', 'o', 'n', 'i', 'd', 'e', 'a', 'i', 'd', 'e', 'n',
-    't', 'i', 'f', 'y', 'i', 'd', 'l', 'e', 'i', 'g', 'n', 'o', 'r', 'e', 'i', 'l', 'l', 'i', 'l',
-    'l', 'e', 'g', 'a', 'l', 'i', 'l', 'l', 'n', 'e', 's', 's', 'i', 'm', 'a', 'g', 'e', 'i', 'm',
-    'i', 't', 'a', 't', 'e', 'i', 'm', 'm', 'e', 'n', 's', 'e', 'i', 'm', 'm', 'u', 'n', 'e', 'i',
-    'm', 'p', 'a', 'c', 't', 'i', 'm', 'p', 'o', 's', 'e', 'i', 'm', 'p', 'r', 'o', 'v', 'e', 'i',
-    'm', 'p', 'u', 'l', 's', 'e', 'i', 'n', 'c', 'h', 'i', 'n', 'c', 'l', 'u', 'd', 'e', 'i', 'n',
-    'c', 'o', 'm', 'e', 'i', 'n', 'c', 'r', 'e', 'a', 's', 'e', 'i', 'n', 'd', 'e', 'x', 'i', 'n',
-    'd', 'i', 'c', 'a', 't', 'e', 'i', 'n', 'd', 'o', 'o', 'r', 'i', 'n', 'd', 'u', 's', 't', 'r',
-    'y', 'i', 'n', 'f', 'a', 'n', 't', 'i', 'n', 'f', 'l', 'i', 'c', 't', 'i', 'n', 'f', 'o', 'r',
-    'm', 'i', 'n', 'h', 'a', 'l', 'e', 'i', 'n', 'h', 'e', 'r', 'i', 't', 'i', 'n', 'i', 't', 'i',
-    'a', 'l', 'i', 'n', 'j', 'e', 'c', 't', 'i', 'n', 'j', 'u', 'r', 'y', 'i', 'n', 'm', 'a', 't',
-    'e', 'i', 'n', 'n', 'e', 'r', 'i', 'n', 'n', 'o', 'c', 'e', 'n', 't', 'i', 'n', 'p', 'u', 't',
-    'i', 'n', 'q', 'u', 'i', 'r', 'y', 'i', 'n', 's', 'a', 'n', 'e', 'i', 'n', 's', 'e', 'c', 't',
-    'i', 'n', 's', 'i', 'd', 'e', 'i', 'n', 's', 'p', 'i', 'r', 'e', 'i', 'n', 's', 't', 'a', 'l',
-    'l', 'i', 'n', 't', 'a', 'c', 't', 'i', 'n', 't', 'e', 'r', 'e', 's', 't', 'i', 'n', 't', 'o',
-    'i', 'n', 'v', 'e', 's', 't', 'i', 'n', 'v', 'i', 't', 'e', 'i', 'n', 'v', 'o', 'l', 'v', 'e',
-    'i', 'r', 'o', 'n', 'i', 's', 'l', 'a', 'n', 'd', 'i', 's', 'o', 'l', 'a', 't', 'e', 'i', 's',
-    's', 'u', 'e', 'i', 't', 'e', 'm', 'i', 'v', 'o', 'r', 'y', 'j', 'a', 'c', 'k', 'e', 't', 'j',
-    'a', 'g', 'u', 'a', 'r', 'j', 'a', 'r', 'j', 'a', 'z', 'z', 'j', 'e', 'a', 'l', 'o', 'u', 's',
-    'j', 'e', 'a', 'n', 's', 'j', 'e', 'l', 'l', 'y', 'j', 'e', 'w', 'e', 'l', 'j', 'o', 'b', 'j',
-    'o', 'i', 'n', 'j', 'o', 'k', 'e', 'j', 'o', 'u', 'r', 'n', 'e', 'y', 'j', 'o', 'y', 'j', 'u',
-    'd', 'g', 'e', 'j', 'u', 'i', 'c', 'e', 'j', 'u', 'm', 'p', 'j', 'u', 'n', 'g', 'l', 'e', 'j',
-    'u', 'n', 'i', 'o', 'r', 'j', 'u', 'n', 'k', 'j', 'u', 's', 't', 'k', 'a', 'n', 'g', 'a', 'r',
-    'o', 'o', 'k', 'e', 'e', 'n', 'k', 'e', 'e', 'p', 'k', 'e', 't', 'c', 'h', 'u', 'p', 'k', 'e',
-    'y', 'k', 'i', 'c', 'k', 'k', 'i', 'd', 'k', 'i', 'd', 'n', 'e', 'y', 'k', 'i', 'n', 'd', 'k',
-    'i', 'n', 'g', 'd', 'o', 'm', 'k', 'i', 's', 's', 'k', 'i', 't', 'k', 'i', 't', 'c', 'h', 'e',
-    'n', 'k', 'i', 't', 'e', 'k', 'i', 't', 't', 'e', 'n', 'k', 'i', 'w', 'i', 'k', 'n', 'e', 'e',
-    'k', 'n', 'i', 'f', 'e', 'k', 'n', 'o', 'c', 'k', 'k', 'n', 'o', 'w', 'l', 'a', 'b', 'l', 'a',
-    'b', 'e', 'l', 'l', 'a', 'b', 'o', 'r', 'l', 'a', 'd', 'd', 'e', 'r', 'l', 'a', 'd', 'y', 'l',
-    'a', 'k', 'e', 'l', 'a', 'm', 'p', 'l', 'a', 'n', 'g', 'u', 'a', 'g', 'e', 'l', 'a', 'p', 't',
-    'o', 'p', 'l', 'a', 'r', 'g', 'e', 'l', 'a', 't', 'e', 'r', 'l', 'a', 't', 'i', 'n', 'l', 'a',
-    'u', 'g', 'h', 'l', 'a', 'u', 'n', 'd', 'r', 'y', 'l', 'a', 'v', 'a', 'l', 'a', 'w', 'l', 'a',
-    'w', 'n', 'l', 'a', 'w', 's', 'u', 'i', 't', 'l', 'a', 'y', 'e', 'r', 'l', 'a', 'z', 'y', 'l',
-    'e', 'a', 'd', 'e', 'r', 'l', 'e', 'a', 'f', 'l', 'e', 'a', 'r', 'n', 'l', 'e', 'a', 'v', 'e',
-    'l', 'e', 'c', 't', 'u', 'r', 'e', 'l', 'e', 'f', 't', 'l', 'e', 'g', 'l', 'e', 'g', 'a', 'l',
-    'l', 'e', 'g', 'e', 'n', 'd', 'l', 'e', 'i', 's', 'u', 'r', 'e', 'l', 'e', 'm', 'o', 'n', 'l',
-    'e', 'n', 'd', 'l', 'e', 'n', 'g', 't', 'h', 'l', 'e', 'n', 's', 'l', 'e', 'o', 'p', 'a', 'r',
-    'd', 'l', 'e', 's', 's', 'o', 'n', 'l', 'e', 't', 't', 'e', 'r', 'l', 'e', 'v', 'e', 'l', 'l',
-    'i', 'a', 'r', 'l', 'i', 'b', 'e', 'r', 't', 'y', 'l', 'i', 'b', 'r', 'a', 'r', 'y', 'l', 'i',
-    'c', 'e', 'n', 's', 'e', 'l', 'i', 'f', 'e', 'l', 'i', 'f', 't', 'l', 'i', 'g', 'h', 't', 'l',
-    'i', 'k', 'e', 'l', 'i', 'm', 'b', 'l', 'i', 'm', 'i', 't', 'l', 'i', 'n', 'k', 'l', 'i', 'o',
-    'n', 'l', 'i', 'q', 'u', 'i', 'd', 'l', 'i', 's', 't', 'l', 'i', 't', 't', 'l', 'e', 'l', 'i',
-    'v', 'e', 'l', 'i', 'z', 'a', 'r', 'd', 'l', 'o', 'a', 'd', 'l', 'o', 'a', 'n', 'l', 'o', 'b',
-    's', 't', 'e', 'r', 'l', 'o', 'c', 'a', 'l', 'l', 'o', 'c', 'k', 'l', 'o', 'g', 'i', 'c', 'l',
-    'o', 'n', 'e', 'l', 'y', 'l', 'o', 'n', 'g', 'l', 'o', 'o', 'p', 'l', 'o', 't', 't', 'e', 'r',
-    'y', 'l', 'o', 'u', 'd', 'l', 'o', 'u', 'n', 'g', 'e', 'l', 'o', 'v', 'e', 'l', 'o', 'y', 'a',
-    'l', 'l', 'u', 'c', 'k', 'y', 'l', 'u', 'g', 'g', 'a', 'g', 'e', 'l', 'u', 'm', 'b', 'e', 'r',
-    'l', 'u', 'n', 'a', 'r', 'l', 'u', 'n', 'c', 'h', 'l', 'u', 'x', 'u', 'r', 'y', 'l', 'y', 'r',
-    'i', 'c', 's', 'm', 'a', 'c', 'h', 'i', 'n', 'e', 'm', 'a', 'd', 'm', 'a', 'g', 'i', 'c', 'm',
-    'a', 'g', 'n', 'e', 't', 'm', 'a', 'i', 'd', 'm', 'a', 'i', 'l', 'm', 'a', 'i', 'n', 'm', 'a',
-    'j', 'o', 'r', 'm', 'a', 'k', 'e', 'm', 'a', 'm', 'm', 'a', 'l', 'm', 'a', 'n', 'm', 'a', 'n',
-    'a', 'g', 'e', 'm', 'a', 'n', 'd', 'a', 't', 'e', 'm', 'a', 'n', 'g', 'o', 'm', 'a', 'n', 's',
-    'i', 'o', 'n', 'm', 'a', 'n', 'u', 'a', 'l', 'm', 'a', 'p', 'l', 'e', 'm', 'a', 'r', 'b', 'l',
-    'e', 'm', 'a', 'r', 'c', 'h', 'm', 'a', 'r', 'g', 'i', 'n', 'm', 'a', 'r', 'i', 'n', 'e', 'm',
-    'a', 'r', 'k', 'e', 't', 'm', 'a', 'r', 'r', 'i', 'a', 'g', 'e', 'm', 'a', 's', 'k', 'm', 'a',
-    's', 's', 'm', 'a', 's', 't', 'e', 'r', 'm', 'a', 't', 'c', 'h', 'm', 'a', 't', 'e', 'r', 'i',
-    'a', 'l', 'm', 'a', 't', 'h', 'm', 'a', 't', 'r', 'i', 'x', 'm', 'a', 't', 't', 'e', 'r', 'm',
-    'a', 'x', 'i', 'm', 'u', 'm', 'm', 'a', 'z', 'e', 'm', 'e', 'a', 'd', 'o', 'w', 'm', 'e', 'a',
-    'n', 'm', 'e', 'a', 's', 'u', 'r', 'e', 'm', 'e', 'a', 't', 'm', 'e', 'c', 'h', 'a', 'n', 'i',
-    'c', 'm', 'e', 'd', 'a', 'l', 'm', 'e', 'd', 'i', 'a', 'm', 'e', 'l', 'o', 'd', 'y', 'm', 'e',
-    'l', 't', 'm', 'e', 'm', 'b', 'e', 'r', 'm', 'e', 'm', 'o', 'r', 'y', 'm', 'e', 'n', 't', 'i',
-    'o', 'n', 'm', 'e', 'n', 'u', 'm', 'e', 'r', 'c', 'y', 'm', 'e', 'r', 'g', 'e', 'm', 'e', 'r',
-    'i', 't', 'm', 'e', 'r', 'r', 'y', 'm', 'e', 's', 'h', 'm', 'e', 's', 's', 'a', 'g', 'e', 'm',
-    'e', 't', 'a', 'l', 'm', 'e', 't', 'h', 'o', 'd', 'm', 'i', 'd', 'd', 'l', 'e', 'm', 'i', 'd',
-    'n', 'i', 'g', 'h', 't', 'm', 'i', 'l', 'k', 'm', 'i', 'l', 'l', 'i', 'o', 'n', 'm', 'i', 'm',
-    'i', 'c', 'm', 'i', 'n', 'd', 'm', 'i', 'n', 'i', 'm', 'u', 'm', 'm', 'i', 'n', 'o', 'r', 'm',
-    'i', 'n', 'u', 't', 'e', 'm', 'i', 'r', 'a', 'c', 'l', 'e', 'm', 'i', 'r', 'r', 'o', 'r', 'm',
-    'i', 's', 'e', 'r', 'y', 'm', 'i', 's', 's', 'm', 'i', 's', 't', 'a', 'k', 'e', 'm', 'i', 'x',
-    'm', 'i', 'x', 'e', 'd', 'm', 'i', 'x', 't', 'u', 'r', 'e', 'm', 'o', 'b', 'i', 'l', 'e', 'm',
-    'o', 'd', 'e', 'l', 'm', 'o', 'd', 'i', 'f', 'y', 'm', 'o', 'm', 'm', 'o', 'm', 'e', 'n', 't',
-    'm', 'o', 'n', 'i', 't', 'o', 'r', 'm', 'o', 'n', 'k', 'e', 'y', 'm', 'o', 'n', 's', 't', 'e',
-    'r', 'm', 'o', 'n', 't', 'h', 'm', 'o', 'o', 'n', 'm', 'o', 'r', 'a', 'l', 'm', 'o', 'r', 'e',
-    'm', 'o', 'r', 'n', 'i', 'n', 'g', 'm', 'o', 's', 'q', 'u', 'i', 't', 'o', 'm', 'o', 't', 'h',
-    'e', 'r', 'm', 'o', 't', 'i', 'o', 'n', 'm', 'o', 't', 'o', 'r', 'm', 'o', 'u', 'n', 't', 'a',
-    'i', 'n', 'm', 'o', 'u', 's', 'e', 'm', 'o', 'v', 'e', 'm', 'o', 'v', 'i', 'e', 'm', 'u', 'c',
-    'h', 'm', 'u', 'f', 'f', 'i', 'n', 'm', 'u', 'l', 'e', 'm', 'u', 'l', 't', 'i', 'p', 'l', 'y',
-    'm', 'u', 's', 'c', 'l', 'e', 'm', 'u', 's', 'e', 'u', 'm', 'm', 'u', 's', 'h', 'r', 'o', 'o',
-    'm', 'm', 'u', 's', 'i', 'c', 'm', 'u', 's', 't', 'm', 'u', 't', 'u', 'a', 'l', 'm', 'y', 's',
-    'e', 'l', 'f', 'm', 'y', 's', 't', 'e', 'r', 'y', 'm', 'y', 't', 'h', 'n', 'a', 'i', 'v', 'e',
-    'n', 'a', 'm', 'e', 'n', 'a', 'p', 'k', 'i', 'n', 'n', 'a', 'r', 'r', 'o', 'w', 'n', 'a', 's',
-    't', 'y', 'n', 'a', 't', 'i', 'o', 'n', 'n', 'a', 't', 'u', 'r', 'e', 'n', 'e', 'a', 'r', 'n',
-    'e', 'c', 'k', 'n', 'e', 'e', 'd', 'n', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'n', 'e', 'g', 'l',
-    'e', 'c', 't', 'n', 'e', 'i', 't', 'h', 'e', 'r', 'n', 'e', 'p', 'h', 'e', 'w', 'n', 'e', 'r',
-    'v', 'e', 'n', 'e', 's', 't', 'n', 'e', 't', 'n', 'e', 't', 'w', 'o', 'r', 'k', 'n', 'e', 'u',
-    't', 'r', 'a', 'l', 'n', 'e', 'v', 'e', 'r', 'n', 'e', 'w', 's', 'n', 'e', 'x', 't', 'n', 'i',
-    'c', 'e', 'n', 'i', 'g', 'h', 't', 'n', 'o', 'b', 'l', 'e', 'n', 'o', 'i', 's', 'e', 'n', 'o',
-    'm', 'i', 'n', 'e', 'e', 'n', 'o', 'o', 'd', 'l', 'e', 'n', 'o', 'r', 'm', 'a', 'l', 'n', 'o',
-    'r', 't', 'h', 'n', 'o', 's', 'e', 'n', 'o', 't', 'a', 'b', 'l', 'e', 'n', 'o', 't', 'e', 'n',
-    'o', 't', 'h', 'i', 'n', 'g', 'n', 'o', 't', 'i', 'c', 'e', 'n', 'o', 'v', 'e', 'l', 'n', 'o',
-    'w', 'n', 'u', 'c', 'l', 'e', 'a', 'r', 'n', 'u', 'm', 'b', 'e', 'r', 'n', 'u', 'r', 's', 'e',
-    'n', 'u', 't', 'o', 'a', 'k', 'o', 'b', 'e', 'y', 'o', 'b', 'j', 'e', 'c', 't', 'o', 'b', 'l',
-    'i', 'g', 'e', 'o', 'b', 's', 'c', 'u', 'r', 'e', 'o', 'b', 's', 'e', 'r', 'v', 'e', 'o', 'b',
-    't', 'a', 'i', 'n', 'o', 'b', 'v', 'i', 'o', 'u', 's', 'o', 'c', 'c', 'u', 'r', 'o', 'c', 'e',
-    'a', 'n', 'o', 'c', 't', 'o', 'b', 'e', 'r', 'o', 'd', 'o', 'r', 'o', 'f', 'f', 'o', 'f', 'f',
-    'e', 'r', 'o', 'f', 'f', 'i', 'c', 'e', 'o', 'f', 't', 'e', 'n', 'o', 'i', 'l', 'o', 'k', 'a',
-    'y', 'o', 'l', 'd', 'o', 'l', 'i', 'v', 'e', 'o', 'l', 'y', 'm', 'p', 'i', 'c', 'o', 'm', 'i',
-    't', 'o', 'n', 'c', 'e', 'o', 'n', 'e', 'o', 'n', 'i', 'o', 'n', 'o', 'n', 'l', 'i', 'n', 'e',
-    'o', 'n', 'l', 'y', 'o', 'p', 'e', 'n', 'o', 'p', 'e', 'r', 'a', 'o', 'p', 'i', 'n', 'i', 'o',
-    'n', 'o', 'p', 'p', 'o', 's', 'e', 'o', 'p', 't', 'i', 'o', 'n', 'o', 'r', 'a', 'n', 'g', 'e',
-    'o', 'r', 'b', 'i', 't', 'o', 'r', 'c', 'h', 'a', 'r', 'd', 'o', 'r', 'd', 'e', 'r', 'o', 'r',
-    'd', 'i', 'n', 'a', 'r', 'y', 'o', 'r', 'g', 'a', 'n', 'o', 'r', 'i', 'e', 'n', 't', 'o', 'r',
-    'i', 'g', 'i', 'n', 'a', 'l', 'o', 'r', 'p', 'h', 'a', 'n', 'o', 's', 't', 'r', 'i', 'c', 'h',
-    'o', 't', 'h', 'e', 'r', 'o', 'u', 't', 'd', 'o', 'o', 'r', 'o', 'u', 't', 'e', 'r', 'o', 'u',
-    't', 'p', 'u', 't', 'o', 'u', 't', 's', 'i', 'd', 'e', 'o', 'v', 'a', 'l', 'o', 'v', 'e', 'n',
-    'o', 'v', 'e', 'r', 'o', 'w', 'n', 'o', 'w', 'n', 'e', 'r', 'o', 'x', 'y', 'g', 'e', 'n', 'o',
-    'y', 's', 't', 'e', 'r', 'o', 'z', 'o', 'n', 'e', 'p', 'a', 'c', 't', 'p', 'a', 'd', 'd', 'l',
-    'e', 'p', 'a', 'g', 'e', 'p', 'a', 'i', 'r', 'p', 'a', 'l', 'a', 'c', 'e', 'p', 'a', 'l', 'm',
-    'p', 'a', 'n', 'd', 'a', 'p', 'a', 'n', 'e', 'l', 'p', 'a', 'n', 'i', 'c', 'p', 'a', 'n', 't',
-    'h', 'e', 'r', 'p', 'a', 'p', 'e', 'r', 'p', 'a', 'r', 'a', 'd', 'e', 'p', 'a', 'r', 'e', 'n',
-    't', 'p', 'a', 'r', 'k', 'p', 'a', 'r', 'r', 'o', 't', 'p', 'a', 'r', 't', 'y', 'p', 'a', 's',
-    's', 'p', 'a', 't', 'c', 'h', 'p', 'a', 't', 'h', 'p', 'a', 't', 'i', 'e', 'n', 't', 'p', 'a',
-    't', 'r', 'o', 'l', 'p', 'a', 't', 't', 'e', 'r', 'n', 'p', 'a', 'u', 's', 'e', 'p', 'a', 'v',
-    'e', 'p', 'a', 'y', 'm', 'e', 'n', 't', 'p', 'e', 'a', 'c', 'e', 'p', 'e', 'a', 'n', 'u', 't',
-    'p', 'e', 'a', 'r', 'p', 'e', 'a', 's', 'a', 'n', 't', 'p', 'e', 'l', 'i', 'c', 'a', 'n', 'p',
-    'e', 'n', 'p', 'e', 'n', 'a', 'l', 't', 'y', 'p', 'e', 'n', 'c', 'i', 'l', 'p', 'e', 'o', 'p',
-    'l', 'e', 'p', 'e', 'p', 'p', 'e', 'r', 'p', 'e', 'r', 'f', 'e', 'c', 't', 'p', 'e', 'r', 'm',
-    'i', 't', 'p', 'e', 'r', 's', 'o', 'n', 'p', 'e', 't', 'p', 'h', 'o', 'n', 'e', 'p', 'h', 'o',
-    't', 'o', 'p', 'h', 'r', 'a', 's', 'e', 'p', 'h', 'y', 's', 'i', 'c', 'a', 'l', 'p', 'i', 'a',
-    'n', 'o', 'p', 'i', 'c', 'n', 'i', 'c', 'p', 'i', 'c', 't', 'u', 'r', 'e', 'p', 'i', 'e', 'c',
-    'e', 'p', 'i', 'g', 'p', 'i', 'g', 'e', 'o', 'n', 'p', 'i', 'l', 'l', 'p', 'i', 'l', 'o', 't',
-    'p', 'i', 'n', 'k', 'p', 'i', 'o', 'n', 'e', 'e', 'r', 'p', 'i', 'p', 'e', 'p', 'i', 's', 't',
-    'o', 'l', 'p', 'i', 't', 'c', 'h', 'p', 'i', 'z', 'z', 'a', 'p', 'l', 'a', 'c', 'e', 'p', 'l',
-    'a', 'n', 'e', 't', 'p', 'l', 'a', 's', 't', 'i', 'c', 'p', 'l', 'a', 't', 'e', 'p', 'l', 'a',
-    'y', 'p', 'l', 'e', 'a', 's', 'e', 'p', 'l', 'e', 'd', 'g', 'e', 'p', 'l', 'u', 'c', 'k', 'p',
-    'l', 'u', 'g', 'p', 'l', 'u', 'n', 'g', 'e', 'p', 'o', 'e', 'm', 'p', 'o', 'e', 't', 'p', 'o',
-    'i', 'n', 't', 'p', 'o', 'l', 'a', 'r', 'p', 'o', 'l', 'e', 'p', 'o', 'l', 'i', 'c', 'e', 'p',
-    'o', 'n', 'd', 'p', 'o', 'n', 'y', 'p', 'o', 'o', 'l', 'p', 'o', 'p', 'u', 'l', 'a', 'r', 'p',
-    'o', 'r', 't', 'i', 'o', 'n', 'p', 'o', 's', 'i', 't', 'i', 'o', 'n', 'p', 'o', 's', 's', 'i',
-    'b', 'l', 'e', 'p', 'o', 's', 't', 'p', 'o', 't', 'a', 't', 'o', 'p', 'o', 't', 't', 'e', 'r',
-    'y', 'p', 'o', 'v', 'e', 'r', 't', 'y', 'p', 'o', 'w', 'd', 'e', 'r', 'p', 'o', 'w', 'e', 'r',
-    'p', 'r', 'a', 'c', 't', 'i', 'c', 'e', 'p', 'r', 'a', 'i', 's', 'e', 'p', 'r', 'e', 'd', 'i',
-    'c', 't', 'p', 'r', 'e', 'f', 'e', 'r', 'p', 'r', 'e', 'p', 'a', 'r', 'e', 'p', 'r', 'e', 's',
-    'e', 'n', 't', 'p', 'r', 'e', 't', 't', 'y', 'p', 'r', 'e', 'v', 'e', 'n', 't', 'p', 'r', 'i',
-    'c', 'e', 'p', 'r', 'i', 'd', 'e', 'p', 'r', 'i', 'm', 'a', 'r', 'y', 'p', 'r', 'i', 'n', 't',
-    'p', 'r', 'i', 'o', 'r', 'i', 't', 'y', 'p', 'r', 'i', 's', 'o', 'n', 'p', 'r', 'i', 'v', 'a',
-    't', 'e', 'p', 'r', 'i', 'z', 'e', 'p', 'r', 'o', 'b', 'l', 'e', 'm', 'p', 'r', 'o', 'c', 'e',
-    's', 's', 'p', 'r', 'o', 'd', 'u', 'c', 'e', 'p', 'r', 'o', 'f', 'i', 't', 'p', 'r', 'o', 'g',
-    'r', 'a', 'm', 'p', 'r', 'o', 'j', 'e', 'c', 't', 'p', 'r', 'o', 'm', 'o', 't', 'e', 'p', 'r',
-    'o', 'o', 'f', 'p', 'r', 'o', 'p', 'e', 'r', 't', 'y', 'p', 'r', 'o', 's', 'p', 'e', 'r', 'p',
-    'r', 'o', 't', 'e', 'c', 't', 'p', 'r', 'o', 'u', 'd', 'p', 'r', 'o', 'v', 'i', 'd', 'e', 'p',
-    'u', 'b', 'l', 'i', 'c', 'p', 'u', 'd', 'd', 'i', 'n', 'g', 'p', 'u', 'l', 'l', 'p', 'u', 'l',
-    'p', 'p', 'u', 'l', 's', 'e', 'p', 'u', 'm', 'p', 'k', 'i', 'n', 'p', 'u', 'n', 'c', 'h', 'p',
-    'u', 'p', 'i', 'l', 'p', 'u', 'p', 'p', 'y', 'p', 'u', 'r', 'c', 'h', 'a', 's', 'e', 'p', 'u',
-    'r', 'i', 't', 'y', 'p', 'u', 'r', 'p', 'o', 's', 'e', 'p', 'u', 'r', 's', 'e', 'p', 'u', 's',
-    'h', 'p', 'u', 't', 'p', 'u', 'z', 'z', 'l', 'e', 'p', 'y', 'r', 'a', 'm', 'i', 'd', 'q', 'u',
-    'a', 'l', 'i', 't', 'y', 'q', 'u', 'a', 'n', 't', 'u', 'm', 'q', 'u', 'a', 'r', 't', 'e', 'r',
-    'q', 'u', 'e', 's', 't', 'i', 'o', 'n', 'q', 'u', 'i', 'c', 'k', 'q', 'u', 'i', 't', 'q', 'u',
-    'i', 'z', 'q', 'u', 'o', 't', 'e', 'r', 'a', 'b', 'b', 'i', 't', 'r', 'a', 'c', 'c', 'o', 'o',
-    'n', 'r', 'a', 'c', 'e', 'r', 'a', 'c', 'k', 'r', 'a', 'd', 'a', 'r', 'r', 'a', 'd', 'i', 'o',
-    'r', 'a', 'i', 'l', 'r', 'a', 'i', 'n', 'r', 'a', 'i', 's', 'e', 'r', 'a', 'l', 'l', 'y', 'r',
-    'a', 'm', 'p', 'r', 'a', 'n', 'c', 'h', 'r', 'a', 'n', 'd', 'o', 'm', 'r', 'a', 'n', 'g', 'e',
-    'r', 'a', 'p', 'i', 'd', 'r', 'a', 'r', 'e', 'r', 'a', 't', 'e', 'r', 'a', 't', 'h', 'e', 'r',
-    'r', 'a', 'v', 'e', 'n', 'r', 'a', 'w', 'r', 'a', 'z', 'o', 'r', 'r', 'e', 'a', 'd', 'y', 'r',
-    'e', 'a', 'l', 'r', 'e', 'a', 's', 'o', 'n', 'r', 'e', 'b', 'e', 'l', 'r', 'e', 'b', 'u', 'i',
-    'l', 'd', 'r', 'e', 'c', 'a', 'l', 'l', 'r', 'e', 'c', 'e', 'i', 'v', 'e', 'r', 'e', 'c', 'i',
-    'p', 'e', 'r', 'e', 'c', 'o', 'r', 'd', 'r', 'e', 'c', 'y', 'c', 'l', 'e', 'r', 'e', 'd', 'u',
-    'c', 'e', 'r', 'e', 'f', 'l', 'e', 'c', 't', 'r', 'e', 'f', 'o', 'r', 'm', 'r', 'e', 'f', 'u',
-    's', 'e', 'r', 'e', 'g', 'i', 'o', 'n', 'r', 'e', 'g', 'r', 'e', 't', 'r', 'e', 'g', 'u', 'l',
-    'a', 'r', 'r', 'e', 'j', 'e', 'c', 't', 'r', 'e', 'l', 'a', 'x', 'r', 'e', 'l', 'e', 'a', 's',
-    'e', 'r', 'e', 'l', 'i', 'e', 'f', 'r', 'e', 'l', 'y', 'r', 'e', 'm', 'a', 'i', 'n', 'r', 'e',
-    'm', 'e', 'm', 'b', 'e', 'r', 'r', 'e', 'm', 'i', 'n', 'd', 'r', 'e', 'm', 'o', 'v', 'e', 'r',
-    'e', 'n', 'd', 'e', 'r', 'r', 'e', 'n', 'e', 'w', 'r', 'e', 'n', 't', 'r', 'e', 'o', 'p', 'e',
-    'n', 'r', 'e', 'p', 'a', 'i', 'r', 'r', 'e', 'p', 'e', 'a', 't', 'r', 'e', 'p', 'l', 'a', 'c',
-    'e', 'r', 'e', 'p', 'o', 'r', 't', 'r', 'e', 'q', 'u', 'i', 'r', 'e', 'r', 'e', 's', 'c', 'u',
-    'e', 'r', 'e', 's', 'e', 'm', 'b', 'l', 'e', 'r', 'e', 's', 'i', 's', 't', 'r', 'e', 's', 'o',
-    'u', 'r', 'c', 'e', 'r', 'e', 's', 'p', 'o', 'n', 's', 'e', 'r', 'e', 's', 'u', 'l', 't', 'r',
-    'e', 't', 'i', 'r', 'e', 'r', 'e', 't', 'r', 'e', 'a', 't', 'r', 'e', 't', 'u', 'r', 'n', 'r',
-    'e', 'u', 'n', 'i', 'o', 'n', 'r', 'e', 'v', 'e', 'a', 'l', 'r', 'e', 'v', 'i', 'e', 'w', 'r',
-    'e', 'w', 'a', 'r', 'd', 'r', 'h', 'y', 't', 'h', 'm', 'r', 'i', 'b', 'r', 'i', 'b', 'b', 'o',
-    'n', 'r', 'i', 'c', 'e', 'r', 'i', 'c', 'h', 'r', 'i', 'd', 'e', 'r', 'i', 'd', 'g', 'e', 'r',
-    'i', 'f', 'l', 'e', 'r', 'i', 'g', 'h', 't', 'r', 'i', 'g', 'i', 'd', 'r', 'i', 'n', 'g', 'r',
-    'i', 'o', 't', 'r', 'i', 'p', 'p', 'l', 'e', 'r', 'i', 's', 'k', 'r', 'i', 't', 'u', 'a', 'l',
-    'r', 'i', 'v', 'a', 'l', 'r', 'i', 'v', 'e', 'r', 'r', 'o', 'a', 'd', 'r', 'o', 'a', 's', 't',
-    'r', 'o', 'b', 'o', 't', 'r', 'o', 'b', 'u', 's', 't', 'r', 'o', 'c', 'k', 'e', 't', 'r', 'o',
-    'm', 'a', 'n', 'c', 'e', 'r', 'o', 'o', 'f', 'r', 'o', 'o', 'k', 'i', 'e', 'r', 'o', 'o', 'm',
-    'r', 'o', 's', 'e', 'r', 'o', 't', 'a', 't', 'e', 'r', 'o', 'u', 'g', 'h', 'r', 'o', 'u', 'n',
-    'd', 'r', 'o', 'u', 't', 'e', 'r', 'o', 'y', 'a', 'l', 'r', 'u', 'b', 'b', 'e', 'r', 'r', 'u',
-    'd', 'e', 'r', 'u', 'g', 'r', 'u', 'l', 'e', 'r', 'u', 'n', 'r', 'u', 'n', 'w', 'a', 'y', 'r',
-    'u', 'r', 'a', 'l', 's', 'a', 'd', 's', 'a', 'd', 'd', 'l', 'e', 's', 'a', 'd', 'n', 'e', 's',
-    's', 's', 'a', 'f', 'e', 's', 'a', 'i', 'l', 's', 'a', 'l', 'a', 'd', 's', 'a', 'l', 'm', 'o',
-    'n', 's', 'a', 'l', 'o', 'n', 's', 'a', 'l', 't', 's', 'a', 'l', 'u', 't', 'e', 's', 'a', 'm',
-    'e', 's', 'a', 'm', 'p', 'l', 'e', 's', 'a', 'n', 'd', 's', 'a', 't', 'i', 's', 'f', 'y', 's',
-    'a', 't', 'o', 's', 'h', 'i', 's', 'a', 'u', 'c', 'e', 's', 'a', 'u', 's', 'a', 'g', 'e', 's',
-    'a', 'v', 'e', 's', 'a', 'y', 's', 'c', 'a', 'l', 'e', 's', 'c', 'a', 'n', 's', 'c', 'a', 'r',
-    'e', 's', 'c', 'a', 't', 't', 'e', 'r', 's', 'c', 'e', 'n', 'e', 's', 'c', 'h', 'e', 'm', 'e',
-    's', 'c', 'h', 'o', 'o', 'l', 's', 'c', 'i', 'e', 'n', 'c', 'e', 's', 'c', 'i', 's', 's', 'o',
-    'r', 's', 's', 'c', 'o', 'r', 'p', 'i', 'o', 'n', 's', 'c', 'o', 'u', 't', 's', 'c', 'r', 'a',
-    'p', 's', 'c', 'r', 'e', 'e', 'n', 's', 'c', 'r', 'i', 'p', 't', 's', 'c', 'r', 'u', 'b', 's',
-    'e', 'a', 's', 'e', 'a', 'r', 'c', 'h', 's', 'e', 'a', 's', 'o', 'n', 's', 'e', 'a', 't', 's',
-    'e', 'c', 'o', 'n', 'd', 's', 'e', 'c', 'r', 'e', 't', 's', 'e', 'c', 't', 'i', 'o', 'n', 's',
-    'e', 'c', 'u', 'r', 'i', 't', 'y', 's', 'e', 'e', 'd', 's', 'e', 'e', 'k', 's', 'e', 'g', 'm',
-    'e', 'n', 't', 's', 'e', 'l', 'e', 'c', 't', 's', 'e', 'l', 'l', 's', 'e', 'm', 'i', 'n', 'a',
-    'r', 's', 'e', 'n', 'i', 'o', 'r', 's', 'e', 'n', 's', 'e', 's', 'e', 'n', 't', 'e', 'n', 'c',
-    'e', 's', 'e', 'r', 'i', 'e', 's', 's', 'e', 'r', 'v', 'i', 'c', 'e', 's', 'e', 's', 's', 'i',
-    'o', 'n', 's', 'e', 't', 't', 'l', 'e', 's', 'e', 't', 'u', 'p', 's', 'e', 'v', 'e', 'n', 's',
-    'h', 'a', 'd', 'o', 'w', 's', 'h', 'a', 'f', 't', 's', 'h', 'a', 'l', 'l', 'o', 'w', 's', 'h',
-    'a', 'r', 'e', 's', 'h', 'e', 'd', 's', 'h', 'e', 'l', 'l', 's', 'h', 'e', 'r', 'i', 'f', 'f',
-    's', 'h', 'i', 'e', 'l', 'd', 's', 'h', 'i', 'f', 't', 's', 'h', 'i', 'n', 'e', 's', 'h', 'i',
-    'p', 's', 'h', 'i', 'v', 'e', 'r', 's', 'h', 'o', 'c', 'k', 's', 'h', 'o', 'e', 's', 'h', 'o',
-    'o', 't', 's', 'h', 'o', 'p', 's', 'h', 'o', 'r', 't', 's', 'h', 'o', 'u', 'l', 'd', 'e', 'r',
-    's', 'h', 'o', 'v', 'e', 's', 'h', 'r', 'i', 'm', 'p', 's', 'h', 'r', 'u', 'g', 's', 'h', 'u',
-    'f', 'f', 'l', 'e', 's', 'h', 'y', 's', 'i', 'b', 'l', 'i', 'n', 'g', 's', 'i', 'c', 'k', 's',
-    'i', 'd', 'e', 's', 'i', 'e', 'g', 'e', 's', 'i', 'g', 'h', 't', 's', 'i', 'g', 'n', 's', 'i',
-    'l', 'e', 'n', 't', 's', 'i', 'l', 'k', 's', 'i', 'l', 'l', 'y', 's', 'i', 'l', 'v', 'e', 'r',
-    's', 'i', 'm', 'i', 'l', 'a', 'r', 's', 'i', 'm', 'p', 'l', 'e', 's', 'i', 'n', 'c', 'e', 's',
-    'i', 'n', 'g', 's', 'i', 'r', 'e', 'n', 's', 'i', 's', 't', 'e', 'r', 's', 'i', 't', 'u', 'a',
-    't', 'e', 's', 'i', 'x', 's', 'i', 'z', 'e', 's', 'k', 'a', 't', 'e', 's', 'k', 'e', 't', 'c',
-    'h', 's', 'k', 'i', 's', 'k', 'i', 'l', 'l', 's', 'k', 'i', 'n', 's', 'k', 'i', 'r', 't', 's',
-    'k', 'u', 'l', 'l', 's', 'l', 'a', 'b', 's', 'l', 'a', 'm', 's', 'l', 'e', 'e', 'p', 's', 'l',
-    'e', 'n', 'd', 'e', 'r', 's', 'l', 'i', 'c', 'e', 's', 'l', 'i', 'd', 'e', 's', 'l', 'i', 'g',
-    'h', 't', 's', 'l', 'i', 'm', 's', 'l', 'o', 'g', 'a', 'n', 's', 'l', 'o', 't', 's', 'l', 'o',
-    'w', 's', 'l', 'u', 's', 'h', 's', 'm', 'a', 'l', 'l', 's', 'm', 'a', 'r', 't', 's', 'm', 'i',
-    'l', 'e', 's', 'm', 'o', 'k', 'e', 's', 'm', 'o', 'o', 't', 'h', 's', 'n', 'a', 'c', 'k', 's',
-    'n', 'a', 'k', 'e', 's', 'n', 'a', 'p', 's', 'n', 'i', 'f', 'f', 's', 'n', 'o', 'w', 's', 'o',
-    'a', 'p', 's', 'o', 'c', 'c', 'e', 'r', 's', 'o', 'c', 'i', 'a', 'l', 's', 'o', 'c', 'k', 's',
-    'o', 'd', 'a', 's', 'o', 'f', 't', 's', 'o', 'l', 'a', 'r', 's', 'o', 'l', 'd', 'i', 'e', 'r',
-    's', 'o', 'l', 'i', 'd', 's', 'o', 'l', 'u', 't', 'i', 'o', 'n', 's', 'o', 'l', 'v', 'e', 's',
-    'o', 'm', 'e', 'o', 'n', 'e', 's', 'o', 'n', 'g', 's', 'o', 'o', 'n', 's', 'o', 'r', 'r', 'y',
-    's', 'o', 'r', 't', 's', 'o', 'u', 'l', 's', 'o', 'u', 'n', 'd', 's', 'o', 'u', 'p', 's', 'o',
-    'u', 'r', 'c', 'e', 's', 'o', 'u', 't', 'h', 's', 'p', 'a', 'c', 'e', 's', 'p', 'a', 'r', 'e',
-    's', 'p', 'a', 't', 'i', 'a', 'l', 's', 'p', 'a', 'w', 'n', 's', 'p', 'e', 'a', 'k', 's', 'p',
-    'e', 'c', 'i', 'a', 'l', 's', 'p', 'e', 'e', 'd', 's', 'p', 'e', 'l', 'l', 's', 'p', 'e', 'n',
-    'd', 's', 'p', 'h', 'e', 'r', 'e', 's', 'p', 'i', 'c', 'e', 's', 'p', 'i', 'd', 'e', 'r', 's',
-    'p', 'i', 'k', 'e', 's', 'p', 'i', 'n', 's', 'p', 'i', 'r', 'i', 't', 's', 'p', 'l', 'i', 't',
-    's', 'p', 'o', 'i', 'l', 's', 'p', 'o', 'n', 's', 'o', 'r', 's', 'p', 'o', 'o', 'n', 's', 'p',
-    'o', 'r', 't', 's', 'p', 'o', 't', 's', 'p', 'r', 'a', 'y', 's', 'p', 'r', 'e', 'a', 'd', 's',
-    'p', 'r', 'i', 'n', 'g', 's', 'p', 'y', 's', 'q', 'u', 'a', 'r', 'e', 's', 'q', 'u', 'e', 'e',
-    'z', 'e', 's', 'q', 'u', 'i', 'r', 'r', 'e', 'l', 's', 't', 'a', 'b', 'l', 'e', 's', 't', 'a',
-    'd', 'i', 'u', 'm', 's', 't', 'a', 'f', 'f', 's', 't', 'a', 'g', 'e', 's', 't', 'a', 'i', 'r',
-    's', 's', 't', 'a', 'm', 'p', 's', 't', 'a', 'n', 'd', 's', 't', 'a', 'r', 't', 's', 't', 'a',
-    't', 'e', 's', 't', 'a', 'y', 's', 't', 'e', 'a', 'k', 's', 't', 'e', 'e', 'l', 's', 't', 'e',
-    'm', 's', 't', 'e', 'p', 's', 't', 'e', 'r', 'e', 'o', 's', 't', 'i', 'c', 'k', 's', 't', 'i',
-    'l', 'l', 's', 't', 'i', 'n', 'g', 's', 't', 'o', 'c', 'k', 's', 't', 'o', 'm', 'a', 'c', 'h',
-    's', 't', 'o', 'n', 'e', 's', 't', 'o', 'o', 'l', 's', 't', 'o', 'r', 'y', 's', 't', 'o', 'v',
-    'e', 's', 't', 'r', 'a', 't', 'e', 'g', 'y', 's', 't', 'r', 'e', 'e', 't', 's', 't', 'r', 'i',
-    'k', 'e', 's', 't', 'r', 'o', 'n', 'g', 's', 't', 'r', 'u', 'g', 'g', 'l', 'e', 's', 't', 'u',
-    'd', 'e', 'n', 't', 's', 't', 'u', 'f', 'f', 's', 't', 'u', 'm', 'b', 'l', 'e', 's', 't', 'y',
-    'l', 'e', 's', 'u', 'b', 'j', 'e', 'c', 't', 's', 'u', 'b', 'm', 'i', 't', 's', 'u', 'b', 'w',
-    'a', 'y', 's', 'u', 'c', 'c', 'e', 's', 's', 's', 'u', 'c', 'h', 's', 'u', 'd', 'd', 'e', 'n',
-    's', 'u', 'f', 'f', 'e', 'r', 's', 'u', 'g', 'a', 'r', 's', 'u', 'g', 'g', 'e', 's', 't', 's',
-    'u', 'i', 't', 's', 'u', 'm', 'm', 'e', 'r', 's', 'u', 'n', 's', 'u', 'n', 'n', 'y', 's', 'u',
-    'n', 's', 'e', 't', 's', 'u', 'p', 'e', 'r', 's', 'u', 'p', 'p', 'l', 'y', 's', 'u', 'p', 'r',
-    'e', 'm', 'e', 's', 'u', 'r', 'e', 's', 'u', 'r', 'f', 'a', 'c', 'e', 's', 'u', 'r', 'g', 'e',
-    's', 'u', 'r', 'p', 'r', 'i', 's', 'e', 's', 'u', 'r', 'r', 'o', 'u', 'n', 'd', 's', 'u', 'r',
-    'v', 'e', 'y', 's', 'u', 's', 'p', 'e', 'c', 't', 's', 'u', 's', 't', 'a', 'i', 'n', 's', 'w',
-    'a', 'l', 'l', 'o', 'w', 's', 'w', 'a', 'm', 'p', 's', 'w', 'a', 'p', 's', 'w', 'a', 'r', 'm',
-    's', 'w', 'e', 'a', 'r', 's', 'w', 'e', 'e', 't', 's', 'w', 'i', 'f', 't', 's', 'w', 'i', 'm',
-    's', 'w', 'i', 'n', 'g', 's', 'w', 'i', 't', 'c', 'h', 's', 'w', 'o', 'r', 'd', 's', 'y', 'm',
-    'b', 'o', 'l', 's', 'y', 'm', 'p', 't', 'o', 'm', 's', 'y', 'r', 'u', 'p', 's', 'y', 's', 't',
-    'e', 'm', 't', 'a', 'b', 'l', 'e', 't', 'a', 'c', 'k', 'l', 'e', 't', 'a', 'g', 't', 'a', 'i',
-    'l', 't', 'a', 'l', 'e', 'n', 't', 't', 'a', 'l', 'k', 't', 'a', 'n', 'k', 't', 'a', 'p', 'e',
-    't', 'a', 'r', 'g', 'e', 't', 't', 'a', 's', 'k', 't', 'a', 's', 't', 'e', 't', 'a', 't', 't',
-    'o', 'o', 't', 'a', 'x', 'i', 't', 'e', 'a', 'c', 'h', 't', 'e', 'a', 'm', 't', 'e', 'l', 'l',
-    't', 'e', 'n', 't', 'e', 'n', 'a', 'n', 't', 't', 'e', 'n', 'n', 'i', 's', 't', 'e', 'n', 't',
-    't', 'e', 'r', 'm', 't', 'e', 's', 't', 't', 'e', 'x', 't', 't', 'h', 'a', 'n', 'k', 't', 'h',
-    'a', 't', 't', 'h', 'e', 'm', 'e', 't', 'h', 'e', 'n', 't', 'h', 'e', 'o', 'r', 'y', 't', 'h',
-    'e', 'r', 'e', 't', 'h', 'e', 'y', 't', 'h', 'i', 'n', 'g', 't', 'h', 'i', 's', 't', 'h', 'o',
-    'u', 'g', 'h', 't', 't', 'h', 'r', 'e', 'e', 't', 'h', 'r', 'i', 'v', 'e', 't', 'h', 'r', 'o',
-    'w', 't', 'h', 'u', 'm', 'b', 't', 'h', 'u', 'n', 'd', 'e', 'r', 't', 'i', 'c', 'k', 'e', 't',
-    't', 'i', 'd', 'e', 't', 'i', 'g', 'e', 'r', 't', 'i', 'l', 't', 't', 'i', 'm', 'b', 'e', 'r',
-    't', 'i', 'm', 'e', 't', 'i', 'n', 'y', 't', 'i', 'p', 't', 'i', 'r', 'e', 'd', 't', 'i', 's',
-    's', 'u', 'e', 't', 'i', 't', 'l', 'e', 't', 'o', 'a', 's', 't', 't', 'o', 'b', 'a', 'c', 'c',
-    'o', 't', 'o', 'd', 'a', 'y', 't', 'o', 'd', 'd', 'l', 'e', 'r', 't', 'o', 'e', 't', 'o', 'g',
-    'e', 't', 'h', 'e', 'r', 't', 'o', 'i', 'l', 'e', 't', 't', 'o', 'k', 'e', 'n', 't', 'o', 'm',
-    'a', 't', 'o', 't', 'o', 'm', 'o', 'r', 'r', 'o', 'w', 't', 'o', 'n', 'e', 't', 'o', 'n', 'g',
-    'u', 'e', 't', 'o', 'n', 'i', 'g', 'h', 't', 't', 'o', 'o', 'l', 't', 'o', 'o', 't', 'h', 't',
-    'o', 'p', 't', 'o', 'p', 'i', 'c', 't', 'o', 'p', 'p', 'l', 'e', 't', 'o', 'r', 'c', 'h', 't',
-    'o', 'r', 'n', 'a', 'd', 'o', 't', 'o', 'r', 't', 'o', 'i', 's', 'e', 't', 'o', 's', 's', 't',
-    'o', 't', 'a', 'l', 't', 'o', 'u', 'r', 'i', 's', 't', 't', 'o', 'w', 'a', 'r', 'd', 't', 'o',
-    'w', 'e', 'r', 't', 'o', 'w', 'n', 't', 'o', 'y', 't', 'r', 'a', 'c', 'k', 't', 'r', 'a', 'd',
-    'e', 't', 'r', 'a', 'f', 'f', 'i', 'c', 't', 'r', 'a', 'g', 'i', 'c', 't', 'r', 'a', 'i', 'n',
-    't', 'r', 'a', 'n', 's', 'f', 'e', 'r', 't', 'r', 'a', 'p', 't', 'r', 'a', 's', 'h', 't', 'r',
-    'a', 'v', 'e', 'l', 't', 'r', 'a', 'y', 't', 'r', 'e', 'a', 't', 't', 'r', 'e', 'e', 't', 'r',
-    'e', 'n', 'd', 't', 'r', 'i', 'a', 'l', 't', 'r', 'i', 'b', 'e', 't', 'r', 'i', 'c', 'k', 't',
-    'r', 'i', 'g', 'g', 'e', 'r', 't', 'r', 'i', 'm', 't', 'r', 'i', 'p', 't', 'r', 'o', 'p', 'h',
-    'y', 't', 'r', 'o', 'u', 'b', 'l', 'e', 't', 'r', 'u', 'c', 'k', 't', 'r', 'u', 'e', 't', 'r',
-    'u', 'l', 'y', 't', 'r', 'u', 'm', 'p', 'e', 't', 't', 'r', 'u', 's', 't', 't', 'r', 'u', 't',
-    'h', 't', 'r', 'y', 't', 'u', 'b', 'e', 't', 'u', 'i', 't', 'i', 'o', 'n', 't', 'u', 'm', 'b',
-    'l', 'e', 't', 'u', 'n', 'a', 't', 'u', 'n', 'n', 'e', 'l', 't', 'u', 'r', 'k', 'e', 'y', 't',
-    'u', 'r', 'n', 't', 'u', 'r', 't', 'l', 'e', 't', 'w', 'e', 'l', 'v', 'e', 't', 'w', 'e', 'n',
-    't', 'y', 't', 'w', 'i', 'c', 'e', 't', 'w', 'i', 'n', 't', 'w', 'i', 's', 't', 't', 'w', 'o',
-    't', 'y', 'p', 'e', 't', 'y', 'p', 'i', 'c', 'a', 'l', 'u', 'g', 'l', 'y', 'u', 'm', 'b', 'r',
-    'e', 'l', 'l', 'a', 'u', 'n', 'a', 'b', 'l', 'e', 'u', 'n', 'a', 'w', 'a', 'r', 'e', 'u', 'n',
-    'c', 'l', 'e', 'u', 'n', 'c', 'o', 'v', 'e', 'r', 'u', 'n', 'd', 'e', 'r', 'u', 'n', 'd', 'o',
-    'u', 'n', 'f', 'a', 'i', 'r', 'u', 'n', 'f', 'o', 'l', 'd', 'u', 'n', 'h', 'a', 'p', 'p', 'y',
-    'u', 'n', 'i', 'f', 'o', 'r', 'm', 'u', 'n', 'i', 'q', 'u', 'e', 'u', 'n', 'i', 't', 'u', 'n',
-    'i', 'v', 'e', 'r', 's', 'e', 'u', 'n', 'k', 'n', 'o', 'w', 'n', 'u', 'n', 'l', 'o', 'c', 'k',
-    'u', 'n', 't', 'i', 'l', 'u', 'n', 'u', 's', 'u', 'a', 'l', 'u', 'n', 'v', 'e', 'i', 'l', 'u',
-    'p', 'd', 'a', 't', 'e', 'u', 'p', 'g', 'r', 'a', 'd', 'e', 'u', 'p', 'h', 'o', 'l', 'd', 'u',
-    'p', 'o', 'n', 'u', 'p', 'p', 'e', 'r', 'u', 'p', 's', 'e', 't', 'u', 'r', 'b', 'a', 'n', 'u',
-    'r', 'g', 'e', 'u', 's', 'a', 'g', 'e', 'u', 's', 'e', 'u', 's', 'e', 'd', 'u', 's', 'e', 'f',
-    'u', 'l', 'u', 's', 'e', 'l', 'e', 's', 's', 'u', 's', 'u', 'a', 'l', 'u', 't', 'i', 'l', 'i',
-    't', 'y', 'v', 'a', 'c', 'a', 'n', 't', 'v', 'a', 'c', 'u', 'u', 'm', 'v', 'a', 'g', 'u', 'e',
-    'v', 'a', 'l', 'i', 'd', 'v', 'a', 'l', 'l', 'e', 'y', 'v', 'a', 'l', 'v', 'e', 'v', 'a', 'n',
-    'v', 'a', 'n', 'i', 's', 'h', 'v', 'a', 'p', 'o', 'r', 'v', 'a', 'r', 'i', 'o', 'u', 's', 'v',
-    'a', 's', 't', 'v', 'a', 'u', 'l', 't', 'v', 'e', 'h', 'i', 'c', 'l', 'e', 'v', 'e', 'l', 'v',
-    'e', 't', 'v', 'e', 'n', 'd', 'o', 'r', 'v', 'e', 'n', 't', 'u', 'r', 'e', 'v', 'e', 'n', 'u',
-    'e', 'v', 'e', 'r', 'b', 'v', 'e', 'r', 'i', 'f', 'y', 'v', 'e', 'r', 's', 'i', 'o', 'n', 'v',
-    'e', 'r', 'y', 'v', 'e', 's', 's', 'e', 'l', 'v', 'e', 't', 'e', 'r', 'a', 'n', 'v', 'i', 'a',
-    'b', 'l', 'e', 'v', 'i', 'b', 'r', 'a', 'n', 't', 'v', 'i', 'c', 'i', 'o', 'u', 's', 'v', 'i',
-    'c', 't', 'o', 'r', 'y', 'v', 'i', 'd', 'e', 'o', 'v', 'i', 'e', 'w', 'v', 'i', 'l', 'l', 'a',
-    'g', 'e', 'v', 'i', 'n', 't', 'a', 'g', 'e', 'v', 'i', 'o', 'l', 'i', 'n', 'v', 'i', 'r', 't',
-    'u', 'a', 'l', 'v', 'i', 'r', 'u', 's', 'v', 'i', 's', 'a', 'v', 'i', 's', 'i', 't', 'v', 'i',
-    's', 'u', 'a', 'l', 'v', 'i', 't', 'a', 'l', 'v', 'i', 'v', 'i', 'd', 'v', 'o', 'c', 'a', 'l',
-    'v', 'o', 'i', 'c', 'e', 'v', 'o', 'i', 'd', 'v', 'o', 'l', 'c', 'a', 'n', 'o', 'v', 'o', 'l',
-    'u', 'm', 'e', 'v', 'o', 't', 'e', 'v', 'o', 'y', 'a', 'g', 'e', 'w', 'a', 'g', 'e', 'w', 'a',
-    'g', 'o', 'n', 'w', 'a', 'i', 't', 'w', 'a', 'l', 'k', 'w', 'a', 'l', 'l', 'w', 'a', 'l', 'n',
-    'u', 't', 'w', 'a', 'n', 't', 'w', 'a', 'r', 'f', 'a', 'r', 'e', 'w', 'a', 'r', 'm', 'w', 'a',
-    'r', 'r', 'i', 'o', 'r', 'w', 'a', 's', 'h', 'w', 'a', 's', 'p', 'w', 'a', 's', 't', 'e', 'w',
-    'a', 't', 'e', 'r', 'w', 'a', 'v', 'e', 'w', 'a', 'y', 'w', 'e', 'a', 'l', 't', 'h', 'w', 'e',
-    'a', 'p', 'o', 'n', 'w', 'e', 'a', 'r', 'w', 'e', 'a', 's', 'e', 'l', 'w', 'e', 'a', 't', 'h',
-    'e', 'r', 'w', 'e', 'b', 'w', 'e', 'd', 'd', 'i', 'n', 'g', 'w', 'e', 'e', 'k', 'e', 'n', 'd',
-    'w', 'e', 'i', 'r', 'd', 'w', 'e', 'l', 'c', 'o', 'm', 'e', 'w', 'e', 's', 't', 'w', 'e', 't',
-    'w', 'h', 'a', 'l', 'e', 'w', 'h', 'a', 't', 'w', 'h', 'e', 'a', 't', 'w', 'h', 'e', 'e', 'l',
-    'w', 'h', 'e', 'n', 'w', 'h', 'e', 'r', 'e', 'w', 'h', 'i', 'p', 'w', 'h', 'i', 's', 'p', 'e',
-    'r', 'w', 'i', 'd', 'e', 'w', 'i', 'd', 't', 'h', 'w', 'i', 'f', 'e', 'w', 'i', 'l', 'd', 'w',
-    'i', 'l', 'l', 'w', 'i', 'n', 'w', 'i', 'n', 'd', 'o', 'w', 'w', 'i', 'n', 'e', 'w', 'i', 'n',
-    'g', 'w', 'i', 'n', 'k', 'w', 'i', 'n', 'n', 'e', 'r', 'w', 'i', 'n', 't', 'e', 'r', 'w', 'i',
-    'r', 'e', 'w', 'i', 's', 'd', 'o', 'm', 'w', 'i', 's', 'e', 'w', 'i', 's', 'h', 'w', 'i', 't',
-    'n', 'e', 's', 's', 'w', 'o', 'l', 'f', 'w', 'o', 'm', 'a', 'n', 'w', 'o', 'n', 'd', 'e', 'r',
-    'w', 'o', 'o', 'd', 'w', 'o', 'o', 'l', 'w', 'o', 'r', 'd', 'w', 'o', 'r', 'k', 'w', 'o', 'r',
-    'l', 'd', 'w', 'o', 'r', 'r', 'y', 'w', 'o', 'r', 't', 'h', 'w', 'r', 'a', 'p', 'w', 'r', 'e',
-    'c', 'k', 'w', 'r', 'e', 's', 't', 'l', 'e', 'w', 'r', 'i', 's', 't', 'w', 'r', 'i', 't', 'e',
-    'w', 'r', 'o', 'n', 'g', 'y', 'a', 'r', 'd', 'y', 'e', 'a', 'r', 'y', 'e', 'l', 'l', 'o', 'w',
-    'y', 'o', 'u', 'y', 'o', 'u', 'n', 'g', 'y', 'o', 'u', 't', 'h', 'z', 'e', 'b', 'r', 'a', 'z',
-    'e', 'r', 'o', 'z', 'o', 'n', 'e', 'z', 'o', 'o'};
+    0x08, 0x82, 0xE2, 0x3D, 0xC0,  // abandon
+    0x08, 0x92, 0xC4, 0xD3, 0x20,  // ability
+    0x08, 0x98, 0x50, 0x00, 0x00,  // able
+    0x08, 0x9F, 0x5A, 0x00, 0x00,  // about
+    0x08, 0x9F, 0x62, 0x80, 0x00,  // above
+    0x08, 0xA6, 0x57, 0x50, 0x00,  // absent
+    0x08, 0xA6, 0xF9, 0x08, 0x00,  // absorb
+    0x08, 0xA7, 0x49, 0x04, 0x74,  // abstract
+    0x08, 0xA7, 0x59, 0x10, 0x00,  // absurd
+    0x08, 0xAB, 0x32, 0x80, 0x00,  // abuse
+    0x08, 0xC6, 0x59, 0xCC, 0x00,  // access
+    0x08, 0xC6, 0x92, 0x15, 0xD4,  // accident
+    0x08, 0xC6, 0xFA, 0xBA, 0x80,  // account
+    0x08, 0xC7, 0x59, 0x94, 0x00,  // accuse
+    0x08, 0xD0, 0x92, 0xD8, 0xA0,  // achieve
+    0x08, 0xD2, 0x40, 0x00, 0x00,  // acid
+    0x08, 0xDF, 0x59, 0xD1, 0x23,  // acoustic
+    0x08, 0xE3, 0x54, 0xC8, 0xA0,  // acquire
+    0x08, 0xE4, 0xF9, 0xCC, 0x00,  // across
+    0x08, 0xE8, 0x00, 0x00, 0x00,  // act
+    0x08, 0xE8, 0x97, 0xB8, 0x00,  // action
+    0x08, 0xE8, 0xF9, 0x00, 0x00,  // actor
+    0x08, 0xE9, 0x22, 0xCE, 0x60,  // actress
+    0x08, 0xE9, 0x50, 0xB0, 0x00,  // actual
+    0x09, 0x03, 0x0A, 0x00, 0x00,  // adapt
+    0x09, 0x08, 0x00, 0x00, 0x00,  // add
+    0x09, 0x08, 0x91, 0xD0, 0x00,  // addict
+    0x09, 0x09, 0x22, 0xCE, 0x60,  // address
+    0x09, 0x15, 0x59, 0xD0, 0x00,  // adjust
+    0x09, 0x1A, 0x9A, 0x00, 0x00,  // admit
+    0x09, 0x2A, 0xCA, 0x00, 0x00,  // adult
+    0x09, 0x2C, 0x17, 0x0C, 0xA0,  // advance
+    0x09, 0x2C, 0x91, 0x94, 0x00,  // advice
+    0x09, 0x64, 0xF1, 0x24, 0x60,  // aerobic
+    0x09, 0x8C, 0x14, 0xC8, 0x00,  // affair
+    0x09, 0x8C, 0xF9, 0x10, 0x00,  // afford
+    0x09, 0xA4, 0x14, 0x90, 0x00,  // afraid
+    0x09, 0xC2, 0x97, 0x00, 0x00,  // again
+    0x09, 0xCA, 0x00, 0x00, 0x00,  // age
+    0x09, 0xCA, 0xEA, 0x00, 0x00,  // agent
+    0x09, 0xE4, 0x52, 0x80, 0x00,  // agree
+    0x0A, 0x0A, 0x12, 0x00, 0x00,  // ahead
+    0x0A, 0x5A, 0x00, 0x00, 0x00,  // aim
+    0x0A, 0x64, 0x00, 0x00, 0x00,  // air
+    0x0A, 0x65, 0x07, 0xCA, 0x80,  // airport
+    0x0A, 0x66, 0xC2, 0x80, 0x00,  // aisle
+    0x0B, 0x03, 0x26, 0x80, 0x00,  // alarm
+    0x0B, 0x05, 0x56, 0x80, 0x00,  // album
+    0x0B, 0x06, 0xF4, 0x3D, 0x80,  // alcohol
+    0x0B, 0x0B, 0x2A, 0x00, 0x00,  // alert
+    0x0B, 0x12, 0x57, 0x00, 0x00,  // alien
+    0x0B, 0x18, 0x00, 0x00, 0x00,  // all
+    0x0B, 0x18, 0x5C, 0x80, 0x00,  // alley
+    0x0B, 0x18, 0xFB, 0x80, 0x00,  // allow
+    0x0B, 0x1A, 0xF9, 0xD0, 0x00,  // almost
+    0x0B, 0x1E, 0xE2, 0x80, 0x00,  // alone
+    0x0B, 0x20, 0x80, 0x80, 0x00,  // alpha
+    0x0B, 0x24, 0x50, 0x93, 0x20,  // already
+    0x0B, 0x26, 0xF0, 0x00, 0x00,  // also
+    0x0B, 0x28, 0x59, 0x00, 0x00,  // alter
+    0x0B, 0x2E, 0x1C, 0xCC, 0x00,  // always
+    0x0B, 0x43, 0x42, 0xD6, 0x40,  // amateur
+    0x0B, 0x43, 0xA4, 0xB8, 0xE0,  // amazing
+    0x0B, 0x5E, 0xE3, 0x80, 0x00,  // among
+    0x0B, 0x5F, 0x57, 0x50, 0x00,  // amount
+    0x0B, 0x6B, 0x32, 0x90, 0x00,  // amused
+    0x0B, 0x82, 0xCC, 0xCE, 0x80,  // analyst
+    0x0B, 0x86, 0x87, 0xC8, 0x00,  // anchor
+    0x0B, 0x86, 0x92, 0xBA, 0x80,  // ancient
+    0x0B, 0x8E, 0x59, 0x00, 0x00,  // anger
+    0x0B, 0x8E, 0xC2, 0x80, 0x00,  // angle
+    0x0B, 0x8F, 0x2C, 0x80, 0x00,  // angry
+    0x0B, 0x92, 0xD0, 0xB0, 0x00,  // animal
+    0x0B, 0x96, 0xC2, 0x80, 0x00,  // ankle
+    0x0B, 0x9C, 0xFA, 0xB8, 0x65,  // announce
+    0x0B, 0x9D, 0x50, 0xB0, 0x00,  // annual
+    0x0B, 0x9F, 0x44, 0x16, 0x40,  // another
+    0x0B, 0xA7, 0x72, 0xC8, 0x00,  // answer
+    0x0B, 0xA8, 0x57, 0x38, 0x20,  // antenna
+    0x0B, 0xA8, 0x98, 0xD4, 0xA0,  // antique
+    0x0B, 0xB0, 0x92, 0xD3, 0x20,  // anxiety
+    0x0B, 0xB2, 0x00, 0x00, 0x00,  // any
+    0x0C, 0x03, 0x2A, 0x00, 0x00,  // apart
+    0x0C, 0x1E, 0xC7, 0x9F, 0x20,  // apology
+    0x0C, 0x20, 0x50, 0xC8, 0x00,  // appear
+    0x0C, 0x20, 0xC2, 0x80, 0x00,  // apple
+    0x0C, 0x21, 0x27, 0xD8, 0xA0,  // approve
+    0x0C, 0x24, 0x96, 0x00, 0x00,  // april
+    0x0C, 0x86, 0x80, 0x00, 0x00,  // arch
+    0x0C, 0x87, 0x44, 0x8C, 0x00,  // arctic
+    0x0C, 0x8A, 0x10, 0x00, 0x00,  // area
+    0x0C, 0x8A, 0xE0, 0x80, 0x00,  // arena
+    0x0C, 0x8F, 0x52, 0x80, 0x00,  // argue
+    0x0C, 0x9A, 0x00, 0x00, 0x00,  // arm
+    0x0C, 0x9A, 0x52, 0x00, 0x00,  // armed
+    0x0C, 0x9A, 0xF9, 0x00, 0x00,  // armor
+    0x0C, 0x9B, 0x90, 0x00, 0x00,  // army
+    0x0C, 0x9F, 0x57, 0x10, 0x00,  // around
+    0x0C, 0xA4, 0x17, 0x1C, 0xA0,  // arrange
+    0x0C, 0xA4, 0x59, 0xD0, 0x00,  // arrest
+    0x0C, 0xA4, 0x9B, 0x14, 0x00,  // arrive
+    0x0C, 0xA4, 0xFB, 0x80, 0x00,  // arrow
+    0x0C, 0xA8, 0x00, 0x00, 0x00,  // art
+    0x0C, 0xA8, 0x53, 0x04, 0x74,  // artefact
+    0x0C, 0xA8, 0x99, 0xD0, 0x00,  // artist
+    0x0C, 0xA9, 0x77, 0xC9, 0x60,  // artwork
+    0x0C, 0xD6, 0x00, 0x00, 0x00,  // ask
+    0x0C, 0xE0, 0x51, 0xD0, 0x00,  // aspect
+    0x0C, 0xE6, 0x1A, 0xB2, 0x80,  // assault
+    0x0C, 0xE6, 0x5A, 0x00, 0x00,  // asset
+    0x0C, 0xE6, 0x99, 0xD0, 0x00,  // assist
+    0x0C, 0xE7, 0x56, 0x94, 0x00,  // assume
+    0x0C, 0xE8, 0x86, 0x84, 0x00,  // asthma
+    0x0D, 0x10, 0xC2, 0xD0, 0xA0,  // athlete
+    0x0D, 0x1E, 0xD0, 0x00, 0x00,  // atom
+    0x0D, 0x28, 0x11, 0xAC, 0x00,  // attack
+    0x0D, 0x28, 0x57, 0x10, 0x00,  // attend
+    0x0D, 0x28, 0x9A, 0x54, 0x85,  // attitude
+    0x0D, 0x29, 0x20, 0x8E, 0x80,  // attract
+    0x0D, 0x47, 0x44, 0xBD, 0xC0,  // auction
+    0x0D, 0x48, 0x9A, 0x00, 0x00,  // audit
+    0x0D, 0x4F, 0x59, 0xD0, 0x00,  // august
+    0x0D, 0x5D, 0x40, 0x00, 0x00,  // aunt
+    0x0D, 0x68, 0x87, 0xC8, 0x00,  // author
+    0x0D, 0x68, 0xF0, 0x00, 0x00,  // auto
+    0x0D, 0x69, 0x56, 0xB8, 0x00,  // autumn
+    0x0D, 0x8B, 0x20, 0x9C, 0xA0,  // average
+    0x0D, 0x9E, 0x30, 0x91, 0xE0,  // avocado
+    0x0D, 0x9E, 0x92, 0x00, 0x00,  // avoid
+    0x0D, 0xC2, 0xB2, 0x80, 0x00,  // awake
+    0x0D, 0xC3, 0x22, 0x80, 0x00,  // aware
+    0x0D, 0xC3, 0x90, 0x00, 0x00,  // away
+    0x0D, 0xCB, 0x37, 0xB4, 0xA0,  // awesome
+    0x0D, 0xCD, 0x56, 0x00, 0x00,  // awful
+    0x0D, 0xD7, 0x70, 0xC8, 0x80,  // awkward
+    0x0E, 0x13, 0x30, 0x00, 0x00,  // axis
+    0x10, 0x45, 0x90, 0x00, 0x00,  // baby
+    0x10, 0x46, 0x82, 0xB1, 0xF2,  // bachelor
+    0x10, 0x46, 0xF7, 0x00, 0x00,  // bacon
+    0x10, 0x48, 0x72, 0x80, 0x00,  // badge
+    0x10, 0x4E, 0x00, 0x00, 0x00,  // bag
+    0x10, 0x58, 0x17, 0x0C, 0xA0,  // balance
+    0x10, 0x58, 0x37, 0xBB, 0x20,  // balcony
+    0x10, 0x58, 0xC0, 0x00, 0x00,  // ball
+    0x10, 0x5A, 0x27, 0xBC, 0x00,  // bamboo
+    0x10, 0x5C, 0x17, 0x04, 0x00,  // banana
+    0x10, 0x5C, 0xE2, 0xC8, 0x00,  // banner
+    0x10, 0x64, 0x00, 0x00, 0x00,  // bar
+    0x10, 0x64, 0x56, 0x64, 0x00,  // barely
+    0x10, 0x64, 0x70, 0xA5, 0xC0,  // bargain
+    0x10, 0x65, 0x22, 0xB0, 0x00,  // barrel
+    0x10, 0x66, 0x50, 0x00, 0x00,  // base
+    0x10, 0x66, 0x91, 0x80, 0x00,  // basic
+    0x10, 0x66, 0xB2, 0xD0, 0x00,  // basket
+    0x10, 0x69, 0x46, 0x14, 0x00,  // battle
+    0x11, 0x42, 0x34, 0x00, 0x00,  // beach
+    0x11, 0x42, 0xE0, 0x00, 0x00,  // bean
+    0x11, 0x43, 0x5A, 0x64, 0x00,  // beauty
+    0x11, 0x46, 0x1A, 0xCC, 0xA0,  // because
+    0x11, 0x46, 0xF6, 0x94, 0x00,  // become
+    0x11, 0x4A, 0x60, 0x00, 0x00,  // beef
+    0x11, 0x4C, 0xF9, 0x14, 0x00,  // before
+    0x11, 0x4E, 0x97, 0x00, 0x00,  // begin
+    0x11, 0x50, 0x1B, 0x14, 0x00,  // behave
+    0x11, 0x50, 0x97, 0x10, 0x00,  // behind
+    0x11, 0x58, 0x92, 0xD8, 0xA0,  // believe
+    0x11, 0x58, 0xFB, 0x80, 0x00,  // below
+    0x11, 0x59, 0x40, 0x00, 0x00,  // belt
+    0x11, 0x5C, 0x34, 0x00, 0x00,  // bench
+    0x11, 0x5C, 0x53, 0x26, 0x80,  // benefit
+    0x11, 0x67, 0x40, 0x00, 0x00,  // best
+    0x11, 0x69, 0x20, 0xE4, 0x00,  // betray
+    0x11, 0x69, 0x42, 0xC8, 0x00,  // better
+    0x11, 0x69, 0x72, 0x95, 0xC0,  // between
+    0x11, 0x72, 0xF7, 0x10, 0x00,  // beyond
+    0x12, 0x47, 0x91, 0xB0, 0xA0,  // bicycle
+    0x12, 0x48, 0x00, 0x00, 0x00,  // bid
+    0x12, 0x56, 0x50, 0x00, 0x00,  // bike
+    0x12, 0x5C, 0x40, 0x00, 0x00,  // bind
+    0x12, 0x5E, 0xC7, 0x9F, 0x20,  // biology
+    0x12, 0x64, 0x40, 0x00, 0x00,  // bird
+    0x12, 0x65, 0x44, 0x00, 0x00,  // birth
+    0x12, 0x69, 0x42, 0xC8, 0x00,  // bitter
+    0x13, 0x02, 0x35, 0x80, 0x00,  // black
+    0x13, 0x02, 0x42, 0x80, 0x00,  // blade
+    0x13, 0x02, 0xD2, 0x80, 0x00,  // blame
+    0x13, 0x02, 0xE5, 0x96, 0x80,  // blanket
+    0x13, 0x03, 0x3A, 0x00, 0x00,  // blast
+    0x13, 0x0A, 0x15, 0x80, 0x00,  // bleak
+    0x13, 0x0B, 0x39, 0x80, 0x00,  // bless
+    0x13, 0x12, 0xE2, 0x00, 0x00,  // blind
+    0x13, 0x1E, 0xF2, 0x00, 0x00,  // blood
+    0x13, 0x1F, 0x39, 0xBD, 0xA0,  // blossom
+    0x13, 0x1F, 0x59, 0x94, 0x00,  // blouse
+    0x13, 0x2A, 0x50, 0x00, 0x00,  // blue
+    0x13, 0x2B, 0x20, 0x00, 0x00,  // blur
+    0x13, 0x2B, 0x34, 0x00, 0x00,  // blush
+    0x13, 0xC3, 0x22, 0x00, 0x00,  // board
+    0x13, 0xC3, 0x40, 0x00, 0x00,  // boat
+    0x13, 0xC9, 0x90, 0x00, 0x00,  // body
+    0x13, 0xD2, 0xC0, 0x00, 0x00,  // boil
+    0x13, 0xDA, 0x20, 0x00, 0x00,  // bomb
+    0x13, 0xDC, 0x50, 0x00, 0x00,  // bone
+    0x13, 0xDD, 0x59, 0x80, 0x00,  // bonus
+    0x13, 0xDE, 0xB0, 0x00, 0x00,  // book
+    0x13, 0xDF, 0x3A, 0x00, 0x00,  // boost
+    0x13, 0xE4, 0x42, 0xC8, 0x00,  // border
+    0x13, 0xE4, 0x97, 0x1C, 0x00,  // boring
+    0x13, 0xE5, 0x27, 0xDC, 0x00,  // borrow
+    0x13, 0xE7, 0x30, 0x00, 0x00,  // boss
+    0x13, 0xE9, 0x47, 0xB4, 0x00,  // bottom
+    0x13, 0xEA, 0xE1, 0x94, 0x00,  // bounce
+    0x13, 0xF0, 0x00, 0x00, 0x00,  // box
+    0x13, 0xF2, 0x00, 0x00, 0x00,  // boy
+    0x14, 0x82, 0x35, 0x96, 0x80,  // bracket
+    0x14, 0x82, 0x97, 0x00, 0x00,  // brain
+    0x14, 0x82, 0xE2, 0x00, 0x00,  // brand
+    0x14, 0x83, 0x39, 0x80, 0x00,  // brass
+    0x14, 0x83, 0x62, 0x80, 0x00,  // brave
+    0x14, 0x8A, 0x12, 0x00, 0x00,  // bread
+    0x14, 0x8A, 0x5D, 0x14, 0x00,  // breeze
+    0x14, 0x92, 0x35, 0x80, 0x00,  // brick
+    0x14, 0x92, 0x43, 0x94, 0x00,  // bridge
+    0x14, 0x92, 0x53, 0x00, 0x00,  // brief
+    0x14, 0x92, 0x74, 0x50, 0x00,  // bright
+    0x14, 0x92, 0xE3, 0x80, 0x00,  // bring
+    0x14, 0x93, 0x35, 0x80, 0x00,  // brisk
+    0x14, 0x9E, 0x31, 0xBD, 0x89,  // broccoli
+    0x14, 0x9E, 0xB2, 0xB8, 0x00,  // broken
+    0x14, 0x9E, 0xED, 0x14, 0x00,  // bronze
+    0x14, 0x9E, 0xF6, 0x80, 0x00,  // broom
+    0x14, 0x9F, 0x44, 0x16, 0x40,  // brother
+    0x14, 0x9F, 0x77, 0x00, 0x00,  // brown
+    0x14, 0xAB, 0x34, 0x00, 0x00,  // brush
+    0x15, 0x44, 0x26, 0x14, 0x00,  // bubble
+    0x15, 0x48, 0x4C, 0x80, 0x00,  // buddy
+    0x15, 0x48, 0x72, 0xD0, 0x00,  // budget
+    0x15, 0x4C, 0x60, 0xB1, 0xE0,  // buffalo
+    0x15, 0x52, 0xC2, 0x00, 0x00,  // build
+    0x15, 0x58, 0x20, 0x00, 0x00,  // bulb
+    0x15, 0x58, 0xB0, 0x00, 0x00,  // bulk
+    0x15, 0x58, 0xC2, 0xD0, 0x00,  // bullet
+    0x15, 0x5C, 0x46, 0x14, 0x00,  // bundle
+    0x15, 0x5C, 0xB2, 0xC8, 0x00,  // bunker
+    0x15, 0x64, 0x42, 0xB8, 0x00,  // burden
+    0x15, 0x64, 0x72, 0xC8, 0x00,  // burger
+    0x15, 0x65, 0x3A, 0x00, 0x00,  // burst
+    0x15, 0x66, 0x00, 0x00, 0x00,  // bus
+    0x15, 0x66, 0x97, 0x16, 0x73,  // business
+    0x15, 0x67, 0x90, 0x00, 0x00,  // busy
+    0x15, 0x69, 0x42, 0xC8, 0x00,  // butter
+    0x15, 0x72, 0x59, 0x00, 0x00,  // buyer
+    0x15, 0x75, 0xA0, 0x00, 0x00,  // buzz
+    0x18, 0x44, 0x20, 0x9C, 0xA0,  // cabbage
+    0x18, 0x44, 0x97, 0x00, 0x00,  // cabin
+    0x18, 0x44, 0xC2, 0x80, 0x00,  // cable
+    0x18, 0x47, 0x4A, 0xCC, 0x00,  // cactus
+    0x18, 0x4E, 0x50, 0x00, 0x00,  // cage
+    0x18, 0x56, 0x50, 0x00, 0x00,  // cake
+    0x18, 0x58, 0xC0, 0x00, 0x00,  // call
+    0x18, 0x58, 0xD0, 0x00, 0x00,  // calm
+    0x18, 0x5A, 0x59, 0x04, 0x00,  // camera
+    0x18, 0x5B, 0x00, 0x00, 0x00,  // camp
+    0x18, 0x5C, 0x00, 0x00, 0x00,  // can
+    0x18, 0x5C, 0x16, 0x00, 0x00,  // canal
+    0x18, 0x5C, 0x32, 0xB0, 0x00,  // cancel
+    0x18, 0x5C, 0x4C, 0x80, 0x00,  // candy
+    0x18, 0x5C, 0xE7, 0xB8, 0x00,  // cannon
+    0x18, 0x5C, 0xF2, 0x80, 0x00,  // canoe
+    0x18, 0x5D, 0x60, 0xCC, 0x00,  // canvas
+    0x18, 0x5D, 0x97, 0xB8, 0x00,  // canyon
+    0x18, 0x60, 0x11, 0x30, 0xA0,  // capable
+    0x18, 0x60, 0x9A, 0x05, 0x80,  // capital
+    0x18, 0x61, 0x40, 0xA5, 0xC0,  // captain
+    0x18, 0x64, 0x00, 0x00, 0x00,  // car
+    0x18, 0x64, 0x27, 0xB8, 0x00,  // carbon
+    0x18, 0x64, 0x40, 0x00, 0x00,  // card
+    0x18, 0x64, 0x77, 0x80, 0x00,  // cargo
+    0x18, 0x65, 0x02, 0xD0, 0x00,  // carpet
+    0x18, 0x65, 0x2C, 0x80, 0x00,  // carry
+    0x18, 0x65, 0x40, 0x00, 0x00,  // cart
+    0x18, 0x66, 0x50, 0x00, 0x00,  // case
+    0x18, 0x66, 0x80, 0x00, 0x00,  // cash
+    0x18, 0x66, 0x97, 0x3C, 0x00,  // casino
+    0x18, 0x67, 0x46, 0x14, 0x00,  // castle
+    0x18, 0x67, 0x50, 0xB0, 0x00,  // casual
+    0x18, 0x68, 0x00, 0x00, 0x00,  // cat
+    0x18, 0x68, 0x16, 0x3C, 0xE0,  // catalog
+    0x18, 0x68, 0x34, 0x00, 0x00,  // catch
+    0x18, 0x68, 0x53, 0xBE, 0x59,  // category
+    0x18, 0x69, 0x46, 0x14, 0x00,  // cattle
+    0x18, 0x6A, 0x74, 0x50, 0x00,  // caught
+    0x18, 0x6B, 0x32, 0x80, 0x00,  // cause
+    0x18, 0x6B, 0x44, 0xBD, 0xC0,  // caution
+    0x18, 0x6C, 0x50, 0x00, 0x00,  // cave
+    0x19, 0x52, 0xC4, 0xB8, 0xE0,  // ceiling
+    0x19, 0x58, 0x59, 0x64, 0x00,  // celery
+    0x19, 0x5A, 0x57, 0x50, 0x00,  // cement
+    0x19, 0x5D, 0x3A, 0xCC, 0x00,  // census
+    0x19, 0x5D, 0x4A, 0xCB, 0x20,  // century
+    0x19, 0x64, 0x50, 0xB0, 0x00,  // cereal
+    0x19, 0x65, 0x40, 0xA5, 0xC0,  // certain
+    0x1A, 0x02, 0x99, 0x00, 0x00,  // chair
+    0x1A, 0x02, 0xC5, 0x80, 0x00,  // chalk
+    0x1A, 0x02, 0xD8, 0x25, 0xEE,  // champion
+    0x1A, 0x02, 0xE3, 0x94, 0x00,  // change
+    0x1A, 0x02, 0xF9, 0x80, 0x00,  // chaos
+    0x1A, 0x03, 0x0A, 0x16, 0x40,  // chapter
+    0x1A, 0x03, 0x23, 0x94, 0x00,  // charge
+    0x1A, 0x03, 0x32, 0x80, 0x00,  // chase
+    0x1A, 0x03, 0x40, 0x00, 0x00,  // chat
+    0x1A, 0x0A, 0x18, 0x00, 0x00,  // cheap
+    0x1A, 0x0A, 0x35, 0x80, 0x00,  // check
+    0x1A, 0x0A, 0x59, 0x94, 0x00,  // cheese
+    0x1A, 0x0A, 0x60, 0x00, 0x00,  // chef
+    0x1A, 0x0B, 0x29, 0x64, 0x00,  // cherry
+    0x1A, 0x0B, 0x3A, 0x00, 0x00,  // chest
+    0x1A, 0x12, 0x35, 0x95, 0xC0,  // chicken
+    0x1A, 0x12, 0x53, 0x00, 0x00,  // chief
+    0x1A, 0x12, 0xC2, 0x00, 0x00,  // child
+    0x1A, 0x12, 0xD7, 0x17, 0x20,  // chimney
+    0x1A, 0x1E, 0x91, 0x94, 0x00,  // choice
+    0x1A, 0x1E, 0xF9, 0x94, 0x00,  // choose
+    0x1A, 0x24, 0xF7, 0x24, 0x60,  // chronic
+    0x1A, 0x2A, 0x35, 0xB0, 0xA0,  // chuckle
+    0x1A, 0x2A, 0xE5, 0x80, 0x00,  // chunk
+    0x1A, 0x2B, 0x27, 0x00, 0x00,  // churn
+    0x1A, 0x4E, 0x19, 0x00, 0x00,  // cigar
+    0x1A, 0x5C, 0xE0, 0xB5, 0xEE,  // cinnamon
+    0x1A, 0x64, 0x36, 0x14, 0x00,  // circle
+    0x1A, 0x68, 0x9D, 0x15, 0xC0,  // citizen
+    0x1A, 0x69, 0x90, 0x00, 0x00,  // city
+    0x1A, 0x6C, 0x96, 0x00, 0x00,  // civil
+    0x1B, 0x02, 0x96, 0x80, 0x00,  // claim
+    0x1B, 0x03, 0x00, 0x00, 0x00,  // clap
+    0x1B, 0x03, 0x24, 0x9B, 0x20,  // clarify
+    0x1B, 0x03, 0x70, 0x00, 0x00,  // claw
+    0x1B, 0x03, 0x90, 0x00, 0x00,  // clay
+    0x1B, 0x0A, 0x17, 0x00, 0x00,  // clean
+    0x1B, 0x0B, 0x25, 0x80, 0x00,  // clerk
+    0x1B, 0x0B, 0x62, 0xC8, 0x00,  // clever
+    0x1B, 0x12, 0x35, 0x80, 0x00,  // click
+    0x1B, 0x12, 0x57, 0x50, 0x00,  // client
+    0x1B, 0x12, 0x63, 0x00, 0x00,  // cliff
+    0x1B, 0x12, 0xD1, 0x00, 0x00,  // climb
+    0x1B, 0x12, 0xE4, 0x8C, 0x00,  // clinic
+    0x1B, 0x13, 0x00, 0x00, 0x00,  // clip
+    0x1B, 0x1E, 0x35, 0x80, 0x00,  // clock
+    0x1B, 0x1E, 0x70, 0x00, 0x00,  // clog
+    0x1B, 0x1F, 0x32, 0x80, 0x00,  // close
+    0x1B, 0x1F, 0x44, 0x00, 0x00,  // cloth
+    0x1B, 0x1F, 0x52, 0x00, 0x00,  // cloud
+    0x1B, 0x1F, 0x77, 0x00, 0x00,  // clown
+    0x1B, 0x2A, 0x20, 0x00, 0x00,  // club
+    0x1B, 0x2A, 0xD8, 0x00, 0x00,  // clump
+    0x1B, 0x2B, 0x3A, 0x16, 0x40,  // cluster
+    0x1B, 0x2B, 0x41, 0xA0, 0x00,  // clutch
+    0x1B, 0xC2, 0x34, 0x00, 0x00,  // coach
+    0x1B, 0xC3, 0x3A, 0x00, 0x00,  // coast
+    0x1B, 0xC6, 0xF7, 0x56, 0x80,  // coconut
+    0x1B, 0xC8, 0x50, 0x00, 0x00,  // code
+    0x1B, 0xCC, 0x62, 0x94, 0x00,  // coffee
+    0x1B, 0xD2, 0xC0, 0x00, 0x00,  // coil
+    0x1B, 0xD2, 0xE0, 0x00, 0x00,  // coin
+    0x1B, 0xD8, 0xC2, 0x8E, 0x80,  // collect
+    0x1B, 0xD8, 0xF9, 0x00, 0x00,  // color
+    0x1B, 0xD9, 0x56, 0xB8, 0x00,  // column
+    0x1B, 0xDA, 0x24, 0xB8, 0xA0,  // combine
+    0x1B, 0xDA, 0x50, 0x00, 0x00,  // come
+    0x1B, 0xDA, 0x67, 0xCA, 0x80,  // comfort
+    0x1B, 0xDA, 0x91, 0x80, 0x00,  // comic
+    0x1B, 0xDA, 0xD7, 0xB8, 0x00,  // common
+    0x1B, 0xDB, 0x00, 0xBB, 0x20,  // company
+    0x1B, 0xDC, 0x32, 0xCA, 0x80,  // concert
+    0x1B, 0xDC, 0x4A, 0x8E, 0x80,  // conduct
+    0x1B, 0xDC, 0x64, 0xC9, 0xA0,  // confirm
+    0x1B, 0xDC, 0x79, 0x16, 0x73,  // congress
+    0x1B, 0xDC, 0xE2, 0x8E, 0x80,  // connect
+    0x1B, 0xDD, 0x34, 0x90, 0xB2,  // consider
+    0x1B, 0xDD, 0x49, 0x3D, 0x80,  // control
+    0x1B, 0xDD, 0x64, 0xB8, 0x65,  // convince
+    0x1B, 0xDE, 0xB0, 0x00, 0x00,  // cook
+    0x1B, 0xDE, 0xC0, 0x00, 0x00,  // cool
+    0x1B, 0xE1, 0x02, 0xC8, 0x00,  // copper
+    0x1B, 0xE1, 0x90, 0x00, 0x00,  // copy
+    0x1B, 0xE4, 0x16, 0x00, 0x00,  // coral
+    0x1B, 0xE4, 0x50, 0x00, 0x00,  // core
+    0x1B, 0xE4, 0xE0, 0x00, 0x00,  // corn
+    0x1B, 0xE5, 0x22, 0x8E, 0x80,  // correct
+    0x1B, 0xE7, 0x40, 0x00, 0x00,  // cost
+    0x1B, 0xE9, 0x47, 0xB8, 0x00,  // cotton
+    0x1B, 0xEA, 0x34, 0x00, 0x00,  // couch
+    0x1B, 0xEA, 0xEA, 0x4B, 0x20,  // country
+    0x1B, 0xEB, 0x06, 0x14, 0x00,  // couple
+    0x1B, 0xEB, 0x29, 0x94, 0x00,  // course
+    0x1B, 0xEB, 0x34, 0xB8, 0x00,  // cousin
+    0x1B, 0xEC, 0x59, 0x00, 0x00,  // cover
+    0x1B, 0xF2, 0xFA, 0x14, 0x00,  // coyote
+    0x1C, 0x82, 0x35, 0x80, 0x00,  // crack
+    0x1C, 0x82, 0x46, 0x14, 0x00,  // cradle
+    0x1C, 0x82, 0x6A, 0x00, 0x00,  // craft
+    0x1C, 0x82, 0xD0, 0x00, 0x00,  // cram
+    0x1C, 0x82, 0xE2, 0x80, 0x00,  // crane
+    0x1C, 0x83, 0x34, 0x00, 0x00,  // crash
+    0x1C, 0x83, 0x42, 0xC8, 0x00,  // crater
+    0x1C, 0x83, 0x76, 0x00, 0x00,  // crawl
+    0x1C, 0x83, 0xAC, 0x80, 0x00,  // crazy
+    0x1C, 0x8A, 0x16, 0x80, 0x00,  // cream
+    0x1C, 0x8A, 0x44, 0xD0, 0x00,  // credit
+    0x1C, 0x8A, 0x55, 0x80, 0x00,  // creek
+    0x1C, 0x8B, 0x70, 0x00, 0x00,  // crew
+    0x1C, 0x92, 0x35, 0x96, 0x80,  // cricket
+    0x1C, 0x92, 0xD2, 0x80, 0x00,  // crime
+    0x1C, 0x93, 0x38, 0x00, 0x00,  // crisp
+    0x1C, 0x93, 0x44, 0x8C, 0x00,  // critic
+    0x1C, 0x9F, 0x00, 0x00, 0x00,  // crop
+    0x1C, 0x9F, 0x39, 0x80, 0x00,  // cross
+    0x1C, 0x9F, 0x51, 0xA0, 0x00,  // crouch
+    0x1C, 0x9F, 0x72, 0x00, 0x00,  // crowd
+    0x1C, 0xAA, 0x34, 0x85, 0x80,  // crucial
+    0x1C, 0xAA, 0x56, 0x00, 0x00,  // cruel
+    0x1C, 0xAA, 0x99, 0x94, 0x00,  // cruise
+    0x1C, 0xAA, 0xD1, 0x30, 0xA0,  // crumble
+    0x1C, 0xAA, 0xE1, 0xA0, 0x00,  // crunch
+    0x1C, 0xAB, 0x34, 0x00, 0x00,  // crush
+    0x1C, 0xB2, 0x00, 0x00, 0x00,  // cry
+    0x1C, 0xB3, 0x3A, 0x05, 0x80,  // crystal
+    0x1D, 0x44, 0x50, 0x00, 0x00,  // cube
+    0x1D, 0x59, 0x4A, 0xC8, 0xA0,  // culture
+    0x1D, 0x60, 0x00, 0x00, 0x00,  // cup
+    0x1D, 0x60, 0x27, 0x86, 0x44,  // cupboard
+    0x1D, 0x64, 0x97, 0xD6, 0x60,  // curious
+    0x1D, 0x65, 0x22, 0xBA, 0x80,  // current
+    0x1D, 0x65, 0x40, 0xA5, 0xC0,  // curtain
+    0x1D, 0x65, 0x62, 0x80, 0x00,  // curve
+    0x1D, 0x66, 0x84, 0xBD, 0xC0,  // cushion
+    0x1D, 0x67, 0x47, 0xB4, 0x00,  // custom
+    0x1D, 0x68, 0x50, 0x00, 0x00,  // cute
+    0x1E, 0x46, 0xC2, 0x80, 0x00,  // cycle
+    0x20, 0x48, 0x00, 0x00, 0x00,  // dad
+    0x20, 0x5A, 0x13, 0x94, 0x00,  // damage
+    0x20, 0x5B, 0x00, 0x00, 0x00,  // damp
+    0x20, 0x5C, 0x32, 0x80, 0x00,  // dance
+    0x20, 0x5C, 0x72, 0xC8, 0x00,  // danger
+    0x20, 0x64, 0x97, 0x1C, 0x00,  // daring
+    0x20, 0x66, 0x80, 0x00, 0x00,  // dash
+    0x20, 0x6A, 0x74, 0x50, 0xB2,  // daughter
+    0x20, 0x6E, 0xE0, 0x00, 0x00,  // dawn
+    0x20, 0x72, 0x00, 0x00, 0x00,  // day
+    0x21, 0x42, 0xC0, 0x00, 0x00,  // deal
+    0x21, 0x44, 0x1A, 0x14, 0x00,  // debate
+    0x21, 0x45, 0x24, 0xCC, 0x00,  // debris
+    0x21, 0x46, 0x12, 0x14, 0x00,  // decade
+    0x21, 0x46, 0x56, 0x88, 0xB2,  // december
+    0x21, 0x46, 0x92, 0x14, 0x00,  // decide
+    0x21, 0x46, 0xC4, 0xB8, 0xA0,  // decline
+    0x21, 0x46, 0xF9, 0x06, 0x85,  // decorate
+    0x21, 0x47, 0x22, 0x86, 0x65,  // decrease
+    0x21, 0x4B, 0x20, 0x00, 0x00,  // deer
+    0x21, 0x4C, 0x57, 0x4C, 0xA0,  // defense
+    0x21, 0x4C, 0x97, 0x14, 0x00,  // define
+    0x21, 0x4D, 0x90, 0x00, 0x00,  // defy
+    0x21, 0x4F, 0x22, 0x94, 0x00,  // degree
+    0x21, 0x58, 0x1C, 0x80, 0x00,  // delay
+    0x21, 0x58, 0x9B, 0x16, 0x40,  // deliver
+    0x21, 0x5A, 0x17, 0x10, 0x00,  // demand
+    0x21, 0x5A, 0x99, 0x94, 0x00,  // demise
+    0x21, 0x5C, 0x90, 0xB0, 0x00,  // denial
+    0x21, 0x5D, 0x44, 0xCE, 0x80,  // dentist
+    0x21, 0x5D, 0x90, 0x00, 0x00,  // deny
+    0x21, 0x60, 0x19, 0x50, 0x00,  // depart
+    0x21, 0x60, 0x57, 0x10, 0x00,  // depend
+    0x21, 0x60, 0xF9, 0xA6, 0x80,  // deposit
+    0x21, 0x61, 0x44, 0x00, 0x00,  // depth
+    0x21, 0x61, 0x5A, 0x64, 0x00,  // deputy
+    0x21, 0x64, 0x9B, 0x14, 0x00,  // derive
+    0x21, 0x66, 0x39, 0x24, 0x45,  // describe
+    0x21, 0x66, 0x59, 0x50, 0x00,  // desert
+    0x21, 0x66, 0x93, 0xB8, 0x00,  // design
+    0x21, 0x66, 0xB0, 0x00, 0x00,  // desk
+    0x21, 0x67, 0x00, 0xA6, 0x40,  // despair
+    0x21, 0x67, 0x49, 0x3F, 0x20,  // destroy
+    0x21, 0x68, 0x14, 0xB0, 0x00,  // detail
+    0x21, 0x68, 0x51, 0xD0, 0x00,  // detect
+    0x21, 0x6C, 0x56, 0x3E, 0x00,  // develop
+    0x21, 0x6C, 0x91, 0x94, 0x00,  // device
+    0x21, 0x6C, 0xFA, 0x14, 0x00,  // devote
+    0x22, 0x42, 0x79, 0x05, 0xA0,  // diagram
+    0x22, 0x42, 0xC0, 0x00, 0x00,  // dial
+    0x22, 0x42, 0xD7, 0xB8, 0x80,  // diamond
+    0x22, 0x43, 0x2C, 0x80, 0x00,  // diary
+    0x22, 0x46, 0x50, 0x00, 0x00,  // dice
+    0x22, 0x4B, 0x32, 0xB0, 0x00,  // diesel
+    0x22, 0x4B, 0x40, 0x00, 0x00,  // diet
+    0x22, 0x4C, 0x62, 0xC8, 0x00,  // differ
+    0x22, 0x4E, 0x9A, 0x05, 0x80,  // digital
+    0x22, 0x4E, 0xE4, 0xD3, 0x20,  // dignity
+    0x22, 0x58, 0x56, 0xB4, 0x20,  // dilemma
+    0x22, 0x5C, 0xE2, 0xC8, 0x00,  // dinner
+    0x22, 0x5C, 0xF9, 0x86, 0xB2,  // dinosaur
+    0x22, 0x64, 0x51, 0xD0, 0x00,  // direct
+    0x22, 0x65, 0x40, 0x00, 0x00,  // dirt
+    0x22, 0x66, 0x13, 0xC8, 0xA5,  // disagree
+    0x22, 0x66, 0x37, 0xD8, 0xB2,  // discover
+    0x22, 0x66, 0x50, 0xCC, 0xA0,  // disease
+    0x22, 0x66, 0x80, 0x00, 0x00,  // dish
+    0x22, 0x66, 0xD4, 0xCE, 0x60,  // dismiss
+    0x22, 0x66, 0xF9, 0x10, 0xB2,  // disorder
+    0x22, 0x67, 0x06, 0x07, 0x20,  // display
+    0x22, 0x67, 0x40, 0xB8, 0x65,  // distance
+    0x22, 0x6C, 0x59, 0x50, 0x00,  // divert
+    0x22, 0x6C, 0x92, 0x14, 0x00,  // divide
+    0x22, 0x6C, 0xF9, 0x0C, 0xA0,  // divorce
+    0x22, 0x75, 0xAC, 0x80, 0x00,  // dizzy
+    0x23, 0xC7, 0x47, 0xC8, 0x00,  // doctor
+    0x23, 0xC7, 0x56, 0x95, 0xD4,  // document
+    0x23, 0xCE, 0x00, 0x00, 0x00,  // dog
+    0x23, 0xD8, 0xC0, 0x00, 0x00,  // doll
+    0x23, 0xD9, 0x04, 0x25, 0xC0,  // dolphin
+    0x23, 0xDA, 0x14, 0xB8, 0x00,  // domain
+    0x23, 0xDC, 0x1A, 0x14, 0x00,  // donate
+    0x23, 0xDC, 0xB2, 0xE4, 0x00,  // donkey
+    0x23, 0xDC, 0xF9, 0x00, 0x00,  // donor
+    0x23, 0xDF, 0x20, 0x00, 0x00,  // door
+    0x23, 0xE6, 0x50, 0x00, 0x00,  // dose
+    0x23, 0xEA, 0x26, 0x14, 0x00,  // double
+    0x23, 0xEC, 0x50, 0x00, 0x00,  // dove
+    0x24, 0x82, 0x6A, 0x00, 0x00,  // draft
+    0x24, 0x82, 0x77, 0xB8, 0x00,  // dragon
+    0x24, 0x82, 0xD0, 0x80, 0x00,  // drama
+    0x24, 0x83, 0x3A, 0x24, 0x60,  // drastic
+    0x24, 0x83, 0x70, 0x00, 0x00,  // draw
+    0x24, 0x8A, 0x16, 0x80, 0x00,  // dream
+    0x24, 0x8B, 0x39, 0x80, 0x00,  // dress
+    0x24, 0x92, 0x6A, 0x00, 0x00,  // drift
+    0x24, 0x92, 0xC6, 0x00, 0x00,  // drill
+    0x24, 0x92, 0xE5, 0x80, 0x00,  // drink
+    0x24, 0x93, 0x00, 0x00, 0x00,  // drip
+    0x24, 0x93, 0x62, 0x80, 0x00,  // drive
+    0x24, 0x9F, 0x00, 0x00, 0x00,  // drop
+    0x24, 0xAA, 0xD0, 0x00, 0x00,  // drum
+    0x24, 0xB2, 0x00, 0x00, 0x00,  // dry
+    0x25, 0x46, 0xB0, 0x00, 0x00,  // duck
+    0x25, 0x5A, 0x20, 0x00, 0x00,  // dumb
+    0x25, 0x5C, 0x50, 0x00, 0x00,  // dune
+    0x25, 0x64, 0x97, 0x1C, 0x00,  // during
+    0x25, 0x67, 0x40, 0x00, 0x00,  // dust
+    0x25, 0x68, 0x34, 0x00, 0x00,  // dutch
+    0x25, 0x69, 0x90, 0x00, 0x00,  // duty
+    0x25, 0xC3, 0x23, 0x00, 0x00,  // dwarf
+    0x26, 0x5C, 0x16, 0xA4, 0x60,  // dynamic
+    0x28, 0x4E, 0x59, 0x00, 0x00,  // eager
+    0x28, 0x4E, 0xC2, 0x80, 0x00,  // eagle
+    0x28, 0x64, 0xCC, 0x80, 0x00,  // early
+    0x28, 0x64, 0xE0, 0x00, 0x00,  // earn
+    0x28, 0x65, 0x44, 0x00, 0x00,  // earth
+    0x28, 0x66, 0x96, 0x64, 0x00,  // easily
+    0x28, 0x67, 0x40, 0x00, 0x00,  // east
+    0x28, 0x67, 0x90, 0x00, 0x00,  // easy
+    0x28, 0xD0, 0xF0, 0x00, 0x00,  // echo
+    0x28, 0xDE, 0xC7, 0x9F, 0x20,  // ecology
+    0x28, 0xDE, 0xE7, 0xB7, 0x20,  // economy
+    0x29, 0x0E, 0x50, 0x00, 0x00,  // edge
+    0x29, 0x13, 0x40, 0x00, 0x00,  // edit
+    0x29, 0x2A, 0x30, 0xD0, 0xA0,  // educate
+    0x29, 0x8C, 0xF9, 0x50, 0x00,  // effort
+    0x29, 0xCE, 0x00, 0x00, 0x00,  // egg
+    0x2A, 0x4E, 0x8A, 0x00, 0x00,  // eight
+    0x2A, 0x68, 0x82, 0xC8, 0x00,  // either
+    0x2B, 0x04, 0xFB, 0x80, 0x00,  // elbow
+    0x2B, 0x08, 0x59, 0x00, 0x00,  // elder
+    0x2B, 0x0A, 0x3A, 0x49, 0x23,  // electric
+    0x2B, 0x0A, 0x70, 0xBA, 0x80,  // elegant
+    0x2B, 0x0A, 0xD2, 0xBA, 0x80,  // element
+    0x2B, 0x0B, 0x04, 0x05, 0xD4,  // elephant
+    0x2B, 0x0B, 0x60, 0xD1, 0xF2,  // elevator
+    0x2B, 0x13, 0x42, 0x80, 0x00,  // elite
+    0x2B, 0x26, 0x50, 0x00, 0x00,  // else
+    0x2B, 0x44, 0x19, 0x2C, 0x00,  // embark
+    0x2B, 0x44, 0xF2, 0x64, 0x00,  // embody
+    0x2B, 0x45, 0x20, 0x8C, 0xA0,  // embrace
+    0x2B, 0x4B, 0x23, 0x94, 0x00,  // emerge
+    0x2B, 0x5F, 0x44, 0xBD, 0xC0,  // emotion
+    0x2B, 0x60, 0xC7, 0xE4, 0x00,  // employ
+    0x2B, 0x60, 0xFB, 0x96, 0x40,  // empower
+    0x2B, 0x61, 0x4C, 0x80, 0x00,  // empty
+    0x2B, 0x82, 0x26, 0x14, 0x00,  // enable
+    0x2B, 0x82, 0x3A, 0x00, 0x00,  // enact
+    0x2B, 0x88, 0x00, 0x00, 0x00,  // end
+    0x2B, 0x88, 0xC2, 0xCE, 0x60,  // endless
+    0x2B, 0x88, 0xF9, 0x4C, 0xA0,  // endorse
+    0x2B, 0x8A, 0xDC, 0x80, 0x00,  // enemy
+    0x2B, 0x8B, 0x23, 0xE4, 0x00,  // energy
+    0x2B, 0x8C, 0xF9, 0x0C, 0xA0,  // enforce
+    0x2B, 0x8E, 0x13, 0x94, 0x00,  // engage
+    0x2B, 0x8E, 0x97, 0x14, 0x00,  // engine
+    0x2B, 0x90, 0x17, 0x0C, 0xA0,  // enhance
+    0x2B, 0x94, 0xFC, 0x80, 0x00,  // enjoy
+    0x2B, 0x98, 0x99, 0xD0, 0x00,  // enlist
+    0x2B, 0x9F, 0x53, 0xA0, 0x00,  // enough
+    0x2B, 0xA4, 0x91, 0xA0, 0x00,  // enrich
+    0x2B, 0xA4, 0xF6, 0x30, 0x00,  // enroll
+    0x2B, 0xA7, 0x59, 0x14, 0x00,  // ensure
+    0x2B, 0xA8, 0x59, 0x00, 0x00,  // enter
+    0x2B, 0xA8, 0x99, 0x14, 0x00,  // entire
+    0x2B, 0xA9, 0x2C, 0x80, 0x00,  // entry
+    0x2B, 0xAC, 0x56, 0x3E, 0x05,  // envelope
+    0x2C, 0x13, 0x37, 0x90, 0xA0,  // episode
+    0x2C, 0x6A, 0x16, 0x00, 0x00,  // equal
+    0x2C, 0x6A, 0x98, 0x00, 0x00,  // equip
+    0x2C, 0x82, 0x00, 0x00, 0x00,  // era
+    0x2C, 0x83, 0x32, 0x80, 0x00,  // erase
+    0x2C, 0x9E, 0x42, 0x80, 0x00,  // erode
+    0x2C, 0x9F, 0x34, 0xBD, 0xC0,  // erosion
+    0x2C, 0xA4, 0xF9, 0x00, 0x00,  // error
+    0x2C, 0xAB, 0x0A, 0x00, 0x00,  // erupt
+    0x2C, 0xC6, 0x18, 0x14, 0x00,  // escape
+    0x2C, 0xE6, 0x1C, 0x80, 0x00,  // essay
+    0x2C, 0xE6, 0x57, 0x0C, 0xA0,  // essence
+    0x2C, 0xE8, 0x1A, 0x14, 0x00,  // estate
+    0x2D, 0x0B, 0x27, 0x05, 0x80,  // eternal
+    0x2D, 0x10, 0x91, 0xCC, 0x00,  // ethics
+    0x2D, 0x92, 0x42, 0xB8, 0x65,  // evidence
+    0x2D, 0x92, 0xC0, 0x00, 0x00,  // evil
+    0x2D, 0x9E, 0xB2, 0x80, 0x00,  // evoke
+    0x2D, 0x9E, 0xCB, 0x14, 0x00,  // evolve
+    0x2E, 0x02, 0x3A, 0x00, 0x00,  // exact
+    0x2E, 0x02, 0xD8, 0x30, 0xA0,  // example
+    0x2E, 0x06, 0x59, 0xCC, 0x00,  // excess
+    0x2E, 0x06, 0x80, 0xB8, 0xE5,  // exchange
+    0x2E, 0x06, 0x9A, 0x14, 0x00,  // excite
+    0x2E, 0x06, 0xCA, 0x90, 0xA0,  // exclude
+    0x2E, 0x07, 0x59, 0x94, 0x00,  // excuse
+    0x2E, 0x0A, 0x3A, 0xD0, 0xA0,  // execute
+    0x2E, 0x0B, 0x21, 0xA6, 0x65,  // exercise
+    0x2E, 0x10, 0x1A, 0xCE, 0x80,  // exhaust
+    0x2E, 0x10, 0x91, 0x26, 0x80,  // exhibit
+    0x2E, 0x12, 0xC2, 0x80, 0x00,  // exile
+    0x2E, 0x13, 0x3A, 0x00, 0x00,  // exist
+    0x2E, 0x13, 0x40, 0x00, 0x00,  // exit
+    0x2E, 0x1F, 0x44, 0x8C, 0x00,  // exotic
+    0x2E, 0x20, 0x17, 0x10, 0x00,  // expand
+    0x2E, 0x20, 0x51, 0xD0, 0x00,  // expect
+    0x2E, 0x20, 0x99, 0x14, 0x00,  // expire
+    0x2E, 0x20, 0xC0, 0xA5, 0xC0,  // explain
+    0x2E, 0x20, 0xF9, 0x94, 0x00,  // expose
+    0x2E, 0x21, 0x22, 0xCE, 0x60,  // express
+    0x2E, 0x28, 0x57, 0x10, 0x00,  // extend
+    0x2E, 0x29, 0x20, 0x80, 0x00,  // extra
+    0x2E, 0x4A, 0x00, 0x00, 0x00,  // eye
+    0x2E, 0x4A, 0x29, 0x3E, 0xE0,  // eyebrow
+    0x30, 0x45, 0x24, 0x8C, 0x00,  // fabric
+    0x30, 0x46, 0x50, 0x00, 0x00,  // face
+    0x30, 0x47, 0x56, 0x53, 0x20,  // faculty
+    0x30, 0x48, 0x50, 0x00, 0x00,  // fade
+    0x30, 0x52, 0xEA, 0x00, 0x00,  // faint
+    0x30, 0x53, 0x44, 0x00, 0x00,  // faith
+    0x30, 0x58, 0xC0, 0x00, 0x00,  // fall
+    0x30, 0x59, 0x32, 0x80, 0x00,  // false
+    0x30, 0x5A, 0x50, 0x00, 0x00,  // fame
+    0x30, 0x5A, 0x96, 0x64, 0x00,  // family
+    0x30, 0x5A, 0xFA, 0xCC, 0x00,  // famous
+    0x30, 0x5C, 0x00, 0x00, 0x00,  // fan
+    0x30, 0x5C, 0x3C, 0x80, 0x00,  // fancy
+    0x30, 0x5D, 0x40, 0xCF, 0x20,  // fantasy
+    0x30, 0x64, 0xD0, 0x00, 0x00,  // farm
+    0x30, 0x66, 0x84, 0xBD, 0xC0,  // fashion
+    0x30, 0x68, 0x00, 0x00, 0x00,  // fat
+    0x30, 0x68, 0x16, 0x00, 0x00,  // fatal
+    0x30, 0x68, 0x82, 0xC8, 0x00,  // father
+    0x30, 0x68, 0x93, 0xD4, 0xA0,  // fatigue
+    0x30, 0x6A, 0xCA, 0x00, 0x00,  // fault
+    0x30, 0x6C, 0xF9, 0x26, 0x85,  // favorite
+    0x31, 0x43, 0x4A, 0xC8, 0xA0,  // feature
+    0x31, 0x45, 0x2A, 0x86, 0x59,  // february
+    0x31, 0x48, 0x59, 0x05, 0x80,  // federal
+    0x31, 0x4A, 0x00, 0x00, 0x00,  // fee
+    0x31, 0x4A, 0x40, 0x00, 0x00,  // feed
+    0x31, 0x4A, 0xC0, 0x00, 0x00,  // feel
+    0x31, 0x5A, 0x16, 0x14, 0x00,  // female
+    0x31, 0x5C, 0x32, 0x80, 0x00,  // fence
+    0x31, 0x67, 0x44, 0xD8, 0x2C,  // festival
+    0x31, 0x68, 0x34, 0x00, 0x00,  // fetch
+    0x31, 0x6C, 0x59, 0x00, 0x00,  // fever
+    0x31, 0x6E, 0x00, 0x00, 0x00,  // few
+    0x32, 0x44, 0x59, 0x00, 0x00,  // fiber
+    0x32, 0x47, 0x44, 0xBD, 0xC0,  // fiction
+    0x32, 0x4A, 0xC2, 0x00, 0x00,  // field
+    0x32, 0x4F, 0x59, 0x14, 0x00,  // figure
+    0x32, 0x58, 0x50, 0x00, 0x00,  // file
+    0x32, 0x58, 0xD0, 0x00, 0x00,  // film
+    0x32, 0x59, 0x42, 0xC8, 0x00,  // filter
+    0x32, 0x5C, 0x16, 0x00, 0x00,  // final
+    0x32, 0x5C, 0x40, 0x00, 0x00,  // find
+    0x32, 0x5C, 0x50, 0x00, 0x00,  // fine
+    0x32, 0x5C, 0x72, 0xC8, 0x00,  // finger
+    0x32, 0x5C, 0x99, 0xA0, 0x00,  // finish
+    0x32, 0x64, 0x50, 0x00, 0x00,  // fire
+    0x32, 0x64, 0xD0, 0x00, 0x00,  // firm
+    0x32, 0x65, 0x3A, 0x00, 0x00,  // first
+    0x32, 0x66, 0x30, 0xB0, 0x00,  // fiscal
+    0x32, 0x66, 0x80, 0x00, 0x00,  // fish
+    0x32, 0x68, 0x00, 0x00, 0x00,  // fit
+    0x32, 0x68, 0xE2, 0xCE, 0x60,  // fitness
+    0x32, 0x70, 0x00, 0x00, 0x00,  // fix
+    0x33, 0x02, 0x70, 0x00, 0x00,  // flag
+    0x33, 0x02, 0xD2, 0x80, 0x00,  // flame
+    0x33, 0x03, 0x34, 0x00, 0x00,  // flash
+    0x33, 0x03, 0x40, 0x00, 0x00,  // flat
+    0x33, 0x03, 0x67, 0xC8, 0x00,  // flavor
+    0x33, 0x0A, 0x50, 0x00, 0x00,  // flee
+    0x33, 0x12, 0x74, 0x50, 0x00,  // flight
+    0x33, 0x13, 0x00, 0x00, 0x00,  // flip
+    0x33, 0x1E, 0x1A, 0x00, 0x00,  // float
+    0x33, 0x1E, 0x35, 0x80, 0x00,  // flock
+    0x33, 0x1E, 0xF9, 0x00, 0x00,  // floor
+    0x33, 0x1F, 0x72, 0xC8, 0x00,  // flower
+    0x33, 0x2A, 0x92, 0x00, 0x00,  // fluid
+    0x33, 0x2B, 0x34, 0x00, 0x00,  // flush
+    0x33, 0x32, 0x00, 0x00, 0x00,  // fly
+    0x33, 0xC2, 0xD0, 0x00, 0x00,  // foam
+    0x33, 0xC7, 0x59, 0x80, 0x00,  // focus
+    0x33, 0xCE, 0x00, 0x00, 0x00,  // fog
+    0x33, 0xD2, 0xC0, 0x00, 0x00,  // foil
+    0x33, 0xD8, 0x40, 0x00, 0x00,  // fold
+    0x33, 0xD8, 0xC7, 0xDC, 0x00,  // follow
+    0x33, 0xDE, 0x40, 0x00, 0x00,  // food
+    0x33, 0xDF, 0x40, 0x00, 0x00,  // foot
+    0x33, 0xE4, 0x32, 0x80, 0x00,  // force
+    0x33, 0xE4, 0x59, 0xD0, 0x00,  // forest
+    0x33, 0xE4, 0x72, 0xD0, 0x00,  // forget
+    0x33, 0xE4, 0xB0, 0x00, 0x00,  // fork
+    0x33, 0xE5, 0x4A, 0xB8, 0xA0,  // fortune
+    0x33, 0xE5, 0x56, 0x80, 0x00,  // forum
+    0x33, 0xE5, 0x70, 0xC8, 0x80,  // forward
+    0x33, 0xE7, 0x34, 0xB0, 0x00,  // fossil
+    0x33, 0xE7, 0x42, 0xC8, 0x00,  // foster
+    0x33, 0xEA, 0xE2, 0x00, 0x00,  // found
+    0x33, 0xF0, 0x00, 0x00, 0x00,  // fox
+    0x34, 0x82, 0x74, 0xB0, 0xA0,  // fragile
+    0x34, 0x82, 0xD2, 0x80, 0x00,  // frame
+    0x34, 0x8B, 0x1A, 0x95, 0xD4,  // frequent
+    0x34, 0x8B, 0x34, 0x00, 0x00,  // fresh
+    0x34, 0x92, 0x57, 0x10, 0x00,  // friend
+    0x34, 0x92, 0xE3, 0x94, 0x00,  // fringe
+    0x34, 0x9E, 0x70, 0x00, 0x00,  // frog
+    0x34, 0x9E, 0xEA, 0x00, 0x00,  // front
+    0x34, 0x9F, 0x3A, 0x00, 0x00,  // frost
+    0x34, 0x9F, 0x77, 0x00, 0x00,  // frown
+    0x34, 0x9F, 0xA2, 0xB8, 0x00,  // frozen
+    0x34, 0xAA, 0x9A, 0x00, 0x00,  // fruit
+    0x35, 0x4A, 0xC0, 0x00, 0x00,  // fuel
+    0x35, 0x5C, 0x00, 0x00, 0x00,  // fun
+    0x35, 0x5C, 0xEC, 0x80, 0x00,  // funny
+    0x35, 0x64, 0xE0, 0x8C, 0xA0,  // furnace
+    0x35, 0x65, 0x90, 0x00, 0x00,  // fury
+    0x35, 0x69, 0x59, 0x14, 0x00,  // future
+    0x38, 0x48, 0x72, 0xD0, 0x00,  // gadget
+    0x38, 0x52, 0xE0, 0x00, 0x00,  // gain
+    0x38, 0x58, 0x1C, 0x64, 0x00,  // galaxy
+    0x38, 0x58, 0xC2, 0xCB, 0x20,  // gallery
+    0x38, 0x5A, 0x50, 0x00, 0x00,  // game
+    0x38, 0x60, 0x00, 0x00, 0x00,  // gap
+    0x38, 0x64, 0x13, 0x94, 0x00,  // garage
+    0x38, 0x64, 0x20, 0x9C, 0xA0,  // garbage
+    0x38, 0x64, 0x42, 0xB8, 0x00,  // garden
+    0x38, 0x64, 0xC4, 0x8C, 0x00,  // garlic
+    0x38, 0x64, 0xD2, 0xBA, 0x80,  // garment
+    0x38, 0x66, 0x00, 0x00, 0x00,  // gas
+    0x38, 0x67, 0x00, 0x00, 0x00,  // gasp
+    0x38, 0x68, 0x50, 0x00, 0x00,  // gate
+    0x38, 0x68, 0x82, 0xC8, 0x00,  // gather
+    0x38, 0x6A, 0x72, 0x80, 0x00,  // gauge
+    0x38, 0x74, 0x50, 0x00, 0x00,  // gaze
+    0x39, 0x5C, 0x59, 0x05, 0x80,  // general
+    0x39, 0x5C, 0x9A, 0xCC, 0x00,  // genius
+    0x39, 0x5D, 0x22, 0x80, 0x00,  // genre
+    0x39, 0x5D, 0x46, 0x14, 0x00,  // gentle
+    0x39, 0x5D, 0x54, 0xB8, 0xA0,  // genuine
+    0x39, 0x67, 0x4A, 0xC8, 0xA0,  // gesture
+    0x3A, 0x1F, 0x3A, 0x00, 0x00,  // ghost
+    0x3A, 0x42, 0xEA, 0x00, 0x00,  // giant
+    0x3A, 0x4D, 0x40, 0x00, 0x00,  // gift
+    0x3A, 0x4E, 0x76, 0x14, 0x00,  // giggle
+    0x3A, 0x5C, 0x72, 0xC8, 0x00,  // ginger
+    0x3A, 0x64, 0x13, 0x18, 0xA0,  // giraffe
+    0x3A, 0x64, 0xC0, 0x00, 0x00,  // girl
+    0x3A, 0x6C, 0x50, 0x00, 0x00,  // give
+    0x3B, 0x02, 0x40, 0x00, 0x00,  // glad
+    0x3B, 0x02, 0xE1, 0x94, 0x00,  // glance
+    0x3B, 0x03, 0x22, 0x80, 0x00,  // glare
+    0x3B, 0x03, 0x39, 0x80, 0x00,  // glass
+    0x3B, 0x12, 0x42, 0x80, 0x00,  // glide
+    0x3B, 0x12, 0xD8, 0x4C, 0xA0,  // glimpse
+    0x3B, 0x1E, 0x22, 0x80, 0x00,  // globe
+    0x3B, 0x1E, 0xF6, 0x80, 0x00,  // gloom
+    0x3B, 0x1F, 0x2C, 0x80, 0x00,  // glory
+    0x3B, 0x1F, 0x62, 0x80, 0x00,  // glove
+    0x3B, 0x1F, 0x70, 0x00, 0x00,  // glow
+    0x3B, 0x2A, 0x50, 0x00, 0x00,  // glue
+    0x3B, 0xC3, 0x40, 0x00, 0x00,  // goat
+    0x3B, 0xC8, 0x42, 0xCE, 0x60,  // goddess
+    0x3B, 0xD8, 0x40, 0x00, 0x00,  // gold
+    0x3B, 0xDE, 0x40, 0x00, 0x00,  // good
+    0x3B, 0xDF, 0x32, 0x80, 0x00,  // goose
+    0x3B, 0xE4, 0x96, 0x30, 0x20,  // gorilla
+    0x3B, 0xE7, 0x02, 0xB0, 0x00,  // gospel
+    0x3B, 0xE7, 0x34, 0xC0, 0x00,  // gossip
+    0x3B, 0xEC, 0x59, 0x38, 0x00,  // govern
+    0x3B, 0xEE, 0xE0, 0x00, 0x00,  // gown
+    0x3C, 0x82, 0x20, 0x00, 0x00,  // grab
+    0x3C, 0x82, 0x32, 0x80, 0x00,  // grace
+    0x3C, 0x82, 0x97, 0x00, 0x00,  // grain
+    0x3C, 0x82, 0xEA, 0x00, 0x00,  // grant
+    0x3C, 0x83, 0x02, 0x80, 0x00,  // grape
+    0x3C, 0x83, 0x39, 0x80, 0x00,  // grass
+    0x3C, 0x83, 0x64, 0xD3, 0x20,  // gravity
+    0x3C, 0x8A, 0x1A, 0x00, 0x00,  // great
+    0x3C, 0x8A, 0x57, 0x00, 0x00,  // green
+    0x3C, 0x92, 0x40, 0x00, 0x00,  // grid
+    0x3C, 0x92, 0x53, 0x00, 0x00,  // grief
+    0x3C, 0x93, 0x40, 0x00, 0x00,  // grit
+    0x3C, 0x9E, 0x32, 0xCB, 0x20,  // grocery
+    0x3C, 0x9F, 0x58, 0x00, 0x00,  // group
+    0x3C, 0x9F, 0x70, 0x00, 0x00,  // grow
+    0x3C, 0xAA, 0xEA, 0x00, 0x00,  // grunt
+    0x3D, 0x43, 0x22, 0x00, 0x00,  // guard
+    0x3D, 0x4B, 0x39, 0x80, 0x00,  // guess
+    0x3D, 0x52, 0x42, 0x80, 0x00,  // guide
+    0x3D, 0x52, 0xCA, 0x00, 0x00,  // guilt
+    0x3D, 0x53, 0x40, 0xC8, 0x00,  // guitar
+    0x3D, 0x5C, 0x00, 0x00, 0x00,  // gun
+    0x3E, 0x5A, 0x00, 0x00, 0x00,  // gym
+    0x40, 0x44, 0x9A, 0x00, 0x00,  // habit
+    0x40, 0x53, 0x20, 0x00, 0x00,  // hair
+    0x40, 0x58, 0x60, 0x00, 0x00,  // half
+    0x40, 0x5A, 0xD2, 0xC8, 0x00,  // hammer
+    0x40, 0x5B, 0x3A, 0x16, 0x40,  // hamster
+    0x40, 0x5C, 0x40, 0x00, 0x00,  // hand
+    0x40, 0x61, 0x0C, 0x80, 0x00,  // happy
+    0x40, 0x64, 0x27, 0xC8, 0x00,  // harbor
+    0x40, 0x64, 0x40, 0x00, 0x00,  // hard
+    0x40, 0x65, 0x34, 0x00, 0x00,  // harsh
+    0x40, 0x65, 0x62, 0xCE, 0x80,  // harvest
+    0x40, 0x68, 0x00, 0x00, 0x00,  // hat
+    0x40, 0x6C, 0x50, 0x00, 0x00,  // have
+    0x40, 0x6E, 0xB0, 0x00, 0x00,  // hawk
+    0x40, 0x74, 0x19, 0x10, 0x00,  // hazard
+    0x41, 0x42, 0x40, 0x00, 0x00,  // head
+    0x41, 0x42, 0xCA, 0x20, 0x00,  // health
+    0x41, 0x43, 0x2A, 0x00, 0x00,  // heart
+    0x41, 0x43, 0x6C, 0x80, 0x00,  // heavy
+    0x41, 0x48, 0x72, 0xA1, 0xE7,  // hedgehog
+    0x41, 0x52, 0x74, 0x50, 0x00,  // height
+    0x41, 0x58, 0xC7, 0x80, 0x00,  // hello
+    0x41, 0x58, 0xD2, 0xD0, 0x00,  // helmet
+    0x41, 0x59, 0x00, 0x00, 0x00,  // help
+    0x41, 0x5C, 0x00, 0x00, 0x00,  // hen
+    0x41, 0x64, 0xF0, 0x00, 0x00,  // hero
+    0x42, 0x48, 0x42, 0xB8, 0x00,  // hidden
+    0x42, 0x4E, 0x80, 0x00, 0x00,  // high
+    0x42, 0x58, 0xC0, 0x00, 0x00,  // hill
+    0x42, 0x5D, 0x40, 0x00, 0x00,  // hint
+    0x42, 0x60, 0x00, 0x00, 0x00,  // hip
+    0x42, 0x64, 0x50, 0x00, 0x00,  // hire
+    0x42, 0x67, 0x47, 0xCB, 0x20,  // history
+    0x43, 0xC4, 0x2C, 0x80, 0x00,  // hobby
+    0x43, 0xC6, 0xB2, 0xE4, 0x00,  // hockey
+    0x43, 0xD8, 0x40, 0x00, 0x00,  // hold
+    0x43, 0xD8, 0x50, 0x00, 0x00,  // hole
+    0x43, 0xD8, 0x92, 0x07, 0x20,  // holiday
+    0x43, 0xD8, 0xC7, 0xDC, 0x00,  // hollow
+    0x43, 0xDA, 0x50, 0x00, 0x00,  // home
+    0x43, 0xDC, 0x5C, 0x80, 0x00,  // honey
+    0x43, 0xDE, 0x40, 0x00, 0x00,  // hood
+    0x43, 0xE0, 0x50, 0x00, 0x00,  // hope
+    0x43, 0xE4, 0xE0, 0x00, 0x00,  // horn
+    0x43, 0xE5, 0x27, 0xC8, 0x00,  // horror
+    0x43, 0xE5, 0x32, 0x80, 0x00,  // horse
+    0x43, 0xE7, 0x04, 0xD0, 0x2C,  // hospital
+    0x43, 0xE7, 0x40, 0x00, 0x00,  // host
+    0x43, 0xE8, 0x56, 0x00, 0x00,  // hotel
+    0x43, 0xEB, 0x20, 0x00, 0x00,  // hour
+    0x43, 0xEC, 0x59, 0x00, 0x00,  // hover
+    0x45, 0x44, 0x00, 0x00, 0x00,  // hub
+    0x45, 0x4E, 0x50, 0x00, 0x00,  // huge
+    0x45, 0x5A, 0x17, 0x00, 0x00,  // human
+    0x45, 0x5A, 0x26, 0x14, 0x00,  // humble
+    0x45, 0x5A, 0xF9, 0x00, 0x00,  // humor
+    0x45, 0x5C, 0x49, 0x14, 0x80,  // hundred
+    0x45, 0x5C, 0x79, 0x64, 0x00,  // hungry
+    0x45, 0x5D, 0x40, 0x00, 0x00,  // hunt
+    0x45, 0x64, 0x46, 0x14, 0x00,  // hurdle
+    0x45, 0x65, 0x2C, 0x80, 0x00,  // hurry
+    0x45, 0x65, 0x40, 0x00, 0x00,  // hurt
+    0x45, 0x66, 0x20, 0xB8, 0x80,  // husband
+    0x46, 0x45, 0x24, 0x90, 0x00,  // hybrid
+    0x48, 0xCA, 0x00, 0x00, 0x00,  // ice
+    0x48, 0xDE, 0xE0, 0x00, 0x00,  // icon
+    0x49, 0x0A, 0x10, 0x00, 0x00,  // idea
+    0x49, 0x0A, 0xEA, 0x24, 0xD9,  // identify
+    0x49, 0x18, 0x50, 0x00, 0x00,  // idle
+    0x49, 0xDC, 0xF9, 0x14, 0x00,  // ignore
+    0x4B, 0x18, 0x00, 0x00, 0x00,  // ill
+    0x4B, 0x18, 0x53, 0x85, 0x80,  // illegal
+    0x4B, 0x18, 0xE2, 0xCE, 0x60,  // illness
+    0x4B, 0x42, 0x72, 0x80, 0x00,  // image
+    0x4B, 0x53, 0x40, 0xD0, 0xA0,  // imitate
+    0x4B, 0x5A, 0x57, 0x4C, 0xA0,  // immense
+    0x4B, 0x5B, 0x57, 0x14, 0x00,  // immune
+    0x4B, 0x60, 0x11, 0xD0, 0x00,  // impact
+    0x4B, 0x60, 0xF9, 0x94, 0x00,  // impose
+    0x4B, 0x61, 0x27, 0xD8, 0xA0,  // improve
+    0x4B, 0x61, 0x56, 0x4C, 0xA0,  // impulse
+    0x4B, 0x86, 0x80, 0x00, 0x00,  // inch
+    0x4B, 0x86, 0xCA, 0x90, 0xA0,  // include
+    0x4B, 0x86, 0xF6, 0x94, 0x00,  // income
+    0x4B, 0x87, 0x22, 0x86, 0x65,  // increase
+    0x4B, 0x88, 0x5C, 0x00, 0x00,  // index
+    0x4B, 0x88, 0x91, 0x86, 0x85,  // indicate
+    0x4B, 0x88, 0xF7, 0xC8, 0x00,  // indoor
+    0x4B, 0x89, 0x59, 0xD2, 0x59,  // industry
+    0x4B, 0x8C, 0x17, 0x50, 0x00,  // infant
+    0x4B, 0x8C, 0xC4, 0x8E, 0x80,  // inflict
+    0x4B, 0x8C, 0xF9, 0x34, 0x00,  // inform
+    0x4B, 0x90, 0x16, 0x14, 0x00,  // inhale
+    0x4B, 0x90, 0x59, 0x26, 0x80,  // inherit
+    0x4B, 0x93, 0x44, 0x85, 0x80,  // initial
+    0x4B, 0x94, 0x51, 0xD0, 0x00,  // inject
+    0x4B, 0x95, 0x59, 0x64, 0x00,  // injury
+    0x4B, 0x9A, 0x1A, 0x14, 0x00,  // inmate
+    0x4B, 0x9C, 0x59, 0x00, 0x00,  // inner
+    0x4B, 0x9C, 0xF1, 0x95, 0xD4,  // innocent
+    0x4B, 0xA1, 0x5A, 0x00, 0x00,  // input
+    0x4B, 0xA3, 0x54, 0xCB, 0x20,  // inquiry
+    0x4B, 0xA6, 0x17, 0x14, 0x00,  // insane
+    0x4B, 0xA6, 0x51, 0xD0, 0x00,  // insect
+    0x4B, 0xA6, 0x92, 0x14, 0x00,  // inside
+    0x4B, 0xA7, 0x04, 0xC8, 0xA0,  // inspire
+    0x4B, 0xA7, 0x40, 0xB1, 0x80,  // install
+    0x4B, 0xA8, 0x11, 0xD0, 0x00,  // intact
+    0x4B, 0xA8, 0x59, 0x16, 0x74,  // interest
+    0x4B, 0xA8, 0xF0, 0x00, 0x00,  // into
+    0x4B, 0xAC, 0x59, 0xD0, 0x00,  // invest
+    0x4B, 0xAC, 0x9A, 0x14, 0x00,  // invite
+    0x4B, 0xAC, 0xF6, 0x58, 0xA0,  // involve
+    0x4C, 0x9E, 0xE0, 0x00, 0x00,  // iron
+    0x4C, 0xD8, 0x17, 0x10, 0x00,  // island
+    0x4C, 0xDE, 0xC0, 0xD0, 0xA0,  // isolate
+    0x4C, 0xE7, 0x52, 0x80, 0x00,  // issue
+    0x4D, 0x0A, 0xD0, 0x00, 0x00,  // item
+    0x4D, 0x9F, 0x2C, 0x80, 0x00,  // ivory
+    0x50, 0x46, 0xB2, 0xD0, 0x00,  // jacket
+    0x50, 0x4F, 0x50, 0xC8, 0x00,  // jaguar
+    0x50, 0x64, 0x00, 0x00, 0x00,  // jar
+    0x50, 0x75, 0xA0, 0x00, 0x00,  // jazz
+    0x51, 0x42, 0xC7, 0xD6, 0x60,  // jealous
+    0x51, 0x42, 0xE9, 0x80, 0x00,  // jeans
+    0x51, 0x58, 0xCC, 0x80, 0x00,  // jelly
+    0x51, 0x6E, 0x56, 0x00, 0x00,  // jewel
+    0x53, 0xC4, 0x00, 0x00, 0x00,  // job
+    0x53, 0xD2, 0xE0, 0x00, 0x00,  // join
+    0x53, 0xD6, 0x50, 0x00, 0x00,  // joke
+    0x53, 0xEB, 0x27, 0x17, 0x20,  // journey
+    0x53, 0xF2, 0x00, 0x00, 0x00,  // joy
+    0x55, 0x48, 0x72, 0x80, 0x00,  // judge
+    0x55, 0x52, 0x32, 0x80, 0x00,  // juice
+    0x55, 0x5B, 0x00, 0x00, 0x00,  // jump
+    0x55, 0x5C, 0x76, 0x14, 0x00,  // jungle
+    0x55, 0x5C, 0x97, 0xC8, 0x00,  // junior
+    0x55, 0x5C, 0xB0, 0x00, 0x00,  // junk
+    0x55, 0x67, 0x40, 0x00, 0x00,  // just
+    0x58, 0x5C, 0x70, 0xC9, 0xEF,  // kangaroo
+    0x59, 0x4A, 0xE0, 0x00, 0x00,  // keen
+    0x59, 0x4B, 0x00, 0x00, 0x00,  // keep
+    0x59, 0x68, 0x34, 0x56, 0x00,  // ketchup
+    0x59, 0x72, 0x00, 0x00, 0x00,  // key
+    0x5A, 0x46, 0xB0, 0x00, 0x00,  // kick
+    0x5A, 0x48, 0x00, 0x00, 0x00,  // kid
+    0x5A, 0x48, 0xE2, 0xE4, 0x00,  // kidney
+    0x5A, 0x5C, 0x40, 0x00, 0x00,  // kind
+    0x5A, 0x5C, 0x72, 0x3D, 0xA0,  // kingdom
+    0x5A, 0x67, 0x30, 0x00, 0x00,  // kiss
+    0x5A, 0x68, 0x00, 0x00, 0x00,  // kit
+    0x5A, 0x68, 0x34, 0x15, 0xC0,  // kitchen
+    0x5A, 0x68, 0x50, 0x00, 0x00,  // kite
+    0x5A, 0x69, 0x42, 0xB8, 0x00,  // kitten
+    0x5A, 0x6E, 0x90, 0x00, 0x00,  // kiwi
+    0x5B, 0x8A, 0x50, 0x00, 0x00,  // knee
+    0x5B, 0x92, 0x62, 0x80, 0x00,  // knife
+    0x5B, 0x9E, 0x35, 0x80, 0x00,  // knock
+    0x5B, 0x9F, 0x70, 0x00, 0x00,  // know
+    0x60, 0x44, 0x00, 0x00, 0x00,  // lab
+    0x60, 0x44, 0x56, 0x00, 0x00,  // label
+    0x60, 0x44, 0xF9, 0x00, 0x00,  // labor
+    0x60, 0x48, 0x42, 0xC8, 0x00,  // ladder
+    0x60, 0x49, 0x90, 0x00, 0x00,  // lady
+    0x60, 0x56, 0x50, 0x00, 0x00,  // lake
+    0x60, 0x5B, 0x00, 0x00, 0x00,  // lamp
+    0x60, 0x5C, 0x7A, 0x84, 0xE5,  // language
+    0x60, 0x61, 0x47, 0xC0, 0x00,  // laptop
+    0x60, 0x64, 0x72, 0x80, 0x00,  // large
+    0x60, 0x68, 0x59, 0x00, 0x00,  // later
+    0x60, 0x68, 0x97, 0x00, 0x00,  // latin
+    0x60, 0x6A, 0x74, 0x00, 0x00,  // laugh
+    0x60, 0x6A, 0xE2, 0x4B, 0x20,  // laundry
+    0x60, 0x6C, 0x10, 0x00, 0x00,  // lava
+    0x60, 0x6E, 0x00, 0x00, 0x00,  // law
+    0x60, 0x6E, 0xE0, 0x00, 0x00,  // lawn
+    0x60, 0x6F, 0x3A, 0xA6, 0x80,  // lawsuit
+    0x60, 0x72, 0x59, 0x00, 0x00,  // layer
+    0x60, 0x75, 0x90, 0x00, 0x00,  // lazy
+    0x61, 0x42, 0x42, 0xC8, 0x00,  // leader
+    0x61, 0x42, 0x60, 0x00, 0x00,  // leaf
+    0x61, 0x43, 0x27, 0x00, 0x00,  // learn
+    0x61, 0x43, 0x62, 0x80, 0x00,  // leave
+    0x61, 0x47, 0x4A, 0xC8, 0xA0,  // lecture
+    0x61, 0x4D, 0x40, 0x00, 0x00,  // left
+    0x61, 0x4E, 0x00, 0x00, 0x00,  // leg
+    0x61, 0x4E, 0x16, 0x00, 0x00,  // legal
+    0x61, 0x4E, 0x57, 0x10, 0x00,  // legend
+    0x61, 0x53, 0x3A, 0xC8, 0xA0,  // leisure
+    0x61, 0x5A, 0xF7, 0x00, 0x00,  // lemon
+    0x61, 0x5C, 0x40, 0x00, 0x00,  // lend
+    0x61, 0x5C, 0x7A, 0x20, 0x00,  // length
+    0x61, 0x5D, 0x30, 0x00, 0x00,  // lens
+    0x61, 0x5F, 0x00, 0xC8, 0x80,  // leopard
+    0x61, 0x67, 0x37, 0xB8, 0x00,  // lesson
+    0x61, 0x69, 0x42, 0xC8, 0x00,  // letter
+    0x61, 0x6C, 0x56, 0x00, 0x00,  // level
+    0x62, 0x43, 0x20, 0x00, 0x00,  // liar
+    0x62, 0x44, 0x59, 0x53, 0x20,  // liberty
+    0x62, 0x45, 0x20, 0xCB, 0x20,  // library
+    0x62, 0x46, 0x57, 0x4C, 0xA0,  // license
+    0x62, 0x4C, 0x50, 0x00, 0x00,  // life
+    0x62, 0x4D, 0x40, 0x00, 0x00,  // lift
+    0x62, 0x4E, 0x8A, 0x00, 0x00,  // light
+    0x62, 0x56, 0x50, 0x00, 0x00,  // like
+    0x62, 0x5A, 0x20, 0x00, 0x00,  // limb
+    0x62, 0x5A, 0x9A, 0x00, 0x00,  // limit
+    0x62, 0x5C, 0xB0, 0x00, 0x00,  // link
+    0x62, 0x5E, 0xE0, 0x00, 0x00,  // lion
+    0x62, 0x63, 0x54, 0x90, 0x00,  // liquid
+    0x62, 0x67, 0x40, 0x00, 0x00,  // list
+    0x62, 0x69, 0x46, 0x14, 0x00,  // little
+    0x62, 0x6C, 0x50, 0x00, 0x00,  // live
+    0x62, 0x74, 0x19, 0x10, 0x00,  // lizard
+    0x63, 0xC2, 0x40, 0x00, 0x00,  // load
+    0x63, 0xC2, 0xE0, 0x00, 0x00,  // loan
+    0x63, 0xC5, 0x3A, 0x16, 0x40,  // lobster
+    0x63, 0xC6, 0x16, 0x00, 0x00,  // local
+    0x63, 0xC6, 0xB0, 0x00, 0x00,  // lock
+    0x63, 0xCE, 0x91, 0x80, 0x00,  // logic
+    0x63, 0xDC, 0x56, 0x64, 0x00,  // lonely
+    0x63, 0xDC, 0x70, 0x00, 0x00,  // long
+    0x63, 0xDF, 0x00, 0x00, 0x00,  // loop
+    0x63, 0xE9, 0x42, 0xCB, 0x20,  // lottery
+    0x63, 0xEA, 0x40, 0x00, 0x00,  // loud
+    0x63, 0xEA, 0xE3, 0x94, 0x00,  // lounge
+    0x63, 0xEC, 0x50, 0x00, 0x00,  // love
+    0x63, 0xF2, 0x16, 0x00, 0x00,  // loyal
+    0x65, 0x46, 0xBC, 0x80, 0x00,  // lucky
+    0x65, 0x4E, 0x70, 0x9C, 0xA0,  // luggage
+    0x65, 0x5A, 0x22, 0xC8, 0x00,  // lumber
+    0x65, 0x5C, 0x19, 0x00, 0x00,  // lunar
+    0x65, 0x5C, 0x34, 0x00, 0x00,  // lunch
+    0x65, 0x71, 0x59, 0x64, 0x00,  // luxury
+    0x66, 0x64, 0x91, 0xCC, 0x00,  // lyrics
+    0x68, 0x46, 0x84, 0xB8, 0xA0,  // machine
+    0x68, 0x48, 0x00, 0x00, 0x00,  // mad
+    0x68, 0x4E, 0x91, 0x80, 0x00,  // magic
+    0x68, 0x4E, 0xE2, 0xD0, 0x00,  // magnet
+    0x68, 0x52, 0x40, 0x00, 0x00,  // maid
+    0x68, 0x52, 0xC0, 0x00, 0x00,  // mail
+    0x68, 0x52, 0xE0, 0x00, 0x00,  // main
+    0x68, 0x54, 0xF9, 0x00, 0x00,  // major
+    0x68, 0x56, 0x50, 0x00, 0x00,  // make
+    0x68, 0x5A, 0xD0, 0xB0, 0x00,  // mammal
+    0x68, 0x5C, 0x00, 0x00, 0x00,  // man
+    0x68, 0x5C, 0x13, 0x94, 0x00,  // manage
+    0x68, 0x5C, 0x40, 0xD0, 0xA0,  // mandate
+    0x68, 0x5C, 0x77, 0x80, 0x00,  // mango
+    0x68, 0x5D, 0x34, 0xBD, 0xC0,  // mansion
+    0x68, 0x5D, 0x50, 0xB0, 0x00,  // manual
+    0x68, 0x60, 0xC2, 0x80, 0x00,  // maple
+    0x68, 0x64, 0x26, 0x14, 0x00,  // marble
+    0x68, 0x64, 0x34, 0x00, 0x00,  // march
+    0x68, 0x64, 0x74, 0xB8, 0x00,  // margin
+    0x68, 0x64, 0x97, 0x14, 0x00,  // marine
+    0x68, 0x64, 0xB2, 0xD0, 0x00,  // market
+    0x68, 0x65, 0x24, 0x84, 0xE5,  // marriage
+    0x68, 0x66, 0xB0, 0x00, 0x00,  // mask
+    0x68, 0x67, 0x30, 0x00, 0x00,  // mass
+    0x68, 0x67, 0x42, 0xC8, 0x00,  // master
+    0x68, 0x68, 0x34, 0x00, 0x00,  // match
+    0x68, 0x68, 0x59, 0x24, 0x2C,  // material
+    0x68, 0x68, 0x80, 0x00, 0x00,  // math
+    0x68, 0x69, 0x24, 0xE0, 0x00,  // matrix
+    0x68, 0x69, 0x42, 0xC8, 0x00,  // matter
+    0x68, 0x70, 0x96, 0xD5, 0xA0,  // maximum
+    0x68, 0x74, 0x50, 0x00, 0x00,  // maze
+    0x69, 0x42, 0x47, 0xDC, 0x00,  // meadow
+    0x69, 0x42, 0xE0, 0x00, 0x00,  // mean
+    0x69, 0x43, 0x3A, 0xC8, 0xA0,  // measure
+    0x69, 0x43, 0x40, 0x00, 0x00,  // meat
+    0x69, 0x46, 0x80, 0xB9, 0x23,  // mechanic
+    0x69, 0x48, 0x16, 0x00, 0x00,  // medal
+    0x69, 0x48, 0x90, 0x80, 0x00,  // media
+    0x69, 0x58, 0xF2, 0x64, 0x00,  // melody
+    0x69, 0x59, 0x40, 0x00, 0x00,  // melt
+    0x69, 0x5A, 0x22, 0xC8, 0x00,  // member
+    0x69, 0x5A, 0xF9, 0x64, 0x00,  // memory
+    0x69, 0x5D, 0x44, 0xBD, 0xC0,  // mention
+    0x69, 0x5D, 0x50, 0x00, 0x00,  // menu
+    0x69, 0x64, 0x3C, 0x80, 0x00,  // mercy
+    0x69, 0x64, 0x72, 0x80, 0x00,  // merge
+    0x69, 0x64, 0x9A, 0x00, 0x00,  // merit
+    0x69, 0x65, 0x2C, 0x80, 0x00,  // merry
+    0x69, 0x66, 0x80, 0x00, 0x00,  // mesh
+    0x69, 0x67, 0x30, 0x9C, 0xA0,  // message
+    0x69, 0x68, 0x16, 0x00, 0x00,  // metal
+    0x69, 0x68, 0x87, 0x90, 0x00,  // method
+    0x6A, 0x48, 0x46, 0x14, 0x00,  // middle
+    0x6A, 0x48, 0xE4, 0x9D, 0x14,  // midnight
+    0x6A, 0x58, 0xB0, 0x00, 0x00,  // milk
+    0x6A, 0x58, 0xC4, 0xBD, 0xC0,  // million
+    0x6A, 0x5A, 0x91, 0x80, 0x00,  // mimic
+    0x6A, 0x5C, 0x40, 0x00, 0x00,  // mind
+    0x6A, 0x5C, 0x96, 0xD5, 0xA0,  // minimum
+    0x6A, 0x5C, 0xF9, 0x00, 0x00,  // minor
+    0x6A, 0x5D, 0x5A, 0x14, 0x00,  // minute
+    0x6A, 0x64, 0x11, 0xB0, 0xA0,  // miracle
+    0x6A, 0x65, 0x27, 0xC8, 0x00,  // mirror
+    0x6A, 0x66, 0x59, 0x64, 0x00,  // misery
+    0x6A, 0x67, 0x30, 0x00, 0x00,  // miss
+    0x6A, 0x67, 0x40, 0xAC, 0xA0,  // mistake
+    0x6A, 0x70, 0x00, 0x00, 0x00,  // mix
+    0x6A, 0x70, 0x52, 0x00, 0x00,  // mixed
+    0x6A, 0x71, 0x4A, 0xC8, 0xA0,  // mixture
+    0x6B, 0xC4, 0x96, 0x14, 0x00,  // mobile
+    0x6B, 0xC8, 0x56, 0x00, 0x00,  // model
+    0x6B, 0xC8, 0x93, 0x64, 0x00,  // modify
+    0x6B, 0xDA, 0x00, 0x00, 0x00,  // mom
+    0x6B, 0xDA, 0x57, 0x50, 0x00,  // moment
+    0x6B, 0xDC, 0x9A, 0x3E, 0x40,  // monitor
+    0x6B, 0xDC, 0xB2, 0xE4, 0x00,  // monkey
+    0x6B, 0xDD, 0x3A, 0x16, 0x40,  // monster
+    0x6B, 0xDD, 0x44, 0x00, 0x00,  // month
+    0x6B, 0xDE, 0xE0, 0x00, 0x00,  // moon
+    0x6B, 0xE4, 0x16, 0x00, 0x00,  // moral
+    0x6B, 0xE4, 0x50, 0x00, 0x00,  // more
+    0x6B, 0xE4, 0xE4, 0xB8, 0xE0,  // morning
+    0x6B, 0xE7, 0x1A, 0xA6, 0x8F,  // mosquito
+    0x6B, 0xE8, 0x82, 0xC8, 0x00,  // mother
+    0x6B, 0xE8, 0x97, 0xB8, 0x00,  // motion
+    0x6B, 0xE8, 0xF9, 0x00, 0x00,  // motor
+    0x6B, 0xEA, 0xEA, 0x05, 0x2E,  // mountain
+    0x6B, 0xEB, 0x32, 0x80, 0x00,  // mouse
+    0x6B, 0xEC, 0x50, 0x00, 0x00,  // move
+    0x6B, 0xEC, 0x92, 0x80, 0x00,  // movie
+    0x6D, 0x46, 0x80, 0x00, 0x00,  // much
+    0x6D, 0x4C, 0x64, 0xB8, 0x00,  // muffin
+    0x6D, 0x58, 0x50, 0x00, 0x00,  // mule
+    0x6D, 0x59, 0x44, 0xC1, 0x99,  // multiply
+    0x6D, 0x66, 0x36, 0x14, 0x00,  // muscle
+    0x6D, 0x66, 0x5A, 0xB4, 0x00,  // museum
+    0x6D, 0x66, 0x89, 0x3D, 0xED,  // mushroom
+    0x6D, 0x66, 0x91, 0x80, 0x00,  // music
+    0x6D, 0x67, 0x40, 0x00, 0x00,  // must
+    0x6D, 0x69, 0x50, 0xB0, 0x00,  // mutual
+    0x6E, 0x66, 0x56, 0x18, 0x00,  // myself
+    0x6E, 0x67, 0x42, 0xCB, 0x20,  // mystery
+    0x6E, 0x68, 0x80, 0x00, 0x00,  // myth
+    0x70, 0x53, 0x62, 0x80, 0x00,  // naive
+    0x70, 0x5A, 0x50, 0x00, 0x00,  // name
+    0x70, 0x60, 0xB4, 0xB8, 0x00,  // napkin
+    0x70, 0x65, 0x27, 0xDC, 0x00,  // narrow
+    0x70, 0x67, 0x4C, 0x80, 0x00,  // nasty
+    0x70, 0x68, 0x97, 0xB8, 0x00,  // nation
+    0x70, 0x69, 0x59, 0x14, 0x00,  // nature
+    0x71, 0x43, 0x20, 0x00, 0x00,  // near
+    0x71, 0x46, 0xB0, 0x00, 0x00,  // neck
+    0x71, 0x4A, 0x40, 0x00, 0x00,  // need
+    0x71, 0x4E, 0x1A, 0x26, 0xC5,  // negative
+    0x71, 0x4E, 0xC2, 0x8E, 0x80,  // neglect
+    0x71, 0x53, 0x44, 0x16, 0x40,  // neither
+    0x71, 0x60, 0x82, 0xDC, 0x00,  // nephew
+    0x71, 0x65, 0x62, 0x80, 0x00,  // nerve
+    0x71, 0x67, 0x40, 0x00, 0x00,  // nest
+    0x71, 0x68, 0x00, 0x00, 0x00,  // net
+    0x71, 0x69, 0x77, 0xC9, 0x60,  // network
+    0x71, 0x6B, 0x49, 0x05, 0x80,  // neutral
+    0x71, 0x6C, 0x59, 0x00, 0x00,  // never
+    0x71, 0x6F, 0x30, 0x00, 0x00,  // news
+    0x71, 0x71, 0x40, 0x00, 0x00,  // next
+    0x72, 0x46, 0x50, 0x00, 0x00,  // nice
+    0x72, 0x4E, 0x8A, 0x00, 0x00,  // night
+    0x73, 0xC4, 0xC2, 0x80, 0x00,  // noble
+    0x73, 0xD3, 0x32, 0x80, 0x00,  // noise
+    0x73, 0xDA, 0x97, 0x14, 0xA0,  // nominee
+    0x73, 0xDE, 0x46, 0x14, 0x00,  // noodle
+    0x73, 0xE4, 0xD0, 0xB0, 0x00,  // normal
+    0x73, 0xE5, 0x44, 0x00, 0x00,  // north
+    0x73, 0xE6, 0x50, 0x00, 0x00,  // nose
+    0x73, 0xE8, 0x11, 0x30, 0xA0,  // notable
+    0x73, 0xE8, 0x50, 0x00, 0x00,  // note
+    0x73, 0xE8, 0x84, 0xB8, 0xE0,  // nothing
+    0x73, 0xE8, 0x91, 0x94, 0x00,  // notice
+    0x73, 0xEC, 0x56, 0x00, 0x00,  // novel
+    0x73, 0xEE, 0x00, 0x00, 0x00,  // now
+    0x75, 0x46, 0xC2, 0x86, 0x40,  // nuclear
+    0x75, 0x5A, 0x22, 0xC8, 0x00,  // number
+    0x75, 0x65, 0x32, 0x80, 0x00,  // nurse
+    0x75, 0x68, 0x00, 0x00, 0x00,  // nut
+    0x78, 0x56, 0x00, 0x00, 0x00,  // oak
+    0x78, 0x8B, 0x90, 0x00, 0x00,  // obey
+    0x78, 0x94, 0x51, 0xD0, 0x00,  // object
+    0x78, 0x98, 0x93, 0x94, 0x00,  // oblige
+    0x78, 0xA6, 0x3A, 0xC8, 0xA0,  // obscure
+    0x78, 0xA6, 0x59, 0x58, 0xA0,  // observe
+    0x78, 0xA8, 0x14, 0xB8, 0x00,  // obtain
+    0x78, 0xAC, 0x97, 0xD6, 0x60,  // obvious
+    0x78, 0xC7, 0x59, 0x00, 0x00,  // occur
+    0x78, 0xCA, 0x17, 0x00, 0x00,  // ocean
+    0x78, 0xE8, 0xF1, 0x16, 0x40,  // october
+    0x79, 0x1F, 0x20, 0x00, 0x00,  // odor
+    0x79, 0x8C, 0x00, 0x00, 0x00,  // off
+    0x79, 0x8C, 0x59, 0x00, 0x00,  // offer
+    0x79, 0x8C, 0x91, 0x94, 0x00,  // office
+    0x79, 0xA8, 0x57, 0x00, 0x00,  // often
+    0x7A, 0x58, 0x00, 0x00, 0x00,  // oil
+    0x7A, 0xC3, 0x90, 0x00, 0x00,  // okay
+    0x7B, 0x08, 0x00, 0x00, 0x00,  // old
+    0x7B, 0x13, 0x62, 0x80, 0x00,  // olive
+    0x7B, 0x32, 0xD8, 0x24, 0x60,  // olympic
+    0x7B, 0x53, 0x40, 0x00, 0x00,  // omit
+    0x7B, 0x86, 0x50, 0x00, 0x00,  // once
+    0x7B, 0x8A, 0x00, 0x00, 0x00,  // one
+    0x7B, 0x92, 0xF7, 0x00, 0x00,  // onion
+    0x7B, 0x98, 0x97, 0x14, 0x00,  // online
+    0x7B, 0x99, 0x90, 0x00, 0x00,  // only
+    0x7C, 0x0A, 0xE0, 0x00, 0x00,  // open
+    0x7C, 0x0B, 0x20, 0x80, 0x00,  // opera
+    0x7C, 0x12, 0xE4, 0xBD, 0xC0,  // opinion
+    0x7C, 0x20, 0xF9, 0x94, 0x00,  // oppose
+    0x7C, 0x28, 0x97, 0xB8, 0x00,  // option
+    0x7C, 0x82, 0xE3, 0x94, 0x00,  // orange
+    0x7C, 0x84, 0x9A, 0x00, 0x00,  // orbit
+    0x7C, 0x86, 0x80, 0xC8, 0x80,  // orchard
+    0x7C, 0x88, 0x59, 0x00, 0x00,  // order
+    0x7C, 0x88, 0x97, 0x06, 0x59,  // ordinary
+    0x7C, 0x8E, 0x17, 0x00, 0x00,  // organ
+    0x7C, 0x92, 0x57, 0x50, 0x00,  // orient
+    0x7C, 0x92, 0x74, 0xB8, 0x2C,  // original
+    0x7C, 0xA0, 0x80, 0xB8, 0x00,  // orphan
+    0x7C, 0xE9, 0x24, 0x8D, 0x00,  // ostrich
+    0x7D, 0x10, 0x59, 0x00, 0x00,  // other
+    0x7D, 0x68, 0x47, 0xBE, 0x40,  // outdoor
+    0x7D, 0x68, 0x59, 0x00, 0x00,  // outer
+    0x7D, 0x69, 0x0A, 0xD0, 0x00,  // output
+    0x7D, 0x69, 0x34, 0x90, 0xA0,  // outside
+    0x7D, 0x82, 0xC0, 0x00, 0x00,  // oval
+    0x7D, 0x8A, 0xE0, 0x00, 0x00,  // oven
+    0x7D, 0x8B, 0x20, 0x00, 0x00,  // over
+    0x7D, 0xDC, 0x00, 0x00, 0x00,  // own
+    0x7D, 0xDC, 0x59, 0x00, 0x00,  // owner
+    0x7E, 0x32, 0x72, 0xB8, 0x00,  // oxygen
+    0x7E, 0x67, 0x42, 0xC8, 0x00,  // oyster
+    0x7E, 0x9E, 0xE2, 0x80, 0x00,  // ozone
+    0x80, 0x47, 0x40, 0x00, 0x00,  // pact
+    0x80, 0x48, 0x46, 0x14, 0x00,  // paddle
+    0x80, 0x4E, 0x50, 0x00, 0x00,  // page
+    0x80, 0x53, 0x20, 0x00, 0x00,  // pair
+    0x80, 0x58, 0x11, 0x94, 0x00,  // palace
+    0x80, 0x58, 0xD0, 0x00, 0x00,  // palm
+    0x80, 0x5C, 0x40, 0x80, 0x00,  // panda
+    0x80, 0x5C, 0x56, 0x00, 0x00,  // panel
+    0x80, 0x5C, 0x91, 0x80, 0x00,  // panic
+    0x80, 0x5D, 0x44, 0x16, 0x40,  // panther
+    0x80, 0x60, 0x59, 0x00, 0x00,  // paper
+    0x80, 0x64, 0x12, 0x14, 0x00,  // parade
+    0x80, 0x64, 0x57, 0x50, 0x00,  // parent
+    0x80, 0x64, 0xB0, 0x00, 0x00,  // park
+    0x80, 0x65, 0x27, 0xD0, 0x00,  // parrot
+    0x80, 0x65, 0x4C, 0x80, 0x00,  // party
+    0x80, 0x67, 0x30, 0x00, 0x00,  // pass
+    0x80, 0x68, 0x34, 0x00, 0x00,  // patch
+    0x80, 0x68, 0x80, 0x00, 0x00,  // path
+    0x80, 0x68, 0x92, 0xBA, 0x80,  // patient
+    0x80, 0x69, 0x27, 0xB0, 0x00,  // patrol
+    0x80, 0x69, 0x42, 0xC9, 0xC0,  // pattern
+    0x80, 0x6B, 0x32, 0x80, 0x00,  // pause
+    0x80, 0x6C, 0x50, 0x00, 0x00,  // pave
+    0x80, 0x72, 0xD2, 0xBA, 0x80,  // payment
+    0x81, 0x42, 0x32, 0x80, 0x00,  // peace
+    0x81, 0x42, 0xEA, 0xD0, 0x00,  // peanut
+    0x81, 0x43, 0x20, 0x00, 0x00,  // pear
+    0x81, 0x43, 0x30, 0xBA, 0x80,  // peasant
+    0x81, 0x58, 0x91, 0x85, 0xC0,  // pelican
+    0x81, 0x5C, 0x00, 0x00, 0x00,  // pen
+    0x81, 0x5C, 0x16, 0x53, 0x20,  // penalty
+    0x81, 0x5C, 0x34, 0xB0, 0x00,  // pencil
+    0x81, 0x5F, 0x06, 0x14, 0x00,  // people
+    0x81, 0x61, 0x02, 0xC8, 0x00,  // pepper
+    0x81, 0x64, 0x62, 0x8E, 0x80,  // perfect
+    0x81, 0x64, 0xD4, 0xD0, 0x00,  // permit
+    0x81, 0x65, 0x37, 0xB8, 0x00,  // person
+    0x81, 0x68, 0x00, 0x00, 0x00,  // pet
+    0x82, 0x1E, 0xE2, 0x80, 0x00,  // phone
+    0x82, 0x1F, 0x47, 0x80, 0x00,  // photo
+    0x82, 0x24, 0x19, 0x94, 0x00,  // phrase
+    0x82, 0x33, 0x34, 0x8C, 0x2C,  // physical
+    0x82, 0x42, 0xE7, 0x80, 0x00,  // piano
+    0x82, 0x46, 0xE4, 0x8C, 0x00,  // picnic
+    0x82, 0x47, 0x4A, 0xC8, 0xA0,  // picture
+    0x82, 0x4A, 0x32, 0x80, 0x00,  // piece
+    0x82, 0x4E, 0x00, 0x00, 0x00,  // pig
+    0x82, 0x4E, 0x57, 0xB8, 0x00,  // pigeon
+    0x82, 0x58, 0xC0, 0x00, 0x00,  // pill
+    0x82, 0x58, 0xFA, 0x00, 0x00,  // pilot
+    0x82, 0x5C, 0xB0, 0x00, 0x00,  // pink
+    0x82, 0x5E, 0xE2, 0x96, 0x40,  // pioneer
+    0x82, 0x60, 0x50, 0x00, 0x00,  // pipe
+    0x82, 0x67, 0x47, 0xB0, 0x00,  // pistol
+    0x82, 0x68, 0x34, 0x00, 0x00,  // pitch
+    0x82, 0x75, 0xA0, 0x80, 0x00,  // pizza
+    0x83, 0x02, 0x32, 0x80, 0x00,  // place
+    0x83, 0x02, 0xE2, 0xD0, 0x00,  // planet
+    0x83, 0x03, 0x3A, 0x24, 0x60,  // plastic
+    0x83, 0x03, 0x42, 0x80, 0x00,  // plate
+    0x83, 0x03, 0x90, 0x00, 0x00,  // play
+    0x83, 0x0A, 0x19, 0x94, 0x00,  // please
+    0x83, 0x0A, 0x43, 0x94, 0x00,  // pledge
+    0x83, 0x2A, 0x35, 0x80, 0x00,  // pluck
+    0x83, 0x2A, 0x70, 0x00, 0x00,  // plug
+    0x83, 0x2A, 0xE3, 0x94, 0x00,  // plunge
+    0x83, 0xCA, 0xD0, 0x00, 0x00,  // poem
+    0x83, 0xCB, 0x40, 0x00, 0x00,  // poet
+    0x83, 0xD2, 0xEA, 0x00, 0x00,  // point
+    0x83, 0xD8, 0x19, 0x00, 0x00,  // polar
+    0x83, 0xD8, 0x50, 0x00, 0x00,  // pole
+    0x83, 0xD8, 0x91, 0x94, 0x00,  // police
+    0x83, 0xDC, 0x40, 0x00, 0x00,  // pond
+    0x83, 0xDD, 0x90, 0x00, 0x00,  // pony
+    0x83, 0xDE, 0xC0, 0x00, 0x00,  // pool
+    0x83, 0xE1, 0x56, 0x06, 0x40,  // popular
+    0x83, 0xE5, 0x44, 0xBD, 0xC0,  // portion
+    0x83, 0xE6, 0x9A, 0x25, 0xEE,  // position
+    0x83, 0xE7, 0x34, 0x89, 0x85,  // possible
+    0x83, 0xE7, 0x40, 0x00, 0x00,  // post
+    0x83, 0xE8, 0x1A, 0x3C, 0x00,  // potato
+    0x83, 0xE9, 0x42, 0xCB, 0x20,  // pottery
+    0x83, 0xEC, 0x59, 0x53, 0x20,  // poverty
+    0x83, 0xEE, 0x42, 0xC8, 0x00,  // powder
+    0x83, 0xEE, 0x59, 0x00, 0x00,  // power
+    0x84, 0x82, 0x3A, 0x24, 0x65,  // practice
+    0x84, 0x82, 0x99, 0x94, 0x00,  // praise
+    0x84, 0x8A, 0x44, 0x8E, 0x80,  // predict
+    0x84, 0x8A, 0x62, 0xC8, 0x00,  // prefer
+    0x84, 0x8B, 0x00, 0xC8, 0xA0,  // prepare
+    0x84, 0x8B, 0x32, 0xBA, 0x80,  // present
+    0x84, 0x8B, 0x4A, 0x64, 0x00,  // pretty
+    0x84, 0x8B, 0x62, 0xBA, 0x80,  // prevent
+    0x84, 0x92, 0x32, 0x80, 0x00,  // price
+    0x84, 0x92, 0x42, 0x80, 0x00,  // pride
+    0x84, 0x92, 0xD0, 0xCB, 0x20,  // primary
+    0x84, 0x92, 0xEA, 0x00, 0x00,  // print
+    0x84, 0x92, 0xF9, 0x26, 0x99,  // priority
+    0x84, 0x93, 0x37, 0xB8, 0x00,  // prison
+    0x84, 0x93, 0x60, 0xD0, 0xA0,  // private
+    0x84, 0x93, 0xA2, 0x80, 0x00,  // prize
+    0x84, 0x9E, 0x26, 0x15, 0xA0,  // problem
+    0x84, 0x9E, 0x32, 0xCE, 0x60,  // process
+    0x84, 0x9E, 0x4A, 0x8C, 0xA0,  // produce
+    0x84, 0x9E, 0x64, 0xD0, 0x00,  // profit
+    0x84, 0x9E, 0x79, 0x05, 0xA0,  // program
+    0x84, 0x9E, 0xA2, 0x8E, 0x80,  // project
+    0x84, 0x9E, 0xD7, 0xD0, 0xA0,  // promote
+    0x84, 0x9E, 0xF3, 0x00, 0x00,  // proof
+    0x84, 0x9F, 0x02, 0xCA, 0x99,  // property
+    0x84, 0x9F, 0x38, 0x16, 0x40,  // prosper
+    0x84, 0x9F, 0x42, 0x8E, 0x80,  // protect
+    0x84, 0x9F, 0x52, 0x00, 0x00,  // proud
+    0x84, 0x9F, 0x64, 0x90, 0xA0,  // provide
+    0x85, 0x44, 0xC4, 0x8C, 0x00,  // public
+    0x85, 0x48, 0x44, 0xB8, 0xE0,  // pudding
+    0x85, 0x58, 0xC0, 0x00, 0x00,  // pull
+    0x85, 0x59, 0x00, 0x00, 0x00,  // pulp
+    0x85, 0x59, 0x32, 0x80, 0x00,  // pulse
+    0x85, 0x5B, 0x05, 0xA5, 0xC0,  // pumpkin
+    0x85, 0x5C, 0x34, 0x00, 0x00,  // punch
+    0x85, 0x60, 0x96, 0x00, 0x00,  // pupil
+    0x85, 0x61, 0x0C, 0x80, 0x00,  // puppy
+    0x85, 0x64, 0x34, 0x06, 0x65,  // purchase
+    0x85, 0x64, 0x9A, 0x64, 0x00,  // purity
+    0x85, 0x65, 0x07, 0xCC, 0xA0,  // purpose
+    0x85, 0x65, 0x32, 0x80, 0x00,  // purse
+    0x85, 0x66, 0x80, 0x00, 0x00,  // push
+    0x85, 0x68, 0x00, 0x00, 0x00,  // put
+    0x85, 0x75, 0xA6, 0x14, 0x00,  // puzzle
+    0x86, 0x64, 0x16, 0xA4, 0x80,  // pyramid
+    0x8D, 0x42, 0xC4, 0xD3, 0x20,  // quality
+    0x8D, 0x42, 0xEA, 0x55, 0xA0,  // quantum
+    0x8D, 0x43, 0x2A, 0x16, 0x40,  // quarter
+    0x8D, 0x4B, 0x3A, 0x25, 0xEE,  // question
+    0x8D, 0x52, 0x35, 0x80, 0x00,  // quick
+    0x8D, 0x53, 0x40, 0x00, 0x00,  // quit
+    0x8D, 0x53, 0xA0, 0x00, 0x00,  // quiz
+    0x8D, 0x5F, 0x42, 0x80, 0x00,  // quote
+    0x90, 0x44, 0x24, 0xD0, 0x00,  // rabbit
+    0x90, 0x46, 0x37, 0xBD, 0xC0,  // raccoon
+    0x90, 0x46, 0x50, 0x00, 0x00,  // race
+    0x90, 0x46, 0xB0, 0x00, 0x00,  // rack
+    0x90, 0x48, 0x19, 0x00, 0x00,  // radar
+    0x90, 0x48, 0x97, 0x80, 0x00,  // radio
+    0x90, 0x52, 0xC0, 0x00, 0x00,  // rail
+    0x90, 0x52, 0xE0, 0x00, 0x00,  // rain
+    0x90, 0x53, 0x32, 0x80, 0x00,  // raise
+    0x90, 0x58, 0xCC, 0x80, 0x00,  // rally
+    0x90, 0x5B, 0x00, 0x00, 0x00,  // ramp
+    0x90, 0x5C, 0x34, 0x00, 0x00,  // ranch
+    0x90, 0x5C, 0x47, 0xB4, 0x00,  // random
+    0x90, 0x5C, 0x72, 0x80, 0x00,  // range
+    0x90, 0x60, 0x92, 0x00, 0x00,  // rapid
+    0x90, 0x64, 0x50, 0x00, 0x00,  // rare
+    0x90, 0x68, 0x50, 0x00, 0x00,  // rate
+    0x90, 0x68, 0x82, 0xC8, 0x00,  // rather
+    0x90, 0x6C, 0x57, 0x00, 0x00,  // raven
+    0x90, 0x6E, 0x00, 0x00, 0x00,  // raw
+    0x90, 0x74, 0xF9, 0x00, 0x00,  // razor
+    0x91, 0x42, 0x4C, 0x80, 0x00,  // ready
+    0x91, 0x42, 0xC0, 0x00, 0x00,  // real
+    0x91, 0x43, 0x37, 0xB8, 0x00,  // reason
+    0x91, 0x44, 0x56, 0x00, 0x00,  // rebel
+    0x91, 0x45, 0x54, 0xB0, 0x80,  // rebuild
+    0x91, 0x46, 0x16, 0x30, 0x00,  // recall
+    0x91, 0x46, 0x54, 0xD8, 0xA0,  // receive
+    0x91, 0x46, 0x98, 0x14, 0x00,  // recipe
+    0x91, 0x46, 0xF9, 0x10, 0x00,  // record
+    0x91, 0x47, 0x91, 0xB0, 0xA0,  // recycle
+    0x91, 0x49, 0x51, 0x94, 0x00,  // reduce
+    0x91, 0x4C, 0xC2, 0x8E, 0x80,  // reflect
+    0x91, 0x4C, 0xF9, 0x34, 0x00,  // reform
+    0x91, 0x4D, 0x59, 0x94, 0x00,  // refuse
+    0x91, 0x4E, 0x97, 0xB8, 0x00,  // region
+    0x91, 0x4F, 0x22, 0xD0, 0x00,  // regret
+    0x91, 0x4F, 0x56, 0x06, 0x40,  // regular
+    0x91, 0x54, 0x51, 0xD0, 0x00,  // reject
+    0x91, 0x58, 0x1C, 0x00, 0x00,  // relax
+    0x91, 0x58, 0x50, 0xCC, 0xA0,  // release
+    0x91, 0x58, 0x92, 0x98, 0x00,  // relief
+    0x91, 0x59, 0x90, 0x00, 0x00,  // rely
+    0x91, 0x5A, 0x14, 0xB8, 0x00,  // remain
+    0x91, 0x5A, 0x56, 0x88, 0xB2,  // remember
+    0x91, 0x5A, 0x97, 0x10, 0x00,  // remind
+    0x91, 0x5A, 0xFB, 0x14, 0x00,  // remove
+    0x91, 0x5C, 0x42, 0xC8, 0x00,  // render
+    0x91, 0x5C, 0x5B, 0x80, 0x00,  // renew
+    0x91, 0x5D, 0x40, 0x00, 0x00,  // rent
+    0x91, 0x5F, 0x02, 0xB8, 0x00,  // reopen
+    0x91, 0x60, 0x14, 0xC8, 0x00,  // repair
+    0x91, 0x60, 0x50, 0xD0, 0x00,  // repeat
+    0x91, 0x60, 0xC0, 0x8C, 0xA0,  // replace
+    0x91, 0x60, 0xF9, 0x50, 0x00,  // report
+    0x91, 0x63, 0x54, 0xC8, 0xA0,  // require
+    0x91, 0x66, 0x3A, 0x94, 0x00,  // rescue
+    0x91, 0x66, 0x56, 0x89, 0x85,  // resemble
+    0x91, 0x66, 0x99, 0xD0, 0x00,  // resist
+    0x91, 0x66, 0xFA, 0xC8, 0x65,  // resource
+    0x91, 0x67, 0x07, 0xBA, 0x65,  // response
+    0x91, 0x67, 0x56, 0x50, 0x00,  // result
+    0x91, 0x68, 0x99, 0x14, 0x00,  // retire
+    0x91, 0x69, 0x22, 0x86, 0x80,  // retreat
+    0x91, 0x69, 0x59, 0x38, 0x00,  // return
+    0x91, 0x6A, 0xE4, 0xBD, 0xC0,  // reunion
+    0x91, 0x6C, 0x50, 0xB0, 0x00,  // reveal
+    0x91, 0x6C, 0x92, 0xDC, 0x00,  // review
+    0x91, 0x6E, 0x19, 0x10, 0x00,  // reward
+    0x92, 0x33, 0x44, 0x34, 0x00,  // rhythm
+    0x92, 0x44, 0x00, 0x00, 0x00,  // rib
+    0x92, 0x44, 0x27, 0xB8, 0x00,  // ribbon
+    0x92, 0x46, 0x50, 0x00, 0x00,  // rice
+    0x92, 0x46, 0x80, 0x00, 0x00,  // rich
+    0x92, 0x48, 0x50, 0x00, 0x00,  // ride
+    0x92, 0x48, 0x72, 0x80, 0x00,  // ridge
+    0x92, 0x4C, 0xC2, 0x80, 0x00,  // rifle
+    0x92, 0x4E, 0x8A, 0x00, 0x00,  // right
+    0x92, 0x4E, 0x92, 0x00, 0x00,  // rigid
+    0x92, 0x5C, 0x70, 0x00, 0x00,  // ring
+    0x92, 0x5F, 0x40, 0x00, 0x00,  // riot
+    0x92, 0x61, 0x06, 0x14, 0x00,  // ripple
+    0x92, 0x66, 0xB0, 0x00, 0x00,  // risk
+    0x92, 0x69, 0x50, 0xB0, 0x00,  // ritual
+    0x92, 0x6C, 0x16, 0x00, 0x00,  // rival
+    0x92, 0x6C, 0x59, 0x00, 0x00,  // river
+    0x93, 0xC2, 0x40, 0x00, 0x00,  // road
+    0x93, 0xC3, 0x3A, 0x00, 0x00,  // roast
+    0x93, 0xC4, 0xFA, 0x00, 0x00,  // robot
+    0x93, 0xC5, 0x59, 0xD0, 0x00,  // robust
+    0x93, 0xC6, 0xB2, 0xD0, 0x00,  // rocket
+    0x93, 0xDA, 0x17, 0x0C, 0xA0,  // romance
+    0x93, 0xDE, 0x60, 0x00, 0x00,  // roof
+    0x93, 0xDE, 0xB4, 0x94, 0x00,  // rookie
+    0x93, 0xDE, 0xD0, 0x00, 0x00,  // room
+    0x93, 0xE6, 0x50, 0x00, 0x00,  // rose
+    0x93, 0xE8, 0x1A, 0x14, 0x00,  // rotate
+    0x93, 0xEA, 0x74, 0x00, 0x00,  // rough
+    0x93, 0xEA, 0xE2, 0x00, 0x00,  // round
+    0x93, 0xEB, 0x42, 0x80, 0x00,  // route
+    0x93, 0xF2, 0x16, 0x00, 0x00,  // royal
+    0x95, 0x44, 0x22, 0xC8, 0x00,  // rubber
+    0x95, 0x48, 0x50, 0x00, 0x00,  // rude
+    0x95, 0x4E, 0x00, 0x00, 0x00,  // rug
+    0x95, 0x58, 0x50, 0x00, 0x00,  // rule
+    0x95, 0x5C, 0x00, 0x00, 0x00,  // run
+    0x95, 0x5D, 0x70, 0xE4, 0x00,  // runway
+    0x95, 0x64, 0x16, 0x00, 0x00,  // rural
+    0x98, 0x48, 0x00, 0x00, 0x00,  // sad
+    0x98, 0x48, 0x46, 0x14, 0x00,  // saddle
+    0x98, 0x48, 0xE2, 0xCE, 0x60,  // sadness
+    0x98, 0x4C, 0x50, 0x00, 0x00,  // safe
+    0x98, 0x52, 0xC0, 0x00, 0x00,  // sail
+    0x98, 0x58, 0x12, 0x00, 0x00,  // salad
+    0x98, 0x58, 0xD7, 0xB8, 0x00,  // salmon
+    0x98, 0x58, 0xF7, 0x00, 0x00,  // salon
+    0x98, 0x59, 0x40, 0x00, 0x00,  // salt
+    0x98, 0x59, 0x5A, 0x14, 0x00,  // salute
+    0x98, 0x5A, 0x50, 0x00, 0x00,  // same
+    0x98, 0x5B, 0x06, 0x14, 0x00,  // sample
+    0x98, 0x5C, 0x40, 0x00, 0x00,  // sand
+    0x98, 0x68, 0x99, 0x9B, 0x20,  // satisfy
+    0x98, 0x68, 0xF9, 0xA1, 0x20,  // satoshi
+    0x98, 0x6A, 0x32, 0x80, 0x00,  // sauce
+    0x98, 0x6B, 0x30, 0x9C, 0xA0,  // sausage
+    0x98, 0x6C, 0x50, 0x00, 0x00,  // save
+    0x98, 0x72, 0x00, 0x00, 0x00,  // say
+    0x98, 0xC2, 0xC2, 0x80, 0x00,  // scale
+    0x98, 0xC2, 0xE0, 0x00, 0x00,  // scan
+    0x98, 0xC3, 0x22, 0x80, 0x00,  // scare
+    0x98, 0xC3, 0x4A, 0x16, 0x40,  // scatter
+    0x98, 0xCA, 0xE2, 0x80, 0x00,  // scene
+    0x98, 0xD0, 0x56, 0x94, 0x00,  // scheme
+    0x98, 0xD0, 0xF7, 0xB0, 0x00,  // school
+    0x98, 0xD2, 0x57, 0x0C, 0xA0,  // science
+    0x98, 0xD3, 0x39, 0xBE, 0x53,  // scissors
+    0x98, 0xDF, 0x28, 0x25, 0xEE,  // scorpion
+    0x98, 0xDF, 0x5A, 0x00, 0x00,  // scout
+    0x98, 0xE4, 0x18, 0x00, 0x00,  // scrap
+    0x98, 0xE4, 0x52, 0xB8, 0x00,  // screen
+    0x98, 0xE4, 0x98, 0x50, 0x00,  // script
+    0x98, 0xE5, 0x51, 0x00, 0x00,  // scrub
+    0x99, 0x42, 0x00, 0x00, 0x00,  // sea
+    0x99, 0x43, 0x21, 0xA0, 0x00,  // search
+    0x99, 0x43, 0x37, 0xB8, 0x00,  // season
+    0x99, 0x43, 0x40, 0x00, 0x00,  // seat
+    0x99, 0x46, 0xF7, 0x10, 0x00,  // second
+    0x99, 0x47, 0x22, 0xD0, 0x00,  // secret
+    0x99, 0x47, 0x44, 0xBD, 0xC0,  // section
+    0x99, 0x47, 0x59, 0x26, 0x99,  // security
+    0x99, 0x4A, 0x40, 0x00, 0x00,  // seed
+    0x99, 0x4A, 0xB0, 0x00, 0x00,  // seek
+    0x99, 0x4E, 0xD2, 0xBA, 0x80,  // segment
+    0x99, 0x58, 0x51, 0xD0, 0x00,  // select
+    0x99, 0x58, 0xC0, 0x00, 0x00,  // sell
+    0x99, 0x5A, 0x97, 0x06, 0x40,  // seminar
+    0x99, 0x5C, 0x97, 0xC8, 0x00,  // senior
+    0x99, 0x5D, 0x32, 0x80, 0x00,  // sense
+    0x99, 0x5D, 0x42, 0xB8, 0x65,  // sentence
+    0x99, 0x64, 0x92, 0xCC, 0x00,  // series
+    0x99, 0x65, 0x64, 0x8C, 0xA0,  // service
+    0x99, 0x67, 0x34, 0xBD, 0xC0,  // session
+    0x99, 0x69, 0x46, 0x14, 0x00,  // settle
+    0x99, 0x69, 0x58, 0x00, 0x00,  // setup
+    0x99, 0x6C, 0x57, 0x00, 0x00,  // seven
+    0x9A, 0x02, 0x47, 0xDC, 0x00,  // shadow
+    0x9A, 0x02, 0x6A, 0x00, 0x00,  // shaft
+    0x9A, 0x02, 0xC6, 0x3E, 0xE0,  // shallow
+    0x9A, 0x03, 0x22, 0x80, 0x00,  // share
+    0x9A, 0x0A, 0x40, 0x00, 0x00,  // shed
+    0x9A, 0x0A, 0xC6, 0x00, 0x00,  // shell
+    0x9A, 0x0B, 0x24, 0x98, 0xC0,  // sheriff
+    0x9A, 0x12, 0x56, 0x10, 0x00,  // shield
+    0x9A, 0x12, 0x6A, 0x00, 0x00,  // shift
+    0x9A, 0x12, 0xE2, 0x80, 0x00,  // shine
+    0x9A, 0x13, 0x00, 0x00, 0x00,  // ship
+    0x9A, 0x13, 0x62, 0xC8, 0x00,  // shiver
+    0x9A, 0x1E, 0x35, 0x80, 0x00,  // shock
+    0x9A, 0x1E, 0x50, 0x00, 0x00,  // shoe
+    0x9A, 0x1E, 0xFA, 0x00, 0x00,  // shoot
+    0x9A, 0x1F, 0x00, 0x00, 0x00,  // shop
+    0x9A, 0x1F, 0x2A, 0x00, 0x00,  // short
+    0x9A, 0x1F, 0x56, 0x10, 0xB2,  // shoulder
+    0x9A, 0x1F, 0x62, 0x80, 0x00,  // shove
+    0x9A, 0x24, 0x96, 0xC0, 0x00,  // shrimp
+    0x9A, 0x25, 0x53, 0x80, 0x00,  // shrug
+    0x9A, 0x2A, 0x63, 0x30, 0xA0,  // shuffle
+    0x9A, 0x32, 0x00, 0x00, 0x00,  // shy
+    0x9A, 0x44, 0xC4, 0xB8, 0xE0,  // sibling
+    0x9A, 0x46, 0xB0, 0x00, 0x00,  // sick
+    0x9A, 0x48, 0x50, 0x00, 0x00,  // side
+    0x9A, 0x4A, 0x72, 0x80, 0x00,  // siege
+    0x9A, 0x4E, 0x8A, 0x00, 0x00,  // sight
+    0x9A, 0x4E, 0xE0, 0x00, 0x00,  // sign
+    0x9A, 0x58, 0x57, 0x50, 0x00,  // silent
+    0x9A, 0x58, 0xB0, 0x00, 0x00,  // silk
+    0x9A, 0x58, 0xCC, 0x80, 0x00,  // silly
+    0x9A, 0x59, 0x62, 0xC8, 0x00,  // silver
+    0x9A, 0x5A, 0x96, 0x06, 0x40,  // similar
+    0x9A, 0x5B, 0x06, 0x14, 0x00,  // simple
+    0x9A, 0x5C, 0x32, 0x80, 0x00,  // since
+    0x9A, 0x5C, 0x70, 0x00, 0x00,  // sing
+    0x9A, 0x64, 0x57, 0x00, 0x00,  // siren
+    0x9A, 0x67, 0x42, 0xC8, 0x00,  // sister
+    0x9A, 0x69, 0x50, 0xD0, 0xA0,  // situate
+    0x9A, 0x70, 0x00, 0x00, 0x00,  // six
+    0x9A, 0x74, 0x50, 0x00, 0x00,  // size
+    0x9A, 0xC3, 0x42, 0x80, 0x00,  // skate
+    0x9A, 0xCB, 0x41, 0xA0, 0x00,  // sketch
+    0x9A, 0xD2, 0x00, 0x00, 0x00,  // ski
+    0x9A, 0xD2, 0xC6, 0x00, 0x00,  // skill
+    0x9A, 0xD2, 0xE0, 0x00, 0x00,  // skin
+    0x9A, 0xD3, 0x2A, 0x00, 0x00,  // skirt
+    0x9A, 0xEA, 0xC6, 0x00, 0x00,  // skull
+    0x9B, 0x02, 0x20, 0x00, 0x00,  // slab
+    0x9B, 0x02, 0xD0, 0x00, 0x00,  // slam
+    0x9B, 0x0A, 0x58, 0x00, 0x00,  // sleep
+    0x9B, 0x0A, 0xE2, 0x16, 0x40,  // slender
+    0x9B, 0x12, 0x32, 0x80, 0x00,  // slice
+    0x9B, 0x12, 0x42, 0x80, 0x00,  // slide
+    0x9B, 0x12, 0x74, 0x50, 0x00,  // slight
+    0x9B, 0x12, 0xD0, 0x00, 0x00,  // slim
+    0x9B, 0x1E, 0x70, 0xB8, 0x00,  // slogan
+    0x9B, 0x1F, 0x40, 0x00, 0x00,  // slot
+    0x9B, 0x1F, 0x70, 0x00, 0x00,  // slow
+    0x9B, 0x2B, 0x34, 0x00, 0x00,  // slush
+    0x9B, 0x42, 0xC6, 0x00, 0x00,  // small
+    0x9B, 0x43, 0x2A, 0x00, 0x00,  // smart
+    0x9B, 0x52, 0xC2, 0x80, 0x00,  // smile
+    0x9B, 0x5E, 0xB2, 0x80, 0x00,  // smoke
+    0x9B, 0x5E, 0xFA, 0x20, 0x00,  // smooth
+    0x9B, 0x82, 0x35, 0x80, 0x00,  // snack
+    0x9B, 0x82, 0xB2, 0x80, 0x00,  // snake
+    0x9B, 0x83, 0x00, 0x00, 0x00,  // snap
+    0x9B, 0x92, 0x63, 0x00, 0x00,  // sniff
+    0x9B, 0x9F, 0x70, 0x00, 0x00,  // snow
+    0x9B, 0xC3, 0x00, 0x00, 0x00,  // soap
+    0x9B, 0xC6, 0x32, 0xC8, 0x00,  // soccer
+    0x9B, 0xC6, 0x90, 0xB0, 0x00,  // social
+    0x9B, 0xC6, 0xB0, 0x00, 0x00,  // sock
+    0x9B, 0xC8, 0x10, 0x00, 0x00,  // soda
+    0x9B, 0xCD, 0x40, 0x00, 0x00,  // soft
+    0x9B, 0xD8, 0x19, 0x00, 0x00,  // solar
+    0x9B, 0xD8, 0x44, 0x96, 0x40,  // soldier
+    0x9B, 0xD8, 0x92, 0x00, 0x00,  // solid
+    0x9B, 0xD9, 0x5A, 0x25, 0xEE,  // solution
+    0x9B, 0xD9, 0x62, 0x80, 0x00,  // solve
+    0x9B, 0xDA, 0x57, 0xB8, 0xA0,  // someone
+    0x9B, 0xDC, 0x70, 0x00, 0x00,  // song
+    0x9B, 0xDE, 0xE0, 0x00, 0x00,  // soon
+    0x9B, 0xE5, 0x2C, 0x80, 0x00,  // sorry
+    0x9B, 0xE5, 0x40, 0x00, 0x00,  // sort
+    0x9B, 0xEA, 0xC0, 0x00, 0x00,  // soul
+    0x9B, 0xEA, 0xE2, 0x00, 0x00,  // sound
+    0x9B, 0xEB, 0x00, 0x00, 0x00,  // soup
+    0x9B, 0xEB, 0x21, 0x94, 0x00,  // source
+    0x9B, 0xEB, 0x44, 0x00, 0x00,  // south
+    0x9C, 0x02, 0x32, 0x80, 0x00,  // space
+    0x9C, 0x03, 0x22, 0x80, 0x00,  // spare
+    0x9C, 0x03, 0x44, 0x85, 0x80,  // spatial
+    0x9C, 0x03, 0x77, 0x00, 0x00,  // spawn
+    0x9C, 0x0A, 0x15, 0x80, 0x00,  // speak
+    0x9C, 0x0A, 0x34, 0x85, 0x80,  // special
+    0x9C, 0x0A, 0x52, 0x00, 0x00,  // speed
+    0x9C, 0x0A, 0xC6, 0x00, 0x00,  // spell
+    0x9C, 0x0A, 0xE2, 0x00, 0x00,  // spend
+    0x9C, 0x10, 0x59, 0x14, 0x00,  // sphere
+    0x9C, 0x12, 0x32, 0x80, 0x00,  // spice
+    0x9C, 0x12, 0x42, 0xC8, 0x00,  // spider
+    0x9C, 0x12, 0xB2, 0x80, 0x00,  // spike
+    0x9C, 0x12, 0xE0, 0x00, 0x00,  // spin
+    0x9C, 0x13, 0x24, 0xD0, 0x00,  // spirit
+    0x9C, 0x18, 0x9A, 0x00, 0x00,  // split
+    0x9C, 0x1E, 0x96, 0x00, 0x00,  // spoil
+    0x9C, 0x1E, 0xE9, 0xBE, 0x40,  // sponsor
+    0x9C, 0x1E, 0xF7, 0x00, 0x00,  // spoon
+    0x9C, 0x1F, 0x2A, 0x00, 0x00,  // sport
+    0x9C, 0x1F, 0x40, 0x00, 0x00,  // spot
+    0x9C, 0x24, 0x1C, 0x80, 0x00,  // spray
+    0x9C, 0x24, 0x50, 0x90, 0x00,  // spread
+    0x9C, 0x24, 0x97, 0x1C, 0x00,  // spring
+    0x9C, 0x32, 0x00, 0x00, 0x00,  // spy
+    0x9C, 0x6A, 0x19, 0x14, 0x00,  // square
+    0x9C, 0x6A, 0x52, 0xE8, 0xA0,  // squeeze
+    0x9C, 0x6A, 0x99, 0x48, 0xAC,  // squirrel
+    0x9D, 0x02, 0x26, 0x14, 0x00,  // stable
+    0x9D, 0x02, 0x44, 0xD5, 0xA0,  // stadium
+    0x9D, 0x02, 0x63, 0x00, 0x00,  // staff
+    0x9D, 0x02, 0x72, 0x80, 0x00,  // stage
+    0x9D, 0x02, 0x99, 0x4C, 0x00,  // stairs
+    0x9D, 0x02, 0xD8, 0x00, 0x00,  // stamp
+    0x9D, 0x02, 0xE2, 0x00, 0x00,  // stand
+    0x9D, 0x03, 0x2A, 0x00, 0x00,  // start
+    0x9D, 0x03, 0x42, 0x80, 0x00,  // state
+    0x9D, 0x03, 0x90, 0x00, 0x00,  // stay
+    0x9D, 0x0A, 0x15, 0x80, 0x00,  // steak
+    0x9D, 0x0A, 0x56, 0x00, 0x00,  // steel
+    0x9D, 0x0A, 0xD0, 0x00, 0x00,  // stem
+    0x9D, 0x0B, 0x00, 0x00, 0x00,  // step
+    0x9D, 0x0B, 0x22, 0xBC, 0x00,  // stereo
+    0x9D, 0x12, 0x35, 0x80, 0x00,  // stick
+    0x9D, 0x12, 0xC6, 0x00, 0x00,  // still
+    0x9D, 0x12, 0xE3, 0x80, 0x00,  // sting
+    0x9D, 0x1E, 0x35, 0x80, 0x00,  // stock
+    0x9D, 0x1E, 0xD0, 0x8D, 0x00,  // stomach
+    0x9D, 0x1E, 0xE2, 0x80, 0x00,  // stone
+    0x9D, 0x1E, 0xF6, 0x00, 0x00,  // stool
+    0x9D, 0x1F, 0x2C, 0x80, 0x00,  // story
+    0x9D, 0x1F, 0x62, 0x80, 0x00,  // stove
+    0x9D, 0x24, 0x1A, 0x14, 0xF9,  // strategy
+    0x9D, 0x24, 0x52, 0xD0, 0x00,  // street
+    0x9D, 0x24, 0x95, 0x94, 0x00,  // strike
+    0x9D, 0x24, 0xF7, 0x1C, 0x00,  // strong
+    0x9D, 0x25, 0x53, 0x9D, 0x85,  // struggle
+    0x9D, 0x2A, 0x42, 0xBA, 0x80,  // student
+    0x9D, 0x2A, 0x63, 0x00, 0x00,  // stuff
+    0x9D, 0x2A, 0xD1, 0x30, 0xA0,  // stumble
+    0x9D, 0x32, 0xC2, 0x80, 0x00,  // style
+    0x9D, 0x44, 0xA2, 0x8E, 0x80,  // subject
+    0x9D, 0x44, 0xD4, 0xD0, 0x00,  // submit
+    0x9D, 0x45, 0x70, 0xE4, 0x00,  // subway
+    0x9D, 0x46, 0x32, 0xCE, 0x60,  // success
+    0x9D, 0x46, 0x80, 0x00, 0x00,  // such
+    0x9D, 0x48, 0x42, 0xB8, 0x00,  // sudden
+    0x9D, 0x4C, 0x62, 0xC8, 0x00,  // suffer
+    0x9D, 0x4E, 0x19, 0x00, 0x00,  // sugar
+    0x9D, 0x4E, 0x72, 0xCE, 0x80,  // suggest
+    0x9D, 0x53, 0x40, 0x00, 0x00,  // suit
+    0x9D, 0x5A, 0xD2, 0xC8, 0x00,  // summer
+    0x9D, 0x5C, 0x00, 0x00, 0x00,  // sun
+    0x9D, 0x5C, 0xEC, 0x80, 0x00,  // sunny
+    0x9D, 0x5D, 0x32, 0xD0, 0x00,  // sunset
+    0x9D, 0x60, 0x59, 0x00, 0x00,  // super
+    0x9D, 0x61, 0x06, 0x64, 0x00,  // supply
+    0x9D, 0x61, 0x22, 0xB4, 0xA0,  // supreme
+    0x9D, 0x64, 0x50, 0x00, 0x00,  // sure
+    0x9D, 0x64, 0x60, 0x8C, 0xA0,  // surface
+    0x9D, 0x64, 0x72, 0x80, 0x00,  // surge
+    0x9D, 0x65, 0x09, 0x26, 0x65,  // surprise
+    0x9D, 0x65, 0x27, 0xD5, 0xC4,  // surround
+    0x9D, 0x65, 0x62, 0xE4, 0x00,  // survey
+    0x9D, 0x67, 0x02, 0x8E, 0x80,  // suspect
+    0x9D, 0x67, 0x40, 0xA5, 0xC0,  // sustain
+    0x9D, 0xC2, 0xC6, 0x3E, 0xE0,  // swallow
+    0x9D, 0xC2, 0xD8, 0x00, 0x00,  // swamp
+    0x9D, 0xC3, 0x00, 0x00, 0x00,  // swap
+    0x9D, 0xC3, 0x26, 0x80, 0x00,  // swarm
+    0x9D, 0xCA, 0x19, 0x00, 0x00,  // swear
+    0x9D, 0xCA, 0x5A, 0x00, 0x00,  // sweet
+    0x9D, 0xD2, 0x6A, 0x00, 0x00,  // swift
+    0x9D, 0xD2, 0xD0, 0x00, 0x00,  // swim
+    0x9D, 0xD2, 0xE3, 0x80, 0x00,  // swing
+    0x9D, 0xD3, 0x41, 0xA0, 0x00,  // switch
+    0x9D, 0xDF, 0x22, 0x00, 0x00,  // sword
+    0x9E, 0x5A, 0x27, 0xB0, 0x00,  // symbol
+    0x9E, 0x5B, 0x0A, 0x3D, 0xA0,  // symptom
+    0x9E, 0x65, 0x58, 0x00, 0x00,  // syrup
+    0x9E, 0x67, 0x42, 0xB4, 0x00,  // system
+    0xA0, 0x44, 0xC2, 0x80, 0x00,  // table
+    0xA0, 0x46, 0xB6, 0x14, 0x00,  // tackle
+    0xA0, 0x4E, 0x00, 0x00, 0x00,  // tag
+    0xA0, 0x52, 0xC0, 0x00, 0x00,  // tail
+    0xA0, 0x58, 0x57, 0x50, 0x00,  // talent
+    0xA0, 0x58, 0xB0, 0x00, 0x00,  // talk
+    0xA0, 0x5C, 0xB0, 0x00, 0x00,  // tank
+    0xA0, 0x60, 0x50, 0x00, 0x00,  // tape
+    0xA0, 0x64, 0x72, 0xD0, 0x00,  // target
+    0xA0, 0x66, 0xB0, 0x00, 0x00,  // task
+    0xA0, 0x67, 0x42, 0x80, 0x00,  // taste
+    0xA0, 0x69, 0x47, 0xBC, 0x00,  // tattoo
+    0xA0, 0x70, 0x90, 0x00, 0x00,  // taxi
+    0xA1, 0x42, 0x34, 0x00, 0x00,  // teach
+    0xA1, 0x42, 0xD0, 0x00, 0x00,  // team
+    0xA1, 0x58, 0xC0, 0x00, 0x00,  // tell
+    0xA1, 0x5C, 0x00, 0x00, 0x00,  // ten
+    0xA1, 0x5C, 0x17, 0x50, 0x00,  // tenant
+    0xA1, 0x5C, 0xE4, 0xCC, 0x00,  // tennis
+    0xA1, 0x5D, 0x40, 0x00, 0x00,  // tent
+    0xA1, 0x64, 0xD0, 0x00, 0x00,  // term
+    0xA1, 0x67, 0x40, 0x00, 0x00,  // test
+    0xA1, 0x71, 0x40, 0x00, 0x00,  // text
+    0xA2, 0x02, 0xE5, 0x80, 0x00,  // thank
+    0xA2, 0x03, 0x40, 0x00, 0x00,  // that
+    0xA2, 0x0A, 0xD2, 0x80, 0x00,  // theme
+    0xA2, 0x0A, 0xE0, 0x00, 0x00,  // then
+    0xA2, 0x0A, 0xF9, 0x64, 0x00,  // theory
+    0xA2, 0x0B, 0x22, 0x80, 0x00,  // there
+    0xA2, 0x0B, 0x90, 0x00, 0x00,  // they
+    0xA2, 0x12, 0xE3, 0x80, 0x00,  // thing
+    0xA2, 0x13, 0x30, 0x00, 0x00,  // this
+    0xA2, 0x1F, 0x53, 0xA2, 0x80,  // thought
+    0xA2, 0x24, 0x52, 0x80, 0x00,  // three
+    0xA2, 0x24, 0x9B, 0x14, 0x00,  // thrive
+    0xA2, 0x24, 0xFB, 0x80, 0x00,  // throw
+    0xA2, 0x2A, 0xD1, 0x00, 0x00,  // thumb
+    0xA2, 0x2A, 0xE2, 0x16, 0x40,  // thunder
+    0xA2, 0x46, 0xB2, 0xD0, 0x00,  // ticket
+    0xA2, 0x48, 0x50, 0x00, 0x00,  // tide
+    0xA2, 0x4E, 0x59, 0x00, 0x00,  // tiger
+    0xA2, 0x59, 0x40, 0x00, 0x00,  // tilt
+    0xA2, 0x5A, 0x22, 0xC8, 0x00,  // timber
+    0xA2, 0x5A, 0x50, 0x00, 0x00,  // time
+    0xA2, 0x5D, 0x90, 0x00, 0x00,  // tiny
+    0xA2, 0x60, 0x00, 0x00, 0x00,  // tip
+    0xA2, 0x64, 0x52, 0x00, 0x00,  // tired
+    0xA2, 0x67, 0x3A, 0x94, 0x00,  // tissue
+    0xA2, 0x68, 0xC2, 0x80, 0x00,  // title
+    0xA3, 0xC3, 0x3A, 0x00, 0x00,  // toast
+    0xA3, 0xC4, 0x11, 0x8D, 0xE0,  // tobacco
+    0xA3, 0xC8, 0x1C, 0x80, 0x00,  // today
+    0xA3, 0xC8, 0x46, 0x16, 0x40,  // toddler
+    0xA3, 0xCA, 0x00, 0x00, 0x00,  // toe
+    0xA3, 0xCE, 0x5A, 0x20, 0xB2,  // together
+    0xA3, 0xD2, 0xC2, 0xD0, 0x00,  // toilet
+    0xA3, 0xD6, 0x57, 0x00, 0x00,  // token
+    0xA3, 0xDA, 0x1A, 0x3C, 0x00,  // tomato
+    0xA3, 0xDA, 0xF9, 0x49, 0xF7,  // tomorrow
+    0xA3, 0xDC, 0x50, 0x00, 0x00,  // tone
+    0xA3, 0xDC, 0x7A, 0x94, 0x00,  // tongue
+    0xA3, 0xDC, 0x93, 0xA2, 0x80,  // tonight
+    0xA3, 0xDE, 0xC0, 0x00, 0x00,  // tool
+    0xA3, 0xDF, 0x44, 0x00, 0x00,  // tooth
+    0xA3, 0xE0, 0x00, 0x00, 0x00,  // top
+    0xA3, 0xE0, 0x91, 0x80, 0x00,  // topic
+    0xA3, 0xE1, 0x06, 0x14, 0x00,  // topple
+    0xA3, 0xE4, 0x34, 0x00, 0x00,  // torch
+    0xA3, 0xE4, 0xE0, 0x91, 0xE0,  // tornado
+    0xA3, 0xE5, 0x47, 0xA6, 0x65,  // tortoise
+    0xA3, 0xE7, 0x30, 0x00, 0x00,  // toss
+    0xA3, 0xE8, 0x16, 0x00, 0x00,  // total
+    0xA3, 0xEB, 0x24, 0xCE, 0x80,  // tourist
+    0xA3, 0xEE, 0x19, 0x10, 0x00,  // toward
+    0xA3, 0xEE, 0x59, 0x00, 0x00,  // tower
+    0xA3, 0xEE, 0xE0, 0x00, 0x00,  // town
+    0xA3, 0xF2, 0x00, 0x00, 0x00,  // toy
+    0xA4, 0x82, 0x35, 0x80, 0x00,  // track
+    0xA4, 0x82, 0x42, 0x80, 0x00,  // trade
+    0xA4, 0x82, 0x63, 0x24, 0x60,  // traffic
+    0xA4, 0x82, 0x74, 0x8C, 0x00,  // tragic
+    0xA4, 0x82, 0x97, 0x00, 0x00,  // train
+    0xA4, 0x82, 0xE9, 0x98, 0xB2,  // transfer
+    0xA4, 0x83, 0x00, 0x00, 0x00,  // trap
+    0xA4, 0x83, 0x34, 0x00, 0x00,  // trash
+    0xA4, 0x83, 0x62, 0xB0, 0x00,  // travel
+    0xA4, 0x83, 0x90, 0x00, 0x00,  // tray
+    0xA4, 0x8A, 0x1A, 0x00, 0x00,  // treat
+    0xA4, 0x8A, 0x50, 0x00, 0x00,  // tree
+    0xA4, 0x8A, 0xE2, 0x00, 0x00,  // trend
+    0xA4, 0x92, 0x16, 0x00, 0x00,  // trial
+    0xA4, 0x92, 0x22, 0x80, 0x00,  // tribe
+    0xA4, 0x92, 0x35, 0x80, 0x00,  // trick
+    0xA4, 0x92, 0x73, 0x96, 0x40,  // trigger
+    0xA4, 0x92, 0xD0, 0x00, 0x00,  // trim
+    0xA4, 0x93, 0x00, 0x00, 0x00,  // trip
+    0xA4, 0x9F, 0x04, 0x64, 0x00,  // trophy
+    0xA4, 0x9F, 0x51, 0x30, 0xA0,  // trouble
+    0xA4, 0xAA, 0x35, 0x80, 0x00,  // truck
+    0xA4, 0xAA, 0x50, 0x00, 0x00,  // true
+    0xA4, 0xAA, 0xCC, 0x80, 0x00,  // truly
+    0xA4, 0xAA, 0xD8, 0x16, 0x80,  // trumpet
+    0xA4, 0xAB, 0x3A, 0x00, 0x00,  // trust
+    0xA4, 0xAB, 0x44, 0x00, 0x00,  // truth
+    0xA4, 0xB2, 0x00, 0x00, 0x00,  // try
+    0xA5, 0x44, 0x50, 0x00, 0x00,  // tube
+    0xA5, 0x53, 0x44, 0xBD, 0xC0,  // tuition
+    0xA5, 0x5A, 0x26, 0x14, 0x00,  // tumble
+    0xA5, 0x5C, 0x10, 0x00, 0x00,  // tuna
+    0xA5, 0x5C, 0xE2, 0xB0, 0x00,  // tunnel
+    0xA5, 0x64, 0xB2, 0xE4, 0x00,  // turkey
+    0xA5, 0x64, 0xE0, 0x00, 0x00,  // turn
+    0xA5, 0x65, 0x46, 0x14, 0x00,  // turtle
+    0xA5, 0xCA, 0xCB, 0x14, 0x00,  // twelve
+    0xA5, 0xCA, 0xEA, 0x64, 0x00,  // twenty
+    0xA5, 0xD2, 0x32, 0x80, 0x00,  // twice
+    0xA5, 0xD2, 0xE0, 0x00, 0x00,  // twin
+    0xA5, 0xD3, 0x3A, 0x00, 0x00,  // twist
+    0xA5, 0xDE, 0x00, 0x00, 0x00,  // two
+    0xA6, 0x60, 0x50, 0x00, 0x00,  // type
+    0xA6, 0x60, 0x91, 0x85, 0x80,  // typical
+    0xA9, 0xD9, 0x90, 0x00, 0x00,  // ugly
+    0xAB, 0x45, 0x22, 0xB1, 0x81,  // umbrella
+    0xAB, 0x82, 0x26, 0x14, 0x00,  // unable
+    0xAB, 0x83, 0x70, 0xC8, 0xA0,  // unaware
+    0xAB, 0x86, 0xC2, 0x80, 0x00,  // uncle
+    0xAB, 0x86, 0xFB, 0x16, 0x40,  // uncover
+    0xAB, 0x88, 0x59, 0x00, 0x00,  // under
+    0xAB, 0x88, 0xF0, 0x00, 0x00,  // undo
+    0xAB, 0x8C, 0x14, 0xC8, 0x00,  // unfair
+    0xAB, 0x8C, 0xF6, 0x10, 0x00,  // unfold
+    0xAB, 0x90, 0x18, 0x43, 0x20,  // unhappy
+    0xAB, 0x92, 0x67, 0xC9, 0xA0,  // uniform
+    0xAB, 0x93, 0x1A, 0x94, 0x00,  // unique
+    0xAB, 0x93, 0x40, 0x00, 0x00,  // unit
+    0xAB, 0x93, 0x62, 0xCA, 0x65,  // universe
+    0xAB, 0x96, 0xE7, 0xDD, 0xC0,  // unknown
+    0xAB, 0x98, 0xF1, 0xAC, 0x00,  // unlock
+    0xAB, 0xA8, 0x96, 0x00, 0x00,  // until
+    0xAB, 0xAB, 0x3A, 0x85, 0x80,  // unusual
+    0xAB, 0xAC, 0x54, 0xB0, 0x00,  // unveil
+    0xAC, 0x08, 0x1A, 0x14, 0x00,  // update
+    0xAC, 0x0F, 0x20, 0x90, 0xA0,  // upgrade
+    0xAC, 0x10, 0xF6, 0x10, 0x00,  // uphold
+    0xAC, 0x1E, 0xE0, 0x00, 0x00,  // upon
+    0xAC, 0x20, 0x59, 0x00, 0x00,  // upper
+    0xAC, 0x26, 0x5A, 0x00, 0x00,  // upset
+    0xAC, 0x84, 0x17, 0x00, 0x00,  // urban
+    0xAC, 0x8E, 0x50, 0x00, 0x00,  // urge
+    0xAC, 0xC2, 0x72, 0x80, 0x00,  // usage
+    0xAC, 0xCA, 0x00, 0x00, 0x00,  // use
+    0xAC, 0xCA, 0x40, 0x00, 0x00,  // used
+    0xAC, 0xCA, 0x6A, 0xB0, 0x00,  // useful
+    0xAC, 0xCA, 0xC2, 0xCE, 0x60,  // useless
+    0xAC, 0xEA, 0x16, 0x00, 0x00,  // usual
+    0xAD, 0x12, 0xC4, 0xD3, 0x20,  // utility
+    0xB0, 0x46, 0x17, 0x50, 0x00,  // vacant
+    0xB0, 0x47, 0x5A, 0xB4, 0x00,  // vacuum
+    0xB0, 0x4F, 0x52, 0x80, 0x00,  // vague
+    0xB0, 0x58, 0x92, 0x00, 0x00,  // valid
+    0xB0, 0x58, 0xC2, 0xE4, 0x00,  // valley
+    0xB0, 0x59, 0x62, 0x80, 0x00,  // valve
+    0xB0, 0x5C, 0x00, 0x00, 0x00,  // van
+    0xB0, 0x5C, 0x99, 0xA0, 0x00,  // vanish
+    0xB0, 0x60, 0xF9, 0x00, 0x00,  // vapor
+    0xB0, 0x64, 0x97, 0xD6, 0x60,  // various
+    0xB0, 0x67, 0x40, 0x00, 0x00,  // vast
+    0xB0, 0x6A, 0xCA, 0x00, 0x00,  // vault
+    0xB1, 0x50, 0x91, 0xB0, 0xA0,  // vehicle
+    0xB1, 0x59, 0x62, 0xD0, 0x00,  // velvet
+    0xB1, 0x5C, 0x47, 0xC8, 0x00,  // vendor
+    0xB1, 0x5D, 0x4A, 0xC8, 0xA0,  // venture
+    0xB1, 0x5D, 0x52, 0x80, 0x00,  // venue
+    0xB1, 0x64, 0x20, 0x00, 0x00,  // verb
+    0xB1, 0x64, 0x93, 0x64, 0x00,  // verify
+    0xB1, 0x65, 0x34, 0xBD, 0xC0,  // version
+    0xB1, 0x65, 0x90, 0x00, 0x00,  // very
+    0xB1, 0x67, 0x32, 0xB0, 0x00,  // vessel
+    0xB1, 0x68, 0x59, 0x05, 0xC0,  // veteran
+    0xB2, 0x42, 0x26, 0x14, 0x00,  // viable
+    0xB2, 0x45, 0x20, 0xBA, 0x80,  // vibrant
+    0xB2, 0x46, 0x97, 0xD6, 0x60,  // vicious
+    0xB2, 0x47, 0x47, 0xCB, 0x20,  // victory
+    0xB2, 0x48, 0x57, 0x80, 0x00,  // video
+    0xB2, 0x4B, 0x70, 0x00, 0x00,  // view
+    0xB2, 0x58, 0xC0, 0x9C, 0xA0,  // village
+    0xB2, 0x5D, 0x40, 0x9C, 0xA0,  // vintage
+    0xB2, 0x5E, 0xC4, 0xB8, 0x00,  // violin
+    0xB2, 0x65, 0x4A, 0x85, 0x80,  // virtual
+    0xB2, 0x65, 0x59, 0x80, 0x00,  // virus
+    0xB2, 0x66, 0x10, 0x00, 0x00,  // visa
+    0xB2, 0x66, 0x9A, 0x00, 0x00,  // visit
+    0xB2, 0x67, 0x50, 0xB0, 0x00,  // visual
+    0xB2, 0x68, 0x16, 0x00, 0x00,  // vital
+    0xB2, 0x6C, 0x92, 0x00, 0x00,  // vivid
+    0xB3, 0xC6, 0x16, 0x00, 0x00,  // vocal
+    0xB3, 0xD2, 0x32, 0x80, 0x00,  // voice
+    0xB3, 0xD2, 0x40, 0x00, 0x00,  // void
+    0xB3, 0xD8, 0x30, 0xB9, 0xE0,  // volcano
+    0xB3, 0xD9, 0x56, 0x94, 0x00,  // volume
+    0xB3, 0xE8, 0x50, 0x00, 0x00,  // vote
+    0xB3, 0xF2, 0x13, 0x94, 0x00,  // voyage
+    0xB8, 0x4E, 0x50, 0x00, 0x00,  // wage
+    0xB8, 0x4E, 0xF7, 0x00, 0x00,  // wagon
+    0xB8, 0x53, 0x40, 0x00, 0x00,  // wait
+    0xB8, 0x58, 0xB0, 0x00, 0x00,  // walk
+    0xB8, 0x58, 0xC0, 0x00, 0x00,  // wall
+    0xB8, 0x58, 0xEA, 0xD0, 0x00,  // walnut
+    0xB8, 0x5D, 0x40, 0x00, 0x00,  // want
+    0xB8, 0x64, 0x60, 0xC8, 0xA0,  // warfare
+    0xB8, 0x64, 0xD0, 0x00, 0x00,  // warm
+    0xB8, 0x65, 0x24, 0xBE, 0x40,  // warrior
+    0xB8, 0x66, 0x80, 0x00, 0x00,  // wash
+    0xB8, 0x67, 0x00, 0x00, 0x00,  // wasp
+    0xB8, 0x67, 0x42, 0x80, 0x00,  // waste
+    0xB8, 0x68, 0x59, 0x00, 0x00,  // water
+    0xB8, 0x6C, 0x50, 0x00, 0x00,  // wave
+    0xB8, 0x72, 0x00, 0x00, 0x00,  // way
+    0xB9, 0x42, 0xCA, 0x20, 0x00,  // wealth
+    0xB9, 0x43, 0x07, 0xB8, 0x00,  // weapon
+    0xB9, 0x43, 0x20, 0x00, 0x00,  // wear
+    0xB9, 0x43, 0x32, 0xB0, 0x00,  // weasel
+    0xB9, 0x43, 0x44, 0x16, 0x40,  // weather
+    0xB9, 0x44, 0x00, 0x00, 0x00,  // web
+    0xB9, 0x48, 0x44, 0xB8, 0xE0,  // wedding
+    0xB9, 0x4A, 0xB2, 0xB8, 0x80,  // weekend
+    0xB9, 0x53, 0x22, 0x00, 0x00,  // weird
+    0xB9, 0x58, 0x37, 0xB4, 0xA0,  // welcome
+    0xB9, 0x67, 0x40, 0x00, 0x00,  // west
+    0xB9, 0x68, 0x00, 0x00, 0x00,  // wet
+    0xBA, 0x02, 0xC2, 0x80, 0x00,  // whale
+    0xBA, 0x03, 0x40, 0x00, 0x00,  // what
+    0xBA, 0x0A, 0x1A, 0x00, 0x00,  // wheat
+    0xBA, 0x0A, 0x56, 0x00, 0x00,  // wheel
+    0xBA, 0x0A, 0xE0, 0x00, 0x00,  // when
+    0xBA, 0x0B, 0x22, 0x80, 0x00,  // where
+    0xBA, 0x13, 0x00, 0x00, 0x00,  // whip
+    0xBA, 0x13, 0x38, 0x16, 0x40,  // whisper
+    0xBA, 0x48, 0x50, 0x00, 0x00,  // wide
+    0xBA, 0x49, 0x44, 0x00, 0x00,  // width
+    0xBA, 0x4C, 0x50, 0x00, 0x00,  // wife
+    0xBA, 0x58, 0x40, 0x00, 0x00,  // wild
+    0xBA, 0x58, 0xC0, 0x00, 0x00,  // will
+    0xBA, 0x5C, 0x00, 0x00, 0x00,  // win
+    0xBA, 0x5C, 0x47, 0xDC, 0x00,  // window
+    0xBA, 0x5C, 0x50, 0x00, 0x00,  // wine
+    0xBA, 0x5C, 0x70, 0x00, 0x00,  // wing
+    0xBA, 0x5C, 0xB0, 0x00, 0x00,  // wink
+    0xBA, 0x5C, 0xE2, 0xC8, 0x00,  // winner
+    0xBA, 0x5D, 0x42, 0xC8, 0x00,  // winter
+    0xBA, 0x64, 0x50, 0x00, 0x00,  // wire
+    0xBA, 0x66, 0x47, 0xB4, 0x00,  // wisdom
+    0xBA, 0x66, 0x50, 0x00, 0x00,  // wise
+    0xBA, 0x66, 0x80, 0x00, 0x00,  // wish
+    0xBA, 0x68, 0xE2, 0xCE, 0x60,  // witness
+    0xBB, 0xD8, 0x60, 0x00, 0x00,  // wolf
+    0xBB, 0xDA, 0x17, 0x00, 0x00,  // woman
+    0xBB, 0xDC, 0x42, 0xC8, 0x00,  // wonder
+    0xBB, 0xDE, 0x40, 0x00, 0x00,  // wood
+    0xBB, 0xDE, 0xC0, 0x00, 0x00,  // wool
+    0xBB, 0xE4, 0x40, 0x00, 0x00,  // word
+    0xBB, 0xE4, 0xB0, 0x00, 0x00,  // work
+    0xBB, 0xE4, 0xC2, 0x00, 0x00,  // world
+    0xBB, 0xE5, 0x2C, 0x80, 0x00,  // worry
+    0xBB, 0xE5, 0x44, 0x00, 0x00,  // worth
+    0xBC, 0x83, 0x00, 0x00, 0x00,  // wrap
+    0xBC, 0x8A, 0x35, 0x80, 0x00,  // wreck
+    0xBC, 0x8B, 0x3A, 0x30, 0xA0,  // wrestle
+    0xBC, 0x93, 0x3A, 0x00, 0x00,  // wrist
+    0xBC, 0x93, 0x42, 0x80, 0x00,  // write
+    0xBC, 0x9E, 0xE3, 0x80, 0x00,  // wrong
+    0xC8, 0x64, 0x40, 0x00, 0x00,  // yard
+    0xC9, 0x43, 0x20, 0x00, 0x00,  // year
+    0xC9, 0x58, 0xC7, 0xDC, 0x00,  // yellow
+    0xCB, 0xEA, 0x00, 0x00, 0x00,  // you
+    0xCB, 0xEA, 0xE3, 0x80, 0x00,  // young
+    0xCB, 0xEB, 0x44, 0x00, 0x00,  // youth
+    0xD1, 0x45, 0x20, 0x80, 0x00,  // zebra
+    0xD1, 0x64, 0xF0, 0x00, 0x00,  // zero
+    0xD3, 0xDC, 0x50, 0x00, 0x00,  // zone
+    0xD3, 0xDE, 0x00, 0x00, 0x00};  // zoo
+
+// Generated by tools/wordlists/gen_wordlists.py: index of the first word starting with each
+// two-letter prefix ("aa", "ab", ..., "zz"), followed by the word count. Words starting with "xy"
+// are in [INDEX[26 * x + y], INDEX[26 * x + y + 1]) and words starting with "x" are in
+// [INDEX[26 * x], INDEX[26 * (x + 1)]).
+unsigned short const BIP39_WORDLIST_PREFIX_INDEX[] = {
+    0,     0,     10,    24,    33,    34,    37,    41,    42,    46,    46,    46,    61,
+    66,    82,    82,    88,    88,    106,   113,   119,   126,   129,   135,   136,   136,
+    136,   155,   155,   155,   155,   175,   175,   175,   175,   183,   183,   183,   197,
+    197,   197,   214,   214,   214,   234,   234,   234,   253,   253,   253,   253,   253,
+    253,   295,   295,   295,   295,   302,   302,   302,   327,   333,   333,   333,   357,
+    357,   357,   398,   398,   398,   427,   427,   427,   438,   438,   438,   438,   439,
+    439,   449,   449,   449,   449,   487,   487,   487,   487,   514,   514,   514,   514,
+    514,   514,   527,   527,   527,   542,   542,   542,   549,   549,   550,   550,   551,
+    551,   559,   559,   562,   565,   565,   566,   567,   567,   569,   569,   569,   578,
+    586,   607,   607,   608,   610,   616,   620,   622,   622,   626,   626,   649,   651,
+    651,   673,   673,   673,   673,   685,   685,   685,   685,   705,   705,   705,   720,
+    720,   720,   739,   739,   739,   751,   751,   751,   757,   757,   757,   757,   757,
+    757,   774,   774,   774,   774,   780,   780,   780,   781,   788,   788,   788,   800,
+    800,   800,   810,   810,   810,   826,   826,   826,   832,   832,   832,   832,   833,
+    833,   848,   848,   848,   848,   859,   859,   859,   859,   866,   866,   866,   866,
+    866,   866,   884,   884,   884,   884,   884,   884,   896,   896,   896,   896,   897,
+    897,   897,   897,   899,   902,   902,   902,   903,   903,   903,   903,   903,   906,
+    914,   946,   946,   946,   946,   947,   950,   951,   951,   952,   952,   952,   952,
+    952,   956,   956,   956,   956,   960,   960,   960,   960,   960,   960,   960,   960,
+    960,   960,   965,   965,   965,   965,   965,   965,   972,   972,   972,   972,   972,
+    972,   973,   973,   973,   973,   977,   977,   977,   977,   988,   988,   988,   988,
+    988,   992,   992,   992,   992,   992,   992,   992,   992,   992,   992,   992,   992,
+    992,   1012,  1012,  1012,  1012,  1030,  1030,  1030,  1030,  1047,  1047,  1047,  1047,
+    1047,  1047,  1061,  1061,  1061,  1061,  1061,  1061,  1067,  1067,  1067,  1067,  1068,
+    1068,  1101,  1101,  1101,  1101,  1122,  1122,  1122,  1122,  1139,  1139,  1139,  1139,
+    1139,  1139,  1160,  1160,  1160,  1160,  1160,  1160,  1170,  1170,  1170,  1170,  1173,
+    1173,  1180,  1180,  1180,  1180,  1195,  1195,  1195,  1195,  1197,  1197,  1197,  1197,
+    1197,  1197,  1210,  1210,  1210,  1210,  1210,  1210,  1214,  1214,  1214,  1214,  1214,
+    1214,  1215,  1222,  1225,  1226,  1226,  1230,  1230,  1230,  1231,  1231,  1232,  1235,
+    1236,  1241,  1241,  1246,  1246,  1255,  1256,  1257,  1261,  1264,  1266,  1267,  1268,
+    1269,  1294,  1294,  1294,  1294,  1308,  1308,  1308,  1312,  1326,  1326,  1326,  1336,
+    1336,  1336,  1355,  1355,  1355,  1384,  1384,  1384,  1400,  1400,  1400,  1400,  1401,
+    1401,  1401,  1401,  1401,  1401,  1401,  1401,  1401,  1401,  1401,  1401,  1401,  1401,
+    1401,  1401,  1401,  1401,  1401,  1401,  1401,  1401,  1409,  1409,  1409,  1409,  1409,
+    1409,  1430,  1430,  1430,  1430,  1478,  1478,  1478,  1479,  1495,  1495,  1495,  1495,
+    1495,  1495,  1510,  1510,  1510,  1510,  1510,  1510,  1517,  1517,  1517,  1517,  1517,
+    1517,  1536,  1536,  1551,  1551,  1574,  1574,  1574,  1597,  1616,  1616,  1623,  1635,
+    1640,  1645,  1666,  1691,  1694,  1694,  1694,  1727,  1752,  1752,  1763,  1763,  1767,
+    1767,  1780,  1780,  1780,  1780,  1790,  1790,  1790,  1805,  1816,  1816,  1816,  1816,
+    1816,  1816,  1844,  1844,  1844,  1872,  1872,  1872,  1880,  1880,  1886,  1886,  1888,
+    1888,  1888,  1888,  1888,  1888,  1888,  1888,  1889,  1889,  1889,  1889,  1889,  1889,
+    1890,  1908,  1908,  1914,  1914,  1916,  1922,  1923,  1923,  1923,  1923,  1923,  1923,
+    1923,  1935,  1935,  1935,  1935,  1946,  1946,  1946,  1946,  1962,  1962,  1962,  1962,
+    1962,  1962,  1969,  1969,  1969,  1969,  1969,  1969,  1969,  1969,  1969,  1969,  1969,
+    1969,  1985,  1985,  1985,  1985,  1997,  1997,  1997,  2005,  2022,  2022,  2022,  2022,
+    2022,  2022,  2032,  2032,  2032,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,
+    2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,
+    2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,  2038,
+    2038,  2039,  2039,  2039,  2039,  2041,  2041,  2041,  2041,  2041,  2041,  2041,  2041,
+    2041,  2041,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,
+    2044,  2044,  2044,  2044,  2044,  2046,  2046,  2046,  2046,  2046,  2046,  2046,  2046,
+    2046,  2046,  2048,  2048,  2048,  2048,  2048,  2048,  2048,  2048,  2048,  2048,  2048,
+    2048};
+
+// Generated by tools/wordlists/gen_wordlists.py: prefix trie, see wordlist.h for the layout
+unsigned long long const BIP39_TRIE[] = {
+    0x001DFFFFFF7FFFFFULL, 0x01A1FAE5B8FEB9FEULL, 0x02A0492444124911ULL, 0x0310492645124991ULL,
+    0x0390490445524111ULL, 0x03F6BCE435AFB96DULL, 0x04D0492444124911ULL, 0x0540492445124991ULL,
+    0x05B0410445104111ULL, 0x060010E0302E384CULL, 0x0660410044104011ULL, 0x06A0008440002111ULL,
+    0x06D0410445104111ULL, 0x0724410445104111ULL, 0x0780410444104111ULL, 0x07D1CAA09BFEBD2FULL,
+    0x0870492645124991ULL, 0x08F0400000100000ULL, 0x0900410444104191ULL, 0x095567F65559FD95ULL,
+    0x0A55490645524191ULL, 0x0AE01A80000EB040ULL, 0x0B20010444004111ULL, 0x0B60090644024191ULL,
+    0x0BC0010040004011ULL, 0x0BE0010040004010ULL, 0x0C00110000144901ULL, 0x0C202000100B4184ULL,
+    0x0C40800020301209ULL, 0x0C60000080020020ULL, 0x0C70000040020011ULL, 0x0C80080000061000ULL,
+    0x0C900020004ED917ULL, 0x0CA0010004104001ULL, 0x0CC02081118C6545ULL, 0x0D0002000002C001ULL,
+    0x0D102840500A5054ULL, 0x0D601000000C8400ULL, 0x0D70200000084080ULL, 0x0D8020000008204CULL,
+    0x0D90010000004010ULL, 0x0DA0000004000431ULL, 0x0DB018A0100E384EULL, 0x0E0020A2150C28F5ULL,
+    0x0E600800000A640CULL, 0x0E70410044104111ULL, 0x0EB00980059E7109ULL, 0x0EF0010444104111ULL,
+    0x0F3018A0230E292AULL, 0x0F807AE0083EBC46ULL, 0x1010088000023900ULL, 0x1030410444124111ULL,
+    0x10802000002A2040ULL, 0x1090410444104111ULL, 0x10E04BE4053EF92DULL, 0x1174410445104111ULL,
+    0x11D01A00000E8802ULL, 0x120000C001563008ULL, 0x1220B2E0982EB877ULL, 0x12C0988146262875ULL,
+    0x133000A010347844ULL, 0x1360000445104111ULL, 0x13902000000E3004ULL, 0x13A0180100060040ULL,
+    0x13D0010000004080ULL, 0x0000000000100140ULL, 0x0000000000080040ULL, 0x13E000004004011AULL,
+    0x13F002000800C012ULL, 0x14102801642E4AF9ULL, 0x1470400000100000ULL, 0x1480010004124001ULL,
+    0x14A01000000C0004ULL, 0x0000000000000090ULL, 0x14B0010400004100ULL, 0x14D022065408C195ULL,
+    0x1540000040000010ULL, 0x155020E4103E390EULL, 0x15B00000406C301BULL, 0x15C038A0008E2856ULL,
+    0x1610410405104111ULL, 0x1650192000964945ULL, 0x1690010444104111ULL, 0x16D00880000A2010ULL,
+    0x16F03820021E9908ULL, 0x1730008000042000ULL, 0x1740080000222061ULL, 0x1750010404104101ULL,
+    0x1780110000664809ULL, 0x17A0010444104111ULL, 0x17E0000400002111ULL, 0x17F00840026AB902ULL,
+    0x1810002004022909ULL, 0x000000000006A848ULL, 0x18301820003EF806ULL, 0x186008C000063042ULL,
+    0x0000000000004010ULL, 0x1890000040000810ULL, 0x18A0002000000800ULL, 0x18B0024000009101ULL,
+    0x18D0B08AB02DB3ACULL, 0x0000000000044800ULL, 0x0000000002020044ULL, 0x1960000004400801ULL,
+    0x0000000001100502ULL, 0x1970008000043108ULL, 0x1980000041080010ULL, 0x19902080204C200CULL,
+    0x19C0010000004110ULL, 0x19D160002B7AB40AULL, 0x1A200081042C7165ULL, 0x1A5000408A2D7467ULL,
+    0x1A80408015386047ULL, 0x1AC0008000803044ULL, 0x1AD03885028EB74CULL, 0x1B3038E0240E380DULL,
+    0x1BB218A020863808ULL, 0x1C10E8C0203E700AULL, 0x1C801020000C0824ULL, 0x1CA01000000C0000ULL,
+    0x1CB02000000E9100ULL, 0x1CC0200100FE8155ULL, 0x0000000000000044ULL, 0x1CE02800006E5102ULL,
+    0x00000000000A1004ULL, 0x1D001000002C0A10ULL, 0x0000000000080014ULL, 0x1D10000080080020ULL,
+    0x0000000001000108ULL, 0x1D20002000000914ULL, 0x1D30000040088110ULL, 0x1D4000042000814FULL,
+    0x1D60200000080000ULL, 0x1D70000040000011ULL, 0x1D80008000002000ULL, 0x1D9028A0013EA94CULL,
+    0x1DD00880040AE801ULL, 0x1E00010001024000ULL, 0x1E100021120CE855ULL, 0x1E40400044100011ULL,
+    0x1E7130A0406EE910ULL, 0x1ED0010444004111ULL, 0x1F100A20020EB80AULL, 0x1F40000404004111ULL,
+    0x1F602084326AB90EULL, 0x1FB0B2E19C7DFA6FULL, 0x20708001382CE06EULL, 0x20C041000D1C5007ULL,
+    0x210000800002284AULL, 0x2110606021383928ULL, 0x2160090604024191ULL, 0x21B028A0542E3855ULL,
+    0x2220090445124111ULL, 0x227000E1028E385EULL, 0x22B0000400100111ULL, 0x22C0010444104111ULL,
+    0x2300010004004101ULL, 0x2320000004004101ULL, 0x233048201012782DULL, 0x2370090445024991ULL,
+    0x23C0400000100000ULL, 0x23D0490445124111ULL, 0x24301A811806B16EULL, 0x24A0000444004111ULL,
+    0x24D0004000061000ULL, 0x24E01020008EA946ULL, 0x2500008004862801ULL, 0x2520480444124111ULL,
+    0x25700040000EB84CULL, 0x25810BC0215EF55BULL, 0x25F0410445104111ULL, 0x2640088000023102ULL,
+    0x2660000440004110ULL, 0x2680020000008000ULL, 0x26900004B4380DADULL, 0x000000000004C0C8ULL,
+    0x0000000000000042ULL, 0x26E0000040100011ULL, 0x26F000A01016A844ULL, 0x27200880000E2880ULL,
+    0x27401800102E681FULL, 0x2770002401080904ULL, 0x27901821012E2940ULL, 0x27D00000040C091BULL,
+    0x27E0000444000111ULL, 0x281010A0200E2828ULL, 0x2850090000027800ULL, 0x2870000440004111ULL,
+    0x0000000000000801ULL, 0x2890400000100000ULL, 0x0000000000020002ULL, 0x0000000000006000ULL,
+    0x0000000000300000ULL, 0x0000000000184010ULL, 0x0000000000104110ULL, 0x0000000000124100ULL,
+    0x0000000000020100ULL, 0x0000000000000101ULL, 0x0000000000004001ULL, 0x0000000000002000ULL,
+    0x0000000000008000ULL, 0x0000000000004010ULL, 0x0000000002080000ULL, 0x0000000000102000ULL,
+    0x0000000000000180ULL, 0x0000000000020810ULL, 0x0000000000104000ULL, 0x0000000000000110ULL,
+    0x0000000000020810ULL, 0x0000000000080080ULL, 0x0000000000002001ULL, 0x0000000001004010ULL,
+    0x0000000000004111ULL, 0x0000000000400110ULL, 0x0000000000100111ULL, 0x0000000000020111ULL,
+    0x0000000000104080ULL, 0x0000000000000104ULL, 0x0000000001020400ULL, 0x0000000000004080ULL,
+    0x0000000000000805ULL, 0x0000000000002001ULL, 0x0000000000020050ULL, 0x0000000000000510ULL,
+    0x0000000000102004ULL, 0x0000000000004001ULL, 0x0000000000000101ULL, 0x0000000000084100ULL,
+    0x0000000000000014ULL, 0x00000000004A0000ULL, 0x0000000000080008ULL, 0x000000000004300CULL,
+    0x0000000000040001ULL, 0x0000000000144000ULL, 0x0000000000060010ULL, 0x00000000000A0000ULL,
+    0x0000000000100010ULL, 0x0000000000040400ULL, 0x0000000000020108ULL, 0x0000000000242104ULL,
+    0x0000000000000011ULL, 0x000000000004205CULL, 0x0000000000486404ULL, 0x0000000000000048ULL,
+    0x0000000000000C02ULL, 0x0000000000000408ULL, 0x0000000000040048ULL, 0x0000000001000100ULL,
+    0x0000000000000902ULL, 0x0000000000001800ULL, 0x0000000000008010ULL, 0x000000000120600DULL,
+    0x0000000000080101ULL, 0x00000000000A804AULL, 0x0000000000180190ULL, 0x0000000000080015ULL,
+    0x00000000000C0040ULL, 0x00000000000C0000ULL, 0x0000000000080010ULL, 0x00000000000EF900ULL,
+    0x0000000000060035ULL, 0x0000000000001814ULL, 0x0000000000004100ULL, 0x0000000000022004ULL,
+    0x0000000001000100ULL, 0x0000000001428100ULL, 0x0000000000220001ULL, 0x000000000000B034ULL,
+    0x00000000005C0044ULL, 0x00000000000C1002ULL, 0x0000000000040004ULL, 0x0000000000002800ULL,
+    0x0000000000104800ULL, 0x0000000000009132ULL, 0x00000000002C206CULL, 0x0000000000000C00ULL,
+    0x0000000001008000ULL, 0x0000000000022011ULL, 0x000000000006A004ULL, 0x00000000024C302CULL,
+    0x0000000000400019ULL, 0x00000000000C1004ULL, 0x0000000000548000ULL, 0x0000000000043114ULL,
+    0x0000000000040000ULL, 0x0000000000000002ULL, 0x00000000002A0100ULL, 0x0000000000080080ULL,
+    0x0000000000008001ULL, 0x0000000000000044ULL, 0x0000000000020001ULL, 0x0000000000024911ULL,
+    0x0000000001000110ULL, 0x0000000000000101ULL, 0x0000000000000101ULL, 0x0000000001080100ULL,
+    0x0000000000184011ULL, 0x0000000000088514ULL, 0x0000000000000011ULL, 0x0000000000004110ULL,
+    0x0000000000021840ULL, 0x00000000000C0000ULL, 0x0000000000002100ULL, 0x0000000000006000ULL,
+    0x0000000000080010ULL, 0x000000000008D095ULL, 0x0000000000004110ULL, 0x0000000000180000ULL,
+    0x0000000000008800ULL, 0x0000000000004401ULL, 0x0000000000441060ULL, 0x0000000000040001ULL,
+    0x000000000020A820ULL, 0x0000000001000004ULL, 0x0000000000000810ULL, 0x0000000000082800ULL,
+    0x0000000001080100ULL, 0x0000000000002800ULL, 0x0000000000209044ULL, 0x0000000000024001ULL,
+    0x0000000000084800ULL, 0x0000000000000006ULL, 0x0000000000004800ULL, 0x0000000000021000ULL,
+    0x0000000000000101ULL, 0x0000000000004100ULL, 0x0000000000020110ULL, 0x0000000000000101ULL,
+    0x0000000000040000ULL, 0x0000000000040008ULL, 0x0000000000000011ULL, 0x0000000000000808ULL,
+    0x0000000000000C00ULL, 0x0000000000001004ULL, 0x0000000000100990ULL, 0x0000000000020004ULL,
+    0x0000000000000101ULL, 0x00000000000C0800ULL, 0x0000000000024911ULL, 0x0000000000020010ULL,
+    0x0000000000000002ULL, 0x0000000000100010ULL, 0x0000000000082000ULL, 0x0000000000040800ULL,
+    0x0000000000004110ULL, 0x0000000000080004ULL, 0x0000000000000181ULL, 0x0000000000000808ULL,
+    0x0000000000081010ULL, 0x0000000000000159ULL, 0x0000000000041010ULL, 0x0000000000000084ULL,
+    0x0000000000002000ULL, 0x00000000002C1040ULL, 0x0000000000008040ULL, 0x0000000000404005ULL,
+    0x0000000000040100ULL, 0x0000000000000808ULL, 0x0000000000080008ULL, 0x0000000000580454ULL,
+    0x00000000000C0000ULL, 0x0000000000001040ULL, 0x0000000000050000ULL, 0x0000000000002010ULL,
+    0x0000000002442040ULL, 0x0000000000002000ULL, 0x0000000001002000ULL, 0x0000000000000801ULL,
+    0x000000000000180BULL, 0x0000000000008000ULL, 0x0000000000000090ULL, 0x00000000001A0110ULL,
+    0x0000000000000801ULL, 0x0000000000062008ULL, 0x0000000000001008ULL, 0x0000000000624002ULL,
+    0x0000000000040008ULL, 0x0000000000048000ULL, 0x000000000024A106ULL, 0x0000000000000011ULL,
+    0x0000000000080018ULL, 0x0000000000500004ULL, 0x0000000000080808ULL, 0x0000000000041000ULL,
+    0x000000000024000AULL, 0x0000000000220808ULL, 0x0000000000009800ULL, 0x0000000000000918ULL,
+    0x0000000000062000ULL, 0x0000000000088000ULL, 0x0000000000004003ULL, 0x0000000000080048ULL,
+    0x00000000000A0008ULL, 0x0000000000002001ULL, 0x0000000000002010ULL, 0x0000000000100010ULL,
+    0x0000000000124001ULL, 0x0000000000024880ULL, 0x0000000000104110ULL, 0x0000000000004801ULL,
+    0x0000000000000011ULL, 0x0000000000100010ULL, 0x0000000000004010ULL, 0x0000000000088111ULL,
+    0x0000000000004011ULL, 0x0000000000004110ULL, 0x0000000000002800ULL, 0x0000000000000540ULL,
+    0x000000000000A000ULL, 0x0000000000002000ULL, 0x0000000000000048ULL, 0x0000000000080014ULL,
+    0x0000000000400004ULL, 0x0000000000004010ULL, 0x0000000001000008ULL, 0x0000000000000110ULL,
+    0x0000000000002040ULL, 0x0000000000042000ULL, 0x0000000000220028ULL, 0x0000000000000011ULL,
+    0x0000000000040048ULL, 0x0000000000020010ULL, 0x0000000000080010ULL, 0x0000000000000102ULL,
+    0x0000000000002008ULL, 0x0000000000000401ULL, 0x0000000000000050ULL, 0x0000000000002008ULL,
+    0x0000000000000005ULL, 0x0000000000002100ULL, 0x0000000000002808ULL, 0x0000000000140049ULL,
+    0x0000000000020546ULL, 0x00000000000C0400ULL, 0x00000000000A0094ULL, 0x00000000000C2008ULL,
+    0x0000000000000101ULL, 0x0000000000084000ULL, 0x0000000000004002ULL, 0x0000000000180000ULL,
+    0x0000000000020144ULL, 0x0000000000040080ULL, 0x0000000000000081ULL, 0x0000000000002008ULL,
+    0x0000000000000C00ULL, 0x0000000000104108ULL, 0x0000000000020001ULL, 0x00000000000C0010ULL,
+    0x0000000000080010ULL, 0x0000000000000110ULL, 0x0000000000000010ULL, 0x00000000000C0500ULL,
+    0x0000000000002011ULL, 0x0000000000004180ULL, 0x0000000000042000ULL, 0x0000000000000110ULL,
+    0x0000000000080010ULL, 0x0000000000080194ULL, 0x0000000000080010ULL, 0x0000000000100100ULL,
+    0x0000000000000801ULL, 0x0000000000400000ULL, 0x0000000000081000ULL, 0x0000000000000191ULL,
+    0x0000000000000014ULL, 0x0000000000000110ULL, 0x0000000001000100ULL, 0x0000000000022000ULL,
+    0x0000000000000110ULL, 0x0000000000000050ULL, 0x0000000000048018ULL, 0x0000000000022000ULL,
+    0x0000000000000010ULL, 0x0000000000001001ULL, 0x0000000000080118ULL, 0x00000000000A0411ULL,
+    0x00000000000A0184ULL, 0x0000000000062004ULL, 0x0000000000000005ULL, 0x0000000000041020ULL,
+    0x0000000000082000ULL, 0x0000000000082000ULL, 0x0000000000000010ULL, 0x0000000000004800ULL,
+    0x00000000010C2004ULL, 0x0000000000000009ULL, 0x0000000000002044ULL, 0x0000000000081000ULL,
+    0x0000000000000111ULL, 0x0000000001000008ULL, 0x00000000000C0100ULL, 0x0000000000080001ULL,
+    0x0000000000000018ULL, 0x0000000000000104ULL, 0x00000000002C8028ULL, 0x000000000224700CULL,
+    0x00000000003CD26EULL, 0x0000000000048800ULL, 0x0000000000008100ULL, 0x0000000000048104ULL,
+    0x0000000000022800ULL, 0x0000000002080004ULL, 0x0000000000000414ULL, 0x0000000000000101ULL,
+    0x0000000000042800ULL, 0x000000000000004CULL, 0x0000000000000090ULL, 0x0000000000040808ULL,
+    0x0000000000100010ULL, 0x0000000001004111ULL, 0x0000000000104800ULL, 0x0000000000120100ULL,
+    0x0000000001000111ULL, 0x0000000000004111ULL, 0x0000000000080018ULL, 0x0000000000004811ULL,
+    0x000000000010C114ULL, 0x0000000000120100ULL, 0x0000000000000110ULL, 0x0000000000000002ULL,
+    0x0000000000000090ULL, 0x0000000000000050ULL, 0x0000000000000180ULL, 0x0000000000000011ULL,
+    0x0000000000040008ULL, 0x0000000000104000ULL, 0x0000000000001420ULL, 0x0000000000082040ULL,
+    0x0000000000400000ULL, 0x0000000000002008ULL, 0x0000000000185001ULL, 0x0000000000008010ULL,
+    0x0000000000004100ULL, 0x0000000000040004ULL, 0x00000000000A2800ULL, 0x0000000000004010ULL,
+    0x0000000000040010ULL, 0x0000000000120000ULL, 0x0000000000100111ULL, 0x00000000000E0000ULL,
+    0x00000000001A4000ULL, 0x0000000000000408ULL, 0x0000000000000810ULL, 0x00000000000C0100ULL,
+    0x0000000000200100ULL, 0x0000000000180000ULL, 0x0000000000020828ULL, 0x0000000000020808ULL,
+    0x000000000020A030ULL, 0x000000000032C014ULL, 0x0000000000100100ULL, 0x0000000000002080ULL,
+    0x0000000000200C10ULL, 0x0000000000008100ULL, 0x0000000000000044ULL, 0x0000000000022800ULL,
+    0x0000000000001002ULL, 0x0000000000002010ULL, 0x000000000000104CULL, 0x0000000000480040ULL,
+    0x0000000000020800ULL, 0x0000000000004400ULL, 0x0000000000008404ULL, 0x0000000000000504ULL,
+    0x0000000000300109ULL, 0x00000000000A0000ULL, 0x00000000000AA800ULL, 0x00000000004A0004ULL,
+    0x0000000000002815ULL, 0x000000000002240CULL, 0x00000000000A6100ULL, 0x0000000000000111ULL,
+    0x0000000000000111ULL, 0x00000000010A316AULL, 0x0000000000029011ULL, 0x0000000000002804ULL,
+    0x0000000000227004ULL, 0x0000000000104111ULL, 0x0000000000001028ULL, 0x0000000000401200ULL,
+    0x0000000000000084ULL, 0x0000000000000041ULL, 0x0000000000042000ULL, 0x0000000000028010ULL,
+    0x0000000000228070ULL, 0x0000000000088000ULL, 0x0000000000029800ULL, 0x0000000000000011ULL,
+    0x0000000000083020ULL, 0x0000000000008002ULL, 0x0000000000000410ULL, 0x0000000000080400ULL,
+    0x0000000000001004ULL, 0x0000000000082001ULL, 0x0000000000082000ULL, 0x0000000001027000ULL,
+    0x0000000000042000ULL, 0x0000000000004110ULL, 0x0000000000003000ULL, 0x0000000000000012ULL,
+    0x0000000000000009ULL, 0x0000000000004001ULL, 0x0000000000000150ULL, 0x0000000000080800ULL,
+    0x0000000000008100ULL, 0x0000000000082004ULL, 0x0000000000002011ULL, 0x000000000124A16CULL,
+    0x0000000000002011ULL, 0x0000000000009047ULL, 0x0000000000108000ULL, 0x00000000000C1814ULL,
+    0x0000000000002001ULL, 0x0000000000082400ULL, 0x0000000000002800ULL, 0x0000000000042004ULL,
+    0x0000000000000110ULL, 0x0000000000400002ULL, 0x0000000000004800ULL, 0x0000000000004010ULL,
+    0x0000000000004001ULL, 0x0000000000290020ULL, 0x0000000000000828ULL, 0x0000000000100001ULL,
+    0x0000000000200900ULL, 0x0000000000000100ULL, 0x0000000000180008ULL, 0x0000000001040102ULL,
+    0x0000000000080100ULL, 0x0000000000180000ULL, 0x0000000000100101ULL, 0x000000000000000CULL,
+    0x0000000000100004ULL, 0x0000000000004010ULL, 0x0000000000002C00ULL, 0x0000000000021020ULL,
+    0x0000000000088080ULL, 0x00000000000E8800ULL, 0x0000000000080800ULL, 0x0000000000022011ULL,
+    0x0000000000048000ULL, 0x0000000000080010ULL, 0x0000000000000808ULL, 0x0000000000082458ULL,
+    0x0000000000000098ULL, 0x0000000000000808ULL, 0x00000000000A0C08ULL, 0x0000000000040004ULL,
+    0x00000000000C0000ULL, 0x0000000000082000ULL};
+
+#if !defined(TARGET_NANOS)
+// Generated by tools/wordlists/gen_wordlists.py from the NFKD text of the French list, the words
+// being packed by their ASCII-folded letters
+unsigned char const BIP39_WORDLIST_FRENCH[] = {
+    0x08, 0x82, 0x99, 0xCC, 0xB2,  // abaisser
+    0x08, 0x82, 0xE2, 0x3D, 0xC0,  // abandon
+    0x08, 0x88, 0x98, 0xD4, 0xB2,  // abdiquer
+    0x08, 0x8A, 0x96, 0x30, 0xA0,  // abeille
+    0x08, 0x9E, 0xC4, 0xC8, 0x00,  // abolir
+    0x08, 0x9F, 0x22, 0x16, 0x40,  // aborder
+    0x08, 0x9F, 0x5A, 0x26, 0x40,  // aboutir
+    0x08, 0x9F, 0x92, 0xC8, 0x00,  // aboyer
+    0x08, 0xA4, 0x19, 0xA4, 0xC0,  // abrasif
+    0x08, 0xA4, 0x5A, 0xD8, 0xB2,  // abreuver
+    0x08, 0xA4, 0x9A, 0x16, 0x40,  // abriter
+    0x08, 0xA4, 0xF3, 0x96, 0x40,  // abroger
+    0x08, 0xA5, 0x58, 0x50, 0x00,  // abrupt
+    0x08, 0xA6, 0x57, 0x0C, 0xA0,  // absence
+    0x08, 0xA6, 0xF6, 0x54, 0x00,  // absolu
+    0x08, 0xA7, 0x59, 0x10, 0xA0,  // absurde
+    0x08, 0xAB, 0x34, 0x98, 0x00,  // abusif
+    0x08, 0xB3, 0x39, 0x85, 0x80,  // abyssal
+    0x08, 0xC2, 0x42, 0xB5, 0x25,  // academie
+    0x08, 0xC2, 0xA7, 0xD4, 0x00,  // acajou
+    0x08, 0xC3, 0x24, 0x95, 0xC0,  // acarien
+    0x08, 0xC6, 0x11, 0x30, 0xB2,  // accabler
+    0x08, 0xC6, 0x58, 0x50, 0xB2,  // accepter
+    0x08, 0xC6, 0xC0, 0xB4, 0xB2,  // acclamer
+    0x08, 0xC6, 0xF6, 0x04, 0x85,  // accolade
+    0x08, 0xC7, 0x27, 0x8D, 0x05,  // accroche
+    0x08, 0xC7, 0x59, 0x96, 0x40,  // accuser
+    0x08, 0xCB, 0x21, 0x14, 0x00,  // acerbe
+    0x08, 0xD0, 0x1A, 0x00, 0x00,  // achat
+    0x08, 0xD0, 0x5A, 0x16, 0x40,  // acheter
+    0x08, 0xD2, 0x4A, 0xB0, 0xB2,  // aciduler
+    0x08, 0xD2, 0x59, 0x00, 0x00,  // acier
+    0x08, 0xDE, 0xD8, 0x50, 0xA0,  // acompte
+    0x08, 0xE3, 0x52, 0xC9, 0x32,  // acquerir
+    0x08, 0xE4, 0xF7, 0x65, 0xA5,  // acronyme
+    0x08, 0xE8, 0x5A, 0xC8, 0x00,  // acteur
+    0x08, 0xE8, 0x93, 0x00, 0x00,  // actif
+    0x08, 0xE9, 0x52, 0xB0, 0x00,  // actuel
+    0x09, 0x0B, 0x0A, 0x14, 0x00,  // adepte
+    0x09, 0x0B, 0x1A, 0x86, 0x80,  // adequat
+    0x09, 0x10, 0x59, 0xA4, 0xC0,  // adhesif
+    0x09, 0x14, 0x51, 0xD1, 0x26,  // adjectif
+    0x09, 0x15, 0x53, 0x96, 0x40,  // adjuger
+    0x09, 0x1A, 0x5A, 0x52, 0x45,  // admettre
+    0x09, 0x1A, 0x99, 0x16, 0x40,  // admirer
+    0x09, 0x1F, 0x0A, 0x16, 0x40,  // adopter
+    0x09, 0x1F, 0x22, 0xC8, 0x00,  // adorer
+    0x09, 0x1F, 0x51, 0xA6, 0x40,  // adoucir
+    0x09, 0x24, 0x59, 0xCC, 0xA0,  // adresse
+    0x09, 0x24, 0xF4, 0xD0, 0x00,  // adroit
+    0x09, 0x2A, 0xCA, 0x14, 0x00,  // adulte
+    0x09, 0x2C, 0x59, 0x08, 0xA0,  // adverbe
+    0x09, 0x64, 0x59, 0x00, 0x00,  // aerer
+    0x09, 0x64, 0xF7, 0x14, 0xC0,  // aeronef
+    0x09, 0x8C, 0x14, 0xC8, 0xA0,  // affaire
+    0x09, 0x8C, 0x51, 0xD0, 0xB2,  // affecter
+    0x09, 0x8C, 0x91, 0xA0, 0xA0,  // affiche
+    0x09, 0x8D, 0x22, 0xD7, 0x00,  // affreux
+    0x09, 0x8D, 0x51, 0x30, 0xB2,  // affubler
+    0x09, 0xC2, 0x32, 0xC8, 0x00,  // agacer
+    0x09, 0xCA, 0xE1, 0x96, 0x40,  // agencer
+    0x09, 0xD2, 0xC2, 0x80, 0x00,  // agile
+    0x09, 0xD3, 0x42, 0xC8, 0x00,  // agiter
+    0x09, 0xE4, 0x13, 0x16, 0x40,  // agrafer
+    0x09, 0xE4, 0x50, 0x89, 0x85,  // agreable
+    0x09, 0xE5, 0x56, 0x94, 0x00,  // agrume
+    0x0A, 0x48, 0x59, 0x00, 0x00,  // aider
+    0x0A, 0x4F, 0x54, 0xB1, 0x85,  // aiguille
+    0x0A, 0x58, 0x92, 0xC8, 0x00,  // ailier
+    0x0A, 0x5A, 0x11, 0x30, 0xA0,  // aimable
+    0x0A, 0x66, 0x17, 0x0C, 0xA0,  // aisance
+    0x0A, 0x9F, 0x5A, 0x16, 0x40,  // ajouter
+    0x0A, 0xAB, 0x3A, 0x16, 0x40,  // ajuster
+    0x0B, 0x03, 0x26, 0x96, 0x40,  // alarmer
+    0x0B, 0x06, 0x84, 0xB5, 0x25,  // alchimie
+    0x0B, 0x0B, 0x2A, 0x14, 0x00,  // alerte
+    0x0B, 0x0E, 0x51, 0x48, 0xA0,  // algebre
+    0x0B, 0x0F, 0x52, 0x80, 0x00,  // algue
+    0x0B, 0x12, 0x57, 0x16, 0x40,  // aliener
+    0x0B, 0x12, 0xD2, 0xBA, 0x80,  // aliment
+    0x0B, 0x18, 0x53, 0x96, 0x40,  // alleger
+    0x0B, 0x18, 0x90, 0x9C, 0xA0,  // alliage
+    0x0B, 0x18, 0xFA, 0x96, 0x40,  // allouer
+    0x0B, 0x19, 0x56, 0x96, 0x40,  // allumer
+    0x0B, 0x1F, 0x59, 0x11, 0x32,  // alourdir
+    0x0B, 0x20, 0x13, 0x84, 0x00,  // alpaga
+    0x0B, 0x28, 0x59, 0xCC, 0xA0,  // altesse
+    0x0B, 0x2C, 0x57, 0xB0, 0xA0,  // alveole
+    0x0B, 0x43, 0x42, 0xD6, 0x40,  // amateur
+    0x0B, 0x44, 0x93, 0xD4, 0x00,  // ambigu
+    0x0B, 0x45, 0x22, 0x80, 0x00,  // ambre
+    0x0B, 0x4A, 0xE0, 0x9C, 0xB2,  // amenager
+    0x0B, 0x4B, 0x2A, 0x55, 0xA5,  // amertume
+    0x0B, 0x52, 0x47, 0xB8, 0x00,  // amidon
+    0x0B, 0x53, 0x20, 0xB0, 0x00,  // amiral
+    0x0B, 0x5F, 0x21, 0x96, 0x40,  // amorcer
+    0x0B, 0x5F, 0x59, 0x00, 0x00,  // amour
+    0x0B, 0x5F, 0x64, 0x89, 0x85,  // amovible
+    0x0B, 0x60, 0x84, 0x89, 0x25,  // amphibie
+    0x0B, 0x60, 0xC2, 0xD6, 0x40,  // ampleur
+    0x0B, 0x6B, 0x30, 0xBA, 0x80,  // amusant
+    0x0B, 0x82, 0xCC, 0xCC, 0xA0,  // analyse
+    0x0B, 0x83, 0x04, 0x3E, 0x45,  // anaphore
+    0x0B, 0x83, 0x21, 0xA1, 0x25,  // anarchie
+    0x0B, 0x83, 0x47, 0xB5, 0x25,  // anatomie
+    0x0B, 0x86, 0x92, 0xB8, 0x00,  // ancien
+    0x0B, 0x8A, 0x17, 0x51, 0x32,  // aneantir
+    0x0B, 0x8E, 0xC2, 0x80, 0x00,  // angle
+    0x0B, 0x8E, 0xF4, 0xCE, 0x65,  // angoisse
+    0x0B, 0x8F, 0x56, 0x16, 0xB8,  // anguleux
+    0x0B, 0x92, 0xD0, 0xB0, 0x00,  // animal
+    0x0B, 0x9C, 0x5C, 0x16, 0x40,  // annexer
+    0x0B, 0x9C, 0xF7, 0x0C, 0xA0,  // annonce
+    0x0B, 0x9D, 0x52, 0xB0, 0x00,  // annuel
+    0x0B, 0x9E, 0x44, 0xB8, 0x00,  // anodin
+    0x0B, 0x9E, 0xD0, 0xB1, 0x25,  // anomalie
+    0x0B, 0x9E, 0xEC, 0xB4, 0xA0,  // anonyme
+    0x0B, 0x9F, 0x26, 0x85, 0x80,  // anormal
+    0x0B, 0xA8, 0x57, 0x38, 0xA0,  // antenne
+    0x0B, 0xA8, 0x92, 0x3E, 0x85,  // antidote
+    0x0B, 0xB0, 0x92, 0xD7, 0x00,  // anxieux
+    0x0C, 0x02, 0x99, 0x96, 0x40,  // apaiser
+    0x0C, 0x0B, 0x24, 0xD1, 0x26,  // aperitif
+    0x0C, 0x18, 0x17, 0x26, 0x40,  // aplanir
+    0x0C, 0x1E, 0xC7, 0x9D, 0x25,  // apologie
+    0x0C, 0x20, 0x19, 0x15, 0x2C,  // appareil
+    0x0C, 0x20, 0x56, 0x16, 0x40,  // appeler
+    0x0C, 0x20, 0xF9, 0x50, 0xB2,  // apporter
+    0x0C, 0x21, 0x5C, 0x96, 0x40,  // appuyer
+    0x0C, 0x6A, 0x19, 0x26, 0xAD,  // aquarium
+    0x0C, 0x6A, 0x52, 0x54, 0x60,  // aqueduc
+    0x0C, 0x84, 0x9A, 0x48, 0xA0,  // arbitre
+    0x0C, 0x85, 0x59, 0xD0, 0xA0,  // arbuste
+    0x0C, 0x88, 0x5A, 0xC8, 0x00,  // ardeur
+    0x0C, 0x88, 0xF4, 0xCC, 0xA0,  // ardoise
+    0x0C, 0x8E, 0x57, 0x50, 0x00,  // argent
+    0x0C, 0x98, 0x58, 0xD5, 0x2E,  // arlequin
+    0x0C, 0x9A, 0x1A, 0x56, 0x45,  // armature
+    0x0C, 0x9A, 0x56, 0x95, 0xD4,  // armement
+    0x0C, 0x9A, 0xF4, 0xC8, 0xA0,  // armoire
+    0x0C, 0x9B, 0x59, 0x14, 0x00,  // armure
+    0x0C, 0xA0, 0x57, 0x50, 0xB2,  // arpenter
+    0x0C, 0xA4, 0x11, 0xA0, 0xB2,  // arracher
+    0x0C, 0xA4, 0x9B, 0x16, 0x40,  // arriver
+    0x0C, 0xA4, 0xF9, 0x96, 0x40,  // arroser
+    0x0C, 0xA6, 0x57, 0x24, 0x60,  // arsenic
+    0x0C, 0xA8, 0x59, 0x24, 0xAC,  // arteriel
+    0x0C, 0xA8, 0x91, 0xB0, 0xA0,  // article
+    0x0C, 0xE0, 0x51, 0xD0, 0x00,  // aspect
+    0x0C, 0xE0, 0x80, 0xB2, 0x85,  // asphalte
+    0x0C, 0xE0, 0x99, 0x16, 0x40,  // aspirer
+    0x0C, 0xE6, 0x1A, 0xD0, 0x00,  // assaut
+    0x0C, 0xE6, 0x59, 0x59, 0x32,  // asservir
+    0x0C, 0xE6, 0x92, 0xD2, 0x85,  // assiette
+    0x0C, 0xE6, 0xF1, 0xA4, 0xB2,  // associer
+    0x0C, 0xE7, 0x59, 0x16, 0x40,  // assurer
+    0x0C, 0xE8, 0x91, 0xBE, 0x80,  // asticot
+    0x0C, 0xE9, 0x22, 0x80, 0x00,  // astre
+    0x0C, 0xE9, 0x51, 0x94, 0x00,  // astuce
+    0x0D, 0x0A, 0xC4, 0x96, 0x40,  // atelier
+    0x0D, 0x1E, 0xD2, 0x80, 0x00,  // atome
+    0x0D, 0x24, 0x9A, 0xB4, 0x00,  // atrium
+    0x0D, 0x24, 0xF1, 0x94, 0x00,  // atroce
+    0x0D, 0x28, 0x18, 0xD4, 0xA0,  // attaque
+    0x0D, 0x28, 0x57, 0x51, 0x26,  // attentif
+    0x0D, 0x28, 0x99, 0x16, 0x40,  // attirer
+    0x0D, 0x29, 0x20, 0xC0, 0xB2,  // attraper
+    0x0D, 0x44, 0x14, 0xB8, 0xA0,  // aubaine
+    0x0D, 0x44, 0x59, 0x1C, 0xA0,  // auberge
+    0x0D, 0x48, 0x11, 0x94, 0x00,  // audace
+    0x0D, 0x48, 0x91, 0x30, 0xA0,  // audible
+    0x0D, 0x4F, 0x59, 0x16, 0x40,  // augurer
+    0x0D, 0x64, 0xF9, 0x14, 0x00,  // aurore
+    0x0D, 0x68, 0xF6, 0xB8, 0xA0,  // automne
+    0x0D, 0x69, 0x2A, 0x8D, 0x05,  // autruche
+    0x0D, 0x82, 0xC2, 0xC8, 0x00,  // avaler
+    0x0D, 0x82, 0xE1, 0x96, 0x40,  // avancer
+    0x0D, 0x83, 0x24, 0x8C, 0xA0,  // avarice
+    0x0D, 0x8A, 0xE4, 0xC8, 0x00,  // avenir
+    0x0D, 0x8B, 0x29, 0x94, 0x00,  // averse
+    0x0D, 0x8B, 0x53, 0xB0, 0xA0,  // aveugle
+    0x0D, 0x92, 0x1A, 0x16, 0xB2,  // aviateur
+    0x0D, 0x92, 0x42, 0x80, 0x00,  // avide
+    0x0D, 0x92, 0xF7, 0x00, 0x00,  // avion
+    0x0D, 0x93, 0x32, 0xC8, 0x00,  // aviser
+    0x0D, 0x9E, 0x97, 0x14, 0x00,  // avoine
+    0x0D, 0x9F, 0x52, 0xC8, 0x00,  // avouer
+    0x0D, 0xA4, 0x96, 0x00, 0x00,  // avril
+    0x0E, 0x12, 0x16, 0x00, 0x00,  // axial
+    0x0E, 0x12, 0xF6, 0x94, 0x00,  // axiome
+    0x10, 0x48, 0x72, 0x80, 0x00,  // badge
+    0x10, 0x4C, 0xFA, 0x96, 0x40,  // bafouer
+    0x10, 0x4E, 0x13, 0x94, 0x00,  // bagage
+    0x10, 0x4F, 0x52, 0xD2, 0x85,  // baguette
+    0x10, 0x52, 0x77, 0x04, 0x85,  // baignade
+    0x10, 0x58, 0x17, 0x0C, 0xB2,  // balancer
+    0x10, 0x58, 0x37, 0xB8, 0x00,  // balcon
+    0x10, 0x58, 0x54, 0xB8, 0xA0,  // baleine
+    0x10, 0x58, 0x99, 0x84, 0xE5,  // balisage
+    0x10, 0x5A, 0x24, 0xB8, 0x00,  // bambin
+    0x10, 0x5C, 0x30, 0xA6, 0x45,  // bancaire
+    0x10, 0x5C, 0x40, 0x9C, 0xA0,  // bandage
+    0x10, 0x5C, 0xC4, 0x96, 0xA5,  // banlieue
+    0x10, 0x5C, 0xE4, 0x96, 0x45,  // banniere
+    0x10, 0x5D, 0x1A, 0xA4, 0xB2,  // banquier
+    0x10, 0x64, 0x24, 0x96, 0x40,  // barbier
+    0x10, 0x64, 0x96, 0x00, 0x00,  // baril
+    0x10, 0x64, 0xF7, 0x00, 0x00,  // baron
+    0x10, 0x65, 0x1A, 0x94, 0x00,  // barque
+    0x10, 0x65, 0x20, 0x9C, 0xA0,  // barrage
+    0x10, 0x67, 0x34, 0xB8, 0x00,  // bassin
+    0x10, 0x67, 0x44, 0xBD, 0xC0,  // bastion
+    0x10, 0x68, 0x14, 0xB1, 0x85,  // bataille
+    0x10, 0x68, 0x50, 0xD4, 0x00,  // bateau
+    0x10, 0x69, 0x42, 0xC9, 0x25,  // batterie
+    0x10, 0x6A, 0x49, 0x24, 0xB2,  // baudrier
+    0x10, 0x6C, 0x19, 0x10, 0xB2,  // bavarder
+    0x11, 0x58, 0x5A, 0x50, 0xA0,  // belette
+    0x11, 0x58, 0x92, 0xC8, 0x00,  // belier
+    0x11, 0x58, 0xFA, 0x14, 0x00,  // belote
+    0x11, 0x5C, 0x53, 0x24, 0x65,  // benefice
+    0x11, 0x64, 0x32, 0x86, 0xA0,  // berceau
+    0x11, 0x64, 0x72, 0xC8, 0x00,  // berger
+    0x11, 0x64, 0xC4, 0xB8, 0xA0,  // berline
+    0x11, 0x64, 0xDA, 0x90, 0x20,  // bermuda
+    0x11, 0x66, 0x11, 0x94, 0x00,  // besace
+    0x11, 0x66, 0xF3, 0xB8, 0xA0,  // besogne
+    0x11, 0x68, 0x14, 0xB0, 0x00,  // betail
+    0x11, 0x6B, 0x29, 0x14, 0x00,  // beurre
+    0x12, 0x44, 0x59, 0x3D, 0xC0,  // biberon
+    0x12, 0x47, 0x91, 0xB0, 0xA0,  // bicycle
+    0x12, 0x49, 0x56, 0x14, 0x00,  // bidule
+    0x12, 0x54, 0xFA, 0x80, 0x00,  // bijou
+    0x12, 0x58, 0x17, 0x00, 0x00,  // bilan
+    0x12, 0x58, 0x97, 0x1E, 0xA5,  // bilingue
+    0x12, 0x58, 0xC0, 0xC8, 0x80,  // billard
+    0x12, 0x5C, 0x14, 0xC8, 0xA0,  // binaire
+    0x12, 0x5E, 0xC7, 0x9D, 0x25,  // biologie
+    0x12, 0x5F, 0x09, 0xA4, 0xA0,  // biopsie
+    0x12, 0x5F, 0x4C, 0xC0, 0xA0,  // biotype
+    0x12, 0x66, 0x3A, 0xA6, 0x80,  // biscuit
+    0x12, 0x66, 0xF7, 0x00, 0x00,  // bison
+    0x12, 0x67, 0x47, 0xD6, 0x49,  // bistouri
+    0x12, 0x69, 0x56, 0x94, 0x00,  // bitume
+    0x12, 0x74, 0x19, 0x48, 0xA0,  // bizarre
+    0x13, 0x02, 0x60, 0xC8, 0x80,  // blafard
+    0x13, 0x02, 0x7A, 0x94, 0x00,  // blague
+    0x13, 0x02, 0xE1, 0xA1, 0x32,  // blanchir
+    0x13, 0x0B, 0x39, 0x85, 0xD4,  // blessant
+    0x13, 0x12, 0xE2, 0x16, 0x40,  // blinder
+    0x13, 0x1E, 0xE2, 0x00, 0x00,  // blond
+    0x13, 0x1F, 0x1A, 0x96, 0x40,  // bloquer
+    0x13, 0x1F, 0x59, 0xBD, 0xC0,  // blouson
+    0x13, 0xC4, 0x19, 0x10, 0x00,  // bobard
+    0x13, 0xC4, 0x97, 0x14, 0x00,  // bobine
+    0x13, 0xD3, 0x22, 0x80, 0x00,  // boire
+    0x13, 0xD3, 0x32, 0xC8, 0x00,  // boiser
+    0x13, 0xD8, 0x92, 0x14, 0x00,  // bolide
+    0x13, 0xDC, 0x27, 0xB8, 0x00,  // bonbon
+    0x13, 0xDC, 0x44, 0xC8, 0x00,  // bondir
+    0x13, 0xDC, 0x82, 0xD6, 0x40,  // bonheur
+    0x13, 0xDC, 0x93, 0x24, 0xB2,  // bonifier
+    0x13, 0xDD, 0x59, 0x80, 0x00,  // bonus
+    0x13, 0xE4, 0x4A, 0xC8, 0xA0,  // bordure
+    0x13, 0xE4, 0xE2, 0x80, 0x00,  // borne
+    0x13, 0xE9, 0x42, 0x80, 0x00,  // botte
+    0x13, 0xEA, 0x36, 0x14, 0x00,  // boucle
+    0x13, 0xEA, 0x5A, 0xE0, 0x00,  // boueux
+    0x13, 0xEA, 0x74, 0x94, 0x00,  // bougie
+    0x13, 0xEA, 0xC7, 0xB8, 0x00,  // boulon
+    0x13, 0xEB, 0x1A, 0xA5, 0xC0,  // bouquin
+    0x13, 0xEB, 0x29, 0x94, 0x00,  // bourse
+    0x13, 0xEB, 0x39, 0xBD, 0x85,  // boussole
+    0x13, 0xEB, 0x44, 0xC6, 0xA5,  // boutique
+    0x13, 0xF0, 0x5A, 0xC8, 0x00,  // boxeur
+    0x14, 0x82, 0xE1, 0xA0, 0xA0,  // branche
+    0x14, 0x83, 0x34, 0x96, 0x40,  // brasier
+    0x14, 0x83, 0x62, 0x80, 0x00,  // brave
+    0x14, 0x8A, 0x24, 0xCC, 0x00,  // brebis
+    0x14, 0x8A, 0x34, 0x14, 0x00,  // breche
+    0x14, 0x8B, 0x5B, 0x04, 0xE5,  // breuvage
+    0x14, 0x92, 0x37, 0xB0, 0xB2,  // bricoler
+    0x14, 0x92, 0x70, 0x90, 0xA0,  // brigade
+    0x14, 0x92, 0xC6, 0x05, 0xD4,  // brillant
+    0x14, 0x92, 0xF1, 0xA0, 0xA0,  // brioche
+    0x14, 0x93, 0x1A, 0x94, 0x00,  // brique
+    0x14, 0x9E, 0x34, 0x56, 0x45,  // brochure
+    0x14, 0x9E, 0x42, 0xC8, 0x00,  // broder
+    0x14, 0x9E, 0xED, 0x16, 0x40,  // bronzer
+    0x14, 0x9F, 0x59, 0xCC, 0xA0,  // brousse
+    0x14, 0x9F, 0x92, 0xD6, 0x40,  // broyeur
+    0x14, 0xAA, 0xD2, 0x80, 0x00,  // brume
+    0x14, 0xAB, 0x38, 0xD4, 0xA0,  // brusque
+    0x14, 0xAB, 0x40, 0xB0, 0x00,  // brutal
+    0x14, 0xAB, 0x90, 0xBA, 0x80,  // bruyant
+    0x15, 0x4C, 0x66, 0x14, 0x00,  // buffle
+    0x15, 0x53, 0x39, 0xBD, 0xC0,  // buisson
+    0x15, 0x58, 0xC2, 0xD1, 0x2E,  // bulletin
+    0x15, 0x64, 0x50, 0xD4, 0x00,  // bureau
+    0x15, 0x64, 0x97, 0x00, 0x00,  // burin
+    0x15, 0x67, 0x44, 0x96, 0x40,  // bustier
+    0x15, 0x68, 0x97, 0x16, 0x40,  // butiner
+    0x15, 0x68, 0xF4, 0xC8, 0x00,  // butoir
+    0x15, 0x6C, 0x11, 0x30, 0xA0,  // buvable
+    0x15, 0x6C, 0x5A, 0x50, 0xA0,  // buvette
+    0x18, 0x44, 0x17, 0x3D, 0xC0,  // cabanon
+    0x18, 0x44, 0x97, 0x14, 0x00,  // cabine
+    0x18, 0x46, 0x82, 0xD2, 0x85,  // cachette
+    0x18, 0x48, 0x50, 0xD4, 0x00,  // cadeau
+    0x18, 0x49, 0x22, 0x80, 0x00,  // cadre
+    0x18, 0x4C, 0x54, 0xB8, 0xA0,  // cafeine
+    0x18, 0x52, 0xC6, 0x3E, 0xA0,  // caillou
+    0x18, 0x53, 0x39, 0xBD, 0xC0,  // caisson
+    0x18, 0x58, 0x3A, 0xB0, 0xB2,  // calculer
+    0x18, 0x58, 0x58, 0x25, 0xC0,  // calepin
+    0x18, 0x58, 0x91, 0x48, 0xA0,  // calibre
+    0x18, 0x58, 0xD2, 0xC8, 0x00,  // calmer
+    0x18, 0x58, 0xF6, 0xB9, 0x25,  // calomnie
+    0x18, 0x59, 0x60, 0xA6, 0x45,  // calvaire
+    0x18, 0x5A, 0x19, 0x04, 0x85,  // camarade
+    0x18, 0x5A, 0x59, 0x04, 0x00,  // camera
+    0x18, 0x5A, 0x97, 0xB8, 0x00,  // camion
+    0x18, 0x5B, 0x00, 0x9D, 0xC5,  // campagne
+    0x18, 0x5C, 0x16, 0x00, 0x00,  // canal
+    0x18, 0x5C, 0x5A, 0x3D, 0xC0,  // caneton
+    0x18, 0x5C, 0xF7, 0x00, 0x00,  // canon
+    0x18, 0x5D, 0x44, 0xB8, 0xA0,  // cantine
+    0x18, 0x5D, 0x56, 0x06, 0x40,  // canular
+    0x18, 0x60, 0x11, 0x30, 0xA0,  // capable
+    0x18, 0x60, 0xF9, 0x05, 0x80,  // caporal
+    0x18, 0x61, 0x24, 0x8C, 0xA0,  // caprice
+    0x18, 0x61, 0x3A, 0xB0, 0xA0,  // capsule
+    0x18, 0x61, 0x42, 0xC8, 0x00,  // capter
+    0x18, 0x61, 0x51, 0xA0, 0xA0,  // capuche
+    0x18, 0x64, 0x11, 0x25, 0xC5,  // carabine
+    0x18, 0x64, 0x27, 0xB8, 0xA0,  // carbone
+    0x18, 0x64, 0x59, 0xCC, 0xB2,  // caresser
+    0x18, 0x64, 0x91, 0x3E, 0xA0,  // caribou
+    0x18, 0x64, 0xE0, 0x9C, 0xA0,  // carnage
+    0x18, 0x64, 0xFA, 0x50, 0xA0,  // carotte
+    0x18, 0x65, 0x22, 0x86, 0xA0,  // carreau
+    0x18, 0x65, 0x47, 0xB8, 0x00,  // carton
+    0x18, 0x66, 0x30, 0x90, 0xA0,  // cascade
+    0x18, 0x66, 0x92, 0xC8, 0x00,  // casier
+    0x18, 0x67, 0x1A, 0x94, 0x00,  // casque
+    0x18, 0x67, 0x3A, 0xC8, 0xA0,  // cassure
+    0x18, 0x6B, 0x32, 0xC8, 0x00,  // causer
+    0x18, 0x6B, 0x44, 0xBD, 0xC0,  // caution
+    0x18, 0x6C, 0x16, 0x24, 0xB2,  // cavalier
+    0x18, 0x6C, 0x59, 0x38, 0xA0,  // caverne
+    0x18, 0x6C, 0x90, 0xC8, 0x00,  // caviar
+    0x19, 0x48, 0x96, 0x30, 0xA0,  // cedille
+    0x19, 0x52, 0xEA, 0x56, 0x45,  // ceinture
+    0x19, 0x58, 0x59, 0xD0, 0xA0,  // celeste
+    0x19, 0x58, 0xCA, 0xB0, 0xA0,  // cellule
+    0x19, 0x5C, 0x49, 0x24, 0xB2,  // cendrier
+    0x19, 0x5D, 0x3A, 0xC8, 0xB2,  // censurer
+    0x19, 0x5D, 0x49, 0x05, 0x80,  // central
+    0x19, 0x64, 0x36, 0x14, 0x00,  // cercle
+    0x19, 0x64, 0x51, 0x48, 0x2C,  // cerebral
+    0x19, 0x64, 0x99, 0x94, 0x00,  // cerise
+    0x19, 0x64, 0xE2, 0xC8, 0x00,  // cerner
+    0x19, 0x65, 0x62, 0x86, 0xA0,  // cerveau
+    0x19, 0x67, 0x32, 0xC8, 0x00,  // cesser
+    0x1A, 0x02, 0x79, 0x25, 0xC0,  // chagrin
+    0x1A, 0x02, 0x99, 0x94, 0x00,  // chaise
+    0x1A, 0x02, 0xC2, 0xD6, 0x40,  // chaleur
+    0x1A, 0x02, 0xD1, 0x48, 0xA0,  // chambre
+    0x1A, 0x02, 0xE1, 0x94, 0x00,  // chance
+    0x1A, 0x03, 0x04, 0xD2, 0x45,  // chapitre
+    0x1A, 0x03, 0x21, 0x3D, 0xC0,  // charbon
+    0x1A, 0x03, 0x39, 0x96, 0xB2,  // chasseur
+    0x1A, 0x03, 0x47, 0xB8, 0x00,  // chaton
+    0x1A, 0x03, 0x59, 0xCD, 0xEE,  // chausson
+    0x1A, 0x03, 0x64, 0xC8, 0xB2,  // chavirer
+    0x1A, 0x0A, 0xD4, 0xCC, 0xA0,  // chemise
+    0x1A, 0x0A, 0xE4, 0xB1, 0x85,  // chenille
+    0x1A, 0x0B, 0x1A, 0xA4, 0xB2,  // chequier
+    0x1A, 0x0B, 0x21, 0xA0, 0xB2,  // chercher
+    0x1A, 0x0B, 0x60, 0xB0, 0x00,  // cheval
+    0x1A, 0x12, 0x57, 0x00, 0x00,  // chien
+    0x1A, 0x12, 0x63, 0x48, 0xA0,  // chiffre
+    0x1A, 0x12, 0x77, 0x3D, 0xC0,  // chignon
+    0x1A, 0x12, 0xD2, 0xC8, 0xA0,  // chimere
+    0x1A, 0x12, 0xFA, 0x00, 0x00,  // chiot
+    0x1A, 0x18, 0xF9, 0x56, 0x45,  // chlorure
+    0x1A, 0x1E, 0x37, 0xB0, 0x34,  // chocolat
+    0x1A, 0x1E, 0x99, 0xA6, 0x40,  // choisir
+    0x1A, 0x1F, 0x32, 0x80, 0x00,  // chose
+    0x1A, 0x1F, 0x52, 0xD2, 0x85,  // chouette
+    0x1A, 0x24, 0xF6, 0x94, 0x00,  // chrome
+    0x1A, 0x2B, 0x42, 0x80, 0x00,  // chute
+    0x1A, 0x4E, 0x19, 0x14, 0x00,  // cigare
+    0x1A, 0x4E, 0xF3, 0xB8, 0xA0,  // cigogne
+    0x1A, 0x5A, 0x57, 0x50, 0xB2,  // cimenter
+    0x1A, 0x5C, 0x56, 0x84, 0x00,  // cinema
+    0x1A, 0x5D, 0x49, 0x16, 0x40,  // cintrer
+    0x1A, 0x64, 0x3A, 0xB0, 0xB2,  // circuler
+    0x1A, 0x64, 0x59, 0x00, 0x00,  // cirer
+    0x1A, 0x65, 0x1A, 0x94, 0x00,  // cirque
+    0x1A, 0x68, 0x59, 0x38, 0xA0,  // citerne
+    0x1A, 0x68, 0xFC, 0x95, 0xC0,  // citoyen
+    0x1A, 0x69, 0x27, 0xB8, 0x00,  // citron
+    0x1A, 0x6C, 0x96, 0x00, 0x00,  // civil
+    0x1B, 0x02, 0x99, 0x3D, 0xC0,  // clairon
+    0x1B, 0x02, 0xD2, 0xD6, 0x40,  // clameur
+    0x1B, 0x03, 0x1A, 0x96, 0x40,  // claquer
+    0x1B, 0x03, 0x39, 0x94, 0x00,  // classe
+    0x1B, 0x03, 0x64, 0x96, 0x40,  // clavier
+    0x1B, 0x12, 0x57, 0x50, 0x00,  // client
+    0x1B, 0x12, 0x77, 0x16, 0x40,  // cligner
+    0x1B, 0x12, 0xD0, 0xD0, 0x00,  // climat
+    0x1B, 0x13, 0x60, 0x9C, 0xA0,  // clivage
+    0x1B, 0x1E, 0x34, 0x14, 0x00,  // cloche
+    0x1B, 0x1E, 0xE0, 0x9C, 0xA0,  // clonage
+    0x1B, 0x1F, 0x07, 0xCA, 0x85,  // cloporte
+    0x1B, 0xC4, 0x16, 0x50, 0x00,  // cobalt
+    0x1B, 0xC5, 0x20, 0x80, 0x00,  // cobra
+    0x1B, 0xC6, 0x19, 0xCC, 0xA0,  // cocasse
+    0x1B, 0xC6, 0xFA, 0x24, 0xB2,  // cocotier
+    0x1B, 0xC8, 0x59, 0x00, 0x00,  // coder
+    0x1B, 0xC8, 0x93, 0x24, 0xB2,  // codifier
+    0x1B, 0xCC, 0x69, 0x14, 0x00,  // coffre
+    0x1B, 0xCE, 0xE2, 0xC8, 0x00,  // cogner
+    0x1B, 0xD0, 0x59, 0xA5, 0xEE,  // cohesion
+    0x1B, 0xD2, 0x63, 0x16, 0x40,  // coiffer
+    0x1B, 0xD2, 0xE1, 0x96, 0x40,  // coincer
+    0x1B, 0xD8, 0x59, 0x14, 0x00,  // colere
+    0x1B, 0xD8, 0x91, 0x49, 0x20,  // colibri
+    0x1B, 0xD8, 0xC4, 0xB8, 0xA0,  // colline
+    0x1B, 0xD8, 0xD0, 0xD0, 0xB2,  // colmater
+    0x1B, 0xD8, 0xF7, 0x15, 0x80,  // colonel
+    0x1B, 0xDA, 0x20, 0xD0, 0x00,  // combat
+    0x1B, 0xDA, 0x52, 0x24, 0xA0,  // comedie
+    0x1B, 0xDA, 0xD0, 0xB8, 0x85,  // commande
+    0x1B, 0xDB, 0x00, 0x8E, 0x80,  // compact
+    0x1B, 0xDC, 0x32, 0xCA, 0x80,  // concert
+    0x1B, 0xDC, 0x4A, 0xA6, 0x45,  // conduire
+    0x1B, 0xDC, 0x64, 0x96, 0x40,  // confier
+    0x1B, 0xDC, 0x72, 0xB0, 0xB2,  // congeler
+    0x1B, 0xDC, 0xE7, 0xD0, 0xB2,  // connoter
+    0x1B, 0xDD, 0x37, 0xB9, 0xC5,  // consonne
+    0x1B, 0xDD, 0x40, 0x8E, 0x80,  // contact
+    0x1B, 0xDD, 0x62, 0xE0, 0xA0,  // convexe
+    0x1B, 0xE0, 0x14, 0xB8, 0x00,  // copain
+    0x1B, 0xE0, 0x92, 0x80, 0x00,  // copie
+    0x1B, 0xE4, 0x14, 0xB0, 0x00,  // corail
+    0x1B, 0xE4, 0x22, 0x86, 0xA0,  // corbeau
+    0x1B, 0xE4, 0x40, 0x9C, 0xA0,  // cordage
+    0x1B, 0xE4, 0xE4, 0x8D, 0x05,  // corniche
+    0x1B, 0xE5, 0x0A, 0xCC, 0x00,  // corpus
+    0x1B, 0xE5, 0x22, 0x8E, 0x80,  // correct
+    0x1B, 0xE5, 0x42, 0x9C, 0xA0,  // cortege
+    0x1B, 0xE6, 0xD4, 0xC6, 0xA5,  // cosmique
+    0x1B, 0xE7, 0x4A, 0xB4, 0xA0,  // costume
+    0x1B, 0xE8, 0xF7, 0x00, 0x00,  // coton
+    0x1B, 0xEA, 0x42, 0x80, 0x00,  // coude
+    0x1B, 0xEB, 0x0A, 0xC8, 0xA0,  // coupure
+    0x1B, 0xEB, 0x20, 0x9C, 0xA0,  // courage
+    0x1B, 0xEB, 0x42, 0x86, 0xA0,  // couteau
+    0x1B, 0xEB, 0x69, 0x26, 0x40,  // couvrir
+    0x1B, 0xF2, 0xFA, 0x14, 0x00,  // coyote
+    0x1C, 0x82, 0x22, 0x80, 0x00,  // crabe
+    0x1C, 0x82, 0x97, 0x50, 0xA0,  // crainte
+    0x1C, 0x83, 0x60, 0xD0, 0xA0,  // cravate
+    0x1C, 0x83, 0x97, 0xB8, 0x00,  // crayon
+    0x1C, 0x8A, 0x1A, 0x56, 0x45,  // creature
+    0x1C, 0x8A, 0x44, 0xD0, 0xB2,  // crediter
+    0x1C, 0x8A, 0xD2, 0xD7, 0x00,  // cremeux
+    0x1C, 0x8B, 0x59, 0x96, 0x40,  // creuser
+    0x1C, 0x8B, 0x62, 0xD2, 0x85,  // crevette
+    0x1C, 0x92, 0x26, 0x16, 0x40,  // cribler
+    0x1C, 0x92, 0x59, 0x00, 0x00,  // crier
+    0x1C, 0x93, 0x3A, 0x05, 0x80,  // cristal
+    0x1C, 0x93, 0x42, 0xC8, 0xA0,  // critere
+    0x1C, 0x9E, 0x99, 0x14, 0x00,  // croire
+    0x1C, 0x9F, 0x1A, 0x96, 0x40,  // croquer
+    0x1C, 0x9F, 0x40, 0xB0, 0xA0,  // crotale
+    0x1C, 0xAA, 0x34, 0x85, 0x80,  // crucial
+    0x1C, 0xAA, 0x56, 0x00, 0x00,  // cruel
+    0x1C, 0xB3, 0x0A, 0x16, 0x40,  // crypter
+    0x1D, 0x44, 0x98, 0xD4, 0xA0,  // cubique
+    0x1D, 0x4A, 0x96, 0x31, 0x32,  // cueillir
+    0x1D, 0x52, 0xC6, 0x16, 0x45,  // cuillere
+    0x1D, 0x53, 0x34, 0xB8, 0xA0,  // cuisine
+    0x1D, 0x53, 0x69, 0x14, 0x00,  // cuivre
+    0x1D, 0x58, 0xD4, 0xB8, 0xB2,  // culminer
+    0x1D, 0x59, 0x44, 0xD8, 0xB2,  // cultiver
+    0x1D, 0x5B, 0x56, 0x16, 0x40,  // cumuler
+    0x1D, 0x60, 0x92, 0x14, 0x00,  // cupide
+    0x1D, 0x64, 0x1A, 0x24, 0xC0,  // curatif
+    0x1D, 0x65, 0x32, 0xD6, 0x40,  // curseur
+    0x1E, 0x42, 0xEA, 0xC8, 0xA0,  // cyanure
+    0x1E, 0x46, 0xC2, 0x80, 0x00,  // cycle
+    0x1E, 0x58, 0x97, 0x12, 0x45,  // cylindre
+    0x1E, 0x5C, 0x98, 0xD4, 0xA0,  // cynique
+    0x20, 0x52, 0x77, 0x16, 0x40,  // daigner
+    0x20, 0x5A, 0x92, 0xC8, 0x00,  // damier
+    0x20, 0x5C, 0x72, 0xC8, 0x00,  // danger
+    0x20, 0x5D, 0x32, 0xD6, 0x40,  // danseur
+    0x20, 0x6B, 0x04, 0x25, 0xC0,  // dauphin
+    0x21, 0x44, 0x1A, 0x52, 0x45,  // debattre
+    0x21, 0x44, 0x9A, 0x16, 0x40,  // debiter
+    0x21, 0x44, 0xF9, 0x10, 0xB2,  // deborder
+    0x21, 0x45, 0x24, 0x90, 0xB2,  // debrider
+    0x21, 0x45, 0x5A, 0x05, 0xD4,  // debutant
+    0x21, 0x46, 0x16, 0x16, 0x40,  // decaler
+    0x21, 0x46, 0x56, 0x8A, 0x45,  // decembre
+    0x21, 0x46, 0x84, 0xC8, 0xB2,  // dechirer
+    0x21, 0x46, 0x92, 0x16, 0x40,  // decider
+    0x21, 0x46, 0xC0, 0xC8, 0xB2,  // declarer
+    0x21, 0x46, 0xF9, 0x16, 0x40,  // decorer
+    0x21, 0x47, 0x24, 0xC8, 0xA0,  // decrire
+    0x21, 0x47, 0x58, 0x30, 0xB2,  // decupler
+    0x21, 0x48, 0x16, 0x14, 0x00,  // dedale
+    0x21, 0x49, 0x51, 0xD1, 0x26,  // deductif
+    0x21, 0x4B, 0x39, 0x94, 0x00,  // deesse
+    0x21, 0x4C, 0x57, 0x4D, 0x26,  // defensif
+    0x21, 0x4C, 0x96, 0x16, 0x40,  // defiler
+    0x21, 0x4D, 0x20, 0xE4, 0xB2,  // defrayer
+    0x21, 0x4E, 0x13, 0x96, 0x40,  // degager
+    0x21, 0x4E, 0x9B, 0x48, 0xB2,  // degivrer
+    0x21, 0x4E, 0xCA, 0xD1, 0x32,  // deglutir
+    0x21, 0x4F, 0x20, 0x98, 0xB2,  // degrafer
+    0x21, 0x54, 0x5A, 0xB8, 0xB2,  // dejeuner
+    0x21, 0x58, 0x91, 0x94, 0x00,  // delice
+    0x21, 0x58, 0xF3, 0x96, 0x40,  // deloger
+    0x21, 0x5A, 0x17, 0x10, 0xB2,  // demander
+    0x21, 0x5A, 0x5A, 0xC8, 0xB2,  // demeurer
+    0x21, 0x5A, 0xF6, 0x26, 0x40,  // demolir
+    0x21, 0x5C, 0x91, 0xA0, 0xB2,  // denicher
+    0x21, 0x5C, 0xFA, 0x96, 0x40,  // denouer
+    0x21, 0x5D, 0x42, 0xB1, 0x85,  // dentelle
+    0x21, 0x5D, 0x52, 0x16, 0x40,  // denuder
+    0x21, 0x60, 0x19, 0x50, 0x00,  // depart
+    0x21, 0x60, 0x57, 0x4C, 0xB2,  // depenser
+    0x21, 0x60, 0x80, 0xCC, 0xB2,  // dephaser
+    0x21, 0x60, 0xC0, 0x8C, 0xB2,  // deplacer
+    0x21, 0x60, 0xF9, 0x96, 0x40,  // deposer
+    0x21, 0x64, 0x17, 0x1C, 0xB2,  // deranger
+    0x21, 0x64, 0xF1, 0x16, 0x40,  // derober
+    0x21, 0x66, 0x19, 0xD2, 0x45,  // desastre
+    0x21, 0x66, 0x32, 0xBA, 0x85,  // descente
+    0x21, 0x66, 0x59, 0x50, 0x00,  // desert
+    0x21, 0x66, 0x93, 0xB8, 0xB2,  // designer
+    0x21, 0x66, 0xF1, 0x15, 0x32,  // desobeir
+    0x21, 0x67, 0x34, 0xB8, 0xB2,  // dessiner
+    0x21, 0x67, 0x49, 0x24, 0xB2,  // destrier
+    0x21, 0x68, 0x11, 0xA0, 0xB2,  // detacher
+    0x21, 0x68, 0x59, 0xD0, 0xB2,  // detester
+    0x21, 0x68, 0xFA, 0xC8, 0xB2,  // detourer
+    0x21, 0x69, 0x22, 0xCE, 0x65,  // detresse
+    0x21, 0x6C, 0x17, 0x0C, 0xB2,  // devancer
+    0x21, 0x6C, 0x57, 0x26, 0x40,  // devenir
+    0x21, 0x6C, 0x97, 0x16, 0x40,  // deviner
+    0x21, 0x6C, 0xF4, 0xC8, 0x00,  // devoir
+    0x22, 0x42, 0x26, 0x14, 0x00,  // diable
+    0x22, 0x42, 0xC7, 0x9E, 0xA5,  // dialogue
+    0x22, 0x42, 0xD0, 0xBA, 0x80,  // diamant
+    0x22, 0x47, 0x42, 0xC8, 0x00,  // dicter
+    0x22, 0x4C, 0x62, 0xC8, 0xB2,  // differer
+    0x22, 0x4E, 0x59, 0x16, 0x40,  // digerer
+    0x22, 0x4E, 0x9A, 0x05, 0x80,  // digital
+    0x22, 0x4E, 0xE2, 0x80, 0x00,  // digne
+    0x22, 0x59, 0x52, 0xC8, 0x00,  // diluer
+    0x22, 0x5A, 0x17, 0x0D, 0x05,  // dimanche
+    0x22, 0x5A, 0x97, 0x54, 0xB2,  // diminuer
+    0x22, 0x5F, 0x8C, 0x90, 0xA0,  // dioxyde
+    0x22, 0x64, 0x51, 0xD1, 0x26,  // directif
+    0x22, 0x64, 0x93, 0x96, 0x40,  // diriger
+    0x22, 0x66, 0x3A, 0xD0, 0xB2,  // discuter
+    0x22, 0x67, 0x07, 0xCC, 0xB2,  // disposer
+    0x22, 0x67, 0x34, 0xC0, 0xB2,  // dissiper
+    0x22, 0x67, 0x40, 0xB8, 0x65,  // distance
+    0x22, 0x6C, 0x59, 0x51, 0x32,  // divertir
+    0x22, 0x6C, 0x99, 0x96, 0x40,  // diviser
+    0x23, 0xC6, 0x96, 0x14, 0x00,  // docile
+    0x23, 0xC7, 0x42, 0xD6, 0x40,  // docteur
+    0x23, 0xCE, 0xD2, 0x80, 0x00,  // dogme
+    0x23, 0xD2, 0x7A, 0x00, 0x00,  // doigt
+    0x23, 0xDA, 0x14, 0xB8, 0xA0,  // domaine
+    0x23, 0xDA, 0x91, 0xA5, 0x85,  // domicile
+    0x23, 0xDB, 0x0A, 0x16, 0x40,  // dompter
+    0x23, 0xDC, 0x1A, 0x16, 0xB2,  // donateur
+    0x23, 0xDC, 0xA7, 0xB8, 0x00,  // donjon
+    0x23, 0xDC, 0xE2, 0xC8, 0x00,  // donner
+    0x23, 0xE0, 0x16, 0xA5, 0xC5,  // dopamine
+    0x23, 0xE5, 0x47, 0xA6, 0x40,  // dortoir
+    0x23, 0xE5, 0x59, 0x14, 0x00,  // dorure
+    0x23, 0xE6, 0x13, 0x94, 0x00,  // dosage
+    0x23, 0xE6, 0x5A, 0xC8, 0x00,  // doseur
+    0x23, 0xE7, 0x34, 0x96, 0x40,  // dossier
+    0x23, 0xE8, 0x1A, 0x25, 0xEE,  // dotation
+    0x23, 0xEA, 0x17, 0x24, 0xB2,  // douanier
+    0x23, 0xEA, 0x26, 0x14, 0x00,  // double
+    0x23, 0xEA, 0x32, 0xD6, 0x40,  // douceur
+    0x23, 0xEB, 0x42, 0xC8, 0x00,  // douter
+    0x23, 0xF2, 0x57, 0x00, 0x00,  // doyen
+    0x24, 0x82, 0x77, 0xB8, 0x00,  // dragon
+    0x24, 0x83, 0x02, 0xC8, 0x00,  // draper
+    0x24, 0x8B, 0x39, 0x96, 0x40,  // dresser
+    0x24, 0x92, 0x21, 0x30, 0xB2,  // dribbler
+    0x24, 0x9E, 0x9A, 0x56, 0x45,  // droiture
+    0x25, 0x60, 0x59, 0x24, 0xA0,  // duperie
+    0x25, 0x60, 0xC2, 0xE0, 0xA0,  // duplexe
+    0x25, 0x64, 0x11, 0x30, 0xA0,  // durable
+    0x25, 0x64, 0x34, 0xC8, 0x00,  // durcir
+    0x26, 0x5C, 0x19, 0xD1, 0x25,  // dynastie
+    0x28, 0x98, 0xFA, 0xA6, 0x40,  // eblouir
+    0x28, 0xC3, 0x2A, 0x16, 0x40,  // ecarter
+    0x28, 0xD0, 0x19, 0x40, 0xA0,  // echarpe
+    0x28, 0xD0, 0x56, 0x30, 0xA0,  // echelle
+    0x28, 0xD8, 0x14, 0xC8, 0xB2,  // eclairer
+    0x28, 0xD8, 0x98, 0x4C, 0xA0,  // eclipse
+    0x28, 0xD8, 0xF9, 0x14, 0x00,  // eclore
+    0x28, 0xD9, 0x59, 0x94, 0x00,  // ecluse
+    0x28, 0xDE, 0xC2, 0x80, 0x00,  // ecole
+    0x28, 0xDE, 0xE7, 0xB5, 0x25,  // economie
+    0x28, 0xDF, 0x21, 0x94, 0x00,  // ecorce
+    0x28, 0xDF, 0x5A, 0x16, 0x40,  // ecouter
+    0x28, 0xE4, 0x19, 0x96, 0x40,  // ecraser
+    0x28, 0xE4, 0x56, 0x96, 0x40,  // ecremer
+    0x28, 0xE4, 0x9B, 0x05, 0x2E,  // ecrivain
+    0x28, 0xE4, 0xFA, 0x80, 0x00,  // ecrou
+    0x28, 0xEA, 0xD2, 0x80, 0x00,  // ecume
+    0x28, 0xEB, 0x22, 0xD5, 0x2C,  // ecureuil
+    0x29, 0x12, 0x64, 0x96, 0x40,  // edifier
+    0x29, 0x2B, 0x1A, 0x96, 0x40,  // eduquer
+    0x29, 0x8C, 0x11, 0x96, 0x40,  // effacer
+    0x29, 0x8C, 0x51, 0xD1, 0x26,  // effectif
+    0x29, 0x8C, 0x93, 0xA4, 0xA0,  // effigie
+    0x29, 0x8C, 0xF9, 0x50, 0x00,  // effort
+    0x29, 0x8D, 0x20, 0xE4, 0xB2,  // effrayer
+    0x29, 0x8D, 0x59, 0xA5, 0xEE,  // effusion
+    0x29, 0xC2, 0xC4, 0xCC, 0xB2,  // egaliser
+    0x29, 0xC3, 0x22, 0xC8, 0x00,  // egarer
+    0x2A, 0x8A, 0x3A, 0x16, 0x40,  // ejecter
+    0x2B, 0x02, 0x27, 0xC8, 0xB2,  // elaborer
+    0x2B, 0x03, 0x23, 0xA6, 0x40,  // elargir
+    0x2B, 0x0A, 0x3A, 0x49, 0xEE,  // electron
+    0x2B, 0x0A, 0x70, 0xBA, 0x80,  // elegant
+    0x2B, 0x0B, 0x04, 0x05, 0xD4,  // elephant
+    0x2B, 0x0B, 0x62, 0x80, 0x00,  // eleve
+    0x2B, 0x12, 0x74, 0x89, 0x85,  // eligible
+    0x2B, 0x13, 0x44, 0xCD, 0xA5,  // elitisme
+    0x2B, 0x1E, 0x72, 0x80, 0x00,  // eloge
+    0x2B, 0x2A, 0x34, 0x90, 0xB2,  // elucider
+    0x2B, 0x2A, 0x42, 0xC8, 0x00,  // eluder
+    0x2B, 0x44, 0x16, 0x30, 0xB2,  // emballer
+    0x2B, 0x44, 0x56, 0x31, 0x32,  // embellir
+    0x2B, 0x45, 0x2C, 0xBD, 0xC0,  // embryon
+    0x2B, 0x4B, 0x20, 0xD4, 0x85,  // emeraude
+    0x2B, 0x53, 0x39, 0xA5, 0xEE,  // emission
+    0x2B, 0x5A, 0x57, 0x16, 0x40,  // emmener
+    0x2B, 0x5F, 0x44, 0xBD, 0xC0,  // emotion
+    0x2B, 0x5F, 0x5B, 0x3D, 0x32,  // emouvoir
+    0x2B, 0x60, 0x59, 0x16, 0xB2,  // empereur
+    0x2B, 0x60, 0xC7, 0xE4, 0xB2,  // employer
+    0x2B, 0x60, 0xF9, 0x50, 0xB2,  // emporter
+    0x2B, 0x61, 0x24, 0xCC, 0xA0,  // emprise
+    0x2B, 0x6A, 0xC9, 0xA5, 0xEE,  // emulsion
+    0x2B, 0x86, 0x12, 0x48, 0xB2,  // encadrer
+    0x2B, 0x86, 0x82, 0xC8, 0xA0,  // enchere
+    0x2B, 0x86, 0xC0, 0xD8, 0xA0,  // enclave
+    0x2B, 0x86, 0xF1, 0xA0, 0xA0,  // encoche
+    0x2B, 0x88, 0x93, 0xD4, 0xB2,  // endiguer
+    0x2B, 0x88, 0xF9, 0xCC, 0xB2,  // endosser
+    0x2B, 0x89, 0x27, 0xA6, 0x80,  // endroit
+    0x2B, 0x89, 0x54, 0xC8, 0xA0,  // enduire
+    0x2B, 0x8B, 0x23, 0xA4, 0xA0,  // energie
+    0x2B, 0x8C, 0x17, 0x0C, 0xA0,  // enfance
+    0x2B, 0x8C, 0x59, 0x34, 0xB2,  // enfermer
+    0x2B, 0x8C, 0xFA, 0xA6, 0x40,  // enfouir
+    0x2B, 0x8E, 0x13, 0x96, 0x40,  // engager
+    0x2B, 0x8E, 0x97, 0x00, 0x00,  // engin
+    0x2B, 0x8E, 0xC7, 0x88, 0xB2,  // englober
+    0x2B, 0x92, 0x76, 0x94, 0x00,  // enigme
+    0x2B, 0x94, 0x16, 0x88, 0xB2,  // enjamber
+    0x2B, 0x94, 0x5A, 0x80, 0x00,  // enjeu
+    0x2B, 0x98, 0x5B, 0x16, 0x40,  // enlever
+    0x2B, 0x9C, 0x56, 0xA4, 0x00,  // ennemi
+    0x2B, 0x9D, 0x5C, 0x96, 0xB8,  // ennuyeux
+    0x2B, 0xA4, 0x91, 0xA1, 0x32,  // enrichir
+    0x2B, 0xA4, 0xF1, 0x04, 0xE5,  // enrobage
+    0x2B, 0xA6, 0x54, 0x9D, 0xC5,  // enseigne
+    0x2B, 0xA8, 0x19, 0xCC, 0xB2,  // entasser
+    0x2B, 0xA8, 0x57, 0x12, 0x45,  // entendre
+    0x2B, 0xA8, 0x92, 0xC8, 0x00,  // entier
+    0x2B, 0xA8, 0xFA, 0xC8, 0xB2,  // entourer
+    0x2B, 0xA9, 0x20, 0xD8, 0xB2,  // entraver
+    0x2B, 0xAA, 0xD2, 0xC8, 0xB2,  // enumerer
+    0x2B, 0xAC, 0x14, 0x26, 0x40,  // envahir
+    0x2B, 0xAC, 0x90, 0x89, 0x85,  // enviable
+    0x2B, 0xAC, 0xFC, 0x96, 0x40,  // envoyer
+    0x2B, 0xB5, 0x96, 0x94, 0x00,  // enzyme
+    0x2B, 0xD8, 0x92, 0xB8, 0x00,  // eolien
+    0x2C, 0x02, 0x99, 0xCD, 0x32,  // epaissir
+    0x2C, 0x03, 0x23, 0xB8, 0xA0,  // epargne
+    0x2C, 0x03, 0x40, 0xBA, 0x80,  // epatant
+    0x2C, 0x03, 0x56, 0x14, 0x00,  // epaule
+    0x2C, 0x12, 0x32, 0xC9, 0x25,  // epicerie
+    0x2C, 0x12, 0x42, 0xB5, 0x25,  // epidemie
+    0x2C, 0x12, 0x59, 0x00, 0x00,  // epier
+    0x2C, 0x12, 0xC7, 0x9E, 0xA5,  // epilogue
+    0x2C, 0x12, 0xE2, 0x80, 0x00,  // epine
+    0x2C, 0x13, 0x37, 0x90, 0xA0,  // episode
+    0x2C, 0x13, 0x40, 0xC1, 0x05,  // epitaphe
+    0x2C, 0x1F, 0x1A, 0x94, 0x00,  // epoque
+    0x2C, 0x24, 0x5A, 0xD8, 0xA0,  // epreuve
+    0x2C, 0x24, 0xFA, 0xD8, 0xB2,  // eprouver
+    0x2C, 0x2A, 0x99, 0x85, 0xD4,  // epuisant
+    0x2C, 0x6A, 0x59, 0x48, 0xA0,  // equerre
+    0x2C, 0x6A, 0x98, 0x14, 0x00,  // equipe
+    0x2C, 0x92, 0x72, 0xC8, 0x00,  // eriger
+    0x2C, 0x9F, 0x34, 0xBD, 0xC0,  // erosion
+    0x2C, 0xA4, 0x5A, 0xC8, 0x00,  // erreur
+    0x2C, 0xAB, 0x0A, 0x25, 0xEE,  // eruption
+    0x2C, 0xC6, 0x16, 0x24, 0xB2,  // escalier
+    0x2C, 0xE0, 0x12, 0x3D, 0xC0,  // espadon
+    0x2C, 0xE0, 0x51, 0x94, 0x00,  // espece
+    0x2C, 0xE0, 0x92, 0x9D, 0x85,  // espiegle
+    0x2C, 0xE0, 0xF4, 0xC8, 0x00,  // espoir
+    0x2C, 0xE1, 0x24, 0xD0, 0x00,  // esprit
+    0x2C, 0xE3, 0x54, 0xD8, 0xB2,  // esquiver
+    0x2C, 0xE6, 0x1C, 0x96, 0x40,  // essayer
+    0x2C, 0xE6, 0x57, 0x0C, 0xA0,  // essence
+    0x2C, 0xE6, 0x92, 0xD4, 0x00,  // essieu
+    0x2C, 0xE6, 0xF9, 0x16, 0x40,  // essorer
+    0x2C, 0xE8, 0x96, 0x94, 0x00,  // estime
+    0x2C, 0xE8, 0xF6, 0x84, 0x60,  // estomac
+    0x2C, 0xE9, 0x20, 0x90, 0xA0,  // estrade
+    0x2D, 0x02, 0x72, 0xC8, 0xA0,  // etagere
+    0x2D, 0x02, 0xC2, 0xC8, 0x00,  // etaler
+    0x2D, 0x02, 0xE1, 0xA0, 0xA0,  // etanche
+    0x2D, 0x03, 0x44, 0xC6, 0xA5,  // etatique
+    0x2D, 0x0A, 0x97, 0x12, 0x45,  // eteindre
+    0x2D, 0x0A, 0xE2, 0x3D, 0x32,  // etendoir
+    0x2D, 0x0B, 0x27, 0x15, 0x80,  // eternel
+    0x2D, 0x10, 0x17, 0x3D, 0x80,  // ethanol
+    0x2D, 0x10, 0x98, 0xD4, 0xA0,  // ethique
+    0x2D, 0x10, 0xE4, 0x94, 0x00,  // ethnie
+    0x2D, 0x13, 0x22, 0xC8, 0x00,  // etirer
+    0x2D, 0x1E, 0x63, 0x16, 0x40,  // etoffer
+    0x2D, 0x1E, 0x96, 0x14, 0x00,  // etoile
+    0x2D, 0x1E, 0xE7, 0x05, 0xD4,  // etonnant
+    0x2D, 0x1F, 0x59, 0x11, 0x32,  // etourdir
+    0x2D, 0x24, 0x17, 0x1C, 0xA0,  // etrange
+    0x2D, 0x24, 0xF4, 0xD0, 0x00,  // etroit
+    0x2D, 0x2A, 0x42, 0x80, 0x00,  // etude
+    0x2D, 0x60, 0x87, 0xC9, 0x25,  // euphorie
+    0x2D, 0x82, 0xCA, 0x96, 0x40,  // evaluer
+    0x2D, 0x83, 0x34, 0xBD, 0xC0,  // evasion
+    0x2D, 0x8A, 0xEA, 0x05, 0x2C,  // eventail
+    0x2D, 0x92, 0x42, 0xB8, 0x65,  // evidence
+    0x2D, 0x93, 0x42, 0xC8, 0x00,  // eviter
+    0x2D, 0x9E, 0xCA, 0xD1, 0x26,  // evolutif
+    0x2D, 0x9F, 0x1A, 0x96, 0x40,  // evoquer
+    0x2E, 0x02, 0x3A, 0x00, 0x00,  // exact
+    0x2E, 0x02, 0x72, 0xC8, 0xB2,  // exagerer
+    0x2E, 0x03, 0x51, 0x96, 0x40,  // exaucer
+    0x2E, 0x06, 0x56, 0x30, 0xB2,  // exceller
+    0x2E, 0x06, 0x9A, 0x05, 0xD4,  // excitant
+    0x2E, 0x06, 0xCA, 0xCD, 0x26,  // exclusif
+    0x2E, 0x07, 0x59, 0x94, 0x00,  // excuse
+    0x2E, 0x0A, 0x3A, 0xD0, 0xB2,  // executer
+    0x2E, 0x0A, 0xD8, 0x30, 0xA0,  // exemple
+    0x2E, 0x0B, 0x21, 0x96, 0x40,  // exercer
+    0x2E, 0x10, 0x16, 0x16, 0x40,  // exhaler
+    0x2E, 0x10, 0xF9, 0x50, 0xB2,  // exhorter
+    0x2E, 0x12, 0x72, 0xB8, 0x65,  // exigence
+    0x2E, 0x12, 0xC2, 0xC8, 0x00,  // exiler
+    0x2E, 0x13, 0x3A, 0x16, 0x40,  // exister
+    0x2E, 0x1F, 0x44, 0xC6, 0xA5,  // exotique
+    0x2E, 0x20, 0x52, 0x24, 0xB2,  // expedier
+    0x2E, 0x20, 0xC7, 0xC8, 0xB2,  // explorer
+    0x2E, 0x20, 0xF9, 0x96, 0x40,  // exposer
+    0x2E, 0x21, 0x24, 0xB4, 0xB2,  // exprimer
+    0x2E, 0x23, 0x54, 0xCC, 0x00,  // exquis
+    0x2E, 0x28, 0x57, 0x4D, 0x26,  // extensif
+    0x2E, 0x29, 0x20, 0xA6, 0x45,  // extraire
+    0x2E, 0x2A, 0xCA, 0x16, 0x40,  // exulter
+    0x30, 0x44, 0xC2, 0x80, 0x00,  // fable
+    0x30, 0x45, 0x56, 0x16, 0xB8,  // fabuleux
+    0x30, 0x46, 0x5A, 0x50, 0xA0,  // facette
+    0x30, 0x46, 0x96, 0x14, 0x00,  // facile
+    0x30, 0x47, 0x4A, 0xC8, 0xA0,  // facture
+    0x30, 0x52, 0x26, 0x26, 0x40,  // faiblir
+    0x30, 0x58, 0x14, 0xCC, 0xA0,  // falaise
+    0x30, 0x5A, 0x5A, 0xE0, 0x00,  // fameux
+    0x30, 0x5A, 0x96, 0x30, 0xA0,  // famille
+    0x30, 0x64, 0x32, 0xD6, 0x40,  // farceur
+    0x30, 0x64, 0x62, 0xB2, 0xA0,  // farfelu
+    0x30, 0x64, 0x97, 0x14, 0x00,  // farine
+    0x30, 0x64, 0xFA, 0x8D, 0x05,  // farouche
+    0x30, 0x66, 0x34, 0xB8, 0xB2,  // fasciner
+    0x30, 0x68, 0x16, 0x00, 0x00,  // fatal
+    0x30, 0x68, 0x93, 0xD4, 0xA0,  // fatigue
+    0x30, 0x6A, 0x37, 0xB8, 0x00,  // faucon
+    0x30, 0x6B, 0x44, 0x98, 0x00,  // fautif
+    0x30, 0x6C, 0x5A, 0xC8, 0x00,  // faveur
+    0x30, 0x6C, 0xF9, 0x24, 0x00,  // favori
+    0x31, 0x45, 0x24, 0xB0, 0xA0,  // febrile
+    0x31, 0x46, 0xF7, 0x10, 0xB2,  // feconder
+    0x31, 0x48, 0x59, 0x16, 0x40,  // federer
+    0x31, 0x58, 0x97, 0x00, 0x00,  // felin
+    0x31, 0x5A, 0xD2, 0x80, 0x00,  // femme
+    0x31, 0x5B, 0x59, 0x00, 0x00,  // femur
+    0x31, 0x5C, 0x47, 0xA6, 0x40,  // fendoir
+    0x31, 0x5E, 0x40, 0xB0, 0x00,  // feodal
+    0x31, 0x64, 0xD2, 0xC8, 0x00,  // fermer
+    0x31, 0x64, 0xF1, 0x94, 0x00,  // feroce
+    0x31, 0x65, 0x62, 0xD6, 0x40,  // ferveur
+    0x31, 0x67, 0x44, 0xD8, 0x2C,  // festival
+    0x31, 0x6A, 0x96, 0x30, 0xA0,  // feuille
+    0x31, 0x6B, 0x49, 0x14, 0x00,  // feutre
+    0x31, 0x6D, 0x24, 0x96, 0x40,  // fevrier
+    0x32, 0x43, 0x31, 0xBC, 0x00,  // fiasco
+    0x32, 0x46, 0x56, 0x16, 0x40,  // ficeler
+    0x32, 0x47, 0x44, 0x98, 0x00,  // fictif
+    0x32, 0x48, 0x56, 0x14, 0x00,  // fidele
+    0x32, 0x4F, 0x59, 0x14, 0x00,  // figure
+    0x32, 0x58, 0x1A, 0x56, 0x45,  // filature
+    0x32, 0x58, 0x5A, 0x04, 0xE5,  // filetage
+    0x32, 0x58, 0x92, 0xC8, 0xA0,  // filiere
+    0x32, 0x58, 0xC2, 0xD5, 0x80,  // filleul
+    0x32, 0x58, 0xD2, 0xC8, 0x00,  // filmer
+    0x32, 0x58, 0xFA, 0x80, 0x00,  // filou
+    0x32, 0x59, 0x49, 0x16, 0x40,  // filtrer
+    0x32, 0x5C, 0x17, 0x0C, 0xB2,  // financer
+    0x32, 0x5C, 0x99, 0x00, 0x00,  // finir
+    0x32, 0x5E, 0xC2, 0x80, 0x00,  // fiole
+    0x32, 0x64, 0xD2, 0x80, 0x00,  // firme
+    0x32, 0x67, 0x3A, 0xC8, 0xA0,  // fissure
+    0x32, 0x70, 0x59, 0x00, 0x00,  // fixer
+    0x33, 0x02, 0x99, 0x16, 0x40,  // flairer
+    0x33, 0x02, 0xD6, 0x94, 0x00,  // flamme
+    0x33, 0x03, 0x38, 0xD4, 0xA0,  // flasque
+    0x33, 0x03, 0x4A, 0x16, 0xB2,  // flatteur
+    0x33, 0x0A, 0x1A, 0x80, 0x00,  // fleau
+    0x33, 0x0A, 0x34, 0x14, 0x00,  // fleche
+    0x33, 0x0B, 0x59, 0x00, 0x00,  // fleur
+    0x33, 0x0B, 0x84, 0xBD, 0xC0,  // flexion
+    0x33, 0x1E, 0x37, 0xB8, 0x00,  // flocon
+    0x33, 0x1F, 0x22, 0x80, 0x00,  // flore
+    0x33, 0x2A, 0x3A, 0x54, 0xB2,  // fluctuer
+    0x33, 0x2A, 0x92, 0x14, 0x00,  // fluide
+    0x33, 0x2B, 0x64, 0x85, 0x80,  // fluvial
+    0x33, 0xD8, 0x92, 0x80, 0x00,  // folie
+    0x33, 0xDC, 0x42, 0xC9, 0x25,  // fonderie
+    0x33, 0xDC, 0x74, 0x89, 0x85,  // fongible
+    0x33, 0xDD, 0x40, 0xA5, 0xC5,  // fontaine
+    0x33, 0xE4, 0x32, 0xC8, 0x00,  // forcer
+    0x33, 0xE4, 0x72, 0xC9, 0xEE,  // forgeron
+    0x33, 0xE4, 0xDA, 0xB0, 0xB2,  // formuler
+    0x33, 0xE5, 0x4A, 0xB8, 0xA0,  // fortune
+    0x33, 0xE7, 0x34, 0xB0, 0xA0,  // fossile
+    0x33, 0xEA, 0x49, 0x14, 0x00,  // foudre
+    0x33, 0xEA, 0x72, 0xC8, 0xA0,  // fougere
+    0x33, 0xEA, 0x96, 0x30, 0xB2,  // fouiller
+    0x33, 0xEA, 0xCA, 0xC8, 0xA0,  // foulure
+    0x33, 0xEB, 0x26, 0xA4, 0x00,  // fourmi
+    0x34, 0x82, 0x74, 0xB0, 0xA0,  // fragile
+    0x34, 0x82, 0x99, 0x94, 0x00,  // fraise
+    0x34, 0x82, 0xE1, 0xA1, 0x32,  // franchir
+    0x34, 0x83, 0x08, 0x16, 0x40,  // frapper
+    0x34, 0x83, 0x92, 0xD6, 0x40,  // frayeur
+    0x34, 0x8A, 0x70, 0xD0, 0xA0,  // fregate
+    0x34, 0x8A, 0x97, 0x16, 0x40,  // freiner
+    0x34, 0x8A, 0xC7, 0xB8, 0x00,  // frelon
+    0x34, 0x8A, 0xD4, 0xC8, 0x00,  // fremir
+    0x34, 0x8A, 0xE2, 0xCD, 0x25,  // frenesie
+    0x34, 0x8B, 0x22, 0x80, 0x00,  // frere
+    0x34, 0x92, 0x11, 0x30, 0xA0,  // friable
+    0x34, 0x92, 0x3A, 0x25, 0xEE,  // friction
+    0x34, 0x93, 0x39, 0xBD, 0xC0,  // frisson
+    0x34, 0x93, 0x67, 0xB0, 0xA0,  // frivole
+    0x34, 0x9E, 0x92, 0x00, 0x00,  // froid
+    0x34, 0x9E, 0xD0, 0x9C, 0xA0,  // fromage
+    0x34, 0x9E, 0xEA, 0x05, 0x80,  // frontal
+    0x34, 0x9F, 0x4A, 0x16, 0x40,  // frotter
+    0x34, 0xAA, 0x9A, 0x00, 0x00,  // fruit
+    0x35, 0x4E, 0x9A, 0x24, 0xC0,  // fugitif
+    0x35, 0x53, 0x42, 0x80, 0x00,  // fuite
+    0x35, 0x64, 0x5A, 0xC8, 0x00,  // fureur
+    0x35, 0x64, 0x92, 0xD7, 0x00,  // furieux
+    0x35, 0x65, 0x44, 0x98, 0x00,  // furtif
+    0x35, 0x66, 0x97, 0xB8, 0x00,  // fusion
+    0x35, 0x69, 0x59, 0x00, 0x00,  // futur
+    0x38, 0x4E, 0xE2, 0xC8, 0x00,  // gagner
+    0x38, 0x58, 0x1C, 0x24, 0xA0,  // galaxie
+    0x38, 0x58, 0x59, 0x24, 0xA0,  // galerie
+    0x38, 0x5A, 0x20, 0x90, 0xB2,  // gambader
+    0x38, 0x64, 0x17, 0x51, 0x32,  // garantir
+    0x38, 0x64, 0x44, 0x95, 0xC0,  // gardien
+    0x38, 0x64, 0xE4, 0xC8, 0x00,  // garnir
+    0x38, 0x65, 0x24, 0x9E, 0xA5,  // garrigue
+    0x38, 0x74, 0x56, 0x30, 0xA0,  // gazelle
+    0x38, 0x74, 0xF7, 0x00, 0x00,  // gazon
+    0x39, 0x42, 0xEA, 0x00, 0x00,  // geant
+    0x39, 0x58, 0x1A, 0x25, 0xC5,  // gelatine
+    0x39, 0x59, 0x56, 0x14, 0x00,  // gelule
+    0x39, 0x5C, 0x40, 0xC9, 0xA5,  // gendarme
+    0x39, 0x5C, 0x59, 0x05, 0x80,  // general
+    0x39, 0x5C, 0x92, 0x80, 0x00,  // genie
+    0x39, 0x5C, 0xFA, 0x80, 0x00,  // genou
+    0x39, 0x5D, 0x44, 0xB0, 0x00,  // gentil
+    0x39, 0x5E, 0xC7, 0x9D, 0x25,  // geologie
+    0x39, 0x5E, 0xD2, 0xD2, 0x45,  // geometre
+    0x39, 0x64, 0x17, 0x26, 0xAD,  // geranium
+    0x39, 0x64, 0xD2, 0x80, 0x00,  // germe
+    0x39, 0x67, 0x4A, 0x95, 0x80,  // gestuel
+    0x39, 0x73, 0x32, 0xC8, 0x00,  // geyser
+    0x3A, 0x44, 0x92, 0xC8, 0x00,  // gibier
+    0x3A, 0x46, 0xC2, 0xC8, 0x00,  // gicler
+    0x3A, 0x64, 0x13, 0x14, 0x00,  // girafe
+    0x3A, 0x6D, 0x22, 0x80, 0x00,  // givre
+    0x3B, 0x02, 0x32, 0x80, 0x00,  // glace
+    0x3B, 0x02, 0x9B, 0x14, 0x00,  // glaive
+    0x3B, 0x13, 0x39, 0x96, 0x40,  // glisser
+    0x3B, 0x1E, 0x22, 0x80, 0x00,  // globe
+    0x3B, 0x1E, 0x99, 0x14, 0x00,  // gloire
+    0x3B, 0x1F, 0x24, 0x96, 0xB8,  // glorieux
+    0x3B, 0xD8, 0x62, 0xD6, 0x40,  // golfeur
+    0x3B, 0xDA, 0xD2, 0x80, 0x00,  // gomme
+    0x3B, 0xDC, 0x66, 0x16, 0x40,  // gonfler
+    0x3B, 0xE4, 0x72, 0x80, 0x00,  // gorge
+    0x3B, 0xE4, 0x96, 0x30, 0xA0,  // gorille
+    0x3B, 0xEA, 0x49, 0x3D, 0xC0,  // goudron
+    0x3B, 0xEA, 0x63, 0x48, 0xA0,  // gouffre
+    0x3B, 0xEA, 0xC7, 0xD0, 0x00,  // goulot
+    0x3B, 0xEB, 0x04, 0xB1, 0x85,  // goupille
+    0x3B, 0xEB, 0x26, 0x85, 0xC4,  // gourmand
+    0x3B, 0xEB, 0x4A, 0x14, 0x00,  // goutte
+    0x3C, 0x82, 0x4A, 0x95, 0x80,  // graduel
+    0x3C, 0x82, 0x63, 0x26, 0x89,  // graffiti
+    0x3C, 0x82, 0x97, 0x14, 0x00,  // graine
+    0x3C, 0x82, 0xE2, 0x00, 0x00,  // grand
+    0x3C, 0x83, 0x08, 0x25, 0xC0,  // grappin
+    0x3C, 0x83, 0x4A, 0xA6, 0x80,  // gratuit
+    0x3C, 0x83, 0x64, 0xC8, 0x00,  // gravir
+    0x3C, 0x8A, 0xE0, 0xD0, 0x00,  // grenat
+    0x3C, 0x92, 0x63, 0x56, 0x45,  // griffure
+    0x3C, 0x92, 0xC6, 0x16, 0x40,  // griller
+    0x3C, 0x92, 0xD8, 0x16, 0x40,  // grimper
+    0x3C, 0x9E, 0x77, 0x16, 0x40,  // grogner
+    0x3C, 0x9E, 0xE2, 0x16, 0x40,  // gronder
+    0x3C, 0x9F, 0x4A, 0x14, 0x00,  // grotte
+    0x3C, 0x9F, 0x58, 0x14, 0x00,  // groupe
+    0x3C, 0xAA, 0x72, 0xC8, 0x00,  // gruger
+    0x3C, 0xAB, 0x44, 0x96, 0x40,  // grutier
+    0x3C, 0xAB, 0x92, 0xC8, 0xA0,  // gruyere
+    0x3D, 0x4B, 0x00, 0xC8, 0x80,  // guepard
+    0x3D, 0x4B, 0x29, 0x24, 0xB2,  // guerrier
+    0x3D, 0x52, 0x42, 0x80, 0x00,  // guide
+    0x3D, 0x52, 0xD0, 0xD6, 0xC5,  // guimauve
+    0x3D, 0x53, 0x40, 0xC8, 0xA0,  // guitare
+    0x3D, 0x67, 0x40, 0xD1, 0x26,  // gustatif
+    0x3E, 0x5A, 0xE0, 0xCE, 0x85,  // gymnaste
+    0x3E, 0x64, 0xF9, 0xD0, 0x34,  // gyrostat
+    0x40, 0x44, 0x9A, 0x54, 0x85,  // habitude
+    0x40, 0x46, 0x87, 0xA6, 0x40,  // hachoir
+    0x40, 0x59, 0x42, 0x80, 0x00,  // halte
+    0x40, 0x5A, 0x50, 0xD4, 0x00,  // hameau
+    0x40, 0x5C, 0x70, 0xC8, 0x00,  // hangar
+    0x40, 0x5C, 0xE2, 0xD1, 0xEE,  // hanneton
+    0x40, 0x64, 0x91, 0xBE, 0x80,  // haricot
+    0x40, 0x64, 0xD7, 0xB9, 0x25,  // harmonie
+    0x40, 0x65, 0x07, 0xB8, 0x00,  // harpon
+    0x40, 0x66, 0x19, 0x10, 0x00,  // hasard
+    0x41, 0x58, 0x9A, 0xB4, 0x00,  // helium
+    0x41, 0x5A, 0x1A, 0x3D, 0xA5,  // hematome
+    0x41, 0x64, 0x22, 0x80, 0x00,  // herbe
+    0x41, 0x64, 0x99, 0xCD, 0xEE,  // herisson
+    0x41, 0x64, 0xD4, 0xB8, 0xA0,  // hermine
+    0x41, 0x64, 0xF7, 0x00, 0x00,  // heron
+    0x41, 0x66, 0x9A, 0x16, 0x40,  // hesiter
+    0x41, 0x6B, 0x22, 0xD7, 0x00,  // heureux
+    0x42, 0x44, 0x59, 0x38, 0xB2,  // hiberner
+    0x42, 0x44, 0xFA, 0x80, 0x00,  // hibou
+    0x42, 0x58, 0x19, 0x05, 0xD4,  // hilarant
+    0x42, 0x67, 0x47, 0xA6, 0x45,  // histoire
+    0x42, 0x6C, 0x59, 0x00, 0x00,  // hiver
+    0x43, 0xDA, 0x19, 0x10, 0x00,  // homard
+    0x43, 0xDA, 0xD0, 0x9C, 0xA0,  // hommage
+    0x43, 0xDA, 0xF3, 0x95, 0xC5,  // homogene
+    0x43, 0xDC, 0xE2, 0xD6, 0x40,  // honneur
+    0x43, 0xDC, 0xF9, 0x16, 0x40,  // honorer
+    0x43, 0xDD, 0x42, 0xD7, 0x00,  // honteux
+    0x43, 0xE4, 0x42, 0x80, 0x00,  // horde
+    0x43, 0xE4, 0x9D, 0x3D, 0xC0,  // horizon
+    0x43, 0xE4, 0xC7, 0x9C, 0xA0,  // horloge
+    0x43, 0xE4, 0xD7, 0xB8, 0xA0,  // hormone
+    0x43, 0xE5, 0x24, 0x89, 0x85,  // horrible
+    0x43, 0xEA, 0xC2, 0xD7, 0x00,  // houleux
+    0x43, 0xEB, 0x39, 0x94, 0x00,  // housse
+    0x45, 0x44, 0xC7, 0xD0, 0x00,  // hublot
+    0x45, 0x52, 0xC2, 0xD7, 0x00,  // huileux
+    0x45, 0x5A, 0x14, 0xB8, 0x00,  // humain
+    0x45, 0x5A, 0x26, 0x14, 0x00,  // humble
+    0x45, 0x5A, 0x92, 0x14, 0x00,  // humide
+    0x45, 0x5A, 0xFA, 0xC8, 0x00,  // humour
+    0x45, 0x64, 0xC2, 0xC8, 0x00,  // hurler
+    0x46, 0x49, 0x27, 0xB4, 0xAC,  // hydromel
+    0x46, 0x4E, 0x92, 0xB8, 0xA0,  // hygiene
+    0x46, 0x5A, 0xE2, 0x80, 0x00,  // hymne
+    0x46, 0x60, 0xE7, 0xCC, 0xA0,  // hypnose
+    0x49, 0x32, 0xC6, 0x14, 0x00,  // idylle
+    0x49, 0xDC, 0xF9, 0x16, 0x40,  // ignorer
+    0x49, 0xEA, 0x17, 0x14, 0x00,  // iguane
+    0x4B, 0x18, 0x91, 0xA6, 0x85,  // illicite
+    0x4B, 0x19, 0x59, 0xA5, 0xEE,  // illusion
+    0x4B, 0x42, 0x72, 0x80, 0x00,  // image
+    0x4B, 0x44, 0x91, 0x16, 0x40,  // imbiber
+    0x4B, 0x53, 0x42, 0xC8, 0x00,  // imiter
+    0x4B, 0x5A, 0x57, 0x4C, 0xA0,  // immense
+    0x4B, 0x5A, 0xF1, 0x25, 0x85,  // immobile
+    0x4B, 0x5B, 0x50, 0x89, 0x85,  // immuable
+    0x4B, 0x60, 0x11, 0xD0, 0x00,  // impact
+    0x4B, 0x60, 0x59, 0x24, 0x2C,  // imperial
+    0x4B, 0x60, 0xC7, 0xC8, 0xB2,  // implorer
+    0x4B, 0x60, 0xF9, 0x96, 0x40,  // imposer
+    0x4B, 0x61, 0x24, 0xB4, 0xB2,  // imprimer
+    0x4B, 0x61, 0x5A, 0x16, 0x40,  // imputer
+    0x4B, 0x86, 0x19, 0x38, 0xB2,  // incarner
+    0x4B, 0x86, 0x57, 0x11, 0x25,  // incendie
+    0x4B, 0x86, 0x92, 0x15, 0xD4,  // incident
+    0x4B, 0x86, 0xC4, 0xB8, 0xB2,  // incliner
+    0x4B, 0x86, 0xF6, 0x3E, 0x45,  // incolore
+    0x4B, 0x88, 0x5C, 0x16, 0x40,  // indexer
+    0x4B, 0x88, 0x91, 0x94, 0x00,  // indice
+    0x4B, 0x89, 0x51, 0xD1, 0x26,  // inductif
+    0x4B, 0x8A, 0x44, 0xD0, 0x00,  // inedit
+    0x4B, 0x8B, 0x0A, 0x24, 0xA0,  // ineptie
+    0x4B, 0x8B, 0x80, 0x8E, 0x80,  // inexact
+    0x4B, 0x8C, 0x97, 0x24, 0x00,  // infini
+    0x4B, 0x8C, 0xC4, 0x9C, 0xB2,  // infliger
+    0x4B, 0x8C, 0xF9, 0x34, 0xB2,  // informer
+    0x4B, 0x8D, 0x59, 0xA5, 0xEE,  // infusion
+    0x4B, 0x8E, 0x59, 0x16, 0x40,  // ingerer
+    0x4B, 0x90, 0x16, 0x16, 0x40,  // inhaler
+    0x4B, 0x90, 0x91, 0x16, 0x40,  // inhiber
+    0x4B, 0x94, 0x51, 0xD0, 0xB2,  // injecter
+    0x4B, 0x95, 0x59, 0x14, 0x00,  // injure
+    0x4B, 0x9C, 0xF1, 0x95, 0xD4,  // innocent
+    0x4B, 0x9E, 0x3A, 0xB0, 0xB2,  // inoculer
+    0x4B, 0x9E, 0xE2, 0x16, 0x40,  // inonder
+    0x4B, 0xA6, 0x39, 0x26, 0x45,  // inscrire
+    0x4B, 0xA6, 0x51, 0xD0, 0xA0,  // insecte
+    0x4B, 0xA6, 0x93, 0xB8, 0xA0,  // insigne
+    0x4B, 0xA6, 0xF6, 0x26, 0x85,  // insolite
+    0x4B, 0xA7, 0x04, 0xC8, 0xB2,  // inspirer
+    0x4B, 0xA7, 0x44, 0xB8, 0x74,  // instinct
+    0x4B, 0xA7, 0x56, 0x50, 0xB2,  // insulter
+    0x4B, 0xA8, 0x11, 0xD0, 0x00,  // intact
+    0x4B, 0xA8, 0x57, 0x4C, 0xA0,  // intense
+    0x4B, 0xA8, 0x96, 0x94, 0x00,  // intime
+    0x4B, 0xA9, 0x24, 0x9E, 0xA5,  // intrigue
+    0x4B, 0xA9, 0x54, 0xD1, 0x26,  // intuitif
+    0x4B, 0xAB, 0x44, 0xB0, 0xA0,  // inutile
+    0x4B, 0xAC, 0x19, 0xA5, 0xEE,  // invasion
+    0x4B, 0xAC, 0x57, 0x50, 0xB2,  // inventer
+    0x4B, 0xAC, 0x9A, 0x16, 0x40,  // inviter
+    0x4B, 0xAC, 0xF8, 0xD4, 0xB2,  // invoquer
+    0x4C, 0x9E, 0xE4, 0xC6, 0xA5,  // ironique
+    0x4C, 0xA4, 0x12, 0x24, 0xB2,  // irradier
+    0x4C, 0xA4, 0x52, 0xB0, 0x00,  // irreel
+    0x4C, 0xA4, 0x9A, 0x16, 0x40,  // irriter
+    0x4C, 0xDE, 0xC2, 0xC8, 0x00,  // isoler
+    0x4D, 0x9E, 0x99, 0x14, 0x00,  // ivoire
+    0x4D, 0xA4, 0x59, 0xCC, 0xA0,  // ivresse
+    0x50, 0x4F, 0x50, 0xC8, 0x00,  // jaguar
+    0x50, 0x52, 0xC6, 0x26, 0x40,  // jaillir
+    0x50, 0x5A, 0x22, 0x80, 0x00,  // jambe
+    0x50, 0x5D, 0x64, 0x96, 0x40,  // janvier
+    0x50, 0x64, 0x44, 0xB8, 0x00,  // jardin
+    0x50, 0x6A, 0x72, 0xC8, 0x00,  // jauger
+    0x50, 0x6A, 0xE2, 0x80, 0x00,  // jaune
+    0x50, 0x6C, 0x56, 0x3E, 0x80,  // javelot
+    0x51, 0x68, 0x11, 0x30, 0xA0,  // jetable
+    0x51, 0x68, 0xF7, 0x00, 0x00,  // jeton
+    0x51, 0x6A, 0x44, 0x80, 0x00,  // jeudi
+    0x51, 0x6A, 0xE2, 0xCE, 0x65,  // jeunesse
+    0x53, 0xD2, 0xE2, 0x48, 0xA0,  // joindre
+    0x53, 0xDC, 0x34, 0x16, 0x40,  // joncher
+    0x53, 0xDC, 0x76, 0x16, 0x40,  // jongler
+    0x53, 0xEA, 0x5A, 0xC8, 0x00,  // joueur
+    0x53, 0xEA, 0x99, 0xCD, 0x26,  // jouissif
+    0x53, 0xEB, 0x27, 0x05, 0x80,  // journal
+    0x53, 0xEC, 0x90, 0xB0, 0x00,  // jovial
+    0x53, 0xF2, 0x1A, 0x80, 0x00,  // joyau
+    0x53, 0xF2, 0x5A, 0xE0, 0x00,  // joyeux
+    0x55, 0x44, 0x96, 0x16, 0x40,  // jubiler
+    0x55, 0x4E, 0x56, 0x95, 0xD4,  // jugement
+    0x55, 0x5C, 0x97, 0xC8, 0x00,  // junior
+    0x55, 0x60, 0xF7, 0x00, 0x00,  // jupon
+    0x55, 0x64, 0x99, 0xD0, 0xA0,  // juriste
+    0x55, 0x67, 0x44, 0x8C, 0xA0,  // justice
+    0x55, 0x68, 0x5A, 0xE0, 0x00,  // juteux
+    0x55, 0x6C, 0x57, 0x25, 0x85,  // juvenile
+    0x58, 0x72, 0x15, 0x80, 0x00,  // kayak
+    0x5A, 0x5A, 0xF7, 0x3C, 0x00,  // kimono
+    0x5A, 0x5F, 0x38, 0xD4, 0xA0,  // kiosque
+    0x60, 0x44, 0x56, 0x00, 0x00,  // label
+    0x60, 0x44, 0x90, 0xB0, 0x00,  // labial
+    0x60, 0x44, 0xFA, 0xC8, 0xB2,  // labourer
+    0x60, 0x46, 0x59, 0x16, 0x40,  // lacerer
+    0x60, 0x47, 0x47, 0xCC, 0xA0,  // lactose
+    0x60, 0x4F, 0x57, 0x14, 0x00,  // lagune
+    0x60, 0x52, 0xE2, 0x80, 0x00,  // laine
+    0x60, 0x53, 0x39, 0x96, 0x40,  // laisser
+    0x60, 0x53, 0x44, 0x96, 0x40,  // laitier
+    0x60, 0x5A, 0x22, 0x86, 0xA0,  // lambeau
+    0x60, 0x5A, 0x56, 0x30, 0xA0,  // lamelle
+    0x60, 0x5B, 0x02, 0x80, 0x00,  // lampe
+    0x60, 0x5C, 0x32, 0xD6, 0x40,  // lanceur
+    0x60, 0x5C, 0x70, 0x9C, 0xA0,  // langage
+    0x60, 0x5D, 0x42, 0xC9, 0xC5,  // lanterne
+    0x60, 0x60, 0x97, 0x00, 0x00,  // lapin
+    0x60, 0x64, 0x72, 0xD6, 0x40,  // largeur
+    0x60, 0x64, 0xD2, 0x80, 0x00,  // larme
+    0x60, 0x6B, 0x24, 0x96, 0x40,  // laurier
+    0x60, 0x6C, 0x11, 0x3C, 0x00,  // lavabo
+    0x60, 0x6C, 0xF4, 0xC8, 0x00,  // lavoir
+    0x61, 0x47, 0x4A, 0xC8, 0xA0,  // lecture
+    0x61, 0x4E, 0x16, 0x00, 0x00,  // legal
+    0x61, 0x4E, 0x59, 0x00, 0x00,  // leger
+    0x61, 0x4F, 0x56, 0x94, 0x00,  // legume
+    0x61, 0x67, 0x34, 0xD8, 0xA0,  // lessive
+    0x61, 0x69, 0x49, 0x14, 0x00,  // lettre
+    0x61, 0x6C, 0x92, 0xC8, 0x00,  // levier
+    0x61, 0x70, 0x98, 0xD4, 0xA0,  // lexique
+    0x61, 0x74, 0x19, 0x10, 0x00,  // lezard
+    0x62, 0x43, 0x39, 0x94, 0x00,  // liasse
+    0x62, 0x44, 0x59, 0x16, 0x40,  // liberer
+    0x62, 0x45, 0x22, 0x80, 0x00,  // libre
+    0x62, 0x46, 0x57, 0x0C, 0xA0,  // licence
+    0x62, 0x46, 0xF9, 0x38, 0xA0,  // licorne
+    0x62, 0x4A, 0x72, 0x80, 0x00,  // liege
+    0x62, 0x4B, 0x69, 0x14, 0x00,  // lievre
+    0x62, 0x4E, 0x1A, 0x56, 0x45,  // ligature
+    0x62, 0x4E, 0xFA, 0x16, 0x40,  // ligoter
+    0x62, 0x4F, 0x52, 0x80, 0x00,  // ligue
+    0x62, 0x5A, 0x59, 0x00, 0x00,  // limer
+    0x62, 0x5A, 0x9A, 0x14, 0x00,  // limite
+    0x62, 0x5A, 0xF7, 0x04, 0x85,  // limonade
+    0x62, 0x5B, 0x04, 0x90, 0xA0,  // limpide
+    0x62, 0x5C, 0x50, 0xA6, 0x45,  // lineaire
+    0x62, 0x5C, 0x77, 0xD0, 0x00,  // lingot
+    0x62, 0x5E, 0xE1, 0x94, 0x35,  // lionceau
+    0x62, 0x63, 0x54, 0x90, 0xA0,  // liquide
+    0x62, 0x66, 0x92, 0xC8, 0xA0,  // lisiere
+    0x62, 0x67, 0x42, 0xC8, 0x00,  // lister
+    0x62, 0x68, 0x84, 0xD5, 0xA0,  // lithium
+    0x62, 0x68, 0x93, 0x94, 0x00,  // litige
+    0x62, 0x69, 0x47, 0xC8, 0x2C,  // littoral
+    0x62, 0x6D, 0x22, 0xD6, 0x40,  // livreur
+    0x63, 0xCE, 0x98, 0xD4, 0xA0,  // logique
+    0x63, 0xD2, 0xEA, 0x05, 0x2E,  // lointain
+    0x63, 0xD3, 0x34, 0xC8, 0x00,  // loisir
+    0x63, 0xDA, 0x29, 0x24, 0x60,  // lombric
+    0x63, 0xE8, 0x59, 0x24, 0xA0,  // loterie
+    0x63, 0xEA, 0x59, 0x00, 0x00,  // louer
+    0x63, 0xEB, 0x22, 0x00, 0x00,  // lourd
+    0x63, 0xEB, 0x49, 0x14, 0x00,  // loutre
+    0x63, 0xEB, 0x62, 0x80, 0x00,  // louve
+    0x63, 0xF2, 0x16, 0x00, 0x00,  // loyal
+    0x65, 0x44, 0x92, 0x80, 0x00,  // lubie
+    0x65, 0x46, 0x92, 0x14, 0x00,  // lucide
+    0x65, 0x47, 0x20, 0xD1, 0x26,  // lucratif
+    0x65, 0x4B, 0x59, 0x00, 0x00,  // lueur
+    0x65, 0x4F, 0x51, 0x48, 0xA0,  // lugubre
+    0x65, 0x53, 0x30, 0xBA, 0x80,  // luisant
+    0x65, 0x5A, 0x92, 0xC8, 0xA0,  // lumiere
+    0x65, 0x5C, 0x14, 0xC8, 0xA0,  // lunaire
+    0x65, 0x5C, 0x44, 0x80, 0x00,  // lundi
+    0x65, 0x64, 0xF7, 0x00, 0x00,  // luron
+    0x65, 0x69, 0x42, 0xC8, 0x00,  // lutter
+    0x65, 0x71, 0x52, 0xD7, 0x00,  // luxueux
+    0x68, 0x46, 0x84, 0xB8, 0xA0,  // machine
+    0x68, 0x4E, 0x19, 0xA5, 0xC0,  // magasin
+    0x68, 0x4E, 0x57, 0x50, 0x20,  // magenta
+    0x68, 0x4E, 0x98, 0xD4, 0xA0,  // magique
+    0x68, 0x52, 0x79, 0x14, 0x00,  // maigre
+    0x68, 0x52, 0xC6, 0x3D, 0xC0,  // maillon
+    0x68, 0x52, 0xEA, 0x24, 0xAE,  // maintien
+    0x68, 0x53, 0x24, 0x94, 0x00,  // mairie
+    0x68, 0x53, 0x37, 0xB8, 0x00,  // maison
+    0x68, 0x54, 0xF9, 0x16, 0x40,  // majorer
+    0x68, 0x58, 0x1C, 0x16, 0x40,  // malaxer
+    0x68, 0x58, 0x53, 0x24, 0x65,  // malefice
+    0x68, 0x58, 0x82, 0xD6, 0x40,  // malheur
+    0x68, 0x58, 0x91, 0x94, 0x00,  // malice
+    0x68, 0x58, 0xC2, 0xD2, 0x85,  // mallette
+    0x68, 0x5A, 0xD7, 0xD6, 0x88,  // mammouth
+    0x68, 0x5C, 0x40, 0xD0, 0xB2,  // mandater
+    0x68, 0x5C, 0x90, 0x89, 0x85,  // maniable
+    0x68, 0x5D, 0x1A, 0x85, 0xD4,  // manquant
+    0x68, 0x5D, 0x42, 0x86, 0xA0,  // manteau
+    0x68, 0x5D, 0x52, 0xB0, 0x00,  // manuel
+    0x68, 0x64, 0x1A, 0x21, 0xEE,  // marathon
+    0x68, 0x64, 0x29, 0x14, 0x00,  // marbre
+    0x68, 0x64, 0x34, 0x05, 0xC4,  // marchand
+    0x68, 0x64, 0x44, 0x80, 0x00,  // mardi
+    0x68, 0x64, 0x9A, 0x25, 0xA5,  // maritime
+    0x68, 0x65, 0x1A, 0x96, 0xB2,  // marqueur
+    0x68, 0x65, 0x27, 0xB8, 0x00,  // marron
+    0x68, 0x65, 0x42, 0xB0, 0xB2,  // marteler
+    0x68, 0x66, 0x37, 0xD2, 0x85,  // mascotte
+    0x68, 0x67, 0x34, 0x98, 0x00,  // massif
+    0x68, 0x68, 0x59, 0x24, 0xAC,  // materiel
+    0x68, 0x68, 0x92, 0xC8, 0xA0,  // matiere
+    0x68, 0x69, 0x20, 0xC6, 0xA5,  // matraque
+    0x68, 0x6A, 0x44, 0xC8, 0xA0,  // maudire
+    0x68, 0x6B, 0x39, 0x84, 0x85,  // maussade
+    0x68, 0x6B, 0x62, 0x80, 0x00,  // mauve
+    0x68, 0x70, 0x96, 0x85, 0x80,  // maximal
+    0x69, 0x46, 0x80, 0xBA, 0x80,  // mechant
+    0x69, 0x46, 0xF7, 0x3A, 0xA0,  // meconnu
+    0x69, 0x48, 0x14, 0xB1, 0x85,  // medaille
+    0x69, 0x48, 0x51, 0xA5, 0xC0,  // medecin
+    0x69, 0x48, 0x9A, 0x16, 0x40,  // mediter
+    0x69, 0x49, 0x59, 0x94, 0x00,  // meduse
+    0x69, 0x52, 0xC6, 0x16, 0xB2,  // meilleur
+    0x69, 0x58, 0x17, 0x1C, 0xA0,  // melange
+    0x69, 0x58, 0xF2, 0x24, 0xA0,  // melodie
+    0x69, 0x5A, 0x29, 0x14, 0x00,  // membre
+    0x69, 0x5A, 0xF4, 0xC8, 0xA0,  // memoire
+    0x69, 0x5C, 0x11, 0x96, 0x40,  // menacer
+    0x69, 0x5C, 0x59, 0x00, 0x00,  // mener
+    0x69, 0x5C, 0x84, 0xC8, 0x00,  // menhir
+    0x69, 0x5D, 0x37, 0xB8, 0xE5,  // mensonge
+    0x69, 0x5D, 0x47, 0xC8, 0x00,  // mentor
+    0x69, 0x64, 0x39, 0x14, 0x89,  // mercredi
+    0x69, 0x64, 0x9A, 0x14, 0x00,  // merite
+    0x69, 0x64, 0xC2, 0x80, 0x00,  // merle
+    0x69, 0x67, 0x30, 0x9C, 0xB2,  // messager
+    0x69, 0x67, 0x59, 0x14, 0x00,  // mesure
+    0x69, 0x68, 0x16, 0x00, 0x00,  // metal
+    0x69, 0x68, 0x57, 0xC8, 0xA0,  // meteore
+    0x69, 0x68, 0x87, 0x90, 0xA0,  // methode
+    0x69, 0x68, 0x92, 0xC8, 0x00,  // metier
+    0x69, 0x6A, 0x26, 0x14, 0x00,  // meuble
+    0x6A, 0x43, 0x56, 0x16, 0x40,  // miauler
+    0x6A, 0x47, 0x27, 0x88, 0xA0,  // microbe
+    0x6A, 0x4B, 0x4A, 0x14, 0x00,  // miette
+    0x6A, 0x4E, 0xE7, 0xB8, 0x00,  // mignon
+    0x6A, 0x4F, 0x22, 0xC8, 0x00,  // migrer
+    0x6A, 0x58, 0x92, 0xD4, 0x00,  // milieu
+    0x6A, 0x58, 0xC4, 0xBD, 0xC0,  // million
+    0x6A, 0x5A, 0x98, 0xD4, 0xA0,  // mimique
+    0x6A, 0x5C, 0x32, 0x80, 0x00,  // mince
+    0x6A, 0x5C, 0x59, 0x05, 0x80,  // mineral
+    0x6A, 0x5C, 0x96, 0x85, 0x80,  // minimal
+    0x6A, 0x5C, 0xF9, 0x16, 0x40,  // minorer
+    0x6A, 0x5D, 0x5A, 0x14, 0x00,  // minute
+    0x6A, 0x64, 0x11, 0xB0, 0xA0,  // miracle
+    0x6A, 0x64, 0xF4, 0xD0, 0xB2,  // miroiter
+    0x6A, 0x67, 0x34, 0xB0, 0xA0,  // missile
+    0x6A, 0x71, 0x42, 0x80, 0x00,  // mixte
+    0x6B, 0xC4, 0x96, 0x14, 0x00,  // mobile
+    0x6B, 0xC8, 0x59, 0x38, 0xA0,  // moderne
+    0x6B, 0xCA, 0xC6, 0x16, 0xB8,  // moelleux
+    0x6B, 0xDC, 0x44, 0x85, 0x80,  // mondial
+    0x6B, 0xDC, 0x9A, 0x16, 0xB2,  // moniteur
+    0x6B, 0xDC, 0xE0, 0xA4, 0xA0,  // monnaie
+    0x6B, 0xDC, 0xFA, 0x3D, 0xC5,  // monotone
+    0x6B, 0xDD, 0x3A, 0x48, 0xA0,  // monstre
+    0x6B, 0xDD, 0x40, 0x9D, 0xC5,  // montagne
+    0x6B, 0xDD, 0x56, 0x95, 0xD4,  // monument
+    0x6B, 0xE3, 0x52, 0xD6, 0x40,  // moqueur
+    0x6B, 0xE4, 0x32, 0x86, 0xA0,  // morceau
+    0x6B, 0xE5, 0x3A, 0xC8, 0xA0,  // morsure
+    0x6B, 0xE5, 0x44, 0x96, 0x40,  // mortier
+    0x6B, 0xE8, 0x5A, 0xC8, 0x00,  // moteur
+    0x6B, 0xE8, 0x93, 0x00, 0x00,  // motif
+    0x6B, 0xEA, 0x34, 0x14, 0x00,  // mouche
+    0x6B, 0xEA, 0x66, 0x14, 0x00,  // moufle
+    0x6B, 0xEA, 0xC4, 0xB8, 0x00,  // moulin
+    0x6B, 0xEB, 0x39, 0xBD, 0xC0,  // mousson
+    0x6B, 0xEB, 0x47, 0xB8, 0x00,  // mouton
+    0x6B, 0xEB, 0x60, 0xBA, 0x80,  // mouvant
+    0x6D, 0x59, 0x44, 0xC1, 0x85,  // multiple
+    0x6D, 0x5C, 0x9A, 0x25, 0xEE,  // munition
+    0x6D, 0x64, 0x14, 0xB1, 0x85,  // muraille
+    0x6D, 0x64, 0x57, 0x14, 0x00,  // murene
+    0x6D, 0x64, 0xDA, 0xC8, 0xA0,  // murmure
+    0x6D, 0x66, 0x36, 0x14, 0x00,  // muscle
+    0x6D, 0x66, 0x5A, 0xB4, 0x00,  // museum
+    0x6D, 0x66, 0x91, 0xA4, 0xAE,  // musicien
+    0x6D, 0x68, 0x1A, 0x25, 0xEE,  // mutation
+    0x6D, 0x68, 0x59, 0x00, 0x00,  // muter
+    0x6D, 0x69, 0x52, 0xB0, 0x00,  // mutuel
+    0x6E, 0x64, 0x90, 0x90, 0xA0,  // myriade
+    0x6E, 0x65, 0x44, 0xB1, 0x85,  // myrtille
+    0x6E, 0x67, 0x42, 0xC8, 0xA0,  // mystere
+    0x6E, 0x68, 0x84, 0xC6, 0xA5,  // mythique
+    0x70, 0x4E, 0x5A, 0xC8, 0x00,  // nageur
+    0x70, 0x61, 0x02, 0x80, 0x00,  // nappe
+    0x70, 0x65, 0x1A, 0xBD, 0x33,  // narquois
+    0x70, 0x65, 0x22, 0xC8, 0x00,  // narrer
+    0x70, 0x68, 0x1A, 0x25, 0xEE,  // natation
+    0x70, 0x68, 0x97, 0xB8, 0x00,  // nation
+    0x70, 0x69, 0x59, 0x14, 0x00,  // nature
+    0x70, 0x6A, 0x69, 0x04, 0xE5,  // naufrage
+    0x70, 0x6B, 0x44, 0xC6, 0xA5,  // nautique
+    0x70, 0x6C, 0x99, 0x14, 0x00,  // navire
+    0x71, 0x45, 0x56, 0x16, 0xB8,  // nebuleux
+    0x71, 0x47, 0x40, 0xC8, 0x00,  // nectar
+    0x71, 0x4C, 0x19, 0xD0, 0xA0,  // nefaste
+    0x71, 0x4E, 0x1A, 0x25, 0xEE,  // negation
+    0x71, 0x4E, 0xC4, 0x9C, 0xB2,  // negliger
+    0x71, 0x4E, 0xF1, 0xA4, 0xB2,  // negocier
+    0x71, 0x52, 0x72, 0x80, 0x00,  // neige
+    0x71, 0x65, 0x62, 0xD7, 0x00,  // nerveux
+    0x71, 0x69, 0x47, 0xE4, 0xB2,  // nettoyer
+    0x71, 0x6B, 0x27, 0xB8, 0xA0,  // neurone
+    0x71, 0x6B, 0x49, 0x3D, 0xC0,  // neutron
+    0x71, 0x6C, 0x5A, 0x80, 0x00,  // neveu
+    0x72, 0x46, 0x82, 0x80, 0x00,  // niche
+    0x72, 0x46, 0xB2, 0xB0, 0x00,  // nickel
+    0x72, 0x69, 0x20, 0xD0, 0xA0,  // nitrate
+    0x72, 0x6C, 0x50, 0xD4, 0x00,  // niveau
+    0x73, 0xC4, 0xC2, 0x80, 0x00,  // noble
+    0x73, 0xC6, 0x93, 0x00, 0x00,  // nocif
+    0x73, 0xC7, 0x4A, 0xC9, 0xC5,  // nocturne
+    0x73, 0xD3, 0x21, 0x96, 0xB2,  // noirceur
+    0x73, 0xD3, 0x32, 0xD2, 0x85,  // noisette
+    0x73, 0xDA, 0x12, 0x14, 0x00,  // nomade
+    0x73, 0xDA, 0x29, 0x16, 0xB8,  // nombreux
+    0x73, 0xDA, 0xD2, 0xC8, 0x00,  // nommer
+    0x73, 0xE4, 0xD0, 0xD1, 0x26,  // normatif
+    0x73, 0xE8, 0x11, 0x30, 0xA0,  // notable
+    0x73, 0xE8, 0x93, 0x24, 0xB2,  // notifier
+    0x73, 0xE8, 0xF4, 0xC8, 0xA0,  // notoire
+    0x73, 0xEB, 0x29, 0x26, 0x40,  // nourrir
+    0x73, 0xEB, 0x62, 0x86, 0xA0,  // nouveau
+    0x73, 0xEC, 0x1A, 0x16, 0xB2,  // novateur
+    0x73, 0xEC, 0x56, 0x8A, 0x45,  // novembre
+    0x73, 0xEC, 0x91, 0x94, 0x00,  // novice
+    0x75, 0x42, 0x72, 0x80, 0x00,  // nuage
+    0x75, 0x42, 0xE1, 0x96, 0x40,  // nuancer
+    0x75, 0x53, 0x22, 0x80, 0x00,  // nuire
+    0x75, 0x53, 0x34, 0x89, 0x85,  // nuisible
+    0x75, 0x5A, 0x59, 0x3C, 0x00,  // numero
+    0x75, 0x61, 0x44, 0x85, 0x80,  // nuptial
+    0x75, 0x63, 0x52, 0x80, 0x00,  // nuque
+    0x75, 0x69, 0x24, 0xD1, 0x26,  // nutritif
+    0x78, 0x8A, 0x99, 0x00, 0x00,  // obeir
+    0x78, 0x94, 0x51, 0xD1, 0x26,  // objectif
+    0x78, 0x98, 0x93, 0x96, 0x40,  // obliger
+    0x78, 0xA6, 0x3A, 0xC8, 0x00,  // obscur
+    0x78, 0xA6, 0x59, 0x58, 0xB2,  // observer
+    0x78, 0xA7, 0x40, 0x8D, 0x85,  // obstacle
+    0x78, 0xA8, 0x57, 0x26, 0x40,  // obtenir
+    0x78, 0xA9, 0x59, 0x16, 0x40,  // obturer
+    0x78, 0xC6, 0x19, 0xA5, 0xEE,  // occasion
+    0x78, 0xC7, 0x58, 0x16, 0x40,  // occuper
+    0x78, 0xCA, 0x17, 0x00, 0x00,  // ocean
+    0x78, 0xE8, 0xF1, 0x48, 0xA0,  // octobre
+    0x78, 0xE9, 0x27, 0xE4, 0xB2,  // octroyer
+    0x78, 0xE9, 0x58, 0x30, 0xB2,  // octupler
+    0x78, 0xEA, 0xC0, 0xA6, 0x45,  // oculaire
+    0x79, 0x0B, 0x59, 0x00, 0x00,  // odeur
+    0x79, 0x1F, 0x20, 0xBA, 0x80,  // odorant
+    0x79, 0x8C, 0x57, 0x4C, 0xB2,  // offenser
+    0x79, 0x8C, 0x91, 0xA4, 0xB2,  // officier
+    0x79, 0x8D, 0x24, 0xC8, 0x00,  // offrir
+    0x79, 0xD3, 0x62, 0x80, 0x00,  // ogive
+    0x7A, 0x66, 0x50, 0xD4, 0x00,  // oiseau
+    0x7A, 0x66, 0x96, 0x31, 0xEE,  // oisillon
+    0x7B, 0x0C, 0x11, 0xD1, 0x26,  // olfactif
+    0x7B, 0x13, 0x64, 0x96, 0x40,  // olivier
+    0x7B, 0x45, 0x20, 0x9C, 0xA0,  // ombrage
+    0x7B, 0x4B, 0x4A, 0x48, 0xA0,  // omettre
+    0x7B, 0x87, 0x4A, 0x96, 0xB8,  // onctueux
+    0x7B, 0x89, 0x56, 0x16, 0x40,  // onduler
+    0x7B, 0x8B, 0x22, 0xD7, 0x00,  // onereux
+    0x7B, 0x93, 0x24, 0xC6, 0xA5,  // onirique
+    0x7C, 0x02, 0xC2, 0x80, 0x00,  // opale
+    0x7C, 0x03, 0x1A, 0x94, 0x00,  // opaque
+    0x7C, 0x0B, 0x22, 0xC8, 0x00,  // operer
+    0x7C, 0x12, 0xE4, 0xBD, 0xC0,  // opinion
+    0x7C, 0x20, 0xF9, 0x52, 0xAE,  // opportun
+    0x7C, 0x21, 0x24, 0xB4, 0xB2,  // opprimer
+    0x7C, 0x28, 0x59, 0x00, 0x00,  // opter
+    0x7C, 0x28, 0x98, 0xD4, 0xA0,  // optique
+    0x7C, 0x82, 0x72, 0xD7, 0x00,  // orageux
+    0x7C, 0x82, 0xE3, 0x94, 0x00,  // orange
+    0x7C, 0x84, 0x9A, 0x14, 0x00,  // orbite
+    0x7C, 0x88, 0xF7, 0x38, 0xB2,  // ordonner
+    0x7C, 0x8A, 0x96, 0x30, 0xA0,  // oreille
+    0x7C, 0x8E, 0x17, 0x14, 0x00,  // organe
+    0x7C, 0x8F, 0x52, 0xA5, 0x80,  // orgueil
+    0x7C, 0x92, 0x64, 0x8C, 0xA0,  // orifice
+    0x7C, 0x9C, 0x56, 0x95, 0xD4,  // ornement
+    0x7C, 0xA3, 0x52, 0x80, 0x00,  // orque
+    0x7C, 0xA8, 0x92, 0x80, 0x00,  // ortie
+    0x7C, 0xC6, 0x96, 0x30, 0xB2,  // osciller
+    0x7C, 0xDA, 0xF9, 0x94, 0x00,  // osmose
+    0x7C, 0xE6, 0x1A, 0x56, 0x45,  // ossature
+    0x7D, 0x03, 0x24, 0x94, 0x00,  // otarie
+    0x7D, 0x64, 0x13, 0x85, 0xC0,  // ouragan
+    0x7D, 0x65, 0x37, 0xB8, 0x00,  // ourson
+    0x7D, 0x68, 0x96, 0x00, 0x00,  // outil
+    0x7D, 0x69, 0x20, 0x9C, 0xB2,  // outrager
+    0x7D, 0x6D, 0x20, 0x9C, 0xA0,  // ouvrage
+    0x7D, 0x83, 0x44, 0xBD, 0xC0,  // ovation
+    0x7E, 0x32, 0x42, 0x80, 0x00,  // oxyde
+    0x7E, 0x32, 0x72, 0xB8, 0xA0,  // oxygene
+    0x7E, 0x9E, 0xE2, 0x80, 0x00,  // ozone
+    0x80, 0x53, 0x34, 0x89, 0x85,  // paisible
+    0x80, 0x58, 0x11, 0x94, 0x00,  // palace
+    0x80, 0x58, 0xD0, 0xC8, 0xB3,  // palmares
+    0x80, 0x58, 0xFA, 0xC8, 0x85,  // palourde
+    0x80, 0x59, 0x02, 0xC8, 0x00,  // palper
+    0x80, 0x5C, 0x11, 0xA0, 0xA0,  // panache
+    0x80, 0x5C, 0x40, 0x80, 0x00,  // panda
+    0x80, 0x5C, 0x77, 0xB1, 0x2E,  // pangolin
+    0x80, 0x5C, 0x98, 0xD4, 0xB2,  // paniquer
+    0x80, 0x5C, 0xE2, 0x86, 0xA0,  // panneau
+    0x80, 0x5C, 0xF9, 0x05, 0xA1,  // panorama
+    0x80, 0x5D, 0x40, 0xB1, 0xEE,  // pantalon
+    0x80, 0x60, 0x1C, 0x94, 0x00,  // papaye
+    0x80, 0x60, 0x92, 0xC8, 0x00,  // papier
+    0x80, 0x60, 0xFA, 0x16, 0x40,  // papoter
+    0x80, 0x61, 0x99, 0x56, 0x60,  // papyrus
+    0x80, 0x64, 0x12, 0x3F, 0x05,  // paradoxe
+    0x80, 0x64, 0x32, 0xB1, 0x85,  // parcelle
+    0x80, 0x64, 0x59, 0xCC, 0xA0,  // paresse
+    0x80, 0x64, 0x6A, 0xB4, 0xB2,  // parfumer
+    0x80, 0x64, 0xC2, 0xC8, 0x00,  // parler
+    0x80, 0x64, 0xF6, 0x14, 0x00,  // parole
+    0x80, 0x65, 0x20, 0xA5, 0xC0,  // parrain
+    0x80, 0x65, 0x32, 0xB4, 0xB2,  // parsemer
+    0x80, 0x65, 0x40, 0x9C, 0xB2,  // partager
+    0x80, 0x65, 0x59, 0x14, 0x00,  // parure
+    0x80, 0x65, 0x62, 0xB9, 0x32,  // parvenir
+    0x80, 0x67, 0x34, 0xBD, 0xC0,  // passion
+    0x80, 0x67, 0x42, 0xC6, 0xA5,  // pasteque
+    0x80, 0x68, 0x59, 0x38, 0xAC,  // paternel
+    0x80, 0x68, 0x92, 0xB8, 0x65,  // patience
+    0x80, 0x69, 0x27, 0xB8, 0x00,  // patron
+    0x80, 0x6C, 0x96, 0x31, 0xEE,  // pavillon
+    0x80, 0x6C, 0xF4, 0xCC, 0xB2,  // pavoiser
+    0x80, 0x72, 0x59, 0x00, 0x00,  // payer
+    0x80, 0x73, 0x30, 0x9C, 0xA0,  // paysage
+    0x81, 0x52, 0x77, 0x14, 0x00,  // peigne
+    0x81, 0x52, 0xEA, 0x48, 0xA0,  // peintre
+    0x81, 0x58, 0x13, 0x94, 0x00,  // pelage
+    0x81, 0x58, 0x91, 0x85, 0xC0,  // pelican
+    0x81, 0x58, 0xC2, 0x80, 0x00,  // pelle
+    0x81, 0x58, 0xFA, 0xCC, 0xA0,  // pelouse
+    0x81, 0x59, 0x51, 0xA0, 0xA0,  // peluche
+    0x81, 0x5C, 0x4A, 0xB0, 0xA0,  // pendule
+    0x81, 0x5C, 0x5A, 0x48, 0xB2,  // penetrer
+    0x81, 0x5C, 0x91, 0x30, 0xA0,  // penible
+    0x81, 0x5D, 0x34, 0x98, 0x00,  // pensif
+    0x81, 0x5D, 0x59, 0x24, 0xA0,  // penurie
+    0x81, 0x60, 0x9A, 0x14, 0x00,  // pepite
+    0x81, 0x60, 0xCA, 0xB4, 0x00,  // peplum
+    0x81, 0x64, 0x49, 0x27, 0x00,  // perdrix
+    0x81, 0x64, 0x67, 0xC8, 0xB2,  // perforer
+    0x81, 0x64, 0x97, 0x90, 0xA0,  // periode
+    0x81, 0x64, 0xDA, 0xD0, 0xB2,  // permuter
+    0x81, 0x65, 0x06, 0x17, 0x05,  // perplexe
+    0x81, 0x65, 0x34, 0xB0, 0x00,  // persil
+    0x81, 0x65, 0x42, 0x80, 0x00,  // perte
+    0x81, 0x66, 0x59, 0x00, 0x00,  // peser
+    0x81, 0x68, 0x16, 0x14, 0x00,  // petale
+    0x81, 0x68, 0x9A, 0x00, 0x00,  // petit
+    0x81, 0x69, 0x24, 0xC8, 0x00,  // petrir
+    0x81, 0x6B, 0x06, 0x14, 0x00,  // peuple
+    0x82, 0x03, 0x20, 0xBD, 0xC0,  // pharaon
+    0x82, 0x1E, 0x24, 0x94, 0x00,  // phobie
+    0x82, 0x1F, 0x1A, 0x94, 0x00,  // phoque
+    0x82, 0x1F, 0x47, 0xB8, 0x00,  // photon
+    0x82, 0x24, 0x19, 0x94, 0x00,  // phrase
+    0x82, 0x33, 0x34, 0xC6, 0xA5,  // physique
+    0x82, 0x42, 0xE7, 0x80, 0x00,  // piano
+    0x82, 0x47, 0x4A, 0xC8, 0x2C,  // pictural
+    0x82, 0x4A, 0x32, 0x80, 0x00,  // piece
+    0x82, 0x4B, 0x29, 0x14, 0x00,  // pierre
+    0x82, 0x4B, 0x5B, 0x48, 0xA0,  // pieuvre
+    0x82, 0x58, 0xFA, 0x14, 0x00,  // pilote
+    0x82, 0x5C, 0x32, 0x86, 0xA0,  // pinceau
+    0x82, 0x60, 0x5A, 0x50, 0xA0,  // pipette
+    0x82, 0x63, 0x52, 0xC8, 0x00,  // piquer
+    0x82, 0x64, 0xF3, 0xD4, 0xA0,  // pirogue
+    0x82, 0x66, 0x34, 0xB8, 0xA0,  // piscine
+    0x82, 0x67, 0x47, 0xB8, 0x00,  // piston
+    0x82, 0x6C, 0xFA, 0x16, 0x40,  // pivoter
+    0x82, 0x70, 0x56, 0x00, 0x00,  // pixel
+    0x82, 0x75, 0xA0, 0x80, 0x00,  // pizza
+    0x83, 0x02, 0x30, 0xC8, 0x80,  // placard
+    0x83, 0x02, 0x67, 0xB8, 0x80,  // plafond
+    0x83, 0x02, 0x99, 0xA6, 0x40,  // plaisir
+    0x83, 0x02, 0xE2, 0xC8, 0x00,  // planer
+    0x83, 0x03, 0x1A, 0x94, 0x00,  // plaque
+    0x83, 0x03, 0x3A, 0x49, 0xEE,  // plastron
+    0x83, 0x03, 0x42, 0x86, 0xA0,  // plateau
+    0x83, 0x0B, 0x59, 0x16, 0x40,  // pleurer
+    0x83, 0x0B, 0x8A, 0xCC, 0x00,  // plexus
+    0x83, 0x12, 0x13, 0x94, 0x00,  // pliage
+    0x83, 0x1E, 0xD1, 0x00, 0x00,  // plomb
+    0x83, 0x1E, 0xE3, 0x96, 0x40,  // plonger
+    0x83, 0x2A, 0x92, 0x80, 0x00,  // pluie
+    0x83, 0x2A, 0xD0, 0x9C, 0xA0,  // plumage
+    0x83, 0xC6, 0x82, 0xD2, 0x85,  // pochette
+    0x83, 0xCB, 0x34, 0x94, 0x00,  // poesie
+    0x83, 0xCB, 0x42, 0x80, 0x00,  // poete
+    0x83, 0xD2, 0xEA, 0x14, 0x00,  // pointe
+    0x83, 0xD3, 0x24, 0x96, 0x40,  // poirier
+    0x83, 0xD3, 0x39, 0xBD, 0xC0,  // poisson
+    0x83, 0xD3, 0x69, 0x14, 0x00,  // poivre
+    0x83, 0xD8, 0x14, 0xC8, 0xA0,  // polaire
+    0x83, 0xD8, 0x91, 0xA4, 0xB2,  // policier
+    0x83, 0xD8, 0xC2, 0xB8, 0x00,  // pollen
+    0x83, 0xD9, 0x93, 0xBD, 0xC5,  // polygone
+    0x83, 0xDA, 0xD0, 0x90, 0xA0,  // pommade
+    0x83, 0xDB, 0x04, 0x96, 0x40,  // pompier
+    0x83, 0xDC, 0x3A, 0x54, 0xAC,  // ponctuel
+    0x83, 0xDC, 0x42, 0xC8, 0xB2,  // ponderer
+    0x83, 0xDC, 0x5C, 0x80, 0x00,  // poney
+    0x83, 0xE5, 0x44, 0xC6, 0xA5,  // portique
+    0x83, 0xE6, 0x9A, 0x25, 0xEE,  // position
+    0x83, 0xE7, 0x32, 0x90, 0xB2,  // posseder
+    0x83, 0xE7, 0x4A, 0xC8, 0xA0,  // posture
+    0x83, 0xE8, 0x13, 0x96, 0x40,  // potager
+    0x83, 0xE8, 0x50, 0xD4, 0x00,  // poteau
+    0x83, 0xE8, 0x97, 0xB8, 0x00,  // potion
+    0x83, 0xEA, 0x32, 0x80, 0x00,  // pouce
+    0x83, 0xEA, 0xC0, 0xA5, 0xC0,  // poulain
+    0x83, 0xEA, 0xD7, 0xB8, 0x00,  // poumon
+    0x83, 0xEB, 0x28, 0x48, 0xA0,  // pourpre
+    0x83, 0xEB, 0x39, 0xA5, 0xC0,  // poussin
+    0x83, 0xEB, 0x67, 0xA6, 0x40,  // pouvoir
+    0x84, 0x82, 0x99, 0x24, 0xA0,  // prairie
+    0x84, 0x83, 0x44, 0xC6, 0xA5,  // pratique
+    0x84, 0x8A, 0x34, 0x96, 0xB8,  // precieux
+    0x84, 0x8A, 0x44, 0xC8, 0xA0,  // predire
+    0x84, 0x8A, 0x64, 0xE0, 0xA0,  // prefixe
+    0x84, 0x8A, 0xCA, 0x90, 0xA0,  // prelude
+    0x84, 0x8A, 0xE7, 0xB4, 0x00,  // prenom
+    0x84, 0x8B, 0x32, 0xB8, 0x65,  // presence
+    0x84, 0x8B, 0x42, 0xE2, 0x85,  // pretexte
+    0x84, 0x8B, 0x67, 0xA6, 0x40,  // prevoir
+    0x84, 0x92, 0xD4, 0xD1, 0x26,  // primitif
+    0x84, 0x92, 0xE1, 0x94, 0x00,  // prince
+    0x84, 0x93, 0x37, 0xB8, 0x00,  // prison
+    0x84, 0x93, 0x62, 0xC8, 0x00,  // priver
+    0x84, 0x9E, 0x26, 0x15, 0xA5,  // probleme
+    0x84, 0x9E, 0x32, 0x90, 0xB2,  // proceder
+    0x84, 0x9E, 0x44, 0x9C, 0xA0,  // prodige
+    0x84, 0x9E, 0x67, 0xB8, 0x80,  // profond
+    0x84, 0x9E, 0x79, 0x16, 0x60,  // progres
+    0x84, 0x9E, 0x92, 0x80, 0x00,  // proie
+    0x84, 0x9E, 0xA2, 0xD0, 0xB2,  // projeter
+    0x84, 0x9E, 0xC7, 0x9E, 0xA5,  // prologue
+    0x84, 0x9E, 0xD2, 0xB8, 0xB2,  // promener
+    0x84, 0x9F, 0x09, 0x14, 0x00,  // propre
+    0x84, 0x9F, 0x38, 0x16, 0x45,  // prospere
+    0x84, 0x9F, 0x42, 0x9C, 0xB2,  // proteger
+    0x84, 0x9F, 0x52, 0xCE, 0x65,  // prouesse
+    0x84, 0x9F, 0x62, 0xC8, 0x45,  // proverbe
+    0x84, 0xAA, 0x42, 0xB8, 0x65,  // prudence
+    0x84, 0xAA, 0xE2, 0x86, 0xA0,  // pruneau
+    0x84, 0xF2, 0x34, 0x3E, 0x65,  // psychose
+    0x85, 0x44, 0xC4, 0x8C, 0x00,  // public
+    0x85, 0x46, 0x59, 0x3D, 0xC0,  // puceron
+    0x85, 0x53, 0x32, 0xC8, 0x00,  // puiser
+    0x85, 0x59, 0x02, 0x80, 0x00,  // pulpe
+    0x85, 0x59, 0x30, 0xC8, 0x00,  // pulsar
+    0x85, 0x5C, 0x14, 0xCC, 0xA0,  // punaise
+    0x85, 0x5C, 0x9A, 0x24, 0xC0,  // punitif
+    0x85, 0x60, 0x9A, 0x48, 0xA0,  // pupitre
+    0x85, 0x64, 0x93, 0x24, 0xB2,  // purifier
+    0x85, 0x75, 0xA6, 0x14, 0x00,  // puzzle
+    0x86, 0x64, 0x16, 0xA4, 0x85,  // pyramide
+    0x8D, 0x43, 0x30, 0xC8, 0x00,  // quasar
+    0x8D, 0x4B, 0x22, 0xB1, 0x85,  // querelle
+    0x8D, 0x4B, 0x3A, 0x25, 0xEE,  // question
+    0x8D, 0x52, 0x5A, 0x54, 0x85,  // quietude
+    0x8D, 0x53, 0x4A, 0x16, 0x40,  // quitter
+    0x8D, 0x5F, 0x44, 0x95, 0xD4,  // quotient
+    0x90, 0x46, 0x97, 0x14, 0x00,  // racine
+    0x90, 0x46, 0xF7, 0x50, 0xB2,  // raconter
+    0x90, 0x48, 0x92, 0xD7, 0x00,  // radieux
+    0x90, 0x4E, 0xF7, 0x11, 0x2E,  // ragondin
+    0x90, 0x52, 0x42, 0xD6, 0x40,  // raideur
+    0x90, 0x53, 0x34, 0xB8, 0x00,  // raisin
+    0x90, 0x58, 0x57, 0x51, 0x32,  // ralentir
+    0x90, 0x58, 0xC7, 0xB8, 0xE5,  // rallonge
+    0x90, 0x5A, 0x19, 0xCC, 0xB2,  // ramasser
+    0x90, 0x60, 0x92, 0x14, 0x00,  // rapide
+    0x90, 0x66, 0x13, 0x94, 0x00,  // rasage
+    0x90, 0x68, 0x99, 0xCC, 0xB2,  // ratisser
+    0x90, 0x6C, 0x13, 0x96, 0x40,  // ravager
+    0x90, 0x6C, 0x97, 0x00, 0x00,  // ravin
+    0x90, 0x72, 0xF7, 0x38, 0xB2,  // rayonner
+    0x91, 0x42, 0x3A, 0x24, 0xC0,  // reactif
+    0x91, 0x42, 0x74, 0xC8, 0x00,  // reagir
+    0x91, 0x42, 0xC4, 0xCC, 0xB2,  // realiser
+    0x91, 0x42, 0xE4, 0xB4, 0xB2,  // reanimer
+    0x91, 0x46, 0x5B, 0x3D, 0x32,  // recevoir
+    0x91, 0x46, 0x9A, 0x16, 0x40,  // reciter
+    0x91, 0x46, 0xC0, 0xB4, 0xB2,  // reclamer
+    0x91, 0x46, 0xF6, 0x50, 0xB2,  // recolter
+    0x91, 0x47, 0x2A, 0xD0, 0xB2,  // recruter
+    0x91, 0x47, 0x56, 0x16, 0x40,  // reculer
+    0x91, 0x47, 0x91, 0xB0, 0xB2,  // recycler
+    0x91, 0x48, 0x93, 0x96, 0x40,  // rediger
+    0x91, 0x48, 0xFA, 0xD0, 0xB2,  // redouter
+    0x91, 0x4C, 0x14, 0xC8, 0xA0,  // refaire
+    0x91, 0x4C, 0xC2, 0xE0, 0xA0,  // reflexe
+    0x91, 0x4C, 0xF9, 0x34, 0xB2,  // reformer
+    0x91, 0x4D, 0x20, 0xA5, 0xC0,  // refrain
+    0x91, 0x4D, 0x53, 0x94, 0x00,  // refuge
+    0x91, 0x4E, 0x16, 0x24, 0xAE,  // regalien
+    0x91, 0x4E, 0x97, 0xB8, 0x00,  // region
+    0x91, 0x4E, 0xC0, 0x9C, 0xA0,  // reglage
+    0x91, 0x4F, 0x56, 0x24, 0xB2,  // regulier
+    0x91, 0x53, 0x42, 0xC8, 0xB2,  // reiterer
+    0x91, 0x54, 0x5A, 0x16, 0x40,  // rejeter
+    0x91, 0x54, 0xFA, 0x96, 0x40,  // rejouer
+    0x91, 0x58, 0x1A, 0x24, 0xC0,  // relatif
+    0x91, 0x58, 0x5B, 0x16, 0x40,  // relever
+    0x91, 0x58, 0x92, 0x98, 0x00,  // relief
+    0x91, 0x5A, 0x19, 0x46, 0xA5,  // remarque
+    0x91, 0x5A, 0x52, 0x14, 0x00,  // remede
+    0x91, 0x5A, 0x99, 0x94, 0x00,  // remise
+    0x91, 0x5A, 0xF7, 0x50, 0xB2,  // remonter
+    0x91, 0x5B, 0x06, 0x26, 0x40,  // remplir
+    0x91, 0x5B, 0x52, 0xC8, 0x00,  // remuer
+    0x91, 0x5C, 0x19, 0x10, 0x00,  // renard
+    0x91, 0x5C, 0x67, 0xCA, 0x80,  // renfort
+    0x91, 0x5C, 0x93, 0x30, 0xB2,  // renifler
+    0x91, 0x5C, 0xF7, 0x0C, 0xB2,  // renoncer
+    0x91, 0x5D, 0x49, 0x16, 0x40,  // rentrer
+    0x91, 0x5D, 0x67, 0xA4, 0x00,  // renvoi
+    0x91, 0x60, 0xC4, 0x96, 0x40,  // replier
+    0x91, 0x60, 0xF9, 0x50, 0xB2,  // reporter
+    0x91, 0x61, 0x24, 0xCC, 0xA0,  // reprise
+    0x91, 0x61, 0x44, 0xB0, 0xA0,  // reptile
+    0x91, 0x63, 0x54, 0xB8, 0x00,  // requin
+    0x91, 0x66, 0x59, 0x58, 0xA0,  // reserve
+    0x91, 0x66, 0x97, 0x16, 0xB8,  // resineux
+    0x91, 0x66, 0xFA, 0x92, 0x45,  // resoudre
+    0x91, 0x67, 0x02, 0x8E, 0x80,  // respect
+    0x91, 0x67, 0x42, 0xC8, 0x00,  // rester
+    0x91, 0x67, 0x56, 0x50, 0x34,  // resultat
+    0x91, 0x68, 0x11, 0x31, 0x32,  // retablir
+    0x91, 0x68, 0x57, 0x26, 0x40,  // retenir
+    0x91, 0x68, 0x91, 0xD5, 0x85,  // reticule
+    0x91, 0x68, 0xF6, 0x88, 0xB2,  // retomber
+    0x91, 0x69, 0x20, 0x8C, 0xB2,  // retracer
+    0x91, 0x6A, 0xE4, 0xBD, 0xC0,  // reunion
+    0x91, 0x6B, 0x39, 0xA6, 0x40,  // reussir
+    0x91, 0x6C, 0x17, 0x0D, 0x05,  // revanche
+    0x91, 0x6C, 0x9B, 0x48, 0xA0,  // revivre
+    0x91, 0x6C, 0xF6, 0x50, 0xA0,  // revolte
+    0x91, 0x6D, 0x56, 0x4D, 0x26,  // revulsif
+    0x92, 0x46, 0x82, 0xCE, 0x65,  // richesse
+    0x92, 0x48, 0x50, 0xD4, 0x00,  // rideau
+    0x92, 0x4B, 0x59, 0x00, 0x00,  // rieur
+    0x92, 0x4E, 0x92, 0x14, 0x00,  // rigide
+    0x92, 0x4E, 0xF6, 0x16, 0x40,  // rigoler
+    0x92, 0x5C, 0x32, 0xC8, 0x00,  // rincer
+    0x92, 0x60, 0xF9, 0xD0, 0xB2,  // riposter
+    0x92, 0x66, 0x91, 0x30, 0xA0,  // risible
+    0x92, 0x67, 0x1A, 0x94, 0x00,  // risque
+    0x92, 0x69, 0x52, 0xB0, 0x00,  // rituel
+    0x92, 0x6C, 0x16, 0x00, 0x00,  // rival
+    0x92, 0x6C, 0x92, 0xC8, 0xA0,  // riviere
+    0x93, 0xC6, 0x82, 0xD7, 0x00,  // rocheux
+    0x93, 0xDA, 0x17, 0x0C, 0xA0,  // romance
+    0x93, 0xDB, 0x09, 0x14, 0x00,  // rompre
+    0x93, 0xDC, 0x32, 0x80, 0x00,  // ronce
+    0x93, 0xDC, 0x44, 0xB8, 0x00,  // rondin
+    0x93, 0xE6, 0x50, 0xD4, 0x00,  // roseau
+    0x93, 0xE6, 0x92, 0xC8, 0x00,  // rosier
+    0x93, 0xE8, 0x1A, 0x24, 0xC0,  // rotatif
+    0x93, 0xE8, 0xF9, 0x00, 0x00,  // rotor
+    0x93, 0xE9, 0x56, 0x14, 0x00,  // rotule
+    0x93, 0xEA, 0x72, 0x80, 0x00,  // rouge
+    0x93, 0xEA, 0x96, 0x30, 0xA0,  // rouille
+    0x93, 0xEA, 0xC2, 0x86, 0xA0,  // rouleau
+    0x93, 0xEB, 0x44, 0xB8, 0xA0,  // routine
+    0x93, 0xF2, 0x1A, 0xB4, 0xA0,  // royaume
+    0x95, 0x44, 0x17, 0x00, 0x00,  // ruban
+    0x95, 0x44, 0x99, 0x80, 0x00,  // rubis
+    0x95, 0x46, 0x82, 0x80, 0x00,  // ruche
+    0x95, 0x4A, 0xC6, 0x14, 0x00,  // ruelle
+    0x95, 0x4F, 0x52, 0xD7, 0x00,  // rugueux
+    0x95, 0x52, 0xE2, 0xC8, 0x00,  // ruiner
+    0x95, 0x53, 0x39, 0x94, 0x35,  // ruisseau
+    0x95, 0x66, 0x59, 0x00, 0x00,  // ruser
+    0x95, 0x67, 0x44, 0xC6, 0xA5,  // rustique
+    0x96, 0x68, 0x86, 0x94, 0x00,  // rythme
+    0x98, 0x44, 0xC2, 0xC8, 0x00,  // sabler
+    0x98, 0x44, 0xFA, 0x16, 0x40,  // saboter
+    0x98, 0x45, 0x22, 0x80, 0x00,  // sabre
+    0x98, 0x46, 0xF1, 0xA0, 0xA0,  // sacoche
+    0x98, 0x4C, 0x19, 0x24, 0x00,  // safari
+    0x98, 0x4E, 0x59, 0xCC, 0xA0,  // sagesse
+    0x98, 0x53, 0x34, 0xC8, 0x00,  // saisir
+    0x98, 0x58, 0x12, 0x14, 0x00,  // salade
+    0x98, 0x58, 0x9B, 0x14, 0x00,  // salive
+    0x98, 0x58, 0xF7, 0x00, 0x00,  // salon
+    0x98, 0x59, 0x52, 0xC8, 0x00,  // saluer
+    0x98, 0x5A, 0x52, 0x24, 0x00,  // samedi
+    0x98, 0x5C, 0x3A, 0x25, 0xEE,  // sanction
+    0x98, 0x5C, 0x76, 0x24, 0xB2,  // sanglier
+    0x98, 0x64, 0x30, 0xCD, 0xA5,  // sarcasme
+    0x98, 0x64, 0x44, 0xB8, 0xA0,  // sardine
+    0x98, 0x69, 0x59, 0x16, 0x40,  // saturer
+    0x98, 0x6A, 0x79, 0x15, 0xD5,  // saugrenu
+    0x98, 0x6A, 0xD7, 0xB8, 0x00,  // saumon
+    0x98, 0x6B, 0x42, 0xC8, 0x00,  // sauter
+    0x98, 0x6B, 0x60, 0x9C, 0xA0,  // sauvage
+    0x98, 0x6C, 0x17, 0x50, 0x00,  // savant
+    0x98, 0x6C, 0xF7, 0x38, 0xB2,  // savonner
+    0x98, 0xC2, 0xC8, 0x15, 0x80,  // scalpel
+    0x98, 0xC2, 0xE2, 0x05, 0x85,  // scandale
+    0x98, 0xCA, 0xC2, 0xC8, 0x34,  // scelerat
+    0x98, 0xCA, 0xE0, 0xC9, 0x2F,  // scenario
+    0x98, 0xCB, 0x0A, 0x48, 0xA0,  // sceptre
+    0x98, 0xD0, 0x56, 0x84, 0x00,  // schema
+    0x98, 0xD2, 0x57, 0x0C, 0xA0,  // science
+    0x98, 0xD2, 0xE2, 0x16, 0x40,  // scinder
+    0x98, 0xDF, 0x22, 0x80, 0x00,  // score
+    0x98, 0xE5, 0x5A, 0x25, 0xC0,  // scrutin
+    0x98, 0xEA, 0xC8, 0x50, 0xB2,  // sculpter
+    0x99, 0x42, 0xE1, 0x94, 0x00,  // seance
+    0x99, 0x46, 0x11, 0x30, 0xA0,  // secable
+    0x99, 0x46, 0x82, 0xC8, 0x00,  // secher
+    0x99, 0x46, 0xFA, 0x96, 0x40,  // secouer
+    0x99, 0x47, 0x22, 0xD0, 0xB2,  // secreter
+    0x99, 0x48, 0x1A, 0x24, 0xC0,  // sedatif
+    0x99, 0x49, 0x54, 0xC8, 0xA0,  // seduire
+    0x99, 0x52, 0x77, 0x16, 0xB2,  // seigneur
+    0x99, 0x54, 0xFA, 0xC8, 0x00,  // sejour
+    0x99, 0x58, 0x51, 0xD1, 0x26,  // selectif
+    0x99, 0x5A, 0x14, 0xB8, 0xA0,  // semaine
+    0x99, 0x5A, 0x26, 0x16, 0x40,  // sembler
+    0x99, 0x5A, 0x57, 0x0C, 0xA0,  // semence
+    0x99, 0x5A, 0x97, 0x05, 0x80,  // seminal
+    0x99, 0x5C, 0x1A, 0x16, 0xB2,  // senateur
+    0x99, 0x5D, 0x34, 0x89, 0x85,  // sensible
+    0x99, 0x5D, 0x42, 0xB8, 0x65,  // sentence
+    0x99, 0x60, 0x19, 0x16, 0x40,  // separer
+    0x99, 0x63, 0x52, 0xB8, 0x65,  // sequence
+    0x99, 0x64, 0x54, 0xB8, 0x00,  // serein
+    0x99, 0x64, 0x72, 0xBA, 0x80,  // sergent
+    0x99, 0x64, 0x92, 0xD7, 0x00,  // serieux
+    0x99, 0x65, 0x2A, 0xC8, 0xA0,  // serrure
+    0x99, 0x65, 0x56, 0x80, 0x00,  // serum
+    0x99, 0x65, 0x64, 0x8C, 0xA0,  // service
+    0x99, 0x66, 0x16, 0x94, 0x00,  // sesame
+    0x99, 0x6C, 0x99, 0x00, 0x00,  // sevir
+    0x99, 0x6D, 0x20, 0x9C, 0xA0,  // sevrage
+    0x99, 0x71, 0x4A, 0xC1, 0x85,  // sextuple
+    0x9A, 0x48, 0x59, 0x05, 0x80,  // sideral
+    0x9A, 0x4A, 0x36, 0x14, 0x00,  // siecle
+    0x9A, 0x4A, 0x72, 0xC8, 0x00,  // sieger
+    0x9A, 0x4C, 0x66, 0x16, 0x40,  // siffler
+    0x9A, 0x4E, 0xC2, 0x80, 0x00,  // sigle
+    0x9A, 0x4E, 0xE0, 0xB0, 0x00,  // signal
+    0x9A, 0x58, 0x57, 0x0C, 0xA0,  // silence
+    0x9A, 0x58, 0x91, 0xA6, 0xAD,  // silicium
+    0x9A, 0x5B, 0x06, 0x14, 0x00,  // simple
+    0x9A, 0x5C, 0x32, 0xC8, 0xA0,  // sincere
+    0x9A, 0x5C, 0x99, 0xD2, 0x45,  // sinistre
+    0x9A, 0x60, 0x87, 0xB8, 0x00,  // siphon
+    0x9A, 0x64, 0xF8, 0x00, 0x00,  // sirop
+    0x9A, 0x66, 0xD4, 0xC6, 0xA5,  // sismique
+    0x9A, 0x69, 0x52, 0xC8, 0x00,  // situer
+    0x9A, 0xD2, 0x59, 0x00, 0x00,  // skier
+    0x9B, 0xC6, 0x90, 0xB0, 0x00,  // social
+    0x9B, 0xC6, 0xC2, 0x80, 0x00,  // socle
+    0x9B, 0xC8, 0x9A, 0xB4, 0x00,  // sodium
+    0x9B, 0xD2, 0x77, 0x16, 0xB8,  // soigneux
+    0x9B, 0xD8, 0x40, 0xD0, 0x00,  // soldat
+    0x9B, 0xD8, 0x54, 0xB0, 0x00,  // soleil
+    0x9B, 0xD8, 0x9A, 0x54, 0x85,  // solitude
+    0x9B, 0xD9, 0x51, 0x30, 0xA0,  // soluble
+    0x9B, 0xDA, 0x29, 0x14, 0x00,  // sombre
+    0x9B, 0xDA, 0xD2, 0xA5, 0x80,  // sommeil
+    0x9B, 0xDA, 0xE7, 0xB0, 0xB2,  // somnoler
+    0x9B, 0xDC, 0x42, 0x80, 0x00,  // sonde
+    0x9B, 0xDC, 0x72, 0xD6, 0x40,  // songeur
+    0x9B, 0xDC, 0xE2, 0xD2, 0x85,  // sonnette
+    0x9B, 0xDC, 0xF9, 0x14, 0x00,  // sonore
+    0x9B, 0xE4, 0x34, 0x96, 0x40,  // sorcier
+    0x9B, 0xE5, 0x44, 0xC8, 0x00,  // sortir
+    0x9B, 0xE6, 0x92, 0x80, 0x00,  // sosie
+    0x9B, 0xE9, 0x44, 0xCC, 0xA0,  // sottise
+    0x9B, 0xEA, 0x34, 0x96, 0xB8,  // soucieux
+    0x9B, 0xEA, 0x4A, 0xC8, 0xA0,  // soudure
+    0x9B, 0xEA, 0x63, 0x30, 0xA0,  // souffle
+    0x9B, 0xEA, 0xC2, 0xD8, 0xB2,  // soulever
+    0x9B, 0xEB, 0x00, 0xC0, 0xA0,  // soupape
+    0x9B, 0xEB, 0x21, 0x94, 0x00,  // source
+    0x9B, 0xEB, 0x44, 0xC8, 0xB2,  // soutirer
+    0x9B, 0xEB, 0x62, 0xB9, 0x32,  // souvenir
+    0x9C, 0x02, 0x34, 0x96, 0xB8,  // spacieux
+    0x9C, 0x03, 0x44, 0x85, 0x80,  // spatial
+    0x9C, 0x0A, 0x34, 0x85, 0x80,  // special
+    0x9C, 0x10, 0x59, 0x14, 0x00,  // sphere
+    0x9C, 0x13, 0x20, 0xB0, 0x00,  // spiral
+    0x9D, 0x02, 0x26, 0x14, 0x00,  // stable
+    0x9D, 0x03, 0x44, 0xBD, 0xC0,  // station
+    0x9D, 0x0B, 0x27, 0x55, 0xA0,  // sternum
+    0x9D, 0x12, 0xDA, 0xB2, 0xB3,  // stimulus
+    0x9D, 0x13, 0x0A, 0xB0, 0xB2,  // stipuler
+    0x9D, 0x24, 0x91, 0xD0, 0x00,  // strict
+    0x9D, 0x2A, 0x44, 0x96, 0xB8,  // studieux
+    0x9D, 0x2B, 0x02, 0xD6, 0x40,  // stupeur
+    0x9D, 0x32, 0xC4, 0xCE, 0x85,  // styliste
+    0x9D, 0x44, 0xC4, 0xB4, 0xA0,  // sublime
+    0x9D, 0x45, 0x3A, 0x48, 0x34,  // substrat
+    0x9D, 0x45, 0x44, 0xB0, 0x00,  // subtil
+    0x9D, 0x45, 0x62, 0xB9, 0x32,  // subvenir
+    0x9D, 0x46, 0x32, 0xCC, 0x00,  // succes
+    0x9D, 0x47, 0x22, 0x80, 0x00,  // sucre
+    0x9D, 0x4C, 0x64, 0xE0, 0xA0,  // suffixe
+    0x9D, 0x4E, 0x72, 0xC8, 0xB2,  // suggerer
+    0x9D, 0x53, 0x62, 0xD6, 0x40,  // suiveur
+    0x9D, 0x58, 0x60, 0xD0, 0xA0,  // sulfate
+    0x9D, 0x60, 0x59, 0x08, 0xA0,  // superbe
+    0x9D, 0x61, 0x06, 0x24, 0xB2,  // supplier
+    0x9D, 0x64, 0x60, 0x8C, 0xA0,  // surface
+    0x9D, 0x64, 0x91, 0x86, 0x85,  // suricate
+    0x9D, 0x64, 0xD2, 0xB8, 0xB2,  // surmener
+    0x9D, 0x65, 0x09, 0x26, 0x65,  // surprise
+    0x9D, 0x65, 0x30, 0xD6, 0x80,  // sursaut
+    0x9D, 0x65, 0x64, 0x94, 0x00,  // survie
+    0x9D, 0x67, 0x02, 0x8E, 0x80,  // suspect
+    0x9E, 0x58, 0xC0, 0x88, 0xA0,  // syllabe
+    0x9E, 0x5A, 0x27, 0xB0, 0xA0,  // symbole
+    0x9E, 0x5A, 0x5A, 0x49, 0x25,  // symetrie
+    0x9E, 0x5C, 0x18, 0x4C, 0xA0,  // synapse
+    0x9E, 0x5D, 0x40, 0xE0, 0xA0,  // syntaxe
+    0x9E, 0x67, 0x42, 0xB4, 0xA0,  // systeme
+    0xA0, 0x44, 0x11, 0x80, 0x00,  // tabac
+    0xA0, 0x44, 0xC4, 0x96, 0x40,  // tablier
+    0xA0, 0x47, 0x44, 0xB0, 0xA0,  // tactile
+    0xA0, 0x52, 0xC6, 0x16, 0x40,  // tailler
+    0xA0, 0x58, 0x57, 0x50, 0x00,  // talent
+    0xA0, 0x58, 0x99, 0xB4, 0x2E,  // talisman
+    0xA0, 0x58, 0xF7, 0x38, 0xB2,  // talonner
+    0xA0, 0x5A, 0x27, 0xD6, 0x40,  // tambour
+    0xA0, 0x5A, 0x99, 0x96, 0x40,  // tamiser
+    0xA0, 0x5C, 0x74, 0x89, 0x85,  // tangible
+    0xA0, 0x60, 0x99, 0x80, 0x00,  // tapis
+    0xA0, 0x63, 0x54, 0xB8, 0xB2,  // taquiner
+    0xA0, 0x64, 0x42, 0xC8, 0x00,  // tarder
+    0xA0, 0x64, 0x93, 0x00, 0x00,  // tarif
+    0xA0, 0x65, 0x44, 0xB8, 0xA0,  // tartine
+    0xA0, 0x67, 0x32, 0x80, 0x00,  // tasse
+    0xA0, 0x68, 0x16, 0xA4, 0x00,  // tatami
+    0xA0, 0x68, 0xFA, 0x84, 0xE5,  // tatouage
+    0xA0, 0x6B, 0x02, 0x80, 0x00,  // taupe
+    0xA0, 0x6B, 0x22, 0x86, 0xA0,  // taureau
+    0xA0, 0x70, 0x59, 0x00, 0x00,  // taxer
+    0xA1, 0x5A, 0xF4, 0xB8, 0x00,  // temoin
+    0xA1, 0x5B, 0x07, 0xC8, 0xAC,  // temporel
+    0xA1, 0x5C, 0x14, 0xB1, 0x85,  // tenaille
+    0xA1, 0x5C, 0x49, 0x14, 0x00,  // tendre
+    0xA1, 0x5C, 0x5A, 0xC8, 0x00,  // teneur
+    0xA1, 0x5C, 0x99, 0x00, 0x00,  // tenir
+    0xA1, 0x5D, 0x34, 0xBD, 0xC0,  // tension
+    0xA1, 0x64, 0xD4, 0xB8, 0xB2,  // terminer
+    0xA1, 0x64, 0xE2, 0x80, 0x00,  // terne
+    0xA1, 0x65, 0x24, 0x89, 0x85,  // terrible
+    0xA1, 0x68, 0x97, 0x14, 0x00,  // tetine
+    0xA1, 0x71, 0x42, 0x80, 0x00,  // texte
+    0xA2, 0x0A, 0xD2, 0x80, 0x00,  // theme
+    0xA2, 0x0A, 0xF9, 0x24, 0xA0,  // theorie
+    0xA2, 0x0B, 0x20, 0xC1, 0x25,  // therapie
+    0xA2, 0x1F, 0x20, 0xE0, 0x00,  // thorax
+    0xA2, 0x44, 0x90, 0x80, 0x00,  // tibia
+    0xA2, 0x4A, 0x42, 0x80, 0x00,  // tiede
+    0xA2, 0x5A, 0x92, 0x14, 0x00,  // timide
+    0xA2, 0x64, 0x56, 0x26, 0x45,  // tirelire
+    0xA2, 0x64, 0xF4, 0xC8, 0x00,  // tiroir
+    0xA2, 0x67, 0x3A, 0x80, 0x00,  // tissu
+    0xA2, 0x68, 0x17, 0x14, 0x00,  // titane
+    0xA2, 0x69, 0x22, 0x80, 0x00,  // titre
+    0xA2, 0x69, 0x51, 0x16, 0x40,  // tituber
+    0xA3, 0xC4, 0xF3, 0x9C, 0x2E,  // toboggan
+    0xA3, 0xD8, 0x59, 0x05, 0xD4,  // tolerant
+    0xA3, 0xDA, 0x1A, 0x14, 0x00,  // tomate
+    0xA3, 0xDC, 0x98, 0xD4, 0xA0,  // tonique
+    0xA3, 0xDC, 0xE2, 0x86, 0xA0,  // tonneau
+    0xA3, 0xE0, 0xF7, 0x65, 0xA5,  // toponyme
+    0xA3, 0xE4, 0x34, 0x14, 0x00,  // torche
+    0xA3, 0xE4, 0x49, 0x14, 0x00,  // tordre
+    0xA3, 0xE4, 0xE0, 0x90, 0xA0,  // tornade
+    0xA3, 0xE5, 0x04, 0xB1, 0x85,  // torpille
+    0xA3, 0xE5, 0x22, 0xBA, 0x80,  // torrent
+    0xA3, 0xE5, 0x32, 0x80, 0x00,  // torse
+    0xA3, 0xE5, 0x4A, 0x94, 0x00,  // tortue
+    0xA3, 0xE8, 0x56, 0x80, 0x00,  // totem
+    0xA3, 0xEA, 0x34, 0x16, 0x40,  // toucher
+    0xA3, 0xEB, 0x27, 0x04, 0xE5,  // tournage
+    0xA3, 0xEB, 0x39, 0x96, 0x40,  // tousser
+    0xA3, 0xF0, 0x97, 0x14, 0x00,  // toxine
+    0xA4, 0x82, 0x3A, 0x25, 0xEE,  // traction
+    0xA4, 0x82, 0x64, 0x8C, 0x00,  // trafic
+    0xA4, 0x82, 0x74, 0xC6, 0xA5,  // tragique
+    0xA4, 0x82, 0x84, 0xC8, 0x00,  // trahir
+    0xA4, 0x82, 0x97, 0x00, 0x00,  // train
+    0xA4, 0x82, 0xE1, 0xA0, 0xB2,  // trancher
+    0xA4, 0x83, 0x60, 0xA5, 0x80,  // travail
+    0xA4, 0x8A, 0x66, 0x14, 0x00,  // trefle
+    0xA4, 0x8A, 0xD8, 0x16, 0x40,  // tremper
+    0xA4, 0x8B, 0x37, 0xC8, 0x00,  // tresor
+    0xA4, 0x8B, 0x54, 0xB0, 0x00,  // treuil
+    0xA4, 0x92, 0x13, 0x94, 0x00,  // triage
+    0xA4, 0x92, 0x2A, 0xB8, 0x2C,  // tribunal
+    0xA4, 0x92, 0x37, 0xD0, 0xB2,  // tricoter
+    0xA4, 0x92, 0xC7, 0x9D, 0x25,  // trilogie
+    0xA4, 0x92, 0xF6, 0xC1, 0x05,  // triomphe
+    0xA4, 0x93, 0x06, 0x16, 0x40,  // tripler
+    0xA4, 0x93, 0x4A, 0xC8, 0xB2,  // triturer
+    0xA4, 0x93, 0x64, 0x85, 0x80,  // trivial
+    0xA4, 0x9E, 0xD1, 0x3D, 0xC5,  // trombone
+    0xA4, 0x9E, 0xE1, 0x80, 0x00,  // tronc
+    0xA4, 0x9F, 0x04, 0x8C, 0x2C,  // tropical
+    0xA4, 0x9F, 0x58, 0x14, 0x35,  // troupeau
+    0xA5, 0x52, 0xC2, 0x80, 0x00,  // tuile
+    0xA5, 0x58, 0x98, 0x14, 0x00,  // tulipe
+    0xA5, 0x5B, 0x56, 0x50, 0xA0,  // tumulte
+    0xA5, 0x5C, 0xE2, 0xB0, 0x00,  // tunnel
+    0xA5, 0x64, 0x24, 0xB8, 0xA0,  // turbine
+    0xA5, 0x68, 0x5A, 0xC8, 0x00,  // tuteur
+    0xA5, 0x68, 0xFC, 0x96, 0x40,  // tutoyer
+    0xA5, 0x72, 0x1A, 0x80, 0x00,  // tuyau
+    0xA6, 0x5B, 0x00, 0xB8, 0x00,  // tympan
+    0xA6, 0x60, 0x87, 0xB8, 0x00,  // typhon
+    0xA6, 0x60, 0x98, 0xD4, 0xA0,  // typique
+    0xA6, 0x64, 0x17, 0x00, 0x00,  // tyran
+    0xA8, 0xAA, 0x59, 0xC6, 0xA5,  // ubuesque
+    0xAB, 0x28, 0x96, 0x94, 0x00,  // ultime
+    0xAB, 0x29, 0x20, 0xCD, 0xEE,  // ultrason
+    0xAB, 0x82, 0xE4, 0xB4, 0xA0,  // unanime
+    0xAB, 0x92, 0x64, 0x96, 0x40,  // unifier
+    0xAB, 0x92, 0xF7, 0x00, 0x00,  // union
+    0xAB, 0x93, 0x1A, 0x94, 0x00,  // unique
+    0xAB, 0x93, 0x40, 0xA6, 0x45,  // unitaire
+    0xAB, 0x93, 0x62, 0xCA, 0x60,  // univers
+    0xAC, 0x82, 0xE4, 0xD5, 0xA0,  // uranium
+    0xAC, 0x84, 0x14, 0xB8, 0x00,  // urbain
+    0xAC, 0xA8, 0x91, 0x85, 0xD4,  // urticant
+    0xAC, 0xC2, 0x72, 0x80, 0x00,  // usage
+    0xAC, 0xD2, 0xE2, 0x80, 0x00,  // usine
+    0xAC, 0xEA, 0x56, 0x00, 0x00,  // usuel
+    0xAC, 0xEB, 0x22, 0x80, 0x00,  // usure
+    0xAD, 0x12, 0xC2, 0x80, 0x00,  // utile
+    0xAD, 0x1F, 0x04, 0x94, 0x00,  // utopie
+    0xB0, 0x46, 0x19, 0x34, 0xA0,  // vacarme
+    0xB0, 0x46, 0x34, 0xB8, 0x00,  // vaccin
+    0xB0, 0x4E, 0x11, 0x3D, 0xC4,  // vagabond
+    0xB0, 0x4F, 0x52, 0x80, 0x00,  // vague
+    0xB0, 0x52, 0xC6, 0x05, 0xD4,  // vaillant
+    0xB0, 0x52, 0xE1, 0xC8, 0xA0,  // vaincre
+    0xB0, 0x53, 0x39, 0x94, 0x35,  // vaisseau
+    0xB0, 0x58, 0x11, 0x30, 0xA0,  // valable
+    0xB0, 0x58, 0x99, 0x94, 0x00,  // valise
+    0xB0, 0x58, 0xC7, 0xB8, 0x00,  // vallon
+    0xB0, 0x59, 0x62, 0x80, 0x00,  // valve
+    0xB0, 0x5B, 0x04, 0xC8, 0xA0,  // vampire
+    0xB0, 0x5C, 0x96, 0x30, 0xA0,  // vanille
+    0xB0, 0x60, 0x5A, 0xC8, 0x00,  // vapeur
+    0xB0, 0x64, 0x92, 0xC8, 0x00,  // varier
+    0xB0, 0x66, 0x5A, 0xE0, 0x00,  // vaseux
+    0xB0, 0x67, 0x30, 0xB0, 0x00,  // vassal
+    0xB0, 0x67, 0x42, 0x80, 0x00,  // vaste
+    0xB1, 0x47, 0x42, 0xD6, 0x40,  // vecteur
+    0xB1, 0x48, 0x5A, 0x50, 0xA0,  // vedette
+    0xB1, 0x4E, 0x5A, 0x05, 0x80,  // vegetal
+    0xB1, 0x50, 0x91, 0xD5, 0x85,  // vehicule
+    0xB1, 0x52, 0xE0, 0xC8, 0x80,  // veinard
+    0xB1, 0x58, 0xF1, 0x94, 0x00,  // veloce
+    0xB1, 0x5C, 0x49, 0x14, 0x89,  // vendredi
+    0xB1, 0x5C, 0x59, 0x16, 0x40,  // venerer
+    0xB1, 0x5C, 0x72, 0xC8, 0x00,  // venger
+    0xB1, 0x5C, 0x96, 0x96, 0xB8,  // venimeux
+    0xB1, 0x5D, 0x47, 0xD6, 0x65,  // ventouse
+    0xB1, 0x64, 0x4A, 0xC8, 0xA0,  // verdure
+    0xB1, 0x64, 0x97, 0x00, 0x00,  // verin
+    0xB1, 0x64, 0xE4, 0xC8, 0x00,  // vernir
+    0xB1, 0x65, 0x27, 0xD4, 0x00,  // verrou
+    0xB1, 0x65, 0x32, 0xC8, 0x00,  // verser
+    0xB1, 0x65, 0x4A, 0x80, 0x00,  // vertu
+    0xB1, 0x67, 0x47, 0xB8, 0x00,  // veston
+    0xB1, 0x68, 0x59, 0x05, 0xC0,  // veteran
+    0xB1, 0x69, 0x59, 0xD0, 0xA0,  // vetuste
+    0xB1, 0x70, 0x17, 0x50, 0x00,  // vexant
+    0xB1, 0x70, 0x59, 0x00, 0x00,  // vexer
+    0xB2, 0x42, 0x4A, 0x8C, 0x00,  // viaduc
+    0xB2, 0x42, 0xE2, 0x14, 0x00,  // viande
+    0xB2, 0x47, 0x47, 0xA6, 0x45,  // victoire
+    0xB2, 0x48, 0x17, 0x1C, 0xA0,  // vidange
+    0xB2, 0x48, 0x57, 0x80, 0x00,  // video
+    0xB2, 0x4E, 0xE2, 0xD2, 0x85,  // vignette
+    0xB2, 0x4F, 0x52, 0xD6, 0x40,  // vigueur
+    0xB2, 0x58, 0x14, 0xB8, 0x00,  // vilain
+    0xB2, 0x58, 0xC0, 0x9C, 0xA0,  // village
+    0xB2, 0x5C, 0x14, 0x9E, 0x45,  // vinaigre
+    0xB2, 0x5E, 0xC7, 0xB8, 0x00,  // violon
+    0xB2, 0x60, 0x59, 0x14, 0x00,  // vipere
+    0xB2, 0x64, 0x56, 0x95, 0xD4,  // virement
+    0xB2, 0x65, 0x4A, 0xBE, 0x65,  // virtuose
+    0xB2, 0x65, 0x59, 0x80, 0x00,  // virus
+    0xB2, 0x66, 0x13, 0x94, 0x00,  // visage
+    0xB2, 0x66, 0x5A, 0xC8, 0x00,  // viseur
+    0xB2, 0x66, 0x97, 0xB8, 0x00,  // vision
+    0xB2, 0x67, 0x1A, 0x96, 0xB8,  // visqueux
+    0xB2, 0x67, 0x52, 0xB0, 0x00,  // visuel
+    0xB2, 0x68, 0x16, 0x00, 0x00,  // vital
+    0xB2, 0x68, 0x59, 0xCC, 0xA0,  // vitesse
+    0xB2, 0x68, 0x91, 0xBD, 0x85,  // viticole
+    0xB2, 0x69, 0x24, 0xB8, 0xA0,  // vitrine
+    0xB2, 0x6C, 0x11, 0x94, 0x00,  // vivace
+    0xB2, 0x6C, 0x98, 0x06, 0x45,  // vivipare
+    0xB3, 0xC6, 0x1A, 0x25, 0xEE,  // vocation
+    0xB3, 0xCF, 0x52, 0xC8, 0x00,  // voguer
+    0xB3, 0xD2, 0xC2, 0x80, 0x00,  // voile
+    0xB3, 0xD3, 0x34, 0xB8, 0x00,  // voisin
+    0xB3, 0xD3, 0x4A, 0xC8, 0xA0,  // voiture
+    0xB3, 0xD8, 0x14, 0xB1, 0x85,  // volaille
+    0xB3, 0xD8, 0x30, 0xB8, 0x00,  // volcan
+    0xB3, 0xD9, 0x44, 0x9C, 0xB2,  // voltiger
+    0xB3, 0xD9, 0x56, 0x94, 0x00,  // volume
+    0xB3, 0xE4, 0x11, 0x94, 0x00,  // vorace
+    0xB3, 0xE5, 0x42, 0xE0, 0x00,  // vortex
+    0xB3, 0xE8, 0x59, 0x00, 0x00,  // voter
+    0xB3, 0xEA, 0xC7, 0xA6, 0x40,  // vouloir
+    0xB3, 0xF2, 0x13, 0x94, 0x00,  // voyage
+    0xB3, 0xF2, 0x56, 0x30, 0xA0,  // voyelle
+    0xB8, 0x4E, 0xF7, 0x00, 0x00,  // wagon
+    0xC1, 0x5C, 0xF7, 0x00, 0x00,  // xenon
+    0xC8, 0x46, 0x8A, 0x00, 0x00,  // yacht
+    0xD1, 0x45, 0x22, 0x80, 0x00,  // zebre
+    0xD1, 0x5C, 0x9A, 0x20, 0x00,  // zenith
+    0xD1, 0x67, 0x42, 0x80, 0x00,  // zeste
+    0xD3, 0xDE, 0xC7, 0x9D, 0x25};  // zoologie
 
-unsigned short const BIP39_WORDLIST_OFFSETS[] = {
-    0,     7,     14,    18,    23,    28,    34,    40,    48,    54,    59,    65,    73,
-    80,    86,    93,    97,    105,   112,   118,   121,   127,   132,   139,   145,   150,
-    153,   159,   166,   172,   177,   182,   189,   195,   202,   208,   214,   220,   225,
-    228,   233,   238,   243,   246,   249,   256,   261,   266,   271,   278,   283,   288,
-    291,   296,   301,   307,   312,   317,   324,   328,   333,   339,   346,   353,   358,
-    364,   370,   377,   383,   390,   395,   400,   405,   411,   416,   424,   430,   437,
-    443,   450,   457,   464,   467,   472,   479,   485,   490,   497,   502,   506,   512,
-    516,   521,   526,   529,   534,   539,   543,   549,   556,   562,   568,   573,   576,
-    584,   590,   597,   600,   606,   613,   618,   624,   630,   636,   643,   647,   653,
-    659,   667,   674,   681,   686,   692,   696,   702,   706,   712,   719,   726,   731,
-    736,   741,   745,   752,   757,   764,   768,   772,   780,   785,   790,   793,   800,
-    807,   811,   817,   823,   829,   832,   838,   845,   851,   855,   860,   866,   872,
-    877,   881,   887,   894,   900,   904,   910,   915,   921,   927,   934,   939,   943,
-    948,   955,   959,   965,   971,   978,   984,   991,   994,   998,   1002,  1009,  1013,
-    1018,  1024,  1029,  1034,  1039,  1046,  1051,  1056,  1061,  1066,  1071,  1078,  1084,
-    1088,  1092,  1097,  1102,  1106,  1110,  1114,  1118,  1122,  1127,  1131,  1136,  1142,
-    1148,  1154,  1158,  1164,  1170,  1173,  1176,  1183,  1188,  1193,  1198,  1203,  1208,
-    1214,  1219,  1225,  1230,  1236,  1241,  1246,  1254,  1260,  1266,  1271,  1278,  1283,
-    1288,  1294,  1299,  1305,  1312,  1317,  1321,  1325,  1331,  1337,  1343,  1349,  1355,
-    1360,  1363,  1371,  1375,  1381,  1386,  1390,  1397,  1402,  1407,  1413,  1417,  1421,
-    1425,  1429,  1435,  1439,  1442,  1447,  1453,  1458,  1464,  1469,  1475,  1481,  1488,
-    1495,  1502,  1505,  1511,  1515,  1520,  1526,  1531,  1535,  1539,  1543,  1549,  1555,
-    1561,  1564,  1571,  1576,  1584,  1590,  1596,  1601,  1608,  1612,  1619,  1625,  1631,
-    1637,  1644,  1650,  1657,  1662,  1667,  1675,  1681,  1686,  1693,  1699,  1704,  1708,
-    1713,  1718,  1724,  1728,  1734,  1739,  1746,  1751,  1756,  1763,  1769,  1775,  1782,
-    1789,  1794,  1799,  1804,  1812,  1818,  1825,  1829,  1834,  1839,  1843,  1850,  1854,
-    1858,  1863,  1868,  1874,  1879,  1885,  1890,  1895,  1901,  1905,  1910,  1914,  1919,
-    1924,  1929,  1934,  1938,  1943,  1950,  1956,  1961,  1966,  1973,  1977,  1983,  1987,
-    1991,  1998,  2003,  2009,  2016,  2020,  2027,  2032,  2038,  2045,  2052,  2059,  2066,
-    2074,  2081,  2089,  2096,  2104,  2108,  2112,  2118,  2122,  2127,  2131,  2135,  2142,
-    2146,  2152,  2157,  2164,  2170,  2176,  2182,  2187,  2193,  2198,  2204,  2209,  2213,
-    2218,  2223,  2229,  2234,  2239,  2244,  2250,  2255,  2259,  2266,  2271,  2276,  2282,
-    2286,  2291,  2297,  2302,  2309,  2314,  2320,  2327,  2333,  2338,  2341,  2348,  2352,
-    2359,  2362,  2370,  2377,  2384,  2391,  2396,  2403,  2409,  2413,  2418,  2421,  2427,
-    2431,  2436,  2442,  2448,  2452,  2460,  2464,  2467,  2471,  2477,  2483,  2489,  2497,
-    2503,  2510,  2518,  2526,  2530,  2537,  2543,  2547,  2553,  2558,  2565,  2571,  2577,
-    2583,  2590,  2594,  2600,  2606,  2613,  2618,  2624,  2630,  2638,  2644,  2650,  2654,
-    2661,  2668,  2674,  2680,  2687,  2693,  2699,  2706,  2710,  2717,  2722,  2726,  2732,
-    2736,  2742,  2749,  2756,  2763,  2769,  2777,  2783,  2787,  2795,  2803,  2810,  2814,
-    2821,  2829,  2836,  2844,  2850,  2856,  2863,  2868,  2874,  2882,  2885,  2889,  2896,
-    2902,  2908,  2914,  2919,  2923,  2927,  2933,  2937,  2942,  2948,  2953,  2960,  2964,
-    2969,  2974,  2979,  2984,  2989,  2993,  2998,  3002,  3006,  3009,  3013,  3017,  3021,
-    3027,  3031,  3036,  3040,  3045,  3052,  3057,  3062,  3067,  3071,  3076,  3082,  3086,
-    3090,  3094,  3101,  3108,  3112,  3116,  3123,  3129,  3132,  3137,  3143,  3148,  3153,
-    3161,  3168,  3175,  3183,  3191,  3196,  3200,  3206,  3212,  3219,  3225,  3232,  3238,
-    3245,  3250,  3256,  3261,  3264,  3271,  3278,  3283,  3289,  3296,  3302,  3308,  3315,
-    3320,  3326,  3332,  3338,  3344,  3350,  3355,  3361,  3366,  3374,  3381,  3386,  3391,
-    3394,  3399,  3404,  3411,  3416,  3421,  3427,  3432,  3439,  3445,  3452,  3458,  3466,
-    3470,  3475,  3481,  3486,  3493,  3499,  3507,  3513,  3520,  3526,  3533,  3541,  3548,
-    3555,  3560,  3565,  3569,  3575,  3581,  3587,  3593,  3600,  3606,  3613,  3619,  3624,
-    3627,  3634,  3640,  3644,  3651,  3655,  3660,  3665,  3669,  3674,  3678,  3684,  3690,
-    3693,  3698,  3705,  3709,  3716,  3719,  3724,  3730,  3737,  3742,  3750,  3757,  3765,
-    3772,  3775,  3779,  3783,  3789,  3794,  3802,  3807,  3812,  3815,  3820,  3827,  3832,
-    3838,  3842,  3846,  3852,  3857,  3861,  3865,  3871,  3877,  3881,  3885,  3890,  3896,
-    3900,  3903,  3910,  3913,  3917,  3922,  3927,  3931,  3937,  3941,  3947,  3951,  3956,
-    3961,  3966,  3972,  3977,  3982,  3985,  3989,  3994,  3997,  4001,  4005,  4011,  4015,
-    4019,  4024,  4030,  4036,  4040,  4047,  4052,  4059,  4065,  4071,  4076,  4079,  4086,
-    4091,  4099,  4104,  4110,  4116,  4120,  4125,  4130,  4135,  4141,  4146,  4150,  4153,
-    4158,  4165,  4169,  4175,  4181,  4185,  4191,  4198,  4202,  4205,  4211,  4218,  4224,
-    4230,  4237,  4240,  4244,  4248,  4254,  4259,  4263,  4270,  4276,  4281,  4287,  4294,
-    4301,  4306,  4311,  4315,  4321,  4327,  4334,  4338,  4342,  4346,  4352,  4357,  4362,
-    4367,  4374,  4379,  4384,  4389,  4394,  4398,  4402,  4406,  4413,  4417,  4421,  4426,
-    4433,  4439,  4445,  4451,  4455,  4459,  4464,  4469,  4474,  4479,  4484,  4491,  4496,
-    4501,  4505,  4510,  4514,  4521,  4526,  4530,  4535,  4540,  4545,  4550,  4555,  4561,
-    4564,  4567,  4572,  4576,  4580,  4586,  4593,  4597,  4602,  4608,  4612,  4617,  4624,
-    4627,  4631,  4635,  4641,  4645,  4651,  4656,  4661,  4669,  4675,  4680,  4686,  4690,
-    4693,  4697,  4703,  4707,  4711,  4715,  4718,  4722,  4729,  4734,  4740,  4744,  4748,
-    4755,  4761,  4765,  4770,  4774,  4778,  4782,  4788,  4793,  4801,  4805,  4810,  4814,
-    4819,  4822,  4826,  4831,  4837,  4842,  4849,  4855,  4859,  4865,  4870,  4874,  4881,
-    4887,  4890,  4894,  4898,  4906,  4910,  4916,  4919,  4926,  4933,  4938,  4945,  4952,
-    4958,  4964,  4970,  4977,  4984,  4988,  4995,  5001,  5009,  5014,  5022,  5028,  5036,
-    5042,  5049,  5055,  5061,  5068,  5075,  5081,  5087,  5093,  5098,  5106,  5111,  5118,
-    5124,  5130,  5136,  5143,  5150,  5156,  5164,  5168,  5174,  5180,  5187,  5191,  5197,
-    5204,  5209,  5213,  5218,  5224,  5230,  5233,  5237,  5244,  5249,  5254,  5259,  5262,
-    5266,  5270,  5277,  5280,  5285,  5290,  5294,  5300,  5306,  5310,  5314,  5322,  5326,
-    5330,  5337,  5340,  5344,  5347,  5353,  5357,  5364,  5368,  5371,  5378,  5382,  5388,
-    5392,  5396,  5401,  5406,  5410,  5413,  5418,  5423,  5429,  5433,  5437,  5441,  5449,
-    5455,  5460,  5465,  5470,  5475,  5482,  5486,  5489,  5493,  5500,  5505,  5509,  5515,
-    5519,  5524,  5529,  5536,  5540,  5543,  5548,  5554,  5561,  5566,  5570,  5576,  5580,
-    5587,  5593,  5599,  5604,  5608,  5615,  5622,  5629,  5633,  5637,  5642,  5646,  5650,
-    5655,  5659,  5663,  5669,  5673,  5679,  5683,  5689,  5693,  5697,  5704,  5709,  5713,
-    5718,  5724,  5728,  5732,  5739,  5743,  5749,  5753,  5758,  5763,  5770,  5776,  5781,
-    5786,  5792,  5798,  5805,  5808,  5813,  5819,  5823,  5827,  5831,  5836,  5840,  5846,
-    5849,  5855,  5862,  5867,  5874,  5880,  5885,  5891,  5896,  5902,  5908,  5914,  5922,
-    5926,  5930,  5936,  5941,  5949,  5953,  5959,  5965,  5972,  5976,  5982,  5986,  5993,
-    5997,  6005,  6010,  6015,  6021,  6025,  6031,  6037,  6044,  6048,  6053,  6058,  6063,
-    6068,  6072,  6079,  6084,  6090,  6096,  6104,  6108,  6115,  6120,  6124,  6131,  6136,
-    6142,  6149,  6155,  6161,  6165,  6172,  6175,  6180,  6187,  6193,  6198,  6204,  6207,
-    6213,  6220,  6226,  6233,  6238,  6242,  6247,  6251,  6258,  6266,  6272,  6278,  6283,
-    6291,  6296,  6300,  6305,  6309,  6315,  6319,  6327,  6333,  6339,  6347,  6352,  6356,
-    6362,  6368,  6375,  6379,  6384,  6388,  6394,  6400,  6405,  6411,  6417,  6421,  6425,
-    6429,  6437,  6444,  6451,  6457,  6462,  6466,  6469,  6476,  6483,  6488,  6492,  6496,
-    6500,  6505,  6510,  6515,  6522,  6528,  6534,  6539,  6543,  6550,  6554,  6561,  6567,
-    6572,  6575,  6582,  6588,  6593,  6596,  6599,  6603,  6609,  6615,  6622,  6629,  6635,
-    6642,  6647,  6652,  6659,  6663,  6666,  6671,  6677,  6682,  6685,  6689,  6692,  6697,
-    6704,  6708,  6712,  6715,  6720,  6726,  6730,  6734,  6739,  6746,  6752,  6758,  6764,
-    6769,  6776,  6781,  6789,  6794,  6800,  6808,  6814,  6821,  6826,  6833,  6838,  6844,
-    6851,  6855,  6859,  6863,  6866,  6871,  6877,  6883,  6888,  6892,  6898,  6902,  6906,
-    6912,  6916,  6921,  6926,  6931,  6938,  6943,  6949,  6955,  6959,  6965,  6970,  6974,
-    6979,  6983,  6990,  6996,  7003,  7008,  7012,  7019,  7024,  7030,  7034,  7041,  7048,
-    7051,  7058,  7064,  7070,  7076,  7083,  7089,  7095,  7098,  7103,  7108,  7114,  7122,
-    7127,  7133,  7140,  7145,  7148,  7154,  7158,  7163,  7167,  7174,  7178,  7184,  7189,
-    7194,  7199,  7205,  7212,  7217,  7221,  7227,  7233,  7238,  7242,  7248,  7252,  7256,
-    7261,  7266,  7270,  7276,  7280,  7284,  7288,  7295,  7302,  7310,  7318,  7322,  7328,
-    7335,  7342,  7348,  7353,  7361,  7367,  7374,  7380,  7387,  7394,  7400,  7407,  7412,
-    7417,  7424,  7429,  7437,  7443,  7450,  7455,  7462,  7469,  7476,  7482,  7489,  7496,
-    7503,  7508,  7516,  7523,  7530,  7535,  7542,  7548,  7555,  7559,  7563,  7568,  7575,
-    7580,  7585,  7590,  7598,  7604,  7611,  7616,  7620,  7623,  7629,  7636,  7643,  7650,
-    7657,  7665,  7670,  7674,  7678,  7683,  7689,  7696,  7700,  7704,  7709,  7714,  7718,
-    7722,  7727,  7732,  7736,  7741,  7747,  7752,  7757,  7761,  7765,  7771,  7776,  7779,
-    7784,  7789,  7793,  7799,  7804,  7811,  7817,  7824,  7830,  7836,  7843,  7849,  7856,
-    7862,  7868,  7874,  7880,  7887,  7893,  7898,  7905,  7911,  7915,  7921,  7929,  7935,
-    7941,  7947,  7952,  7956,  7962,  7968,  7974,  7981,  7987,  7994,  8000,  8008,  8014,
-    8022,  8030,  8036,  8042,  8049,  8055,  8062,  8068,  8074,  8080,  8086,  8089,  8095,
-    8099,  8103,  8107,  8112,  8117,  8122,  8127,  8131,  8135,  8141,  8145,  8151,  8156,
-    8161,  8165,  8170,  8175,  8181,  8187,  8194,  8198,  8204,  8208,  8212,  8218,  8223,
-    8228,  8233,  8238,  8244,  8248,  8251,  8255,  8258,  8264,  8269,  8272,  8278,  8285,
-    8289,  8293,  8298,  8304,  8309,  8313,  8319,  8323,  8329,  8333,  8340,  8347,  8352,
-    8359,  8363,  8366,  8371,  8375,  8380,  8387,  8392,  8398,  8404,  8411,  8419,  8427,
-    8432,  8437,  8443,  8449,  8454,  8457,  8463,  8469,  8473,  8479,  8485,  8492,  8500,
-    8504,  8508,  8515,  8521,  8525,  8532,  8538,  8543,  8551,  8557,  8564,  8571,  8577,
-    8582,  8587,  8593,  8598,  8605,  8610,  8614,  8619,  8626,  8632,  8637,  8642,  8646,
-    8652,  8657,  8661,  8666,  8670,  8675,  8683,  8688,  8694,  8699,  8706,  8709,  8716,
-    8720,  8724,  8729,  8734,  8738,  8744,  8748,  8753,  8759,  8766,  8772,  8777,  8781,
-    8786,  8792,  8799,  8802,  8806,  8811,  8817,  8820,  8825,  8829,  8834,  8839,  8843,
-    8847,  8852,  8859,  8864,  8869,  8875,  8879,  8885,  8889,  8893,  8898,  8903,  8908,
-    8913,  8918,  8924,  8929,  8934,  8938,  8943,  8947,  8951,  8957,  8963,  8967,  8971,
-    8975,  8980,  8987,  8992,  9000,  9005,  9012,  9016,  9020,  9025,  9029,  9033,  9038,
-    9042,  9048,  9053,  9058,  9063,  9070,  9075,  9080,  9087,  9092,  9097,  9102,  9108,
-    9113,  9119,  9124,  9128,  9134,  9139,  9144,  9151,  9156,  9161,  9165,  9170,  9176,
-    9182,  9185,  9191,  9198,  9206,  9212,  9219,  9224,  9229,  9235,  9240,  9245,  9250,
-    9255,  9259,  9264,  9269,  9273,  9277,  9283,  9288,  9293,  9298,  9303,  9310,  9315,
-    9320,  9325,  9330,  9338,  9344,  9350,  9356,  9364,  9371,  9376,  9383,  9388,  9395,
-    9401,  9407,  9414,  9418,  9424,  9430,  9435,  9442,  9446,  9452,  9455,  9460,  9466,
-    9471,  9477,  9484,  9488,  9495,  9500,  9508,  9516,  9522,  9529,  9536,  9543,  9548,
-    9552,  9557,  9562,  9567,  9572,  9576,  9581,  9587,  9592,  9598,  9605,  9610,  9616,
-    9621,  9627,  9630,  9634,  9640,  9644,  9648,  9652,  9658,  9662,  9667,  9673,  9677,
-    9682,  9686,  9690,  9693,  9699,  9705,  9709,  9713,  9717,  9721,  9726,  9730,  9735,
-    9739,  9745,  9750,  9754,  9759,  9763,  9770,  9775,  9781,  9786,  9791,  9798,  9804,
-    9808,  9813,  9817,  9823,  9827,  9831,  9834,  9839,  9845,  9850,  9855,  9862,  9867,
-    9874,  9877,  9885,  9891,  9896,  9902,  9910,  9914,  9920,  9927,  9931,  9936,  9939,
-    9944,  9950,  9955,  9962,  9970,  9974,  9979,  9986,  9992,  9997,  10001, 10004, 10009,
-    10014, 10021, 10027, 10032, 10040, 10044, 10049, 10055, 10059, 10064, 10068, 10073, 10078,
-    10083, 10088, 10095, 10099, 10103, 10109, 10116, 10121, 10125, 10130, 10137, 10142, 10147,
-    10150, 10154, 10161, 10167, 10171, 10177, 10183, 10187, 10193, 10199, 10205, 10210, 10214,
-    10219, 10222, 10226, 10233, 10237, 10245, 10251, 10258, 10263, 10270, 10275, 10279, 10285,
-    10291, 10298, 10305, 10311, 10315, 10323, 10330, 10336, 10341, 10348, 10354, 10360, 10367,
-    10373, 10377, 10382, 10387, 10392, 10396, 10401, 10404, 10408, 10414, 10421, 10426, 10433,
-    10439, 10445, 10450, 10455, 10461, 10466, 10469, 10475, 10480, 10487, 10491, 10496, 10503,
-    10509, 10515, 10522, 10527, 10531, 10537, 10544, 10548, 10554, 10561, 10567, 10574, 10581,
-    10588, 10593, 10597, 10604, 10611, 10617, 10624, 10629, 10633, 10638, 10644, 10649, 10654,
-    10659, 10664, 10668, 10675, 10681, 10685, 10691, 10695, 10700, 10704, 10708, 10712, 10718,
-    10722, 10729, 10733, 10740, 10744, 10748, 10753, 10758, 10762, 10765, 10771, 10777, 10781,
-    10787, 10794, 10797, 10804, 10811, 10816, 10823, 10827, 10830, 10835, 10839, 10844, 10849,
-    10853, 10858, 10862, 10869, 10873, 10878, 10882, 10886, 10890, 10893, 10899, 10903, 10907,
-    10911, 10917, 10923, 10927, 10933, 10937, 10941, 10948, 10952, 10957, 10963, 10967, 10971,
-    10975, 10979, 10984, 10989, 10994, 10998, 11003, 11010, 11015, 11020, 11025, 11029, 11033,
-    11039, 11042, 11047, 11052, 11057, 11061, 11065, 11068};
+unsigned short const BIP39_WORDLIST_PREFIX_INDEX_FRENCH[] = {
+    0,     0,     18,    38,    52,    54,    59,    66,    66,    71,    73,    73,    88,
+    101,   121,   121,   129,   131,   148,   159,   167,   175,   188,   188,   190,   190,
+    190,   217,   217,   217,   217,   229,   229,   229,   229,   245,   245,   245,   253,
+    253,   253,   275,   275,   275,   295,   295,   295,   305,   305,   305,   305,   305,
+    305,   351,   351,   351,   351,   364,   364,   364,   392,   404,   404,   404,   416,
+    416,   416,   462,   462,   462,   481,   481,   481,   492,   492,   492,   492,   496,
+    496,   501,   501,   501,   501,   556,   556,   556,   556,   576,   576,   576,   576,
+    576,   576,   598,   598,   598,   603,   603,   603,   607,   607,   607,   607,   608,
+    608,   608,   609,   626,   628,   628,   634,   636,   636,   636,   637,   637,   648,
+    661,   695,   696,   711,   713,   717,   731,   749,   750,   757,   757,   781,   781,
+    781,   801,   801,   801,   801,   816,   816,   816,   816,   834,   834,   834,   847,
+    847,   847,   861,   861,   861,   881,   881,   881,   888,   888,   888,   888,   888,
+    888,   898,   898,   898,   898,   912,   912,   912,   912,   916,   916,   916,   922,
+    922,   922,   933,   933,   933,   951,   951,   951,   957,   957,   957,   957,   959,
+    959,   969,   969,   969,   969,   977,   977,   977,   977,   982,   982,   982,   982,
+    982,   982,   995,   995,   995,   995,   995,   995,   1002,  1002,  1002,  1002,  1006,
+    1006,  1006,  1006,  1006,  1007,  1007,  1007,  1009,  1009,  1009,  1009,  1009,  1011,
+    1023,  1063,  1063,  1063,  1063,  1067,  1068,  1068,  1068,  1070,  1070,  1070,  1070,
+    1070,  1078,  1078,  1078,  1078,  1082,  1082,  1082,  1082,  1082,  1082,  1082,  1082,
+    1082,  1082,  1091,  1091,  1091,  1091,  1091,  1091,  1099,  1099,  1099,  1099,  1099,
+    1099,  1100,  1100,  1100,  1100,  1100,  1100,  1100,  1100,  1102,  1102,  1102,  1102,
+    1102,  1102,  1102,  1102,  1102,  1102,  1102,  1102,  1102,  1102,  1102,  1102,  1102,
+    1102,  1123,  1123,  1123,  1123,  1132,  1132,  1132,  1132,  1156,  1156,  1156,  1156,
+    1156,  1156,  1166,  1166,  1166,  1166,  1166,  1166,  1178,  1178,  1178,  1178,  1178,
+    1178,  1216,  1216,  1216,  1216,  1242,  1242,  1242,  1242,  1259,  1259,  1259,  1259,
+    1259,  1259,  1281,  1281,  1281,  1281,  1281,  1281,  1292,  1292,  1292,  1292,  1296,
+    1296,  1306,  1306,  1306,  1306,  1318,  1318,  1318,  1318,  1322,  1322,  1322,  1322,
+    1322,  1322,  1339,  1339,  1339,  1339,  1339,  1339,  1347,  1347,  1347,  1347,  1347,
+    1347,  1347,  1355,  1362,  1364,  1364,  1367,  1368,  1368,  1370,  1370,  1370,  1372,
+    1374,  1378,  1378,  1386,  1386,  1397,  1400,  1401,  1406,  1407,  1407,  1409,  1409,
+    1410,  1446,  1446,  1446,  1446,  1472,  1472,  1472,  1478,  1493,  1493,  1493,  1507,
+    1507,  1507,  1536,  1536,  1536,  1566,  1567,  1567,  1577,  1577,  1577,  1577,  1578,
+    1578,  1578,  1578,  1578,  1578,  1578,  1578,  1578,  1578,  1578,  1578,  1578,  1578,
+    1578,  1578,  1578,  1578,  1578,  1578,  1578,  1578,  1584,  1584,  1584,  1584,  1584,
+    1584,  1599,  1599,  1599,  1599,  1661,  1661,  1661,  1661,  1673,  1673,  1673,  1673,
+    1673,  1673,  1688,  1688,  1688,  1688,  1688,  1688,  1697,  1697,  1697,  1697,  1698,
+    1698,  1721,  1721,  1732,  1732,  1761,  1761,  1761,  1761,  1776,  1776,  1777,  1777,
+    1777,  1777,  1804,  1809,  1809,  1809,  1809,  1818,  1837,  1837,  1837,  1837,  1843,
+    1843,  1864,  1864,  1864,  1864,  1876,  1876,  1876,  1880,  1889,  1889,  1889,  1889,
+    1889,  1889,  1907,  1907,  1907,  1930,  1930,  1930,  1938,  1938,  1938,  1938,  1942,
+    1942,  1942,  1943,  1943,  1943,  1943,  1943,  1943,  1943,  1943,  1943,  1943,  1945,
+    1945,  1951,  1951,  1951,  1951,  1954,  1958,  1960,  1960,  1960,  1960,  1960,  1960,
+    1960,  1978,  1978,  1978,  1978,  2000,  2000,  2000,  2000,  2026,  2026,  2026,  2026,
+    2026,  2026,  2041,  2041,  2041,  2041,  2041,  2041,  2041,  2041,  2041,  2041,  2041,
+    2041,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,
+    2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,  2042,
+    2042,  2042,  2042,  2042,  2042,  2043,  2043,  2043,  2043,  2043,  2043,  2043,  2043,
+    2043,  2043,  2043,  2043,  2043,  2043,  2043,  2043,  2043,  2043,  2043,  2043,  2043,
+    2043,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,
+    2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,  2044,
+    2044,  2044,  2044,  2044,  2044,  2047,  2047,  2047,  2047,  2047,  2047,  2047,  2047,
+    2047,  2047,  2048,  2048,  2048,  2048,  2048,  2048,  2048,  2048,  2048,  2048,  2048,
+    2048};
+
+unsigned long long const BIP39_TRIE_FRENCH[] = {
+    0x0018FFFFFFFFFFFFULL, 0x0182FEEDF8BFBB7EULL, 0x02B0492444124911ULL, 0x0324492645124991ULL,
+    0x03B0490445124111ULL, 0x0412BEE1B0BFFA6EULL, 0x04F0492444124911ULL, 0x0564492445124911ULL,
+    0x05E4410445104111ULL, 0x064088E100263848ULL, 0x06A0410044104011ULL, 0x06E0000400000101ULL,
+    0x06F0410444104111ULL, 0x0744410445104111ULL, 0x07A0410444104111ULL, 0x07F25AE4BABEB96EULL,
+    0x08C0492645164991ULL, 0x0940400000100000ULL, 0x0950410445104111ULL, 0x09A463045518C515ULL,
+    0x0A34490645124191ULL, 0x0AB038A0000E2802ULL, 0x0B00010444004111ULL, 0x0B40000040004010ULL,
+    0x0B50190005164019ULL, 0x0B902006140B4195ULL, 0x0BE0094840325290ULL, 0x0C30080000020000ULL,
+    0x0C40000080000020ULL, 0x0C50080400020111ULL, 0x0000000000041848ULL, 0x0000000000104000ULL,
+    0x0C7000250028C955ULL, 0x0CA003044810C113ULL, 0x0CF0218104886155ULL, 0x0D4002000000C811ULL,
+    0x0D50400000100000ULL, 0x0D602840280E984AULL, 0x0DB03200000C8000ULL, 0x0DE02800000A4010ULL,
+    0x0E002000280A004AULL, 0x0E30010444024111ULL, 0x0E70000400000100ULL, 0x0E8038A1003E3968ULL,
+    0x0EE01820001E2800ULL, 0x0F101120020C6A0EULL, 0x0F40010004004111ULL, 0x0F604884089A2902ULL,
+    0x0FB0410444104111ULL, 0x1000A800002E0920ULL, 0x1030DAE42836B92EULL, 0x10E008A000062908ULL,
+    0x1110010444124911ULL, 0x11502881002A3040ULL, 0x1190010404004101ULL, 0x11C05AE4391EB9EEULL,
+    0x1270410445104111ULL, 0x12C0082400029912ULL, 0x0000000000002805ULL, 0x12F0008000103100ULL,
+    0x1300BAE1B82EBA7EULL, 0x13D0984104265865ULL, 0x143058C0111EB144ULL, 0x1490000004004111ULL,
+    0x14A00A0000028000ULL, 0x14C0492200124881ULL, 0x0000000000100100ULL, 0x1510000080000020ULL,
+    0x1520000004000001ULL, 0x1530400444104111ULL, 0x157003000810D112ULL, 0x15A0A889B23E2B7CULL,
+    0x1630080404124101ULL, 0x1660400000100000ULL, 0x0000000000124100ULL, 0x16703200000D8004ULL,
+    0x16A0090244124191ULL, 0x16F0010404004111ULL, 0x172022065419C195ULL, 0x1790E840183E1906ULL,
+    0x180048400036780EULL, 0x183000A01086684DULL, 0x1860410044104011ULL, 0x18A0488000162800ULL,
+    0x18D0010444104111ULL, 0x19100800000E0140ULL, 0x1928082002021840ULL, 0x195009A001066801ULL,
+    0x0000000000220006ULL, 0x1990010004004101ULL, 0x19B0480000123800ULL, 0x19D0410404104111ULL,
+    0x1A10000440040110ULL, 0x0000000000021000ULL, 0x1A30088000063806ULL, 0x1A50080000161800ULL,
+    0x1A60000008240802ULL, 0x1A7048C000123000ULL, 0x1AB0004000021102ULL, 0x0000000000009048ULL,
+    0x0000000000102000ULL, 0x1AC0002000000800ULL, 0x1AD0024000009103ULL, 0x1AF0B10AF03C62FCULL,
+    0x1B90080000024000ULL, 0x0000000000024000ULL, 0x1BA0400000323140ULL, 0x1BB0600000180000ULL,
+    0x1BD4408001302100ULL, 0x00000000002EA042ULL, 0x0000000000005000ULL, 0x1C0088C41832B146ULL,
+    0x1C70000102AC0044ULL, 0x1C8030C1582D7057ULL, 0x1D00400401181140ULL, 0x1D200080108A3156ULL,
+    0x1D4078A5009E3B44ULL, 0x1DC038E0301E390CULL, 0x1E4008A100863855ULL, 0x1E806880001B201AULL,
+    0x1EC03800000E2800ULL, 0x1EF00800000E0000ULL, 0x1F006800003A8040ULL, 0x1F304001003A0166ULL,
+    0x1F50000010280004ULL, 0x1F60E044103A1106ULL, 0x1FC0000404099101ULL, 0x1FE03000000C0A10ULL,
+    0x2000200010180014ULL, 0x0000000000004010ULL, 0x2020000080000020ULL, 0x2030100000040000ULL,
+    0x0000000000000120ULL, 0x0000000000000012ULL, 0x000000000000011CULL, 0x2040220004088111ULL,
+    0x207000010409215BULL, 0x0000000000041004ULL, 0x20902800002A0000ULL, 0x20B4000001000000ULL,
+    0x20C4BAA0012EA900ULL, 0x21402AA4001EA900ULL, 0x21A0010001024001ULL, 0x21B0100042A7A815ULL,
+    0x21D0410044104111ULL, 0x221070E4401E3914ULL, 0x2290410444104111ULL, 0x22E000A00202A906ULL,
+    0x2300000440004111ULL, 0x23208024112C994CULL, 0x2360F2E9B43DBB6DULL, 0x24409001002CA05CULL,
+    0x247070C0011C3004ULL, 0x24C0100408040156ULL, 0x24F0C8A0083A3966ULL, 0x2550000444124191ULL,
+    0x258088C030A7BB0DULL, 0x25E000A1400EB878ULL, 0x262048E0101E390CULL, 0x2680000004000191ULL,
+    0x2690400405120111ULL, 0x26C00A0018068966ULL, 0x270000C000043800ULL, 0x27206860089FB906ULL,
+    0x278008C0008A3000ULL, 0x27B0000040004010ULL, 0x27C02800000E1012ULL, 0x27E04880009AB802ULL,
+    0x2810010444004111ULL, 0x28502000010A3900ULL, 0x2860020000029000ULL, 0x2870200000080000ULL,
+    0x2880000400000101ULL, 0x0000000000080003ULL, 0x2890400000100101ULL, 0x0000000000004100ULL,
+    0x28A010251006B944ULL, 0x28F22880008E29CCULL, 0x2930B821242EE84DULL, 0x29B40824011A0944ULL,
+    0x0000000000042002ULL, 0x0000000000002100ULL, 0x0000000001120800ULL, 0x0000000000104111ULL,
+    0x0000000000104010ULL, 0x0000000000020208ULL, 0x0000000000124811ULL, 0x0000000000000011ULL,
+    0x0000000000000018ULL, 0x0000000000100110ULL, 0x0000000000018000ULL, 0x0000000000100010ULL,
+    0x0000000000000110ULL, 0x0000000000128000ULL, 0x0000000000004010ULL, 0x0000000000004010ULL,
+    0x0000000000120111ULL, 0x0000000000080800ULL, 0x0000000000100011ULL, 0x0000000000100010ULL,
+    0x0000000000001010ULL, 0x0000000000104110ULL, 0x0000000000020100ULL, 0x0000000000022000ULL,
+    0x0000000000020008ULL, 0x0000000000320000ULL, 0x0000000000000880ULL, 0x00000000000A8800ULL,
+    0x0000000000104800ULL, 0x0000000000104010ULL, 0x0000000000023008ULL, 0x0000000000000110ULL,
+    0x0000000000104011ULL, 0x0000000000000011ULL, 0x0000000000100100ULL, 0x0000000000004010ULL,
+    0x0000000000104011ULL, 0x0000000000004101ULL, 0x0000000000000110ULL, 0x0000000000000190ULL,
+    0x0000000000104111ULL, 0x0000000000120100ULL, 0x0000000000004100ULL, 0x0000000000020111ULL,
+    0x0000000000000011ULL, 0x0000000000000101ULL, 0x0000000000024000ULL, 0x0000000000022800ULL,
+    0x0000000000122000ULL, 0x0000000000044009ULL, 0x0000000000100100ULL, 0x0000000000004001ULL,
+    0x0000000000100001ULL, 0x0000000000000115ULL, 0x000000000001280CULL, 0x0000000000034102ULL,
+    0x00000000000C0000ULL, 0x0000000000080011ULL, 0x0000000000004110ULL, 0x0000000000001844ULL,
+    0x0000000000004001ULL, 0x0000000000000901ULL, 0x0000000000088800ULL, 0x0000000000084004ULL,
+    0x0000000000002060ULL, 0x0000000000112000ULL, 0x0000000000000101ULL, 0x0000000000060000ULL,
+    0x000000000010018AULL, 0x0000000000002008ULL, 0x00000000000F0854ULL, 0x0000000000242000ULL,
+    0x0000000000100006ULL, 0x0000000000014844ULL, 0x000000000110200CULL, 0x00000000010C1000ULL,
+    0x0000000000000110ULL, 0x0000000000004100ULL, 0x0000000000000011ULL, 0x0000000000000101ULL,
+    0x0000000000020010ULL, 0x0000000000040800ULL, 0x0000000000205114ULL, 0x0000000000008111ULL,
+    0x0000000000184011ULL, 0x00000000001E4001ULL, 0x00000000000A6113ULL, 0x0000000000050104ULL,
+    0x00000000000C0000ULL, 0x0000000000000111ULL, 0x0000000000000810ULL, 0x00000000000C0008ULL,
+    0x0000000000202114ULL, 0x00000000003EB940ULL, 0x0000000000233000ULL, 0x0000000000005070ULL,
+    0x0000000000140104ULL, 0x0000000000004001ULL, 0x0000000000080010ULL, 0x0000000000010014ULL,
+    0x0000000000024010ULL, 0x0000000000251100ULL, 0x0000000000201050ULL, 0x000000000000A004ULL,
+    0x0000000000020001ULL, 0x0000000000004001ULL, 0x0000000000000110ULL, 0x0000000000002020ULL,
+    0x0000000000005910ULL, 0x0000000000009012ULL, 0x00000000002C206CULL, 0x0000000000000101ULL,
+    0x00000000000AA00BULL, 0x0000000000081000ULL, 0x00000000002A8008ULL, 0x0000000001200102ULL,
+    0x0000000000301009ULL, 0x00000000000C0012ULL, 0x0000000000090100ULL, 0x0000000000000014ULL,
+    0x0000000000240800ULL, 0x0000000000081000ULL, 0x0000000000040001ULL, 0x0000000000040040ULL,
+    0x0000000000124101ULL, 0x0000000000124991ULL, 0x0000000000100001ULL, 0x0000000000020110ULL,
+    0x0000000000020901ULL, 0x0000000000004100ULL, 0x0000000000004011ULL, 0x0000000000184100ULL,
+    0x0000000000004891ULL, 0x0000000000004001ULL, 0x00000000000C4115ULL, 0x0000000000024011ULL,
+    0x0000000000004111ULL, 0x0000000000001802ULL, 0x0000000000002110ULL, 0x0000000000000101ULL,
+    0x0000000000000110ULL, 0x00000000000C8004ULL, 0x0000000000000110ULL, 0x0000000000080100ULL,
+    0x0000000000008101ULL, 0x0000000000002201ULL, 0x0000000000180000ULL, 0x0000000000040011ULL,
+    0x0000000000080007ULL, 0x0000000000008040ULL, 0x0000000000000810ULL, 0x0000000000000005ULL,
+    0x0000000000000011ULL, 0x0000000000104101ULL, 0x0000000000122800ULL, 0x0000000000004111ULL,
+    0x0000000000021000ULL, 0x0000000000124111ULL, 0x0000000000020800ULL, 0x0000000000020002ULL,
+    0x0000000000208044ULL, 0x0000000000080040ULL, 0x000000000000000CULL, 0x0000000000020011ULL,
+    0x0000000000180000ULL, 0x0000000000024810ULL, 0x0000000000004881ULL, 0x0000000000124100ULL,
+    0x0000000000004011ULL, 0x0000000000000901ULL, 0x0000000000000011ULL, 0x0000000000100010ULL,
+    0x0000000000004100ULL, 0x0000000000024111ULL, 0x0000000000004101ULL, 0x00000000001A0100ULL,
+    0x00000000000C281CULL, 0x0000000000004010ULL, 0x0000000000000110ULL, 0x0000000000024111ULL,
+    0x0000000000004111ULL, 0x0000000000024100ULL, 0x0000000000082840ULL, 0x0000000000022100ULL,
+    0x0000000000002101ULL, 0x0000000000102120ULL, 0x0000000000004001ULL, 0x0000000000040800ULL,
+    0x0000000000080008ULL, 0x0000000000010800ULL, 0x0000000000100044ULL, 0x0000000000100910ULL,
+    0x0000000000021004ULL, 0x0000000000004001ULL, 0x0000000000040840ULL, 0x0000000000024810ULL,
+    0x0000000000020010ULL, 0x0000000000100800ULL, 0x0000000000080110ULL, 0x0000000000000110ULL,
+    0x0000000000004124ULL, 0x0000000000000101ULL, 0x0000000000080004ULL, 0x0000000000004010ULL,
+    0x0000000000101000ULL, 0x0000000000205000ULL, 0x0000000000080100ULL, 0x0000000000080010ULL,
+    0x0000000000085911ULL, 0x0000000000000101ULL, 0x00000000000C1100ULL, 0x0000000000900005ULL,
+    0x0000000000020004ULL, 0x0000000000200104ULL, 0x0000000000080048ULL, 0x0000000000081044ULL,
+    0x0000000000020948ULL, 0x000000000100A140ULL, 0x0000000000023940ULL, 0x0000000000240005ULL,
+    0x0000000000083100ULL, 0x0000000000080110ULL, 0x0000000000000011ULL, 0x0000000000022009ULL,
+    0x0000000000004010ULL, 0x0000000000100001ULL, 0x0000000000084118ULL, 0x0000000000001800ULL,
+    0x0000000000001001ULL, 0x0000000000000104ULL, 0x0000000000020102ULL, 0x0000000000000140ULL,
+    0x00000000000A8828ULL, 0x000000000028A128ULL, 0x0000000000001820ULL, 0x0000000000182040ULL,
+    0x0000000001080040ULL, 0x0000000000028000ULL, 0x0000000000081008ULL, 0x0000000000002040ULL,
+    0x0000000000009100ULL, 0x0000000000005102ULL, 0x0000000000004010ULL, 0x0000000000005001ULL,
+    0x0000000000086000ULL, 0x0000000000021908ULL, 0x0000000000040800ULL, 0x0000000000004103ULL,
+    0x0000000000100100ULL, 0x0000000000104010ULL, 0x0000000000124811ULL, 0x0000000000004911ULL,
+    0x0000000000100110ULL, 0x0000000000808008ULL, 0x0000000000104900ULL, 0x0000000000000101ULL,
+    0x0000000000100010ULL, 0x0000000000002004ULL, 0x000000000018C114ULL, 0x0000000000120111ULL,
+    0x0000000000004111ULL, 0x0000000000000111ULL, 0x0000000000002040ULL, 0x0000000000004001ULL,
+    0x0000000000002008ULL, 0x0000000000000044ULL, 0x0000000000020110ULL, 0x0000000000000011ULL,
+    0x0000000000004110ULL, 0x0000000000080010ULL, 0x00000000000C2000ULL, 0x0000000000008012ULL,
+    0x0000000000080044ULL, 0x0000000000001040ULL, 0x0000000000004001ULL, 0x0000000000100011ULL,
+    0x0000000000020010ULL, 0x0000000000004010ULL, 0x0000000000200040ULL, 0x0000000000104001ULL,
+    0x000000000000C110ULL, 0x0000000000000050ULL, 0x0000000000080100ULL, 0x0000000000080180ULL,
+    0x0000000000042000ULL, 0x00000000002A0010ULL, 0x0000000000020100ULL, 0x0000000000000009ULL,
+    0x0000000000000111ULL, 0x0000000000062840ULL, 0x0000000000000991ULL, 0x0000000000190108ULL,
+    0x00000000000B010FULL, 0x0000000000040004ULL, 0x0000000000020110ULL, 0x0000000000240008ULL,
+    0x0000000000004080ULL, 0x0000000000100111ULL, 0x0000000000004001ULL, 0x0000000000004002ULL,
+    0x00000000000C0091ULL, 0x0000000000000904ULL, 0x0000000000140000ULL, 0x0000000000000191ULL,
+    0x0000000000022000ULL, 0x0000000000000900ULL, 0x0000000000104114ULL, 0x0000000000004001ULL,
+    0x00000000001C6108ULL, 0x00000000000C0004ULL, 0x0000000000000110ULL, 0x00000000002C0824ULL,
+    0x0000000000001011ULL, 0x0000000000000114ULL, 0x0000000000100011ULL, 0x0000000000080100ULL,
+    0x0000000000030000ULL, 0x0000000000100101ULL, 0x0000000000080020ULL, 0x0000000000004801ULL,
+    0x00000000000A0000ULL, 0x0000000000000480ULL, 0x0000000000080100ULL, 0x0000000000060000ULL,
+    0x0000000000001003ULL, 0x0000000000004101ULL, 0x0000000000220000ULL, 0x0000000000000111ULL,
+    0x0000000000002040ULL, 0x0000000000060000ULL, 0x0000000000080014ULL, 0x0000000000100010ULL,
+    0x0000000000100001ULL, 0x0000000000124000ULL, 0x0000000000020110ULL, 0x0000000000000110ULL,
+    0x0000000000010800ULL, 0x0000000000024000ULL, 0x0000000000000110ULL, 0x0000000000002040ULL,
+    0x0000000000100001ULL, 0x0000000000040001ULL, 0x0000000000020100ULL, 0x0000000000000048ULL,
+    0x000000000000D001ULL, 0x0000000000086149ULL, 0x0000000001004101ULL, 0x00000000003E4835ULL,
+    0x00000000000C0000ULL, 0x0000000000020110ULL, 0x0000000000004100ULL, 0x0000000000040010ULL,
+    0x0000000000002040ULL, 0x0000000000104901ULL, 0x0000000000140118ULL, 0x0000000000000900ULL,
+    0x00000000000C9128ULL, 0x0000000000020101ULL, 0x0000000000090002ULL, 0x0000000000120004ULL,
+    0x0000000000080004ULL, 0x00000000000D2124ULL, 0x0000000000900000ULL, 0x0000000000003000ULL,
+    0x0000000000001100ULL, 0x00000000000C0000ULL, 0x0000000000262000ULL, 0x0000000001000901ULL,
+    0x0000000000009000ULL, 0x000000000000001CULL, 0x00000000000C0100ULL, 0x0000000000000111ULL,
+    0x0000000000261804ULL, 0x0000000000080100ULL, 0x00000000002C282CULL, 0x0000000000243000ULL,
+    0x00000000003C9B6EULL, 0x0000000000002008ULL, 0x0000000000048000ULL, 0x0000000000000101ULL,
+    0x0000000000060000ULL, 0x0000000000080010ULL, 0x0000000000004100ULL, 0x0000000000040008ULL,
+    0x0000000000000810ULL, 0x0000000000000101ULL, 0x0000000000002844ULL, 0x0000000001124910ULL,
+    0x0000000000004100ULL, 0x0000000000124801ULL, 0x0000000000100901ULL, 0x0000000000004010ULL,
+    0x0000000000000111ULL, 0x000000000010C111ULL, 0x0000000000284121ULL, 0x00000000000A4800ULL,
+    0x000000000018C110ULL, 0x0000000000024111ULL, 0x0000000000042000ULL, 0x0000000000104101ULL,
+    0x0000000000004100ULL, 0x0000000000010100ULL, 0x0000000000000101ULL, 0x0000000000008001ULL,
+    0x000000000000000CULL, 0x0000000000000110ULL, 0x0000000000104001ULL, 0x0000000000080940ULL,
+    0x0000000000000101ULL, 0x0000000000042000ULL, 0x0000000000080010ULL, 0x0000000000024800ULL,
+    0x0000000000104101ULL, 0x0000000000000044ULL, 0x000000000000000CULL, 0x0000000000281040ULL,
+    0x0000000000004001ULL, 0x0000000000002800ULL, 0x000000000000A800ULL, 0x0000000000002010ULL,
+    0x0000000000024081ULL, 0x0000000000100001ULL, 0x0000000000000113ULL, 0x00000000000C0001ULL,
+    0x0000000000320150ULL, 0x0000000000020100ULL, 0x0000000000000044ULL, 0x0000000000002800ULL,
+    0x0000000000000110ULL, 0x0000000000000104ULL, 0x0000000000000900ULL, 0x0000000000100118ULL,
+    0x0000000000003002ULL, 0x0000000000006048ULL, 0x0000000000080004ULL, 0x00000000002A882CULL,
+    0x0000000000080004ULL, 0x0000000000080002ULL, 0x0000000000009000ULL, 0x0000000000008008ULL,
+    0x00000000002C0800ULL, 0x0000000000020004ULL, 0x0000000000008010ULL, 0x0000000000249120ULL,
+    0x0000000000000012ULL, 0x0000000000080001ULL, 0x0000000000000801ULL, 0x0000000000004110ULL,
+    0x0000000000000102ULL, 0x0000000000080108ULL, 0x0000000000004001ULL, 0x0000000000028000ULL,
+    0x000000000000C000ULL, 0x0000000000040119ULL, 0x0000000000023000ULL, 0x0000000000025000ULL,
+    0x0000000000004010ULL, 0x0000000000120001ULL, 0x0000000000002100ULL, 0x00000000000EA00CULL,
+    0x0000000000060004ULL, 0x00000000002021E4ULL, 0x0000000000141020ULL, 0x000000000028C807ULL,
+    0x000000000010B000ULL, 0x0000000000004010ULL, 0x0000000000000180ULL, 0x0000000000020100ULL,
+    0x0000000000294020ULL, 0x0000000000020010ULL, 0x0000000000000005ULL, 0x0000000000100001ULL,
+    0x0000000000042800ULL, 0x0000000000200901ULL, 0x00000000000C0010ULL, 0x0000000000080158ULL,
+    0x00000000000E2108ULL, 0x0000000000100010ULL, 0x0000000000000011ULL, 0x0000000000002008ULL,
+    0x0000000000000011ULL, 0x0000000000102000ULL, 0x0000000000000801ULL, 0x0000000000180010ULL,
+    0x0000000000110111ULL, 0x0000000000020111ULL, 0x0000000000000101ULL, 0x00000000000C0800ULL,
+    0x0000000000180005ULL, 0x0000000000080001ULL, 0x0000000000000011ULL};
+
+// BIP39_WORDLIST_MARK values of the accents of the French words
+unsigned int const BIP39_WORDLIST_MARKS_FRENCH[] = {
+    0x00120401, 0x00210401, 0x00270201, 0x00280301, 0x00340101, 0x00350101,
+    0x00400301, 0x004C0300, 0x004E0301, 0x00500301, 0x00570301, 0x005B0201,
+    0x006A0201, 0x007A0201, 0x00920301, 0x00CB0500, 0x00DA0101, 0x00DC0101,
+    0x00DC0301, 0x00E30101, 0x01170200, 0x01360301, 0x01400301, 0x015F0101,
+    0x01610101, 0x01670101, 0x01670301, 0x01790201, 0x017F0400, 0x018B0301,
+    0x01A80301, 0x01AB0300, 0x01B10301, 0x01C40400, 0x01D20201, 0x01D30201,
+    0x01D40201, 0x01DA0400, 0x01E30500, 0x01F50101, 0x01F60101, 0x01F70101,
+    0x01F80101, 0x01F90101, 0x01FA0101, 0x01FB0101, 0x01FC0101, 0x01FD0101,
+    0x01FE0101, 0x01FF0101, 0x02000101, 0x02010101, 0x02020101, 0x02030101,
+    0x02040101, 0x02050101, 0x02060101, 0x02070101, 0x02080101, 0x02090101,
+    0x020A0101, 0x020B0101, 0x020C0101, 0x020D0101, 0x020E0101, 0x02110101,
+    0x02120101, 0x02130101, 0x02150101, 0x02160101, 0x02170101, 0x02180101,
+    0x02190101, 0x021A0101, 0x021B0101, 0x021C0101, 0x021D0101, 0x021F0101,
+    0x02200101, 0x02210101, 0x02210501, 0x02240101, 0x02250101, 0x02260101,
+    0x02270101, 0x02300401, 0x02310301, 0x02600001, 0x02610001, 0x02620001,
+    0x02630001, 0x02640001, 0x02650001, 0x02660001, 0x02670001, 0x02680001,
+    0x02690001, 0x026A0001, 0x026B0001, 0x026C0001, 0x026D0001, 0x026D0301,
+    0x026E0001, 0x026F0001, 0x02700001, 0x02710001, 0x02720001, 0x02730001,
+    0x027A0001, 0x027B0001, 0x027C0001, 0x027D0001, 0x027E0001, 0x027F0001,
+    0x02800001, 0x02800201, 0x02810001, 0x02810201, 0x02820001, 0x02820200,
+    0x02830001, 0x02840001, 0x02850001, 0x02860001, 0x02870001, 0x028B0001,
+    0x028C0001, 0x028E0001, 0x028F0001, 0x02940001, 0x02960400, 0x029D0001,
+    0x02A40001, 0x02B20001, 0x02B20401, 0x02B70001, 0x02B80001, 0x02B90001,
+    0x02BA0001, 0x02BB0001, 0x02BC0001, 0x02BD0001, 0x02BD0401, 0x02BE0001,
+    0x02BF0001, 0x02C00001, 0x02C10001, 0x02C20001, 0x02C30001, 0x02C40001,
+    0x02C50001, 0x02C60001, 0x02C70001, 0x02C80001, 0x02C90001, 0x02CA0001,
+    0x02CC0001, 0x02CF0300, 0x02D00400, 0x02DB0001, 0x02DB0400, 0x02DC0001,
+    0x02DD0001, 0x02DE0001, 0x02DF0001, 0x02E00001, 0x02E10001, 0x02E20001,
+    0x02E30001, 0x02E50001, 0x02E60001, 0x02E70001, 0x02E80001, 0x02E90001,
+    0x02EA0001, 0x02EB0001, 0x02EC0001, 0x02EE0001, 0x02EF0001, 0x02F00001,
+    0x02F10001, 0x02F20001, 0x02F30001, 0x02F40001, 0x02F60401, 0x02FC0201,
+    0x03050301, 0x03210101, 0x03220101, 0x03230101, 0x03230301, 0x03240101,
+    0x03260101, 0x03280101, 0x032A0101, 0x032F0101, 0x03330300, 0x03370400,
+    0x03460201, 0x03470200, 0x03590400, 0x03620201, 0x03650201, 0x03660201,
+    0x03660401, 0x03670200, 0x03820101, 0x03830101, 0x03840101, 0x03860101,
+    0x03860301, 0x03870101, 0x038A0101, 0x038B0101, 0x038B0400, 0x038C0101,
+    0x03B60400, 0x03B70201, 0x03C90101, 0x03CA0101, 0x03CC0101, 0x03CE0101,
+    0x03CF0101, 0x03D80500, 0x03EB0400, 0x03FA0301, 0x04070201, 0x040E0301,
+    0x04290301, 0x044A0301, 0x04510301, 0x04640101, 0x04650101, 0x04660101,
+    0x046B0101, 0x046D0301, 0x04710200, 0x04720200, 0x047A0301, 0x047E0400,
+    0x04940400, 0x04A50301, 0x04B90301, 0x04BA0400, 0x04C00101, 0x04C10101,
+    0x04C20101, 0x04C30101, 0x04C40101, 0x04C50101, 0x04C70101, 0x04C80101,
+    0x04CA0101, 0x04D10101, 0x04D50101, 0x04D60101, 0x04D60301, 0x04D70101,
+    0x04D80101, 0x04E30301, 0x05040300, 0x05070301, 0x050E0400, 0x051A0101,
+    0x051C0101, 0x051D0101, 0x051E0101, 0x051F0101, 0x053F0301, 0x05430201,
+    0x054D0201, 0x05600201, 0x05640201, 0x05800400, 0x05840600, 0x059E0400,
+    0x05A90101, 0x05AE0101, 0x05AE0301, 0x05AF0101, 0x05B10101, 0x05B20101,
+    0x05B30101, 0x05B60101, 0x05BC0101, 0x05BE0101, 0x05C80200, 0x05E40201,
+    0x05E50200, 0x05F10401, 0x05F50401, 0x06020201, 0x06030201, 0x06040201,
+    0x06050201, 0x06060201, 0x06070201, 0x06080201, 0x06090201, 0x060E0500,
+    0x060F0401, 0x06120500, 0x06180500, 0x06190401, 0x062D0301, 0x063F0101,
+    0x06400101, 0x06410101, 0x06420101, 0x06440101, 0x06450101, 0x06460101,
+    0x064A0101, 0x064D0101, 0x064E0101, 0x06510101, 0x06520101, 0x06530101,
+    0x06540101, 0x06550101, 0x06550401, 0x065C0300, 0x066C0101, 0x066D0101,
+    0x066E0101, 0x06710101, 0x06720101, 0x06740101, 0x06770101, 0x06780101,
+    0x067B0101, 0x067C0101, 0x06880400, 0x06BB0201, 0x06BB0401, 0x06BC0201,
+    0x06BE0301, 0x06C40101, 0x06C50101, 0x06C60101, 0x06C80101, 0x06C80401,
+    0x06C90101, 0x06CA0101, 0x06CC0101, 0x06CD0101, 0x06D10101, 0x06D20101,
+    0x06D50101, 0x06D60101, 0x06D90101, 0x06DB0101, 0x06DD0101, 0x06DE0101,
+    0x06E10301, 0x06E20200, 0x06E30201, 0x06EA0400, 0x070E0201, 0x070F0300,
+    0x071E0400, 0x07210401, 0x072F0301, 0x07320400, 0x07480101, 0x07520101,
+    0x07540200, 0x07550201, 0x07560201, 0x07590200, 0x07620301, 0x077A0200,
+    0x077C0201, 0x07BC0101, 0x07BC0301, 0x07BD0101, 0x07BF0101, 0x07C10101,
+    0x07C10301, 0x07C60101, 0x07CC0101, 0x07CC0301, 0x07CD0101, 0x07D40301,
+    0x07DB0300, 0x07FA0101, 0x07FC0100, 0x07FD0101};
+#endif
 
 unsigned char const BIP39_MNEMONIC[] = {'m', 'n', 'e', 'm', 'o', 'n', 'i', 'c'};
 
+bip39_wordlist_t const BIP39_WORDLISTS[] = {
+    // the English words have no combining mark
+    [BIP39_LANGUAGE_ENGLISH] =
+        {
+            .words = BIP39_WORDLIST,
+            .prefix_index = BIP39_WORDLIST_PREFIX_INDEX,
+            .trie = BIP39_TRIE,
+            .marks = NULL,
+            .marks_count = 0,
+        },
+#if !defined(TARGET_NANOS)
+    [BIP39_LANGUAGE_FRENCH] =
+        {
+            .words = BIP39_WORDLIST_FRENCH,
+            .prefix_index = BIP39_WORDLIST_PREFIX_INDEX_FRENCH,
+            .trie = BIP39_TRIE_FRENCH,
+            .marks = BIP39_WORDLIST_MARKS_FRENCH,
+            .marks_count = BIP39_WORDLIST_MARKS_FRENCH_LENGTH,
+        },
+#endif
+};
+
 #ifdef HAVE_ELECTRUM
 
 unsigned char const ELECTRUM_SEED_VERSION[] =
@@ -17,9 +17,29 @@
 
 #pragma once
 
-#define BIP39_WORDLIST_LENGTH         11068
-#define BIP39_WORDLIST_OFFSETS_LENGTH 2049
-#define BIP39_MNEMONIC_LENGTH         8
+#define BIP39_WORDLIST_COUNT               2048
+#define BIP39_WORDLIST_WORD_LETTERS        8
+#define BIP39_WORDLIST_LETTER_BITS         5
+#define BIP39_WORDLIST_STRIDE              5
+#define BIP39_WORDLIST_LENGTH              (BIP39_WORDLIST_COUNT * BIP39_WORDLIST_STRIDE)
+#define BIP39_WORDLIST_PREFIX_INDEX_LENGTH (26 * 26 + 1)
+#define BIP39_TRIE_LENGTH                  650
+#define BIP39_TRIE_FRENCH_LENGTH           671
+#define BIP39_WORDLIST_MARKS_FRENCH_LENGTH 388
+#define BIP39_MNEMONIC_LENGTH              8
+
+// 24 words of 11 bits: 256 bits of entropy followed by an 8-bit checksum
+#define BIP39_ENTROPY_MAX_LENGTH 33
+// 24 words of up to 8 letters, separated by spaces
+#define BIP39_MNEMONIC_MAX_LENGTH (24 * 9)
+// NFKD text of a word: each letter may be followed by a 2-byte combining mark (U+0300-U+036F)
+#define BIP39_WORD_TEXT_MAX_LENGTH (BIP39_WORDLIST_WORD_LETTERS * 3)
+// the final word of a 12-word phrase holds 7 entropy bits followed by a 4-bit checksum
+#define BIP39_FINAL_WORD_MAX_CANDIDATES 128
+// the largest 3-letter stem of the lists ("pro", French) has 14 words, and each of its 3 letters
+// can be replaced, preceded by another one or removed (see bolos_ux_bip39_near_word)
+#define BIP39_NEAR_WORD_STEM_SLOTS 14
+#define BIP39_NEAR_WORD_SLOTS      (BIP39_NEAR_WORD_STEM_SLOTS + 3 * (2 * 26 + 1))
 
 #ifdef HAVE_ELECTRUM
 
@@ -32,10 +52,50 @@
 
 #define BIP39_PBKDF2_ROUNDS 2048
 
+// combining mark of the NFKD text of a word, following the letter at the given position
+#define BIP39_WORDLIST_MARK(index, position, mark) \
+    (((unsigned int) (index) << 16) | ((position) << 8) | ((mark) - 0x300))
+
+// A BIP39 wordlist in the format output by the wordlist generator, so that every language is
+// searched and decoded by the same code. The words are packed by their ASCII-folded letters (see
+// seed_rom_variables.c), which are the ones typed and displayed: the generator only accepts the
+// lists whose folded words sort in the wordlist order. The combining marks dropped by the folding
+// are listed apart, by increasing BIP39_WORDLIST_MARK value, to rebuild the NFKD text hashed by
+// PBKDF2. The lists which are not written with Latin letters (Japanese, Korean, Chinese) cannot be
+// typed on the keyboards, and do not fit the format.
+typedef struct {
+    const unsigned char *words;
+    const unsigned short *prefix_index;
+    const unsigned long long *trie;
+    const unsigned int *marks;
+    unsigned int marks_count;
+} bip39_wordlist_t;
+
+// the French list is not compiled in for Nano S, which lacks the flash for it
+#define BIP39_LANGUAGE_ENGLISH 0
+#if defined(TARGET_NANOS)
+#define BIP39_LANGUAGE_COUNT 1
+#else
+#define BIP39_LANGUAGE_FRENCH 1
+#define BIP39_LANGUAGE_COUNT  2
+#endif
+
 extern unsigned char const WIDE BIP39_WORDLIST[BIP39_WORDLIST_LENGTH];
-extern unsigned short const WIDE BIP39_WORDLIST_OFFSETS[BIP39_WORDLIST_OFFSETS_LENGTH];
+extern unsigned short const WIDE BIP39_WORDLIST_PREFIX_INDEX[BIP39_WORDLIST_PREFIX_INDEX_LENGTH];
+extern unsigned long long const WIDE BIP39_TRIE[BIP39_TRIE_LENGTH];
 extern unsigned char const WIDE BIP39_MNEMONIC[BIP39_MNEMONIC_LENGTH];
 
+#if !defined(TARGET_NANOS)
+extern unsigned char const WIDE BIP39_WORDLIST_FRENCH[BIP39_WORDLIST_LENGTH];
+extern unsigned short const WIDE
+    BIP39_WORDLIST_PREFIX_INDEX_FRENCH[BIP39_WORDLIST_PREFIX_INDEX_LENGTH];
+extern unsigned long long const WIDE BIP39_TRIE_FRENCH[BIP39_TRIE_FRENCH_LENGTH];
+extern unsigned int const WIDE BIP39_WORDLIST_MARKS_FRENCH[BIP39_WORDLIST_MARKS_FRENCH_LENGTH];
+#endif
+
+// indexed by BIP39_LANGUAGE_*
+extern bip39_wordlist_t const WIDE BIP39_WORDLISTS[BIP39_LANGUAGE_COUNT];
+
 #ifdef HAVE_ELECTRUM
 
 extern unsigned char const WIDE ELECTRUM_SEED_VERSION[ELECTRUM_SEED_VERSION_LENGTH];
@@ -0,0 +1,397 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <string.h>
+#include <os.h>
+#include <lcx_hmac.h>
+#include <lcx_math.h>
+#include <lcx_sha256.h>
+
+#include "constants.h"
+#include "./common.h"
+#include "./bip85.h"
+#include "./bip39/common_bip39.h"
+
+#define BIP32_HARDENED 0x80000000
+#define BIP32_KEY_LENGTH 32
+
+// order of the secp256k1 group, the private keys being reduced modulo it
+static const uint8_t SECP256K1_N[BIP32_KEY_LENGTH] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b, 0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x41};
+
+// BIP85 language codes of the BIP39 wordlists
+static const uint32_t BIP85_BIP39_LANGUAGES[BIP39_LANGUAGE_COUNT] = {
+    [BIP39_LANGUAGE_ENGLISH] = 0,
+#if !defined(TARGET_NANOS)
+    [BIP39_LANGUAGE_FRENCH] = 6,
+#endif
+};
+
+// m/83696968' node derived by the OS, and the node of the latest application path derived from it
+static struct {
+    uint8_t purpose_key[BIP32_KEY_LENGTH];
+    uint8_t purpose_chain_code[BIP32_KEY_LENGTH];
+    bool purpose_cached;
+    uint8_t key[BIP32_KEY_LENGTH];
+    uint8_t chain_code[BIP32_KEY_LENGTH];
+    uint32_t path[BIP85_APPLICATION_PATH_MAX_LENGTH];
+    size_t path_length;
+    bool cached;
+} bip85_node;
+
+static cx_err_t hmac_sha512(const uint8_t *key,
+                            size_t key_length,
+                            const uint8_t *data,
+                            size_t data_length,
+                            uint8_t out[64]) {
+    cx_hmac_sha512_t ctx;
+    cx_err_t error;
+
+    CX_CHECK(cx_hmac_sha512_init_no_throw(&ctx, key, key_length));
+    CX_CHECK(cx_hmac_no_throw((cx_hmac_t *) &ctx, CX_LAST, data, data_length, out, 64));
+end:
+    memzero(&ctx, sizeof(ctx));
+    return error;
+}
+
+// BIP32 derivation of the hardened child of a private key, in place
+static cx_err_t bip32_derive_hardened(uint8_t key[BIP32_KEY_LENGTH],
+                                      uint8_t chain_code[BIP32_KEY_LENGTH],
+                                      uint32_t index) {
+    // 0x00 || key || ser32(index)
+    uint8_t data[1 + BIP32_KEY_LENGTH + 4];
+    uint8_t digest[64];
+    int diff;
+    cx_err_t error;
+
+    index |= BIP32_HARDENED;
+    data[0] = 0x00;
+    memcpy(data + 1, key, BIP32_KEY_LENGTH);
+    data[1 + BIP32_KEY_LENGTH] = index >> 24;
+    data[2 + BIP32_KEY_LENGTH] = index >> 16;
+    data[3 + BIP32_KEY_LENGTH] = index >> 8;
+    data[4 + BIP32_KEY_LENGTH] = index;
+    CX_CHECK(hmac_sha512(chain_code, BIP32_KEY_LENGTH, data, sizeof(data), digest));
+
+    // the children BIP32 skips (with a probability below 2^-127) are reported as errors
+    CX_CHECK(cx_math_cmp_no_throw(digest, SECP256K1_N, BIP32_KEY_LENGTH, &diff));
+    if (diff >= 0) {
+        error = CX_INVALID_PARAMETER;
+        goto end;
+    }
+    CX_CHECK(cx_math_addm_no_throw(key, digest, key, SECP256K1_N, BIP32_KEY_LENGTH));
+    if (cx_math_is_zero(key, BIP32_KEY_LENGTH)) {
+        error = CX_INVALID_PARAMETER;
+        goto end;
+    }
+    memcpy(chain_code, digest + BIP32_KEY_LENGTH, BIP32_KEY_LENGTH);
+end:
+    memzero(data, sizeof(data));
+    memzero(digest, sizeof(digest));
+    return error;
+}
+
+static bool bip85_purpose_node_derive(void) {
+    const uint32_t path[] = {BIP85_PURPOSE | BIP32_HARDENED};
+    // os_derive_bip32* may write a 64-byte private key
+    uint8_t private_key[64];
+    cx_err_t error;
+
+    if (bip85_node.purpose_cached) {
+        return true;
+    }
+    error = os_derive_bip32_no_throw(CX_CURVE_256K1,
+                                     path,
+                                     ARRAYLEN(path),
+                                     private_key,
+                                     bip85_node.purpose_chain_code);
+    if (error == CX_OK) {
+        memcpy(bip85_node.purpose_key, private_key, BIP32_KEY_LENGTH);
+        bip85_node.purpose_cached = true;
+    } else {
+        PRINTF("BIP85 node derivation failed: 0x%x\n", error);
+        bip85_node_clear();
+    }
+    memzero(private_key, sizeof(private_key));
+    return bip85_node.purpose_cached;
+}
+
+// derive the node of the application path, unless it is the cached one
+static bool bip85_node_derive(const uint32_t *path, size_t path_length) {
+    if (path_length > BIP85_APPLICATION_PATH_MAX_LENGTH) {
+        return false;
+    }
+    if (bip85_node.cached && bip85_node.path_length == path_length &&
+        memcmp(bip85_node.path, path, path_length * sizeof(path[0])) == 0) {
+        return true;
+    }
+    if (!bip85_purpose_node_derive()) {
+        return false;
+    }
+    bip85_node.cached = false;
+    memcpy(bip85_node.key, bip85_node.purpose_key, BIP32_KEY_LENGTH);
+    memcpy(bip85_node.chain_code, bip85_node.purpose_chain_code, BIP32_KEY_LENGTH);
+    for (size_t i = 0; i < path_length; i++) {
+        if (bip32_derive_hardened(bip85_node.key, bip85_node.chain_code, path[i]) != CX_OK) {
+            bip85_node_clear();
+            return false;
+        }
+    }
+    memcpy(bip85_node.path, path, path_length * sizeof(path[0]));
+    bip85_node.path_length = path_length;
+    bip85_node.cached = true;
+    return true;
+}
+
+bool bip85_entropy(const uint32_t *path,
+                   size_t path_length,
+                   uint32_t index,
+                   uint8_t entropy[BIP85_ENTROPY_LENGTH]) {
+    const char hmac_key[] = "bip-entropy-from-k";
+    uint8_t key[BIP32_KEY_LENGTH];
+    uint8_t chain_code[BIP32_KEY_LENGTH];
+    bool result = false;
+
+    if (index > BIP85_INDEX_MAX || !bip85_node_derive(path, path_length)) {
+        return false;
+    }
+    memcpy(key, bip85_node.key, BIP32_KEY_LENGTH);
+    memcpy(chain_code, bip85_node.chain_code, BIP32_KEY_LENGTH);
+    if (bip32_derive_hardened(key, chain_code, index) == CX_OK &&
+        hmac_sha512((const uint8_t *) hmac_key, strlen(hmac_key), key, sizeof(key), entropy) ==
+            CX_OK) {
+        result = true;
+    } else {
+        memzero(entropy, BIP85_ENTROPY_LENGTH);
+    }
+    memzero(key, sizeof(key));
+    memzero(chain_code, sizeof(chain_code));
+    return result;
+}
+
+// application path of a child, return its length (0 if the length parameter is invalid)
+static size_t bip85_application_path(uint32_t application,
+                                     uint32_t length,
+                                     uint32_t path[BIP85_APPLICATION_PATH_MAX_LENGTH]) {
+    if (!bip85_length_check(application, length)) {
+        return 0;
+    }
+    path[0] = application;
+    switch (application) {
+        case BIP85_APPLICATION_BIP39:
+            path[1] = BIP85_BIP39_LANGUAGES[bolos_ux_bip39_wordlist_get()];
+            path[2] = length;
+            return 3;
+        case BIP85_APPLICATION_XPRV:
+            return 1;
+        default:
+            path[1] = length;
+            return 2;
+    }
+}
+
+bool bip85_length_check(uint32_t application, uint32_t length) {
+    switch (application) {
+        case BIP85_APPLICATION_BIP39:
+            return length == BIP39_MNEMONIC_SIZE_12 || length == BIP39_MNEMONIC_SIZE_18 ||
+                   length == BIP39_MNEMONIC_SIZE_24;
+        case BIP85_APPLICATION_HEX:
+            return length >= BIP85_HEX_LENGTH_MIN && length <= BIP85_HEX_LENGTH_MAX;
+        case BIP85_APPLICATION_PWD_BASE64:
+            return length >= BIP85_PWD_BASE64_LENGTH_MIN && length <= BIP85_PWD_BASE64_LENGTH_MAX;
+        case BIP85_APPLICATION_PWD_BASE85:
+            return length >= BIP85_PWD_BASE85_LENGTH_MIN && length <= BIP85_PWD_BASE85_LENGTH_MAX;
+        case BIP85_APPLICATION_XPRV:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool bip85_bip39_entropy(unsigned int word_count, uint32_t index, uint8_t *entropy) {
+    uint32_t path[BIP85_APPLICATION_PATH_MAX_LENGTH];
+    const size_t path_length = bip85_application_path(BIP85_APPLICATION_BIP39, word_count, path);
+    uint8_t buffer[BIP85_ENTROPY_LENGTH];
+
+    if (path_length == 0 || !bip85_entropy(path, path_length, index, buffer)) {
+        return false;
+    }
+    memcpy(entropy, buffer, word_count * 4 / 3);
+    memzero(buffer, sizeof(buffer));
+    return true;
+}
+
+/*
+ * Encodings of the entropy, writing the length first characters of the text
+ */
+static void hex_encode(const uint8_t *entropy, size_t length, char *out) {
+    static const char digits[] = "0123456789abcdef";
+
+    for (size_t i = 0; i < length; i++) {
+        out[i] = ((const char *) PIC(digits))[(entropy[i / 2] >> (i % 2 ? 0 : 4)) & 0x0F];
+    }
+}
+
+// RFC 4648 alphabet, the length being short of the padding of the 64 bytes of entropy
+static void base64_encode(const uint8_t *entropy, size_t length, char *out) {
+    static const char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    for (size_t i = 0; i < length; i++) {
+        const size_t byte = 6 * i / 8;
+        // the 6 bits straddle at most 2 bytes, the one after the entropy being 0
+        const unsigned int bits =
+            entropy[byte] << 8 | (byte + 1 < BIP85_ENTROPY_LENGTH ? entropy[byte + 1] : 0);
+        out[i] = ((const char *) PIC(alphabet))[(bits >> (10 - 6 * i % 8)) & 0x3F];
+    }
+}
+
+// RFC 1924 alphabet (as Python's base64.b85encode), 5 characters per 4 bytes of entropy
+static void base85_encode(const uint8_t *entropy, size_t length, char *out) {
+    static const char alphabet[] =
+        "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz!#$%&()*+-;<=>?@^_`{|}~";
+    char chunk[5];
+
+    for (size_t i = 0; i < length; i += sizeof(chunk)) {
+        uint32_t value = (uint32_t) entropy[i / 5 * 4] << 24 | entropy[i / 5 * 4 + 1] << 16 |
+                         entropy[i / 5 * 4 + 2] << 8 | entropy[i / 5 * 4 + 3];
+        for (size_t j = sizeof(chunk); j-- > 0;) {
+            chunk[j] = ((const char *) PIC(alphabet))[value % 85];
+            value /= 85;
+        }
+        memcpy(out + i, chunk, MIN(sizeof(chunk), length - i));
+    }
+    memzero(chunk, sizeof(chunk));
+}
+
+// serialized extended private key: version, depth, parent fingerprint, child number, chain code
+// and 0x00 || key, followed by a 4-byte checksum
+#define XPRV_LENGTH         (4 + 1 + 4 + 4 + BIP32_KEY_LENGTH + 1 + BIP32_KEY_LENGTH)
+#define XPRV_CHECKED_LENGTH (XPRV_LENGTH + 4)
+// base58 text of XPRV_CHECKED_LENGTH bytes
+#define XPRV_TEXT_LENGTH 111
+
+// the root extended private key of the chain code and key halves of the entropy, as base58check
+static bool xprv_encode(const uint8_t *entropy, char *out) {
+    static const char alphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+    uint8_t xprv[XPRV_CHECKED_LENGTH] = {0x04, 0x88, 0xAD, 0xE4};
+    uint8_t hash[32];
+    // base58 digits, least significant first
+    uint8_t digits[XPRV_TEXT_LENGTH];
+    size_t digits_length = 0;
+    int diff;
+    bool result = false;
+
+    if (cx_math_cmp_no_throw(entropy + BIP32_KEY_LENGTH, SECP256K1_N, BIP32_KEY_LENGTH, &diff) !=
+            CX_OK ||
+        diff >= 0 || cx_math_is_zero(entropy + BIP32_KEY_LENGTH, BIP32_KEY_LENGTH)) {
+        return false;
+    }
+    memcpy(xprv + XPRV_LENGTH - 1 - 2 * BIP32_KEY_LENGTH, entropy, BIP32_KEY_LENGTH);
+    memcpy(xprv + XPRV_LENGTH - BIP32_KEY_LENGTH, entropy + BIP32_KEY_LENGTH, BIP32_KEY_LENGTH);
+    cx_hash_sha256(xprv, XPRV_LENGTH, hash, sizeof(hash));
+    cx_hash_sha256(hash, sizeof(hash), hash, sizeof(hash));
+    memcpy(xprv + XPRV_LENGTH, hash, 4);
+
+    // the serialization starts with the non-zero version byte, no leading '1' is needed
+    for (size_t i = 0; i < XPRV_CHECKED_LENGTH; i++) {
+        unsigned int carry = xprv[i];
+        for (size_t j = 0; j < digits_length; j++) {
+            carry += digits[j] << 8;
+            digits[j] = carry % 58;
+            carry /= 58;
+        }
+        while (carry > 0 && digits_length < sizeof(digits)) {
+            digits[digits_length++] = carry % 58;
+            carry /= 58;
+        }
+    }
+    if (digits_length == XPRV_TEXT_LENGTH) {
+        for (size_t i = 0; i < XPRV_TEXT_LENGTH; i++) {
+            out[i] = ((const char *) PIC(alphabet))[digits[XPRV_TEXT_LENGTH - 1 - i]];
+        }
+        result = true;
+    }
+    memzero(xprv, sizeof(xprv));
+    memzero(hash, sizeof(hash));
+    memzero(digits, sizeof(digits));
+    return result;
+}
+
+size_t bip85_text(uint32_t application,
+                  uint32_t length,
+                  uint32_t index,
+                  char *out,
+                  size_t out_size) {
+    uint32_t path[BIP85_APPLICATION_PATH_MAX_LENGTH];
+    const size_t path_length = bip85_application_path(application, length, path);
+    uint8_t entropy[BIP85_ENTROPY_LENGTH];
+    size_t text_length = 0;
+
+    if (out_size == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+    if (path_length == 0 || !bip85_entropy(path, path_length, index, entropy)) {
+        return 0;
+    }
+    switch (application) {
+        case BIP85_APPLICATION_BIP39:
+            text_length = bolos_ux_bip39_mnemonic_encode(entropy,
+                                                         length * 4 / 3,
+                                                         (unsigned char *) out,
+                                                         out_size - 1);
+            break;
+        case BIP85_APPLICATION_HEX:
+            if (2 * length < out_size) {
+                text_length = 2 * length;
+                hex_encode(entropy, text_length, out);
+            }
+            break;
+        case BIP85_APPLICATION_PWD_BASE64:
+            if (length < out_size) {
+                text_length = length;
+                base64_encode(entropy, text_length, out);
+            }
+            break;
+        case BIP85_APPLICATION_PWD_BASE85:
+            if (length < out_size) {
+                text_length = length;
+                base85_encode(entropy, text_length, out);
+            }
+            break;
+        case BIP85_APPLICATION_XPRV:
+            if (XPRV_TEXT_LENGTH < out_size && xprv_encode(entropy, out)) {
+                text_length = XPRV_TEXT_LENGTH;
+            }
+            break;
+        default:
+            break;
+    }
+    memzero(entropy, sizeof(entropy));
+    out[text_length] = '\0';
+    return text_length;
+}
+
+bool bip85_node_cached(void) {
+    return bip85_node.purpose_cached;
+}
+
+void bip85_node_clear(void) {
+    memzero(&bip85_node, sizeof(bip85_node));
+}
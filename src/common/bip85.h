@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// BIP85 deterministic entropy: the children of the device's seed are derived at
+// m/83696968'/<application path>'/<index>', all of the indexes being hardened.
+//
+// The m/83696968' node is derived by the OS once, and kept until bip85_node_clear (see
+// device_root_key_clear) along with the node of the latest application path derived from it
+// (m/83696968'/39'/0'/12' for 12-word English BIP39 children): going from a child index to the
+// next one then costs a single hardened derivation step instead of a derivation of the whole path.
+#define BIP85_PURPOSE 83696968
+// largest hardened index, without the hardening bit
+#define BIP85_INDEX_MAX 0x7FFFFFFF
+// number of indexes of an application path, the application number followed by its parameters
+#define BIP85_APPLICATION_PATH_MAX_LENGTH 3
+#define BIP85_ENTROPY_LENGTH 64
+
+// applications, and the bounds of their length parameter
+#define BIP85_APPLICATION_BIP39      39      // words: 12, 18 or 24
+#define BIP85_APPLICATION_HEX        128169  // bytes
+#define BIP85_APPLICATION_PWD_BASE64 707764  // characters
+#define BIP85_APPLICATION_PWD_BASE85 707785  // characters
+#define BIP85_APPLICATION_XPRV       32      // no length parameter
+
+#define BIP85_HEX_LENGTH_MIN        16
+#define BIP85_HEX_LENGTH_MAX        64
+#define BIP85_PWD_BASE64_LENGTH_MIN 20
+#define BIP85_PWD_BASE64_LENGTH_MAX 86
+#define BIP85_PWD_BASE85_LENGTH_MIN 10
+#define BIP85_PWD_BASE85_LENGTH_MAX 80
+
+// entropy of the child at the index of the application path (indexes without the hardening bit),
+// return false if the derivation failed
+bool bip85_entropy(const uint32_t *path,
+                   size_t path_length,
+                   uint32_t index,
+                   uint8_t entropy[BIP85_ENTROPY_LENGTH]);
+
+// entropy of the word_count long BIP39 child at the index, in the language of the current
+// wordlist: entropy receives the word_count * 4 / 3 bytes encoded by bolos_ux_bip39_mnemonic_encode
+bool bip85_bip39_entropy(unsigned int word_count, uint32_t index, uint8_t *entropy);
+
+// whether the length parameter is valid for the application (ignored for XPRV)
+bool bip85_length_check(uint32_t application, uint32_t length);
+
+// write the text of the child at the index (BIP39 phrase, hexadecimal entropy, password or
+// extended private key) null-terminated in out, return its length, 0 if the derivation failed or
+// the text does not fit: the text is encoded straight from the derived entropy, which is zeroed
+// before returning
+size_t bip85_text(uint32_t application,
+                  uint32_t length,
+                  uint32_t index,
+                  char *out,
+                  size_t out_size);
+
+// whether a node is cached, and its zeroing
+bool bip85_node_cached(void);
+void bip85_node_clear(void);
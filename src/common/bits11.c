@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include "bits11.h"
+
+void bits11_unpack(const unsigned char *bits,
+                   unsigned int skip_bits,
+                   uint16_t *indexes,
+                   size_t count) {
+    uint32_t accumulator = *bits++ & (0xFF >> skip_bits);
+    unsigned int available = 8 - skip_bits;
+
+    for (size_t i = 0; i < count; i++) {
+        while (available < 11) {
+            accumulator = (accumulator << 8) | *bits++;
+            available += 8;
+        }
+        available -= 11;
+        indexes[i] = (accumulator >> available) & BITS11_MASK;
+    }
+    accumulator = 0;
+}
+
+void bits11_pack(const uint16_t *indexes, size_t count, unsigned char *bits) {
+    uint32_t accumulator = 0;
+    unsigned int pending = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        accumulator = (accumulator << 11) | (indexes[i] & BITS11_MASK);
+        pending += 11;
+        while (pending >= 8) {
+            pending -= 8;
+            *bits++ = accumulator >> pending;
+        }
+    }
+    if (pending > 0) {
+        *bits = accumulator << (8 - pending);
+    }
+    accumulator = 0;
+}
+
+// an index spans 2 or 3 bytes: only the bytes actually holding it are accessed, so that the
+// last index of a buffer can be reached without reading past its end
+uint16_t bits11_get(const unsigned char *bits, size_t position) {
+    const size_t offset = position * 11;
+    const unsigned int shift = 24 - 11 - (offset % 8);
+    bits += offset / 8;
+
+    uint32_t accumulator = (bits[0] << 16) | (bits[1] << 8);
+    if (shift < 8) {
+        accumulator |= bits[2];
+    }
+    return (accumulator >> shift) & BITS11_MASK;
+}
+
+void bits11_set(unsigned char *bits, size_t position, uint16_t index) {
+    const size_t offset = position * 11;
+    const unsigned int shift = 24 - 11 - (offset % 8);
+    const uint32_t mask = (uint32_t) BITS11_MASK << shift;
+    bits += offset / 8;
+
+    uint32_t accumulator = (bits[0] << 16) | (bits[1] << 8);
+    if (shift < 8) {
+        accumulator |= bits[2];
+    }
+    accumulator = (accumulator & ~mask) | (((uint32_t) index << shift) & mask);
+    bits[0] = accumulator >> 16;
+    bits[1] = accumulator >> 8;
+    if (shift < 8) {
+        bits[2] = accumulator;
+    }
+}
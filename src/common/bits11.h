@@ -0,0 +1,43 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 11-bit word indexes packed big-endian in a bit stream, as used by BIP39 and Electrum mnemonics.
+//
+// Bits go through a 32-bit accumulator a byte at a time, so a 24-word mnemonic takes 24
+// shift/mask steps instead of one operation per bit.
+#define BITS11_MASK 0x7FF
+
+// number of bytes holding count packed indexes
+#define BITS11_LENGTH(count) (((count) * 11 + 7) / 8)
+
+// unpack count indexes, the first one starting after the skip_bits most significant bits
+void bits11_unpack(const unsigned char *bits,
+                   unsigned int skip_bits,
+                   uint16_t *indexes,
+                   size_t count);
+
+// pack count indexes in BITS11_LENGTH(count) bytes, the unused trailing bits are zeroed
+void bits11_pack(const uint16_t *indexes, size_t count, unsigned char *bits);
+
+// random access to the index at the given position, the other indexes are left untouched
+uint16_t bits11_get(const unsigned char *bits, size_t position);
+void bits11_set(unsigned char *bits, size_t position, uint16_t index);
@@ -0,0 +1,312 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <string.h>
+#include <os.h>
+
+#include "../common.h"
+#include "./codex32.h"
+
+// BCH generator multiples of the 5 bits shifted out of the 65-bit short and 75-bit long residues
+static const codex32_residue_t CODEX32_SHORT_GEN[32] = {
+    {0x0000000000000000ULL, 0x000}, {0x9dc500ce73fde210ULL, 0x001},
+    {0xbfae00def77fe529ULL, 0x001}, {0x226b001084820739ULL, 0x000},
+    {0xfbd920fffe7bee52ULL, 0x001}, {0x661c20318d860c42ULL, 0x000},
+    {0x4477202109040b7bULL, 0x000}, {0xd9b220ef7af9e96bULL, 0x001},
+    {0x739640bdeee3fdadULL, 0x001}, {0xee5340739d1e1fbdULL, 0x000},
+    {0xcc384063199c1884ULL, 0x000}, {0x51fd40ad6a61fa94ULL, 0x001},
+    {0x884f6042109813ffULL, 0x000}, {0x158a608c6365f1efULL, 0x001},
+    {0x37e1609ce7e7f6d6ULL, 0x001}, {0xaa246052941a14c6ULL, 0x000},
+    {0x7729a039cfc75f5aULL, 0x000}, {0xeaeca0f7bc3abd4aULL, 0x001},
+    {0xc887a0e738b8ba73ULL, 0x001}, {0x5542a0294b455863ULL, 0x000},
+    {0x8cf080c631bcb108ULL, 0x001}, {0x1135800842415318ULL, 0x000},
+    {0x335e8018c6c35421ULL, 0x000}, {0xae9b80d6b53eb631ULL, 0x001},
+    {0x04bfe0842124a2f7ULL, 0x001}, {0x997ae04a52d940e7ULL, 0x000},
+    {0xbb11e05ad65b47deULL, 0x000}, {0x26d4e094a5a6a5ceULL, 0x001},
+    {0xff66c07bdf5f4ca5ULL, 0x000}, {0x62a3c0b5aca2aeb5ULL, 0x001},
+    {0x40c8c0a52820a98cULL, 0x001}, {0xdd0dc06b5bdd4b9cULL, 0x000},
+};
+static const codex32_residue_t CODEX32_LONG_GEN[32] = {
+    {0x0000000000000000ULL, 0x000}, {0x9d273535ea62d897ULL, 0x3d5},
+    {0xbecb6361c6c51507ULL, 0x7a9}, {0x23ec56542ca7cd90ULL, 0x47c},
+    {0xf9b7e6c38d8a2a0eULL, 0x543}, {0x6490d3f667e8f299ULL, 0x696},
+    {0x477c85a24b4f3f09ULL, 0x2ea}, {0xda5bb097a12de79eULL, 0x13f},
+    {0x77eaeccf1990d13cULL, 0x0c5}, {0xeacdd9faf3f209abULL, 0x310},
+    {0xc9218faedf55c43bULL, 0x76c}, {0x5406ba9b35371cacULL, 0x4b9},
+    {0x8e5d0a0c941afb32ULL, 0x586}, {0x137a3f397e7823a5ULL, 0x653},
+    {0x3096696d52dfee35ULL, 0x22f}, {0xadb15c58b8bd36a2ULL, 0x1fa},
+    {0x7f74f8dc71b10651ULL, 0x188}, {0xe253cde99bd3dec6ULL, 0x25d},
+    {0xc1bf9bbdb7741356ULL, 0x621}, {0x5c98ae885d16cbc1ULL, 0x5f4},
+    {0x86c31e1ffc3b2c5fULL, 0x4cb}, {0x1be42b2a1659f4c8ULL, 0x71e},
+    {0x38087d7e3afe3958ULL, 0x362}, {0xa52f484bd09ce1cfULL, 0x0b7},
+    {0x089e14136821d76dULL, 0x14d}, {0x95b9212682430ffaULL, 0x298},
+    {0xb6557772aee4c26aULL, 0x6e4}, {0x2b72424744861afdULL, 0x531},
+    {0xf129f2d0e5abfd63ULL, 0x40e}, {0x6c0ec7e50fc925f4ULL, 0x7db},
+    {0x4fe291b1236ee864ULL, 0x3a7}, {0xd2c5a484c90c30f3ULL, 0x072},
+};
+// residues of a valid share, "secretshare32" and "secretshare32ex" as BCH targets
+static const codex32_residue_t CODEX32_SHORT_CONST = {0x0ce0795c2fd1e62aULL, 0x001};
+static const codex32_residue_t CODEX32_LONG_CONST = {0x81e570bf4798ab26ULL, 0x433};
+
+// GF(32) modulo x^5 + x^3 + 1, of generator x: the exponentials are doubled so that the sum of
+// two logarithms needs no reduction. The share values being checksum-protected text, and not key
+// material, the lookups need not be constant-time.
+static const uint8_t GF32_EXP[62] = {
+    1,  2,  4,  8,  16, 9,  18, 13, 26, 29, 19, 15, 30, 21, 3,  6,  12, 24, 25, 27, 31,
+    23, 7,  14, 28, 17, 11, 22, 5,  10, 20, 1,  2,  4,  8,  16, 9,  18, 13, 26, 29, 19,
+    15, 30, 21, 3,  6,  12, 24, 25, 27, 31, 23, 7,  14, 28, 17, 11, 22, 5,  10, 20};
+static const uint8_t GF32_LOG[32] = {0,  0,  1,  14, 2,  28, 15, 22, 3,  5,  29,
+                                     26, 16, 7,  23, 11, 4,  25, 6,  10, 30, 13,
+                                     27, 21, 17, 18, 8,  19, 24, 9,  12, 20};
+
+#define GF32_ORDER 31
+
+int8_t codex32_char_value(char c) {
+    if (c >= 'A' && c <= 'Z') {
+        c += 'a' - 'A';
+    }
+    // strchr would find the terminating null character
+    const char *position = c == '\0' ? NULL : strchr(CODEX32_CHARSET, c);
+    return position == NULL ? -1 : position - CODEX32_CHARSET;
+}
+
+void codex32_checksum_init(codex32_residue_t *residue) {
+    const size_t length = sizeof(CODEX32_HRP) - 1;
+
+    residue->low = 1;
+    residue->high = 0;
+    // high bits of the characters, a separator and their low bits: no reduction happens yet
+    for (size_t i = 0; i < length; i++) {
+        codex32_checksum_update(residue, CODEX32_HRP[i] >> 5, false);
+    }
+    codex32_checksum_update(residue, 0, false);
+    for (size_t i = 0; i < length; i++) {
+        codex32_checksum_update(residue, CODEX32_HRP[i] & 0x1F, false);
+    }
+}
+
+void codex32_checksum_update(codex32_residue_t *residue, uint8_t value, bool long_checksum) {
+    const codex32_residue_t *gen;
+    uint8_t top;
+
+    if (long_checksum) {
+        // bits 70 to 74
+        top = residue->high >> 6;
+        residue->high &= 0x3F;
+        gen = &CODEX32_LONG_GEN[top];
+    } else {
+        // bits 60 to 64
+        top = ((residue->high << 4) | (residue->low >> 60)) & 0x1F;
+        residue->high = 0;
+        residue->low &= 0x0FFFFFFFFFFFFFFFULL;
+        gen = &CODEX32_SHORT_GEN[top];
+    }
+    residue->high = ((residue->high << 5) | (residue->low >> 59)) ^ gen->high;
+    residue->low = ((residue->low << 5) | value) ^ gen->low;
+}
+
+bool codex32_checksum_verify(const codex32_residue_t *residue, bool long_checksum) {
+    const codex32_residue_t *target = long_checksum ? &CODEX32_LONG_CONST : &CODEX32_SHORT_CONST;
+
+    return residue->low == target->low && residue->high == target->high;
+}
+
+// length of the checksum of a data part, as set by the reader
+static bool codex32_long_checksum(size_t length) {
+    return length > CODEX32_SHORT_MAX_LENGTH;
+}
+
+// threshold of a share, its 1st character being a digit
+static uint8_t codex32_threshold(const codex32_share_t *share) {
+    const char digit = CODEX32_CHARSET[share->values[0]];
+
+    return digit == '0' ? 1 : digit - '0';
+}
+
+bool codex32_reader_start(codex32_reader_t *reader, size_t secret_length) {
+    memzero(reader, sizeof(*reader));
+    if (secret_length < CODEX32_MIN_SECRET_SIZE || secret_length > CODEX32_MAX_SECRET_SIZE) {
+        return false;
+    }
+    reader->final_length = CODEX32_LENGTH(secret_length);
+    codex32_checksum_init(&reader->residue);
+    return true;
+}
+
+// check the header character at position against the previous shares
+static codex32_char_status_t codex32_header_check(const codex32_share_t *share,
+                                                  size_t position,
+                                                  const codex32_share_t *shares,
+                                                  size_t share_count) {
+    const uint8_t value = share->values[position];
+    const char c = CODEX32_CHARSET[value];
+
+    if (position == 0 && c != '0' && (c < '2' || c > '9')) {
+        return CODEX32_CHAR_INVALID_HEADER;
+    }
+    if (position == CODEX32_HEADER_LENGTH - 1 && c != 's' && codex32_threshold(share) == 1) {
+        return CODEX32_CHAR_INVALID_HEADER;
+    }
+    for (size_t i = 0; i < share_count; i++) {
+        // the threshold and the identifier are the ones of the previous shares, not the index
+        if ((position < CODEX32_HEADER_LENGTH - 1) != (shares[i].values[position] == value)) {
+            return CODEX32_CHAR_MISMATCH;
+        }
+    }
+    return CODEX32_CHAR_ACCEPTED;
+}
+
+codex32_char_status_t codex32_reader_char_add(codex32_reader_t *reader,
+                                              char c,
+                                              const codex32_share_t *shares,
+                                              size_t share_count) {
+    codex32_share_t *share = &reader->share;
+    const int8_t value = codex32_char_value(c);
+    const bool long_checksum = codex32_long_checksum(reader->final_length);
+
+    if (value < 0) {
+        return CODEX32_CHAR_INVALID;
+    }
+    if (share->length >= reader->final_length) {
+        return CODEX32_CHAR_MISMATCH;
+    }
+    share->values[share->length] = value;
+    if (share->length < CODEX32_HEADER_LENGTH) {
+        const codex32_char_status_t status =
+            codex32_header_check(share, share->length, shares, share_count);
+        if (status != CODEX32_CHAR_ACCEPTED) {
+            share->values[share->length] = 0;
+            return status;
+        }
+    }
+    if (share->length + 1 == reader->final_length) {
+        codex32_residue_t residue = reader->residue;
+
+        codex32_checksum_update(&residue, value, long_checksum);
+        if (!codex32_checksum_verify(&residue, long_checksum)) {
+            share->values[share->length] = 0;
+            return CODEX32_CHAR_INVALID_CHECKSUM;
+        }
+        reader->residue = residue;
+        share->length++;
+        return CODEX32_SHARE_COMPLETE;
+    }
+    codex32_checksum_update(&reader->residue, value, long_checksum);
+    share->length++;
+    return CODEX32_CHAR_ACCEPTED;
+}
+
+bool codex32_reader_char_remove(codex32_reader_t *reader) {
+    codex32_share_t *share = &reader->share;
+    const bool long_checksum = codex32_long_checksum(reader->final_length);
+
+    if (share->length == 0) {
+        return false;
+    }
+    share->values[--share->length] = 0;
+    // the checksum has no inverse step, it is absorbed again from the start
+    codex32_checksum_init(&reader->residue);
+    for (size_t i = 0; i < share->length; i++) {
+        codex32_checksum_update(&reader->residue, share->values[i], long_checksum);
+    }
+    return true;
+}
+
+bool codex32_shares_complete(const codex32_share_t *shares, size_t share_count) {
+    if (share_count == 0) {
+        return false;
+    }
+    for (size_t i = 0; i < share_count; i++) {
+        if (shares[i].values[CODEX32_HEADER_LENGTH - 1] == CODEX32_SECRET_INDEX) {
+            return true;
+        }
+    }
+    return share_count >= codex32_threshold(&shares[0]);
+}
+
+// a * b, b being given by its logarithm
+static uint8_t gf32_mul_log(uint8_t a, uint8_t log_b) {
+    return a == 0 ? 0 : GF32_EXP[GF32_LOG[a] + log_b];
+}
+
+size_t codex32_combine(const codex32_share_t *shares,
+                       size_t share_count,
+                       uint8_t *secret,
+                       size_t secret_size) {
+    uint8_t payload[CODEX32_MAX_LENGTH] = {0};
+    const codex32_share_t *first = &shares[0];
+    const size_t length = first->length;
+    const size_t checksum_length = codex32_long_checksum(length) ? CODEX32_LONG_CHECKSUM_LENGTH
+                                                                 : CODEX32_SHORT_CHECKSUM_LENGTH;
+    const size_t secret_length = (length - CODEX32_HEADER_LENGTH - checksum_length) * 5 / 8;
+    const codex32_share_t *secret_share = NULL;
+    size_t n = 0;
+
+    if (!codex32_shares_complete(shares, share_count) || secret_length > secret_size) {
+        return 0;
+    }
+    for (size_t i = 0; i < share_count; i++) {
+        if (shares[i].length != length) {
+            return 0;
+        }
+        if (shares[i].values[CODEX32_HEADER_LENGTH - 1] == CODEX32_SECRET_INDEX) {
+            secret_share = &shares[i];
+        }
+    }
+    share_count = codex32_threshold(first);
+
+    if (secret_share != NULL) {
+        memcpy(payload, secret_share->values, length);
+    } else {
+        // Lagrange basis polynomials at the secret index, over the first threshold shares
+        for (size_t i = 0; i < share_count; i++) {
+            const uint8_t x_i = shares[i].values[CODEX32_HEADER_LENGTH - 1];
+            unsigned int log_l = 0;
+
+            for (size_t j = 0; j < share_count; j++) {
+                const uint8_t x_j = shares[j].values[CODEX32_HEADER_LENGTH - 1];
+
+                if (j == i) {
+                    continue;
+                }
+                if (x_i == x_j) {
+                    return 0;
+                }
+                log_l += GF32_LOG[CODEX32_SECRET_INDEX ^ x_j] + GF32_ORDER - GF32_LOG[x_i ^ x_j];
+                log_l %= GF32_ORDER;
+            }
+            for (size_t c = CODEX32_HEADER_LENGTH; c < length - checksum_length; c++) {
+                payload[c] ^= gf32_mul_log(shares[i].values[c], log_l);
+            }
+        }
+    }
+
+    // the payload bits, the padding ones being dropped
+    uint32_t accumulator = 0;
+    unsigned int bits = 0;
+    for (size_t c = CODEX32_HEADER_LENGTH; n < secret_length; c++) {
+        accumulator = (accumulator << 5) | payload[c];
+        bits += 5;
+        if (bits >= 8) {
+            bits -= 8;
+            secret[n++] = accumulator >> bits;
+            accumulator &= (1 << bits) - 1;
+        }
+    }
+    memzero(payload, sizeof(payload));
+    return secret_length;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// codex32 shares (BIP93): the data part of a share, following its "ms1" prefix, is a string of
+// bech32 characters (5-bit values): threshold (0 for an unshared secret, else 2 to 9), 4-character
+// identifier, share index, the share value right-padded with at most 4 bits, and a BCH checksum
+// of 13 characters (15 for a data part longer than CODEX32_SHORT_MAX_LENGTH characters).
+//
+// The shares are points of a polynomial over GF(32), the secret being the share of index 's'.
+#define CODEX32_HRP                   "ms"
+#define CODEX32_CHARSET               "qpzry9x8gf2tvdw0s3jn54khce6mua7l"
+#define CODEX32_HEADER_LENGTH         6
+#define CODEX32_SHORT_CHECKSUM_LENGTH 13
+#define CODEX32_LONG_CHECKSUM_LENGTH  15
+#define CODEX32_SHORT_MAX_LENGTH      93
+#define CODEX32_PAYLOAD_LENGTH(secret_length) (((secret_length) * 8 + 4) / 5)
+// data part without its checksum, and the length of the checksum following it
+#define CODEX32_UNCHECKED_LENGTH(secret_length) \
+    (CODEX32_HEADER_LENGTH + CODEX32_PAYLOAD_LENGTH(secret_length))
+#define CODEX32_CHECKSUM_LENGTH(unchecked_length)                                \
+    ((unchecked_length) + CODEX32_SHORT_CHECKSUM_LENGTH <= CODEX32_SHORT_MAX_LENGTH \
+         ? CODEX32_SHORT_CHECKSUM_LENGTH                                          \
+         : CODEX32_LONG_CHECKSUM_LENGTH)
+#define CODEX32_LENGTH(secret_length)         \
+    (CODEX32_UNCHECKED_LENGTH(secret_length) + \
+     CODEX32_CHECKSUM_LENGTH(CODEX32_UNCHECKED_LENGTH(secret_length)))
+#define CODEX32_MIN_SECRET_SIZE 16
+#define CODEX32_MAX_SECRET_SIZE 64
+#define CODEX32_MAX_LENGTH      CODEX32_LENGTH(CODEX32_MAX_SECRET_SIZE)  // 124 characters
+#define CODEX32_MAX_THRESHOLD   9
+// value of the 's' character, index of the secret
+#define CODEX32_SECRET_INDEX 16
+
+// value of a bech32 character (either case), -1 if it is not one
+int8_t codex32_char_value(char c);
+
+// BCH checksum over GF(32), of up to 75 bits, computed a character at a time: each character
+// costs a shift and the lookup of the generator multiples of the 5 bits shifted out
+typedef struct {
+    uint64_t low;
+    uint16_t high;
+} codex32_residue_t;
+
+// absorb the expansion of CODEX32_HRP
+void codex32_checksum_init(codex32_residue_t *residue);
+void codex32_checksum_update(codex32_residue_t *residue, uint8_t value, bool long_checksum);
+// whether the characters absorbed so far end with a valid checksum
+bool codex32_checksum_verify(const codex32_residue_t *residue, bool long_checksum);
+
+typedef struct {
+    // 5-bit values of the data part
+    uint8_t values[CODEX32_MAX_LENGTH];
+    uint8_t length;
+} codex32_share_t;
+
+// Shares are read a character at a time, so that a mistyped character is reported as soon as it
+// is known:
+// - its 1st character is the threshold, which has to be the one of the previous shares,
+// - its next 4 ones the identifier, which has to be the one of the previous shares,
+// - its 6th one the share index, which has to be 's' for a threshold of 0, and not be the index
+//   of a previous share,
+// - its final one completes the checksum, updated with each character.
+typedef enum {
+    CODEX32_CHAR_ACCEPTED,
+    CODEX32_SHARE_COMPLETE,
+    CODEX32_CHAR_INVALID,           // not a bech32 character
+    CODEX32_CHAR_INVALID_HEADER,    // the threshold or the share index is invalid
+    CODEX32_CHAR_MISMATCH,          // the share does not belong with the previous ones
+    CODEX32_CHAR_INVALID_CHECKSUM,  // a character of the share is wrong
+} codex32_char_status_t;
+
+typedef struct {
+    codex32_share_t share;
+    uint8_t final_length;
+    codex32_residue_t residue;
+} codex32_reader_t;
+
+// start reading a share of a secret_length bytes long secret, return false if not supported
+bool codex32_reader_start(codex32_reader_t *reader, size_t secret_length);
+// add a character to the share, checked against the shares already read: the character is only
+// kept if accepted, the share being output in reader->share once complete
+codex32_char_status_t codex32_reader_char_add(codex32_reader_t *reader,
+                                              char c,
+                                              const codex32_share_t *shares,
+                                              size_t share_count);
+// remove the latest character, return false if there is none: the checksum is absorbed again
+bool codex32_reader_char_remove(codex32_reader_t *reader);
+
+// whether the shares, read by codex32_reader_char_add, reach their threshold (or hold the secret)
+bool codex32_shares_complete(const codex32_share_t *shares, size_t share_count);
+
+// recover the secret from shares reaching their threshold, by Lagrange interpolation at the
+// index 's', return its length or 0 if the shares are inconsistent
+size_t codex32_combine(const codex32_share_t *shares,
+                       size_t share_count,
+                       uint8_t *secret,
+                       size_t secret_size);
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #define ALPHABET_LENGTH 27
 #define KBD_LETTERS     "qwertyuiopasdfghjklzxcvbnm"
 
@@ -27,4 +31,74 @@
 #define SPRINTF(strbuf, ...) snprintf((char*) (strbuf), sizeof(strbuf), __VA_ARGS__)
 #endif
 
-bool compare_recovery_phrase(void);
+// The root key of the device's seed is derived once per session for all the comparisons, only a
+// keyed hash of it being kept in RAM: device_root_key_ticker, run on each ticker event, zeroes it
+// after DEVICE_ROOT_KEY_TIMEOUT_TICKS events without user input (device_root_key_activity), and
+// device_root_key_clear on exit. The BIP85 node derived from the device's seed (see bip85.h, only
+// used on Stax and Flex) is dropped along with it.
+#define DEVICE_ROOT_KEY_TIMEOUT_TICKS (5 * 60 * 10)  // 5 minutes of 100 ms ticker events
+
+void device_root_key_activity(void);
+void device_root_key_ticker(void);
+void device_root_key_clear(void);
+
+// The recovery phrase is compared to the device's seed in stages, so that the PBKDF2 rounds of
+// the seed derivation are spread over the ticker events instead of blocking the UI:
+// - compare_recovery_phrase_start converts the entered phrase into the PBKDF2 state,
+// - compare_recovery_phrase_step runs a bounded number of rounds and returns the progress (%),
+// - once it reaches 100, compare_recovery_phrase_finish compares the root keys.
+// compare_recovery_phrase_cancel drops the pending derivation, zeroing its state.
+// Nano S has no RAM left to keep the PBKDF2 state between two ticker events: the seed is derived
+// at once by compare_recovery_phrase_start, compare_recovery_phrase_step then returning 100.
+#define COMPARE_RECOVERY_PHRASE_ROUNDS_PER_STEP 128
+
+bool compare_recovery_phrase_start(void);
+bool compare_recovery_phrase_pending(void);
+uint8_t compare_recovery_phrase_step(void);
+bool compare_recovery_phrase_finish(void);
+void compare_recovery_phrase_cancel(void);
+
+// A BIP32 master seed recovered as such (a codex32 secret, 16 to 64 bytes long, the 64-byte one
+// being the seed of a BIP39 phrase) is compared to the device's seed at once, having no PBKDF2
+// rounds to run
+bool compare_master_seed(const uint8_t* seed, size_t seed_length);
+
+// While the final word of a BIP39 phrase is entered, the idle ticker events are used to derive the
+// seed of the likeliest candidate (the first checksum-valid word matching the typed prefix):
+// compare_recovery_phrase_start resumes that derivation if the phrase is completed with this word.
+// Speculation only starts COMPARE_RECOVERY_PHRASE_SPECULATION_IDLE_TICKS ticker events after the
+// last user input, and runs fewer rounds per event than the comparison itself, so that typing
+// stays responsive. Not available on Nano S, for the same lack of RAM.
+#if !defined(TARGET_NANOS)
+#define COMPARE_RECOVERY_PHRASE_SPECULATION_IDLE_TICKS       5
+#define COMPARE_RECOVERY_PHRASE_SPECULATION_ROUNDS_PER_STEP 32
+void compare_recovery_phrase_speculate(const unsigned char* entropy,
+                                       unsigned int word_count,
+                                       unsigned int candidate);
+#endif
+
+// The phrase matching the device's seed is searched for in the same way among the variants of an
+// entered BIP39 phrase: the seeds of the variants with a valid checksum are derived one after the
+// other, until one matches the device's seed. The variants are either:
+// - the words completing the phrase at an unknown position (phrase_search_missing_word_start),
+//   2048 / 2^CS of them being checksum-valid, CS being the checksum length,
+// - its adjacent swaps, and its words replaced by a near one (see bolos_ux_bip39_words_near),
+//   to repair a mistyped phrase (phrase_search_repair_start): the near words of each word are
+//   enumerated from its stem (bolos_ux_bip39_near_word), in BIP39_NEAR_WORD_SLOTS variants.
+// phrase_search_step scans at most PHRASE_SEARCH_SCANS_PER_STEP variants, checking the checksum
+// of at most PHRASE_SEARCH_CHECKS_PER_STEP of them, runs a bounded number of rounds and returns
+// the progress (%). Once it reaches 100, phrase_search_finish outputs the found phrase if any.
+// phrase_search_cancel drops the pending search, zeroing its state. Only offered on Stax and Flex.
+#if defined(HAVE_NBGL)
+#define PHRASE_SEARCH_SCANS_PER_STEP  512
+#define PHRASE_SEARCH_CHECKS_PER_STEP 64
+
+bool phrase_search_missing_word_start(const unsigned char* entropy,
+                                      unsigned int word_count,
+                                      unsigned int position);
+bool phrase_search_repair_start(const unsigned char* entropy, unsigned int word_count);
+bool phrase_search_pending(void);
+uint8_t phrase_search_step(void);
+bool phrase_search_finish(unsigned char* entropy);
+void phrase_search_cancel(void);
+#endif
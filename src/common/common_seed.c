@@ -16,74 +16,497 @@
  ********************************************************************************/
 
 #include <lcx_hmac.h>
+#include <lcx_rng.h>
 
 #include "constants.h"
 #include "ui.h"
 #include "./common.h"
 #include "./bip39/common_bip39.h"
+#include "./bip85.h"
 #if defined(HAVE_NBGL)
 #include "../nbgl/bip39_mnemonic.h"
 extern unsigned int onboarding_type;
 #endif
 
-bool compare_recovery_phrase(void) {
-    // convert mnemonic to hex-seed
-    uint8_t buffer[64];
+// ticker events since the last user input, up to DEVICE_ROOT_KEY_TIMEOUT_TICKS
+static unsigned int idle_ticks;
+
+// seed derivation, pending between two steps, and its speculative run while the final word of a
+// BIP39 phrase is being entered
+static struct {
+#if defined(TARGET_NANOS)
+    // the seed being derived at once, only the result of the comparison is kept
+    bool matches;
+#else
+    pbkdf2_sha512_t pbkdf2;
+#endif
+    // set by compare_recovery_phrase_start, the derivation is then that of the entered phrase
+    bool started;
+
+#if !defined(TARGET_NANOS)
+    // phrase being speculated on, its final word cleared
+    unsigned char entropy[BIP39_ENTROPY_MAX_LENGTH];
+    unsigned int word_count;
+    // final word whose seed is being derived in pbkdf2, if speculating
+    bool speculating;
+    uint16_t speculative_word;
+#endif
+} seed_derivation;
+
+static bool seed_derivation_matches(pbkdf2_sha512_t* pbkdf2);
+
+#if !defined(TARGET_NANOS)
+// whether the speculative derivation is the one of the entered phrase
+static bool compare_recovery_phrase_resume(const unsigned char* entropy, unsigned int word_count) {
+    bool same = seed_derivation.speculating && seed_derivation.word_count == word_count &&
+                bolos_ux_bip39_entropy_word_get(entropy, word_count - 1) ==
+                    seed_derivation.speculative_word;
+
+    for (unsigned int i = 0; same && i < word_count - 1; i++) {
+        same = bolos_ux_bip39_entropy_word_get(entropy, i) ==
+               bolos_ux_bip39_entropy_word_get(seed_derivation.entropy, i);
+    }
+    if (!same) {
+        compare_recovery_phrase_cancel();
+        return false;
+    }
+    PRINTF("Resuming the speculative seed derivation\n");
+    seed_derivation.started = true;
+    return true;
+}
+#endif
+
+bool compare_recovery_phrase_start(void) {
+    cx_err_t error = CX_INVALID_PARAMETER;
+#if defined(TARGET_NANOS)
+    pbkdf2_sha512_t ctx;
+    pbkdf2_sha512_t* pbkdf2 = &ctx;
+#else
+    pbkdf2_sha512_t* pbkdf2 = &seed_derivation.pbkdf2;
+#endif
 
 #if defined(HAVE_BAGL)
+#ifdef HAVE_ELECTRUM
+    // the phrase is hashed with another salt, the speculative derivation being a BIP39 one
+    if (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39 &&
+        G_bolos_ux_context.onboarding_algorithm == BOLOS_UX_ONBOARDING_ALGORITHM_ELECTRUM) {
+        compare_recovery_phrase_cancel();
+        error = bolos_ux_electrum_mnemonic_to_seed_start(
+            pbkdf2,
+            (unsigned char*) G_bolos_ux_context.words_buffer,
+            G_bolos_ux_context.words_buffer_length);
+    } else
+#endif
     if (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_BIP39) {
-        bolos_ux_bip39_mnemonic_to_seed((unsigned char*) G_bolos_ux_context.words_buffer,
-                                        G_bolos_ux_context.words_buffer_length,
-                                        buffer);
+#if !defined(TARGET_NANOS)
+        if (compare_recovery_phrase_resume(G_bolos_ux_context.bip39_entropy,
+                                           G_bolos_ux_context.onboarding_kind)) {
+            return true;
+        }
+#endif
+        // the text of the entered words has no accents, the seed is derived from their indexes
+        error = bolos_ux_bip39_entropy_to_seed_start(pbkdf2,
+                                                     G_bolos_ux_context.bip39_entropy,
+                                                     G_bolos_ux_context.onboarding_kind);
     } else if (G_bolos_ux_context.onboarding_type == ONBOARDING_TYPE_SSKR) {
-        G_bolos_ux_context.words_buffer_length = sizeof(G_bolos_ux_context.words_buffer);
-        bolos_ux_sskr_to_seed_convert((unsigned char*) G_bolos_ux_context.sskr_words_buffer,
-                                      G_bolos_ux_context.sskr_words_buffer_length,
-                                      G_bolos_ux_context.sskr_share_count,
-                                      (unsigned char*) &G_bolos_ux_context.words_buffer,
-                                      &G_bolos_ux_context.words_buffer_length,
-                                      buffer);
+        compare_recovery_phrase_cancel();
+        // the phrase is kept as text, in case the BIP39 phrase is to be displayed afterwards
+        const unsigned int word_count = bolos_ux_sskr_to_bip39_entropy_convert(
+            (unsigned char*) G_bolos_ux_context.sskr_words_buffer,
+            G_bolos_ux_context.sskr_words_buffer_length,
+            G_bolos_ux_context.sskr_share_count,
+            G_bolos_ux_context.bip39_entropy);
+        G_bolos_ux_context.words_buffer_length =
+            bolos_ux_bip39_entropy_to_mnemonic(G_bolos_ux_context.bip39_entropy,
+                                               word_count,
+                                               (unsigned char*) G_bolos_ux_context.words_buffer,
+                                               sizeof(G_bolos_ux_context.words_buffer));
+        error = bolos_ux_bip39_entropy_to_seed_start(pbkdf2,
+                                                     G_bolos_ux_context.bip39_entropy,
+                                                     word_count);
+        memzero(G_bolos_ux_context.bip39_entropy, sizeof(G_bolos_ux_context.bip39_entropy));
     }
 #elif defined(HAVE_NBGL)
-    if (onboarding_type == ONBOARDING_TYPE_BIP39) {
-        bolos_ux_bip39_mnemonic_to_seed((const unsigned char *) bip39_mnemonic_get(),
-                                        bip39_mnemonic_length_get(),
-                                        buffer);
-    } else if (onboarding_type == ONBOARDING_TYPE_SSKR) {
-        bip39_mnemonic_from_sskr_shares(buffer);
+    if (onboarding_type == ONBOARDING_TYPE_SSKR) {
+        compare_recovery_phrase_cancel();
+        bip39_mnemonic_from_sskr_shares();
+    } else if (onboarding_type == ONBOARDING_TYPE_SLIP39) {
+        compare_recovery_phrase_cancel();
+        bip39_mnemonic_from_slip39_shares();
+    } else if (compare_recovery_phrase_resume(bip39_mnemonic_entropy_get(),
+                                              bip39_mnemonic_final_size_get())) {
+        return true;
     }
+    error = bolos_ux_bip39_entropy_to_seed_start(pbkdf2,
+                                                 bip39_mnemonic_entropy_get(),
+                                                 bip39_mnemonic_final_size_get());
 #endif
-    PRINTF("Input seed:\n %.*H\n", 64, buffer);
+#if defined(TARGET_NANOS)
+    if (error == CX_OK) {
+        error = pbkdf2_sha512_step(pbkdf2, pbkdf2->rounds_left);
+    }
+    seed_derivation.matches = error == CX_OK && seed_derivation_matches(pbkdf2);
+    memzero(&ctx, sizeof(ctx));
+#endif
+    seed_derivation.started = true;
+    return error == CX_OK;
+}
 
-    // get rootkey from hex-seed
+bool compare_recovery_phrase_pending(void) {
+    return seed_derivation.started;
+}
+
+uint8_t compare_recovery_phrase_step(void) {
+#if defined(TARGET_NANOS)
+    return 100;
+#else
+    pbkdf2_sha512_t* pbkdf2 = &seed_derivation.pbkdf2;
+
+    // a failed step zeroes the context, which is then reported as complete (and not matching)
+    if (pbkdf2_sha512_step(pbkdf2, COMPARE_RECOVERY_PHRASE_ROUNDS_PER_STEP) != CX_OK ||
+        pbkdf2->iterations == 0) {
+        return 100;
+    }
+    return (uint8_t) (100 * (pbkdf2->iterations - pbkdf2->rounds_left) / pbkdf2->iterations);
+#endif
+}
+
+void compare_recovery_phrase_cancel(void) {
+    memzero(&seed_derivation, sizeof(seed_derivation));
+}
+
+#if !defined(TARGET_NANOS)
+void compare_recovery_phrase_speculate(const unsigned char* entropy,
+                                       unsigned int word_count,
+                                       unsigned int candidate) {
+    bool same = seed_derivation.word_count == word_count;
+    unsigned int i;
+
+    // the rounds would delay the handling of the next key press
+    if (seed_derivation.started || idle_ticks < COMPARE_RECOVERY_PHRASE_SPECULATION_IDLE_TICKS ||
+        bolos_ux_bip39_final_word_candidate_count(word_count) == 0) {
+        return;
+    }
+
+    // editing the previous words drops all that was speculated on them
+    for (i = 0; same && i < word_count - 1; i++) {
+        same = bolos_ux_bip39_entropy_word_get(entropy, i) ==
+               bolos_ux_bip39_entropy_word_get(seed_derivation.entropy, i);
+    }
+    if (!same) {
+        compare_recovery_phrase_cancel();
+        memcpy(seed_derivation.entropy, entropy, sizeof(seed_derivation.entropy));
+        bolos_ux_bip39_entropy_word_set(seed_derivation.entropy, word_count - 1, 0);
+        seed_derivation.word_count = word_count;
+    }
+
+    // switch to the candidate once the previous one is no longer the likeliest, provided it
+    // completes the phrase into a valid one
+    if (candidate < BIP39_WORDLIST_COUNT &&
+        (!seed_derivation.speculating || seed_derivation.speculative_word != candidate)) {
+        memzero(&seed_derivation.pbkdf2, sizeof(seed_derivation.pbkdf2));
+        bolos_ux_bip39_entropy_word_set(seed_derivation.entropy, word_count - 1, candidate);
+        seed_derivation.speculating =
+            bolos_ux_bip39_entropy_check(seed_derivation.entropy, word_count) &&
+            bolos_ux_bip39_entropy_to_seed_start(&seed_derivation.pbkdf2,
+                                                 seed_derivation.entropy,
+                                                 word_count) == CX_OK;
+        seed_derivation.speculative_word = candidate;
+        bolos_ux_bip39_entropy_word_set(seed_derivation.entropy, word_count - 1, 0);
+    }
+    if (seed_derivation.speculating &&
+        pbkdf2_sha512_step(&seed_derivation.pbkdf2,
+                           COMPARE_RECOVERY_PHRASE_SPECULATION_ROUNDS_PER_STEP) != CX_OK) {
+        seed_derivation.speculating = false;
+    }
+}
+#endif
+
+// BIP32 root key (private key and chain code) of a master seed, the seed_length first bytes of the
+// buffer, computed in place
+static void seed_root_key(uint8_t buffer[64], size_t seed_length) {
     cx_hmac_sha512_t ctx;
     const char key[] = "Bitcoin seed";
 
     LEDGER_ASSERT(cx_hmac_sha512_init_no_throw(&ctx, (const uint8_t*) key, strlen(key)) == CX_OK,
                   "HMAC init failed");
-    LEDGER_ASSERT(cx_hmac_no_throw((cx_hmac_t*) &ctx, CX_LAST, buffer, 64, buffer, 64) == CX_OK,
-                  "HMAC failed");
-    PRINTF("Root key from input:\n%.*H\n", 64, buffer);
+    LEDGER_ASSERT(
+        cx_hmac_no_throw((cx_hmac_t*) &ctx, CX_LAST, buffer, seed_length, buffer, 64) == CX_OK,
+        "HMAC failed");
+    memzero(&ctx, sizeof(ctx));
+}
+
+// The root key of the device's seed is only kept as a keyed hash, computed once per session: the
+// root keys of the phrases are hashed with the same random key to be compared to it
+static struct {
+    uint8_t key[32];
+    uint8_t fingerprint[32];
+    bool cached;
+} device_root_key;
 
-    // get rootkey from device's seed
-    uint8_t buffer_device[64];
+static void root_key_fingerprint(const uint8_t root_key[64], uint8_t fingerprint[32]) {
+    cx_hmac_sha256_t ctx;
+
+    LEDGER_ASSERT(cx_hmac_sha256_init_no_throw(&ctx, device_root_key.key, 32) == CX_OK,
+                  "HMAC init failed");
+    LEDGER_ASSERT(cx_hmac_no_throw((cx_hmac_t*) &ctx, CX_LAST, root_key, 64, fingerprint, 32) ==
+                      CX_OK,
+                  "HMAC failed");
+    memzero(&ctx, sizeof(ctx));
+}
 
+// derive the BIP32 root key of the device's seed, unless it is cached
+static bool device_root_key_cache(void) {
     // os_derive_bip32* do not accept NULL path, even with a size of 0, so we provide an empty path
     const unsigned int empty_path = 0;
-    if (os_derive_bip32_no_throw(CX_CURVE_256K1,
-                                 &empty_path,
-                                 0,
-                                 buffer_device,
-                                 buffer_device + 32) != CX_OK) {
-        PRINTF("An error occurred while comparing the recovery phrase\n");
-        return 0;
-    }
-    PRINTF("Root key from device: \n%.*H\n", 64, buffer_device);
-
-    // compare both rootkey
-    const bool result = os_secure_memcmp(buffer, buffer_device, 64) ? false : true;
-    memzero(buffer_device, 64);
+    uint8_t buffer[64];
+
+    if (device_root_key.cached) {
+        return true;
+    }
+    if (os_derive_bip32_no_throw(CX_CURVE_256K1, &empty_path, 0, buffer, buffer + 32) != CX_OK) {
+        memzero(buffer, sizeof(buffer));
+        return false;
+    }
+    cx_rng_no_throw(device_root_key.key, sizeof(device_root_key.key));
+    root_key_fingerprint(buffer, device_root_key.fingerprint);
+    memzero(buffer, sizeof(buffer));
+    device_root_key.cached = true;
+    return true;
+}
+
+// whether the root key is the one of the device's seed or not
+static bool device_root_key_matches(const uint8_t root_key[64]) {
+    uint8_t fingerprint[32];
+    bool matches;
+
+    if (!device_root_key_cache()) {
+        PRINTF("An error occurred while deriving the device root key\n");
+        return false;
+    }
+    root_key_fingerprint(root_key, fingerprint);
+    matches = os_secure_memcmp(fingerprint, device_root_key.fingerprint, 32) == 0;
+    memzero(fingerprint, sizeof(fingerprint));
+    return matches;
+}
+
+void device_root_key_activity(void) {
+    idle_ticks = 0;
+}
+
+void device_root_key_ticker(void) {
+    if (idle_ticks < DEVICE_ROOT_KEY_TIMEOUT_TICKS) {
+        idle_ticks++;
+    }
+#if defined(HAVE_NBGL)
+    if ((device_root_key.cached || bip85_node_cached()) &&
+        idle_ticks >= DEVICE_ROOT_KEY_TIMEOUT_TICKS) {
+#else
+    if (device_root_key.cached && idle_ticks >= DEVICE_ROOT_KEY_TIMEOUT_TICKS) {
+#endif
+        PRINTF("Inactivity timeout, dropping the device root key\n");
+        device_root_key_clear();
+    }
+}
+
+void device_root_key_clear(void) {
+    memzero(&device_root_key, sizeof(device_root_key));
+#if defined(HAVE_NBGL)
+    bip85_node_clear();
+#endif
+}
+
+// whether the seed derived in the PBKDF2 state is the device's one, the state being zeroed
+static bool seed_derivation_matches(pbkdf2_sha512_t* pbkdf2) {
+    // convert mnemonic to hex-seed
+    uint8_t buffer[64];
+
+    if (pbkdf2_sha512_final(pbkdf2, buffer, sizeof(buffer)) != CX_OK) {
+        PRINTF("An error occurred while deriving the recovery phrase seed\n");
+        memzero(buffer, sizeof(buffer));
+        return false;
+    }
+    PRINTF("Input seed:\n %.*H\n", 64, buffer);
+
+    // get rootkey from hex-seed
+    seed_root_key(buffer, sizeof(buffer));
+    PRINTF("Root key from input:\n%.*H\n", 64, buffer);
+
+    // compare it to the device's one
+    const bool result = device_root_key_matches(buffer);
     memzero(buffer, 64);
 
     return result;
 }
+
+bool compare_recovery_phrase_finish(void) {
+#if defined(TARGET_NANOS)
+    const bool result = seed_derivation.matches;
+#else
+    const bool result = seed_derivation_matches(&seed_derivation.pbkdf2);
+#endif
+    compare_recovery_phrase_cancel();
+    return result;
+}
+
+bool compare_master_seed(const uint8_t* seed, size_t seed_length) {
+    uint8_t buffer[64];
+
+    if (seed_length > sizeof(buffer)) {
+        return false;
+    }
+    memcpy(buffer, seed, seed_length);
+    seed_root_key(buffer, seed_length);
+    const bool result = device_root_key_matches(buffer);
+    memzero(buffer, sizeof(buffer));
+
+    return result;
+}
+
+#if defined(HAVE_NBGL)
+// search among the variants of a phrase for the one matching the device's seed, the seeds of the
+// checksum-valid ones being derived one after the other in seed_derivation.pbkdf2
+static struct {
+    // phrase as entered, and the variant being tried
+    unsigned char phrase[BIP39_ENTROPY_MAX_LENGTH];
+    unsigned char entropy[BIP39_ENTROPY_MAX_LENGTH];
+    unsigned int word_count;
+    // the unknown word when looking for it, (unsigned int)-1 when repairing the phrase
+    unsigned int position;
+    // next variant to try, out of variant_count
+    unsigned int next;
+    unsigned int variant_count;
+    bool deriving;
+    bool found;
+} phrase_search;
+
+static bool phrase_search_start(const unsigned char* entropy,
+                                unsigned int word_count,
+                                unsigned int position,
+                                unsigned int variant_count) {
+    compare_recovery_phrase_cancel();
+    phrase_search_cancel();
+    if (bolos_ux_bip39_final_word_candidate_count(word_count) == 0) {
+        return false;
+    }
+    // the root keys of the candidates are compared to the device's one
+    if (!device_root_key_cache()) {
+        PRINTF("An error occurred while deriving the device root key\n");
+        return false;
+    }
+    memcpy(phrase_search.phrase, entropy, sizeof(phrase_search.phrase));
+    phrase_search.word_count = word_count;
+    phrase_search.position = position;
+    phrase_search.variant_count = variant_count;
+    return true;
+}
+
+bool phrase_search_missing_word_start(const unsigned char* entropy,
+                                      unsigned int word_count,
+                                      unsigned int position) {
+    return position < word_count &&
+           phrase_search_start(entropy, word_count, position, BIP39_WORDLIST_COUNT);
+}
+
+bool phrase_search_repair_start(const unsigned char* entropy, unsigned int word_count) {
+    // the adjacent swaps, then each word replaced by each of its near words
+    return word_count > 1 &&
+           phrase_search_start(entropy,
+                               word_count,
+                               (unsigned int) -1,
+                               word_count - 1 + word_count * BIP39_NEAR_WORD_SLOTS);
+}
+
+bool phrase_search_pending(void) {
+    return phrase_search.word_count != 0;
+}
+
+// set the entropy to the n-th variant of the phrase, returns false if it is not worth checking
+static bool phrase_search_variant(unsigned int n) {
+    unsigned char* entropy = phrase_search.entropy;
+    const unsigned int word_count = phrase_search.word_count;
+
+    memcpy(entropy, phrase_search.phrase, sizeof(phrase_search.phrase));
+    if (phrase_search.position != (unsigned int) -1) {
+        bolos_ux_bip39_entropy_word_set(entropy, phrase_search.position, n);
+        return true;
+    }
+    if (n < word_count - 1) {
+        const unsigned int first = bolos_ux_bip39_entropy_word_get(entropy, n);
+        const unsigned int second = bolos_ux_bip39_entropy_word_get(entropy, n + 1);
+        bolos_ux_bip39_entropy_word_set(entropy, n, second);
+        bolos_ux_bip39_entropy_word_set(entropy, n + 1, first);
+        return first != second;
+    }
+    n -= word_count - 1;
+    const unsigned int position = n / BIP39_NEAR_WORD_SLOTS;
+    const unsigned int word =
+        bolos_ux_bip39_near_word(bolos_ux_bip39_entropy_word_get(entropy, position),
+                                 n % BIP39_NEAR_WORD_SLOTS);
+    if (word >= BIP39_WORDLIST_COUNT) {
+        return false;
+    }
+    bolos_ux_bip39_entropy_word_set(entropy, position, word);
+    return true;
+}
+
+uint8_t phrase_search_step(void) {
+    pbkdf2_sha512_t* pbkdf2 = &seed_derivation.pbkdf2;
+    unsigned int scans = 0;
+    unsigned int checks = 0;
+
+    // only the variants giving a valid checksum have their seed derived
+    while (!phrase_search.deriving && !phrase_search.found &&
+           phrase_search.next < phrase_search.variant_count &&
+           scans++ < PHRASE_SEARCH_SCANS_PER_STEP && checks < PHRASE_SEARCH_CHECKS_PER_STEP) {
+        if (!phrase_search_variant(phrase_search.next++)) {
+            continue;
+        }
+        checks++;
+        phrase_search.deriving =
+            bolos_ux_bip39_entropy_check(phrase_search.entropy, phrase_search.word_count) &&
+            bolos_ux_bip39_entropy_to_seed_start(pbkdf2,
+                                                 phrase_search.entropy,
+                                                 phrase_search.word_count) == CX_OK;
+    }
+
+    if (phrase_search.deriving) {
+        if (pbkdf2_sha512_step(pbkdf2, COMPARE_RECOVERY_PHRASE_ROUNDS_PER_STEP) != CX_OK) {
+            // a failed derivation is that of a candidate which does not match
+            phrase_search.deriving = false;
+        } else if (pbkdf2->rounds_left == 0) {
+            phrase_search.deriving = false;
+            phrase_search.found = seed_derivation_matches(pbkdf2);
+        }
+    }
+
+    if (phrase_search.found ||
+        (!phrase_search.deriving && phrase_search.next >= phrase_search.variant_count)) {
+        return 100;
+    }
+    // the variants tried so far, the one being derived only counting for the rounds already run
+    uint32_t done = 100 * phrase_search.next;
+    if (phrase_search.deriving && pbkdf2->iterations != 0) {
+        done -= 100 * pbkdf2->rounds_left / pbkdf2->iterations;
+    }
+    return (uint8_t) (done / phrase_search.variant_count);
+}
+
+bool phrase_search_finish(unsigned char* entropy) {
+    const bool found = phrase_search.found;
+
+    if (found) {
+        memcpy(entropy, phrase_search.entropy, sizeof(phrase_search.entropy));
+    }
+    phrase_search_cancel();
+    return found;
+}
+
+void phrase_search_cancel(void) {
+    // the derivation state is shared with the comparison, only dropped if a search is running
+    if (phrase_search_pending()) {
+        memzero(&seed_derivation.pbkdf2, sizeof(seed_derivation.pbkdf2));
+    }
+    memzero(&phrase_search, sizeof(phrase_search));
+}
+#endif
@@ -17,88 +17,138 @@
 
 #ifdef HAVE_ELECTRUM
 
-#include "common.h"
-
-int cx_math_shiftr_11(unsigned char *r, unsigned int len) {
-    unsigned int j, b11;
-    b11 = r[len - 1] | ((r[len - 2] & 7) << 8);
+#include <os.h>
+#include <cx.h>
 
-    for (j = len - 2; j > 0; j--) {
-        r[j + 1] = (r[j] >> 3) | (r[j - 1] << 5);
-    }
-    r[1] = r[0] >> 3;
-    r[0] = 0;
+#include "common.h"
+#include "bits11.h"
+#include "bip39/common_bip39.h"
 
-    return b11;
-}
+#define ELECTRUM_WORD_COUNT 12
+// 132 bits, the 4 most significant bits of the first byte being 0
+#define ELECTRUM_SEED_LENGTH 17
+// the nonce is the 32 least significant bits of the seed, held by its first 3 words
+#define ELECTRUM_NONCE_WORDS 3
+#define ELECTRUM_NONCE_TEXT_MAX_LENGTH \
+    (ELECTRUM_NONCE_WORDS * (BIP39_WORDLIST_WORD_LETTERS + 1) - 1)
+#define ELECTRUM_MNEMONIC_MAX_LENGTH (ELECTRUM_WORD_COUNT * (BIP39_WORDLIST_WORD_LETTERS + 1))
 
-static unsigned int bolos_ux_electrum_bip39_mnemonic_encode(const uint8_t *seed17,
-                                                            uint8_t *out,
-                                                            size_t out_length) {
-    unsigned char tmp[17];
-    unsigned int i;
+// write the words [first, last) of the mnemonic, separated by spaces, a space preceding the
+// first of them unless it is the first word of the mnemonic
+static unsigned int electrum_words_encode(const uint16_t indexes[ELECTRUM_WORD_COUNT],
+                                          unsigned int first,
+                                          unsigned int last,
+                                          unsigned char *out) {
+    unsigned char word[BIP39_WORDLIST_WORD_LETTERS + 1];
     unsigned int offset = 0;
-    memcpy(tmp, seed17, sizeof(tmp));
-    for (i = 0; i < 12; i++) {
-        unsigned char word_length;
-        unsigned int idx = cx_math_shiftr_11(tmp, sizeof(tmp));
-        word_length = BIP39_WORDLIST_OFFSETS[idx + 1] - BIP39_WORDLIST_OFFSETS[idx];
-        if ((offset + word_length) > out_length) {
-            THROW(INVALID_PARAMETER);
-        }
-        memcpy(out + offset, BIP39_WORDLIST + BIP39_WORDLIST_OFFSETS[idx], word_length);
-        offset += word_length;
-        if (i < 11) {
-            if (offset > out_length) {
-                THROW(INVALID_PARAMETER);
-            }
+
+    for (unsigned int i = first; i < last; i++) {
+        // the seed is a big number whose least significant 11 bits give the first word
+        const unsigned int word_length =
+            bolos_ux_bip39_idx_strcpy(indexes[ELECTRUM_WORD_COUNT - 1 - i], word);
+        if (i > 0) {
             out[offset++] = ' ';
         }
+        memcpy(out + offset, word, word_length);
+        offset += word_length;
     }
+    memzero(word, sizeof(word));
     return offset;
 }
 
+// the version is the first byte of HMAC-SHA512("Seed version", mnemonic)
+static bool electrum_version_matches(const hmac_sha512_key_t *key,
+                                     unsigned int version,
+                                     const unsigned char *mnemonic,
+                                     unsigned int mnemonic_length) {
+    unsigned char mac[PBKDF2_SHA512_LENGTH];
+    bool matches;
+
+    matches = hmac_sha512_keyed(key, mnemonic, mnemonic_length, mac) == CX_OK && mac[0] == version;
+    memzero(mac, sizeof(mac));
+    return matches;
+}
+
 unsigned int bolos_ux_electrum_new_bip39_mnemonic(unsigned int version,
                                                   unsigned char *out,
                                                   unsigned int out_length) {
-    unsigned char seed[17];
-    unsigned int nonce;
-    unsigned int offset;
-    // Initialize a proper seed <= 132 bits
-    for (;;) {
-        cx_rng(seed, sizeof(seed));
-        if (seed[0] < 0x10) {
-            break;
-        }
+    unsigned char seed[ELECTRUM_SEED_LENGTH];
+    uint16_t indexes[ELECTRUM_WORD_COUNT];
+    // the nonce words are rewritten in front of the text of the other words, which is encoded once
+    unsigned char text[ELECTRUM_NONCE_TEXT_MAX_LENGTH + ELECTRUM_MNEMONIC_MAX_LENGTH];
+    unsigned char *const tail = text + ELECTRUM_NONCE_TEXT_MAX_LENGTH;
+    unsigned char *head;
+    unsigned int tail_length, head_length, length = 0;
+    hmac_sha512_key_t key;
+    uint32_t nonce;
+
+    if (hmac_sha512_key_init(&key, ELECTRUM_SEED_VERSION, ELECTRUM_SEED_VERSION_LENGTH) != CX_OK) {
+        return 0;
     }
+    // Initialize a proper seed of 132 bits, the most significant word not being the first of the
+    // wordlist as Electrum would then encode it with 11 words only
+    do {
+        cx_rng_no_throw(seed, sizeof(seed));
+        seed[0] &= 0x0F;
+        bits11_unpack(seed, 4, indexes, ELECTRUM_WORD_COUNT);
+    } while (indexes[0] == 0);
+    tail_length = electrum_words_encode(indexes, ELECTRUM_NONCE_WORDS, ELECTRUM_WORD_COUNT, tail);
+
     nonce = (seed[sizeof(seed) - 4] << 24) | (seed[sizeof(seed) - 3] << 16) |
             (seed[sizeof(seed) - 2] << 8) | (seed[sizeof(seed) - 1]);
-    // Find a nonce that matches the version
+    // Find a nonce that matches the version, only the words holding it being re-encoded
     for (;;) {
         nonce++;
         seed[sizeof(seed) - 4] = (nonce >> 24);
         seed[sizeof(seed) - 3] = (nonce >> 16);
         seed[sizeof(seed) - 2] = (nonce >> 8);
         seed[sizeof(seed) - 1] = nonce;
-        offset = bolos_ux_electrum_bip39_mnemonic_encode(seed, out, out_length);
-        if (bolos_ux_electrum_bip39_mnemonic_check(version, out, offset)) {
+        // the 33 least significant bits: the nonce and the lowest bit of the byte before it
+        bits11_unpack(seed + sizeof(seed) - 5,
+                      7,
+                      indexes + ELECTRUM_WORD_COUNT - ELECTRUM_NONCE_WORDS,
+                      ELECTRUM_NONCE_WORDS);
+        head_length = electrum_words_encode(indexes, 0, ELECTRUM_NONCE_WORDS, text);
+        head = tail - head_length;
+        memmove(head, text, head_length);
+        if (electrum_version_matches(&key, version, head, head_length + tail_length)) {
             break;
         }
     }
-    return offset;
+    if (head_length + tail_length <= out_length) {
+        length = head_length + tail_length;
+        memcpy(out, head, length);
+    }
+    memzero(seed, sizeof(seed));
+    memzero(indexes, sizeof(indexes));
+    memzero(text, sizeof(text));
+    memzero(&key, sizeof(key));
+    nonce = 0;
+    return length;
 }
 
 unsigned int bolos_ux_electrum_bip39_mnemonic_check(unsigned int version,
                                                     unsigned char *mnemonic,
                                                     unsigned int mnemonic_length) {
-    unsigned char tmp[64];
-    cx_hmac_sha512(ELECTRUM_SEED_VERSION,
-                   ELECTRUM_SEED_VERSION_LENGTH,
-                   mnemonic,
-                   mnemonic_length,
-                   tmp,
-                   64);
-    return (tmp[0] == version);
+    hmac_sha512_key_t key;
+    unsigned int valid =
+        hmac_sha512_key_init(&key, ELECTRUM_SEED_VERSION, ELECTRUM_SEED_VERSION_LENGTH) == CX_OK &&
+        electrum_version_matches(&key, version, mnemonic, mnemonic_length);
+
+    memzero(&key, sizeof(key));
+    return valid;
+}
+
+cx_err_t bolos_ux_electrum_mnemonic_to_seed_start(pbkdf2_sha512_t *ctx,
+                                                  const unsigned char *mnemonic,
+                                                  unsigned int mnemonic_length) {
+    // without passphrase, the salt is "electrum"
+    return pbkdf2_sha512_init(ctx,
+                              mnemonic,
+                              mnemonic_length,
+                              ELECTRUM_MNEMONIC,
+                              ELECTRUM_MNEMONIC_LENGTH,
+                              ELECTRUM_PBKDF2_ROUNDS);
 }
 
 #endif
@@ -0,0 +1,419 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <os.h>
+
+#include "../common.h"
+#include "./qrcode.h"
+
+// codewords of the versions at the L level, the error correction ones following the data ones
+static const uint8_t QRCODE_DATA_CODEWORDS[QRCODE_MAX_VERSION] = {19, 34, 55};
+static const uint8_t QRCODE_ECC_CODEWORDS[QRCODE_MAX_VERSION] = {7, 10, 15};
+#define QRCODE_MAX_DATA_CODEWORDS 55
+#define QRCODE_MAX_ECC_CODEWORDS  15
+
+// character count bits of the modes, up to the version 9
+#define QRCODE_MODE_BITS               4
+#define QRCODE_MODE_ALPHANUMERIC       0x2
+#define QRCODE_ALPHANUMERIC_COUNT_BITS 9
+#define QRCODE_MODE_BYTE               0x4
+#define QRCODE_BYTE_COUNT_BITS         8
+#define QRCODE_TERMINATOR_BITS 4
+#define QRCODE_PAD_BYTES       (0xec ^ 0x11)  // the pad bytes alternate 0xec and 0x11
+
+// the alphanumeric mode packs pairs of characters in 11 bits, a final single one in 6 bits
+static const char QRCODE_ALPHANUMERIC_CHARSET[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+#define QRCODE_ALPHANUMERIC_PAIR_BITS 11
+#define QRCODE_ALPHANUMERIC_CHAR_BITS 6
+
+// format information: error correction level and mask, BCH(15, 5) protected and XOR-masked
+#define QRCODE_ECL_L_BITS     0x1
+#define QRCODE_FORMAT_GEN     0x537
+#define QRCODE_FORMAT_XOR     0x5412
+#define QRCODE_MASK_COUNT     8
+#define QRCODE_PENALTY_RUN    3
+#define QRCODE_PENALTY_BLOCK  3
+#define QRCODE_PENALTY_FINDER 40
+#define QRCODE_PENALTY_DARK   10
+
+static void qrcode_module_set(qrcode_t *qrcode, uint8_t x, uint8_t y, bool dark) {
+    const size_t i = (size_t) y * qrcode->size + x;
+
+    if (dark) {
+        qrcode->modules[i / 8] |= 1 << (i % 8);
+    } else {
+        qrcode->modules[i / 8] &= ~(1 << (i % 8));
+    }
+}
+
+bool qrcode_module_get(const qrcode_t *qrcode, uint8_t x, uint8_t y) {
+    const size_t i = (size_t) y * qrcode->size + x;
+
+    return (qrcode->modules[i / 8] >> (i % 8)) & 1;
+}
+
+// whether the module belongs to a function pattern or to the format information, which the data
+// modules go around
+static bool qrcode_function_module(uint8_t size, uint8_t x, uint8_t y) {
+    // finder patterns with their separators, and the format information
+    if ((x < 9 && y < 9) || (x >= size - 8 && y < 9) || (x < 9 && y >= size - 8)) {
+        return true;
+    }
+    // timing patterns
+    if (x == 6 || y == 6) {
+        return true;
+    }
+    // alignment pattern of the versions 2 and above, centered 7 modules from the bottom-right
+    return size > QRCODE_SIZE(1) && x >= size - 9 && x <= size - 5 && y >= size - 9 &&
+           y <= size - 5;
+}
+
+// concentric squares centered on (x, y), dark but at the listed distances from the center
+static void qrcode_pattern_draw(qrcode_t *qrcode,
+                                uint8_t x,
+                                uint8_t y,
+                                uint8_t radius,
+                                uint8_t light1,
+                                uint8_t light2) {
+    for (int dy = -radius; dy <= radius; dy++) {
+        for (int dx = -radius; dx <= radius; dx++) {
+            const int distance = MAX(abs(dx), abs(dy));
+
+            if (x + dx >= 0 && x + dx < qrcode->size && y + dy >= 0 && y + dy < qrcode->size) {
+                qrcode_module_set(qrcode, x + dx, y + dy, distance != light1 && distance != light2);
+            }
+        }
+    }
+}
+
+static void qrcode_function_patterns_draw(qrcode_t *qrcode) {
+    const uint8_t size = qrcode->size;
+
+    for (uint8_t i = 0; i < size; i++) {
+        qrcode_module_set(qrcode, 6, i, i % 2 == 0);
+        qrcode_module_set(qrcode, i, 6, i % 2 == 0);
+    }
+    // the separators are the light outer square of the finder patterns
+    qrcode_pattern_draw(qrcode, 3, 3, 4, 2, 4);
+    qrcode_pattern_draw(qrcode, size - 4, 3, 4, 2, 4);
+    qrcode_pattern_draw(qrcode, 3, size - 4, 4, 2, 4);
+    if (qrcode->version > 1) {
+        qrcode_pattern_draw(qrcode, size - 7, size - 7, 2, 1, 1);
+    }
+}
+
+static void qrcode_format_draw(qrcode_t *qrcode, uint8_t mask) {
+    const uint8_t size = qrcode->size;
+    const uint16_t data = QRCODE_ECL_L_BITS << 3 | mask;
+    uint16_t remainder = data;
+
+    for (uint8_t i = 0; i < 10; i++) {
+        remainder = (remainder << 1) ^ ((remainder >> 9) * QRCODE_FORMAT_GEN);
+    }
+    const uint16_t bits = (data << 10 | remainder) ^ QRCODE_FORMAT_XOR;
+
+    // around the top-left finder pattern
+    for (uint8_t i = 0; i <= 5; i++) {
+        qrcode_module_set(qrcode, 8, i, (bits >> i) & 1);
+    }
+    qrcode_module_set(qrcode, 8, 7, (bits >> 6) & 1);
+    qrcode_module_set(qrcode, 8, 8, (bits >> 7) & 1);
+    qrcode_module_set(qrcode, 7, 8, (bits >> 8) & 1);
+    for (uint8_t i = 9; i < 15; i++) {
+        qrcode_module_set(qrcode, 14 - i, 8, (bits >> i) & 1);
+    }
+    // split between the top-right and bottom-left ones, along with the dark module
+    for (uint8_t i = 0; i < 8; i++) {
+        qrcode_module_set(qrcode, size - 1 - i, 8, (bits >> i) & 1);
+    }
+    for (uint8_t i = 8; i < 15; i++) {
+        qrcode_module_set(qrcode, 8, size - 15 + i, (bits >> i) & 1);
+    }
+    qrcode_module_set(qrcode, 8, size - 8, true);
+}
+
+// zigzag of 2 modules wide columns, from the bottom-right, skipping the vertical timing pattern:
+// the remainder bits following the codewords are left light
+static void qrcode_codewords_draw(qrcode_t *qrcode, const uint8_t *codewords, size_t count) {
+    const uint8_t size = qrcode->size;
+    size_t i = 0;
+
+    for (int right = size - 1; right >= 1; right -= 2) {
+        if (right == 6) {
+            right = 5;
+        }
+        const bool upward = ((right + 1) & 2) == 0;
+        for (uint8_t vertical = 0; vertical < size; vertical++) {
+            for (uint8_t j = 0; j < 2; j++) {
+                const uint8_t x = right - j;
+                const uint8_t y = upward ? size - 1 - vertical : vertical;
+
+                if (!qrcode_function_module(size, x, y) && i < count * 8) {
+                    qrcode_module_set(qrcode, x, y, (codewords[i / 8] >> (7 - i % 8)) & 1);
+                    i++;
+                }
+            }
+        }
+    }
+}
+
+static bool qrcode_mask_bit(uint8_t mask, uint8_t x, uint8_t y) {
+    switch (mask) {
+        case 0:
+            return (x + y) % 2 == 0;
+        case 1:
+            return y % 2 == 0;
+        case 2:
+            return x % 3 == 0;
+        case 3:
+            return (x + y) % 3 == 0;
+        case 4:
+            return (x / 3 + y / 2) % 2 == 0;
+        case 5:
+            return x * y % 2 + x * y % 3 == 0;
+        case 6:
+            return (x * y % 2 + x * y % 3) % 2 == 0;
+        default:
+            return ((x + y) % 2 + x * y % 3) % 2 == 0;
+    }
+}
+
+// XOR the data modules with the mask, applying it a second time removes it
+static void qrcode_mask_apply(qrcode_t *qrcode, uint8_t mask) {
+    for (uint8_t y = 0; y < qrcode->size; y++) {
+        for (uint8_t x = 0; x < qrcode->size; x++) {
+            if (!qrcode_function_module(qrcode->size, x, y) && qrcode_mask_bit(mask, x, y)) {
+                qrcode_module_set(qrcode, x, y, !qrcode_module_get(qrcode, x, y));
+            }
+        }
+    }
+}
+
+// runs of 5 modules or more of a color, and 1:1:3:1:1 finder-like patterns next to 4 light
+// modules, along the rows or the columns
+static uint32_t qrcode_lines_penalty(const qrcode_t *qrcode, bool columns) {
+    uint32_t penalty = 0;
+
+    for (uint8_t i = 0; i < qrcode->size; i++) {
+        uint16_t window = 0;
+        uint8_t run = 0;
+        bool color = false;
+
+        for (uint8_t j = 0; j < qrcode->size; j++) {
+            const bool dark = columns ? qrcode_module_get(qrcode, i, j)
+                                      : qrcode_module_get(qrcode, j, i);
+
+            if (run > 0 && dark == color) {
+                run++;
+                penalty += run == 5 ? QRCODE_PENALTY_RUN : run > 5 ? 1 : 0;
+            } else {
+                color = dark;
+                run = 1;
+            }
+            window = ((window << 1) | dark) & 0x7ff;
+            if (j >= 10 && (window == 0x5d0 || window == 0x05d)) {
+                penalty += QRCODE_PENALTY_FINDER;
+            }
+        }
+    }
+    return penalty;
+}
+
+static uint32_t qrcode_penalty(const qrcode_t *qrcode) {
+    const uint8_t size = qrcode->size;
+    uint32_t penalty = qrcode_lines_penalty(qrcode, false) + qrcode_lines_penalty(qrcode, true);
+    uint32_t dark = 0;
+
+    for (uint8_t y = 0; y < size; y++) {
+        for (uint8_t x = 0; x < size; x++) {
+            const bool color = qrcode_module_get(qrcode, x, y);
+
+            dark += color;
+            // 2x2 blocks of a color
+            if (x + 1 < size && y + 1 < size && qrcode_module_get(qrcode, x + 1, y) == color &&
+                qrcode_module_get(qrcode, x, y + 1) == color &&
+                qrcode_module_get(qrcode, x + 1, y + 1) == color) {
+                penalty += QRCODE_PENALTY_BLOCK;
+            }
+        }
+    }
+    // each 5% of deviation of the dark modules from half of them
+    const uint32_t total = (uint32_t) size * size;
+    penalty += QRCODE_PENALTY_DARK * (uint32_t) abs((int) (dark * 20) - (int) (total * 10)) / total;
+    return penalty;
+}
+
+static uint8_t gf256_mul(uint8_t a, uint8_t b) {
+    uint8_t product = 0;
+
+    // reduced by x^8 + x^4 + x^3 + x^2 + 1
+    for (int i = 7; i >= 0; i--) {
+        product = (product << 1) ^ ((product >> 7) * 0x1d);
+        product ^= ((b >> i) & 1) * a;
+    }
+    return product;
+}
+
+// remainder of the data codewords by the generator polynomial of the given degree, whose roots
+// are the powers of 2 from 2^0
+static void qrcode_ecc_compute(const uint8_t *data, size_t length, uint8_t *ecc, uint8_t degree) {
+    uint8_t generator[QRCODE_MAX_ECC_CODEWORDS] = {0};
+    uint8_t root = 1;
+
+    // coefficients from the highest degree, the leading 1 being implicit
+    generator[degree - 1] = 1;
+    for (uint8_t i = 0; i < degree; i++) {
+        for (uint8_t j = 0; j < degree; j++) {
+            generator[j] = gf256_mul(generator[j], root);
+            if (j + 1 < degree) {
+                generator[j] ^= generator[j + 1];
+            }
+        }
+        root = gf256_mul(root, 0x02);
+    }
+
+    memset(ecc, 0, degree);
+    for (size_t i = 0; i < length; i++) {
+        const uint8_t factor = data[i] ^ ecc[0];
+
+        memmove(ecc, ecc + 1, degree - 1);
+        ecc[degree - 1] = 0;
+        for (uint8_t j = 0; j < degree; j++) {
+            ecc[j] ^= gf256_mul(generator[j], factor);
+        }
+    }
+}
+
+static void qrcode_bits_append(uint8_t *buffer, size_t *bit_length, uint32_t value, uint8_t count) {
+    for (int i = count - 1; i >= 0; i--) {
+        if ((value >> i) & 1) {
+            buffer[*bit_length / 8] |= 0x80 >> (*bit_length % 8);
+        }
+        (*bit_length)++;
+    }
+}
+
+static int8_t qrcode_alphanumeric_value(char c) {
+    for (uint8_t i = 0; i < sizeof(QRCODE_ALPHANUMERIC_CHARSET) - 1; i++) {
+        if (QRCODE_ALPHANUMERIC_CHARSET[i] == c) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// encode a single segment of the given mode in the smallest version holding it, then pick the
+// mask of lowest penalty
+static bool qrcode_encode(qrcode_t *qrcode, uint8_t mode, const uint8_t *data, size_t length) {
+    uint8_t codewords[QRCODE_MAX_DATA_CODEWORDS + QRCODE_MAX_ECC_CODEWORDS] = {0};
+    const size_t bits =
+        mode == QRCODE_MODE_BYTE
+            ? QRCODE_MODE_BITS + QRCODE_BYTE_COUNT_BITS + length * 8
+            : QRCODE_MODE_BITS + QRCODE_ALPHANUMERIC_COUNT_BITS +
+                  length / 2 * QRCODE_ALPHANUMERIC_PAIR_BITS +
+                  length % 2 * QRCODE_ALPHANUMERIC_CHAR_BITS;
+    uint8_t version = 1;
+
+    while (version <= QRCODE_MAX_VERSION && bits > QRCODE_DATA_CODEWORDS[version - 1] * 8) {
+        version++;
+    }
+    if (version > QRCODE_MAX_VERSION) {
+        return false;
+    }
+    const uint8_t data_codewords = QRCODE_DATA_CODEWORDS[version - 1];
+    const size_t capacity = data_codewords * 8;
+    size_t bit_length = 0;
+
+    qrcode_bits_append(codewords, &bit_length, mode, QRCODE_MODE_BITS);
+    if (mode == QRCODE_MODE_BYTE) {
+        qrcode_bits_append(codewords, &bit_length, length, QRCODE_BYTE_COUNT_BITS);
+        for (size_t i = 0; i < length; i++) {
+            qrcode_bits_append(codewords, &bit_length, data[i], 8);
+        }
+    } else {
+        qrcode_bits_append(codewords, &bit_length, length, QRCODE_ALPHANUMERIC_COUNT_BITS);
+        for (size_t i = 0; i + 1 < length; i += 2) {
+            qrcode_bits_append(codewords,
+                               &bit_length,
+                               data[i] * (sizeof(QRCODE_ALPHANUMERIC_CHARSET) - 1) + data[i + 1],
+                               QRCODE_ALPHANUMERIC_PAIR_BITS);
+        }
+        if (length % 2) {
+            qrcode_bits_append(codewords,
+                               &bit_length,
+                               data[length - 1],
+                               QRCODE_ALPHANUMERIC_CHAR_BITS);
+        }
+    }
+    // zero terminator, cut short by the end of the data capacity, and padding up to it
+    bit_length += MIN(QRCODE_TERMINATOR_BITS, capacity - bit_length);
+    bit_length = (bit_length + 7) / 8 * 8;
+    for (uint8_t pad = 0xec; bit_length < capacity; pad ^= QRCODE_PAD_BYTES) {
+        qrcode_bits_append(codewords, &bit_length, pad, 8);
+    }
+    qrcode_ecc_compute(codewords,
+                       data_codewords,
+                       codewords + data_codewords,
+                       QRCODE_ECC_CODEWORDS[version - 1]);
+
+    memzero(qrcode, sizeof(*qrcode));
+    qrcode->version = version;
+    qrcode->size = QRCODE_SIZE(version);
+    qrcode_function_patterns_draw(qrcode);
+    qrcode_codewords_draw(qrcode, codewords, data_codewords + QRCODE_ECC_CODEWORDS[version - 1]);
+    memzero(codewords, sizeof(codewords));
+
+    uint8_t best_mask = 0;
+    uint32_t best_penalty = UINT32_MAX;
+    for (uint8_t mask = 0; mask < QRCODE_MASK_COUNT; mask++) {
+        qrcode_mask_apply(qrcode, mask);
+        qrcode_format_draw(qrcode, mask);
+        const uint32_t penalty = qrcode_penalty(qrcode);
+        if (penalty < best_penalty) {
+            best_mask = mask;
+            best_penalty = penalty;
+        }
+        qrcode_mask_apply(qrcode, mask);
+    }
+    qrcode_mask_apply(qrcode, best_mask);
+    qrcode_format_draw(qrcode, best_mask);
+    return true;
+}
+
+bool qrcode_encode_bytes(qrcode_t *qrcode, const uint8_t *data, size_t length) {
+    return qrcode_encode(qrcode, QRCODE_MODE_BYTE, data, length);
+}
+
+bool qrcode_encode_alphanumeric(qrcode_t *qrcode, const char *text, size_t length) {
+    uint8_t values[QRCODE_ALPHANUMERIC_MAX_LENGTH];
+
+    if (length > sizeof(values)) {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++) {
+        const int8_t value = qrcode_alphanumeric_value(text[i]);
+        if (value < 0) {
+            return false;
+        }
+        values[i] = value;
+    }
+    const bool encoded = qrcode_encode(qrcode, QRCODE_MODE_ALPHANUMERIC, values, length);
+    memzero(values, sizeof(values));
+    return encoded;
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// QR codes (ISO/IEC 18004) of versions 1 to QRCODE_MAX_VERSION, at the L error correction level:
+// their data fits a single Reed-Solomon block and they have no version information, which keeps
+// the encoder down to a fixed module buffer.
+#define QRCODE_MAX_VERSION 3
+#define QRCODE_SIZE(version) (17 + 4 * (version))
+#define QRCODE_MAX_SIZE      QRCODE_SIZE(QRCODE_MAX_VERSION)
+// light modules to be drawn around the symbol
+#define QRCODE_QUIET_ZONE 4
+// characters of the alphanumeric mode held by the QRCODE_MAX_VERSION
+#define QRCODE_ALPHANUMERIC_MAX_LENGTH 77
+
+typedef struct {
+    // one bit per module, row by row, set for a dark module
+    uint8_t modules[(QRCODE_MAX_SIZE * QRCODE_MAX_SIZE + 7) / 8];
+    uint8_t version;
+    uint8_t size;
+} qrcode_t;
+
+// encode the bytes in byte mode, in the smallest version holding them, with the mask of lowest
+// penalty, return false if they do not fit: the symbol holds the data, to be cleared once drawn
+bool qrcode_encode_bytes(qrcode_t *qrcode, const uint8_t *data, size_t length);
+
+// same as qrcode_encode_bytes in alphanumeric mode, for text of the digits, upper case letters,
+// space and "$%*+-./:" characters, return false if another one is found
+bool qrcode_encode_alphanumeric(qrcode_t *qrcode, const char *text, size_t length);
+
+// whether the module of column x and row y is dark
+bool qrcode_module_get(const qrcode_t *qrcode, uint8_t x, uint8_t y);
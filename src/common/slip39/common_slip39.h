@@ -0,0 +1,50 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+// SLIP-39 helpers
+#include "./seed_rom_variables.h"
+#include "./slip39.h"
+
+// set [first, last) to the range of the words starting with the prefix, empty if none
+void bolos_ux_slip39_get_word_range_starting_with(const unsigned char *prefix,
+                                                  const unsigned int prefixlength,
+                                                  unsigned int *first,
+                                                  unsigned int *last);
+unsigned int bolos_ux_slip39_get_word_idx_starting_with(const unsigned char *prefix,
+                                                        const unsigned int prefixlength);
+// same as bolos_ux_slip39_get_word_idx_starting_with when a single word starts with the prefix,
+// else SLIP39_WORDLIST_COUNT: the first 4 letters of a SLIP-39 word identify it
+unsigned int bolos_ux_slip39_get_unique_word_idx_starting_with(const unsigned char *prefix,
+                                                               const unsigned int prefixlength);
+unsigned int bolos_ux_slip39_idx_strcpy(const unsigned int index, unsigned char *buffer);
+unsigned int bolos_ux_slip39_get_word_count_starting_with(const unsigned char *prefix,
+                                                          const unsigned int prefixlength);
+unsigned int bolos_ux_slip39_get_word_next_letters_starting_with(
+    const unsigned char *prefix,
+    const unsigned int prefixlength,
+    unsigned char *next_letters_buffer);
+
+#if defined(HAVE_NBGL)
+size_t bolos_ux_slip39_fill_with_candidates(const unsigned char *startingChars,
+                                            const size_t startingCharsLength,
+                                            char wordCandidatesBuffer[],
+                                            const char *wordIndexorBuffer[]);
+uint32_t bolos_ux_slip39_get_keyboard_mask(const unsigned char *prefix,
+                                           const unsigned int prefixLength);
+#endif
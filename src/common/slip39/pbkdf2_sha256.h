@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <cx.h>
+
+#define PBKDF2_SHA256_LENGTH 32
+// longer passwords are hashed into a PBKDF2_SHA256_LENGTH key first
+#define PBKDF2_SHA256_BLOCK_LENGTH 64
+
+// HMAC-SHA256 key schedule, as hmac_sha512_key_t (see bip39/pbkdf2_sha512.h): the key is absorbed
+// once in the inner and outer SHA-256 states, which are then copied for each message.
+typedef struct hmac_sha256_key_s {
+    cx_sha256_t inner;  // state after absorbing key ^ ipad
+    cx_sha256_t outer;  // state after absorbing key ^ opad
+} hmac_sha256_key_t;
+
+cx_err_t hmac_sha256_key_init(hmac_sha256_key_t *key, const uint8_t *secret, size_t secret_length);
+
+// mac may be the message
+cx_err_t hmac_sha256_keyed(const hmac_sha256_key_t *key,
+                           const uint8_t *message,
+                           size_t message_length,
+                           uint8_t mac[PBKDF2_SHA256_LENGTH]);
+
+// PBKDF2-HMAC-SHA256 limited to a single output block, as needed for the SLIP-39 Feistel rounds.
+//
+// Same as pbkdf2_sha512_t: a round costs 2 SHA-256 compressions thanks to the key schedule of
+// the password, and the derivation may be run a few rounds at a time from the ticker.
+typedef struct pbkdf2_sha256_s {
+    hmac_sha256_key_t key;
+    uint8_t u[PBKDF2_SHA256_LENGTH];  // U_i
+    uint8_t t[PBKDF2_SHA256_LENGTH];  // U_1 ^ ... ^ U_i
+    uint32_t iterations;
+    uint32_t rounds_left;
+} pbkdf2_sha256_t;
+
+// compute the keys midstates and U_1, leaving iterations - 1 rounds to run
+cx_err_t pbkdf2_sha256_init(pbkdf2_sha256_t *ctx,
+                            const uint8_t *password,
+                            size_t password_length,
+                            const uint8_t *salt,
+                            size_t salt_length,
+                            uint32_t iterations);
+
+// run at most max_rounds of the remaining rounds
+cx_err_t pbkdf2_sha256_step(pbkdf2_sha256_t *ctx, uint32_t max_rounds);
+
+// output the derived key once all rounds have been run, and zero the context
+cx_err_t pbkdf2_sha256_final(pbkdf2_sha256_t *ctx, uint8_t *out, size_t out_length);
+
+// init, run every round and final at once
+cx_err_t pbkdf2_sha256(const uint8_t *password,
+                       size_t password_length,
+                       const uint8_t *salt,
+                       size_t salt_length,
+                       uint32_t iterations,
+                       uint8_t *out,
+                       size_t out_length);
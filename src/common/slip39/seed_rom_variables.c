@@ -0,0 +1,1150 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <os.h>
+
+#include "./seed_rom_variables.h"
+
+// SLIP-39 wordlist generated by tools/wordlists/gen_wordlists.py, each word packed in
+// SLIP39_WORDLIST_STRIDE bytes like the BIP39 ones (see bip39/seed_rom_variables.c): big-endian,
+// 5 bits per letter, 'a' is 1, 'z' is 26 and the unused trailing letters are 0, so that packed
+// words sort as their text.
+unsigned char const SLIP39_WORDLIST[] = {
+    0x08, 0xC2, 0x42, 0xB5, 0x23,  // academic
+    0x08, 0xD2, 0x40, 0x00, 0x00,  // acid
+    0x08, 0xDC, 0x50, 0x00, 0x00,  // acne
+    0x08, 0xE3, 0x54, 0xC8, 0xA0,  // acquire
+    0x08, 0xE4, 0xF1, 0x06, 0x80,  // acrobat
+    0x08, 0xE8, 0x9B, 0x26, 0x99,  // activity
+    0x08, 0xE9, 0x22, 0xCE, 0x60,  // actress
+    0x09, 0x03, 0x0A, 0x00, 0x00,  // adapt
+    0x09, 0x0B, 0x1A, 0x86, 0x85,  // adequate
+    0x09, 0x15, 0x59, 0xD0, 0x00,  // adjust
+    0x09, 0x1A, 0x9A, 0x00, 0x00,  // admit
+    0x09, 0x1F, 0x27, 0x00, 0x00,  // adorn
+    0x09, 0x2A, 0xCA, 0x00, 0x00,  // adult
+    0x09, 0x2C, 0x17, 0x0C, 0xA0,  // advance
+    0x09, 0x2C, 0xF1, 0x86, 0x85,  // advocate
+    0x09, 0xA4, 0x14, 0x90, 0x00,  // afraid
+    0x09, 0xC2, 0x97, 0x00, 0x00,  // again
+    0x09, 0xCA, 0xE1, 0xE4, 0x00,  // agency
+    0x09, 0xE4, 0x52, 0x80, 0x00,  // agree
+    0x0A, 0x48, 0x50, 0x00, 0x00,  // aide
+    0x0A, 0x64, 0x39, 0x04, 0xD4,  // aircraft
+    0x0A, 0x64, 0xC4, 0xB8, 0xA0,  // airline
+    0x0A, 0x65, 0x07, 0xCA, 0x80,  // airport
+    0x0A, 0x83, 0x20, 0x00, 0x00,  // ajar
+    0x0B, 0x03, 0x26, 0x80, 0x00,  // alarm
+    0x0B, 0x05, 0x56, 0x80, 0x00,  // album
+    0x0B, 0x06, 0xF4, 0x3D, 0x80,  // alcohol
+    0x0B, 0x12, 0x57, 0x00, 0x00,  // alien
+    0x0B, 0x13, 0x62, 0x80, 0x00,  // alive
+    0x0B, 0x20, 0x80, 0x80, 0x00,  // alpha
+    0x0B, 0x24, 0x50, 0x93, 0x20,  // already
+    0x0B, 0x28, 0xF0, 0x00, 0x00,  // alto
+    0x0B, 0x2A, 0xD4, 0xBA, 0xAD,  // aluminum
+    0x0B, 0x2E, 0x1C, 0xCC, 0x00,  // always
+    0x0B, 0x43, 0xA4, 0xB8, 0xE0,  // amazing
+    0x0B, 0x44, 0x9A, 0x25, 0xEE,  // ambition
+    0x0B, 0x5F, 0x57, 0x50, 0x00,  // amount
+    0x0B, 0x6B, 0x32, 0x80, 0x00,  // amuse
+    0x0B, 0x82, 0xCC, 0xCD, 0x33,  // analysis
+    0x0B, 0x83, 0x47, 0xB7, 0x20,  // anatomy
+    0x0B, 0x86, 0x59, 0xD1, 0xF2,  // ancestor
+    0x0B, 0x86, 0x92, 0xBA, 0x80,  // ancient
+    0x0B, 0x8E, 0x56, 0x00, 0x00,  // angel
+    0x0B, 0x8F, 0x2C, 0x80, 0x00,  // angry
+    0x0B, 0x92, 0xD0, 0xB0, 0x00,  // animal
+    0x0B, 0xA7, 0x72, 0xC8, 0x00,  // answer
+    0x0B, 0xA8, 0x57, 0x38, 0x20,  // antenna
+    0x0B, 0xB0, 0x92, 0xD3, 0x20,  // anxiety
+    0x0C, 0x03, 0x2A, 0x00, 0x00,  // apart
+    0x0C, 0x6A, 0x1A, 0x24, 0x60,  // aquatic
+    0x0C, 0x86, 0x12, 0x14, 0x00,  // arcade
+    0x0C, 0x8A, 0xE0, 0x80, 0x00,  // arena
+    0x0C, 0x8F, 0x52, 0x80, 0x00,  // argue
+    0x0C, 0x9A, 0x52, 0x00, 0x00,  // armed
+    0x0C, 0xA8, 0x99, 0xD0, 0x00,  // artist
+    0x0C, 0xA9, 0x77, 0xC9, 0x60,  // artwork
+    0x0C, 0xE0, 0x51, 0xD0, 0x00,  // aspect
+    0x0D, 0x47, 0x44, 0xBD, 0xC0,  // auction
+    0x0D, 0x4F, 0x59, 0xD0, 0x00,  // august
+    0x0D, 0x5D, 0x40, 0x00, 0x00,  // aunt
+    0x0D, 0x8B, 0x20, 0x9C, 0xA0,  // average
+    0x0D, 0x92, 0x1A, 0x25, 0xEE,  // aviation
+    0x0D, 0x9E, 0x92, 0x00, 0x00,  // avoid
+    0x0D, 0xC3, 0x22, 0x00, 0x00,  // award
+    0x0D, 0xC3, 0x90, 0x00, 0x00,  // away
+    0x0E, 0x13, 0x30, 0x00, 0x00,  // axis
+    0x0E, 0x18, 0x50, 0x00, 0x00,  // axle
+    0x11, 0x42, 0xD0, 0x00, 0x00,  // beam
+    0x11, 0x43, 0x22, 0x00, 0x00,  // beard
+    0x11, 0x43, 0x62, 0xC8, 0x00,  // beaver
+    0x11, 0x46, 0xF6, 0x94, 0x00,  // become
+    0x11, 0x49, 0x27, 0xBD, 0xA0,  // bedroom
+    0x11, 0x50, 0x1B, 0x25, 0xF2,  // behavior
+    0x11, 0x52, 0xE3, 0x80, 0x00,  // being
+    0x11, 0x58, 0x92, 0xD8, 0xA0,  // believe
+    0x11, 0x58, 0xF7, 0x1C, 0x00,  // belong
+    0x11, 0x5C, 0x53, 0x26, 0x80,  // benefit
+    0x11, 0x67, 0x40, 0x00, 0x00,  // best
+    0x11, 0x72, 0xF7, 0x10, 0x00,  // beyond
+    0x12, 0x56, 0x50, 0x00, 0x00,  // bike
+    0x12, 0x5E, 0xC7, 0x9F, 0x20,  // biology
+    0x12, 0x65, 0x44, 0x10, 0x39,  // birthday
+    0x12, 0x66, 0x87, 0xC0, 0x00,  // bishop
+    0x13, 0x02, 0x35, 0x80, 0x00,  // black
+    0x13, 0x02, 0xE5, 0x96, 0x80,  // blanket
+    0x13, 0x0B, 0x39, 0xA5, 0xC7,  // blessing
+    0x13, 0x12, 0xD8, 0x00, 0x00,  // blimp
+    0x13, 0x12, 0xE2, 0x00, 0x00,  // blind
+    0x13, 0x2A, 0x50, 0x00, 0x00,  // blue
+    0x13, 0xC9, 0x90, 0x00, 0x00,  // body
+    0x13, 0xD9, 0x40, 0x00, 0x00,  // bolt
+    0x13, 0xE4, 0x97, 0x1C, 0x00,  // boring
+    0x13, 0xE4, 0xE0, 0x00, 0x00,  // born
+    0x13, 0xE8, 0x80, 0x00, 0x00,  // both
+    0x13, 0xEA, 0xE2, 0x06, 0x59,  // boundary
+    0x14, 0x82, 0x32, 0xB0, 0xB4,  // bracelet
+    0x14, 0x82, 0xE1, 0xA0, 0x00,  // branch
+    0x14, 0x83, 0x62, 0x80, 0x00,  // brave
+    0x14, 0x8A, 0x1A, 0x20, 0xA0,  // breathe
+    0x14, 0x92, 0x53, 0x25, 0xC7,  // briefing
+    0x14, 0x9E, 0xB2, 0xB8, 0x00,  // broken
+    0x14, 0x9F, 0x44, 0x16, 0x40,  // brother
+    0x14, 0x9F, 0x79, 0x96, 0x40,  // browser
+    0x15, 0x46, 0xB2, 0xD0, 0x00,  // bucket
+    0x15, 0x48, 0x72, 0xD0, 0x00,  // budget
+    0x15, 0x52, 0xC2, 0x25, 0xC7,  // building
+    0x15, 0x58, 0x20, 0x00, 0x00,  // bulb
+    0x15, 0x58, 0x72, 0x80, 0x00,  // bulge
+    0x15, 0x5B, 0x0C, 0x80, 0x00,  // bumpy
+    0x15, 0x5C, 0x46, 0x14, 0x00,  // bundle
+    0x15, 0x64, 0x42, 0xB8, 0x00,  // burden
+    0x15, 0x64, 0xE4, 0xB8, 0xE0,  // burning
+    0x15, 0x67, 0x90, 0x00, 0x00,  // busy
+    0x15, 0x72, 0x59, 0x00, 0x00,  // buyer
+    0x18, 0x4E, 0x50, 0x00, 0x00,  // cage
+    0x18, 0x58, 0x34, 0xD5, 0xA0,  // calcium
+    0x18, 0x5A, 0x59, 0x04, 0x00,  // camera
+    0x18, 0x5B, 0x0A, 0xCC, 0x00,  // campus
+    0x18, 0x5D, 0x97, 0xB8, 0x00,  // canyon
+    0x18, 0x60, 0x11, 0xA6, 0x99,  // capacity
+    0x18, 0x60, 0x9A, 0x05, 0x80,  // capital
+    0x18, 0x61, 0x4A, 0xC8, 0xA0,  // capture
+    0x18, 0x64, 0x27, 0xB8, 0x00,  // carbon
+    0x18, 0x64, 0x49, 0x80, 0x00,  // cards
+    0x18, 0x64, 0x53, 0x55, 0x80,  // careful
+    0x18, 0x64, 0x77, 0x80, 0x00,  // cargo
+    0x18, 0x65, 0x02, 0xD0, 0x00,  // carpet
+    0x18, 0x65, 0x62, 0x80, 0x00,  // carve
+    0x18, 0x68, 0x53, 0xBE, 0x59,  // category
+    0x18, 0x6B, 0x32, 0x80, 0x00,  // cause
+    0x19, 0x52, 0xC4, 0xB8, 0xE0,  // ceiling
+    0x19, 0x5D, 0x42, 0xC8, 0x00,  // center
+    0x19, 0x64, 0x16, 0xA4, 0x60,  // ceramic
+    0x1A, 0x02, 0xD8, 0x25, 0xEE,  // champion
+    0x1A, 0x02, 0xE3, 0x94, 0x00,  // change
+    0x1A, 0x03, 0x24, 0xD3, 0x20,  // charity
+    0x1A, 0x0A, 0x35, 0x80, 0x00,  // check
+    0x1A, 0x0A, 0xD4, 0x8C, 0x2C,  // chemical
+    0x1A, 0x0B, 0x3A, 0x00, 0x00,  // chest
+    0x1A, 0x0B, 0x70, 0x00, 0x00,  // chew
+    0x1A, 0x2A, 0x21, 0x64, 0x00,  // chubby
+    0x1A, 0x5C, 0x56, 0x84, 0x00,  // cinema
+    0x1A, 0x6C, 0x96, 0x00, 0x00,  // civil
+    0x1B, 0x03, 0x39, 0x80, 0x00,  // class
+    0x1B, 0x03, 0x90, 0x00, 0x00,  // clay
+    0x1B, 0x0A, 0x17, 0x56, 0x00,  // cleanup
+    0x1B, 0x12, 0x57, 0x50, 0x00,  // client
+    0x1B, 0x12, 0xD0, 0xD0, 0xA0,  // climate
+    0x1B, 0x12, 0xE4, 0x8C, 0x00,  // clinic
+    0x1B, 0x1E, 0x35, 0x80, 0x00,  // clock
+    0x1B, 0x1E, 0x79, 0x80, 0x00,  // clogs
+    0x1B, 0x1F, 0x32, 0xD0, 0x00,  // closet
+    0x1B, 0x1F, 0x44, 0x16, 0x60,  // clothes
+    0x1B, 0x2A, 0x20, 0x00, 0x00,  // club
+    0x1B, 0x2B, 0x3A, 0x16, 0x40,  // cluster
+    0x1B, 0xC2, 0xC0, 0x00, 0x00,  // coal
+    0x1B, 0xC3, 0x3A, 0x05, 0x80,  // coastal
+    0x1B, 0xC8, 0x97, 0x1C, 0x00,  // coding
+    0x1B, 0xD9, 0x56, 0xB8, 0x00,  // column
+    0x1B, 0xDB, 0x00, 0xBB, 0x20,  // company
+    0x1B, 0xE4, 0xE2, 0xC8, 0x00,  // corner
+    0x1B, 0xE7, 0x4A, 0xB4, 0xA0,  // costume
+    0x1B, 0xEA, 0xEA, 0x16, 0x40,  // counter
+    0x1B, 0xEB, 0x29, 0x94, 0x00,  // course
+    0x1B, 0xEC, 0x59, 0x00, 0x00,  // cover
+    0x1B, 0xEE, 0x27, 0xE4, 0x00,  // cowboy
+    0x1C, 0x82, 0x46, 0x14, 0x00,  // cradle
+    0x1C, 0x82, 0x6A, 0x00, 0x00,  // craft
+    0x1C, 0x83, 0xAC, 0x80, 0x00,  // crazy
+    0x1C, 0x8A, 0x44, 0xD0, 0x00,  // credit
+    0x1C, 0x92, 0x35, 0x96, 0x80,  // cricket
+    0x1C, 0x92, 0xD4, 0xB8, 0x2C,  // criminal
+    0x1C, 0x93, 0x34, 0xCC, 0x00,  // crisis
+    0x1C, 0x93, 0x44, 0x8C, 0x2C,  // critical
+    0x1C, 0x9F, 0x72, 0x00, 0x00,  // crowd
+    0x1C, 0xAA, 0x34, 0x85, 0x80,  // crucial
+    0x1C, 0xAA, 0xE1, 0xA0, 0x00,  // crunch
+    0x1C, 0xAB, 0x34, 0x00, 0x00,  // crush
+    0x1C, 0xB3, 0x3A, 0x05, 0x80,  // crystal
+    0x1D, 0x44, 0x91, 0x80, 0x00,  // cubic
+    0x1D, 0x59, 0x4A, 0xC8, 0x2C,  // cultural
+    0x1D, 0x64, 0x97, 0xD6, 0x60,  // curious
+    0x1D, 0x64, 0xCC, 0x80, 0x00,  // curly
+    0x1D, 0x67, 0x47, 0x93, 0x20,  // custody
+    0x1E, 0x58, 0x97, 0x10, 0xB2,  // cylinder
+    0x20, 0x53, 0x3C, 0x80, 0x00,  // daisy
+    0x20, 0x5A, 0x13, 0x94, 0x00,  // damage
+    0x20, 0x5C, 0x32, 0x80, 0x00,  // dance
+    0x20, 0x64, 0xB7, 0x16, 0x73,  // darkness
+    0x20, 0x68, 0x11, 0x06, 0x65,  // database
+    0x20, 0x6A, 0x74, 0x50, 0xB2,  // daughter
+    0x21, 0x42, 0x46, 0x25, 0xC5,  // deadline
+    0x21, 0x42, 0xC0, 0x00, 0x00,  // deal
+    0x21, 0x45, 0x24, 0xCC, 0x00,  // debris
+    0x21, 0x45, 0x5A, 0x00, 0x00,  // debut
+    0x21, 0x46, 0x57, 0x50, 0x00,  // decent
+    0x21, 0x46, 0x99, 0xA5, 0xEE,  // decision
+    0x21, 0x46, 0xC0, 0xC8, 0xA0,  // declare
+    0x21, 0x46, 0xF9, 0x06, 0x85,  // decorate
+    0x21, 0x47, 0x22, 0x86, 0x65,  // decrease
+    0x21, 0x58, 0x9B, 0x16, 0x40,  // deliver
+    0x21, 0x5A, 0x17, 0x10, 0x00,  // demand
+    0x21, 0x5D, 0x34, 0xD3, 0x20,  // density
+    0x21, 0x5D, 0x90, 0x00, 0x00,  // deny
+    0x21, 0x60, 0x19, 0x50, 0x00,  // depart
+    0x21, 0x60, 0x57, 0x10, 0x00,  // depend
+    0x21, 0x60, 0x91, 0xD0, 0x00,  // depict
+    0x21, 0x60, 0xC7, 0xE4, 0x00,  // deploy
+    0x21, 0x66, 0x39, 0x24, 0x45,  // describe
+    0x21, 0x66, 0x59, 0x50, 0x00,  // desert
+    0x21, 0x66, 0x99, 0x14, 0x00,  // desire
+    0x21, 0x66, 0xBA, 0x3E, 0x00,  // desktop
+    0x21, 0x67, 0x49, 0x3F, 0x20,  // destroy
+    0x21, 0x68, 0x14, 0xB0, 0xA4,  // detailed
+    0x21, 0x68, 0x51, 0xD0, 0x00,  // detect
+    0x21, 0x6C, 0x91, 0x94, 0x00,  // device
+    0x21, 0x6C, 0xFA, 0x14, 0x00,  // devote
+    0x22, 0x42, 0x77, 0x3E, 0x65,  // diagnose
+    0x22, 0x47, 0x40, 0xD0, 0xA0,  // dictate
+    0x22, 0x4B, 0x40, 0x00, 0x00,  // diet
+    0x22, 0x58, 0x56, 0xB4, 0x20,  // dilemma
+    0x22, 0x5A, 0x97, 0x26, 0x68,  // diminish
+    0x22, 0x5C, 0x97, 0x1C, 0x00,  // dining
+    0x22, 0x60, 0xC7, 0xB4, 0x20,  // diploma
+    0x22, 0x66, 0x19, 0xD0, 0xB2,  // disaster
+    0x22, 0x66, 0x3A, 0xCE, 0x60,  // discuss
+    0x22, 0x66, 0x50, 0xCC, 0xA0,  // disease
+    0x22, 0x66, 0x80, 0x00, 0x00,  // dish
+    0x22, 0x66, 0xD4, 0xCE, 0x60,  // dismiss
+    0x22, 0x67, 0x06, 0x07, 0x20,  // display
+    0x22, 0x67, 0x40, 0xB8, 0x65,  // distance
+    0x22, 0x6C, 0x50, 0x00, 0x00,  // dive
+    0x22, 0x6C, 0xF9, 0x0C, 0xA0,  // divorce
+    0x23, 0xC7, 0x56, 0x95, 0xD4,  // document
+    0x23, 0xDA, 0x14, 0xB8, 0x00,  // domain
+    0x23, 0xDA, 0x59, 0xD1, 0x23,  // domestic
+    0x23, 0xDA, 0x97, 0x05, 0xD4,  // dominant
+    0x23, 0xEA, 0x74, 0x00, 0x00,  // dough
+    0x23, 0xEE, 0xEA, 0x3E, 0xEE,  // downtown
+    0x24, 0x82, 0x77, 0xB8, 0x00,  // dragon
+    0x24, 0x82, 0xD0, 0xD1, 0x23,  // dramatic
+    0x24, 0x8A, 0x16, 0x80, 0x00,  // dream
+    0x24, 0x8B, 0x39, 0x80, 0x00,  // dress
+    0x24, 0x92, 0x6A, 0x00, 0x00,  // drift
+    0x24, 0x92, 0xE5, 0x80, 0x00,  // drink
+    0x24, 0x9F, 0x62, 0x80, 0x00,  // drove
+    0x24, 0xAA, 0x70, 0x00, 0x00,  // drug
+    0x24, 0xB2, 0x59, 0x00, 0x00,  // dryer
+    0x25, 0x46, 0xB6, 0x25, 0xC7,  // duckling
+    0x25, 0x56, 0x50, 0x00, 0x00,  // duke
+    0x25, 0x64, 0x1A, 0x25, 0xEE,  // duration
+    0x25, 0xC3, 0x23, 0x00, 0x00,  // dwarf
+    0x26, 0x5C, 0x16, 0xA4, 0x60,  // dynamic
+    0x28, 0x64, 0xCC, 0x80, 0x00,  // early
+    0x28, 0x65, 0x44, 0x00, 0x00,  // earth
+    0x28, 0x66, 0x56, 0x00, 0x00,  // easel
+    0x28, 0x67, 0x90, 0x00, 0x00,  // easy
+    0x28, 0xD0, 0xF0, 0x00, 0x00,  // echo
+    0x28, 0xD8, 0x98, 0x4C, 0xA0,  // eclipse
+    0x28, 0xDE, 0xC7, 0x9F, 0x20,  // ecology
+    0x29, 0x0E, 0x50, 0x00, 0x00,  // edge
+    0x29, 0x13, 0x47, 0xC8, 0x00,  // editor
+    0x29, 0x2A, 0x30, 0xD0, 0xA0,  // educate
+    0x2A, 0x68, 0x82, 0xC8, 0x00,  // either
+    0x2B, 0x04, 0xFB, 0x80, 0x00,  // elbow
+    0x2B, 0x08, 0x59, 0x00, 0x00,  // elder
+    0x2B, 0x0A, 0x3A, 0x25, 0xEE,  // election
+    0x2B, 0x0A, 0x70, 0xBA, 0x80,  // elegant
+    0x2B, 0x0A, 0xD2, 0xBA, 0x80,  // element
+    0x2B, 0x0B, 0x04, 0x05, 0xD4,  // elephant
+    0x2B, 0x0B, 0x60, 0xD1, 0xF2,  // elevator
+    0x2B, 0x13, 0x42, 0x80, 0x00,  // elite
+    0x2B, 0x26, 0x50, 0x00, 0x00,  // else
+    0x2B, 0x42, 0x96, 0x00, 0x00,  // email
+    0x2B, 0x4B, 0x20, 0xB0, 0x80,  // emerald
+    0x2B, 0x53, 0x39, 0xA5, 0xEE,  // emission
+    0x2B, 0x60, 0x59, 0x3E, 0x40,  // emperor
+    0x2B, 0x60, 0x80, 0xCD, 0x33,  // emphasis
+    0x2B, 0x60, 0xC7, 0xE4, 0xB2,  // employer
+    0x2B, 0x61, 0x4C, 0x80, 0x00,  // empty
+    0x2B, 0x88, 0x97, 0x1C, 0x00,  // ending
+    0x2B, 0x88, 0xC2, 0xCE, 0x60,  // endless
+    0x2B, 0x88, 0xF9, 0x4C, 0xA0,  // endorse
+    0x2B, 0x8A, 0xDC, 0x80, 0x00,  // enemy
+    0x2B, 0x8B, 0x23, 0xE4, 0x00,  // energy
+    0x2B, 0x8C, 0xF9, 0x0C, 0xA0,  // enforce
+    0x2B, 0x8E, 0x13, 0x94, 0x00,  // engage
+    0x2B, 0x94, 0xFC, 0x80, 0x00,  // enjoy
+    0x2B, 0x98, 0x19, 0x1C, 0xA0,  // enlarge
+    0x2B, 0xA9, 0x20, 0xB8, 0x65,  // entrance
+    0x2B, 0xAC, 0x56, 0x3E, 0x05,  // envelope
+    0x2B, 0xAD, 0x90, 0x00, 0x00,  // envy
+    0x2C, 0x12, 0x42, 0xB5, 0x23,  // epidemic
+    0x2C, 0x13, 0x37, 0x90, 0xA0,  // episode
+    0x2C, 0x6A, 0x1A, 0x25, 0xEE,  // equation
+    0x2C, 0x6A, 0x98, 0x00, 0x00,  // equip
+    0x2C, 0x83, 0x32, 0xC8, 0x00,  // eraser
+    0x2C, 0x9E, 0x42, 0x80, 0x00,  // erode
+    0x2C, 0xC6, 0x18, 0x14, 0x00,  // escape
+    0x2C, 0xE8, 0x1A, 0x14, 0x00,  // estate
+    0x2C, 0xE8, 0x96, 0x86, 0x85,  // estimate
+    0x2D, 0x82, 0xCA, 0x86, 0x85,  // evaluate
+    0x2D, 0x8A, 0xE4, 0xB8, 0xE0,  // evening
+    0x2D, 0x92, 0x42, 0xB8, 0x65,  // evidence
+    0x2D, 0x92, 0xC0, 0x00, 0x00,  // evil
+    0x2D, 0x9E, 0xB2, 0x80, 0x00,  // evoke
+    0x2E, 0x02, 0x3A, 0x00, 0x00,  // exact
+    0x2E, 0x02, 0xD8, 0x30, 0xA0,  // example
+    0x2E, 0x06, 0x52, 0x90, 0x00,  // exceed
+    0x2E, 0x06, 0x80, 0xB8, 0xE5,  // exchange
+    0x2E, 0x06, 0xCA, 0x90, 0xA0,  // exclude
+    0x2E, 0x07, 0x59, 0x94, 0x00,  // excuse
+    0x2E, 0x0A, 0x3A, 0xD0, 0xA0,  // execute
+    0x2E, 0x0B, 0x21, 0xA6, 0x65,  // exercise
+    0x2E, 0x10, 0x1A, 0xCE, 0x80,  // exhaust
+    0x2E, 0x1F, 0x44, 0x8C, 0x00,  // exotic
+    0x2E, 0x20, 0x17, 0x10, 0x00,  // expand
+    0x2E, 0x20, 0x51, 0xD0, 0x00,  // expect
+    0x2E, 0x20, 0xC0, 0xA5, 0xC0,  // explain
+    0x2E, 0x21, 0x22, 0xCE, 0x60,  // express
+    0x2E, 0x28, 0x57, 0x10, 0x00,  // extend
+    0x2E, 0x29, 0x20, 0x80, 0x00,  // extra
+    0x2E, 0x4A, 0x29, 0x3E, 0xE0,  // eyebrow
+    0x30, 0x46, 0x96, 0x26, 0x99,  // facility
+    0x30, 0x47, 0x40, 0x00, 0x00,  // fact
+    0x30, 0x52, 0xCA, 0xC8, 0xA0,  // failure
+    0x30, 0x52, 0xEA, 0x00, 0x00,  // faint
+    0x30, 0x56, 0x50, 0x00, 0x00,  // fake
+    0x30, 0x59, 0x32, 0x80, 0x00,  // false
+    0x30, 0x5A, 0x96, 0x64, 0x00,  // family
+    0x30, 0x5A, 0xFA, 0xCC, 0x00,  // famous
+    0x30, 0x5C, 0x3C, 0x80, 0x00,  // fancy
+    0x30, 0x5C, 0x79, 0x80, 0x00,  // fangs
+    0x30, 0x5D, 0x40, 0xCF, 0x20,  // fantasy
+    0x30, 0x68, 0x16, 0x00, 0x00,  // fatal
+    0x30, 0x68, 0x93, 0xD4, 0xA0,  // fatigue
+    0x30, 0x6C, 0xF9, 0x26, 0x85,  // favorite
+    0x30, 0x6E, 0xE0, 0x00, 0x00,  // fawn
+    0x32, 0x44, 0x59, 0x00, 0x00,  // fiber
+    0x32, 0x47, 0x44, 0xBD, 0xC0,  // fiction
+    0x32, 0x59, 0x42, 0xC8, 0x00,  // filter
+    0x32, 0x5C, 0x17, 0x0C, 0xA0,  // finance
+    0x32, 0x5C, 0x44, 0xB8, 0xF3,  // findings
+    0x32, 0x5C, 0x72, 0xC8, 0x00,  // finger
+    0x32, 0x64, 0x53, 0x33, 0x20,  // firefly
+    0x32, 0x64, 0xD0, 0x00, 0x00,  // firm
+    0x32, 0x66, 0x30, 0xB0, 0x00,  // fiscal
+    0x32, 0x66, 0x84, 0xB8, 0xE0,  // fishing
+    0x32, 0x68, 0xE2, 0xCE, 0x60,  // fitness
+    0x33, 0x02, 0xD2, 0x80, 0x00,  // flame
+    0x33, 0x03, 0x34, 0x00, 0x00,  // flash
+    0x33, 0x03, 0x67, 0xC8, 0x00,  // flavor
+    0x33, 0x0A, 0x10, 0x00, 0x00,  // flea
+    0x33, 0x0B, 0x84, 0x89, 0x85,  // flexible
+    0x33, 0x13, 0x00, 0x00, 0x00,  // flip
+    0x33, 0x1E, 0x1A, 0x00, 0x00,  // float
+    0x33, 0x1F, 0x20, 0xB0, 0x00,  // floral
+    0x33, 0x2A, 0x63, 0x00, 0x00,  // fluff
+    0x33, 0xC7, 0x59, 0x80, 0x00,  // focus
+    0x33, 0xE4, 0x24, 0x90, 0x00,  // forbid
+    0x33, 0xE4, 0x32, 0x80, 0x00,  // force
+    0x33, 0xE4, 0x51, 0x86, 0x74,  // forecast
+    0x33, 0xE4, 0x72, 0xD0, 0x00,  // forget
+    0x33, 0xE4, 0xD0, 0xB0, 0x00,  // formal
+    0x33, 0xE5, 0x4A, 0xB8, 0xA0,  // fortune
+    0x33, 0xE5, 0x70, 0xC8, 0x80,  // forward
+    0x33, 0xEA, 0xE2, 0x16, 0x40,  // founder
+    0x34, 0x82, 0x3A, 0x25, 0xEE,  // fraction
+    0x34, 0x82, 0x76, 0x95, 0xD4,  // fragment
+    0x34, 0x8B, 0x1A, 0x95, 0xD4,  // frequent
+    0x34, 0x8B, 0x34, 0x34, 0x2E,  // freshman
+    0x34, 0x92, 0x19, 0x00, 0x00,  // friar
+    0x34, 0x92, 0x43, 0x94, 0x00,  // fridge
+    0x34, 0x92, 0x57, 0x11, 0x99,  // friendly
+    0x34, 0x9F, 0x3A, 0x00, 0x00,  // frost
+    0x34, 0x9F, 0x44, 0x00, 0x00,  // froth
+    0x34, 0x9F, 0xA2, 0xB8, 0x00,  // frozen
+    0x35, 0x5A, 0x59, 0x80, 0x00,  // fumes
+    0x35, 0x5C, 0x44, 0xB8, 0xE0,  // funding
+    0x35, 0x64, 0xC0, 0x00, 0x00,  // furl
+    0x35, 0x66, 0x52, 0x00, 0x00,  // fused
+    0x38, 0x58, 0x1C, 0x64, 0x00,  // galaxy
+    0x38, 0x5A, 0x50, 0x00, 0x00,  // game
+    0x38, 0x64, 0x20, 0x9C, 0xA0,  // garbage
+    0x38, 0x64, 0x42, 0xB8, 0x00,  // garden
+    0x38, 0x64, 0xC4, 0x8C, 0x00,  // garlic
+    0x38, 0x66, 0xF6, 0x25, 0xC5,  // gasoline
+    0x38, 0x68, 0x82, 0xC8, 0x00,  // gather
+    0x39, 0x5C, 0x59, 0x05, 0x80,  // general
+    0x39, 0x5C, 0x9A, 0xCC, 0x00,  // genius
+    0x39, 0x5D, 0x22, 0x80, 0x00,  // genre
+    0x39, 0x5D, 0x54, 0xB8, 0xA0,  // genuine
+    0x39, 0x5E, 0xC7, 0x9F, 0x20,  // geology
+    0x39, 0x67, 0x4A, 0xC8, 0xA0,  // gesture
+    0x3B, 0x02, 0x40, 0x00, 0x00,  // glad
+    0x3B, 0x02, 0xE1, 0x94, 0x00,  // glance
+    0x3B, 0x03, 0x39, 0x96, 0x60,  // glasses
+    0x3B, 0x0A, 0xE0, 0x00, 0x00,  // glen
+    0x3B, 0x12, 0xD8, 0x4C, 0xA0,  // glimpse
+    0x3B, 0xC3, 0x40, 0x00, 0x00,  // goat
+    0x3B, 0xD8, 0x42, 0xB8, 0x00,  // golden
+    0x3C, 0x82, 0x4A, 0x86, 0x85,  // graduate
+    0x3C, 0x82, 0xEA, 0x00, 0x00,  // grant
+    0x3C, 0x83, 0x38, 0x00, 0x00,  // grasp
+    0x3C, 0x83, 0x64, 0xD3, 0x20,  // gravity
+    0x3C, 0x83, 0x90, 0x00, 0x00,  // gray
+    0x3C, 0x8A, 0x1A, 0x16, 0x74,  // greatest
+    0x3C, 0x92, 0x53, 0x00, 0x00,  // grief
+    0x3C, 0x92, 0xC6, 0x00, 0x00,  // grill
+    0x3C, 0x92, 0xE0, 0x00, 0x00,  // grin
+    0x3C, 0x9E, 0x32, 0xCB, 0x20,  // grocery
+    0x3C, 0x9F, 0x39, 0x80, 0x00,  // gross
+    0x3C, 0x9F, 0x58, 0x00, 0x00,  // group
+    0x3C, 0x9F, 0x77, 0x56, 0x00,  // grownup
+    0x3C, 0xAA, 0xD8, 0x64, 0x00,  // grumpy
+    0x3D, 0x43, 0x22, 0x00, 0x00,  // guard
+    0x3D, 0x4B, 0x3A, 0x00, 0x00,  // guest
+    0x3D, 0x52, 0xCA, 0x00, 0x00,  // guilt
+    0x3D, 0x53, 0x40, 0xC8, 0x00,  // guitar
+    0x3D, 0x5B, 0x30, 0x00, 0x00,  // gums
+    0x40, 0x53, 0x2C, 0x80, 0x00,  // hairy
+    0x40, 0x5B, 0x3A, 0x16, 0x40,  // hamster
+    0x40, 0x5C, 0x40, 0x00, 0x00,  // hand
+    0x40, 0x5C, 0x72, 0xC8, 0x00,  // hanger
+    0x40, 0x65, 0x62, 0xCE, 0x80,  // harvest
+    0x40, 0x6C, 0x50, 0x00, 0x00,  // have
+    0x40, 0x6C, 0xF1, 0x80, 0x00,  // havoc
+    0x40, 0x6E, 0xB0, 0x00, 0x00,  // hawk
+    0x40, 0x74, 0x19, 0x10, 0x00,  // hazard
+    0x41, 0x42, 0x49, 0x96, 0x80,  // headset
+    0x41, 0x42, 0xCA, 0x20, 0x00,  // health
+    0x41, 0x43, 0x24, 0xB8, 0xE0,  // hearing
+    0x41, 0x43, 0x40, 0x00, 0x00,  // heat
+    0x41, 0x59, 0x03, 0x55, 0x80,  // helpful
+    0x41, 0x64, 0x16, 0x10, 0x00,  // herald
+    0x41, 0x64, 0x40, 0x00, 0x00,  // herd
+    0x41, 0x66, 0x9A, 0x06, 0x85,  // hesitate
+    0x43, 0xC4, 0xF0, 0x00, 0x00,  // hobo
+    0x43, 0xD8, 0x92, 0x07, 0x20,  // holiday
+    0x43, 0xD9, 0x90, 0x00, 0x00,  // holy
+    0x43, 0xDA, 0x50, 0x00, 0x00,  // home
+    0x43, 0xE4, 0xD7, 0xB8, 0xA0,  // hormone
+    0x43, 0xE7, 0x04, 0xD0, 0x2C,  // hospital
+    0x43, 0xEB, 0x20, 0x00, 0x00,  // hour
+    0x45, 0x4E, 0x50, 0x00, 0x00,  // huge
+    0x45, 0x5A, 0x17, 0x00, 0x00,  // human
+    0x45, 0x5A, 0x92, 0x26, 0x99,  // humidity
+    0x45, 0x5D, 0x44, 0xB8, 0xE0,  // hunting
+    0x45, 0x66, 0x20, 0xB8, 0x80,  // husband
+    0x45, 0x66, 0x80, 0x00, 0x00,  // hush
+    0x45, 0x66, 0xBC, 0x80, 0x00,  // husky
+    0x46, 0x45, 0x24, 0x90, 0x00,  // hybrid
+    0x49, 0x0A, 0x10, 0x00, 0x00,  // idea
+    0x49, 0x0A, 0xEA, 0x24, 0xD9,  // identify
+    0x49, 0x18, 0x50, 0x00, 0x00,  // idle
+    0x4B, 0x42, 0x72, 0x80, 0x00,  // image
+    0x4B, 0x60, 0x11, 0xD0, 0x00,  // impact
+    0x4B, 0x60, 0xCC, 0x80, 0x00,  // imply
+    0x4B, 0x61, 0x27, 0xD8, 0xA0,  // improve
+    0x4B, 0x61, 0x56, 0x4C, 0xA0,  // impulse
+    0x4B, 0x86, 0xCA, 0x90, 0xA0,  // include
+    0x4B, 0x86, 0xF6, 0x94, 0x00,  // income
+    0x4B, 0x87, 0x22, 0x86, 0x65,  // increase
+    0x4B, 0x88, 0x5C, 0x00, 0x00,  // index
+    0x4B, 0x88, 0x91, 0x86, 0x85,  // indicate
+    0x4B, 0x89, 0x59, 0xD2, 0x59,  // industry
+    0x4B, 0x8C, 0x17, 0x50, 0x00,  // infant
+    0x4B, 0x8C, 0xF9, 0x34, 0x00,  // inform
+    0x4B, 0x90, 0x59, 0x26, 0x80,  // inherit
+    0x4B, 0x95, 0x59, 0x64, 0x00,  // injury
+    0x4B, 0x9A, 0x1A, 0x14, 0x00,  // inmate
+    0x4B, 0xA6, 0x51, 0xD0, 0x00,  // insect
+    0x4B, 0xA6, 0x92, 0x14, 0x00,  // inside
+    0x4B, 0xA7, 0x40, 0xB1, 0x80,  // install
+    0x4B, 0xA8, 0x57, 0x10, 0x00,  // intend
+    0x4B, 0xA8, 0x96, 0x86, 0x85,  // intimate
+    0x4B, 0xAC, 0x19, 0xA5, 0xEE,  // invasion
+    0x4B, 0xAC, 0xF6, 0x58, 0xA0,  // involve
+    0x4C, 0x93, 0x30, 0x00, 0x00,  // iris
+    0x4C, 0xD8, 0x17, 0x10, 0x00,  // island
+    0x4C, 0xDE, 0xC0, 0xD0, 0xA0,  // isolate
+    0x4D, 0x0A, 0xD0, 0x00, 0x00,  // item
+    0x4D, 0x9F, 0x2C, 0x80, 0x00,  // ivory
+    0x50, 0x46, 0xB2, 0xD0, 0x00,  // jacket
+    0x51, 0x64, 0xBC, 0x80, 0x00,  // jerky
+    0x51, 0x6E, 0x56, 0x4B, 0x20,  // jewelry
+    0x53, 0xD2, 0xE0, 0x00, 0x00,  // join
+    0x55, 0x48, 0x91, 0xA4, 0x2C,  // judicial
+    0x55, 0x52, 0x32, 0x80, 0x00,  // juice
+    0x55, 0x5B, 0x00, 0x00, 0x00,  // jump
+    0x55, 0x5C, 0x3A, 0x25, 0xEE,  // junction
+    0x55, 0x5C, 0x97, 0xC8, 0x00,  // junior
+    0x55, 0x5C, 0xB0, 0x00, 0x00,  // junk
+    0x55, 0x65, 0x90, 0x00, 0x00,  // jury
+    0x55, 0x67, 0x44, 0x8C, 0xA0,  // justice
+    0x59, 0x64, 0xE2, 0xB0, 0x00,  // kernel
+    0x59, 0x72, 0x27, 0x86, 0x44,  // keyboard
+    0x5A, 0x48, 0xE2, 0xE4, 0x00,  // kidney
+    0x5A, 0x5C, 0x40, 0x00, 0x00,  // kind
+    0x5A, 0x68, 0x34, 0x15, 0xC0,  // kitchen
+    0x5B, 0x92, 0x62, 0x80, 0x00,  // knife
+    0x5B, 0x93, 0x40, 0x00, 0x00,  // knit
+    0x60, 0x48, 0x57, 0x00, 0x00,  // laden
+    0x60, 0x48, 0xC2, 0x80, 0x00,  // ladle
+    0x60, 0x49, 0x91, 0x54, 0xE0,  // ladybug
+    0x60, 0x53, 0x20, 0x00, 0x00,  // lair
+    0x60, 0x5B, 0x00, 0x00, 0x00,  // lamp
+    0x60, 0x5C, 0x7A, 0x84, 0xE5,  // language
+    0x60, 0x64, 0x72, 0x80, 0x00,  // large
+    0x60, 0x66, 0x59, 0x00, 0x00,  // laser
+    0x60, 0x6A, 0xE2, 0x4B, 0x20,  // laundry
+    0x60, 0x6F, 0x3A, 0xA6, 0x80,  // lawsuit
+    0x61, 0x42, 0x42, 0xC8, 0x00,  // leader
+    0x61, 0x42, 0x60, 0x00, 0x00,  // leaf
+    0x61, 0x43, 0x27, 0x00, 0x00,  // learn
+    0x61, 0x43, 0x62, 0xCC, 0x00,  // leaves
+    0x61, 0x47, 0x4A, 0xC8, 0xA0,  // lecture
+    0x61, 0x4E, 0x16, 0x00, 0x00,  // legal
+    0x61, 0x4E, 0x57, 0x10, 0x00,  // legend
+    0x61, 0x4F, 0x30, 0x00, 0x00,  // legs
+    0x61, 0x5C, 0x40, 0x00, 0x00,  // lend
+    0x61, 0x5C, 0x7A, 0x20, 0x00,  // length
+    0x61, 0x6C, 0x56, 0x00, 0x00,  // level
+    0x62, 0x44, 0x59, 0x53, 0x20,  // liberty
+    0x62, 0x45, 0x20, 0xCB, 0x20,  // library
+    0x62, 0x46, 0x57, 0x4C, 0xA0,  // license
+    0x62, 0x4D, 0x40, 0x00, 0x00,  // lift
+    0x62, 0x56, 0x56, 0x64, 0x00,  // likely
+    0x62, 0x58, 0x11, 0x80, 0x00,  // lilac
+    0x62, 0x59, 0x90, 0x00, 0x00,  // lily
+    0x62, 0x61, 0x30, 0x00, 0x00,  // lips
+    0x62, 0x63, 0x54, 0x90, 0x00,  // liquid
+    0x62, 0x67, 0x42, 0xB8, 0x00,  // listen
+    0x62, 0x68, 0x59, 0x06, 0x59,  // literary
+    0x62, 0x6C, 0x97, 0x1C, 0x00,  // living
+    0x62, 0x74, 0x19, 0x10, 0x00,  // lizard
+    0x63, 0xC2, 0xE0, 0x00, 0x00,  // loan
+    0x63, 0xC4, 0x50, 0x00, 0x00,  // lobe
+    0x63, 0xC6, 0x1A, 0x25, 0xEE,  // location
+    0x63, 0xE6, 0x97, 0x1C, 0x00,  // losing
+    0x63, 0xEA, 0x40, 0x00, 0x00,  // loud
+    0x63, 0xF2, 0x16, 0x53, 0x20,  // loyalty
+    0x65, 0x46, 0xB0, 0x00, 0x00,  // luck
+    0x65, 0x5C, 0x19, 0x00, 0x00,  // lunar
+    0x65, 0x5C, 0x34, 0x00, 0x00,  // lunch
+    0x65, 0x5C, 0x79, 0x80, 0x00,  // lungs
+    0x65, 0x71, 0x59, 0x64, 0x00,  // luxury
+    0x66, 0x52, 0xE3, 0x80, 0x00,  // lying
+    0x66, 0x64, 0x91, 0xCC, 0x00,  // lyrics
+    0x68, 0x46, 0x84, 0xB8, 0xA0,  // machine
+    0x68, 0x4E, 0x1D, 0x25, 0xC5,  // magazine
+    0x68, 0x52, 0x42, 0xB8, 0x00,  // maiden
+    0x68, 0x52, 0xC6, 0x85, 0xC0,  // mailman
+    0x68, 0x52, 0xE0, 0x00, 0x00,  // main
+    0x68, 0x56, 0x5A, 0xC0, 0x00,  // makeup
+    0x68, 0x56, 0x97, 0x1C, 0x00,  // making
+    0x68, 0x5A, 0x10, 0x00, 0x00,  // mama
+    0x68, 0x5C, 0x13, 0x96, 0x40,  // manager
+    0x68, 0x5C, 0x40, 0xD0, 0xA0,  // mandate
+    0x68, 0x5D, 0x34, 0xBD, 0xC0,  // mansion
+    0x68, 0x5D, 0x50, 0xB0, 0x00,  // manual
+    0x68, 0x64, 0x1A, 0x21, 0xEE,  // marathon
+    0x68, 0x64, 0x34, 0x00, 0x00,  // march
+    0x68, 0x64, 0xB2, 0xD0, 0x00,  // market
+    0x68, 0x65, 0x62, 0xB0, 0x00,  // marvel
+    0x68, 0x66, 0xF7, 0x00, 0x00,  // mason
+    0x68, 0x68, 0x59, 0x24, 0x2C,  // material
+    0x68, 0x68, 0x80, 0x00, 0x00,  // math
+    0x68, 0x70, 0x96, 0xD5, 0xA0,  // maximum
+    0x68, 0x72, 0xF9, 0x00, 0x00,  // mayor
+    0x69, 0x42, 0xE4, 0xB8, 0xE0,  // meaning
+    0x69, 0x48, 0x16, 0x00, 0x00,  // medal
+    0x69, 0x48, 0x91, 0x85, 0x80,  // medical
+    0x69, 0x5A, 0x22, 0xC8, 0x00,  // member
+    0x69, 0x5A, 0xF9, 0x64, 0x00,  // memory
+    0x69, 0x5D, 0x40, 0xB0, 0x00,  // mental
+    0x69, 0x64, 0x34, 0x05, 0xD4,  // merchant
+    0x69, 0x64, 0x9A, 0x00, 0x00,  // merit
+    0x69, 0x68, 0x87, 0x90, 0x00,  // method
+    0x69, 0x69, 0x24, 0x8C, 0x00,  // metric
+    0x6A, 0x49, 0x3A, 0x00, 0x00,  // midst
+    0x6A, 0x58, 0x40, 0x00, 0x00,  // mild
+    0x6A, 0x58, 0x9A, 0x06, 0x59,  // military
+    0x6A, 0x5C, 0x59, 0x05, 0x80,  // mineral
+    0x6A, 0x5C, 0x99, 0xD0, 0xB2,  // minister
+    0x6A, 0x64, 0x11, 0xB0, 0xA0,  // miracle
+    0x6A, 0x70, 0x52, 0x00, 0x00,  // mixed
+    0x6A, 0x71, 0x4A, 0xC8, 0xA0,  // mixture
+    0x6B, 0xC4, 0x96, 0x14, 0x00,  // mobile
+    0x6B, 0xC8, 0x59, 0x38, 0x00,  // modern
+    0x6B, 0xC8, 0x93, 0x64, 0x00,  // modify
+    0x6B, 0xD3, 0x3A, 0x56, 0x45,  // moisture
+    0x6B, 0xDA, 0x57, 0x50, 0x00,  // moment
+    0x6B, 0xE4, 0xE4, 0xB8, 0xE0,  // morning
+    0x6B, 0xE5, 0x43, 0x84, 0xE5,  // mortgage
+    0x6B, 0xE8, 0x82, 0xC8, 0x00,  // mother
+    0x6B, 0xEA, 0xEA, 0x05, 0x2E,  // mountain
+    0x6B, 0xEB, 0x32, 0x80, 0x00,  // mouse
+    0x6B, 0xEC, 0x50, 0x00, 0x00,  // move
+    0x6D, 0x46, 0x80, 0x00, 0x00,  // much
+    0x6D, 0x58, 0x50, 0x00, 0x00,  // mule
+    0x6D, 0x59, 0x44, 0xC1, 0x85,  // multiple
+    0x6D, 0x66, 0x36, 0x14, 0x00,  // muscle
+    0x6D, 0x66, 0x5A, 0xB4, 0x00,  // museum
+    0x6D, 0x66, 0x91, 0x80, 0x00,  // music
+    0x6D, 0x67, 0x40, 0xB8, 0xE0,  // mustang
+    0x70, 0x52, 0xC0, 0x00, 0x00,  // nail
+    0x70, 0x68, 0x97, 0xB8, 0x2C,  // national
+    0x71, 0x46, 0xB6, 0x04, 0x65,  // necklace
+    0x71, 0x4E, 0x1A, 0x26, 0xC5,  // negative
+    0x71, 0x65, 0x67, 0xD6, 0x60,  // nervous
+    0x71, 0x69, 0x77, 0xC9, 0x60,  // network
+    0x71, 0x6F, 0x30, 0x00, 0x00,  // news
+    0x75, 0x46, 0xC2, 0x86, 0x40,  // nuclear
+    0x75, 0x5A, 0x20, 0x00, 0x00,  // numb
+    0x75, 0x5A, 0x59, 0x3E, 0xB3,  // numerous
+    0x76, 0x58, 0xF7, 0x00, 0x00,  // nylon
+    0x78, 0x66, 0x99, 0x80, 0x00,  // oasis
+    0x78, 0x8B, 0x34, 0xD3, 0x20,  // obesity
+    0x78, 0x94, 0x51, 0xD0, 0x00,  // object
+    0x78, 0xA6, 0x59, 0x58, 0xA0,  // observe
+    0x78, 0xA8, 0x14, 0xB8, 0x00,  // obtain
+    0x78, 0xCA, 0x17, 0x00, 0x00,  // ocean
+    0x79, 0xA8, 0x57, 0x00, 0x00,  // often
+    0x7B, 0x32, 0xD8, 0x24, 0x60,  // olympic
+    0x7B, 0x53, 0x40, 0x00, 0x00,  // omit
+    0x7C, 0x82, 0xC0, 0x00, 0x00,  // oral
+    0x7C, 0x82, 0xE3, 0x94, 0x00,  // orange
+    0x7C, 0x84, 0x9A, 0x00, 0x00,  // orbit
+    0x7C, 0x88, 0x59, 0x00, 0x00,  // order
+    0x7C, 0x88, 0x97, 0x06, 0x59,  // ordinary
+    0x7C, 0x8E, 0x17, 0x27, 0x45,  // organize
+    0x7D, 0x5C, 0x32, 0x80, 0x00,  // ounce
+    0x7D, 0x8A, 0xE0, 0x00, 0x00,  // oven
+    0x7D, 0x8B, 0x20, 0xB1, 0x80,  // overall
+    0x7D, 0xDC, 0x59, 0x00, 0x00,  // owner
+    0x80, 0x46, 0x59, 0x80, 0x00,  // paces
+    0x80, 0x46, 0x93, 0x24, 0x60,  // pacific
+    0x80, 0x46, 0xB0, 0x9C, 0xA0,  // package
+    0x80, 0x52, 0x40, 0x00, 0x00,  // paid
+    0x80, 0x52, 0xEA, 0x25, 0xC7,  // painting
+    0x80, 0x54, 0x16, 0x86, 0x60,  // pajamas
+    0x80, 0x5C, 0x30, 0xAC, 0xA0,  // pancake
+    0x80, 0x5D, 0x49, 0x80, 0x00,  // pants
+    0x80, 0x60, 0x10, 0x00, 0x00,  // papa
+    0x80, 0x60, 0x59, 0x00, 0x00,  // paper
+    0x80, 0x64, 0x32, 0xB0, 0x00,  // parcel
+    0x80, 0x64, 0xB4, 0xB8, 0xE0,  // parking
+    0x80, 0x65, 0x4C, 0x80, 0x00,  // party
+    0x80, 0x68, 0x57, 0x50, 0x00,  // patent
+    0x80, 0x69, 0x27, 0xB0, 0x00,  // patrol
+    0x80, 0x72, 0xD2, 0xBA, 0x80,  // payment
+    0x80, 0x73, 0x27, 0xB1, 0x80,  // payroll
+    0x81, 0x42, 0x32, 0x9A, 0xAC,  // peaceful
+    0x81, 0x42, 0xEA, 0xD0, 0x00,  // peanut
+    0x81, 0x43, 0x30, 0xBA, 0x80,  // peasant
+    0x81, 0x46, 0x17, 0x00, 0x00,  // pecan
+    0x81, 0x5C, 0x16, 0x53, 0x20,  // penalty
+    0x81, 0x5C, 0x34, 0xB0, 0x00,  // pencil
+    0x81, 0x64, 0x32, 0xBA, 0x80,  // percent
+    0x81, 0x64, 0x62, 0x8E, 0x80,  // perfect
+    0x81, 0x64, 0xD4, 0xD0, 0x00,  // permit
+    0x81, 0x68, 0x9A, 0x25, 0xEE,  // petition
+    0x82, 0x02, 0xEA, 0x3D, 0xA0,  // phantom
+    0x82, 0x03, 0x26, 0x84, 0x79,  // pharmacy
+    0x82, 0x1F, 0x47, 0x80, 0x00,  // photo
+    0x82, 0x24, 0x19, 0x94, 0x00,  // phrase
+    0x82, 0x33, 0x34, 0x8E, 0x60,  // physics
+    0x82, 0x46, 0xBA, 0xC0, 0x00,  // pickup
+    0x82, 0x47, 0x4A, 0xC8, 0xA0,  // picture
+    0x82, 0x4A, 0x32, 0x80, 0x00,  // piece
+    0x82, 0x58, 0x50, 0x00, 0x00,  // pile
+    0x82, 0x5C, 0xB0, 0x00, 0x00,  // pink
+    0x82, 0x60, 0x56, 0x25, 0xC5,  // pipeline
+    0x82, 0x67, 0x47, 0xB0, 0x00,  // pistol
+    0x82, 0x68, 0x34, 0x00, 0x00,  // pitch
+    0x83, 0x02, 0x97, 0x4C, 0x00,  // plains
+    0x83, 0x02, 0xE0, 0x00, 0x00,  // plan
+    0x83, 0x03, 0x3A, 0x24, 0x60,  // plastic
+    0x83, 0x03, 0x43, 0x3E, 0x4D,  // platform
+    0x83, 0x03, 0x97, 0x98, 0xC0,  // playoff
+    0x83, 0x0A, 0x19, 0xD6, 0x45,  // pleasure
+    0x83, 0x1F, 0x40, 0x00, 0x00,  // plot
+    0x83, 0x2A, 0xE3, 0x94, 0x00,  // plunge
+    0x84, 0x82, 0x3A, 0x24, 0x65,  // practice
+    0x84, 0x83, 0x92, 0xC8, 0x00,  // prayer
+    0x84, 0x8A, 0x11, 0xA0, 0x00,  // preach
+    0x84, 0x8A, 0x40, 0xD1, 0xF2,  // predator
+    0x84, 0x8A, 0x77, 0x05, 0xD4,  // pregnant
+    0x84, 0x8A, 0xD4, 0xD5, 0xA0,  // premium
+    0x84, 0x8B, 0x00, 0xC8, 0xA0,  // prepare
+    0x84, 0x8B, 0x32, 0xB8, 0x65,  // presence
+    0x84, 0x8B, 0x62, 0xBA, 0x80,  // prevent
+    0x84, 0x92, 0x59, 0xD0, 0x00,  // priest
+    0x84, 0x92, 0xD0, 0xCB, 0x20,  // primary
+    0x84, 0x92, 0xF9, 0x26, 0x99,  // priority
+    0x84, 0x93, 0x37, 0xB8, 0xB2,  // prisoner
+    0x84, 0x93, 0x60, 0x8F, 0x20,  // privacy
+    0x84, 0x93, 0xA2, 0x80, 0x00,  // prize
+    0x84, 0x9E, 0x26, 0x15, 0xA0,  // problem
+    0x84, 0x9E, 0x32, 0xCE, 0x60,  // process
+    0x84, 0x9E, 0x64, 0xB0, 0xA0,  // profile
+    0x84, 0x9E, 0x79, 0x05, 0xA0,  // program
+    0x84, 0x9E, 0xD4, 0xCC, 0xA0,  // promise
+    0x84, 0x9F, 0x38, 0x14, 0x74,  // prospect
+    0x84, 0x9F, 0x64, 0x90, 0xA0,  // provide
+    0x84, 0xAA, 0xE2, 0x80, 0x00,  // prune
+    0x85, 0x44, 0xC4, 0x8C, 0x00,  // public
+    0x85, 0x59, 0x32, 0x80, 0x00,  // pulse
+    0x85, 0x5B, 0x09, 0x80, 0x00,  // pumps
+    0x85, 0x5C, 0x99, 0xA0, 0x00,  // punish
+    0x85, 0x5D, 0x90, 0x00, 0x00,  // puny
+    0x85, 0x60, 0x16, 0x00, 0x00,  // pupal
+    0x85, 0x64, 0x34, 0x06, 0x65,  // purchase
+    0x85, 0x65, 0x06, 0x14, 0x00,  // purple
+    0x86, 0x68, 0x87, 0xB8, 0x00,  // python
+    0x8D, 0x42, 0xEA, 0x26, 0x99,  // quantity
+    0x8D, 0x43, 0x2A, 0x16, 0x40,  // quarter
+    0x8D, 0x52, 0x35, 0x80, 0x00,  // quick
+    0x8D, 0x52, 0x5A, 0x00, 0x00,  // quiet
+    0x90, 0x46, 0x50, 0x00, 0x00,  // race
+    0x90, 0x46, 0x99, 0xB4, 0x00,  // racism
+    0x90, 0x48, 0x19, 0x00, 0x00,  // radar
+    0x90, 0x52, 0xC9, 0x3C, 0x24,  // railroad
+    0x90, 0x52, 0xE1, 0x3E, 0xE0,  // rainbow
+    0x90, 0x53, 0x34, 0xB8, 0x00,  // raisin
+    0x90, 0x5C, 0x47, 0xB4, 0x00,  // random
+    0x90, 0x5C, 0xB2, 0x90, 0x00,  // ranked
+    0x90, 0x60, 0x92, 0x4C, 0x00,  // rapids
+    0x90, 0x67, 0x0C, 0x80, 0x00,  // raspy
+    0x91, 0x42, 0x3A, 0x25, 0xEE,  // reaction
+    0x91, 0x42, 0xC4, 0xE8, 0xA0,  // realize
+    0x91, 0x44, 0xFA, 0xB8, 0x80,  // rebound
+    0x91, 0x45, 0x54, 0xB0, 0x80,  // rebuild
+    0x91, 0x46, 0x16, 0x30, 0x00,  // recall
+    0x91, 0x46, 0x54, 0xD8, 0xB2,  // receiver
+    0x91, 0x46, 0xFB, 0x16, 0x40,  // recover
+    0x91, 0x4F, 0x22, 0xD0, 0x00,  // regret
+    0x91, 0x4F, 0x56, 0x06, 0x40,  // regular
+    0x91, 0x54, 0x51, 0xD0, 0x00,  // reject
+    0x91, 0x58, 0x1A, 0x14, 0x00,  // relate
+    0x91, 0x5A, 0x56, 0x88, 0xB2,  // remember
+    0x91, 0x5A, 0x97, 0x10, 0x00,  // remind
+    0x91, 0x5A, 0xFB, 0x14, 0x00,  // remove
+    0x91, 0x5C, 0x42, 0xC8, 0x00,  // render
+    0x91, 0x60, 0x14, 0xC8, 0x00,  // repair
+    0x91, 0x60, 0x50, 0xD0, 0x00,  // repeat
+    0x91, 0x60, 0xC0, 0x8C, 0xA0,  // replace
+    0x91, 0x63, 0x54, 0xC8, 0xA0,  // require
+    0x91, 0x66, 0x3A, 0x94, 0x00,  // rescue
+    0x91, 0x66, 0x50, 0xC8, 0x68,  // research
+    0x91, 0x66, 0x92, 0x15, 0xD4,  // resident
+    0x91, 0x67, 0x07, 0xBA, 0x65,  // response
+    0x91, 0x67, 0x56, 0x50, 0x00,  // result
+    0x91, 0x68, 0x14, 0xB0, 0xB2,  // retailer
+    0x91, 0x69, 0x22, 0x86, 0x80,  // retreat
+    0x91, 0x6A, 0xE4, 0xBD, 0xC0,  // reunion
+    0x91, 0x6C, 0x57, 0x54, 0xA0,  // revenue
+    0x91, 0x6C, 0x92, 0xDC, 0x00,  // review
+    0x91, 0x6E, 0x19, 0x10, 0x00,  // reward
+    0x92, 0x32, 0xD2, 0x80, 0x00,  // rhyme
+    0x92, 0x33, 0x44, 0x34, 0x00,  // rhythm
+    0x92, 0x46, 0x80, 0x00, 0x00,  // rich
+    0x92, 0x6C, 0x16, 0x00, 0x00,  // rival
+    0x92, 0x6C, 0x59, 0x00, 0x00,  // river
+    0x93, 0xC4, 0x97, 0x00, 0x00,  // robin
+    0x93, 0xC6, 0xBC, 0x80, 0x00,  // rocky
+    0x93, 0xDA, 0x17, 0x51, 0x23,  // romantic
+    0x93, 0xDB, 0x00, 0x00, 0x00,  // romp
+    0x93, 0xE7, 0x42, 0xC8, 0x00,  // roster
+    0x93, 0xEA, 0xE2, 0x00, 0x00,  // round
+    0x93, 0xF2, 0x16, 0x00, 0x00,  // royal
+    0x95, 0x52, 0xE0, 0x00, 0x00,  // ruin
+    0x95, 0x58, 0x59, 0x00, 0x00,  // ruler
+    0x95, 0x5A, 0xF9, 0x00, 0x00,  // rumor
+    0x98, 0x46, 0xB0, 0x00, 0x00,  // sack
+    0x98, 0x4C, 0x19, 0x24, 0x00,  // safari
+    0x98, 0x58, 0x19, 0x64, 0x00,  // salary
+    0x98, 0x58, 0xF7, 0x00, 0x00,  // salon
+    0x98, 0x59, 0x40, 0x00, 0x00,  // salt
+    0x98, 0x68, 0x99, 0x9B, 0x20,  // satisfy
+    0x98, 0x68, 0xF9, 0xA1, 0x20,  // satoshi
+    0x98, 0x6C, 0x59, 0x00, 0x00,  // saver
+    0x98, 0x73, 0x30, 0x00, 0x00,  // says
+    0x98, 0xC2, 0xE2, 0x05, 0x80,  // scandal
+    0x98, 0xC3, 0x22, 0x90, 0x00,  // scared
+    0x98, 0xC3, 0x4A, 0x16, 0x40,  // scatter
+    0x98, 0xCA, 0xE2, 0x80, 0x00,  // scene
+    0x98, 0xD0, 0xF6, 0x06, 0x40,  // scholar
+    0x98, 0xD2, 0x57, 0x0C, 0xA0,  // science
+    0x98, 0xDF, 0x5A, 0x00, 0x00,  // scout
+    0x98, 0xE4, 0x16, 0x89, 0x85,  // scramble
+    0x98, 0xE4, 0x5B, 0x80, 0x00,  // screw
+    0x98, 0xE4, 0x98, 0x50, 0x00,  // script
+    0x98, 0xE4, 0xF6, 0x30, 0x00,  // scroll
+    0x99, 0x42, 0x67, 0xBC, 0x80,  // seafood
+    0x99, 0x43, 0x37, 0xB8, 0x00,  // season
+    0x99, 0x47, 0x22, 0xD0, 0x00,  // secret
+    0x99, 0x47, 0x59, 0x26, 0x99,  // security
+    0x99, 0x4E, 0xD2, 0xBA, 0x80,  // segment
+    0x99, 0x5C, 0x97, 0xC8, 0x00,  // senior
+    0x9A, 0x02, 0x47, 0xDC, 0x00,  // shadow
+    0x9A, 0x02, 0x6A, 0x00, 0x00,  // shaft
+    0x9A, 0x02, 0xD2, 0x80, 0x00,  // shame
+    0x9A, 0x03, 0x02, 0x90, 0x00,  // shaped
+    0x9A, 0x03, 0x28, 0x00, 0x00,  // sharp
+    0x9A, 0x0A, 0xCA, 0x16, 0x40,  // shelter
+    0x9A, 0x0B, 0x24, 0x98, 0xC0,  // sheriff
+    0x9A, 0x1F, 0x2A, 0x00, 0x00,  // short
+    0x9A, 0x1F, 0x56, 0x10, 0x00,  // should
+    0x9A, 0x24, 0x96, 0xC0, 0x00,  // shrimp
+    0x9A, 0x48, 0x5B, 0x85, 0x8B,  // sidewalk
+    0x9A, 0x58, 0x57, 0x50, 0x00,  // silent
+    0x9A, 0x59, 0x62, 0xC8, 0x00,  // silver
+    0x9A, 0x5A, 0x96, 0x06, 0x40,  // similar
+    0x9A, 0x5B, 0x06, 0x14, 0x00,  // simple
+    0x9A, 0x5C, 0x76, 0x14, 0x00,  // single
+    0x9A, 0x67, 0x42, 0xC8, 0x00,  // sister
+    0x9A, 0xD2, 0xE0, 0x00, 0x00,  // skin
+    0x9A, 0xEA, 0xE5, 0x80, 0x00,  // skunk
+    0x9B, 0x03, 0x00, 0x00, 0x00,  // slap
+    0x9B, 0x03, 0x62, 0xCB, 0x20,  // slavery
+    0x9B, 0x0A, 0x40, 0x00, 0x00,  // sled
+    0x9B, 0x12, 0x32, 0x80, 0x00,  // slice
+    0x9B, 0x12, 0xD0, 0x00, 0x00,  // slim
+    0x9B, 0x1F, 0x70, 0x00, 0x00,  // slow
+    0x9B, 0x2B, 0x34, 0x00, 0x00,  // slush
+    0x9B, 0x43, 0x2A, 0x00, 0x00,  // smart
+    0x9B, 0x4A, 0x19, 0x00, 0x00,  // smear
+    0x9B, 0x4A, 0xC6, 0x00, 0x00,  // smell
+    0x9B, 0x53, 0x25, 0x80, 0x00,  // smirk
+    0x9B, 0x53, 0x44, 0x00, 0x00,  // smith
+    0x9B, 0x5E, 0xB4, 0xB8, 0xE0,  // smoking
+    0x9B, 0x6A, 0x70, 0x00, 0x00,  // smug
+    0x9B, 0x82, 0xB2, 0x80, 0x00,  // snake
+    0x9B, 0x83, 0x09, 0xA1, 0xF4,  // snapshot
+    0x9B, 0x92, 0x63, 0x00, 0x00,  // sniff
+    0x9B, 0xC6, 0x92, 0xD3, 0x20,  // society
+    0x9B, 0xCD, 0x4B, 0x86, 0x45,  // software
+    0x9B, 0xD8, 0x44, 0x96, 0x40,  // soldier
+    0x9B, 0xD9, 0x5A, 0x25, 0xEE,  // solution
+    0x9B, 0xEA, 0xC0, 0x00, 0x00,  // soul
+    0x9B, 0xEB, 0x21, 0x94, 0x00,  // source
+    0x9C, 0x02, 0x32, 0x80, 0x00,  // space
+    0x9C, 0x03, 0x25, 0x80, 0x00,  // spark
+    0x9C, 0x0A, 0x15, 0x80, 0x00,  // speak
+    0x9C, 0x0A, 0x34, 0x96, 0x60,  // species
+    0x9C, 0x0A, 0xC6, 0x25, 0xC7,  // spelling
+    0x9C, 0x0A, 0xE2, 0x00, 0x00,  // spend
+    0x9C, 0x0B, 0x70, 0x00, 0x00,  // spew
+    0x9C, 0x12, 0x42, 0xC8, 0x00,  // spider
+    0x9C, 0x12, 0xC6, 0x00, 0x00,  // spill
+    0x9C, 0x12, 0xE2, 0x80, 0x00,  // spine
+    0x9C, 0x13, 0x24, 0xD0, 0x00,  // spirit
+    0x9C, 0x13, 0x40, 0x00, 0x00,  // spit
+    0x9C, 0x24, 0x1C, 0x80, 0x00,  // spray
+    0x9C, 0x24, 0x97, 0x2D, 0x85,  // sprinkle
+    0x9C, 0x6A, 0x19, 0x14, 0x00,  // square
+    0x9C, 0x6A, 0x52, 0xE8, 0xA0,  // squeeze
+    0x9D, 0x02, 0x44, 0xD5, 0xA0,  // stadium
+    0x9D, 0x02, 0x63, 0x00, 0x00,  // staff
+    0x9D, 0x02, 0xE2, 0x06, 0x44,  // standard
+    0x9D, 0x03, 0x2A, 0x25, 0xC7,  // starting
+    0x9D, 0x03, 0x44, 0xBD, 0xC0,  // station
+    0x9D, 0x03, 0x90, 0x00, 0x00,  // stay
+    0x9D, 0x0A, 0x12, 0x64, 0x00,  // steady
+    0x9D, 0x0B, 0x00, 0x00, 0x00,  // step
+    0x9D, 0x12, 0x35, 0x80, 0x00,  // stick
+    0x9D, 0x12, 0xCA, 0x00, 0x00,  // stilt
+    0x9D, 0x1F, 0x2C, 0x80, 0x00,  // story
+    0x9D, 0x24, 0x1A, 0x14, 0xF9,  // strategy
+    0x9D, 0x24, 0x95, 0x94, 0x00,  // strike
+    0x9D, 0x32, 0xC2, 0x80, 0x00,  // style
+    0x9D, 0x44, 0xA2, 0x8E, 0x80,  // subject
+    0x9D, 0x44, 0xD4, 0xD0, 0x00,  // submit
+    0x9D, 0x4E, 0x19, 0x00, 0x00,  // sugar
+    0x9D, 0x53, 0x40, 0x89, 0x85,  // suitable
+    0x9D, 0x5C, 0xC4, 0x9D, 0x14,  // sunlight
+    0x9D, 0x60, 0x59, 0x25, 0xF2,  // superior
+    0x9D, 0x64, 0x60, 0x8C, 0xA0,  // surface
+    0x9D, 0x65, 0x09, 0x26, 0x65,  // surprise
+    0x9D, 0x65, 0x64, 0xD8, 0xA0,  // survive
+    0x9D, 0xCA, 0x1A, 0x16, 0x40,  // sweater
+    0x9D, 0xD2, 0xD6, 0xA5, 0xC7,  // swimming
+    0x9D, 0xD2, 0xE3, 0x80, 0x00,  // swing
+    0x9D, 0xD3, 0x41, 0xA0, 0x00,  // switch
+    0x9E, 0x5A, 0x27, 0xB1, 0x23,  // symbolic
+    0x9E, 0x5B, 0x00, 0xD1, 0x19,  // sympathy
+    0x9E, 0x5C, 0x49, 0x3D, 0xA5,  // syndrome
+    0x9E, 0x67, 0x42, 0xB4, 0x00,  // system
+    0xA0, 0x46, 0xB6, 0x14, 0x00,  // tackle
+    0xA0, 0x47, 0x44, 0x8E, 0x60,  // tactics
+    0xA0, 0x49, 0x07, 0xB0, 0xA0,  // tadpole
+    0xA0, 0x58, 0x57, 0x50, 0x00,  // talent
+    0xA0, 0x66, 0xB0, 0x00, 0x00,  // task
+    0xA0, 0x67, 0x42, 0x80, 0x00,  // taste
+    0xA0, 0x6A, 0x74, 0x50, 0x00,  // taught
+    0xA0, 0x70, 0x90, 0x00, 0x00,  // taxi
+    0xA1, 0x42, 0x34, 0x16, 0x40,  // teacher
+    0xA1, 0x42, 0xD6, 0x86, 0x85,  // teammate
+    0xA1, 0x43, 0x38, 0x3D, 0xEE,  // teaspoon
+    0xA1, 0x5B, 0x06, 0x14, 0x00,  // temple
+    0xA1, 0x5C, 0x17, 0x50, 0x00,  // tenant
+    0xA1, 0x5C, 0x42, 0xB8, 0x79,  // tendency
+    0xA1, 0x5D, 0x34, 0xBD, 0xC0,  // tension
+    0xA1, 0x64, 0xD4, 0xB8, 0x2C,  // terminal
+    0xA1, 0x67, 0x44, 0x9B, 0x20,  // testify
+    0xA1, 0x71, 0x4A, 0xC8, 0xA0,  // texture
+    0xA2, 0x02, 0xE5, 0x80, 0x00,  // thank
+    0xA2, 0x03, 0x40, 0x00, 0x00,  // that
+    0xA2, 0x0A, 0x1A, 0x16, 0x40,  // theater
+    0xA2, 0x0A, 0xF9, 0x64, 0x00,  // theory
+    0xA2, 0x0B, 0x20, 0xC3, 0x20,  // therapy
+    0xA2, 0x1F, 0x27, 0x00, 0x00,  // thorn
+    0xA2, 0x24, 0x50, 0xD0, 0xAE,  // threaten
+    0xA2, 0x2A, 0xD1, 0x00, 0x00,  // thumb
+    0xA2, 0x2A, 0xE2, 0x16, 0x40,  // thunder
+    0xA2, 0x46, 0xB2, 0xD0, 0x00,  // ticket
+    0xA2, 0x49, 0x90, 0x00, 0x00,  // tidy
+    0xA2, 0x5A, 0x22, 0xC8, 0x00,  // timber
+    0xA2, 0x5A, 0x56, 0x64, 0x00,  // timely
+    0xA2, 0x5C, 0x70, 0x00, 0x00,  // ting
+    0xA3, 0xCD, 0x50, 0x00, 0x00,  // tofu
+    0xA3, 0xCE, 0x5A, 0x20, 0xB2,  // together
+    0xA3, 0xD8, 0x59, 0x06, 0x85,  // tolerate
+    0xA3, 0xE8, 0x16, 0x00, 0x00,  // total
+    0xA3, 0xF0, 0x91, 0x80, 0x00,  // toxic
+    0xA4, 0x82, 0x35, 0xCC, 0x00,  // tracks
+    0xA4, 0x82, 0x63, 0x24, 0x60,  // traffic
+    0xA4, 0x82, 0x97, 0x25, 0xC7,  // training
+    0xA4, 0x82, 0xE9, 0x98, 0xB2,  // transfer
+    0xA4, 0x83, 0x34, 0x00, 0x00,  // trash
+    0xA4, 0x83, 0x62, 0xB0, 0xB2,  // traveler
+    0xA4, 0x8A, 0x1A, 0x00, 0x00,  // treat
+    0xA4, 0x8A, 0xE2, 0x00, 0x00,  // trend
+    0xA4, 0x92, 0x16, 0x00, 0x00,  // trial
+    0xA4, 0x92, 0x3C, 0x8D, 0x85,  // tricycle
+    0xA4, 0x93, 0x00, 0x00, 0x00,  // trip
+    0xA4, 0x93, 0x56, 0xC1, 0x00,  // triumph
+    0xA4, 0x9F, 0x51, 0x30, 0xA0,  // trouble
+    0xA4, 0xAA, 0x50, 0x00, 0x00,  // true
+    0xA4, 0xAB, 0x3A, 0x00, 0x00,  // trust
+    0xA5, 0xD2, 0x32, 0x80, 0x00,  // twice
+    0xA5, 0xD2, 0xE0, 0x00, 0x00,  // twin
+    0xA6, 0x60, 0x50, 0x00, 0x00,  // type
+    0xA6, 0x60, 0x91, 0x85, 0x80,  // typical
+    0xA9, 0xD9, 0x90, 0x00, 0x00,  // ugly
+    0xAB, 0x28, 0x96, 0x86, 0x85,  // ultimate
+    0xAB, 0x45, 0x22, 0xB1, 0x81,  // umbrella
+    0xAB, 0x86, 0xFB, 0x16, 0x40,  // uncover
+    0xAB, 0x88, 0x59, 0x1D, 0xE0,  // undergo
+    0xAB, 0x8C, 0x14, 0xC8, 0x00,  // unfair
+    0xAB, 0x8C, 0xF6, 0x10, 0x00,  // unfold
+    0xAB, 0x90, 0x18, 0x43, 0x20,  // unhappy
+    0xAB, 0x92, 0xF7, 0x00, 0x00,  // union
+    0xAB, 0x93, 0x62, 0xCA, 0x65,  // universe
+    0xAB, 0x96, 0x97, 0x10, 0x00,  // unkind
+    0xAB, 0x96, 0xE7, 0xDD, 0xC0,  // unknown
+    0xAB, 0xAB, 0x3A, 0x85, 0x80,  // unusual
+    0xAB, 0xAF, 0x20, 0xC0, 0x00,  // unwrap
+    0xAC, 0x0F, 0x20, 0x90, 0xA0,  // upgrade
+    0xAC, 0x27, 0x40, 0xA6, 0x53,  // upstairs
+    0xAC, 0xCB, 0x27, 0x05, 0xA5,  // username
+    0xAC, 0xD0, 0x59, 0x00, 0x00,  // usher
+    0xAC, 0xEA, 0x16, 0x00, 0x00,  // usual
+    0xB0, 0x58, 0x92, 0x00, 0x00,  // valid
+    0xB0, 0x59, 0x50, 0x89, 0x85,  // valuable
+    0xB0, 0x5B, 0x04, 0xC8, 0xA0,  // vampire
+    0xB0, 0x5C, 0x99, 0xA0, 0x00,  // vanish
+    0xB0, 0x64, 0x97, 0xD6, 0x60,  // various
+    0xB1, 0x4E, 0x17, 0x00, 0x00,  // vegan
+    0xB1, 0x59, 0x62, 0xD0, 0x00,  // velvet
+    0xB1, 0x5D, 0x4A, 0xC8, 0xA0,  // venture
+    0xB1, 0x64, 0x44, 0x8E, 0x80,  // verdict
+    0xB1, 0x64, 0x93, 0x64, 0x00,  // verify
+    0xB1, 0x65, 0x90, 0x00, 0x00,  // very
+    0xB1, 0x68, 0x59, 0x05, 0xC0,  // veteran
+    0xB1, 0x70, 0x52, 0x00, 0x00,  // vexed
+    0xB2, 0x47, 0x44, 0xB4, 0x00,  // victim
+    0xB2, 0x48, 0x57, 0x80, 0x00,  // video
+    0xB2, 0x4B, 0x70, 0x00, 0x00,  // view
+    0xB2, 0x5D, 0x40, 0x9C, 0xA0,  // vintage
+    0xB2, 0x5E, 0xC2, 0xB8, 0x65,  // violence
+    0xB2, 0x64, 0x16, 0x00, 0x00,  // viral
+    0xB2, 0x66, 0x9A, 0x3E, 0x40,  // visitor
+    0xB2, 0x67, 0x50, 0xB0, 0x00,  // visual
+    0xB2, 0x68, 0x16, 0xA5, 0xD3,  // vitamins
+    0xB3, 0xC6, 0x16, 0x00, 0x00,  // vocal
+    0xB3, 0xD2, 0x32, 0x80, 0x00,  // voice
+    0xB3, 0xD9, 0x56, 0x94, 0x00,  // volume
+    0xB3, 0xE8, 0x59, 0x00, 0x00,  // voter
+    0xB3, 0xE8, 0x97, 0x1C, 0x00,  // voting
+    0xB8, 0x58, 0xEA, 0xD0, 0x00,  // walnut
+    0xB8, 0x64, 0xDA, 0x20, 0x00,  // warmth
+    0xB8, 0x64, 0xE0, 0x00, 0x00,  // warn
+    0xB8, 0x68, 0x34, 0x00, 0x00,  // watch
+    0xB8, 0x6D, 0x90, 0x00, 0x00,  // wavy
+    0xB9, 0x42, 0xCA, 0x23, 0x20,  // wealthy
+    0xB9, 0x43, 0x07, 0xB8, 0x00,  // weapon
+    0xB9, 0x44, 0x30, 0xB4, 0x00,  // webcam
+    0xB9, 0x58, 0x37, 0xB4, 0xA0,  // welcome
+    0xB9, 0x58, 0x60, 0xC8, 0xA0,  // welfare
+    0xB9, 0x67, 0x42, 0xC9, 0xC0,  // western
+    0xBA, 0x49, 0x44, 0x00, 0x00,  // width
+    0xBA, 0x58, 0x46, 0x24, 0xC5,  // wildlife
+    0xBA, 0x5C, 0x47, 0xDC, 0x00,  // window
+    0xBA, 0x5C, 0x50, 0x00, 0x00,  // wine
+    0xBA, 0x64, 0x56, 0x16, 0x73,  // wireless
+    0xBA, 0x66, 0x47, 0xB4, 0x00,  // wisdom
+    0xBA, 0x68, 0x82, 0x48, 0x37,  // withdraw
+    0xBA, 0x69, 0x30, 0x00, 0x00,  // wits
+    0xBB, 0xD8, 0x60, 0x00, 0x00,  // wolf
+    0xBB, 0xDA, 0x17, 0x00, 0x00,  // woman
+    0xBB, 0xE4, 0xB0, 0x00, 0x00,  // work
+    0xBB, 0xE5, 0x44, 0x64, 0x00,  // worthy
+    0xBC, 0x83, 0x00, 0x00, 0x00,  // wrap
+    0xBC, 0x93, 0x3A, 0x00, 0x00,  // wrist
+    0xBC, 0x93, 0x44, 0xB8, 0xE0,  // writing
+    0xBC, 0x9F, 0x42, 0x80, 0x00,  // wrote
+    0xC9, 0x43, 0x20, 0x00, 0x00,  // year
+    0xC9, 0x59, 0x00, 0x00, 0x00,  // yelp
+    0xCA, 0x4A, 0xC2, 0x00, 0x00,  // yield
+    0xCB, 0xCE, 0x10, 0x00, 0x00,  // yoga
+    0xD1, 0x64, 0xF0, 0x00, 0x00};  // zero
+
+// Generated by tools/wordlists/gen_wordlists.py: prefix trie, see wordlist.h for the layout
+unsigned long long const SLIP39_TRIE[] = {
+    0x0015FFFFFF7FFFFFULL, 0x0193C8E530F7BB6CULL, 0x0250492440124910ULL, 0x02B0492645124991ULL,
+    0x0330490445524111ULL, 0x03929EE035A7B90DULL, 0x0450492404124901ULL, 0x04B0492044124811ULL,
+    0x0510410045104011ULL, 0x055010C0202E3008ULL, 0x0590400040104011ULL, 0x05B0008440002110ULL,
+    0x05E4410445104111ULL, 0x0640410444104111ULL, 0x0690400045100011ULL, 0x06C0880008721827ULL,
+    0x06F0482645120991ULL, 0x0760400000100000ULL, 0x0770410644104191ULL, 0x07D567F65559FD95ULL,
+    0x08D5090645424191ULL, 0x095012800004B840ULL, 0x0980010444004111ULL, 0x09C0090444024111ULL,
+    0x0A10000040004110ULL, 0x0A202000000B2101ULL, 0x0A30800000305211ULL, 0x0000000000020011ULL,
+    0x0A40080000020008ULL, 0x0A500004005A8107ULL, 0x0000000000104003ULL, 0x0A600001148C0145ULL,
+    0x0A90200000081054ULL, 0x0000000000002044ULL, 0x0000000000004110ULL, 0x0AA0000004000001ULL,
+    0x0000000000000900ULL, 0x0AB000200504298DULL, 0x0000000000064400ULL, 0x0AD0000404100111ULL,
+    0x0AF00800001A0808ULL, 0x0B00010004004111ULL, 0x0B2008200106390CULL, 0x0B400A40001AB840ULL,
+    0x0000000000022100ULL, 0x0B70000044100011ULL, 0x0000000000202000ULL, 0x0B90410404104111ULL,
+    0x0BD0400004761809ULL, 0x0BF0400405104111ULL, 0x0C20080000060802ULL, 0x00000000001A3100ULL,
+    0x0C30B2801C2CB807ULL, 0x0CB090000024B815ULL, 0x0CD0004000501004ULL, 0x0CE0000445104111ULL,
+    0x0000000000020404ULL, 0x0D10180000060000ULL, 0x0000000000004880ULL, 0x0000000000100140ULL,
+    0x0D3000004004011AULL, 0x0D40020000008111ULL, 0x0D50800060280A78ULL, 0x0D80000400000100ULL,
+    0x0D90400000100000ULL, 0x0000000000004001ULL, 0x0DA0200000080004ULL, 0x0DB0000400004111ULL,
+    0x0DC022005408C095ULL, 0x0E1020C410683D04ULL, 0x0E601880000E2806ULL, 0x0E90010044104111ULL,
+    0x0EC0080000120004ULL, 0x0ED0010444004111ULL, 0x0000000000063000ULL, 0x0F100800000E1800ULL,
+    0x0F20008000046000ULL, 0x0F30000004000111ULL, 0x0000000000000801ULL, 0x0F40010404104111ULL,
+    0x0F70000400001111ULL, 0x0F80808002623100ULL, 0x0FA0080004060801ULL, 0x0FC0002000161802ULL,
+    0x0FD0104000043040ULL, 0x0FF0000040000810ULL, 0x1000020000008001ULL, 0x1010B000B02C12ACULL,
+    0x0000000000004800ULL, 0x0000000000420000ULL, 0x1070008000063108ULL, 0x0000000001020000ULL,
+    0x0000000000082008ULL, 0x1080000400000100ULL, 0x1090000020563108ULL, 0x10A0008104202045ULL,
+    0x10D000200A2D8C26ULL, 0x0000000001140007ULL, 0x10F0008000802004ULL, 0x0000000000020100ULL,
+    0x11002894018E3544ULL, 0x11502840200A3009ULL, 0x119200A000822808ULL, 0x11C04800203A110AULL,
+    0x11F0102000040804ULL, 0x0000000000080100ULL, 0x00000000004A0044ULL, 0x1210004000001004ULL,
+    0x00000000000C0210ULL, 0x122000002400004BULL, 0x1240000040000010ULL, 0x12542A84110AA304ULL,
+    0x12C00880040A2005ULL, 0x12F0000005024001ULL, 0x13000000100CA814ULL, 0x1310000004104011ULL,
+    0x1320010444104111ULL, 0x136008800002B802ULL, 0x1380000404000101ULL, 0x13A000841004A10CULL,
+    0x13D0B2411C7DBA47ULL, 0x1464000001000000ULL, 0x1470800000200004ULL, 0x1480004001141006ULL,
+    0x0000000000001900ULL, 0x1490202001280824ULL, 0x14B0080004024191ULL, 0x14D0000014002045ULL,
+    0x14F0010044024011ULL, 0x1520006000043808ULL, 0x0000000000100100ULL, 0x1540000404104111ULL,
+    0x1560000440104111ULL, 0x1580000004000101ULL, 0x1590402000100824ULL, 0x15B0080444020111ULL,
+    0x15F0400000100000ULL, 0x1600080445024111ULL, 0x164008000802A142ULL, 0x1660000400000110ULL,
+    0x1670004000043000ULL, 0x168010001094080CULL, 0x16A0008004863001ULL, 0x16C0400044124011ULL,
+    0x16F000400000300CULL, 0x0000000000880860ULL, 0x1700400444104111ULL, 0x1740000400000100ULL,
+    0x1750020000008000ULL, 0x17600014805005ACULL, 0x0000000000040040ULL, 0x0000000000100090ULL,
+    0x1790002000023800ULL, 0x17A00800008A2840ULL, 0x17B01000000E601CULL, 0x17C0200000080904ULL,
+    0x17D00800002A0800ULL, 0x17E0002004040803ULL, 0x18002080000E2808ULL, 0x1820080000021800ULL,
+    0x1830000400004101ULL, 0x0000000000000801ULL, 0x0000000000020100ULL, 0x0000000000004001ULL,
+    0x0000000000008804ULL, 0x0000000000200010ULL, 0x0000000000080800ULL, 0x0000000000000110ULL,
+    0x0000000000020010ULL, 0x0000000000400100ULL, 0x0000000001020000ULL, 0x0000000000221000ULL,
+    0x0000000000004100ULL, 0x0000000000002004ULL, 0x0000000000003000ULL, 0x0000000000002100ULL,
+    0x0000000000202004ULL, 0x0000000000480400ULL, 0x0000000000000042ULL, 0x0000000000002008ULL,
+    0x0000000000008010ULL, 0x0000000000080101ULL, 0x000000000020805AULL, 0x0000000000023000ULL,
+    0x0000000000441004ULL, 0x0000000001040000ULL, 0x0000000000003010ULL, 0x00000000000C0044ULL,
+    0x0000000000040002ULL, 0x0000000000040800ULL, 0x0000000000022000ULL, 0x0000000002000028ULL,
+    0x00000000000C1004ULL, 0x0000000000042004ULL, 0x0000000000000900ULL, 0x0000000000000808ULL,
+    0x0000000000120000ULL, 0x0000000000024910ULL, 0x0000000001040000ULL, 0x0000000000000911ULL,
+    0x0000000000080514ULL, 0x0000000000000011ULL, 0x0000000000004100ULL, 0x0000000000089095ULL,
+    0x0000000000004010ULL, 0x0000000000000111ULL, 0x0000000000001040ULL, 0x0000000000040001ULL,
+    0x0000000000002020ULL, 0x0000000000080800ULL, 0x0000000001000010ULL, 0x0000000000209044ULL,
+    0x0000000000080890ULL, 0x0000000000004900ULL, 0x0000000000021000ULL, 0x0000000001000010ULL,
+    0x0000000000040008ULL, 0x0000000000000101ULL, 0x0000000000000101ULL, 0x0000000000000808ULL,
+    0x0000000000001004ULL, 0x0000000000100890ULL, 0x0000000000020004ULL, 0x0000000000020811ULL,
+    0x0000000000020010ULL, 0x0000000000080100ULL, 0x0000000000002800ULL, 0x0000000000004100ULL,
+    0x0000000000080044ULL, 0x0000000000000101ULL, 0x0000000000000049ULL, 0x0000000000001010ULL,
+    0x0000000000000084ULL, 0x0000000000241000ULL, 0x0000000000800001ULL, 0x0000000000020001ULL,
+    0x0000000000481056ULL, 0x0000000000000044ULL, 0x0000000000050000ULL, 0x0000000000000019ULL,
+    0x00000000020C0000ULL, 0x000000000000080AULL, 0x0000000000120110ULL, 0x0000000000042008ULL,
+    0x0000000001242008ULL, 0x0000000000002810ULL, 0x0000000000540004ULL, 0x0000000000080800ULL,
+    0x0000000000000048ULL, 0x0000000000004010ULL, 0x00000000000A0808ULL, 0x0000000000000009ULL,
+    0x0000000001000100ULL, 0x0000000000000101ULL, 0x0000000000000482ULL, 0x0000000000002001ULL,
+    0x0000000000120801ULL, 0x0000000000024800ULL, 0x0000000000100110ULL, 0x0000000000004001ULL,
+    0x0000000000080110ULL, 0x0000000000000110ULL, 0x0000000000004001ULL, 0x0000000000000504ULL,
+    0x0000000000080020ULL, 0x0000000001000810ULL, 0x0000000000220028ULL, 0x0000000000040011ULL,
+    0x0000000000000048ULL, 0x0000000000020010ULL, 0x0000000001000001ULL, 0x0000000000000045ULL,
+    0x0000000000002808ULL, 0x0000000000000110ULL, 0x0000000000140009ULL, 0x0000000000200405ULL,
+    0x0000000000000090ULL, 0x0000000000000101ULL, 0x0000000000004002ULL, 0x0000000000000104ULL,
+    0x0000000000020080ULL, 0x0000000000000108ULL, 0x0000000000000110ULL, 0x0000000000080010ULL,
+    0x0000000000000110ULL, 0x0000000000082000ULL, 0x0000000000042000ULL, 0x0000000000080010ULL,
+    0x0000000000080114ULL, 0x0000000000000012ULL, 0x0000000000002800ULL, 0x0000000000000110ULL,
+    0x0000000000022000ULL, 0x0000000000000510ULL, 0x0000000000002008ULL, 0x0000000000080004ULL,
+    0x0000000000000011ULL, 0x0000000000080404ULL, 0x0000000000020010ULL, 0x0000000000021000ULL,
+    0x0000000000042004ULL, 0x0000000000000005ULL, 0x0000000000001024ULL, 0x0000000000022000ULL,
+    0x0000000000080400ULL, 0x00000000010C2100ULL, 0x0000000001000004ULL, 0x0000000000249049ULL,
+    0x0000000002245010ULL, 0x0000000000241066ULL, 0x0000000001000100ULL, 0x0000000000008004ULL,
+    0x0000000000022000ULL, 0x0000000000000014ULL, 0x0000000000000110ULL, 0x0000000000042800ULL,
+    0x0000000000000408ULL, 0x0000000000000804ULL, 0x0000000000104000ULL, 0x0000000000004011ULL,
+    0x0000000000120000ULL, 0x0000000000004110ULL, 0x0000000000000811ULL, 0x0000000000108114ULL,
+    0x0000000000020001ULL, 0x0000000000000110ULL, 0x0000000000081000ULL, 0x0000000000000011ULL,
+    0x0000000000008001ULL, 0x0000000000084001ULL, 0x0000000000004100ULL, 0x00000000000A2000ULL,
+    0x0000000000004111ULL, 0x0000000000040020ULL, 0x0000000000120000ULL, 0x0000000000029028ULL,
+    0x0000000000020800ULL, 0x0000000000120000ULL, 0x0000000000200010ULL, 0x0000000000008100ULL,
+    0x0000000000208000ULL, 0x0000000000001004ULL, 0x0000000000000801ULL, 0x00000000000A0000ULL,
+    0x0000000000008400ULL, 0x0000000000100008ULL, 0x0000000000020800ULL, 0x0000000000020004ULL,
+    0x0000000000402805ULL, 0x00000000000A2808ULL, 0x0000000000000101ULL, 0x0000000000000011ULL,
+    0x00000000010A2028ULL, 0x0000000000008001ULL, 0x0000000000000804ULL, 0x0000000000000101ULL,
+    0x0000000000001200ULL, 0x0000000000208020ULL, 0x0000000000083000ULL, 0x0000000000008002ULL,
+    0x0000000000080400ULL, 0x0000000000080400ULL, 0x0000000000041004ULL, 0x0000000000040009ULL,
+    0x0000000000082000ULL, 0x0000000000024001ULL, 0x0000000000003000ULL, 0x0000000000000012ULL,
+    0x0000000000242124ULL, 0x0000000000002001ULL, 0x0000000000108005ULL, 0x0000000000040010ULL,
+    0x0000000000002004ULL, 0x0000000000000110ULL, 0x0000000000004001ULL, 0x0000000000204000ULL,
+    0x0000000000002100ULL, 0x0000000000100100ULL, 0x0000000001000108ULL, 0x0000000000100100ULL,
+    0x0000000000000110ULL, 0x0000000000003000ULL, 0x0000000000008800ULL, 0x0000000000000024ULL,
+    0x0000000000000018ULL, 0x0000000000040080ULL, 0x0000000000080400ULL, 0x00000000000C0000ULL};
@@ -0,0 +1,28 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#define SLIP39_WORDLIST_COUNT        1024
+#define SLIP39_WORDLIST_WORD_LETTERS 8
+#define SLIP39_WORDLIST_LETTER_BITS  5
+#define SLIP39_WORDLIST_STRIDE       5
+#define SLIP39_WORDLIST_LENGTH       (SLIP39_WORDLIST_COUNT * SLIP39_WORDLIST_STRIDE)
+#define SLIP39_TRIE_LENGTH           388
+
+extern unsigned char const WIDE SLIP39_WORDLIST[SLIP39_WORDLIST_LENGTH];
+extern unsigned long long const WIDE SLIP39_TRIE[SLIP39_TRIE_LENGTH];
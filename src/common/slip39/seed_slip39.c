@@ -0,0 +1,176 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <string.h>
+#include <os.h>
+#include <cx.h>
+
+#include "../common.h"
+#include "../wordlist.h"
+#include "./common_slip39.h"
+
+// packed word of the wordlist, see seed_rom_variables.c for the layout
+static uint64_t slip39_word_key(unsigned int index) {
+    const unsigned char *entry =
+        (const unsigned char *) PIC(SLIP39_WORDLIST) + SLIP39_WORDLIST_STRIDE * index;
+    uint64_t key = 0;
+    for (unsigned int i = 0; i < SLIP39_WORDLIST_STRIDE; i++) {
+        key = (key << 8) | entry[i];
+    }
+    return key;
+}
+
+// letter at the given position of a packed word, 0 past its end
+static unsigned char slip39_key_letter(uint64_t key, unsigned int position) {
+    const unsigned int code =
+        (key >> (SLIP39_WORDLIST_LETTER_BITS * (SLIP39_WORDLIST_WORD_LETTERS - 1 - position))) &
+        0x1F;
+    return code == 0 ? 0 : 'a' + code - 1;
+}
+
+unsigned int bolos_ux_slip39_idx_strcpy(unsigned int index, unsigned char *buffer) {
+    if (index < SLIP39_WORDLIST_COUNT && buffer) {
+        const uint64_t key = slip39_word_key(index);
+        unsigned int length = 0;
+        while (length < SLIP39_WORDLIST_WORD_LETTERS && slip39_key_letter(key, length) != 0) {
+            buffer[length] = slip39_key_letter(key, length);
+            length++;
+        }
+        buffer[length] = 0;  // EOS
+        return length;
+    }
+    // no word at that index
+    return 0;
+}
+
+static int slip39_compare_prefix(unsigned int index,
+                                 const unsigned char *prefix,
+                                 size_t prefix_length) {
+    const uint64_t key = slip39_word_key(index);
+    for (size_t j = 0; j < prefix_length; j++) {
+        if (j == SLIP39_WORDLIST_WORD_LETTERS) {
+            return -1;
+        }
+        // zero padding sorts before any letter
+        const unsigned char letter = slip39_key_letter(key, j);
+        if (letter != prefix[j]) {
+            return letter < prefix[j] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+void bolos_ux_slip39_get_word_range_starting_with(const unsigned char *prefix,
+                                                  const unsigned int prefixlength,
+                                                  unsigned int *first,
+                                                  unsigned int *last) {
+    *first = 0;
+    *last = SLIP39_WORDLIST_COUNT;
+    wordlist_prefix_range(slip39_compare_prefix, prefix, prefixlength, first, last);
+}
+
+unsigned int bolos_ux_slip39_get_word_idx_starting_with(const unsigned char *prefix,
+                                                        const unsigned int prefixlength) {
+    unsigned int first, last;
+    bolos_ux_slip39_get_word_range_starting_with(prefix, prefixlength, &first, &last);
+    if (first < last) {
+        return first;
+    }
+    // no match, sry
+    return SLIP39_WORDLIST_COUNT;
+}
+
+unsigned int bolos_ux_slip39_get_unique_word_idx_starting_with(const unsigned char *prefix,
+                                                               const unsigned int prefixlength) {
+    uint32_t next_letters;
+
+    if (wordlist_trie_walk(PIC(SLIP39_TRIE), prefix, prefixlength, &next_letters) !=
+        WORDLIST_TRIE_SINGLE_WORD) {
+        return SLIP39_WORDLIST_COUNT;
+    }
+    // at most one word left, which may not match the letters past the last node
+    return bolos_ux_slip39_get_word_idx_starting_with(prefix, prefixlength);
+}
+
+unsigned int bolos_ux_slip39_get_word_count_starting_with(const unsigned char *prefix,
+                                                          const unsigned int prefixlength) {
+    unsigned int first, last;
+    bolos_ux_slip39_get_word_range_starting_with(prefix, prefixlength, &first, &last);
+    // return number of matched word starting with the given prefix
+    return last - first;
+}
+
+// mask of the letters which may follow the prefix ('a' is bit 0)
+static uint32_t slip39_get_word_next_letters_mask(const unsigned char *prefix,
+                                                  const unsigned int prefixlength) {
+    uint32_t next_letters = 0;
+    switch (wordlist_trie_walk(PIC(SLIP39_TRIE), prefix, prefixlength, &next_letters)) {
+        case WORDLIST_TRIE_NODE:
+            return next_letters;
+        case WORDLIST_TRIE_SINGLE_WORD: {
+            // out of the trie, the single matching word gives the next letter
+            const unsigned int i = bolos_ux_slip39_get_word_idx_starting_with(prefix, prefixlength);
+            if (i < SLIP39_WORDLIST_COUNT && prefixlength < SLIP39_WORDLIST_WORD_LETTERS) {
+                const unsigned char letter = slip39_key_letter(slip39_word_key(i), prefixlength);
+                return letter == 0 ? 0 : 1 << (letter - 'a');
+            }
+            return 0;
+        }
+        default:
+            return 0;
+    }
+}
+
+// allocate at most 26 letters for next possibilities
+unsigned int bolos_ux_slip39_get_word_next_letters_starting_with(
+    const unsigned char *prefix,
+    unsigned int prefixlength,
+    unsigned char *next_letters_buffer) {
+    // return number of letters following the given prefix
+    return wordlist_letters_from_mask(slip39_get_word_next_letters_mask(prefix, prefixlength),
+                                      next_letters_buffer);
+}
+
+#if defined(HAVE_NBGL)
+#include <nbgl_layout.h>
+
+size_t bolos_ux_slip39_fill_with_candidates(const unsigned char *startingChars,
+                                            const size_t startingCharsLength,
+                                            char wordCandidatesBuffer[],
+                                            const char *wordIndexorBuffer[]) {
+    unsigned int first, last;
+    bolos_ux_slip39_get_word_range_starting_with(startingChars,
+                                                 startingCharsLength,
+                                                 &first,
+                                                 &last);
+    const size_t nbMatchingWords = MIN(last - first, NB_MAX_SUGGESTION_BUTTONS);
+    PRINTF("'%d' words start with '%s'\n", last - first, startingChars);
+    size_t offset = 0;
+    for (size_t i = 0; i < nbMatchingWords; i++) {
+        unsigned char *const wordDest = (unsigned char *) (&wordCandidatesBuffer[0] + offset);
+        offset += bolos_ux_slip39_idx_strcpy(first + i, wordDest) + 1;  // + trailing '\0' size
+        wordIndexorBuffer[i] = (char *) wordDest;
+    }
+    return nbMatchingWords;
+}
+
+uint32_t bolos_ux_slip39_get_keyboard_mask(const unsigned char *prefix,
+                                           const unsigned int prefixLength) {
+    PRINTF("Looking for letter candidates following '%s'\n", prefix);
+    return wordlist_keyboard_mask(slip39_get_word_next_letters_mask(prefix, prefixLength));
+}
+#endif
@@ -0,0 +1,521 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <string.h>
+#include <os.h>
+#include <cx.h>
+
+#include "../common.h"
+#include "./slip39.h"
+
+// RS1024 generator multiples of the 5 low and of the 5 high bits shifted out of the checksum
+static const uint32_t RS1024_LOW[32] = {
+    0x00000000, 0x00E0E040, 0x01C1C080, 0x012120C0, 0x03838100, 0x03636140, 0x02424180, 0x02A2A1C0,
+    0x07070200, 0x07E7E240, 0x06C6C280, 0x062622C0, 0x04848300, 0x04646340, 0x05454380, 0x05A5A3C0,
+    0x0E0E0009, 0x0EEEE049, 0x0FCFC089, 0x0F2F20C9, 0x0D8D8109, 0x0D6D6149, 0x0C4C4189, 0x0CACA1C9,
+    0x09090209, 0x09E9E249, 0x08C8C289, 0x082822C9, 0x0A8A8309, 0x0A6A6349, 0x0B4B4389, 0x0BABA3C9};
+static const uint32_t RS1024_HIGH[32] = {
+    0x00000000, 0x1C0C2412, 0x38086C24, 0x24044836, 0x3090FC48, 0x2C9CD85A, 0x0898906C, 0x1494B47E,
+    0x21B1F890, 0x3DBDDC82, 0x19B994B4, 0x05B5B0A6, 0x112104D8, 0x0D2D20CA, 0x292968FC, 0x35254CEE,
+    0x03F3F120, 0x1FFFD532, 0x3BFB9D04, 0x27F7B916, 0x33630D68, 0x2F6F297A, 0x0B6B614C, 0x1767455E,
+    0x224209B0, 0x3E4E2DA2, 0x1A4A6594, 0x06464186, 0x12D2F5F8, 0x0EDED1EA, 0x2ADA99DC, 0x36D6BDCE};
+
+// customization string of the checksum, its first 6 letters being the one of non-extendable
+// shares, and the salt prefix of their Feistel rounds
+static const char SLIP39_CUSTOMIZATION[] = "shamir_extendable";
+#define SLIP39_SALT_PREFIX_LENGTH 6
+
+void slip39_rs1024_init(slip39_rs1024_t *checksum, bool extendable) {
+    const size_t length =
+        extendable ? sizeof(SLIP39_CUSTOMIZATION) - 1 : SLIP39_SALT_PREFIX_LENGTH;
+
+    *checksum = 1;
+    for (size_t i = 0; i < length; i++) {
+        slip39_rs1024_update(checksum, SLIP39_CUSTOMIZATION[i]);
+    }
+}
+
+void slip39_rs1024_update(slip39_rs1024_t *checksum, uint16_t word) {
+    const uint32_t top = *checksum >> 20;
+
+    *checksum = ((*checksum & 0xFFFFF) << SLIP39_RADIX_BITS) ^ word ^ RS1024_LOW[top & 0x1F] ^
+                RS1024_HIGH[top >> 5];
+}
+
+bool slip39_rs1024_verify(slip39_rs1024_t checksum) {
+    return checksum == 1;
+}
+
+void slip39_rs1024_final(slip39_rs1024_t checksum, uint16_t words[SLIP39_CHECKSUM_WORDS]) {
+    for (size_t i = 0; i < SLIP39_CHECKSUM_WORDS; i++) {
+        slip39_rs1024_update(&checksum, 0);
+    }
+    checksum ^= 1;
+    for (size_t i = 0; i < SLIP39_CHECKSUM_WORDS; i++) {
+        words[i] = (checksum >> (SLIP39_RADIX_BITS * (SLIP39_CHECKSUM_WORDS - 1 - i))) &
+                   (SLIP39_RADIX - 1);
+    }
+}
+
+// number of zero bits padding the value of the share to whole words
+static unsigned int slip39_padding_bits(size_t value_length) {
+    return (SLIP39_WORDS(value_length) - SLIP39_HEADER_WORDS - SLIP39_CHECKSUM_WORDS) *
+               SLIP39_RADIX_BITS -
+           value_length * 8;
+}
+
+size_t slip39_share_encode(const slip39_share_t *share, uint16_t *words, size_t words_size) {
+    const size_t word_count = SLIP39_WORDS(share->value_length);
+    slip39_rs1024_t checksum;
+    // the padding bits are the first ones of the accumulator
+    unsigned int bits = slip39_padding_bits(share->value_length);
+    uint32_t accumulator = 0;
+    size_t n = SLIP39_HEADER_WORDS;
+
+    if (share->value_length < SSS_MIN_SECRET_SIZE || share->value_length > SSS_MAX_SECRET_SIZE ||
+        word_count > words_size) {
+        return 0;
+    }
+    const uint32_t id_exp = ((uint32_t) (share->identifier & 0x7FFF) << 5) |
+                            (share->extendable << 4) | (share->iteration_exponent & 0x0F);
+    const uint32_t group_member =
+        ((uint32_t) (share->group_index & 0x0F) << 16) |
+        ((uint32_t) ((share->group_threshold - 1) & 0x0F) << 12) |
+        (((share->group_count - 1) & 0x0F) << 8) | ((share->member_index & 0x0F) << 4) |
+        ((share->member_threshold - 1) & 0x0F);
+    words[0] = id_exp >> SLIP39_RADIX_BITS;
+    words[1] = id_exp & (SLIP39_RADIX - 1);
+    words[2] = group_member >> SLIP39_RADIX_BITS;
+    words[3] = group_member & (SLIP39_RADIX - 1);
+
+    for (size_t i = 0; i < share->value_length; i++) {
+        accumulator = (accumulator << 8) | share->value[i];
+        bits += 8;
+        if (bits >= SLIP39_RADIX_BITS) {
+            bits -= SLIP39_RADIX_BITS;
+            words[n++] = (accumulator >> bits) & (SLIP39_RADIX - 1);
+            accumulator &= (1 << bits) - 1;
+        }
+    }
+
+    slip39_rs1024_init(&checksum, share->extendable);
+    for (size_t i = 0; i < n; i++) {
+        slip39_rs1024_update(&checksum, words[i]);
+    }
+    slip39_rs1024_final(checksum, words + n);
+    return word_count;
+}
+
+// value of a complete share, its padding bits being checked already
+static void slip39_value_decode(const uint16_t *words, uint8_t *value, size_t value_length) {
+    const unsigned int padding = slip39_padding_bits(value_length);
+    unsigned int bits = SLIP39_RADIX_BITS - padding;
+    uint32_t accumulator = words[0] & ((1 << bits) - 1);
+    size_t n = 0;
+
+    for (size_t i = 1; n < value_length; i++) {
+        while (bits >= 8) {
+            bits -= 8;
+            value[n++] = accumulator >> bits;
+            accumulator &= (1 << bits) - 1;
+        }
+        if (n < value_length) {
+            accumulator = (accumulator << SLIP39_RADIX_BITS) | words[i];
+            bits += SLIP39_RADIX_BITS;
+        }
+    }
+}
+
+bool slip39_reader_start(slip39_reader_t *reader, size_t final_size) {
+    memzero(reader, sizeof(*reader));
+    if (final_size < SLIP39_MIN_WORDS || final_size > SLIP39_MAX_WORDS) {
+        return false;
+    }
+    // the padding is shorter than a byte: the value length is the whole bytes of the value words
+    const size_t value_length =
+        (final_size - SLIP39_HEADER_WORDS - SLIP39_CHECKSUM_WORDS) * SLIP39_RADIX_BITS / 16 * 2;
+    if (SLIP39_WORDS(value_length) != final_size) {
+        return false;
+    }
+    reader->final_size = final_size;
+    reader->share.value_length = value_length;
+    return true;
+}
+
+// check the share fields completed by the latest word
+static slip39_word_status_t slip39_reader_check(slip39_reader_t *reader,
+                                                const slip39_share_t *shares,
+                                                size_t share_count) {
+    slip39_share_t *share = &reader->share;
+    const uint16_t *words = reader->words;
+
+    switch (reader->word_count) {
+        case 2:
+            share->identifier = (words[0] << 5) | (words[1] >> 5);
+            share->extendable = (words[1] >> 4) & 1;
+            share->iteration_exponent = words[1] & 0x0F;
+            for (size_t i = 0; i < share_count; i++) {
+                if (shares[i].identifier != share->identifier ||
+                    shares[i].extendable != share->extendable ||
+                    shares[i].iteration_exponent != share->iteration_exponent ||
+                    shares[i].value_length != share->value_length) {
+                    return SLIP39_WORD_MISMATCH;
+                }
+            }
+            break;
+        case SLIP39_HEADER_WORDS:
+            share->group_index = words[2] >> 6;
+            share->group_threshold = ((words[2] >> 2) & 0x0F) + 1;
+            share->group_count = (((words[2] & 0x03) << 2) | (words[3] >> 8)) + 1;
+            share->member_index = (words[3] >> 4) & 0x0F;
+            share->member_threshold = (words[3] & 0x0F) + 1;
+            if (share->group_threshold > share->group_count ||
+                share->group_index >= share->group_count ||
+                share->member_threshold > SSS_MAX_SHARE_COUNT) {
+                return SLIP39_WORD_INVALID_HEADER;
+            }
+            for (size_t i = 0; i < share_count; i++) {
+                if (shares[i].group_threshold != share->group_threshold ||
+                    shares[i].group_count != share->group_count ||
+                    (shares[i].group_index == share->group_index &&
+                     (shares[i].member_threshold != share->member_threshold ||
+                      shares[i].member_index == share->member_index))) {
+                    return SLIP39_WORD_MISMATCH;
+                }
+            }
+            break;
+        case SLIP39_HEADER_WORDS + 1:
+            if (words[SLIP39_HEADER_WORDS] >>
+                (SLIP39_RADIX_BITS - slip39_padding_bits(share->value_length))) {
+                return SLIP39_WORD_INVALID_PADDING;
+            }
+            break;
+        default:
+            break;
+    }
+    if (reader->word_count == reader->final_size) {
+        if (!slip39_rs1024_verify(reader->checksum)) {
+            return SLIP39_WORD_INVALID_CHECKSUM;
+        }
+        slip39_value_decode(words + SLIP39_HEADER_WORDS, share->value, share->value_length);
+        return SLIP39_SHARE_COMPLETE;
+    }
+    return SLIP39_WORD_ACCEPTED;
+}
+
+slip39_word_status_t slip39_reader_word_add(slip39_reader_t *reader,
+                                            uint16_t word,
+                                            const slip39_share_t *shares,
+                                            size_t share_count) {
+    const slip39_rs1024_t checksum = reader->checksum;
+
+    if (reader->word_count >= reader->final_size || word >= SLIP39_RADIX) {
+        return SLIP39_WORD_MISMATCH;
+    }
+    reader->words[reader->word_count++] = word;
+    // the customization string depends on the extendable flag, held by the 2nd word
+    if (reader->word_count == 2) {
+        slip39_rs1024_init(&reader->checksum, (word >> 4) & 1);
+        slip39_rs1024_update(&reader->checksum, reader->words[0]);
+    }
+    if (reader->word_count >= 2) {
+        slip39_rs1024_update(&reader->checksum, word);
+    }
+
+    const slip39_word_status_t status = slip39_reader_check(reader, shares, share_count);
+    if (status != SLIP39_WORD_ACCEPTED && status != SLIP39_SHARE_COMPLETE) {
+        reader->words[--reader->word_count] = 0;
+        reader->checksum = checksum;
+    }
+    return status;
+}
+
+bool slip39_reader_word_remove(slip39_reader_t *reader) {
+    if (reader->word_count == 0) {
+        return false;
+    }
+    reader->words[--reader->word_count] = 0;
+    memzero(reader->share.value, sizeof(reader->share.value));
+    // the checksum of the remaining words is computed again
+    reader->checksum = 0;
+    if (reader->word_count >= 2) {
+        slip39_rs1024_init(&reader->checksum, (reader->words[1] >> 4) & 1);
+        for (size_t i = 0; i < reader->word_count; i++) {
+            slip39_rs1024_update(&reader->checksum, reader->words[i]);
+        }
+    }
+    return true;
+}
+
+// count the shares of the group, and the indexes and values of up to its member threshold of them
+static uint8_t slip39_group_members(const slip39_share_t *shares,
+                                    size_t share_count,
+                                    uint8_t group_index,
+                                    uint8_t *threshold,
+                                    uint8_t *x,
+                                    const uint8_t **y) {
+    uint8_t members = 0;
+
+    *threshold = 0;
+    for (size_t i = 0; i < share_count; i++) {
+        if (shares[i].group_index != group_index) {
+            continue;
+        }
+        *threshold = shares[i].member_threshold;
+        if (x != NULL && members < *threshold) {
+            x[members] = shares[i].member_index;
+            y[members] = shares[i].value;
+        }
+        members++;
+    }
+    return members;
+}
+
+bool slip39_shares_complete(const slip39_share_t *shares, size_t share_count) {
+    uint8_t groups = 0;
+    uint8_t threshold;
+
+    if (share_count == 0) {
+        return false;
+    }
+    for (uint8_t group_index = 0; group_index < SLIP39_MAX_GROUP_COUNT; group_index++) {
+        const uint8_t members =
+            slip39_group_members(shares, share_count, group_index, &threshold, NULL, NULL);
+        groups += members > 0 && members >= threshold;
+    }
+    return groups >= shares[0].group_threshold;
+}
+
+size_t slip39_combine(const slip39_share_t *shares, size_t share_count, uint8_t *secret) {
+    uint8_t group_values[SSS_MAX_SHARE_COUNT][SSS_MAX_SECRET_SIZE];
+    uint8_t group_x[SSS_MAX_SHARE_COUNT];
+    const uint8_t *group_y[SSS_MAX_SHARE_COUNT];
+    uint8_t x[SSS_MAX_SHARE_COUNT];
+    const uint8_t *y[SSS_MAX_SHARE_COUNT];
+    uint8_t groups = 0;
+    uint8_t threshold;
+    size_t length = 0;
+
+    if (!slip39_shares_complete(shares, share_count) ||
+        shares[0].group_threshold > SSS_MAX_SHARE_COUNT) {
+        return 0;
+    }
+    const uint8_t value_length = shares[0].value_length;
+    // the first group_threshold groups reaching their member threshold give the secret
+    for (uint8_t group_index = 0;
+         group_index < SLIP39_MAX_GROUP_COUNT && groups < shares[0].group_threshold;
+         group_index++) {
+        const uint8_t members =
+            slip39_group_members(shares, share_count, group_index, &threshold, x, y);
+        if (members == 0 || members < threshold) {
+            continue;
+        }
+        if (sss_recover_secret(threshold, x, y, value_length, group_values[groups]) !=
+            value_length) {
+            goto end;
+        }
+        group_x[groups] = group_index;
+        group_y[groups] = group_values[groups];
+        groups++;
+    }
+    if (sss_recover_secret(groups, group_x, group_y, value_length, secret) == value_length) {
+        length = value_length;
+    }
+
+end:
+    memzero(group_values, sizeof(group_values));
+    return length;
+}
+
+int16_t slip39_split(const uint8_t *secret,
+                     uint8_t secret_length,
+                     uint16_t identifier,
+                     bool extendable,
+                     uint8_t iteration_exponent,
+                     uint8_t group_threshold,
+                     const slip39_group_descriptor_t *groups,
+                     uint8_t group_count,
+                     slip39_share_t *shares,
+                     size_t shares_size,
+                     unsigned char *(*random_generator)(uint8_t *, size_t)) {
+    uint8_t group_values[SSS_MAX_SHARE_COUNT * SSS_MAX_SECRET_SIZE];
+    uint8_t member_values[SSS_MAX_SHARE_COUNT * SSS_MAX_SECRET_SIZE];
+    int16_t result;
+    size_t n = 0;
+
+    result = sss_split_secret(group_threshold,
+                              group_count,
+                              secret,
+                              secret_length,
+                              group_values,
+                              random_generator);
+    for (uint8_t group_index = 0; result >= 0 && group_index < group_count; group_index++) {
+        const slip39_group_descriptor_t *group = &groups[group_index];
+        // a group of several shares recovered by any of them is a mistake
+        if (group->threshold == 1 && group->count > 1) {
+            result = SSS_ERROR_INVALID_THRESHOLD;
+            break;
+        }
+        result = sss_split_secret(group->threshold,
+                                  group->count,
+                                  group_values + group_index * secret_length,
+                                  secret_length,
+                                  member_values,
+                                  random_generator);
+        for (uint8_t member_index = 0; result >= 0 && member_index < group->count;
+             member_index++) {
+            if (n >= shares_size) {
+                result = SSS_ERROR_TOO_MANY_SHARES;
+                break;
+            }
+            slip39_share_t *share = &shares[n++];
+            share->identifier = identifier;
+            share->extendable = extendable;
+            share->iteration_exponent = iteration_exponent;
+            share->group_index = group_index;
+            share->group_threshold = group_threshold;
+            share->group_count = group_count;
+            share->member_index = member_index;
+            share->member_threshold = group->threshold;
+            share->value_length = secret_length;
+            memcpy(share->value, member_values + member_index * secret_length, secret_length);
+        }
+    }
+
+    memzero(group_values, sizeof(group_values));
+    memzero(member_values, sizeof(member_values));
+    if (result < 0) {
+        memzero(shares, shares_size * sizeof(*shares));
+        return result;
+    }
+    return (int16_t) n;
+}
+
+// start the PBKDF2 derivation of the current round: F(i, R) is derived from the round index
+// followed by the passphrase, salted with the salt prefix and R
+static cx_err_t slip39_cipher_round_start(slip39_cipher_t *ctx) {
+    uint8_t salt[SLIP39_SALT_PREFIX_LENGTH + 2 + SSS_MAX_SECRET_SIZE / 2];
+    size_t salt_length = 0;
+
+    // the rounds are run backwards to decrypt
+    ctx->password[0] = ctx->decrypt ? SLIP39_ROUND_COUNT - 1 - ctx->round : ctx->round;
+    if (!ctx->extendable) {
+        memcpy(salt, SLIP39_CUSTOMIZATION, SLIP39_SALT_PREFIX_LENGTH);
+        salt[SLIP39_SALT_PREFIX_LENGTH] = ctx->identifier >> 8;
+        salt[SLIP39_SALT_PREFIX_LENGTH + 1] = ctx->identifier & 0xFF;
+        salt_length = SLIP39_SALT_PREFIX_LENGTH + 2;
+    }
+    memcpy(salt + salt_length, ctx->right, ctx->half_length);
+    salt_length += ctx->half_length;
+
+    const cx_err_t error = pbkdf2_sha256_init(&ctx->pbkdf2,
+                                              ctx->password,
+                                              ctx->password_length,
+                                              salt,
+                                              salt_length,
+                                              ctx->round_iterations);
+    memzero(salt, sizeof(salt));
+    return error;
+}
+
+cx_err_t slip39_cipher_start(slip39_cipher_t *ctx,
+                             bool decrypt,
+                             const uint8_t *secret,
+                             size_t secret_length,
+                             const uint8_t *passphrase,
+                             size_t passphrase_length,
+                             uint16_t identifier,
+                             bool extendable,
+                             uint8_t iteration_exponent) {
+    cx_err_t error = CX_OK;
+
+    memzero(ctx, sizeof(*ctx));
+    if (secret_length < SSS_MIN_SECRET_SIZE || secret_length > SSS_MAX_SECRET_SIZE ||
+        secret_length % 2 != 0 || passphrase_length > SLIP39_PASSPHRASE_MAX_LENGTH ||
+        iteration_exponent > 0x0F) {
+        return CX_INVALID_PARAMETER;
+    }
+    ctx->half_length = secret_length / 2;
+    memcpy(ctx->left, secret, ctx->half_length);
+    memcpy(ctx->right, secret + ctx->half_length, ctx->half_length);
+    memcpy(ctx->password + 1, passphrase, passphrase_length);
+    ctx->password_length = 1 + passphrase_length;
+    ctx->identifier = identifier;
+    ctx->extendable = extendable;
+    ctx->decrypt = decrypt;
+    ctx->round_iterations =
+        (SLIP39_BASE_ITERATION_COUNT << iteration_exponent) / SLIP39_ROUND_COUNT;
+    CX_CHECK(slip39_cipher_round_start(ctx));
+
+end:
+    if (error != CX_OK) {
+        memzero(ctx, sizeof(*ctx));
+    }
+    return error;
+}
+
+uint8_t slip39_cipher_step(slip39_cipher_t *ctx, uint32_t max_rounds) {
+    uint8_t f[PBKDF2_SHA256_LENGTH];
+    cx_err_t error = CX_OK;
+
+    while (ctx->half_length > 0 && ctx->round < SLIP39_ROUND_COUNT) {
+        const uint32_t rounds = MIN(max_rounds, ctx->pbkdf2.rounds_left);
+        CX_CHECK(pbkdf2_sha256_step(&ctx->pbkdf2, rounds));
+        max_rounds -= rounds;
+        if (ctx->pbkdf2.rounds_left > 0) {
+            break;
+        }
+        // (L, R) = (R, L ^ F(i, R))
+        CX_CHECK(pbkdf2_sha256_final(&ctx->pbkdf2, f, ctx->half_length));
+        for (size_t i = 0; i < ctx->half_length; i++) {
+            const uint8_t right = ctx->right[i];
+            ctx->right[i] = ctx->left[i] ^ f[i];
+            ctx->left[i] = right;
+        }
+        if (++ctx->round < SLIP39_ROUND_COUNT) {
+            CX_CHECK(slip39_cipher_round_start(ctx));
+        }
+    }
+
+end:
+    memzero(f, sizeof(f));
+    // a failed step zeroes the context, which is then reported as complete
+    if (error != CX_OK) {
+        memzero(ctx, sizeof(*ctx));
+    }
+    if (ctx->half_length == 0 || ctx->round >= SLIP39_ROUND_COUNT) {
+        return 100;
+    }
+    const uint64_t done = (uint64_t) ctx->round * ctx->round_iterations +
+                          ctx->round_iterations - ctx->pbkdf2.rounds_left;
+    return (uint8_t) (100 * done / ((uint64_t) SLIP39_ROUND_COUNT * ctx->round_iterations));
+}
+
+cx_err_t slip39_cipher_final(slip39_cipher_t *ctx, uint8_t *out, size_t out_length) {
+    cx_err_t error = CX_OK;
+
+    if (ctx->half_length == 0 || ctx->round < SLIP39_ROUND_COUNT ||
+        out_length != 2 * (size_t) ctx->half_length) {
+        error = CX_INVALID_PARAMETER;
+    } else {
+        // R || L
+        memcpy(out, ctx->right, ctx->half_length);
+        memcpy(out + ctx->half_length, ctx->left, ctx->half_length);
+    }
+    memzero(ctx, sizeof(*ctx));
+    return error;
+}
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <cx.h>
+
+#include "sss.h"
+#include "./pbkdf2_sha256.h"
+
+// SLIP-39 shares (Shamir's Secret-Sharing for Mnemonic Codes), on the SSS engine of SSKR: the
+// master secret is encrypted by a 4-round Feistel cipher, and the encrypted master secret split
+// in two levels, the groups then their members, by sss_split_secret (SSS_DIGEST_INDEX and
+// SSS_SECRET_INDEX being the ones of SLIP-39).
+//
+// A share is a list of 10-bit words: identifier (15 bits), extendable flag, iteration exponent
+// (4 bits), group index, group threshold - 1, group count - 1, member index, member threshold - 1
+// (4 bits each), the share value left-padded with zero bits to a multiple of 10 bits, and a
+// 3-word RS1024 checksum.
+#define SLIP39_RADIX_BITS     10
+#define SLIP39_RADIX          (1 << SLIP39_RADIX_BITS)
+#define SLIP39_CHECKSUM_WORDS 3
+// identifier, flag and exponent in the first 2 words, group and member fields in the next 2
+#define SLIP39_HEADER_WORDS   4
+#define SLIP39_WORDS(secret_length) \
+    (SLIP39_HEADER_WORDS + ((secret_length) * 8 + SLIP39_RADIX_BITS - 1) / SLIP39_RADIX_BITS + \
+     SLIP39_CHECKSUM_WORDS)
+#define SLIP39_MIN_WORDS SLIP39_WORDS(SSS_MIN_SECRET_SIZE)  // 20 words for 128 bits
+#define SLIP39_MAX_WORDS SLIP39_WORDS(SSS_MAX_SECRET_SIZE)  // 33 words for 256 bits
+
+#define SLIP39_MAX_GROUP_COUNT 16
+// iterations of PBKDF2 for an exponent of 0, spread over the rounds
+#define SLIP39_BASE_ITERATION_COUNT 10000
+#define SLIP39_ROUND_COUNT          4
+#define SLIP39_PASSPHRASE_MAX_LENGTH 64
+
+// RS1024 checksum over GF(1024), computed a word at a time: each word costs a shift and the
+// lookup of the generator multiples of the 10 bits shifted out, in two tables of 32 entries
+typedef uint32_t slip39_rs1024_t;
+
+// absorb the customization string ("shamir", or "shamir_extendable" for extendable shares)
+void slip39_rs1024_init(slip39_rs1024_t *checksum, bool extendable);
+void slip39_rs1024_update(slip39_rs1024_t *checksum, uint16_t word);
+// whether the words absorbed so far end with a valid checksum
+bool slip39_rs1024_verify(slip39_rs1024_t checksum);
+// the checksum words to append to the words absorbed so far
+void slip39_rs1024_final(slip39_rs1024_t checksum, uint16_t words[SLIP39_CHECKSUM_WORDS]);
+
+typedef struct {
+    uint16_t identifier;
+    bool extendable;
+    uint8_t iteration_exponent;
+    uint8_t group_index;
+    uint8_t group_threshold;
+    uint8_t group_count;
+    uint8_t member_index;
+    uint8_t member_threshold;
+    uint8_t value[SSS_MAX_SECRET_SIZE];
+    uint8_t value_length;
+} slip39_share_t;
+
+// encode the share with its checksum, return its word count or 0 if it does not fit
+size_t slip39_share_encode(const slip39_share_t *share, uint16_t *words, size_t words_size);
+
+// Shares are read a word at a time, so that a mistyped word is reported as soon as it is known:
+// - its 2nd word completes the identifier, which has to be the one of the previous shares,
+// - its 4th word completes the group and member fields, which have to be consistent with them,
+// - its 5th word holds the padding bits, which have to be zero,
+// - its final word completes the checksum, updated with each word.
+typedef enum {
+    SLIP39_WORD_ACCEPTED,
+    SLIP39_SHARE_COMPLETE,
+    SLIP39_WORD_INVALID_HEADER,    // the thresholds exceed the counts
+    SLIP39_WORD_MISMATCH,          // the share does not belong with the previous ones
+    SLIP39_WORD_INVALID_PADDING,   // the padding bits are not zero
+    SLIP39_WORD_INVALID_CHECKSUM,  // a word of the share is wrong
+} slip39_word_status_t;
+
+typedef struct {
+    uint16_t words[SLIP39_MAX_WORDS];
+    uint8_t word_count;
+    uint8_t final_size;
+    // over the customization string and the words, once the extendable flag is known
+    slip39_rs1024_t checksum;
+    slip39_share_t share;
+} slip39_reader_t;
+
+// start reading a share of final_size words, return false if no secret has that many words
+bool slip39_reader_start(slip39_reader_t *reader, size_t final_size);
+// add a word (index in the wordlist) to the share, checked against the shares already read: the
+// word is only kept if accepted, the share being output in reader->share once complete
+slip39_word_status_t slip39_reader_word_add(slip39_reader_t *reader,
+                                            uint16_t word,
+                                            const slip39_share_t *shares,
+                                            size_t share_count);
+// remove the latest word, return false if there is none
+bool slip39_reader_word_remove(slip39_reader_t *reader);
+
+// whether the shares, read by slip39_reader_word_add, reach the group threshold
+bool slip39_shares_complete(const slip39_share_t *shares, size_t share_count);
+
+// recover the encrypted master secret from shares reaching the group threshold, return its
+// length or 0 if the shares are inconsistent (a digest not matching)
+size_t slip39_combine(const slip39_share_t *shares, size_t share_count, uint8_t *secret);
+
+typedef struct {
+    uint8_t threshold;
+    uint8_t count;
+} slip39_group_descriptor_t;
+
+// split the encrypted master secret in groups of shares, output by group then member, return the
+// share count or a negative SSS error
+int16_t slip39_split(const uint8_t *secret,
+                     uint8_t secret_length,
+                     uint16_t identifier,
+                     bool extendable,
+                     uint8_t iteration_exponent,
+                     uint8_t group_threshold,
+                     const slip39_group_descriptor_t *groups,
+                     uint8_t group_count,
+                     slip39_share_t *shares,
+                     size_t shares_size,
+                     unsigned char *(*random_generator)(uint8_t *, size_t));
+
+// Feistel cipher of the master secret: each round runs (SLIP39_BASE_ITERATION_COUNT << exponent)
+// / SLIP39_ROUND_COUNT iterations of PBKDF2-HMAC-SHA256, which may be run a few at a time from
+// the ticker as for the BIP39 seed derivation.
+typedef struct {
+    pbkdf2_sha256_t pbkdf2;
+    uint8_t left[SSS_MAX_SECRET_SIZE / 2];
+    uint8_t right[SSS_MAX_SECRET_SIZE / 2];
+    uint8_t half_length;
+    // round index followed by the passphrase
+    uint8_t password[1 + SLIP39_PASSPHRASE_MAX_LENGTH];
+    uint8_t password_length;
+    uint16_t identifier;
+    bool extendable;
+    bool decrypt;
+    // rounds completed, out of SLIP39_ROUND_COUNT
+    uint8_t round;
+    uint32_t round_iterations;
+} slip39_cipher_t;
+
+// encrypt (or decrypt) the secret with the passphrase and the parameters of its shares
+cx_err_t slip39_cipher_start(slip39_cipher_t *ctx,
+                             bool decrypt,
+                             const uint8_t *secret,
+                             size_t secret_length,
+                             const uint8_t *passphrase,
+                             size_t passphrase_length,
+                             uint16_t identifier,
+                             bool extendable,
+                             uint8_t iteration_exponent);
+// run at most max_rounds PBKDF2 rounds, return the progress (%), 100 once the cipher is complete
+// or failed
+uint8_t slip39_cipher_step(slip39_cipher_t *ctx, uint32_t max_rounds);
+// output the result once complete, and zero the context
+cx_err_t slip39_cipher_final(slip39_cipher_t *ctx, uint8_t *out, size_t out_length);
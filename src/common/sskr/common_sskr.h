@@ -31,6 +31,20 @@ void bolos_ux_sskr_to_seed_convert(const unsigned char *sskr_shares_hex,
                                    unsigned int *words_buffer_length,
                                    unsigned char *seed);
 
+// Combine hex value SSKR shares into a BIP39 entropy buffer, return its number of words or 0
+unsigned int bolos_ux_sskr_to_bip39_entropy_convert(const unsigned char *sskr_shares_hex,
+                                                    unsigned int sskr_shares_hex_length,
+                                                    unsigned int sskr_shares_count,
+                                                    unsigned char *bip39_entropy);
+
+// convert seed from BIP39 entropy buffer to SSKR
+unsigned int bolos_ux_bip39_entropy_to_sskr_convert(const unsigned char *bip39_entropy,
+                                                    unsigned int bip39_onboarding_kind,
+                                                    unsigned int *sskr_group_descriptor,
+                                                    uint8_t *sskr_share_count,
+                                                    unsigned char *sskr_words_buffer,
+                                                    unsigned int *sskr_words_buffer_length);
+
 // convert seed from BIP39 to SSKR
 unsigned int bolos_ux_bip39_to_sskr_convert(unsigned char *bip39_words_buffer,
                                             unsigned int bip39_words_buffer_length,
@@ -44,6 +58,11 @@ unsigned int bolos_ux_sskr_hex_check(const unsigned char *sskr_shares_hex,
                                      unsigned int sskr_shares_hex_length,
                                      unsigned int sskr_share_count);
 
+// set [first, last) to the range of the words starting with the prefix, empty if none
+void bolos_ux_sskr_get_word_range_starting_with(const unsigned char *prefix,
+                                                const unsigned int prefixlength,
+                                                unsigned int *first,
+                                                unsigned int *last);
 unsigned int bolos_ux_sskr_get_word_idx_starting_with(const unsigned char *prefix,
                                                       const unsigned int prefixlength);
 unsigned int bolos_ux_sskr_idx_strcpy(const unsigned int index, unsigned char *buffer);
@@ -70,3 +70,31 @@ unsigned char const SSKR_WORDLIST[] = {
     'h', 'i', 'z', 'w', 'o', 'l', 'f', 'w', 'o', 'r', 'k', 'y', 'a', 'n', 'k', 'y', 'a', 'w', 'n',
     'y', 'e', 'l', 'l', 'y', 'o', 'g', 'a', 'y', 'u', 'r', 't', 'z', 'a', 'p', 's', 'z', 'e', 'r',
     'o', 'z', 'e', 's', 't', 'z', 'i', 'n', 'c', 'z', 'o', 'n', 'e', 'z', 'o', 'o', 'm'};
+
+// Generated by tools/wordlists/gen_wordlists.py: prefix trie, see wordlist.h for the layout
+unsigned long long const SSKR_TRIE[] = {
+    0x001DFFFFFF7FFFFFULL, 0x0000000000DB8806ULL, 0x01A0480044124911ULL, 0x01E0410005124981ULL,
+    0x0210490404124111ULL, 0x0262000005A0800DULL, 0x0280482404124911ULL, 0x02D0480445124911ULL,
+    0x0320010444104111ULL, 0x03600880200A200CULL, 0x0390410004104001ULL, 0x03C0000440002110ULL,
+    0x03E0410444104111ULL, 0x0430000444004111ULL, 0x0460010044104011ULL, 0x049000000860B002ULL,
+    0x04A0412004104811ULL, 0x04E0400000100000ULL, 0x04F0410044104111ULL, 0x0530010004584D15ULL,
+    0x0550010404524111ULL, 0x0580008000062040ULL, 0x0590010440004111ULL, 0x05C0010204004091ULL,
+    0x05F0000004104011ULL, 0x0600010040004111ULL, 0x0000000000020804ULL, 0x0000000000080800ULL,
+    0x0000000000000011ULL, 0x0000000002000800ULL, 0x00000000000C0800ULL, 0x0000000000044808ULL,
+    0x0000000000060000ULL, 0x00000000010A0000ULL, 0x0000000000000014ULL, 0x0000000000404000ULL,
+    0x0000000000104001ULL, 0x0000000000080800ULL, 0x0000000000040004ULL, 0x0000000000000101ULL,
+    0x0000000000000104ULL, 0x0000000002040840ULL, 0x0000000000100011ULL, 0x0000000000004010ULL,
+    0x0000000000002010ULL, 0x0000000000001800ULL, 0x0000000000001001ULL, 0x0000000000020020ULL,
+    0x0000000000000101ULL, 0x0000000000060000ULL, 0x0000000000422800ULL, 0x0000000000000801ULL,
+    0x0000000000000840ULL, 0x0000000000028800ULL, 0x0000000000000810ULL, 0x0000000000080404ULL,
+    0x0000000000004100ULL, 0x0000000002000008ULL, 0x0000000000400900ULL, 0x0000000000023048ULL,
+    0x000000000100A010ULL, 0x0000000000482804ULL, 0x0000000002201000ULL, 0x0000000000000041ULL,
+    0x0000000000045001ULL, 0x0000000000300040ULL, 0x0000000000002005ULL, 0x0000000002082100ULL,
+    0x0000000000007000ULL, 0x0000000000042800ULL, 0x0000000000200100ULL, 0x0000000000C00010ULL,
+    0x0000000000084000ULL, 0x0000000000004010ULL, 0x0000000000020100ULL, 0x0000000000100001ULL,
+    0x0000000000044010ULL, 0x0000000000021020ULL, 0x0000000000000101ULL, 0x0000000000001004ULL,
+    0x0000000000000009ULL, 0x0000000000004005ULL, 0x0000000000042102ULL, 0x0000000000000060ULL,
+    0x0000000000002801ULL, 0x0000000000840004ULL, 0x0000000000003010ULL, 0x0000000001001100ULL,
+    0x0000000000000108ULL, 0x00000000000A0000ULL, 0x0000000000040013ULL, 0x0000000000400100ULL,
+    0x0000000000A62800ULL, 0x0000000000000111ULL, 0x0000000000020800ULL, 0x0000000000402000ULL,
+    0x0000000000060000ULL, 0x0000000000006000ULL};
@@ -18,8 +18,10 @@
 #pragma once
 
 #define SSKR_WORDLIST_LENGTH 1024
+#define SSKR_TRIE_LENGTH     98
 
 // All ByteWords have uniform length of 4
 #define SSKR_BYTEWORD_LENGTH 4
 
 extern unsigned char const WIDE SSKR_WORDLIST[SSKR_WORDLIST_LENGTH];
+extern unsigned long long const WIDE SSKR_TRIE[SSKR_TRIE_LENGTH];
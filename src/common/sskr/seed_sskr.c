@@ -20,6 +20,7 @@
 #include <cx.h>
 
 #include "../common.h"
+#include "../wordlist.h"
 #include "./seed_rom_variables.h"
 #include "../bip39/common_bip39.h"
 #include "./sskr.h"
@@ -80,6 +81,24 @@ unsigned int bolos_ux_sskr_combine(unsigned char *sskr_shares_hex,
     return (unsigned int) output_len;
 }
 
+unsigned int bolos_ux_sskr_to_bip39_entropy_convert(unsigned char *sskr_shares_hex,
+                                                    unsigned int sskr_shares_hex_length,
+                                                    unsigned int sskr_shares_count,
+                                                    unsigned char *bip39_entropy) {
+    // the secret is the BIP39 entropy, its checksum bits follow
+    unsigned int seed_len = bolos_ux_sskr_combine(sskr_shares_hex,
+                                                  sskr_shares_hex_length,
+                                                  sskr_shares_count,
+                                                  bip39_entropy);
+    if (seed_len % 4 || seed_len < 16 || seed_len > 32) {
+        memzero(bip39_entropy, BIP39_ENTROPY_MAX_LENGTH);
+        return 0;
+    }
+    bip39_entropy[seed_len] = 0;
+    bolos_ux_bip39_entropy_checksum_set(bip39_entropy, seed_len * 3 / 4);
+    return seed_len * 3 / 4;
+}
+
 void bolos_ux_sskr_to_seed_convert(unsigned char *sskr_shares_hex,
                                    unsigned int sskr_shares_hex_length,
                                    unsigned int sskr_shares_count,
@@ -186,22 +205,18 @@ unsigned int bolos_ux_sskr_byteword_to_hex(unsigned char *byteword) {
     return SSKR_WORDLIST_LENGTH / SSKR_BYTEWORD_LENGTH;
 }
 
-unsigned int bolos_ux_bip39_to_sskr_convert(unsigned char *bip39_words_buffer,
-                                            unsigned int bip39_words_buffer_length,
-                                            unsigned int bip39_onboarding_kind,
-                                            unsigned int *group_descriptor,
-                                            uint8_t *share_count,
-                                            unsigned char *share_words_buffer,
-                                            unsigned int *share_words_buffer_length) {
-    // get seed from bip39 mnemonic
+unsigned int bolos_ux_bip39_entropy_to_sskr_convert(const unsigned char *bip39_entropy,
+                                                    unsigned int bip39_onboarding_kind,
+                                                    unsigned int *group_descriptor,
+                                                    uint8_t *share_count,
+                                                    unsigned char *share_words_buffer,
+                                                    unsigned int *share_words_buffer_length) {
+    // the checksum bits following the entropy are not part of the secret
     uint8_t seed_len = bip39_onboarding_kind * 4 / 3;
-    uint8_t seed_buffer[SSKR_MAX_STRENGTH_BYTES + 1];
+    uint8_t seed_buffer[SSKR_MAX_STRENGTH_BYTES];
 
-    if (bolos_ux_bip39_mnemonic_decode(bip39_words_buffer,
-                                       bip39_words_buffer_length,
-                                       seed_buffer,
-                                       seed_len + 1) == 1) {
-        memzero(bip39_words_buffer, sizeof(bip39_words_buffer));
+    if (seed_len <= sizeof(seed_buffer)) {
+        memcpy(seed_buffer, bip39_entropy, seed_len);
         uint8_t groups_len = 1;
         uint8_t groups_threshold = 1;
         uint8_t share_len_expected = 0;
@@ -269,7 +284,6 @@ unsigned int bolos_ux_bip39_to_sskr_convert(unsigned char *bip39_words_buffer,
                     memzero(cbor_share_crc_buffer, sizeof(cbor_share_crc_buffer));
                     memzero(share_words_buffer, sizeof(share_words_buffer));
                     share_words_buffer_length = 0;
-                    memzero(bip39_words_buffer, sizeof(bip39_words_buffer));
                     return 0;
                 }
                 memzero(cbor_share_crc_buffer, sizeof(cbor_share_crc_buffer));
@@ -278,11 +292,38 @@ unsigned int bolos_ux_bip39_to_sskr_convert(unsigned char *bip39_words_buffer,
             memzero(share_hex_buffer, sizeof(share_hex_buffer));
         }
     }
-    memzero(bip39_words_buffer, bip39_words_buffer_length);
 
     return 1;
 }
 
+unsigned int bolos_ux_bip39_to_sskr_convert(unsigned char *bip39_words_buffer,
+                                            unsigned int bip39_words_buffer_length,
+                                            unsigned int bip39_onboarding_kind,
+                                            unsigned int *group_descriptor,
+                                            uint8_t *share_count,
+                                            unsigned char *share_words_buffer,
+                                            unsigned int *share_words_buffer_length) {
+    // get entropy from bip39 mnemonic
+    uint8_t entropy[BIP39_ENTROPY_MAX_LENGTH];
+    unsigned int ret = 1;
+
+    if (bolos_ux_bip39_mnemonic_decode(bip39_words_buffer,
+                                       bip39_words_buffer_length,
+                                       entropy,
+                                       sizeof(entropy)) == 1) {
+        ret = bolos_ux_bip39_entropy_to_sskr_convert(entropy,
+                                                     bip39_onboarding_kind,
+                                                     group_descriptor,
+                                                     share_count,
+                                                     share_words_buffer,
+                                                     share_words_buffer_length);
+        memzero(entropy, sizeof(entropy));
+    }
+    memzero(bip39_words_buffer, bip39_words_buffer_length);
+
+    return ret;
+}
+
 unsigned int bolos_ux_sskr_hex_check(unsigned char *sskr_shares_hex,
                                      unsigned int sskr_shares_hex_length,
                                      unsigned int sskr_shares_count) {
@@ -329,82 +370,77 @@ unsigned int bolos_ux_sskr_idx_strcpy(unsigned int index, unsigned char *buffer)
     return 0;
 }
 
-unsigned int bolos_ux_sskr_get_word_idx_starting_with(const unsigned char *prefix,
-                                                      const unsigned int prefixlength) {
-    unsigned int i;
-    for (i = 0; i < SSKR_WORDLIST_LENGTH / SSKR_BYTEWORD_LENGTH; i++) {
-        unsigned int j = 0;
-        while (j < (unsigned int) (SSKR_BYTEWORD_LENGTH) && j < prefixlength &&
-               SSKR_WORDLIST[SSKR_BYTEWORD_LENGTH * i + j] == prefix[j]) {
-            j++;
+static int sskr_compare_prefix(unsigned int index,
+                               const unsigned char *prefix,
+                               size_t prefix_length) {
+    const unsigned char *word = SSKR_WORDLIST + SSKR_BYTEWORD_LENGTH * index;
+    for (size_t j = 0; j < prefix_length; j++) {
+        if (j == SSKR_BYTEWORD_LENGTH) {
+            return -1;
         }
-        if (j == prefixlength) {
-            return i;
+        if (word[j] != prefix[j]) {
+            return word[j] < prefix[j] ? -1 : 1;
         }
     }
+    return 0;
+}
+
+void bolos_ux_sskr_get_word_range_starting_with(const unsigned char *prefix,
+                                                const unsigned int prefixlength,
+                                                unsigned int *first,
+                                                unsigned int *last) {
+    *first = 0;
+    *last = SSKR_WORDLIST_LENGTH / SSKR_BYTEWORD_LENGTH;
+    wordlist_prefix_range(sskr_compare_prefix, prefix, prefixlength, first, last);
+}
+
+unsigned int bolos_ux_sskr_get_word_idx_starting_with(const unsigned char *prefix,
+                                                      const unsigned int prefixlength) {
+    unsigned int first, last;
+    bolos_ux_sskr_get_word_range_starting_with(prefix, prefixlength, &first, &last);
+    if (first < last) {
+        return first;
+    }
     // no match, sry
     return SSKR_WORDLIST_LENGTH / SSKR_BYTEWORD_LENGTH;
 }
 
 unsigned int bolos_ux_sskr_get_word_count_starting_with(const unsigned char *prefix,
                                                         const unsigned int prefixlength) {
-    unsigned int i;
-    unsigned int count = 0;
-    for (i = 0; i < SSKR_WORDLIST_LENGTH / SSKR_BYTEWORD_LENGTH; i++) {
-        unsigned int j = 0;
-        while (j < (unsigned int) (SSKR_BYTEWORD_LENGTH) && j < prefixlength &&
-               SSKR_WORDLIST[SSKR_BYTEWORD_LENGTH * i + j] == prefix[j]) {
-            j++;
-        }
-        if (j == prefixlength) {
-            count++;
-        }
-        // don't seek till the end, abort when the prefix is not matched anymore
-        else if (count > 0) {
-            break;
+    unsigned int first, last;
+    bolos_ux_sskr_get_word_range_starting_with(prefix, prefixlength, &first, &last);
+    // return number of matched word starting with the given prefix
+    return last - first;
+}
+
+// mask of the letters which may follow the prefix ('a' is bit 0)
+static uint32_t sskr_get_word_next_letters_mask(const unsigned char *prefix,
+                                                const unsigned int prefixlength) {
+    uint32_t next_letters = 0;
+    switch (wordlist_trie_walk(SSKR_TRIE, prefix, prefixlength, &next_letters)) {
+        case WORDLIST_TRIE_NODE:
+            return next_letters;
+        case WORDLIST_TRIE_SINGLE_WORD: {
+            // out of the trie, the single matching word gives the next letter
+            const unsigned int i = bolos_ux_sskr_get_word_idx_starting_with(prefix, prefixlength);
+            if (i < SSKR_WORDLIST_LENGTH / SSKR_BYTEWORD_LENGTH &&
+                prefixlength < SSKR_BYTEWORD_LENGTH) {
+                return 1 << (SSKR_WORDLIST[SSKR_BYTEWORD_LENGTH * i + prefixlength] - 'a');
+            }
+            return 0;
         }
+        default:
+            return 0;
     }
-    // return number of matched word starting with the given prefix
-    return count;
 }
 
 // allocate at most 26 letters for next possibilities
-// algorithm considers the SSKR words are alphabetically ordered in the wordlist
 unsigned int bolos_ux_sskr_get_word_next_letters_starting_with(const unsigned char *prefix,
                                                                unsigned int prefixlength,
                                                                unsigned char *next_letters_buffer) {
-    unsigned int i;
-    unsigned int letter_count = 0;
-    for (i = 0; i < SSKR_WORDLIST_LENGTH / SSKR_BYTEWORD_LENGTH; i++) {
-        unsigned int j = 0;
-        while (j < (unsigned int) (SSKR_BYTEWORD_LENGTH) && j < prefixlength &&
-               SSKR_WORDLIST[SSKR_BYTEWORD_LENGTH * i + j] == prefix[j]) {
-            j++;
-        }
-        if (j == prefixlength) {
-            if (j < (unsigned int) (SSKR_BYTEWORD_LENGTH)) {
-                // j is inc during previous loop, don't touch it
-                unsigned char next_letter = SSKR_WORDLIST[SSKR_BYTEWORD_LENGTH * i + j];
-                // add the first next_letter inconditionnally
-                if (letter_count == 0) {
-                    next_letters_buffer[0] = next_letter;
-                    letter_count = 1;
-                }
-                // the next_letter is different
-                else if (next_letters_buffer[0] != next_letter) {
-                    next_letters_buffer++;
-                    next_letters_buffer[0] = next_letter;
-                    letter_count++;
-                }
-            }
-        }
-        // don't seek till the end, abort when the prefix is not matched anymore
-        else if (letter_count > 0) {
-            break;
-        }
-    }
-    // return number of matched word starting with the given prefix
-    return letter_count;
+    // return number of letters following the given prefix
+    return wordlist_letters_from_mask(sskr_get_word_next_letters_mask(prefix, prefixlength),
+                                      next_letters_buffer);
 }
 
 #if defined(HAVE_NBGL)
@@ -414,25 +450,15 @@ size_t bolos_ux_sskr_fill_with_candidates(const unsigned char *startingChars,
                                           const size_t startingCharsLength,
                                           char wordCandidatesBuffer[],
                                           const char *wordIndexorBuffer[]) {
-    PRINTF("Calculating nb of words starting with '%s' (size is '%d')\n",
-           startingChars,
-           startingCharsLength);
-    const size_t nbMatchingWords =
-        MIN(bolos_ux_sskr_get_word_count_starting_with(startingChars, startingCharsLength),
-            NB_MAX_SUGGESTION_BUTTONS);
-    PRINTF("'%d' words start with '%s'\n", nbMatchingWords, startingChars);
-    if (nbMatchingWords == 0) {
-        return 0;
-    }
-    size_t matchingWordIndex =
-        bolos_ux_sskr_get_word_idx_starting_with(startingChars, startingCharsLength);
+    unsigned int first, last;
+    bolos_ux_sskr_get_word_range_starting_with(startingChars, startingCharsLength, &first, &last);
+    const size_t nbMatchingWords = MIN(last - first, NB_MAX_SUGGESTION_BUTTONS);
+    PRINTF("'%d' words start with '%s'\n", last - first, startingChars);
+    // flash words are not NUL-terminated, copy them next to each other in the candidates buffer
     size_t offset = 0;
     for (size_t i = 0; i < nbMatchingWords; i++) {
         unsigned char *const wordDest = (unsigned char *) (&wordCandidatesBuffer[0] + offset);
-        const size_t wordSize = bolos_ux_sskr_idx_strcpy(matchingWordIndex, wordDest);
-        matchingWordIndex++;
-        *(wordDest + wordSize) = '\0';
-        offset += wordSize + 1;  // + trailing '\0' size
+        offset += bolos_ux_sskr_idx_strcpy(first + i, wordDest) + 1;  // + trailing '\0' size
         wordIndexorBuffer[i] = (char *) wordDest;
     }
     return nbMatchingWords;
@@ -440,20 +466,7 @@ size_t bolos_ux_sskr_fill_with_candidates(const unsigned char *startingChars,
 
 uint32_t bolos_ux_sskr_get_keyboard_mask(const unsigned char *prefix,
                                          const unsigned int prefixLength) {
-    uint32_t existing_mask = 1 << 28;  // Starting with the 'return' keypad activated
-    unsigned char next_letters[ALPHABET_LENGTH] = {0};
     PRINTF("Looking for letter candidates following '%s'\n", prefix);
-    const size_t nb_letters =
-        bolos_ux_sskr_get_word_next_letters_starting_with(prefix, prefixLength, next_letters);
-    next_letters[nb_letters] = '\0';
-    PRINTF("Next letters are in: %s\n", next_letters);
-    for (int i = 0; i < ALPHABET_LENGTH; i++) {
-        for (size_t j = 0; j < nb_letters; j++) {
-            if (KBD_LETTERS[i] == next_letters[j]) {
-                existing_mask += 1 << i;
-            }
-        }
-    }
-    return (-1 ^ existing_mask);
+    return wordlist_keyboard_mask(sskr_get_word_next_letters_mask(prefix, prefixLength));
 }
 #endif
@@ -0,0 +1,360 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <string.h>
+#include <os.h>
+#include <cx.h>
+
+#include "../common.h"
+#include "../sskr/seed_rom_variables.h"
+#include "./ur.h"
+
+#define UR_SCHEME      "UR:"
+#define UR_CRC_LENGTH  4
+#define UR_PART_FIELDS 5
+#define UR_SEED_LENGTH 8
+
+// CBOR major types, and the additional information of their 1, 2 and 4-byte arguments
+#define CBOR_UNSIGNED 0x00
+#define CBOR_BYTES    0x40
+#define CBOR_ARRAY    0x80
+#define CBOR_UINT8    24
+#define CBOR_UINT16   25
+#define CBOR_UINT32   26
+
+// shortest header of a CBOR item, its argument following the major type
+static size_t cbor_header_length(uint32_t value) {
+    return value < CBOR_UINT8 ? 1 : value <= 0xff ? 2 : value <= 0xffff ? 3 : 5;
+}
+
+static size_t cbor_header_write(uint8_t *buffer, uint8_t major_type, uint32_t value) {
+    const size_t length = cbor_header_length(value);
+
+    if (length == 1) {
+        buffer[0] = major_type | value;
+        return length;
+    }
+    buffer[0] = major_type | (length == 2 ? CBOR_UINT8 : length == 3 ? CBOR_UINT16 : CBOR_UINT32);
+    for (size_t i = 1; i < length; i++) {
+        buffer[i] = value >> (8 * (length - 1 - i));
+    }
+    return length;
+}
+
+static size_t decimal_length(uint32_t value) {
+    size_t length = 1;
+
+    for (; value >= 10; value /= 10) {
+        length++;
+    }
+    return length;
+}
+
+static uint64_t rotl(const uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+void ur_xoshiro256_init(ur_xoshiro256_t *rng, const uint8_t *seed, size_t seed_length) {
+    uint8_t digest[CX_SHA256_SIZE];
+
+    cx_hash_sha256(seed, seed_length, digest, sizeof(digest));
+    // the words of the state are read in network byte order
+    for (size_t i = 0; i < ARRAYLEN(rng->state); i++) {
+        rng->state[i] = 0;
+        for (size_t j = 0; j < sizeof(rng->state[i]); j++) {
+            rng->state[i] = rng->state[i] << 8 | digest[i * sizeof(rng->state[i]) + j];
+        }
+    }
+    memzero(digest, sizeof(digest));
+}
+
+uint64_t ur_xoshiro256_next(ur_xoshiro256_t *rng) {
+    uint64_t *s = rng->state;
+    const uint64_t result = rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+// the reference implementation draws doubles, which are reproduced to pick the same fragments
+static double ur_xoshiro256_next_double(ur_xoshiro256_t *rng) {
+    return (double) ur_xoshiro256_next(rng) / 18446744073709551616.0;
+}
+
+static size_t ur_xoshiro256_next_index(ur_xoshiro256_t *rng, size_t n) {
+    return (size_t) (ur_xoshiro256_next_double(rng) * (double) n);
+}
+
+// number of fragments mixed, d being chosen with a probability proportional to 1/d by the alias
+// method of Vose, computed as the reference implementation
+static uint16_t ur_degree_choose(ur_xoshiro256_t *rng, uint16_t count) {
+    double probabilities[UR_FOUNTAIN_MAX_COUNT];
+    uint8_t aliases[UR_FOUNTAIN_MAX_COUNT] = {0};
+    uint8_t small[UR_FOUNTAIN_MAX_COUNT];
+    uint8_t large[UR_FOUNTAIN_MAX_COUNT];
+    size_t small_count = 0;
+    size_t large_count = 0;
+    double sum = 0;
+
+    for (size_t d = 1; d <= count; d++) {
+        sum += 1.0 / d;
+    }
+    for (size_t i = count; i > 0; i--) {
+        probabilities[i - 1] = 1.0 / i * count / sum;
+        if (probabilities[i - 1] < 1) {
+            small[small_count++] = i - 1;
+        } else {
+            large[large_count++] = i - 1;
+        }
+    }
+    while (small_count > 0 && large_count > 0) {
+        const uint8_t a = small[--small_count];
+        const uint8_t g = large[--large_count];
+
+        aliases[a] = g;
+        probabilities[g] += probabilities[a] - 1;
+        if (probabilities[g] < 1) {
+            small[small_count++] = g;
+        } else {
+            large[large_count++] = g;
+        }
+    }
+    while (large_count > 0) {
+        probabilities[large[--large_count]] = 1;
+    }
+    while (small_count > 0) {
+        probabilities[small[--small_count]] = 1;
+    }
+
+    const size_t i = ur_xoshiro256_next_index(rng, count);
+    return (ur_xoshiro256_next_double(rng) < probabilities[i] ? i : aliases[i]) + 1;
+}
+
+uint32_t ur_fragments_choose(uint32_t seq, uint16_t count, uint32_t checksum) {
+    uint8_t seed[UR_SEED_LENGTH];
+    uint8_t remaining[UR_FOUNTAIN_MAX_COUNT];
+    ur_xoshiro256_t rng;
+    uint32_t fragments = 0;
+
+    if (seq == 0 || count == 0 || count > UR_FOUNTAIN_MAX_COUNT) {
+        return 0;
+    }
+    if (seq <= count) {
+        return (uint32_t) 1 << (seq - 1);
+    }
+    // seq and the checksum in network byte order
+    for (size_t i = 0; i < sizeof(uint32_t); i++) {
+        seed[i] = seq >> (8 * (sizeof(uint32_t) - 1 - i));
+        seed[sizeof(uint32_t) + i] = checksum >> (8 * (sizeof(uint32_t) - 1 - i));
+    }
+    ur_xoshiro256_init(&rng, seed, sizeof(seed));
+    const uint16_t degree = ur_degree_choose(&rng, count);
+
+    // the first fragments of a shuffle of them all
+    for (size_t i = 0; i < count; i++) {
+        remaining[i] = i;
+    }
+    for (size_t n = count; n > (size_t) (count - degree); n--) {
+        const size_t index = ur_xoshiro256_next_index(&rng, n);
+
+        fragments |= (uint32_t) 1 << remaining[index];
+        memmove(remaining + index, remaining + index + 1, n - index - 1);
+    }
+    memzero(&rng, sizeof(rng));
+    return fragments;
+}
+
+// CBOR array of the multipart frame seq
+static size_t ur_part_length(const ur_encoder_t *encoder,
+                             uint32_t seq,
+                             uint16_t count,
+                             size_t fragment_length) {
+    return 1 + cbor_header_length(seq) + cbor_header_length(count) +
+           cbor_header_length(encoder->length) + cbor_header_length(encoder->checksum) +
+           cbor_header_length(fragment_length) + fragment_length;
+}
+
+static size_t ur_text_length(const ur_encoder_t *encoder,
+                             uint32_t seq,
+                             uint16_t count,
+                             size_t fragment_length) {
+    const size_t length = strlen(UR_SCHEME) + strlen(encoder->type) + 1;
+
+    if (count == 1) {
+        return length + 2 * (encoder->length + UR_CRC_LENGTH);
+    }
+    return length + decimal_length(seq) + decimal_length(count) + 2 +
+           2 * (ur_part_length(encoder, seq, count, fragment_length) + UR_CRC_LENGTH);
+}
+
+bool ur_encoder_start(ur_encoder_t *encoder,
+                      const char *type,
+                      const uint8_t *message,
+                      size_t length,
+                      size_t max_text_length) {
+    memzero(encoder, sizeof(*encoder));
+    if (length == 0) {
+        return false;
+    }
+    encoder->type = type;
+    encoder->message = message;
+    encoder->length = length;
+    encoder->checksum = cx_crc32(message, length);
+
+    for (size_t fragments = 1; fragments <= length && fragments <= UINT16_MAX; fragments++) {
+        const size_t fragment_length = (length + fragments - 1) / fragments;
+        // the fewest fragments of that length, none of them being only padding
+        const uint16_t count = (length + fragment_length - 1) / fragment_length;
+        const size_t part_length =
+            count == 1 ? length : ur_part_length(encoder, count, count, fragment_length);
+
+        // the systematic frame count is the longest one
+        if (part_length <= UR_PART_MAX_LENGTH &&
+            ur_text_length(encoder, count, count, fragment_length) <= max_text_length) {
+            encoder->fragment_length = fragment_length;
+            encoder->count = count;
+            encoder->cycle = count;
+            // followed by up to as many fountain-coded frames which fit
+            if (count > 1 && count <= UR_FOUNTAIN_MAX_COUNT) {
+                while (encoder->cycle < 2 * count &&
+                       ur_part_length(encoder, encoder->cycle + 1, count, fragment_length) <=
+                           UR_PART_MAX_LENGTH &&
+                       ur_text_length(encoder, encoder->cycle + 1, count, fragment_length) <=
+                           max_text_length) {
+                    encoder->cycle++;
+                }
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// the appended text is kept NUL-terminated, the helpers returning false if it does not fit
+static bool ur_text_append(char *text, size_t size, size_t *offset, const char *string) {
+    for (; *string != '\0'; string++) {
+        if (*offset + 1 >= size) {
+            return false;
+        }
+        // the text is upper case, as the alphanumeric mode of QR codes
+        text[(*offset)++] = *string >= 'a' && *string <= 'z' ? *string - 'a' + 'A' : *string;
+    }
+    text[*offset] = '\0';
+    return true;
+}
+
+static bool ur_decimal_append(char *text, size_t size, size_t *offset, uint32_t value) {
+    char digits[sizeof("4294967295")];
+    const size_t length = decimal_length(value);
+
+    digits[length] = '\0';
+    for (size_t i = length; i > 0; i--) {
+        digits[i - 1] = '0' + value % 10;
+        value /= 10;
+    }
+    return ur_text_append(text, size, offset, digits);
+}
+
+static bool ur_bytewords_append(char *text,
+                                size_t size,
+                                size_t *offset,
+                                const uint8_t *bytes,
+                                size_t length) {
+    char byteword[3] = {0};
+
+    for (size_t i = 0; i < length; i++) {
+        const unsigned char *word = SSKR_WORDLIST + bytes[i] * SSKR_BYTEWORD_LENGTH;
+
+        byteword[0] = word[0];
+        byteword[1] = word[SSKR_BYTEWORD_LENGTH - 1];
+        if (!ur_text_append(text, size, offset, byteword)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// XOR the fragment index, zero-padded, into a fragment
+static void ur_fragment_mix(const ur_encoder_t *encoder, uint16_t index, uint8_t *fragment) {
+    const size_t start = index * encoder->fragment_length;
+    const size_t length = MIN(encoder->fragment_length, encoder->length - start);
+
+    for (size_t i = 0; i < length; i++) {
+        fragment[i] ^= encoder->message[start + i];
+    }
+}
+
+size_t ur_encoder_part_get(const ur_encoder_t *encoder, uint32_t seq, char *text, size_t size) {
+    uint8_t part[UR_PART_MAX_LENGTH + UR_CRC_LENGTH];
+    size_t length = 0;
+    size_t offset = 0;
+
+    if (seq < 1 || seq > encoder->cycle || size == 0) {
+        return 0;
+    }
+    bool fits = ur_text_append(text, size, &offset, UR_SCHEME) &&
+                ur_text_append(text, size, &offset, encoder->type) &&
+                ur_text_append(text, size, &offset, "/");
+    if (encoder->count == 1) {
+        memcpy(part, encoder->message, encoder->length);
+        length = encoder->length;
+    } else {
+        fits = fits && ur_decimal_append(text, size, &offset, seq) &&
+               ur_text_append(text, size, &offset, "-") &&
+               ur_decimal_append(text, size, &offset, encoder->count) &&
+               ur_text_append(text, size, &offset, "/");
+        part[length++] = CBOR_ARRAY | UR_PART_FIELDS;
+        length += cbor_header_write(part + length, CBOR_UNSIGNED, seq);
+        length += cbor_header_write(part + length, CBOR_UNSIGNED, encoder->count);
+        length += cbor_header_write(part + length, CBOR_UNSIGNED, encoder->length);
+        length += cbor_header_write(part + length, CBOR_UNSIGNED, encoder->checksum);
+        length += cbor_header_write(part + length, CBOR_BYTES, encoder->fragment_length);
+        memset(part + length, 0, encoder->fragment_length);
+        if (seq <= encoder->count) {
+            ur_fragment_mix(encoder, seq - 1, part + length);
+        } else {
+            const uint32_t fragments =
+                ur_fragments_choose(seq, encoder->count, encoder->checksum);
+
+            for (uint16_t i = 0; i < encoder->count; i++) {
+                if ((fragments >> i) & 1) {
+                    ur_fragment_mix(encoder, i, part + length);
+                }
+            }
+        }
+        length += encoder->fragment_length;
+    }
+    // CRC-32 in network byte order
+    const uint32_t checksum = cx_crc32(part, length);
+    for (size_t i = 0; i < UR_CRC_LENGTH; i++) {
+        part[length++] = checksum >> (8 * (UR_CRC_LENGTH - 1 - i));
+    }
+    fits = fits && ur_bytewords_append(text, size, &offset, part, length);
+    memzero(part, sizeof(part));
+
+    if (!fits) {
+        memzero(text, size);
+        return 0;
+    }
+    return offset;
+}
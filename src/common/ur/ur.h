@@ -0,0 +1,75 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Uniform Resources (BCR-2020-005) of a CBOR message, as upper case text for the alphanumeric
+// mode of QR codes:
+// - "UR:<TYPE>/<BODY>" when the message fits in a single part, its body being the minimal
+//   ByteWords (first and last letters of each byteword) of the message followed by its CRC-32,
+// - else "UR:<TYPE>/<SEQ>-<COUNT>/<BODY>" multipart frames (BCR-2020-012), each body being the
+//   minimal ByteWords of the CBOR array [seq, count, message length, message CRC-32, fragment]
+//   followed by its CRC-32, the message being split in count zero-padded fragments.
+//
+// The count systematic frames, each holding a fragment, are followed by fountain-coded ones whose
+// fragment is the XOR of fragments picked at random from seq and the message CRC-32, which help
+// the decoders having missed some frames. Frames are cycled up to encoder->cycle: up to as many
+// fountain-coded frames as systematic ones follow them, as long as they fit and there are at most
+// UR_FOUNTAIN_MAX_COUNT fragments.
+#define UR_PART_MAX_LENGTH    64
+#define UR_FOUNTAIN_MAX_COUNT 32
+
+typedef struct {
+    const char *type;
+    const uint8_t *message;
+    size_t length;
+    uint32_t checksum;
+    size_t fragment_length;
+    uint16_t count;
+    // last frame of a cycle, count if no fountain-coded frame is output
+    uint32_t cycle;
+} ur_encoder_t;
+
+// split the message, of a lower case type, in the fewest fragments whose frames are at most
+// max_text_length characters long, return false if none is: the message is read by
+// ur_encoder_part_get, and has to be kept until then
+bool ur_encoder_start(ur_encoder_t *encoder,
+                      const char *type,
+                      const uint8_t *message,
+                      size_t length,
+                      size_t max_text_length);
+
+// write the frame seq (from 1 to encoder->cycle) as a NUL-terminated text, return its length or 0
+// if it does not fit
+size_t ur_encoder_part_get(const ur_encoder_t *encoder, uint32_t seq, char *text, size_t size);
+
+// Xoshiro256** generator of BCR-2020-012, seeded with the SHA-256 digest of a seed
+typedef struct {
+    uint64_t state[4];
+} ur_xoshiro256_t;
+
+void ur_xoshiro256_init(ur_xoshiro256_t *rng, const uint8_t *seed, size_t seed_length);
+
+uint64_t ur_xoshiro256_next(ur_xoshiro256_t *rng);
+
+// bitmask of the fragments mixed in the frame seq of a message split in count fragments, 0 if
+// count is above UR_FOUNTAIN_MAX_COUNT
+uint32_t ur_fragments_choose(uint32_t seq, uint16_t count, uint32_t checksum);
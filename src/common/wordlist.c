@@ -0,0 +1,99 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include "./wordlist.h"
+
+// position of each letter, in alphabetical order, in the KBD_LETTERS keyboard layout
+static const uint8_t KBD_LETTERS_POSITION[26] = {10, 23, 21, 12, 2,  13, 14, 15, 7,
+                                                 16, 17, 18, 25, 24, 8,  9,  0,  3,
+                                                 11, 4,  6,  22, 1,  20, 5,  19};
+
+static uint32_t popcount26(uint32_t value) {
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    value = (value + (value >> 4)) & 0x0F0F0F0F;
+    return (value * 0x01010101) >> 24;
+}
+
+void wordlist_prefix_range(wordlist_compare_prefix_t compare,
+                           const unsigned char *prefix,
+                           size_t prefix_length,
+                           unsigned int *first,
+                           unsigned int *last) {
+    unsigned int low = *first, high = *last;
+    // first word not sorted before the prefix
+    while (low < high) {
+        const unsigned int middle = low + (high - low) / 2;
+        if (compare(middle, prefix, prefix_length) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    *first = low;
+    // first word sorted after the prefix
+    high = *last;
+    while (low < high) {
+        const unsigned int middle = low + (high - low) / 2;
+        if (compare(middle, prefix, prefix_length) <= 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    *last = low;
+}
+
+wordlist_trie_result_t wordlist_trie_walk(const unsigned long long *trie,
+                                          const unsigned char *prefix,
+                                          size_t prefix_length,
+                                          uint32_t *next_letters) {
+    unsigned long long node = trie[0];
+    for (size_t i = 0; i < prefix_length; i++) {
+        const uint32_t letter = (uint32_t) (prefix[i] - 'a');
+        if (letter >= 26 || (WORDLIST_TRIE_LETTERS(node) & (1 << letter)) == 0) {
+            return WORDLIST_TRIE_NO_MATCH;
+        }
+        const uint32_t branches = WORDLIST_TRIE_BRANCHES(node);
+        if ((branches & (1 << letter)) == 0) {
+            return WORDLIST_TRIE_SINGLE_WORD;
+        }
+        node = trie[WORDLIST_TRIE_FIRST_CHILD(node) + popcount26(branches & ((1 << letter) - 1))];
+    }
+    *next_letters = WORDLIST_TRIE_LETTERS(node);
+    return WORDLIST_TRIE_NODE;
+}
+
+size_t wordlist_letters_from_mask(uint32_t letters_mask, unsigned char *buffer) {
+    size_t count = 0;
+    for (unsigned char letter = 0; letter < 26; letter++) {
+        if (letters_mask & (1 << letter)) {
+            buffer[count++] = 'a' + letter;
+        }
+    }
+    return count;
+}
+
+uint32_t wordlist_keyboard_mask(uint32_t letters_mask) {
+    uint32_t enabled_keys = 1 << 28;  // Starting with the 'return' keypad activated
+    for (uint8_t letter = 0; letter < 26; letter++) {
+        if (letters_mask & (1 << letter)) {
+            enabled_keys |= 1 << KBD_LETTERS_POSITION[letter];
+        }
+    }
+    return (-1 ^ enabled_keys);
+}
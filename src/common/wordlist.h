@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Prefix trie shared by the BIP39 and SSKR wordlists, generated alongside the wordlists.
+//
+// Only prefixes shared by at least two words get a node: once a prefix matches a single word,
+// the next letter is read from that word. Each node is packed in a 64-bit word:
+// - bits  0-25: letters that may follow the prefix ('a' is bit 0)
+// - bits 26-51: letters leading to another node (prefix still shared by several words)
+// - bits 52-63: index of the first child node, the others following in alphabetical order
+// Node 0 is the empty prefix.
+#define WORDLIST_TRIE_LETTERS(node)     ((uint32_t) ((node) & 0x3FFFFFF))
+#define WORDLIST_TRIE_BRANCHES(node)    ((uint32_t) (((node) >> 26) & 0x3FFFFFF))
+#define WORDLIST_TRIE_FIRST_CHILD(node) ((uint32_t) ((node) >> 52))
+
+typedef enum {
+    WORDLIST_TRIE_NO_MATCH,     // no word starts with the prefix
+    WORDLIST_TRIE_SINGLE_WORD,  // at most one word starts with the prefix
+    WORDLIST_TRIE_NODE,         // several words start with the prefix
+} wordlist_trie_result_t;
+
+// compare the beginning of the word at the given index with the prefix, strncmp style
+typedef int (*wordlist_compare_prefix_t)(unsigned int index,
+                                         const unsigned char *prefix,
+                                         size_t prefix_length);
+
+// narrow [first, last) of a sorted wordlist down to the words starting with the prefix, using
+// two binary searches. The range is empty (first == last) when no word matches.
+void wordlist_prefix_range(wordlist_compare_prefix_t compare,
+                           const unsigned char *prefix,
+                           size_t prefix_length,
+                           unsigned int *first,
+                           unsigned int *last);
+
+// walk the trie along the prefix, at most one node per letter
+// when WORDLIST_TRIE_NODE is returned, next_letters is set to the mask of the possible next
+// letters. When WORDLIST_TRIE_SINGLE_WORD is returned, the caller has to look the word up
+// as the remaining letters of the prefix were not checked.
+wordlist_trie_result_t wordlist_trie_walk(const unsigned long long *trie,
+                                          const unsigned char *prefix,
+                                          size_t prefix_length,
+                                          uint32_t *next_letters);
+
+// write the letters of the mask in alphabetical order, return the number of letters
+size_t wordlist_letters_from_mask(uint32_t letters_mask, unsigned char *buffer);
+
+// convert a letters mask to the NBGL keyboard mask, in which set bits are the *disabled* keys
+// in KBD_LETTERS order and the 'return' key (bit 28) is always enabled
+uint32_t wordlist_keyboard_mask(uint32_t letters_mask);
@@ -29,8 +29,20 @@ enum {
     BIP39_MNEMONIC_SIZE_24 = 24,
 };
 
-// Type of onboarding we are performing (BIP39 or SSKR)
-enum { ONBOARDING_TYPE_BIP39, ONBOARDING_TYPE_SSKR };
+// Type of onboarding we are performing (BIP39, SSKR, SLIP-39 or codex32, or the generation of
+// BIP85 children): the checked ones come first, as they index the result texts
+enum {
+    ONBOARDING_TYPE_BIP39,
+    ONBOARDING_TYPE_SSKR,
+    ONBOARDING_TYPE_SLIP39,
+    ONBOARDING_TYPE_CODEX32,
+    ONBOARDING_TYPE_BIP85,
+};
+
+#ifdef HAVE_ELECTRUM
+// Seed algorithm of a BIP39 wordlist phrase
+enum { BOLOS_UX_ONBOARDING_ALGORITHM_BIP39, BOLOS_UX_ONBOARDING_ALGORITHM_ELECTRUM };
+#endif
 
 // State of the dynamic display
 enum { STATIC_SCREEN, DYNAMIC_SCREEN };
@@ -23,35 +23,26 @@
 #include "../common/sskr/common_sskr.h"
 #include "./bip39_mnemonic.h"
 #include "./sskr_shares.h"
+#include "./slip39_shares.h"
 
 #if defined(SCREEN_SIZE_WALLET)
 
 typedef struct bip39_buffer_struct {
-    // the mnemonic passphrase, built over time
-    char buffer[BIP39_MNEMONIC_MAX_LENGTH];
-    // current length of the mnemonic passphrase
-    size_t length;
+    // the mnemonic 11-bit word indexes, packed as they are entered
+    unsigned char entropy[BIP39_ENTROPY_MAX_LENGTH];
     // index of the current word ((size_t)-1 mean there is no word currently)
     size_t current_word_index;
-    // array of every stored word lengths (used for removing them if needed)
-    size_t word_lengths[BIP39_MNEMONIC_SIZE_24];
     // expected number of word in the final mnemonic (12 or 18 or 24)
     size_t final_size;
+    // index of the word marked as unknown, to be searched for ((size_t)-1 if there is none)
+    size_t unknown_word_index;
+    // first word changed by the repair search, and whether it was swapped with the next one
+    size_t fixed_word_index;
+    bool fixed_by_swap;
 } bip39_buffer_t;
 
 static bip39_buffer_t mnemonic = {0};
 
-size_t bip39_mnemonic_shrink(const size_t size) {
-    if (size == 0 || size > mnemonic.length) {
-        // shrink all
-        mnemonic.length = 0;
-    } else {
-        mnemonic.length -= size;
-    }
-    memzero(&mnemonic.buffer[mnemonic.length], BIP39_MNEMONIC_MAX_LENGTH - mnemonic.length);
-    return mnemonic.length;
-}
-
 void bip39_mnemonic_final_size_set(const size_t size) {
     mnemonic.final_size = size;
 }
@@ -67,6 +58,7 @@ size_t bip39_mnemonic_current_word_number_get(void) {
 void bip39_mnemonic_reset(void) {
     memzero(&mnemonic, sizeof(mnemonic));
     mnemonic.current_word_index = (size_t) -1;
+    mnemonic.unknown_word_index = (size_t) -1;
 }
 
 bool bip39_mnemonic_word_remove(void) {
@@ -74,79 +66,145 @@ bool bip39_mnemonic_word_remove(void) {
     if (mnemonic.current_word_index == (size_t) -1) {
         return false;
     }
-    const size_t current_length = mnemonic.word_lengths[mnemonic.current_word_index];
+    bolos_ux_bip39_entropy_word_set(mnemonic.entropy, mnemonic.current_word_index, 0);
+    if (mnemonic.unknown_word_index == mnemonic.current_word_index) {
+        mnemonic.unknown_word_index = (size_t) -1;
+    }
     mnemonic.current_word_index--;
-    // removing previous word from mnemonic buffer (+ 1 blank space)
-    bip39_mnemonic_shrink(current_length + 1);
     PRINTF("Number of remaining words in the mnemonic: '%d'\n", mnemonic.current_word_index + 1);
     return true;
 }
 
-size_t bip39_mnemonic_word_add(const char* const buffer, const size_t size) {
-    if (mnemonic.current_word_index != (size_t) -1) {
-        // adding an extra white space ' ' between words
-        mnemonic.buffer[mnemonic.length++] = ' ';
-        mnemonic.buffer[mnemonic.length] = '\0';
+size_t bip39_mnemonic_word_add(const unsigned int index) {
+    if (mnemonic.current_word_index + 1 >= BIP39_MNEMONIC_SIZE_24) {
+        return bip39_mnemonic_current_word_number_get();
     }
-    memcpy(&mnemonic.buffer[0] + mnemonic.length, buffer, size);
-    mnemonic.length += size;
     mnemonic.current_word_index++;
-    mnemonic.word_lengths[mnemonic.current_word_index] = size;
+    bolos_ux_bip39_entropy_word_set(mnemonic.entropy, mnemonic.current_word_index, index);
     PRINTF("Number of words in the mnemonic: '%d'\n", bip39_mnemonic_current_word_number_get());
-    PRINTF("Current mnemonic: '%s'\n", &mnemonic.buffer[0]);
     return bip39_mnemonic_current_word_number_get();
 }
 
+size_t bip39_mnemonic_unknown_word_add(void) {
+    if (mnemonic.unknown_word_index != (size_t) -1 ||
+        mnemonic.current_word_index + 1 >= BIP39_MNEMONIC_SIZE_24) {
+        return bip39_mnemonic_current_word_number_get();
+    }
+    // the unknown word is left to 0 until it is found
+    bip39_mnemonic_word_add(0);
+    mnemonic.unknown_word_index = mnemonic.current_word_index;
+    return bip39_mnemonic_current_word_number_get();
+}
+
+size_t bip39_mnemonic_unknown_word_get(void) {
+    return mnemonic.unknown_word_index;
+}
+
 bool bip39_mnemonic_complete_check(void) {
     return (mnemonic.final_size == 0
                 ? false
                 : (mnemonic.current_word_index + 1) >= bip39_mnemonic_final_size_get());
 }
 
-bool bip39_mnemonic_check(bool* match) {
-    *match = false;
+bool bip39_mnemonic_check(void) {
     if (!bip39_mnemonic_complete_check()) {
         return false;
     }
-    PRINTF("Checking the following mnemonic: '%s' (size %d)\n",
-           &mnemonic.buffer[0],
-           mnemonic.length);
+    PRINTF("Checking the following mnemonic entropy: '%.*H'\n",
+           sizeof(mnemonic.entropy),
+           &mnemonic.entropy[0]);
+
+    // with an unknown word the checksum can't be checked, the word is searched for instead
+    if (mnemonic.unknown_word_index != (size_t) -1) {
+        return phrase_search_missing_word_start(mnemonic.entropy,
+                                                mnemonic.final_size,
+                                                mnemonic.unknown_word_index);
+    }
 
-    if (bolos_ux_bip39_mnemonic_check((unsigned char*) &mnemonic.buffer[0], mnemonic.length) ==
-        false) {
-        bip39_mnemonic_reset();
+    // an invalid mnemonic is kept, in case it is to be repaired
+    if (bolos_ux_bip39_entropy_check(mnemonic.entropy, mnemonic.final_size) == false) {
         return false;
     }
 
-    *match = compare_recovery_phrase();
+    // the comparison itself is run from the ticker, see compare_recovery_phrase_step
+    if (!compare_recovery_phrase_start()) {
+        return false;
+    }
     // Don't clear the mnemonic just yet as we may need it to generate SSKR shares
     //    bip39_mnemonic_reset();
 
     return true;
 }
 
-void bip39_mnemonic_from_sskr_shares(unsigned char* seed) {
-    mnemonic.length = BIP39_MNEMONIC_MAX_LENGTH;
+bool bip39_mnemonic_repair(void) {
+    if (!bip39_mnemonic_complete_check() || mnemonic.unknown_word_index != (size_t) -1) {
+        return false;
+    }
+    return phrase_search_repair_start(mnemonic.entropy, mnemonic.final_size);
+}
 
-    bolos_ux_sskr_to_seed_convert((const unsigned char*) sskr_shares_get(),
-                                  sskr_shares_length_get(),
-                                  sskr_sharecount_get(),
-                                  (const unsigned char*) bip39_mnemonic_get(),
-                                  &mnemonic.length,
-                                  seed);
+bool bip39_mnemonic_search_finish(void) {
+    unsigned char entropy[BIP39_ENTROPY_MAX_LENGTH];
 
-    if (mnemonic.length > 0) {
-        PRINTF("BIP39 mnemonic: %.*s\n", mnemonic.length, bip39_mnemonic_get());
+    if (!phrase_search_finish(entropy)) {
+        return false;
+    }
+    // a repair changes a single word, or two adjacent ones when swapping them
+    mnemonic.fixed_word_index = 0;
+    while (mnemonic.fixed_word_index + 1 < mnemonic.final_size &&
+           bolos_ux_bip39_entropy_word_get(entropy, mnemonic.fixed_word_index) ==
+               bolos_ux_bip39_entropy_word_get(mnemonic.entropy, mnemonic.fixed_word_index)) {
+        mnemonic.fixed_word_index++;
     }
+    mnemonic.fixed_by_swap =
+        mnemonic.fixed_word_index + 1 < mnemonic.final_size &&
+        bolos_ux_bip39_entropy_word_get(entropy, mnemonic.fixed_word_index + 1) !=
+            bolos_ux_bip39_entropy_word_get(mnemonic.entropy, mnemonic.fixed_word_index + 1);
+    memcpy(mnemonic.entropy, entropy, sizeof(mnemonic.entropy));
+    memzero(entropy, sizeof(entropy));
+    return true;
+}
+
+size_t bip39_mnemonic_fixed_word_get(bool* swapped) {
+    *swapped = mnemonic.fixed_by_swap;
+    return mnemonic.fixed_word_index;
+}
+
+void bip39_mnemonic_from_sskr_shares(void) {
+    mnemonic.final_size = bolos_ux_sskr_to_bip39_entropy_convert(
+        (const unsigned char*) sskr_shares_get(),
+        sskr_shares_length_get(),
+        sskr_sharecount_get(),
+        mnemonic.entropy);
+    mnemonic.current_word_index = mnemonic.final_size - 1;
+}
+
+// the secret of the shares is the entropy of the phrase, its checksum bits being appended
+static void bip39_mnemonic_from_secret(const uint8_t* secret, const size_t length) {
+    memzero(mnemonic.entropy, sizeof(mnemonic.entropy));
+    memcpy(mnemonic.entropy, secret, MIN(length, sizeof(mnemonic.entropy)));
+    mnemonic.final_size = length * 3 / 4;
+    bolos_ux_bip39_entropy_checksum_set(mnemonic.entropy, mnemonic.final_size);
+    mnemonic.current_word_index = mnemonic.final_size - 1;
+}
+
+void bip39_mnemonic_from_slip39_shares(void) {
+    size_t length;
+    const uint8_t* secret = slip39_shares_secret_get(&length);
+
+    bip39_mnemonic_from_secret(secret, length);
 }
 
 // Used for BIP39 <-> SSKR roundtrip
-char* bip39_mnemonic_get(void) {
-    return mnemonic.buffer;
+const unsigned char* bip39_mnemonic_entropy_get(void) {
+    return mnemonic.entropy;
 }
 
-size_t bip39_mnemonic_length_get(void) {
-    return mnemonic.length;
+size_t bip39_mnemonic_text_get(char* buffer, const size_t size) {
+    return bolos_ux_bip39_entropy_to_mnemonic(mnemonic.entropy,
+                                              mnemonic.final_size,
+                                              (unsigned char*) buffer,
+                                              size);
 }
 
 #endif
@@ -22,8 +22,6 @@
 
 #if defined(SCREEN_SIZE_WALLET)
 
-#define BIP39_MNEMONIC_MAX_LENGTH (BIP39_MNEMONIC_SIZE_24 * (BIP39_MAX_WORD_LENGTH + 1))
-
 /*
  * Sets how many words are expected in the mnemonic passphrase
  */
@@ -45,9 +43,29 @@ size_t bip39_mnemonic_current_word_number_get(void);
 bool bip39_mnemonic_complete_check(void);
 
 /*
- * Check if the currently stored mnemonic generates the same seed as the current device's one
+ * Check if the currently stored mnemonic is valid, and if so start its comparison with the
+ * current device's seed (see compare_recovery_phrase_step). If a word is unknown, start the
+ * search for it instead (see phrase_search_step)
+ */
+bool bip39_mnemonic_check(void);
+
+/*
+ * Start the search for the variant of the stored mnemonic (adjacent words swapped, or a word
+ * replaced by a near one) matching the current device's seed (see phrase_search_step)
+ */
+bool bip39_mnemonic_repair(void);
+
+/*
+ * Once the search for the unknown word (or the repair) is over, replace the mnemonic with the
+ * found one, returns false if none matches the current device's seed
+ */
+bool bip39_mnemonic_search_finish(void);
+
+/*
+ * Returns the index of the first word changed by the repair, swapped with the next one if
+ * swapped is set
  */
-bool bip39_mnemonic_check(bool* match);
+size_t bip39_mnemonic_fixed_word_get(bool* swapped);
 
 /*
  * Erase all information and reset the indexes
@@ -61,23 +79,40 @@ void bip39_mnemonic_reset(void);
 bool bip39_mnemonic_word_remove(void);
 
 /*
- * Adds a word in the passphrase, returns how many words are stored in the mnemonic
+ * Adds a word, given its index in the BIP39 wordlist, in the passphrase, returns how many words
+ * are stored in the mnemonic
  */
-size_t bip39_mnemonic_word_add(const char* const buffer, const size_t size);
+size_t bip39_mnemonic_word_add(const unsigned int index);
+
+/*
+ * Adds a word marked as unknown in the passphrase (at most one word can be), returns how many
+ * words are stored in the mnemonic
+ */
+size_t bip39_mnemonic_unknown_word_add(void);
+
+/*
+ * Returns the index of the word marked as unknown, (size_t)-1 if there is none
+ */
+size_t bip39_mnemonic_unknown_word_get(void);
 
 /*
  * Generate BIP39 mnemonic from SSKR shares
  */
-void bip39_mnemonic_from_sskr_shares(unsigned char* seed);
+void bip39_mnemonic_from_sskr_shares(void);
+
+/*
+ * Generate BIP39 mnemonic from the master secret of SLIP-39 shares
+ */
+void bip39_mnemonic_from_slip39_shares(void);
 
 /*
- * Returns the mnemonic passphrase
+ * Returns the mnemonic entropy buffer (packed word indexes followed by the checksum bits)
  */
-char* bip39_mnemonic_get(void);
+const unsigned char* bip39_mnemonic_entropy_get(void);
 
 /*
- * Returns length of the mnemonic passphrase
+ * Writes the mnemonic passphrase as text in the buffer, returns its length (0 if it does not fit)
  */
-size_t bip39_mnemonic_length_get(void);
+size_t bip39_mnemonic_text_get(char* buffer, const size_t size);
 
 #endif  // SCREEN_SIZE_WALLET
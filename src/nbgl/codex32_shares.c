@@ -0,0 +1,106 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <os.h>
+#include <string.h>
+
+#include "../common/common.h"
+#include "./codex32_shares.h"
+
+#if defined(SCREEN_SIZE_WALLET)
+
+static struct {
+    // shares entered so far
+    codex32_share_t shares[CODEX32_SHARES_MAX_COUNT];
+    uint8_t count;
+    // share being entered
+    codex32_reader_t reader;
+    size_t secret_length;
+    uint8_t secret[CODEX32_MAX_SECRET_SIZE];
+} codex32 = {0};
+
+void codex32_shares_reset(void) {
+    memzero(&codex32, sizeof(codex32));
+}
+
+bool codex32_shares_start(const size_t secret_length) {
+    codex32_shares_reset();
+    if (secret_length != CODEX32_MAX_SECRET_SIZE) {
+        return false;
+    }
+    codex32.secret_length = secret_length;
+    return codex32_reader_start(&codex32.reader, secret_length);
+}
+
+size_t codex32_shares_final_size_get(void) {
+    return codex32.reader.final_length;
+}
+
+size_t codex32_shares_current_char_number_get(void) {
+    return codex32.reader.share.length;
+}
+
+uint8_t codex32_shares_current_share_number_get(void) {
+    return codex32.count + 1;
+}
+
+size_t codex32_shares_current_text_get(const size_t start, char* buffer, const size_t size) {
+    size_t n = 0;
+
+    for (size_t i = start; i < codex32.reader.share.length && n < size; i++) {
+        buffer[n++] = CODEX32_CHARSET[codex32.reader.share.values[i]] - 'a' + 'A';
+    }
+    return n;
+}
+
+codex32_char_status_t codex32_shares_char_add(const char c) {
+    if (codex32.count >= CODEX32_SHARES_MAX_COUNT) {
+        return CODEX32_CHAR_MISMATCH;
+    }
+    const codex32_char_status_t status =
+        codex32_reader_char_add(&codex32.reader, c, codex32.shares, codex32.count);
+    if (status == CODEX32_SHARE_COMPLETE) {
+        PRINTF("codex32 share %d complete\n", codex32.count + 1);
+        memcpy(&codex32.shares[codex32.count++], &codex32.reader.share, sizeof(codex32_share_t));
+        codex32_reader_start(&codex32.reader, codex32.secret_length);
+    }
+    return status;
+}
+
+bool codex32_shares_char_remove(void) {
+    return codex32_reader_char_remove(&codex32.reader);
+}
+
+bool codex32_shares_complete_check(void) {
+    return codex32_shares_complete(codex32.shares, codex32.count);
+}
+
+bool codex32_shares_check(void) {
+    if (codex32_combine(codex32.shares, codex32.count, codex32.secret, sizeof(codex32.secret)) !=
+        codex32.secret_length) {
+        PRINTF("The codex32 shares are inconsistent\n");
+        memzero(codex32.secret, sizeof(codex32.secret));
+        return false;
+    }
+    return true;
+}
+
+bool codex32_shares_master_seed_compare(void) {
+    return compare_master_seed(codex32.secret, codex32.secret_length);
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include "../common/codex32/codex32.h"
+
+#if defined(SCREEN_SIZE_WALLET)
+
+// codex32 shares, entered a character at a time: as defined by BIP93, their secret is the BIP32
+// master seed itself, compared to the device's seed at once. Only 64-byte secrets are accepted, the
+// length of the seed of the BIP39 phrase of the device, 16 and 32-byte secrets being those of
+// wallets without BIP39 phrase.
+#define CODEX32_SHARES_MAX_COUNT CODEX32_MAX_THRESHOLD
+
+/*
+ * Erase all information, the shares are then expected to hold a secret_length bytes long secret
+ * (64 bytes), returns false if they cannot
+ */
+bool codex32_shares_start(const size_t secret_length);
+
+/*
+ * Erase all information
+ */
+void codex32_shares_reset(void);
+
+/*
+ * Returns how many characters are expected in each share, following its "ms1" prefix
+ */
+size_t codex32_shares_final_size_get(void);
+
+/*
+ * Returns how many characters of the current share are stored
+ */
+size_t codex32_shares_current_char_number_get(void);
+
+/*
+ * Returns the number of the share being entered, starting at 1
+ */
+uint8_t codex32_shares_current_share_number_get(void);
+
+/*
+ * Copy the characters of the current share from the start-th one, in upper case, returns their
+ * count
+ */
+size_t codex32_shares_current_text_get(const size_t start, char* buffer, const size_t size);
+
+/*
+ * Add a character to the current share, only kept if accepted: once the share is complete the
+ * next one is started
+ */
+codex32_char_status_t codex32_shares_char_add(const char c);
+
+/*
+ * Remove the latest character of the current share, returns false if there is none
+ */
+bool codex32_shares_char_remove(void);
+
+/*
+ * Whether the complete shares reach their threshold
+ */
+bool codex32_shares_complete_check(void);
+
+/*
+ * Recover the secret, returns false if the shares are inconsistent
+ */
+bool codex32_shares_check(void);
+
+/*
+ * Whether the recovered master seed is the device's one
+ */
+bool codex32_shares_master_seed_compare(void);
+
+#endif
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <os.h>
+
+#if defined(SCREEN_SIZE_WALLET)
+
+#include <nbgl_front.h>
+
+#include "./qrcode_screen.h"
+
+// the rectangles drawn by nbgl_frontDrawRect are kept aligned on the 4-pixel vertical unit of
+// the frame buffer
+#define QRCODE_SCREEN_ALIGNMENT 4
+
+void qrcode_screen_draw(const qrcode_t *qrcode, const uint16_t top, const uint16_t height) {
+    const uint16_t modules = qrcode->size + 2 * QRCODE_QUIET_ZONE;
+    uint16_t module_pixels = MIN(SCREEN_WIDTH, height) / modules;
+    module_pixels -= module_pixels % QRCODE_SCREEN_ALIGNMENT;
+    if (module_pixels == 0) {
+        return;
+    }
+    const uint16_t left = (SCREEN_WIDTH - qrcode->size * module_pixels) / 2;
+    uint16_t y0 = top + (height - qrcode->size * module_pixels) / 2;
+    y0 -= y0 % QRCODE_SCREEN_ALIGNMENT;
+    nbgl_area_t area = {.height = module_pixels, .backgroundColor = BLACK, .bpp = NBGL_BPP_1};
+
+    // the page background being white, only the runs of dark modules of each row are drawn
+    for (uint8_t y = 0; y < qrcode->size; y++) {
+        uint8_t x = 0;
+        while (x < qrcode->size) {
+            if (!qrcode_module_get(qrcode, x, y)) {
+                x++;
+                continue;
+            }
+            const uint8_t start = x;
+            while (x < qrcode->size && qrcode_module_get(qrcode, x, y)) {
+                x++;
+            }
+            area.x0 = left + start * module_pixels;
+            area.y0 = y0 + y * module_pixels;
+            area.width = (x - start) * module_pixels;
+            nbgl_frontDrawRect(&area);
+        }
+    }
+}
+
+void qrcode_screen_refresh(const qrcode_t *qrcode, const uint16_t top, const uint16_t height) {
+    const nbgl_area_t band = {.x0 = 0,
+                              .y0 = top,
+                              .width = SCREEN_WIDTH,
+                              .height = height,
+                              .backgroundColor = WHITE,
+                              .bpp = NBGL_BPP_1};
+
+    nbgl_frontDrawRect(&band);
+    qrcode_screen_draw(qrcode, top, height);
+    nbgl_frontRefreshArea(&band, BLACK_AND_WHITE_FAST_REFRESH, POST_REFRESH_FORCE_POWER_OFF);
+}
+
+#endif  // SCREEN_SIZE_WALLET
@@ -0,0 +1,38 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include "../common/qrcode/qrcode.h"
+
+#if defined(SCREEN_SIZE_WALLET)
+
+/*
+ * Draws the symbol with its quiet zone straight to the frame buffer, as big as it fits in the
+ * full-width band of the given height starting at top, and centered in it: to be called once the
+ * page around it is drawn, before its refresh
+ */
+void qrcode_screen_draw(const qrcode_t *qrcode, const uint16_t top, const uint16_t height);
+
+/*
+ * Same as qrcode_screen_draw over the symbol previously drawn in the band, once the page is shown:
+ * the band is cleared and only its area is refreshed, in black and white
+ */
+void qrcode_screen_refresh(const qrcode_t *qrcode, const uint16_t top, const uint16_t height);
+
+#endif  // SCREEN_SIZE_WALLET
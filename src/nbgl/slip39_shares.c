@@ -0,0 +1,242 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include <os.h>
+#include <string.h>
+#include <lcx_rng.h>
+
+#include "../common/common.h"
+#include "../common/bip39/common_bip39.h"
+#include "./slip39_shares.h"
+
+#if defined(SCREEN_SIZE_WALLET)
+
+static struct {
+    // shares entered so far, or generated
+    slip39_share_t shares[SLIP39_SHARES_MAX_COUNT];
+    uint8_t count;
+    // share being entered
+    slip39_reader_t reader;
+    // encryption or decryption of the master secret, run by slip39_shares_step
+    slip39_cipher_t cipher;
+    bool pending;
+    // decrypted master secret, or the encrypted one to split
+    uint8_t secret[SSS_MAX_SECRET_SIZE];
+    size_t secret_length;
+    uint16_t identifier;
+    uint8_t sharenum;
+    uint8_t threshold;
+} slip39 = {0};
+
+void slip39_shares_reset(void) {
+    memzero(&slip39, sizeof(slip39));
+}
+
+bool slip39_shares_start(const size_t final_size) {
+    slip39_shares_reset();
+    // the master secret has to be the entropy of a 12, 18 or 24-word BIP39 phrase
+    return (final_size == SLIP39_WORDS(16) || final_size == SLIP39_WORDS(24) ||
+            final_size == SLIP39_WORDS(32)) &&
+           slip39_reader_start(&slip39.reader, final_size);
+}
+
+size_t slip39_shares_final_size_get(void) {
+    return slip39.reader.final_size;
+}
+
+size_t slip39_shares_current_word_number_get(void) {
+    return slip39.reader.word_count;
+}
+
+uint8_t slip39_shares_current_share_number_get(void) {
+    return slip39.count + 1;
+}
+
+slip39_word_status_t slip39_shares_word_add(const unsigned int index) {
+    if (slip39.count >= SLIP39_SHARES_MAX_COUNT) {
+        return SLIP39_WORD_MISMATCH;
+    }
+    const slip39_word_status_t status =
+        slip39_reader_word_add(&slip39.reader, index, slip39.shares, slip39.count);
+    PRINTF("SLIP-39 share %d word %d: status %d\n",
+           slip39.count + 1,
+           slip39.reader.word_count,
+           status);
+    if (status == SLIP39_SHARE_COMPLETE) {
+        memcpy(&slip39.shares[slip39.count++], &slip39.reader.share, sizeof(slip39_share_t));
+        // the next share has as many words
+        slip39_reader_start(&slip39.reader, slip39.reader.final_size);
+    }
+    return status;
+}
+
+bool slip39_shares_word_remove(void) {
+    return slip39_reader_word_remove(&slip39.reader);
+}
+
+bool slip39_shares_complete_check(void) {
+    return slip39_shares_complete(slip39.shares, slip39.count);
+}
+
+bool slip39_shares_check(void) {
+    uint8_t secret[SSS_MAX_SECRET_SIZE];
+    const size_t length = slip39_combine(slip39.shares, slip39.count, secret);
+
+    if (length == 0) {
+        PRINTF("The SLIP-39 shares are inconsistent\n");
+        return false;
+    }
+    const cx_err_t error = slip39_cipher_start(&slip39.cipher,
+                                               true,
+                                               secret,
+                                               length,
+                                               NULL,
+                                               0,
+                                               slip39.shares[0].identifier,
+                                               slip39.shares[0].extendable,
+                                               slip39.shares[0].iteration_exponent);
+    memzero(secret, sizeof(secret));
+    slip39.secret_length = length;
+    slip39.pending = error == CX_OK;
+    return slip39.pending;
+}
+
+bool slip39_shares_pending(void) {
+    return slip39.pending;
+}
+
+uint8_t slip39_shares_step(void) {
+    if (!slip39.pending) {
+        return 100;
+    }
+    return slip39_cipher_step(&slip39.cipher, SLIP39_SHARES_ROUNDS_PER_STEP);
+}
+
+bool slip39_shares_decrypt_finish(void) {
+    slip39.pending = false;
+    if (slip39_cipher_final(&slip39.cipher, slip39.secret, slip39.secret_length) != CX_OK) {
+        memzero(slip39.secret, sizeof(slip39.secret));
+        return false;
+    }
+    // the comparison itself is run from the ticker, see compare_recovery_phrase_step
+    return compare_recovery_phrase_start();
+}
+
+const uint8_t* slip39_shares_secret_get(size_t* length) {
+    *length = slip39.secret_length;
+    return slip39.secret;
+}
+
+void slip39_sharenum_set(const uint8_t sharenum) {
+    slip39.sharenum = sharenum;
+}
+
+uint8_t slip39_sharenum_get(void) {
+    return slip39.sharenum;
+}
+
+void slip39_threshold_set(const uint8_t threshold) {
+    slip39.threshold = threshold;
+}
+
+uint8_t slip39_threshold_get(void) {
+    return slip39.threshold;
+}
+
+bool slip39_shares_generate_start(const unsigned char* entropy, const size_t word_count) {
+    // the checksum bits following the entropy are not part of the secret
+    const size_t length = word_count * 4 / 3;
+
+    slip39.count = 0;
+    if (length != 16 && length != 24 && length != 32) {
+        return false;
+    }
+    // a new identifier for the new set of shares, which are extendable
+    cx_rng_no_throw((uint8_t*) &slip39.identifier, sizeof(slip39.identifier));
+    slip39.identifier &= 0x7FFF;
+    slip39.secret_length = length;
+    slip39.pending = slip39_cipher_start(&slip39.cipher,
+                                         false,
+                                         entropy,
+                                         length,
+                                         NULL,
+                                         0,
+                                         slip39.identifier,
+                                         true,
+                                         0) == CX_OK;
+    return slip39.pending;
+}
+
+bool slip39_shares_generate_finish(void) {
+    const slip39_group_descriptor_t group = {.threshold = slip39.threshold,
+                                             .count = slip39.sharenum};
+    int16_t share_count = -1;
+
+    slip39.pending = false;
+    if (slip39_cipher_final(&slip39.cipher, slip39.secret, slip39.secret_length) == CX_OK) {
+        share_count = slip39_split(slip39.secret,
+                                   slip39.secret_length,
+                                   slip39.identifier,
+                                   true,
+                                   0,
+                                   1,
+                                   &group,
+                                   1,
+                                   slip39.shares,
+                                   SLIP39_SHARES_MAX_COUNT,
+                                   cx_rng);
+    }
+    memzero(slip39.secret, sizeof(slip39.secret));
+    PRINTF("SLIP-39 share count returned: %d\n", share_count);
+    if (share_count != slip39.sharenum) {
+        memzero(slip39.shares, sizeof(slip39.shares));
+        return false;
+    }
+    slip39.count = share_count;
+    return true;
+}
+
+uint8_t slip39_sharecount_get(void) {
+    return slip39.count;
+}
+
+size_t slip39_share_text_get(const uint8_t index, char* buffer, const size_t size) {
+    uint16_t words[SLIP39_MAX_WORDS];
+    unsigned char word[SLIP39_WORDLIST_WORD_LETTERS + 1];
+    size_t length = 0;
+
+    if (index >= slip39.count) {
+        return 0;
+    }
+    const size_t word_count = slip39_share_encode(&slip39.shares[index], words, SLIP39_MAX_WORDS);
+    for (size_t i = 0; i < word_count; i++) {
+        const size_t word_length = bolos_ux_slip39_idx_strcpy(words[i], word);
+        if (length + (i > 0) + word_length > size) {
+            length = 0;
+            break;
+        }
+        if (i > 0) {
+            buffer[length++] = ' ';
+        }
+        memcpy(buffer + length, word, word_length);
+        length += word_length;
+    }
+    memzero(words, sizeof(words));
+    memzero(word, sizeof(word));
+    return length;
+}
+#endif
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *   Ledger Seed Tool application
+ *   (c) 2016-2025 Ledger SAS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#pragma once
+
+#include "../common/slip39/common_slip39.h"
+
+#if defined(SCREEN_SIZE_WALLET)
+
+// SLIP-39 shares of the BIP39 entropy, as the SSKR shares: the master secret of 20, 27 and 33-word
+// shares is the entropy of a 12, 18 and 24-word phrase. SLIP-39 wallets take it as the BIP32 seed
+// and restore another wallet from these "BIP39-entropy SLIP-39" shares, only this app recovers
+// the phrase from them, and a genuine SLIP-39 backup never matches the device. It is encrypted
+// without passphrase, the Feistel rounds being run a few PBKDF2 iterations at a time from the
+// ticker: a PBKDF2-HMAC-SHA256 round costs about half a PBKDF2-HMAC-SHA512 one, see
+// COMPARE_RECOVERY_PHRASE_ROUNDS_PER_STEP.
+#define SLIP39_SHARES_MAX_COUNT 16
+// 33 words of 8 letters at most, space separated
+#define SLIP39_SHARE_TEXT_MAX_LENGTH (SLIP39_MAX_WORDS * (SLIP39_WORDLIST_WORD_LETTERS + 1) - 1)
+#define SLIP39_SHARES_ROUNDS_PER_STEP 256
+
+/*
+ * Erase all information, the shares are then expected to have final_size words (20, 27 or 33),
+ * returns false if they cannot
+ */
+bool slip39_shares_start(const size_t final_size);
+
+/*
+ * Erase all information
+ */
+void slip39_shares_reset(void);
+
+/*
+ * Returns how many words are expected in each share
+ */
+size_t slip39_shares_final_size_get(void);
+
+/*
+ * Returns how many words of the current share are stored
+ */
+size_t slip39_shares_current_word_number_get(void);
+
+/*
+ * Returns the number of the share being entered, starting at 1
+ */
+uint8_t slip39_shares_current_share_number_get(void);
+
+/*
+ * Adds a word, given its index in the SLIP-39 wordlist, in the current share: it is only kept if
+ * accepted (see slip39_reader_word_add), the share being stored once complete
+ */
+slip39_word_status_t slip39_shares_word_add(const unsigned int index);
+
+/*
+ * Remove the latest word from the current share, returns true if there was at least one to
+ * remove, else false (there was no word)
+ */
+bool slip39_shares_word_remove(void);
+
+/*
+ * Check if the stored shares reach the group threshold
+ */
+bool slip39_shares_complete_check(void);
+
+/*
+ * Combine the stored shares, and if they are consistent start the decryption of their master
+ * secret, to be compared with the current device's seed once complete (see slip39_shares_step)
+ */
+bool slip39_shares_check(void);
+
+/*
+ * Whether the master secret is being encrypted or decrypted
+ */
+bool slip39_shares_pending(void);
+
+/*
+ * Run SLIP39_SHARES_ROUNDS_PER_STEP PBKDF2 rounds of the pending encryption or decryption,
+ * returns its progress (%)
+ */
+uint8_t slip39_shares_step(void);
+
+/*
+ * Once decrypted, start the comparison of the master secret as BIP39 entropy with the current
+ * device's seed (see compare_recovery_phrase_step)
+ */
+bool slip39_shares_decrypt_finish(void);
+
+/*
+ * Returns the decrypted master secret, and its length
+ */
+const uint8_t* slip39_shares_secret_get(size_t* length);
+
+/*
+ * Sets the number of SLIP-39 shares to generate
+ */
+void slip39_sharenum_set(const uint8_t sharenum);
+
+/*
+ * Returns the number of SLIP-39 shares to generate
+ */
+uint8_t slip39_sharenum_get(void);
+
+/*
+ * Sets the SLIP-39 threshold
+ */
+void slip39_threshold_set(const uint8_t threshold);
+
+/*
+ * Returns the SLIP-39 threshold
+ */
+uint8_t slip39_threshold_get(void);
+
+/*
+ * Start the encryption of the BIP39 entropy under a new random identifier, returns false if it is
+ * not 128, 192 or 256 bits long
+ */
+bool slip39_shares_generate_start(const unsigned char* entropy, const size_t word_count);
+
+/*
+ * Once encrypted, split the master secret in a single group of slip39_sharenum_get() shares,
+ * returns false if the split failed
+ */
+bool slip39_shares_generate_finish(void);
+
+/*
+ * Returns the SLIP-39 share count
+ */
+uint8_t slip39_sharecount_get(void);
+
+/*
+ * Writes the share at the given index as text in the buffer, returns its length (0 if it does not
+ * fit)
+ */
+size_t slip39_share_text_get(const uint8_t index, char* buffer, const size_t size);
+
+#endif  // SCREEN_SIZE_WALLET
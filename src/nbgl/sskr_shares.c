@@ -20,6 +20,8 @@
 
 #include "../common/common.h"
 #include "../common/sskr/common_sskr.h"
+#include "../common/bip39/common_bip39.h"
+#include "../common/bip85.h"
 #include "./sskr_shares.h"
 #include "./bip39_mnemonic.h"
 
@@ -135,16 +137,15 @@ void sskr_shares_reset(void) {
     shares.current_share_index = (uint8_t) -1;
 }
 
-void sskr_shares_from_bip39_mnemonic(void) {
+static void sskr_shares_from_bip39_entropy(const unsigned char* entropy, const size_t word_count) {
     shares.length = 0;
 
-    bolos_ux_bip39_to_sskr_convert((unsigned char*) bip39_mnemonic_get(),
-                                   bip39_mnemonic_length_get(),
-                                   bip39_mnemonic_final_size_get(),
-                                   shares.group_descriptor[0],
-                                   &shares.count,
-                                   (unsigned char*) shares.buffer,
-                                   &shares.length);
+    bolos_ux_bip39_entropy_to_sskr_convert(entropy,
+                                           word_count,
+                                           shares.group_descriptor[0],
+                                           &shares.count,
+                                           (unsigned char*) shares.buffer,
+                                           &shares.length);
 
     if (shares.count > 0) {
         PRINTF("SSKR share count is %d\n", shares.count);
@@ -158,6 +159,21 @@ void sskr_shares_from_bip39_mnemonic(void) {
     }
 }
 
+void sskr_shares_from_bip39_mnemonic(void) {
+    sskr_shares_from_bip39_entropy(bip39_mnemonic_entropy_get(), bip39_mnemonic_final_size_get());
+}
+
+bool sskr_shares_from_bip85_child(const size_t word_count, const uint32_t index) {
+    unsigned char entropy[BIP39_ENTROPY_MAX_LENGTH];
+
+    shares.count = 0;
+    if (bip85_bip39_entropy(word_count, index, entropy)) {
+        sskr_shares_from_bip39_entropy(entropy, word_count);
+    }
+    memzero(entropy, sizeof(entropy));
+    return shares.count > 0;
+}
+
 bool sskr_shares_complete_check(void) {
     // We won't know final size until after word 5
     if (sskr_shares_current_word_number_get() < 5 ||
@@ -175,8 +191,7 @@ bool sskr_shares_complete_check(void) {
     return true;
 }
 
-bool sskr_shares_check(bool* match) {
-    *match = false;
+bool sskr_shares_check(void) {
     if (!sskr_shares_complete_check()) {
         return false;
     }
@@ -193,7 +208,10 @@ bool sskr_shares_check(bool* match) {
         return false;
     }
 
-    *match = compare_recovery_phrase();
+    // the comparison itself is run from the ticker, see compare_recovery_phrase_step
+    if (!compare_recovery_phrase_start()) {
+        return false;
+    }
     // Don't clear the shares just yet as we may need it to generate BIP39 mnemonic
     //    sskr_shares_reset();
 
@@ -207,4 +225,26 @@ char* sskr_shares_get(void) {
 size_t sskr_shares_length_get(void) {
     return shares.length;
 }
+
+size_t sskr_shares_share_cbor_get(const uint8_t index, uint8_t* cbor, const size_t size) {
+    // 3 bytes of CBOR tag + CBOR byte string + 4 bytes of CRC checksum, as space separated words
+    const size_t tag_length = 3;
+    const size_t checksum_length = sizeof(uint32_t);
+
+    if (index >= shares.count) {
+        return 0;
+    }
+    const size_t share_length = shares.length / shares.count;
+    const char* const share = shares.buffer + index * share_length;
+    const size_t words = (share_length + 1) / (SSKR_BYTEWORD_LENGTH + 1);
+
+    if (words < tag_length + checksum_length || words - tag_length - checksum_length > size) {
+        return 0;
+    }
+    for (size_t i = tag_length; i < words - checksum_length; i++) {
+        cbor[i - tag_length] =
+            bolos_ux_sskr_byteword_to_hex((unsigned char*) share + i * (SSKR_BYTEWORD_LENGTH + 1));
+    }
+    return words - tag_length - checksum_length;
+}
 #endif
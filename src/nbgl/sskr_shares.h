@@ -23,6 +23,8 @@
 
 // 16 shares * 229 chars per share (46 SSKR ByteWords)
 #define SSKR_SHARES_MAX_LENGTH 3664
+// 2 bytes of CBOR header + 5 bytes of metadata + 32 bytes of share
+#define SSKR_SHARE_CBOR_MAX_LENGTH 39
 
 /*
  * Remove the latest word from the shares, returns true if there was at least one to remove,
@@ -46,9 +48,10 @@ size_t sskr_shares_current_word_number_get(void);
 bool sskr_shares_complete_check(void);
 
 /*
- * Check if the currently stored mnemonic generates the same seed as the current device's one
+ * Check if the currently stored shares are valid, and if so start their comparison with the
+ * current device's seed (see compare_recovery_phrase_step)
  */
-bool sskr_shares_check(bool* match);
+bool sskr_shares_check(void);
 
 /*
  * Sets the number of SSKR shares
@@ -90,6 +93,12 @@ void sskr_shares_reset(void);
  */
 void sskr_shares_from_bip39_mnemonic(void);
 
+/*
+ * Generate SSKR shares from the BIP39 phrase of a BIP85 child, its entropy being split as derived
+ * (the phrase never exists as text), returns false if the derivation or the split failed
+ */
+bool sskr_shares_from_bip85_child(const size_t word_count, const uint32_t index);
+
 /*
  * Returns the generated SSKR shares
  */
@@ -100,4 +109,11 @@ char* sskr_shares_get(void);
  */
 size_t sskr_shares_length_get(void);
 
+/*
+ * Writes the CBOR byte string of a generated share, read back from its ByteWords without their
+ * CBOR tag and CRC-32 checksum (the payload of its ur:sskr UR), returns its length (0 if there is
+ * no such share or it does not fit)
+ */
+size_t sskr_shares_share_cbor_get(const uint8_t index, uint8_t* cbor, const size_t size);
+
 #endif  // SCREEN_SIZE_WALLET
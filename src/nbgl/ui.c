@@ -30,11 +30,18 @@
 #include <nbgl_page.h>
 #include <nbgl_layout.h>
 
+#include "../common/common.h"
 #include "../common/bip39/common_bip39.h"
 #include "../common/sskr/common_sskr.h"
+#include "../common/slip39/common_slip39.h"
+#include "../common/bip85.h"
 #include "../ui.h"
 #include "./bip39_mnemonic.h"
 #include "./sskr_shares.h"
+#include "./slip39_shares.h"
+#include "./codex32_shares.h"
+#include "./qrcode_screen.h"
+#include "../common/ur/ur.h"
 #include "./layout_generic_screen.h"
 
 #define HEADER_SIZE 50
@@ -48,29 +55,52 @@ unsigned int onboarding_type;
 
 static void display_home_page(void);
 static void display_check_keyboard_page(void);
+static void display_check_progress_page(void);
 static void display_check_result_page(const bool result);
+static void display_search_result_page(void);
 static void display_bip39_select_phrase_length_page(void);
+static void display_bip39_select_wordlist_page(void);
 static void display_bip39_mnemonic(void);
 static void display_sskr_select_numshares_page(void);
 static void display_sskr_select_threshold_page(void);
+static void display_select_shares_kind_page(void);
+static void display_slip39_select_numshares_page(void);
+static void display_slip39_select_threshold_page(void);
+static void display_codex32_keyboard_page(void);
+static void display_bip85_select_application_page(void);
+static void display_bip85_select_index_page(void);
 
 /*
  * Utils
  */
 static const char *buttonTexts[NB_MAX_SUGGESTION_BUTTONS] = {0};
+// word committed as soon as the entered letters identified it, reported in the header of the next
+// word, whose back button undoes it (BIP39_WORDLIST_COUNT if none)
+static unsigned int auto_committed_word = BIP39_WORDLIST_COUNT;
+// BIP85 application and its length parameter (words, bytes or characters) of the generated children
+static uint32_t bip85_application;
+static uint32_t bip85_length;
 
 static void reset_globals() {
+    compare_recovery_phrase_cancel();
+    phrase_search_cancel();
+    auto_committed_word = BIP39_WORDLIST_COUNT;
+    bolos_ux_bip39_final_word_filter_set(NULL, 0);
+    bolos_ux_bip39_wordlist_set(BIP39_LANGUAGE_ENGLISH);
     bip39_mnemonic_reset();
     sskr_shares_reset();
+    slip39_shares_reset();
+    codex32_shares_reset();
     memzero(buttonTexts, sizeof(buttonTexts[0]) * NB_MAX_SUGGESTION_BUTTONS);
 }
 
 static void on_quit(void) {
+    device_root_key_clear();
     os_sched_exit(-1);
 }
 
 /*
- * Select tool type, BIP39 or SSKR
+ * Select tool type, BIP39 or Shamir's secret shares (SSKR, SLIP-39 or codex32)
  */
 enum select_tool {
     SELECT_TOOL_ICON_INDEX = 0,
@@ -84,7 +114,16 @@ enum select_tool {
 
 #define SELECT_TOOL_NB_BUTTONS 3
 
-static const char *toolType[] = {"BIP39 Check", "SSKR Check", "BIP85 Generate"};
+// checks run back to back since the tool was selected from the home page: once dismissed, a
+// result leads to the selection of the next check, which reports the tally
+static struct {
+    unsigned int checked;
+    unsigned int matched;
+    // whether the phrase of the displayed result has been compared to the device's seed
+    bool compared;
+} check_tally;
+
+static const char *toolType[] = {"BIP39 Check", "Shamir Check", "BIP85 Generate"};
 static void select_tool_callback(nbgl_obj_t *obj, nbgl_touchType_t eventType) {
     nbgl_obj_t **screenChildren = nbgl_screenGetElements(0);
     if (eventType != TOUCHED) {
@@ -97,19 +136,21 @@ static void select_tool_callback(nbgl_obj_t *obj, nbgl_touchType_t eventType) {
         display_bip39_select_phrase_length_page();
     } else if (obj == screenChildren[SELECT_TOOL_SSKR_INDEX]) {
         nbgl_layoutRelease(layout);
-        onboarding_type = ONBOARDING_TYPE_SSKR;
-        display_check_keyboard_page();
+        display_select_shares_kind_page();
     } else if (obj == screenChildren[SELECT_TOOL_BIP85_INDEX]) {
         nbgl_layoutRelease(layout);
-        nbgl_useCaseStatus("Under Construction\nComing soon", false, display_home_page);
+        onboarding_type = ONBOARDING_TYPE_BIP85;
+        display_bip85_select_application_page();
     } else if (obj == screenChildren[SELECT_TOOL_BACK_BUTTON_INDEX]) {
         nbgl_layoutRelease(layout);
+        memzero(&check_tally, sizeof(check_tally));
         display_home_page();
         return;
     }
 }
 
 static void display_select_tool_page(void) {
+    static char select_tool_text[64];
     nbgl_obj_t **screenChildren;
 
     // From top to bottom:
@@ -123,8 +164,18 @@ static void display_select_tool_page(void) {
         (nbgl_obj_t *) generic_screen_set_icon(&C_seed_stax_64px);
     screenChildren[SELECT_TOOL_TEXT_INDEX] =
         (nbgl_obj_t *) generic_screen_set_title(screenChildren[SELECT_TOOL_ICON_INDEX]);
-    ((nbgl_text_area_t *) screenChildren[SELECT_TOOL_TEXT_INDEX])->text =
-        "\n\nSelect the tool\nyou wish to use";
+    if (check_tally.checked == 0) {
+        snprintf(select_tool_text,
+                 sizeof(select_tool_text),
+                 "\n\nSelect the tool\nyou wish to use");
+    } else {
+        snprintf(select_tool_text,
+                 sizeof(select_tool_text),
+                 "\n%d checked, %d matching\n\nSelect the next check",
+                 check_tally.checked,
+                 check_tally.matched);
+    }
+    ((nbgl_text_area_t *) screenChildren[SELECT_TOOL_TEXT_INDEX])->text = select_tool_text;
     // create nb words buttons
     nbgl_objPoolGetArray(BUTTON,
                          SELECT_TOOL_NB_BUTTONS,
@@ -162,22 +213,31 @@ static void select_recover_bip39_choice(bool bip39_rec) {
 }
 
 void display_select_recover_bip39_page(void) {
-    nbgl_useCaseChoice(
-        &C_bip39_stax_64px,
-        "Recover BIP39 Phrase?",
-        "Choose if you wish to\nrecover the BIP39 phrase\nfrom your valid\nSSKR shares.",
-        "Recover BIP39",
-        "Done",
-        select_recover_bip39_choice);
+    nbgl_useCaseChoice(&C_bip39_stax_64px,
+                       "Recover BIP39 Phrase?",
+                       onboarding_type == ONBOARDING_TYPE_SLIP39
+                           ? "Choose if you wish to\nrecover the BIP39 phrase\nfrom your valid\n"
+                             "BIP39-entropy\nSLIP-39 shares."
+                           : "Choose if you wish to\nrecover the BIP39 phrase\nfrom your valid\n"
+                             "SSKR shares.",
+                       "Recover BIP39",
+                       "Done",
+                       select_recover_bip39_choice);
 }
 
 /*
  * Select Generate SSKR
  */
+static void display_select_generate_slip39_page(void);
+
 static void select_generate_sskr_choice(bool sskr_gen) {
     if (sskr_gen) {
         nbgl_layoutRelease(layout);
         display_sskr_select_numshares_page();
+    } else if (onboarding_type == ONBOARDING_TYPE_BIP39) {
+        // SLIP-39 shares are offered next
+        nbgl_layoutRelease(layout);
+        display_select_generate_slip39_page();
     } else {
         nbgl_layoutRelease(layout);
         display_home_page();
@@ -193,6 +253,162 @@ void display_select_generate_sskr_page(void) {
                        select_generate_sskr_choice);
 }
 
+/*
+ * Select Generate BIP39-entropy SLIP-39 shares, once warned that they hold the entropy of the BIP39
+ * phrase: a SLIP-39 wallet takes it as the BIP32 seed, restoring another wallet than the phrase's
+ */
+static void slip39_warning_choice(bool understood) {
+    if (understood) {
+        display_slip39_select_numshares_page();
+    } else {
+        display_home_page();
+    }
+}
+
+static void display_slip39_warning_page(void) {
+    nbgl_useCaseChoice(&C_Important_Circle_64px,
+                       "Not a SLIP-39 wallet",
+                       "The shares hold your BIP39\nphrase, which only this app\nrecovers: SLIP-39\n"
+                       "wallets restore a different\nwallet from them.",
+                       "I understand",
+                       "Cancel",
+                       slip39_warning_choice);
+}
+
+static void select_generate_slip39_choice(bool slip39_gen) {
+    if (slip39_gen) {
+        display_slip39_warning_page();
+    } else {
+        display_home_page();
+    }
+}
+
+static void display_select_generate_slip39_page(void) {
+    nbgl_useCaseChoice(&C_sskr_stax_64px,
+                       "Generate BIP39-entropy\nSLIP-39 Shares?",
+                       "Choose if you wish to\ngenerate BIP39-entropy\nSLIP-39 shares from your\n"
+                       "valid BIP39 phrase.",
+                       "Generate shares",
+                       "Done",
+                       select_generate_slip39_choice);
+}
+
+/*
+ * Select the kind of Shamir's secret shares to check, and the length of SLIP-39 shares: they are
+ * read as this app generates them, their master secret being the BIP39 entropy
+ */
+enum slip39_length_token {
+    SLIP39_LENGTH_BACK_BUTTON_TOKEN = FIRST_USER_TOKEN,
+    SLIP39_LENGTH_FIRST_TOKEN,
+};
+
+static const struct {
+    const char *name;
+    uint8_t words;
+} slip39_lengths[] = {
+    // shares of the entropy of 12, 18 and 24-word phrases
+    {"20 words", SLIP39_WORDS(16)},
+    {"27 words", SLIP39_WORDS(24)},
+    {"33 words", SLIP39_WORDS(32)},
+};
+
+static void display_select_other_shares_kind_page(void);
+
+static void slip39_length_dispatcher(const int token, uint8_t index) {
+    UNUSED(index);
+    nbgl_layoutRelease(layout);
+    if (token == SLIP39_LENGTH_BACK_BUTTON_TOKEN) {
+        display_select_other_shares_kind_page();
+        return;
+    }
+    onboarding_type = ONBOARDING_TYPE_SLIP39;
+    slip39_shares_start(slip39_lengths[token - SLIP39_LENGTH_FIRST_TOKEN].words);
+    display_check_keyboard_page();
+}
+
+static void display_select_slip39_length_page(void) {
+    nbgl_layoutDescription_t layoutDescription = {.modal = false,
+                                                  .onActionCallback = &slip39_length_dispatcher};
+    nbgl_layoutHeader_t headerDesc = {.type = HEADER_BACK_AND_TEXT,
+                                      .separationLine = true,
+                                      .backAndText.token = SLIP39_LENGTH_BACK_BUTTON_TOKEN,
+                                      .backAndText.tuneId = TUNE_TAP_CASUAL,
+                                      .backAndText.text = "BIP39-entropy SLIP-39"};
+
+    layout = nbgl_layoutGet(&layoutDescription);
+    nbgl_layoutAddHeader(layout, &headerDesc);
+    for (size_t i = 0; i < ARRAYLEN(slip39_lengths); i++) {
+        nbgl_layoutBar_t bar = {.text = PIC(slip39_lengths[i].name),
+                                .subText = NULL,
+                                .iconLeft = NULL,
+                                .iconRight = &PUSH_ICON,
+                                .token = SLIP39_LENGTH_FIRST_TOKEN + i,
+                                .centered = false,
+                                .inactive = false,
+                                .tuneId = TUNE_TAP_CASUAL};
+        nbgl_layoutAddTouchableBar(layout, &bar);
+        nbgl_layoutAddSeparationLine(layout);
+    }
+    nbgl_layoutDraw(layout);
+    nbgl_refresh();
+}
+
+static void select_other_shares_kind_choice(bool slip39) {
+    if (slip39) {
+        display_select_slip39_length_page();
+    } else {
+        // only 512-bit codex32 secrets can be the seed of the device
+        onboarding_type = ONBOARDING_TYPE_CODEX32;
+        codex32_shares_start(CODEX32_MAX_SECRET_SIZE);
+        display_codex32_keyboard_page();
+    }
+}
+
+static void display_select_other_shares_kind_page(void) {
+    nbgl_useCaseChoice(&C_sskr_stax_64px,
+                       "Shamir Check",
+                       "Shares generated by\nthis app, or codex32\nshares of a 512-bit seed?",
+                       "BIP39-entropy SLIP-39",
+                       "codex32, 512 bits",
+                       select_other_shares_kind_choice);
+}
+
+static void select_shares_kind_choice(bool sskr) {
+    if (sskr) {
+        onboarding_type = ONBOARDING_TYPE_SSKR;
+        display_check_keyboard_page();
+    } else {
+        display_select_other_shares_kind_page();
+    }
+}
+
+static void display_select_shares_kind_page(void) {
+    nbgl_useCaseChoice(&C_sskr_stax_64px,
+                       "Shamir Check",
+                       "Which kind of\nShamir's secret shares\ndo you wish to check?",
+                       "SSKR shares",
+                       "Other shares",
+                       select_shares_kind_choice);
+}
+
+/*
+ * Select the wordlist of the BIP39 phrase to check: the words are typed and displayed without
+ * their accents, which are only restored for the seed derivation
+ */
+static void select_bip39_wordlist_choice(bool english) {
+    bolos_ux_bip39_wordlist_set(english ? BIP39_LANGUAGE_ENGLISH : BIP39_LANGUAGE_FRENCH);
+    display_check_keyboard_page();
+}
+
+static void display_bip39_select_wordlist_page(void) {
+    nbgl_useCaseChoice(&C_bip39_stax_64px,
+                       "BIP39 wordlist",
+                       "Choose the language of\nthe words written on your\nRecovery Sheet.",
+                       "English",
+                       "French",
+                       select_bip39_wordlist_choice);
+}
+
 /*
  * Select mnemonic size page
  */
@@ -224,11 +440,20 @@ static void select_bip39_phrase_length_callback(nbgl_obj_t *obj, nbgl_touchType_
         bip39_mnemonic_final_size_set(BIP39_MNEMONIC_SIZE_24);
     } else if (obj == screenChildren[SELECT_BIP39_PHRASE_LENGTH_BACK_BUTTON_INDEX]) {
         nbgl_layoutRelease(layout);
-        display_select_tool_page();
+        if (onboarding_type == ONBOARDING_TYPE_BIP85) {
+            display_bip85_select_application_page();
+        } else {
+            display_select_tool_page();
+        }
         return;
     }
     nbgl_layoutRelease(layout);
-    display_check_keyboard_page();
+    if (onboarding_type == ONBOARDING_TYPE_BIP85) {
+        bip85_length = bip39_mnemonic_final_size_get();
+        display_bip85_select_index_page();
+    } else {
+        display_bip39_select_wordlist_page();
+    }
 }
 
 static void display_bip39_select_phrase_length_page(void) {
@@ -246,7 +471,8 @@ static void display_bip39_select_phrase_length_page(void) {
     screenChildren[SELECT_BIP39_PHRASE_LENGTH_TEXT_INDEX] = (nbgl_obj_t *) generic_screen_set_title(
         screenChildren[SELECT_BIP39_PHRASE_LENGTH_ICON_INDEX]);
     ((nbgl_text_area_t *) screenChildren[SELECT_BIP39_PHRASE_LENGTH_TEXT_INDEX])->text =
-        "\nHow long is your\nBIP39 Recovery\nPhrase?";
+        onboarding_type == ONBOARDING_TYPE_BIP85 ? "\nHow long are the\nBIP85 child\nphrases?"
+                                                 : "\nHow long is your\nBIP39 Recovery\nPhrase?";
 
     // create nb words buttons
     nbgl_objPoolGetArray(
@@ -286,15 +512,41 @@ enum check {
     CHECK_BACK_BUTTON_TOKEN = FIRST_USER_TOKEN,
     CHECK_FIRST_SUGGESTION_TOKEN,
     CHECK_RESULT_TOKEN,
+    CHECK_CANCEL_TOKEN,
+    CHECK_REPAIR_TOKEN,
 };
 
 static char textToEnter[BIP39_MAX_WORD_LENGTH + 1] = {0};
 static int keyboardIndex = 0;
 static bool seed_match = false;
+static bool seed_valid = false;
 // the biggest word of BIP39 list is 8 char (9 with trailing '\0'), and
 // the max number of showed suggestions is NB_MAX_SUGGESTION_BUTTONS
 static char wordCandidates[(BIP39_MAX_WORD_LENGTH + 1) * NB_MAX_SUGGESTION_BUTTONS] = {0};
 
+// before any letter is entered, a BIP39 word can be marked as unknown (a single one per phrase),
+// to be searched for once all the others are entered
+#define UNKNOWN_WORD_TEXT "Unknown"
+
+// number of the word being entered in the phrase or the share
+static size_t keyboard_word_number_get(void) {
+    if (onboarding_type == ONBOARDING_TYPE_BIP39) {
+        return bip39_mnemonic_current_word_number_get() + 1;
+    } else if (onboarding_type == ONBOARDING_TYPE_SLIP39) {
+        return slip39_shares_current_word_number_get() + 1;
+    }
+    return sskr_shares_current_word_number_get() + 1;
+}
+
+static size_t unknown_word_suggestion_set(void) {
+    if (onboarding_type != ONBOARDING_TYPE_BIP39 ||
+        bip39_mnemonic_unknown_word_get() != (size_t) -1) {
+        return 0;
+    }
+    buttonTexts[0] = UNKNOWN_WORD_TEXT;
+    return 1;
+}
+
 /*
  * Function called when a key of keyboard is touched
  */
@@ -313,6 +565,22 @@ static void key_press_callback(const char touchedKey) {
         textToEnter[previousTextLen] = touchedKey;
         textToEnter[previousTextLen + 1] = '\0';
         textLen = previousTextLen + 1;
+
+        // BIP39 words are identified by their first letters, but the final one which is still
+        // confirmed as the phrase is then checked
+        if (onboarding_type == ONBOARDING_TYPE_BIP39 &&
+            bip39_mnemonic_current_word_number_get() + 1 < bip39_mnemonic_final_size_get()) {
+            const unsigned int position =
+                bolos_ux_bip39_get_unique_word_idx_starting_with((unsigned char *) textToEnter,
+                                                                 textLen);
+            if (position < BIP39_WORDLIST_COUNT) {
+                nbgl_layoutRelease(layout);
+                auto_committed_word = bolos_ux_bip39_offered_word_idx(position);
+                bip39_mnemonic_word_add(auto_committed_word);
+                display_check_keyboard_page();
+                return;
+            }
+        }
     }
 
     // Update the screen (written word, suggestions, ...)
@@ -326,9 +594,7 @@ static void key_press_callback(const char touchedKey) {
         .title = PIC(headerText),
         .text = PIC(textToEnter),
         .numbered = true,
-        .number = onboarding_type == ONBOARDING_TYPE_BIP39
-                      ? bip39_mnemonic_current_word_number_get() + 1
-                      : sskr_shares_current_word_number_get() + 1,
+        .number = keyboard_word_number_get(),
         .grayedOut = false,
         .textToken = KBD_TEXT_TOKEN,
         .suggestionButtons = suggestionButtons,
@@ -336,29 +602,43 @@ static void key_press_callback(const char touchedKey) {
     };
     PRINTF("Current text is: '%s' (size '%d')\n", textToEnter, textLen);
 
-    if (textLen < 2) {
+    if (textLen == 0) {
+        keyboardContent.suggestionButtons.nbUsedButtons = unknown_word_suggestion_set();
+        nbgl_layoutUpdateKeyboardContent(layout, &keyboardContent);
+    } else if (textLen < 2) {
         // Suggestions only when the word contains 2+ letters
         nbgl_layoutUpdateKeyboardContent(layout, &keyboardContent);
     } else {
-        const size_t nbMatchingWords =
-            onboarding_type == ONBOARDING_TYPE_BIP39
-                ? bolos_ux_bip39_fill_with_candidates((unsigned char *) &(textToEnter[0]),
-                                                      strlen(textToEnter),
-                                                      wordCandidates,
-                                                      buttonTexts)
-                : bolos_ux_sskr_fill_with_candidates((unsigned char *) &(textToEnter[0]),
+        size_t nbMatchingWords;
+        if (onboarding_type == ONBOARDING_TYPE_BIP39) {
+            nbMatchingWords = bolos_ux_bip39_fill_with_candidates((unsigned char *) &(textToEnter[0]),
+                                                                  strlen(textToEnter),
+                                                                  wordCandidates,
+                                                                  buttonTexts);
+        } else if (onboarding_type == ONBOARDING_TYPE_SLIP39) {
+            nbMatchingWords =
+                bolos_ux_slip39_fill_with_candidates((unsigned char *) &(textToEnter[0]),
                                                      strlen(textToEnter),
                                                      wordCandidates,
                                                      buttonTexts);
+        } else {
+            nbMatchingWords = bolos_ux_sskr_fill_with_candidates((unsigned char *) &(textToEnter[0]),
+                                                                 strlen(textToEnter),
+                                                                 wordCandidates,
+                                                                 buttonTexts);
+        }
         keyboardContent.suggestionButtons.nbUsedButtons = nbMatchingWords;
         nbgl_layoutUpdateKeyboardContent(layout, &keyboardContent);
     }
-    if (textLen > 0) {
-        mask = onboarding_type == ONBOARDING_TYPE_BIP39
-                   ? bolos_ux_bip39_get_keyboard_mask((unsigned char *) &(textToEnter[0]),
-                                                      strlen(textToEnter))
-                   : bolos_ux_sskr_get_keyboard_mask((unsigned char *) &(textToEnter[0]),
-                                                     strlen(textToEnter));
+    if (textLen > 0 && onboarding_type == ONBOARDING_TYPE_BIP39) {
+        mask = bolos_ux_bip39_get_keyboard_mask((unsigned char *) &(textToEnter[0]),
+                                                strlen(textToEnter));
+    } else if (textLen > 0 && onboarding_type == ONBOARDING_TYPE_SLIP39) {
+        mask = bolos_ux_slip39_get_keyboard_mask((unsigned char *) &(textToEnter[0]),
+                                                 strlen(textToEnter));
+    } else if (textLen > 0) {
+        mask = bolos_ux_sskr_get_keyboard_mask((unsigned char *) &(textToEnter[0]),
+                                               strlen(textToEnter));
     }
     nbgl_layoutDraw(layout);
     nbgl_layoutUpdateKeyboard(layout, keyboardIndex, mask, false, LOWER_CASE);
@@ -369,6 +649,8 @@ static void bip39_keyboard_dispatcher(const int token, uint8_t index) {
     UNUSED(index);
     if (token == CHECK_BACK_BUTTON_TOKEN) {
         nbgl_layoutRelease(layout);
+        // drop what was speculatively derived from the words entered so far
+        compare_recovery_phrase_cancel();
         if (bip39_mnemonic_word_remove()) {
             display_check_keyboard_page();
         } else {
@@ -380,10 +662,23 @@ static void bip39_keyboard_dispatcher(const int token, uint8_t index) {
         PRINTF("Selected word is '%s' (size '%d')\n",
                buttonTexts[token - CHECK_FIRST_SUGGESTION_TOKEN],
                strlen(buttonTexts[token - CHECK_FIRST_SUGGESTION_TOKEN]));
-        bip39_mnemonic_word_add(buttonTexts[token - CHECK_FIRST_SUGGESTION_TOKEN],
-                                strlen(buttonTexts[token - CHECK_FIRST_SUGGESTION_TOKEN]));
+        if (textToEnter[0] == '\0') {
+            // the only suggestion without any letter entered
+            bip39_mnemonic_unknown_word_add();
+        } else {
+            // suggestions are the first offered words matching the entered text
+            bip39_mnemonic_word_add(bolos_ux_bip39_offered_word_idx(
+                bolos_ux_bip39_get_word_idx_starting_with((unsigned char *) &(textToEnter[0]),
+                                                          strlen(textToEnter)) +
+                (token - CHECK_FIRST_SUGGESTION_TOKEN)));
+        }
         if (bip39_mnemonic_complete_check()) {
-            display_check_result_page(bip39_mnemonic_check(&seed_match));
+            seed_match = false;
+            if (bip39_mnemonic_check()) {
+                display_check_progress_page();
+            } else {
+                display_check_result_page(false);
+            }
         } else {
             display_check_keyboard_page();
         }
@@ -398,7 +693,7 @@ static void sskr_keyboard_dispatcher(const int token, uint8_t index) {
             display_check_keyboard_page();
         } else {
             sskr_shares_reset();
-            display_select_tool_page();
+            display_select_shares_kind_page();
         }
     } else if (token >= CHECK_FIRST_SUGGESTION_TOKEN) {
         nbgl_layoutRelease(layout);
@@ -407,18 +702,252 @@ static void sskr_keyboard_dispatcher(const int token, uint8_t index) {
                strlen(buttonTexts[token - CHECK_FIRST_SUGGESTION_TOKEN]));
         sskr_shares_word_add(buttonTexts[token - CHECK_FIRST_SUGGESTION_TOKEN]);
         if (sskr_shares_complete_check()) {
-            display_check_result_page(sskr_shares_check(&seed_match));
+            seed_match = false;
+            if (sskr_shares_check()) {
+                display_check_progress_page();
+            } else {
+                display_check_result_page(false);
+            }
         } else {
             display_check_keyboard_page();
         }
     }
 }
 
+// the entered word is checked at once, as far as the words entered before it allow
+static void slip39_keyboard_dispatcher(const int token, uint8_t index) {
+    UNUSED(index);
+    if (token == CHECK_BACK_BUTTON_TOKEN) {
+        nbgl_layoutRelease(layout);
+        if (slip39_shares_word_remove()) {
+            display_check_keyboard_page();
+        } else {
+            slip39_shares_reset();
+            display_select_shares_kind_page();
+        }
+    } else if (token >= CHECK_FIRST_SUGGESTION_TOKEN) {
+        nbgl_layoutRelease(layout);
+        PRINTF("Selected word is '%s' (size '%d')\n",
+               buttonTexts[token - CHECK_FIRST_SUGGESTION_TOKEN],
+               strlen(buttonTexts[token - CHECK_FIRST_SUGGESTION_TOKEN]));
+        // suggestions are the first words matching the entered text
+        switch (slip39_shares_word_add(
+            bolos_ux_slip39_get_word_idx_starting_with((unsigned char *) &(textToEnter[0]),
+                                                       strlen(textToEnter)) +
+            (token - CHECK_FIRST_SUGGESTION_TOKEN))) {
+            case SLIP39_WORD_ACCEPTED:
+                display_check_keyboard_page();
+                break;
+            case SLIP39_SHARE_COMPLETE:
+                if (!slip39_shares_complete_check()) {
+                    display_check_keyboard_page();
+                    break;
+                }
+                seed_match = false;
+                if (slip39_shares_check()) {
+                    display_check_progress_page();
+                } else {
+                    display_check_result_page(false);
+                }
+                break;
+            case SLIP39_WORD_INVALID_HEADER:
+                nbgl_useCaseStatus("This word makes the share\nheader invalid",
+                                   false,
+                                   display_check_keyboard_page);
+                break;
+            case SLIP39_WORD_MISMATCH:
+                nbgl_useCaseStatus("This share does not belong\nwith the previous ones",
+                                   false,
+                                   display_check_keyboard_page);
+                break;
+            case SLIP39_WORD_INVALID_PADDING:
+                nbgl_useCaseStatus("This word cannot start\nthe share value",
+                                   false,
+                                   display_check_keyboard_page);
+                break;
+            case SLIP39_WORD_INVALID_CHECKSUM:
+            default:
+                nbgl_useCaseStatus("Invalid checksum, a word\nof this share is wrong",
+                                   false,
+                                   display_check_keyboard_page);
+                break;
+        }
+    }
+}
+
+/*
+ * codex32 shares are entered a character at a time, each one being checked at once as far as the
+ * ones entered before it allow, and displayed by groups of 4 characters
+ */
+#define CODEX32_GROUP_LENGTH 4
+
+// the entered text is the group of the latest character
+static void codex32_keyboard_content_set(nbgl_layoutKeyboardContent_t *content) {
+    const size_t length = codex32_shares_current_char_number_get();
+    const size_t group = length == 0 ? 0 : (length - 1) / CODEX32_GROUP_LENGTH;
+
+    textToEnter[codex32_shares_current_text_get(group * CODEX32_GROUP_LENGTH,
+                                                textToEnter,
+                                                CODEX32_GROUP_LENGTH)] = '\0';
+    snprintf(headerText,
+             HEADER_SIZE,
+             "Enter Share %d Character %d/%d\nfollowing its MS1",
+             codex32_shares_current_share_number_get(),
+             MIN(length + 1, codex32_shares_final_size_get()),
+             codex32_shares_final_size_get());
+
+    memzero(content, sizeof(*content));
+    content->type = KEYBOARD_WITH_SUGGESTIONS;
+    content->title = PIC(headerText);
+    content->text = PIC(textToEnter);
+    content->numbered = true;
+    content->number = group + 1;
+    content->grayedOut = false;
+    content->textToken = KBD_TEXT_TOKEN;
+    content->suggestionButtons.buttons = PIC(buttonTexts);
+    content->suggestionButtons.firstButtonToken = CHECK_FIRST_SUGGESTION_TOKEN;
+    content->suggestionButtons.nbUsedButtons = 0;
+    content->tuneId = TUNE_TAP_CASUAL;
+}
+
+static void codex32_share_complete(void) {
+    if (!codex32_shares_complete_check()) {
+        display_codex32_keyboard_page();
+        return;
+    }
+    seed_match = false;
+    if (!codex32_shares_check()) {
+        display_check_result_page(false);
+    } else {
+        // no PBKDF2 rounds to run
+        check_tally.compared = true;
+        seed_match = codex32_shares_master_seed_compare();
+        display_check_result_page(true);
+    }
+}
+
+static void codex32_key_press_callback(const char touchedKey) {
+    const char *error = NULL;
+
+    if (touchedKey == BACKSPACE_KEY) {
+        if (!codex32_shares_char_remove()) {
+            return;
+        }
+    } else {
+        switch (codex32_shares_char_add(touchedKey)) {
+            case CODEX32_CHAR_ACCEPTED:
+                break;
+            case CODEX32_SHARE_COMPLETE:
+                nbgl_layoutRelease(layout);
+                codex32_share_complete();
+                return;
+            case CODEX32_CHAR_INVALID:
+                // '1' of the digits, or a key of another mode
+                return;
+            case CODEX32_CHAR_INVALID_HEADER:
+                error = "This character makes the share\nheader invalid";
+                break;
+            case CODEX32_CHAR_MISMATCH:
+                error = "This share does not belong\nwith the previous ones";
+                break;
+            case CODEX32_CHAR_INVALID_CHECKSUM:
+            default:
+                error = "Invalid checksum, a character\nof this share is wrong";
+                break;
+        }
+    }
+    if (error != NULL) {
+        nbgl_layoutRelease(layout);
+        nbgl_useCaseStatus(error, false, display_codex32_keyboard_page);
+        return;
+    }
+
+    nbgl_layoutKeyboardContent_t keyboardContent;
+    codex32_keyboard_content_set(&keyboardContent);
+    nbgl_layoutUpdateKeyboardContent(layout, &keyboardContent);
+    nbgl_layoutDraw(layout);
+}
+
+static void codex32_keyboard_dispatcher(const int token, uint8_t index) {
+    UNUSED(index);
+    if (token == CHECK_BACK_BUTTON_TOKEN) {
+        nbgl_layoutRelease(layout);
+        if (codex32_shares_char_remove()) {
+            display_codex32_keyboard_page();
+        } else {
+            codex32_shares_reset();
+            display_select_shares_kind_page();
+        }
+    }
+}
+
+static void display_codex32_keyboard_page(void) {
+    nbgl_layoutDescription_t layoutDescription = {.modal = false,
+                                                  .onActionCallback = &codex32_keyboard_dispatcher};
+    nbgl_layoutKbd_t kbdInfo = {.lettersOnly = false,  // with the digits
+                                .mode = MODE_LETTERS,  // start in letters mode
+                                .keyMask = 0,
+                                .callback = &codex32_key_press_callback};
+    nbgl_layoutHeader_t headerDesc = {.type = HEADER_BACK_AND_TEXT,
+                                      .separationLine = false,
+                                      .backAndText.token = CHECK_BACK_BUTTON_TOKEN,
+                                      .backAndText.tuneId = TUNE_TAP_CASUAL,
+                                      .backAndText.text = NULL};
+
+    // the letters which are not bech32 characters are inactive
+    for (size_t i = 0; i < strlen(KBD_LETTERS); i++) {
+        if (codex32_char_value(KBD_LETTERS[i]) < 0) {
+            kbdInfo.keyMask |= 1 << i;
+        }
+    }
+    memzero(buttonTexts, sizeof(buttonTexts[0]) * NB_MAX_SUGGESTION_BUTTONS);
+
+    layout = nbgl_layoutGet(&layoutDescription);
+    nbgl_layoutAddHeader(layout, &headerDesc);
+    keyboardIndex = nbgl_layoutAddKeyboard(layout, &kbdInfo);
+    nbgl_layoutKeyboardContent_t keyboardContent;
+    codex32_keyboard_content_set(&keyboardContent);
+    nbgl_layoutAddKeyboardContent(layout, &keyboardContent);
+    nbgl_layoutDraw(layout);
+}
+
+/*
+ * While the final BIP39 word is entered, the idle time is used to derive the seed of the most
+ * likely candidate, see compare_recovery_phrase_speculate
+ */
+#define CHECK_SPECULATION_TICKER_MS 100
+
+static void check_speculation_ticker_callback(void) {
+    // the first offered word matching the entered text is the likeliest
+    compare_recovery_phrase_speculate(
+        bip39_mnemonic_entropy_get(),
+        bip39_mnemonic_final_size_get(),
+        bolos_ux_bip39_offered_word_idx(bolos_ux_bip39_get_word_idx_starting_with(
+            (unsigned char *) &(textToEnter[0]),
+            strlen(textToEnter))));
+}
+
 static void display_check_keyboard_page() {
-    nbgl_layoutDescription_t layoutDescription = {
-        .modal = false,
-        .onActionCallback = onboarding_type == ONBOARDING_TYPE_BIP39 ? &bip39_keyboard_dispatcher
-                                                                     : &sskr_keyboard_dispatcher};
+    nbgl_layoutDescription_t layoutDescription = {.modal = false,
+                                                  .onActionCallback = &sskr_keyboard_dispatcher};
+    if (onboarding_type == ONBOARDING_TYPE_BIP39) {
+        layoutDescription.onActionCallback = &bip39_keyboard_dispatcher;
+    } else if (onboarding_type == ONBOARDING_TYPE_SLIP39) {
+        layoutDescription.onActionCallback = &slip39_keyboard_dispatcher;
+    }
+    // the final BIP39 word is only picked among the ones giving a valid checksum, which are unknown
+    // if another word is
+    if (onboarding_type == ONBOARDING_TYPE_BIP39 &&
+        bip39_mnemonic_unknown_word_get() == (size_t) -1 &&
+        bip39_mnemonic_current_word_number_get() + 1 == bip39_mnemonic_final_size_get()) {
+        bolos_ux_bip39_final_word_filter_set(bip39_mnemonic_entropy_get(),
+                                             bip39_mnemonic_final_size_get());
+        layoutDescription.ticker.tickerCallback = &check_speculation_ticker_callback;
+        layoutDescription.ticker.tickerValue = CHECK_SPECULATION_TICKER_MS;
+        layoutDescription.ticker.tickerIntervale = CHECK_SPECULATION_TICKER_MS;
+    } else {
+        bolos_ux_bip39_final_word_filter_set(NULL, 0);
+    }
     nbgl_layoutKbd_t kbdInfo = {.lettersOnly = true,   // use only letters
                                 .mode = MODE_LETTERS,  // start in letters mode
                                 .keyMask = 0,          // no inactive key
@@ -426,7 +955,20 @@ static void display_check_keyboard_page() {
     textToEnter[0] = '\0';
     memzero(buttonTexts, sizeof(buttonTexts[0]) * NB_MAX_SUGGESTION_BUTTONS);
     layout = nbgl_layoutGet(&layoutDescription);
-    if (onboarding_type == ONBOARDING_TYPE_BIP39) {
+    if (onboarding_type == ONBOARDING_TYPE_BIP39 && auto_committed_word < BIP39_WORDLIST_COUNT) {
+        unsigned char word[BIP39_MAX_WORD_LENGTH + 1];
+
+        bolos_ux_bip39_idx_strcpy(auto_committed_word, word);
+        snprintf(headerText,
+                 HEADER_SIZE,
+                 "Word n. %d '%s' added\nEnter word n. %d/%d",
+                 bip39_mnemonic_current_word_number_get(),
+                 word,
+                 bip39_mnemonic_current_word_number_get() + 1,
+                 bip39_mnemonic_final_size_get());
+        memzero(word, sizeof(word));
+        auto_committed_word = BIP39_WORDLIST_COUNT;
+    } else if (onboarding_type == ONBOARDING_TYPE_BIP39) {
         snprintf(headerText,
                  HEADER_SIZE,
                  "Enter word n. %d/%d of your\nBIP39 Recovery Phrase",
@@ -438,6 +980,13 @@ static void display_check_keyboard_page() {
                  "Enter Share %d Word %d\nof your Recovery Phrase",
                  sskr_shareindex_get() + 1,
                  sskr_shares_current_word_number_get() + 1);
+    } else if (onboarding_type == ONBOARDING_TYPE_SLIP39) {
+        snprintf(headerText,
+                 HEADER_SIZE,
+                 "Enter Share %d Word %d/%d\nBIP39-entropy SLIP-39",
+                 slip39_shares_current_share_number_get(),
+                 slip39_shares_current_word_number_get() + 1,
+                 slip39_shares_final_size_get());
     }
 
     nbgl_layoutHeader_t headerDesc = {.type = HEADER_BACK_AND_TEXT,
@@ -452,16 +1001,14 @@ static void display_check_keyboard_page() {
     nbgl_layoutSuggestionButtons_t suggestionButtons = {
         .buttons = PIC(buttonTexts),
         .firstButtonToken = CHECK_FIRST_SUGGESTION_TOKEN,
-        .nbUsedButtons = 0,
+        .nbUsedButtons = unknown_word_suggestion_set(),
     };
     nbgl_layoutKeyboardContent_t keyboardContent = {
         .type = KEYBOARD_WITH_SUGGESTIONS,
         .title = PIC(headerText),
         .text = PIC(textToEnter),
         .numbered = true,
-        .number = onboarding_type == ONBOARDING_TYPE_BIP39
-                      ? bip39_mnemonic_current_word_number_get() + 1
-                      : sskr_shares_current_word_number_get() + 1,
+        .number = keyboard_word_number_get(),
         .grayedOut = false,
         .textToken = KBD_TEXT_TOKEN,
         .suggestionButtons = suggestionButtons,
@@ -502,28 +1049,141 @@ static void display_home_page() {
 #define DEVICE "Ledger Flex"
 #endif
 
+/*
+ * Progress page, the PBKDF2 rounds of the comparison (or of the search for the unknown word or
+ * for a repair, or of the decryption of SLIP-39 shares before their comparison) are run a few at
+ * a time from the ticker
+ */
+#define CHECK_PROGRESS_TICKER_MS 100
+
+static uint8_t check_progress = 0;
+
+static void check_progress_ticker_callback(void) {
+    if (slip39_shares_pending()) {
+        const uint8_t progress = slip39_shares_step();
+        if (progress < 100 && progress == check_progress) {
+            return;
+        }
+        nbgl_layoutRelease(layout);
+        if (progress < 100) {
+            check_progress = progress;
+        } else if (slip39_shares_decrypt_finish()) {
+            // the decrypted master secret is then compared as BIP39 entropy
+            check_progress = 0;
+        } else {
+            display_check_result_page(false);
+            return;
+        }
+        display_check_progress_page();
+        return;
+    }
+
+    const bool searching = phrase_search_pending();
+    const uint8_t progress = searching ? phrase_search_step() : compare_recovery_phrase_step();
+
+    if (progress < 100) {
+        // only redraw when the displayed percentage changes
+        if (progress != check_progress) {
+            check_progress = progress;
+            nbgl_layoutRelease(layout);
+            display_check_progress_page();
+        }
+        return;
+    }
+    nbgl_layoutRelease(layout);
+    check_tally.compared = true;
+    if (searching) {
+        seed_match = bip39_mnemonic_search_finish();
+        display_search_result_page();
+        return;
+    }
+    seed_match = compare_recovery_phrase_finish();
+    display_check_result_page(true);
+}
+
+static void check_progress_dispatcher(const int token, uint8_t index) {
+    UNUSED(index);
+    if (token == CHECK_CANCEL_TOKEN) {
+        nbgl_layoutRelease(layout);
+        reset_globals();
+        display_home_page();
+    }
+}
+
+static void display_check_progress_page(void) {
+    nbgl_layoutDescription_t layoutDescription = {
+        .modal = false,
+        .onActionCallback = &check_progress_dispatcher,
+        .ticker.tickerCallback = &check_progress_ticker_callback,
+        .ticker.tickerValue = CHECK_PROGRESS_TICKER_MS,
+        .ticker.tickerIntervale = CHECK_PROGRESS_TICKER_MS};
+    nbgl_layoutProgressBar_t progressBar = {.percentage = check_progress,
+                                            .text = "Checking your\nRecovery Phrase",
+                                            .subText = NULL};
+
+    if (phrase_search_pending()) {
+        progressBar.text = bip39_mnemonic_unknown_word_get() != (size_t) -1
+                               ? "Searching for the\nunknown word"
+                               : "Searching for\na typo";
+    } else if (slip39_shares_pending()) {
+        progressBar.text = "Decrypting your\nBIP39-entropy\nSLIP-39 shares";
+    }
+
+    layout = nbgl_layoutGet(&layoutDescription);
+    nbgl_layoutAddProgressBar(layout, &progressBar);
+    nbgl_layoutAddFooter(layout, "Cancel", CHECK_CANCEL_TOKEN, TUNE_TAP_CASUAL);
+    nbgl_layoutDraw(layout);
+    nbgl_refresh();
+}
+
 /*
  * Result page
  */
-static void check_result_callback(int token __attribute__((unused)),
-                                  uint8_t index __attribute__((unused))) {
-    if (onboarding_type == ONBOARDING_TYPE_BIP39 && bip39_mnemonic_check(&seed_match) &&
-        seed_match) {
+// whether dismissing the result leads to the recovery of the other kind of backup
+static bool check_result_follow_up(void) {
+    return (onboarding_type == ONBOARDING_TYPE_BIP39 && seed_valid && seed_match) ||
+           (onboarding_type == ONBOARDING_TYPE_SSKR && seed_valid) ||
+           (onboarding_type == ONBOARDING_TYPE_SLIP39 && seed_valid);
+}
+
+static void check_result_callback(int token, uint8_t index __attribute__((unused))) {
+    if (token == CHECK_REPAIR_TOKEN) {
+        seed_match = false;
+        if (bip39_mnemonic_repair()) {
+            display_check_progress_page();
+        } else {
+            reset_globals();
+            display_home_page();
+        }
+        return;
+    }
+    // a repaired phrase is only counted once, with the result of its repair
+    if (check_tally.compared) {
+        check_tally.checked++;
+        check_tally.matched += seed_valid && seed_match;
+        check_tally.compared = false;
+    }
+    if (onboarding_type == ONBOARDING_TYPE_BIP39 && seed_valid && seed_match) {
         display_select_generate_sskr_page();
-    } else if (onboarding_type == ONBOARDING_TYPE_SSKR && sskr_shares_check(&seed_match)) {
+    } else if (check_result_follow_up()) {
         display_select_recover_bip39_page();
     } else {
+        // check another backup
         reset_globals();
-        display_home_page();
+        display_select_tool_page();
     }
 }
 
 static void display_check_result_page(const bool result) {
-    static const char *possible_results[2][5] = {
+    static const char *possible_results[2][9] = {
         {"Invalid Secret\nRecovery Phrase",
          "The BIP39 Recovery Phrase\nyou have entered is not valid",
          "",
          "The SSKR Recovery Phrase\nyou have entered is not valid",
+         "",
+         "The BIP39-entropy\nSLIP-39 shares\nyou have entered are not valid",
+         "",
+         "The codex32 shares\nyou have entered are not valid",
          ""},
         {"Valid Secret\nRecovery Phrase",
          "The BIP39 Recovery Phrase\nyou have entered\ndoesn't match the one present\n"
@@ -533,11 +1193,26 @@ static void display_check_result_page(const bool result) {
          "The SSKR Recovery Phrase\nyou have entered\ndoesn't match the one present\n"
          "on this " DEVICE ".",
          "The SSKR Recovery Phrase\nyou have entered\nmatches the one present\n"
+         "on this " DEVICE ".",
+         "The BIP39-entropy\nSLIP-39 shares\nyou have entered\ndon't match the seed present\n"
+         "on this " DEVICE ".",
+         "The BIP39-entropy\nSLIP-39 shares\nyou have entered\nmatch the seed present\n"
+         "on this " DEVICE ".",
+         "The codex32 shares\nyou have entered\ndon't match the seed present\n"
+         "on this " DEVICE ".",
+         "The codex32 shares\nyou have entered\nmatch the seed present\n"
          "on this " DEVICE "."}};
     static const nbgl_icon_details_t *icons[3] = {&C_Denied_Circle_64px,
                                                   &C_Important_Circle_64px,
                                                   &C_Check_Circle_64px};
 
+    check_progress = 0;
+    seed_valid = result;
+    // a typed BIP39 phrase which is invalid or does not match may be a mistyped one
+    const bool repairable = onboarding_type == ONBOARDING_TYPE_BIP39 &&
+                            bip39_mnemonic_unknown_word_get() == (size_t) -1 &&
+                            !(result && seed_match);
+
     nbgl_pageInfoDescription_t info = {
         .centeredInfo.icon = icons[result + seed_match],
         .centeredInfo.text1 = possible_results[result][0],
@@ -545,7 +1220,78 @@ static void display_check_result_page(const bool result) {
         .centeredInfo.text3 = NULL,
         .centeredInfo.style = LARGE_CASE_INFO,
         .centeredInfo.offsetY = -16,
-        .footerText = "Tap to dismiss",
+        .footerText = check_result_follow_up() ? "Tap to dismiss" : "Tap to check another",
+        .footerToken = CHECK_RESULT_TOKEN,
+        .bottomButtonStyle = NO_BUTTON_STYLE,
+        .bottomButtonsToken = CHECK_REPAIR_TOKEN,
+        .tapActionText = NULL,
+        .topRightStyle = NO_BUTTON_STYLE,
+        .actionButtonText = repairable ? "Try to repair" : NULL,
+        .tuneId = TUNE_TAP_CASUAL};
+    pageContext = nbgl_pageDrawInfo(&check_result_callback, NULL, &info);
+    nbgl_refresh();
+}
+
+/*
+ * Search result page, the unknown word completes the phrase (or the repaired phrase is) the
+ * device's one, if found
+ */
+static void display_search_result_page(void) {
+    static char search_result[128];
+    unsigned char word[BIP39_MAX_WORD_LENGTH + 1];
+    const size_t unknown_word = bip39_mnemonic_unknown_word_get();
+    const char *text1 = seed_match ? "Unknown word\nfound" : "Unknown word\nnot found";
+    // the word found, or the first one changed by the repair
+    size_t word_index = unknown_word;
+    bool swapped = false;
+
+    check_progress = 0;
+    seed_valid = seed_match;
+
+    if (unknown_word == (size_t) -1) {
+        text1 = seed_match ? "Recovery Phrase\nrepaired" : "Recovery Phrase\nnot repaired";
+        word_index = bip39_mnemonic_fixed_word_get(&swapped);
+    }
+
+    if (!seed_match && unknown_word == (size_t) -1) {
+        snprintf(search_result,
+                 sizeof(search_result),
+                 "No swap or typo fix makes\nthe BIP39 Recovery Phrase\nmatch the one present\n"
+                 "on this " DEVICE ".");
+    } else if (!seed_match) {
+        snprintf(search_result,
+                 sizeof(search_result),
+                 "No word n. %d completes\nthe BIP39 Recovery Phrase\ninto the one present\n"
+                 "on this " DEVICE ".",
+                 unknown_word + 1);
+    } else if (swapped) {
+        snprintf(search_result,
+                 sizeof(search_result),
+                 "Words n. %d and %d were\nswapped, the BIP39 Recovery\nPhrase then matches the\n"
+                 "one present on this " DEVICE ".",
+                 word_index + 1,
+                 word_index + 2);
+    } else {
+        bolos_ux_bip39_idx_strcpy(
+            bolos_ux_bip39_entropy_word_get(bip39_mnemonic_entropy_get(), word_index),
+            word);
+        snprintf(search_result,
+                 sizeof(search_result),
+                 "Word n. %d is '%s', the\nBIP39 Recovery Phrase then\nmatches the one present\n"
+                 "on this " DEVICE ".",
+                 word_index + 1,
+                 word);
+    }
+    memzero(word, sizeof(word));
+
+    nbgl_pageInfoDescription_t info = {
+        .centeredInfo.icon = seed_match ? &C_Check_Circle_64px : &C_Important_Circle_64px,
+        .centeredInfo.text1 = text1,
+        .centeredInfo.text2 = search_result,
+        .centeredInfo.text3 = NULL,
+        .centeredInfo.style = LARGE_CASE_INFO,
+        .centeredInfo.offsetY = -16,
+        .footerText = check_result_follow_up() ? "Tap to dismiss" : "Tap to check another",
         .footerToken = CHECK_RESULT_TOKEN,
         .bottomButtonStyle = NO_BUTTON_STYLE,
         .tapActionText = NULL,
@@ -598,7 +1344,8 @@ void display_sskr_select_numshares_page() {
 }
 
 char item_buffer[15];
-char value_buffer[(SSKR_SHARES_MAX_LENGTH / 16) + 1];
+// an SSKR share, a SLIP-39 one, or a BIP39 phrase
+char value_buffer[MAX(SSKR_SHARES_MAX_LENGTH / 16, SLIP39_SHARE_TEXT_MAX_LENGTH) + 1];
 
 static void review_done(void) {
     memzero(item_buffer, sizeof(item_buffer));
@@ -608,33 +1355,432 @@ static void review_done(void) {
     display_home_page();
 }
 
+/*
+ * CompactSeedQR of the BIP39 phrase: its entropy bytes, without the checksum bits, as a byte mode
+ * QR code (21x21 for 12 words, 25x25 for 18 and 24 words), encoded straight from the packed
+ * entropy and drawn once, the symbol being erased right after
+ */
+enum {
+    BIP39_MNEMONIC_SEEDQR_TOKEN = FIRST_USER_TOKEN,
+    COMPACT_SEEDQR_BACK_BUTTON_TOKEN,
+};
+
+static void compact_seedqr_dispatcher(const int token, uint8_t index) {
+    UNUSED(index);
+    if (token == COMPACT_SEEDQR_BACK_BUTTON_TOKEN) {
+        nbgl_layoutRelease(layout);
+        display_bip39_mnemonic();
+    }
+}
+
+static void display_compact_seedqr_page(void) {
+    nbgl_layoutDescription_t layoutDescription = {.modal = false,
+                                                  .onActionCallback = &compact_seedqr_dispatcher};
+    nbgl_layoutHeader_t headerDesc = {.type = HEADER_BACK_AND_TEXT,
+                                      .separationLine = true,
+                                      .backAndText.token = COMPACT_SEEDQR_BACK_BUTTON_TOKEN,
+                                      .backAndText.tuneId = TUNE_TAP_CASUAL,
+                                      .backAndText.text = "CompactSeedQR"};
+    static qrcode_t qrcode;
+
+    layout = nbgl_layoutGet(&layoutDescription);
+    nbgl_layoutAddHeader(layout, &headerDesc);
+    nbgl_layoutDraw(layout);
+    if (qrcode_encode_bytes(&qrcode,
+                            bip39_mnemonic_entropy_get(),
+                            bip39_mnemonic_final_size_get() * 4 / 3)) {
+        qrcode_screen_draw(&qrcode,
+                           TOUCHABLE_HEADER_BAR_HEIGHT,
+                           SCREEN_HEIGHT - TOUCHABLE_HEADER_BAR_HEIGHT);
+    }
+    memzero(&qrcode, sizeof(qrcode));
+    nbgl_refresh();
+}
+
+static void bip39_mnemonic_content_callback(int token, uint8_t index, int page) {
+    UNUSED(index);
+    UNUSED(page);
+    if (token == BIP39_MNEMONIC_SEEDQR_TOKEN) {
+        display_compact_seedqr_page();
+    }
+}
+
 static void display_bip39_mnemonic() {
     static nbgl_layoutTagValue_t pairs[1];
-    static const nbgl_content_t content[1] = {
+    static const nbgl_content_t content[2] = {
         {.type = TAG_VALUE_LIST,
          .contentActionCallback = NULL,
          .content.tagValueList.nbPairs = 1,
          .content.tagValueList.nbMaxLinesForValue = 0,
          .content.tagValueList.wrapping = true,
-         .content.tagValueList.pairs = (nbgl_layoutTagValue_t *) pairs}};
+         .content.tagValueList.pairs = (nbgl_layoutTagValue_t *) pairs},
+        {.type = INFO_BUTTON,
+         .contentActionCallback = bip39_mnemonic_content_callback,
+         .content.infoButton.text = "Scan your BIP39 phrase\nas a CompactSeedQR",
+         .content.infoButton.icon = &C_bip39_stax_64px,
+         .content.infoButton.buttonText = "Show CompactSeedQR",
+         .content.infoButton.buttonToken = BIP39_MNEMONIC_SEEDQR_TOKEN,
+         .content.infoButton.tuneId = TUNE_TAP_CASUAL}};
     static const nbgl_genericContents_t genericContent = {.callbackCallNeeded = false,
                                                           .contentsList = content,
-                                                          .nbContents = 1};
+                                                          .nbContents = ARRAYLEN(content)};
 
     SPRINTF(item_buffer, "BIP39 Phrase");
     pairs[0].item = item_buffer;
 
-    strncpy(value_buffer, bip39_mnemonic_get(), bip39_mnemonic_length_get());
     // Ensure null termination
-    value_buffer[bip39_mnemonic_length_get()] = '\0';
+    value_buffer[bip39_mnemonic_text_get(value_buffer, sizeof(value_buffer) - 1)] = '\0';
     pairs[0].value = value_buffer;
 
     nbgl_useCaseGenericReview(&genericContent, "Done", review_done);
 }
 
+/*
+ * BIP85 children, reviewed a page per child from the selected index on
+ */
+#define BIP85_INDEX_MAX_DIGITS       10
+#define BIP85_CHILDREN_PER_REVIEW    10
+#define BIP85_CHILD_ITEM_BUFFER_SIZE 32
+
+enum bip85_token {
+    BIP85_BACK_BUTTON_TOKEN = FIRST_USER_TOKEN,
+    BIP85_FIRST_APPLICATION_TOKEN,
+};
+
+static const struct {
+    uint32_t application;
+    const char *name;
+    // unit and bounds of the length parameter, asked for unless the unit is NULL (the BIP39
+    // phrase length being selected as for the checks)
+    const char *unit;
+    uint8_t length_min;
+    uint8_t length_max;
+} bip85_applications[] = {
+    {BIP85_APPLICATION_BIP39, "BIP39 phrase", NULL, 0, 0},
+    {BIP85_APPLICATION_HEX, "Hex entropy", "bytes", BIP85_HEX_LENGTH_MIN, BIP85_HEX_LENGTH_MAX},
+    {BIP85_APPLICATION_PWD_BASE64,
+     "Base64 password",
+     "characters",
+     BIP85_PWD_BASE64_LENGTH_MIN,
+     BIP85_PWD_BASE64_LENGTH_MAX},
+    {BIP85_APPLICATION_PWD_BASE85,
+     "Base85 password",
+     "characters",
+     BIP85_PWD_BASE85_LENGTH_MIN,
+     BIP85_PWD_BASE85_LENGTH_MAX},
+    {BIP85_APPLICATION_XPRV, "XPRV", NULL, 0, 0},
+};
+
+static uint32_t bip85_first_index;
+// entry of bip85_applications of the selected application
+static size_t bip85_application_entry;
+
+static void review_bip85_children_contentGetter(uint8_t index, nbgl_content_t *genericreview) {
+    static nbgl_layoutTagValue_t pairs[1];
+    static char child_item_buffer[BIP85_CHILD_ITEM_BUFFER_SIZE];
+
+    genericreview->type = TAG_VALUE_LIST;
+    genericreview->contentActionCallback = NULL;
+    genericreview->content.tagValueList.nbPairs = 1;
+    genericreview->content.tagValueList.nbMaxLinesForValue = 0;
+    genericreview->content.tagValueList.wrapping = true;
+    genericreview->content.tagValueList.pairs = (nbgl_layoutTagValue_t *) pairs;
+
+    SPRINTF(child_item_buffer,
+            "%s #%u",
+            (const char *) PIC(bip85_applications[bip85_application_entry].name),
+            bip85_first_index + index);
+    pairs[0].item = child_item_buffer;
+
+    // the node of the path is cached, each child costs a single derivation step, its text being
+    // encoded straight into the displayed buffer
+    if (bip85_text(bip85_application,
+                   bip85_length,
+                   bip85_first_index + index,
+                   value_buffer,
+                   sizeof(value_buffer)) == 0) {
+        SPRINTF(value_buffer, "Derivation failed");
+    }
+    pairs[0].value = value_buffer;
+}
+
+static void display_bip85_children(void) {
+    static nbgl_genericContents_t genericContent;
+    genericContent.callbackCallNeeded = true;
+    genericContent.contentGetterCallback = review_bip85_children_contentGetter;
+    // the last page is the child at the largest index
+    genericContent.nbContents =
+        MIN(BIP85_CHILDREN_PER_REVIEW, BIP85_INDEX_MAX - bip85_first_index + 1);
+
+    nbgl_useCaseGenericReview(&genericContent, "Done", review_done);
+}
+
+// the shares of a child are generated from its derived entropy, without encoding its phrase
+static void select_bip85_sskr_choice(bool sskr_gen) {
+    if (sskr_gen) {
+        display_sskr_select_numshares_page();
+    } else {
+        display_bip85_children();
+    }
+}
+
+static void display_bip85_select_sskr_page(void) {
+    static char title[BIP85_CHILD_ITEM_BUFFER_SIZE];
+
+    SPRINTF(title, "BIP85 Child #%u", bip85_first_index);
+    nbgl_useCaseChoice(&C_sskr_stax_64px,
+                       title,
+                       "Choose if you wish to\ngenerate SSKR shares from\nthe BIP39 phrase of\n"
+                       "this child.",
+                       "Generate SSKR",
+                       "Display phrases",
+                       select_bip85_sskr_choice);
+}
+
+static void bip85_index_validate(const uint8_t *indexentry, uint8_t length) {
+    uint64_t index = 0;
+
+    for (uint8_t i = 0; i < length; i++) {
+        index = 10 * index + indexentry[i] - '0';
+    }
+
+    PRINTF("BIP85 index entered is '%u'\n", (uint32_t) index);
+
+    if (index > BIP85_INDEX_MAX) {
+        nbgl_useCaseStatus("BIP85 index cannot be greater than 2147483647",
+                           false,
+                           display_bip85_select_index_page);
+    } else if (bip85_application == BIP85_APPLICATION_BIP39) {
+        bip85_first_index = index;
+        display_bip85_select_sskr_page();
+    } else {
+        bip85_first_index = index;
+        display_bip85_children();
+    }
+}
+
+static void display_bip85_select_index_page(void) {
+    // Draw the keypad
+    nbgl_useCaseKeypad("Enter index of the\nfirst BIP85 child",
+                       1,
+                       BIP85_INDEX_MAX_DIGITS,
+                       false,
+                       false,
+                       bip85_index_validate,
+                       display_bip85_select_application_page);
+}
+
+static void display_bip85_select_length_page(void);
+
+static void bip85_length_validate(const uint8_t *lengthentry, uint8_t length) {
+    bip85_length = 0;
+    for (uint8_t i = 0; i < length; i++) {
+        bip85_length = 10 * bip85_length + lengthentry[i] - '0';
+    }
+
+    PRINTF("BIP85 length entered is '%u'\n", bip85_length);
+
+    if (bip85_length_check(bip85_application, bip85_length)) {
+        display_bip85_select_index_page();
+    } else {
+        nbgl_useCaseStatus("Length out of range", false, display_bip85_select_length_page);
+    }
+}
+
+static void display_bip85_select_length_page(void) {
+    static char title[48];
+
+    SPRINTF(title,
+            "Enter number of %s\n(%d - %d)",
+            (const char *) PIC(bip85_applications[bip85_application_entry].unit),
+            bip85_applications[bip85_application_entry].length_min,
+            bip85_applications[bip85_application_entry].length_max);
+    // Draw the keypad
+    nbgl_useCaseKeypad(title,
+                       1,
+                       MAX_NUMBER_LENGTH,
+                       false,
+                       false,
+                       bip85_length_validate,
+                       display_bip85_select_application_page);
+}
+
+static void bip85_application_dispatcher(const int token, uint8_t index) {
+    UNUSED(index);
+    nbgl_layoutRelease(layout);
+    if (token == BIP85_BACK_BUTTON_TOKEN) {
+        display_select_tool_page();
+        return;
+    }
+    bip85_application_entry = token - BIP85_FIRST_APPLICATION_TOKEN;
+    bip85_application = bip85_applications[bip85_application_entry].application;
+    bip85_length = 0;
+    if (bip85_application == BIP85_APPLICATION_BIP39) {
+        display_bip39_select_phrase_length_page();
+    } else if (bip85_applications[bip85_application_entry].unit == NULL) {
+        display_bip85_select_index_page();
+    } else {
+        display_bip85_select_length_page();
+    }
+}
+
+static void display_bip85_select_application_page(void) {
+    nbgl_layoutDescription_t layoutDescription = {
+        .modal = false,
+        .onActionCallback = &bip85_application_dispatcher};
+    nbgl_layoutHeader_t headerDesc = {.type = HEADER_BACK_AND_TEXT,
+                                      .separationLine = true,
+                                      .backAndText.token = BIP85_BACK_BUTTON_TOKEN,
+                                      .backAndText.tuneId = TUNE_TAP_CASUAL,
+                                      .backAndText.text = "BIP85 Generate"};
+
+    layout = nbgl_layoutGet(&layoutDescription);
+    nbgl_layoutAddHeader(layout, &headerDesc);
+    for (size_t i = 0; i < ARRAYLEN(bip85_applications); i++) {
+        nbgl_layoutBar_t bar = {.text = PIC(bip85_applications[i].name),
+                                .subText = NULL,
+                                .iconLeft = NULL,
+                                .iconRight = &PUSH_ICON,
+                                .token = BIP85_FIRST_APPLICATION_TOKEN + i,
+                                .centered = false,
+                                .inactive = false,
+                                .tuneId = TUNE_TAP_CASUAL};
+        nbgl_layoutAddTouchableBar(layout, &bar);
+        nbgl_layoutAddSeparationLine(layout);
+    }
+    nbgl_layoutDraw(layout);
+    nbgl_refresh();
+}
+
+/*
+ * Generated SSKR shares as ur:sskr QR codes: the CBOR byte string of a share is read back from its
+ * ByteWords, and shown as a single frame (12-word phrases) or as multipart frames cycled on the
+ * ticker (18 and 24-word phrases), fountain-coded ones following the systematic ones, the frames
+ * being drawn over each other
+ */
+#define SSKR_SHARE_QR_TICKER_MS 500
+#define SSKR_SHARE_QR_TOP       TOUCHABLE_HEADER_BAR_HEIGHT
+#define SSKR_SHARE_QR_HEIGHT    (SCREEN_HEIGHT - TOUCHABLE_HEADER_BAR_HEIGHT - SIMPLE_FOOTER_HEIGHT)
+
+enum {
+    SSKR_SHARES_QR_TOKEN = FIRST_USER_TOKEN,
+    SSKR_SHARE_QR_BACK_BUTTON_TOKEN,
+    SSKR_SHARE_QR_NEXT_TOKEN,
+};
+
+static struct {
+    uint8_t share;
+    // frame being shown, from 1
+    uint32_t seq;
+    uint8_t cbor[SSKR_SHARE_CBOR_MAX_LENGTH];
+    ur_encoder_t encoder;
+} sskr_share_qr;
+
+static void display_sskr_shares_review(void);
+
+static void sskr_share_qr_frame_draw(const bool page_drawn) {
+    static qrcode_t qrcode;
+    char text[QRCODE_ALPHANUMERIC_MAX_LENGTH + 1];
+    const size_t length =
+        ur_encoder_part_get(&sskr_share_qr.encoder, sskr_share_qr.seq, text, sizeof(text));
+
+    if (length > 0 && qrcode_encode_alphanumeric(&qrcode, text, length)) {
+        if (page_drawn) {
+            qrcode_screen_refresh(&qrcode, SSKR_SHARE_QR_TOP, SSKR_SHARE_QR_HEIGHT);
+        } else {
+            qrcode_screen_draw(&qrcode, SSKR_SHARE_QR_TOP, SSKR_SHARE_QR_HEIGHT);
+        }
+    }
+    memzero(&qrcode, sizeof(qrcode));
+    memzero(text, sizeof(text));
+}
+
+static void sskr_share_qr_ticker_callback(void) {
+    sskr_share_qr.seq = sskr_share_qr.seq % sskr_share_qr.encoder.cycle + 1;
+    sskr_share_qr_frame_draw(true);
+}
+
+static void display_sskr_share_qr_page(const uint8_t share);
+
+static void sskr_share_qr_dispatcher(const int token, uint8_t index) {
+    UNUSED(index);
+    nbgl_layoutRelease(layout);
+    if (token == SSKR_SHARE_QR_NEXT_TOKEN && sskr_share_qr.share + 1 < sskr_sharecount_get()) {
+        display_sskr_share_qr_page(sskr_share_qr.share + 1);
+        return;
+    }
+    memzero(&sskr_share_qr, sizeof(sskr_share_qr));
+    if (token == SSKR_SHARE_QR_BACK_BUTTON_TOKEN) {
+        display_sskr_shares_review();
+    } else {
+        review_done();
+    }
+}
+
+static void display_sskr_share_qr_page(const uint8_t share) {
+    nbgl_layoutDescription_t layoutDescription = {.modal = false,
+                                                  .onActionCallback = &sskr_share_qr_dispatcher};
+    nbgl_layoutHeader_t headerDesc = {.type = HEADER_BACK_AND_TEXT,
+                                      .separationLine = true,
+                                      .backAndText.token = SSKR_SHARE_QR_BACK_BUTTON_TOKEN,
+                                      .backAndText.tuneId = TUNE_TAP_CASUAL,
+                                      .backAndText.text = headerText};
+
+    memzero(&sskr_share_qr, sizeof(sskr_share_qr));
+    sskr_share_qr.share = share;
+    sskr_share_qr.seq = 1;
+    const size_t length =
+        sskr_shares_share_cbor_get(share, sskr_share_qr.cbor, sizeof(sskr_share_qr.cbor));
+    if (length == 0 || !ur_encoder_start(&sskr_share_qr.encoder,
+                                         "sskr",
+                                         sskr_share_qr.cbor,
+                                         length,
+                                         QRCODE_ALPHANUMERIC_MAX_LENGTH)) {
+        memzero(&sskr_share_qr, sizeof(sskr_share_qr));
+        nbgl_useCaseStatus("QR code generation failed", false, display_sskr_shares_review);
+        return;
+    }
+    if (sskr_share_qr.encoder.count > 1) {
+        layoutDescription.ticker.tickerCallback = &sskr_share_qr_ticker_callback;
+        layoutDescription.ticker.tickerValue = SSKR_SHARE_QR_TICKER_MS;
+        layoutDescription.ticker.tickerIntervale = SSKR_SHARE_QR_TICKER_MS;
+    }
+    SPRINTF(headerText, "SSKR Share #%d", share + 1);
+
+    layout = nbgl_layoutGet(&layoutDescription);
+    nbgl_layoutAddHeader(layout, &headerDesc);
+    nbgl_layoutAddFooter(layout,
+                         share + 1 < sskr_sharecount_get() ? "Next share" : "Done",
+                         SSKR_SHARE_QR_NEXT_TOKEN,
+                         TUNE_TAP_CASUAL);
+    nbgl_layoutDraw(layout);
+    sskr_share_qr_frame_draw(false);
+    nbgl_refresh();
+}
+
+static void sskr_shares_content_callback(int token, uint8_t index, int page) {
+    UNUSED(index);
+    UNUSED(page);
+    if (token == SSKR_SHARES_QR_TOKEN) {
+        display_sskr_share_qr_page(0);
+    }
+}
+
 static void review_sskr_shares_contentGetter(uint8_t index, nbgl_content_t *genericreview) {
     static nbgl_layoutTagValue_t pairs[1];
 
+    if (index == sskr_sharecount_get()) {
+        // the shares are followed by their export as QR codes
+        genericreview->type = INFO_BUTTON;
+        genericreview->contentActionCallback = sskr_shares_content_callback;
+        genericreview->content.infoButton.text = "Export the SSKR shares\nas ur:sskr QR codes";
+        genericreview->content.infoButton.icon = &C_sskr_stax_64px;
+        genericreview->content.infoButton.buttonText = "Show QR codes";
+        genericreview->content.infoButton.buttonToken = SSKR_SHARES_QR_TOKEN;
+        genericreview->content.infoButton.tuneId = TUNE_TAP_CASUAL;
+        return;
+    }
+
     genericreview->type = TAG_VALUE_LIST;
     genericreview->contentActionCallback = NULL;
     genericreview->content.tagValueList.nbPairs = 1;
@@ -656,17 +1802,27 @@ static void review_sskr_shares_contentGetter(uint8_t index, nbgl_content_t *gene
     pairs[0].value = value_buffer;
 }
 
-static void display_sskr_shares(void) {
-    sskr_shares_from_bip39_mnemonic();
-
+static void display_sskr_shares_review(void) {
     static nbgl_genericContents_t genericContent;
     genericContent.callbackCallNeeded = true;
     genericContent.contentGetterCallback = review_sskr_shares_contentGetter;
-    genericContent.nbContents = sskr_sharecount_get();
+    genericContent.nbContents = sskr_sharecount_get() + 1;
 
     nbgl_useCaseGenericReview(&genericContent, "Done", review_done);
 }
 
+static void display_sskr_shares(void) {
+    if (onboarding_type == ONBOARDING_TYPE_BIP85) {
+        if (!sskr_shares_from_bip85_child(bip85_length, bip85_first_index)) {
+            nbgl_useCaseStatus("SSKR generation failed", false, review_done);
+            return;
+        }
+    } else {
+        sskr_shares_from_bip39_mnemonic();
+    }
+    display_sskr_shares_review();
+}
+
 static void sskr_threshold_validate(const uint8_t *thresholdentry, uint8_t length) {
     // Code to validate the entered threshold number
 
@@ -704,6 +1860,149 @@ void display_sskr_select_threshold_page() {
                        display_sskr_select_numshares_page);
 }
 
+/*
+ * Generate BIP39-entropy SLIP-39 shares, in a single group: the Feistel rounds encrypting the
+ * entropy are run from the ticker before the split
+ */
+static void review_slip39_shares_contentGetter(uint8_t index, nbgl_content_t *genericreview) {
+    static nbgl_layoutTagValue_t pairs[1];
+    static char share_item_buffer[sizeof("BIP39-entropy SLIP-39 Share #16")];
+
+    genericreview->type = TAG_VALUE_LIST;
+    genericreview->contentActionCallback = NULL;
+    genericreview->content.tagValueList.nbPairs = 1;
+    genericreview->content.tagValueList.nbMaxLinesForValue = 0;
+    genericreview->content.tagValueList.wrapping = true;
+    genericreview->content.tagValueList.pairs = (nbgl_layoutTagValue_t *) pairs;
+
+    SPRINTF(share_item_buffer, "BIP39-entropy SLIP-39 Share #%d", index + 1);
+    pairs[0].item = share_item_buffer;
+
+    // Ensure null termination
+    value_buffer[slip39_share_text_get(index, value_buffer, sizeof(value_buffer) - 1)] = '\0';
+    pairs[0].value = value_buffer;
+}
+
+static void display_slip39_shares(void) {
+    static nbgl_genericContents_t genericContent;
+    genericContent.callbackCallNeeded = true;
+    genericContent.contentGetterCallback = review_slip39_shares_contentGetter;
+    genericContent.nbContents = slip39_sharecount_get();
+
+    nbgl_useCaseGenericReview(&genericContent, "Done", review_done);
+}
+
+static void slip39_generate_ticker_callback(void);
+
+static void display_slip39_generate_progress_page(void) {
+    nbgl_layoutDescription_t layoutDescription = {
+        .modal = false,
+        .onActionCallback = &check_progress_dispatcher,
+        .ticker.tickerCallback = &slip39_generate_ticker_callback,
+        .ticker.tickerValue = CHECK_PROGRESS_TICKER_MS,
+        .ticker.tickerIntervale = CHECK_PROGRESS_TICKER_MS};
+    nbgl_layoutProgressBar_t progressBar = {.percentage = check_progress,
+                                            .text = "Encrypting your\nBIP39 entropy",
+                                            .subText = NULL};
+
+    layout = nbgl_layoutGet(&layoutDescription);
+    nbgl_layoutAddProgressBar(layout, &progressBar);
+    nbgl_layoutAddFooter(layout, "Cancel", CHECK_CANCEL_TOKEN, TUNE_TAP_CASUAL);
+    nbgl_layoutDraw(layout);
+    nbgl_refresh();
+}
+
+static void slip39_generate_ticker_callback(void) {
+    const uint8_t progress = slip39_shares_step();
+
+    if (progress < 100) {
+        // only redraw when the displayed percentage changes
+        if (progress != check_progress) {
+            check_progress = progress;
+            nbgl_layoutRelease(layout);
+            display_slip39_generate_progress_page();
+        }
+        return;
+    }
+    nbgl_layoutRelease(layout);
+    check_progress = 0;
+    if (!slip39_shares_generate_finish()) {
+        nbgl_useCaseStatus("Share generation failed", false, review_done);
+        return;
+    }
+    display_slip39_shares();
+}
+
+static void slip39_sharenum_validate(const uint8_t *sharenumentry, uint8_t length) {
+    slip39_sharenum_set(0);
+
+    for (uint8_t i = 0; i < length; i++) {
+        slip39_sharenum_set(10 * slip39_sharenum_get() + sharenumentry[i] - '0');
+    }
+
+    PRINTF("Number of SLIP-39 shares entered is '%d'\n", slip39_sharenum_get());
+
+    if (slip39_sharenum_get() > 0 && slip39_sharenum_get() <= SLIP39_SHARES_MAX_COUNT) {
+        display_slip39_select_threshold_page();
+    } else {
+        nbgl_useCaseStatus("Number of shares must be between 1 and 16",
+                           false,
+                           display_select_generate_slip39_page);
+    }
+}
+
+static void display_slip39_select_numshares_page(void) {
+    // Draw the keypad
+    nbgl_useCaseKeypad("Enter number of BIP39-\nentropy SLIP-39 shares\nto generate (1 - 16)",
+                       1,
+                       MAX_NUMBER_LENGTH,
+                       false,
+                       false,
+                       slip39_sharenum_validate,
+                       display_select_generate_slip39_page);
+}
+
+static void slip39_threshold_validate(const uint8_t *thresholdentry, uint8_t length) {
+    slip39_threshold_set(0);
+
+    for (uint8_t i = 0; i < length; i++) {
+        slip39_threshold_set(10 * slip39_threshold_get() + thresholdentry[i] - '0');
+    }
+
+    PRINTF("SLIP-39 threshold value entered is '%d'\n", slip39_threshold_get());
+
+    if (slip39_threshold_get() < 1) {
+        nbgl_useCaseStatus("Threshold value cannot be 0",
+                           false,
+                           display_select_generate_slip39_page);
+    } else if (slip39_threshold_get() > slip39_sharenum_get()) {
+        nbgl_useCaseStatus("Threshold value cannot be greater than number of shares",
+                           false,
+                           display_select_generate_slip39_page);
+    } else if (slip39_threshold_get() == 1 && slip39_sharenum_get() > 1) {
+        nbgl_useCaseStatus("1-of-m shares where\nm > 1 is not supported",
+                           false,
+                           display_select_generate_slip39_page);
+    } else if (!slip39_shares_generate_start(bip39_mnemonic_entropy_get(),
+                                             bip39_mnemonic_final_size_get())) {
+        nbgl_useCaseStatus("Share generation failed", false, review_done);
+    } else {
+        check_progress = 0;
+        display_slip39_generate_progress_page();
+    }
+}
+
+static void display_slip39_select_threshold_page(void) {
+    // Draw the keypad
+    nbgl_useCaseKeypad("Enter threshold value",
+                       1,
+                       MAX_NUMBER_LENGTH,
+                       false,
+                       false,
+                       slip39_threshold_validate,
+                       display_slip39_select_numshares_page);
+}
+
 /*
  * Public function
  */
@@ -0,0 +1,28 @@
+from pathlib import Path
+
+BIP39_WORDLIST = (Path(__file__).resolve().parents[2] / "tools" / "wordlists" /
+                  "bip39_english.txt").read_text().split()
+
+def unique_prefix(word):
+    # Shortest prefix matching this single word, None if the word starts another one
+    for length in range(1, len(word) + 1):
+        if sum(other.startswith(word[:length]) for other in BIP39_WORDLIST) == 1:
+            return word[:length]
+    return None
+
+def write_bip39_phrase(keyboard, suggestion, words, unknown_word=None):
+    # All but the final word are committed as soon as their letters identify them, which the
+    # header of the next keyboard page confirms, the final one being picked among the suggestions.
+    # The word numbered unknown_word (from 1) is marked as unknown by its suggestion, offered before
+    # any letter is entered.
+    for number, word in enumerate(words, 1):
+        if number == unknown_word:
+            suggestion.choose(1)
+            continue
+        prefix = unique_prefix(word)
+        if number < len(words) and prefix is not None:
+            keyboard.write(prefix)
+            keyboard.client.wait_for_text_on_screen(f"Word n. {number} '{word}' added", 5)
+        else:
+            keyboard.write(word[:4])
+            suggestion.choose(1)
@@ -7,6 +7,7 @@ from ragger.conftest import configuration
 from ragger.firmware.touch.use_cases import UseCaseHomeExt, UseCaseViewDetails, UseCaseChoice
 from ragger.firmware.touch.layouts import CenteredFooter, LetterOnlyKeyboard, Suggestions, ChoiceList
 from keypad import Keypad
+from bip39_phrase import write_bip39_phrase
 
 @fixture(scope='session')
 def set_seed():
@@ -483,11 +484,11 @@ def all_eink_bip39_24word(backend, device):
         backend.finger_touch(200, 420, 1)
     elif device.type == DeviceType.FLEX:
         backend.finger_touch(240, 320, 1)
+    backend.wait_for_text_on_screen("BIP39 wordlist", 5)
+    choice.confirm()
     backend.wait_for_text_on_screen("Enter word", 5)
     words = configuration.OPTIONAL.CUSTOM_SEED
-    for word in configuration.OPTIONAL.CUSTOM_SEED.split():
-        keyboard.write(word[:4])
-        suggestion.choose(1)
+    write_bip39_phrase(keyboard, suggestion, words.split())
     backend.wait_for_text_on_screen("Valid Secret", 10)
     backend.wait_for_text_on_screen("Recovery Phrase", 1)
     check_result.tap()
@@ -501,15 +502,18 @@ def all_eink_bip39_24word(backend, device):
     keypad.enter()
     backend.wait_for_text_on_screen("SSKR Share", 5)
     backend.wait_for_text_on_screen("tuna next keep hard", 1)
-    backend.wait_for_text_on_screen("1 of 3", 1)
+    backend.wait_for_text_on_screen("1 of 4", 1)
     review.next()
     backend.wait_for_text_on_screen("SSKR Share", 5)
     backend.wait_for_text_on_screen("tuna next keep hard", 1)
-    backend.wait_for_text_on_screen("2 of 3", 1)
+    backend.wait_for_text_on_screen("2 of 4", 1)
     review.next()
     backend.wait_for_text_on_screen("SSKR Share", 5)
     backend.wait_for_text_on_screen("tuna next keep hard", 1)
-    backend.wait_for_text_on_screen("3 of 3", 1)
+    backend.wait_for_text_on_screen("3 of 4", 1)
+    review.next()
+    backend.wait_for_text_on_screen("Show QR codes", 5)
+    backend.wait_for_text_on_screen("4 of 4", 1)
     review.exit()
     backend.wait_for_text_on_screen("Seed Tool", 5)
     home_page.quit()
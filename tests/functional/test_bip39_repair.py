@@ -0,0 +1,62 @@
+from pytest import fixture
+from pytest import mark
+from pytest import skip
+from ledgered.devices import DeviceType
+from ragger.conftest import configuration
+from ragger.firmware.touch.use_cases import UseCaseHomeExt, UseCaseChoice
+from ragger.firmware.touch.layouts import CenteredFooter, LetterOnlyKeyboard, Suggestions
+from bip39_phrase import write_bip39_phrase
+
+@fixture(scope='session')
+def set_seed():
+    # Seed taken from https://github.com/BlockchainCommons/crypto-commons/blob/master/Docs/sskr-test-vector.md#128-bit-seed
+    configuration.OPTIONAL.CUSTOM_SEED = "fly mule excess resource treat plunge nose soda reflect adult ramp planet"
+
+def all_eink_bip39_repair(backend, device):
+    home_page = UseCaseHomeExt(backend, device)
+    select_footer = CenteredFooter(backend, device)
+    keyboard = LetterOnlyKeyboard(backend, device)
+    suggestion = Suggestions(backend, device)
+    check_result = CenteredFooter(backend, device)
+    choice = UseCaseChoice(backend, device)
+
+    backend.wait_for_text_on_screen("Seed Tool", 10)
+    home_page.action()
+    backend.wait_for_text_on_screen("BIP39 Check", 5)
+#   Workaround for https://github.com/LedgerHQ/ragger/issues/247
+    select_footer.tap()
+    backend.wait_for_text_on_screen("12 words", 5)
+    select_footer.tap()
+    backend.wait_for_text_on_screen("BIP39 wordlist", 5)
+    choice.confirm()
+    backend.wait_for_text_on_screen("Enter word", 5)
+    # "rose" mistyped for the 7th word, "nose": the checksum stays valid but the seed differs
+    words = configuration.OPTIONAL.CUSTOM_SEED.split()
+    words[6] = "rose"
+    write_bip39_phrase(keyboard, suggestion, words)
+    backend.wait_for_text_on_screen("Valid Secret", 30)
+    backend.wait_for_text_on_screen("doesn't match", 1)
+    # "Try to repair" button, drawn above the footer where the confirm button of a choice is
+    choice.confirm()
+    backend.wait_for_text_on_screen("repaired", 60)
+    backend.wait_for_text_on_screen("Word n. 7 is 'nose'", 1)
+    check_result.tap()
+    backend.wait_for_text_on_screen("Generate SSKR", 5)
+    choice.reject()
+    backend.wait_for_text_on_screen("Generate shares", 5)
+    choice.reject()
+    backend.wait_for_text_on_screen("Seed Tool", 5)
+    home_page.quit()
+
+@mark.use_on_backend("speculos")
+def test_bip39_repair(device, backend, navigator, set_seed):
+    if device.type == DeviceType.NANOS:
+        skip("Skipping test for Nano S device")
+    elif device.type == DeviceType.NANOSP:
+        skip("Skipping test for Nano S+ device")
+    elif device.type == DeviceType.NANOX:
+        skip("Skipping test for Nano X device")
+    elif device.type == DeviceType.STAX:
+        all_eink_bip39_repair(backend, device)
+    elif device.type == DeviceType.FLEX:
+        all_eink_bip39_repair(backend, device)
@@ -0,0 +1,63 @@
+from pytest import fixture
+from pytest import mark
+from pytest import skip
+from ledgered.devices import DeviceType
+from ragger.conftest import configuration
+from ragger.firmware.touch.use_cases import UseCaseHomeExt, UseCaseViewDetails, UseCaseChoice
+from ragger.firmware.touch.layouts import CenteredFooter, ChoiceList
+from keypad import Keypad
+
+@fixture(scope='session')
+def set_seed():
+    # Seed taken from https://github.com/BlockchainCommons/crypto-commons/blob/master/Docs/sskr-test-vector.md#128-bit-seed
+    configuration.OPTIONAL.CUSTOM_SEED = "fly mule excess resource treat plunge nose soda reflect adult ramp planet"
+
+def all_eink_bip85(backend, device):
+    home_page = UseCaseHomeExt(backend, device)
+    select_footer = CenteredFooter(backend, device)
+    keypad = Keypad(backend, device)
+    review = UseCaseViewDetails(backend, device)
+    choice = UseCaseChoice(backend, device)
+    select_application = ChoiceList(backend, device)
+
+    backend.wait_for_text_on_screen("Seed Tool", 10)
+    home_page.action()
+    backend.wait_for_text_on_screen("BIP85 Generate", 5)
+#   Workaround for https://github.com/LedgerHQ/ragger/issues/247
+#   "BIP85 Generate", the tool button above "Shamir Check"
+    if device.type == DeviceType.STAX:
+        backend.finger_touch(212, 422, 1)
+    elif device.type == DeviceType.FLEX:
+        backend.finger_touch(240, 332, 1)
+    # "BIP39 phrase", first of the applications listed below the header
+    backend.wait_for_text_on_screen("BIP39 phrase", 5)
+    select_application.choose(1)
+    backend.wait_for_text_on_screen("12 words", 5)
+    select_footer.tap()
+    backend.wait_for_text_on_screen("Enter index of the", 5)
+    keypad.write("0")
+    keypad.enter()
+    backend.wait_for_text_on_screen("BIP85 Child #0", 5)
+    choice.reject()
+    # Children of m/83696968'/39'/0'/12'/0' and m/83696968'/39'/0'/12'/1'
+    backend.wait_for_text_on_screen("BIP39 phrase #0", 10)
+    backend.wait_for_text_on_screen("select into bar", 1)
+    review.next()
+    backend.wait_for_text_on_screen("BIP39 phrase #1", 10)
+    backend.wait_for_text_on_screen("era harvest mom", 1)
+    review.exit()
+    backend.wait_for_text_on_screen("Seed Tool", 5)
+    home_page.quit()
+
+@mark.use_on_backend("speculos")
+def test_bip85(device, backend, navigator, set_seed):
+    if device.type == DeviceType.NANOS:
+        skip("Skipping test for Nano S device")
+    elif device.type == DeviceType.NANOSP:
+        skip("Skipping test for Nano S+ device")
+    elif device.type == DeviceType.NANOX:
+        skip("Skipping test for Nano X device")
+    elif device.type == DeviceType.STAX:
+        all_eink_bip85(backend, device)
+    elif device.type == DeviceType.FLEX:
+        all_eink_bip85(backend, device)
@@ -0,0 +1,74 @@
+from pytest import fixture
+from pytest import mark
+from pytest import skip
+from ledgered.devices import DeviceType
+from ragger.conftest import configuration
+from ragger.firmware.touch.use_cases import UseCaseHomeExt, UseCaseChoice
+from ragger.firmware.touch.layouts import CenteredFooter, LetterOnlyKeyboard, Suggestions
+from bip39_phrase import write_bip39_phrase
+
+@fixture(scope='session')
+def set_seed():
+    # Seed taken from https://github.com/BlockchainCommons/crypto-commons/blob/master/Docs/sskr-test-vector.md#128-bit-seed
+    configuration.OPTIONAL.CUSTOM_SEED = "fly mule excess resource treat plunge nose soda reflect adult ramp planet"
+
+def all_eink_check_tally(backend, device):
+    # A valid phrase which is not the one of the device
+    other_phrase = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about"
+
+    home_page = UseCaseHomeExt(backend, device)
+    select_footer = CenteredFooter(backend, device)
+    keyboard = LetterOnlyKeyboard(backend, device)
+    suggestion = Suggestions(backend, device)
+    check_result = CenteredFooter(backend, device)
+    choice = UseCaseChoice(backend, device)
+
+    backend.wait_for_text_on_screen("Seed Tool", 10)
+    home_page.action()
+    backend.wait_for_text_on_screen("Select the tool", 5)
+#   Workaround for https://github.com/LedgerHQ/ragger/issues/247
+    select_footer.tap()
+    backend.wait_for_text_on_screen("12 words", 5)
+    select_footer.tap()
+    backend.wait_for_text_on_screen("BIP39 wordlist", 5)
+    choice.confirm()
+    backend.wait_for_text_on_screen("Enter word", 5)
+    write_bip39_phrase(keyboard, suggestion, other_phrase.split())
+    backend.wait_for_text_on_screen("Valid Secret", 30)
+    backend.wait_for_text_on_screen("doesn't match", 1)
+    backend.wait_for_text_on_screen("Tap to check another", 1)
+    check_result.tap()
+    # Back to the tools, counting the backup just checked
+    backend.wait_for_text_on_screen("1 checked, 0 matching", 5)
+    select_footer.tap()
+    backend.wait_for_text_on_screen("12 words", 5)
+    select_footer.tap()
+    backend.wait_for_text_on_screen("BIP39 wordlist", 5)
+    choice.confirm()
+    backend.wait_for_text_on_screen("Enter word", 5)
+    words = configuration.OPTIONAL.CUSTOM_SEED
+    write_bip39_phrase(keyboard, suggestion, words.split())
+    backend.wait_for_text_on_screen("Valid Secret", 30)
+    backend.wait_for_text_on_screen("Tap to dismiss", 1)
+    check_result.tap()
+    backend.wait_for_text_on_screen("Generate SSKR", 5)
+    choice.reject()
+    backend.wait_for_text_on_screen("Generate shares", 5)
+    choice.reject()
+    backend.wait_for_text_on_screen("Seed Tool", 5)
+    # The tally is kept until the tools are left by their back button
+    home_page.action()
+    backend.wait_for_text_on_screen("2 checked, 1 matching", 5)
+
+@mark.use_on_backend("speculos")
+def test_check_tally(device, backend, navigator, set_seed):
+    if device.type == DeviceType.NANOS:
+        skip("Skipping test for Nano S device")
+    elif device.type == DeviceType.NANOSP:
+        skip("Skipping test for Nano S+ device")
+    elif device.type == DeviceType.NANOX:
+        skip("Skipping test for Nano X device")
+    elif device.type == DeviceType.STAX:
+        all_eink_check_tally(backend, device)
+    elif device.type == DeviceType.FLEX:
+        all_eink_check_tally(backend, device)
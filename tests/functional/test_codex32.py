@@ -0,0 +1,73 @@
+import re
+from pytest import fixture
+from pytest import mark
+from pytest import skip
+from ledgered.devices import DeviceType
+from ragger.conftest import configuration
+from ragger.firmware.touch.use_cases import UseCaseHomeExt, UseCaseChoice
+from ragger.firmware.touch.layouts import CenteredFooter, FullKeyboardLetters, FullKeyboardSpecialCharacters1
+
+@fixture(scope='session')
+def set_seed():
+    # Seed taken from https://github.com/BlockchainCommons/crypto-commons/blob/master/Docs/sskr-test-vector.md#128-bit-seed
+    configuration.OPTIONAL.CUSTOM_SEED = "fly mule excess resource treat plunge nose soda reflect adult ramp planet"
+
+def write_codex32_share(letters, digits, characters):
+    # The keyboard starts with the letters and stays on the digits until switched back
+    on_digits = False
+    for run in re.findall(r"[0-9]+|[^0-9]+", characters):
+        if run[0].isdigit() != on_digits:
+            (digits if on_digits else letters).change_layout()
+            on_digits = not on_digits
+        (digits if on_digits else letters).write(run)
+
+def all_eink_codex32(backend, device):
+    # Shares 'a' and 'c' of a 2-of-n set whose 512-bit secret, interpolated at 's', is the BIP39
+    # seed of the device's phrase (PBKDF2-SHA512 of the phrase salted with "mnemonic")
+    codex32_shares = [
+        "ms12ledsa569lxdxfk3ard6grr3v03wx5f8zhny4raagu6c5dtvqpp328ty2pezcsjg9q5nhckuk7xudzzfev8mmx"
+        "rvahxe39rfkmt7244fc5hng2s70acn7xdx43e5",
+        "ms12ledscvj9k8gsdujavd3huv55lg87uyaydzfm4ze4ttzer7qszdsyuye8gs6qqxqh5dzqp6pcg6uuyhv3k0vuf"
+        "kttsrm7a09kseatusp7rt9eqw6a4d7xgrrs9vu",
+    ]
+
+    home_page = UseCaseHomeExt(backend, device)
+    letters = FullKeyboardLetters(backend, device)
+    digits = FullKeyboardSpecialCharacters1(backend, device)
+    check_result = CenteredFooter(backend, device)
+    choice = UseCaseChoice(backend, device)
+
+    backend.wait_for_text_on_screen("Seed Tool", 10)
+    home_page.action()
+    backend.wait_for_text_on_screen("Shamir Check", 5)
+#   Workaround for https://github.com/LedgerHQ/ragger/issues/247
+    if device.type == DeviceType.STAX:
+        backend.finger_touch(212, 510, 1)
+    elif device.type == DeviceType.FLEX:
+        backend.finger_touch(240, 420, 1)
+    backend.wait_for_text_on_screen("Other shares", 5)
+    choice.reject()
+    backend.wait_for_text_on_screen("codex32, 512 bits", 5)
+    choice.reject()
+    for number, codex32_share in enumerate(codex32_shares, 1):
+        backend.wait_for_text_on_screen(f"Enter Share {number} Character 1/124", 5)
+        # the "ms1" prefix is not entered
+        write_codex32_share(letters, digits, codex32_share[3:])
+    backend.wait_for_text_on_screen("Valid Secret", 10)
+    backend.wait_for_text_on_screen("match the seed", 1)
+    check_result.tap()
+    # Back to the tools, counting the secret just checked
+    backend.wait_for_text_on_screen("1 checked, 1 matching", 5)
+
+@mark.use_on_backend("speculos")
+def test_codex32(device, backend, navigator, set_seed):
+    if device.type == DeviceType.NANOS:
+        skip("Skipping test for Nano S device")
+    elif device.type == DeviceType.NANOSP:
+        skip("Skipping test for Nano S+ device")
+    elif device.type == DeviceType.NANOX:
+        skip("Skipping test for Nano X device")
+    elif device.type == DeviceType.STAX:
+        all_eink_codex32(backend, device)
+    elif device.type == DeviceType.FLEX:
+        all_eink_codex32(backend, device)
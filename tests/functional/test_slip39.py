@@ -0,0 +1,64 @@
+from pytest import fixture
+from pytest import mark
+from pytest import skip
+from ledgered.devices import DeviceType
+from ragger.conftest import configuration
+from ragger.firmware.touch.use_cases import UseCaseHomeExt, UseCaseChoice
+from ragger.firmware.touch.layouts import CenteredFooter, LetterOnlyKeyboard, Suggestions, ChoiceList
+
+@fixture(scope='session')
+def set_seed():
+    # Seed taken from https://github.com/BlockchainCommons/crypto-commons/blob/master/Docs/sskr-test-vector.md#128-bit-seed
+    configuration.OPTIONAL.CUSTOM_SEED = "fly mule excess resource treat plunge nose soda reflect adult ramp planet"
+
+def all_eink_slip39(backend, device):
+    # Share taken from https://github.com/trezor/python-shamir-mnemonic/blob/master/vectors.json (vector 1),
+    # valid but not holding the seed of the device
+    slip39_share = "duckling enlarge academic academic agency result length solution fridge kidney coal piece deal husband erode duke ajar critical decision keyboard"
+
+    home_page = UseCaseHomeExt(backend, device)
+    keyboard = LetterOnlyKeyboard(backend, device)
+    suggestion = Suggestions(backend, device)
+    check_result = CenteredFooter(backend, device)
+    choice = UseCaseChoice(backend, device)
+    select_length = ChoiceList(backend, device)
+
+    backend.wait_for_text_on_screen("Seed Tool", 10)
+    home_page.action()
+    backend.wait_for_text_on_screen("Shamir Check", 5)
+#   Workaround for https://github.com/LedgerHQ/ragger/issues/247
+    if device.type == DeviceType.STAX:
+        backend.finger_touch(212, 510, 1)
+    elif device.type == DeviceType.FLEX:
+        backend.finger_touch(240, 420, 1)
+    backend.wait_for_text_on_screen("Other shares", 5)
+    choice.reject()
+    backend.wait_for_text_on_screen("BIP39-entropy SLIP-39", 5)
+    choice.confirm()
+    # "20 words", first of the lengths listed below the header
+    backend.wait_for_text_on_screen("20 words", 5)
+    select_length.choose(1)
+    backend.wait_for_text_on_screen("Enter Share 1 Word 1/20", 5)
+    for word in slip39_share.split():
+        keyboard.write(word[:4])
+        suggestion.choose(1)
+    backend.wait_for_text_on_screen("Valid Secret", 60)
+    backend.wait_for_text_on_screen("don't match", 1)
+    check_result.tap()
+    backend.wait_for_text_on_screen("Recover BIP39", 5)
+    choice.reject()
+    backend.wait_for_text_on_screen("Seed Tool", 5)
+    home_page.quit()
+
+@mark.use_on_backend("speculos")
+def test_slip39(device, backend, navigator, set_seed):
+    if device.type == DeviceType.NANOS:
+        skip("Skipping test for Nano S device")
+    elif device.type == DeviceType.NANOSP:
+        skip("Skipping test for Nano S+ device")
+    elif device.type == DeviceType.NANOX:
+        skip("Skipping test for Nano X device")
+    elif device.type == DeviceType.STAX:
+        all_eink_slip39(backend, device)
+    elif device.type == DeviceType.FLEX:
+        all_eink_slip39(backend, device)
@@ -1237,13 +1237,15 @@ def all_eink_sskr_256bit(backend, device):
 
     backend.wait_for_text_on_screen("Seed Tool", 10)
     home_page.action()
-    backend.wait_for_text_on_screen("SSKR Check", 5)
+    backend.wait_for_text_on_screen("Shamir Check", 5)
 #    select_tool.choose(6)
 #   Workaround for https://github.com/LedgerHQ/ragger/issues/247
     if device.type == DeviceType.STAX:
         backend.finger_touch(212, 510, 1)
     elif device.type == DeviceType.FLEX:
         backend.finger_touch(240, 420, 1)
+    backend.wait_for_text_on_screen("SSKR shares", 5)
+    choice.confirm()
     backend.wait_for_text_on_screen("Enter Share 1 Word 1", 5)
     words = configuration.OPTIONAL.CUSTOM_SEED
     for shard in sskr_shards:
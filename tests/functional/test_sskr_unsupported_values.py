@@ -6,6 +6,7 @@ from ragger.conftest import configuration
 from ragger.firmware.touch.use_cases import UseCaseHomeExt, UseCaseViewDetails, UseCaseChoice
 from ragger.firmware.touch.layouts import CenteredFooter, LetterOnlyKeyboard, Suggestions, ChoiceList
 from keypad import Keypad
+from bip39_phrase import write_bip39_phrase
 
 @fixture(scope='session')
 def set_seed():
@@ -31,11 +32,11 @@ def all_eink_unsupported_values(backend, device):
     select_footer.tap()
     backend.wait_for_text_on_screen("12 words", 5)
     select_footer.tap()
+    backend.wait_for_text_on_screen("BIP39 wordlist", 5)
+    choice.confirm()
     backend.wait_for_text_on_screen("Enter word", 5)
     words = configuration.OPTIONAL.CUSTOM_SEED
-    for word in configuration.OPTIONAL.CUSTOM_SEED.split():
-        keyboard.write(word[:4])
-        suggestion.choose(1)
+    write_bip39_phrase(keyboard, suggestion, words.split())
     backend.wait_for_text_on_screen("Valid Secret", 5)
     backend.wait_for_text_on_screen("Recovery Phrase", 1)
     check_result.tap()
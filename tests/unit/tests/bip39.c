@@ -3,9 +3,14 @@
 #include <stddef.h>
 #include <setjmp.h>
 #include <cmocka.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 #include "testutils.h"
+#include "bits11.h"
 #include "bip39/common_bip39.h"
+#include "bip39/pbkdf2_sha512.h"
 
 const unsigned char bip39_mnemonic[] = "toe priority custom gauge jacket theme arrest bargain gloom wide ill fit eagle prepare capable fish limb cigar reform other priority speak rough imitate";
 
@@ -28,9 +33,536 @@ static void test_bip39(void **state) {
     assert_memory_equal(buffer, seed, sizeof(seed));
 }
 
+static void test_bip39_mnemonic_check(void **state) {
+    unsigned char buffer[sizeof(bip39_mnemonic)];
+
+    memcpy(buffer, bip39_mnemonic, sizeof(buffer));
+    assert_int_equal(bolos_ux_bip39_mnemonic_check(buffer, sizeof(bip39_mnemonic) - 1), 1);
+
+    // "toe" -> "tow", not in the wordlist
+    buffer[2] = 'w';
+    assert_int_equal(bolos_ux_bip39_mnemonic_check(buffer, sizeof(bip39_mnemonic) - 1), 0);
+
+    // "toe priority" -> "toepriority", too long for any word
+    memcpy(buffer, bip39_mnemonic, sizeof(buffer));
+    memmove(buffer + 3, buffer + 4, sizeof(buffer) - 4);
+    assert_int_equal(bolos_ux_bip39_mnemonic_check(buffer, sizeof(bip39_mnemonic) - 2), 0);
+}
+
+static const struct {
+    const char *entropy;
+    const char *mnemonic;
+} vectors[] = {
+    {"00000000000000000000000000000000",
+     "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon "
+     "about"},
+    {"7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f",
+     "legal winner thank year wave sausage worth useful legal winner thank yellow"},
+    {"ffffffffffffffffffffffffffffffff",
+     "zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo wrong"},
+    {"9e885d952ad362caeb4efe34a8e91bd2",
+     "ozone drill grab fiber curtain grace pudding thank cruise elder eight picnic"},
+    {"000000000000000000000000000000000000000000000000",
+     "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon "
+     "abandon abandon abandon abandon abandon abandon agent"},
+    {"808080808080808080808080808080808080808080808080",
+     "letter advice cage absurd amount doctor acoustic avoid letter advice cage absurd amount "
+     "doctor acoustic avoid letter always"},
+    {"6610b25967cdcca9d59875f5cb50b0ea75433311869e930b",
+     "gravity machine north sort system female filter attitude volume fold club stay feature "
+     "office ecology stable narrow fog"},
+    {"0000000000000000000000000000000000000000000000000000000000000000",
+     "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon "
+     "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon "
+     "abandon art"},
+    {"ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+     "zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo "
+     "vote"},
+    {"68a79eaca2324873eacc50cb9c6eca8cc68ea5d936f98787c60c7ebc74e6ce7c",
+     "hamster diagram private dutch cause delay private meat slide toddler razor book happy "
+     "fancy gospel tennis maple dilemma loan word shrug inflict delay length"},
+};
+
+static size_t hex_decode(const char *hex, uint8_t *out) {
+    size_t i;
+    for (i = 0; hex[2 * i] != '\0'; i++) {
+        unsigned int byte;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        out[i] = byte;
+    }
+    return i;
+}
+
+static void test_bip39_vectors(void **state) {
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        uint8_t entropy[32];
+        uint8_t bits[33];
+        unsigned char mnemonic[24 * 9];
+        const size_t entropy_len = hex_decode(vectors[v].entropy, entropy);
+        const size_t mnemonic_len = strlen(vectors[v].mnemonic);
+
+        assert_int_equal(
+            bolos_ux_bip39_mnemonic_encode(entropy, entropy_len, mnemonic, sizeof(mnemonic)),
+            mnemonic_len);
+        assert_memory_equal(mnemonic, vectors[v].mnemonic, mnemonic_len);
+
+        assert_int_equal(bolos_ux_bip39_mnemonic_decode(mnemonic, mnemonic_len, bits, sizeof(bits)),
+                         1);
+        assert_memory_equal(bits, entropy, entropy_len);
+        assert_int_equal(bolos_ux_bip39_entropy_check(bits, entropy_len * 3 / 4), 1);
+    }
+}
+
+static void test_bip39_final_word_candidates(void **state) {
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        uint8_t bits[33] = {0};
+        const unsigned int word_count = hex_decode(vectors[v].entropy, bits) * 3 / 4;
+        const unsigned int count = bolos_ux_bip39_final_word_candidate_count(word_count);
+        unsigned int n = 0;
+
+        assert_int_equal(count, 1u << (11 - word_count / 3));
+        // every final word passing the checksum, in increasing order
+        for (unsigned int index = 0; index < 2048; index++) {
+            bolos_ux_bip39_entropy_word_set(bits, word_count - 1, index);
+            if (bolos_ux_bip39_entropy_check(bits, word_count)) {
+                assert_true(n < count);
+                assert_int_equal(bolos_ux_bip39_final_word_candidate(bits, word_count, n), index);
+                n++;
+            }
+        }
+        assert_int_equal(n, count);
+    }
+    assert_int_equal(bolos_ux_bip39_final_word_candidate_count(13), 0);
+}
+
+static void test_bip39_final_word_filter(void **state) {
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        uint8_t bits[33] = {0};
+        unsigned char word[9] = {0};
+        unsigned char letters[26];
+        const unsigned int word_count = hex_decode(vectors[v].entropy, bits) * 3 / 4;
+        const unsigned int count = bolos_ux_bip39_final_word_candidate_count(word_count);
+
+        bolos_ux_bip39_entropy_checksum_set(bits, word_count);
+        const unsigned int last_word = bolos_ux_bip39_entropy_word_get(bits, word_count - 1);
+        bolos_ux_bip39_final_word_filter_set(bits, word_count);
+        assert_int_equal(bolos_ux_bip39_get_word_count_starting_with(word, 0), count);
+        assert_int_equal(bolos_ux_bip39_get_word_idx_starting_with(word, 0), 0);
+        for (unsigned int n = 0; n < count; n++) {
+            assert_int_equal(bolos_ux_bip39_offered_word_idx(n),
+                             bolos_ux_bip39_final_word_candidate(bits, word_count, n));
+        }
+        assert_int_equal(bolos_ux_bip39_offered_word_idx(count), 2048);
+
+        // the actual final word is reachable letter by letter, and is offered alone at the end
+        const unsigned int length = bolos_ux_bip39_idx_strcpy(last_word, word);
+        for (unsigned int l = 0; l < length; l++) {
+            const unsigned int letter_count =
+                bolos_ux_bip39_get_word_next_letters_starting_with(word, l, letters);
+            assert_non_null(memchr(letters, word[l], letter_count));
+            assert_true(bolos_ux_bip39_get_word_count_starting_with(word, l + 1) <=
+                        bolos_ux_bip39_get_word_count_starting_with(word, l));
+        }
+        const unsigned int position = bolos_ux_bip39_get_word_idx_starting_with(word, length);
+        assert_true(position < count);
+        assert_int_equal(bolos_ux_bip39_offered_word_idx(position), last_word);
+
+        bolos_ux_bip39_final_word_filter_set(NULL, 0);
+        assert_int_equal(bolos_ux_bip39_get_word_count_starting_with(word, 0), 2048);
+        assert_int_equal(bolos_ux_bip39_get_word_idx_starting_with(word, length), last_word);
+    }
+}
+
+static unsigned int word_idx(const char *word) {
+    return bolos_ux_bip39_get_word_idx_starting_with((const unsigned char *) word, strlen(word));
+}
+
+static void test_bip39_words_near(void **state) {
+    static const struct {
+        const char *a;
+        const char *b;
+        bool near;
+    } pairs[] = {
+        {"act", "actor", true},       // same family
+        {"tent", "tenant", true},     // same family
+        {"cat", "car", true},         // one letter replaced
+        {"lake", "like", true},       // one letter replaced
+        {"fat", "flat", true},        // one letter added
+        {"across", "cross", true},    // one letter removed
+        {"zoo", "zone", false},       // two letters away
+        {"abandon", "ability", false},
+        {"cat", "act", false},        // swapped letters
+        {"cat", "cat", false},        // the word itself
+    };
+
+    for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+        assert_int_equal(bolos_ux_bip39_words_near(word_idx(pairs[i].a), word_idx(pairs[i].b)),
+                         pairs[i].near);
+        assert_int_equal(bolos_ux_bip39_words_near(word_idx(pairs[i].b), word_idx(pairs[i].a)),
+                         pairs[i].near);
+    }
+    assert_false(bolos_ux_bip39_words_near(0, 2048));
+}
+
+static void test_bip39_near_word(void **state) {
+    (void) state;
+    uint8_t near[BIP39_WORDLIST_COUNT];
+
+    // the slots give each near word of a word once, and nothing else, in every wordlist
+    for (unsigned int language = 0; language < BIP39_LANGUAGE_COUNT; language++) {
+        assert_int_equal(bolos_ux_bip39_wordlist_set(language), 1);
+        for (unsigned int a = 0; a < BIP39_WORDLIST_COUNT; a++) {
+            memset(near, 0, sizeof(near));
+            for (unsigned int n = 0; n < BIP39_NEAR_WORD_SLOTS; n++) {
+                const unsigned int b = bolos_ux_bip39_near_word(a, n);
+                if (b < BIP39_WORDLIST_COUNT) {
+                    assert_true(bolos_ux_bip39_words_near(a, b));
+                    assert_int_equal(near[b]++, 0);
+                }
+            }
+            for (unsigned int b = 0; b < BIP39_WORDLIST_COUNT; b++) {
+                assert_int_equal(near[b], bolos_ux_bip39_words_near(a, b));
+            }
+        }
+    }
+    bolos_ux_bip39_wordlist_set(BIP39_LANGUAGE_ENGLISH);
+    assert_int_equal(bolos_ux_bip39_near_word(0, BIP39_NEAR_WORD_SLOTS), BIP39_WORDLIST_COUNT);
+    assert_int_equal(bolos_ux_bip39_near_word(2048, 0), BIP39_WORDLIST_COUNT);
+}
+
+static void test_bip39_unique_word(void **state) {
+    unsigned char word[9];
+
+    assert_int_equal(bolos_ux_bip39_get_unique_word_idx_starting_with((unsigned char *) "aband", 5),
+                     0);
+    assert_int_equal(bolos_ux_bip39_get_unique_word_idx_starting_with((unsigned char *) "zoo", 3),
+                     2047);
+    assert_int_equal(bolos_ux_bip39_get_unique_word_idx_starting_with((unsigned char *) "act", 3),
+                     2048);
+    assert_int_equal(bolos_ux_bip39_get_unique_word_idx_starting_with((unsigned char *) "xyz", 3),
+                     2048);
+    assert_int_equal(bolos_ux_bip39_get_unique_word_idx_starting_with(word, 0), 2048);
+
+    // every prefix of every word is unique exactly when a single word starts with it
+    for (unsigned int i = 0; i < 2048; i++) {
+        const unsigned int length = bolos_ux_bip39_idx_strcpy(i, word);
+        for (unsigned int l = 1; l <= length; l++) {
+            const bool unique = bolos_ux_bip39_get_word_count_starting_with(word, l) == 1;
+            assert_int_equal(bolos_ux_bip39_get_unique_word_idx_starting_with(word, l),
+                             unique ? i : 2048);
+            // the first 4 letters identify a word
+            assert_true(unique || l < 4 || l == length);
+        }
+    }
+}
+
+// Electrum mnemonics read the seed as a big number, least significant 11 bits first
+static unsigned int shiftr_11(unsigned char *r, unsigned int len) {
+    unsigned int j, b11;
+    b11 = r[len - 1] | ((r[len - 2] & 7) << 8);
+
+    for (j = len - 2; j > 0; j--) {
+        r[j + 1] = (r[j] >> 3) | (r[j - 1] << 5);
+    }
+    r[1] = r[0] >> 3;
+    r[0] = 0;
+
+    return b11;
+}
+
+static void test_bits11(void **state) {
+    uint16_t indexes[24], unpacked[24];
+    uint8_t bits[33], repacked[33];
+
+    for (unsigned int i = 0; i < 24; i++) {
+        indexes[i] = (i * 1021 + 517) & BITS11_MASK;
+    }
+    for (size_t count = 12; count <= 24; count += 6) {
+        memset(bits, 0xA5, sizeof(bits));
+        bits11_pack(indexes, count, bits);
+        // the bytes following the packed indexes are left untouched
+        if (BITS11_LENGTH(count) < sizeof(bits)) {
+            assert_int_equal(bits[BITS11_LENGTH(count)], 0xA5);
+        }
+        bits11_unpack(bits, 0, unpacked, count);
+        assert_memory_equal(unpacked, indexes, count * sizeof(indexes[0]));
+
+        memset(repacked, 0xA5, sizeof(repacked));
+        for (size_t i = 0; i < count; i++) {
+            assert_int_equal(bits11_get(bits, i), indexes[i]);
+            bits11_set(repacked, i, indexes[i]);
+        }
+        assert_memory_equal(repacked, bits, BITS11_LENGTH(count) - 1);
+    }
+
+    // 132-bit Electrum seed, its 4 most significant bits being zero
+    uint8_t seed[17], reference[17];
+    for (unsigned int i = 0; i < sizeof(seed); i++) {
+        seed[i] = reference[i] = i * 37 + 11;
+    }
+    seed[0] = reference[0] &= 0x0F;
+    bits11_unpack(seed, 4, unpacked, 12);
+    for (unsigned int i = 0; i < 12; i++) {
+        assert_int_equal(unpacked[11 - i], shiftr_11(reference, sizeof(reference)));
+    }
+}
+
+static void test_pbkdf2_sha512(void **state) {
+    uint8_t salt[] = "mnemonicTREZOR";
+    uint8_t expected[64], out[64];
+    pbkdf2_sha512_t ctx;
+
+    // every vector mnemonic, the 24-word ones being longer than a SHA-512 block
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        const uint8_t *password = (const uint8_t *) vectors[v].mnemonic;
+        const size_t password_length = strlen(vectors[v].mnemonic);
+
+        cx_pbkdf2_sha512(password, password_length, salt, sizeof(salt) - 1, 2048, expected, 64);
+        assert_int_equal(
+            pbkdf2_sha512(password, password_length, salt, sizeof(salt) - 1, 2048, out, 64),
+            CX_OK);
+        assert_memory_equal(out, expected, 64);
+
+        // a few rounds at a time
+        memset(out, 0, sizeof(out));
+        assert_int_equal(
+            pbkdf2_sha512_init(&ctx, password, password_length, salt, sizeof(salt) - 1, 2048),
+            CX_OK);
+        while (ctx.rounds_left > 0) {
+            assert_int_equal(pbkdf2_sha512_step(&ctx, 100), CX_OK);
+        }
+        assert_int_equal(pbkdf2_sha512_final(&ctx, out, 64), CX_OK);
+        assert_memory_equal(out, expected, 64);
+    }
+
+    // BIP39 reference seed of "abandon ... about" with the "TREZOR" passphrase
+    static const uint8_t trezor_seed[] = {
+        0xc5, 0x52, 0x57, 0xc3, 0x60, 0xc0, 0x7c, 0x72, 0x02, 0x9a, 0xeb, 0xc1, 0xb5,
+        0x3c, 0x05, 0xed, 0x03, 0x62, 0xad, 0xa3, 0x8e, 0xad, 0x3e, 0x3e, 0x9e, 0xfa,
+        0x37, 0x08, 0xe5, 0x34, 0x95, 0x53, 0x1f, 0x09, 0xa6, 0x98, 0x75, 0x99, 0xd1,
+        0x82, 0x64, 0xc1, 0xe1, 0xc9, 0x2f, 0x2c, 0xf1, 0x41, 0x63, 0x0c, 0x7a, 0x3c,
+        0x4a, 0xb7, 0xc8, 0x1b, 0x2f, 0x00, 0x16, 0x98, 0xe7, 0x46, 0x3b, 0x04};
+    assert_int_equal(pbkdf2_sha512((const uint8_t *) vectors[0].mnemonic,
+                                   strlen(vectors[0].mnemonic),
+                                   salt,
+                                   sizeof(salt) - 1,
+                                   2048,
+                                   out,
+                                   64),
+                     CX_OK);
+    assert_memory_equal(out, trezor_seed, sizeof(trezor_seed));
+
+    // rounds left to run
+    assert_int_equal(pbkdf2_sha512_init(&ctx, salt, 8, salt, 8, 2048), CX_OK);
+    assert_int_equal(pbkdf2_sha512_step(&ctx, 2046), CX_OK);
+    assert_int_equal(ctx.rounds_left, 1);
+    assert_int_equal(pbkdf2_sha512_final(&ctx, out, 64), CX_INVALID_PARAMETER);
+
+    assert_int_equal(pbkdf2_sha512(salt, 8, salt, 8, 0, out, 64), CX_INVALID_PARAMETER);
+    assert_int_equal(pbkdf2_sha512(salt, 8, salt, 8, 1, out, 65), CX_INVALID_PARAMETER);
+}
+
+static void test_bip39_seed_start(void **state) {
+    pbkdf2_sha512_t ctx;
+
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        uint8_t expected[64], out[64];
+        uint8_t bits[33];
+        const unsigned char *mnemonic = (const unsigned char *) vectors[v].mnemonic;
+        const size_t mnemonic_len = strlen(vectors[v].mnemonic);
+        const unsigned int word_count = hex_decode(vectors[v].entropy, bits) * 3 / 4;
+
+        bolos_ux_bip39_mnemonic_to_seed(mnemonic, mnemonic_len, expected);
+
+        // resumed derivation from the text
+        assert_int_equal(bolos_ux_bip39_mnemonic_to_seed_start(&ctx, mnemonic, mnemonic_len),
+                         CX_OK);
+        while (ctx.rounds_left > 0) {
+            assert_int_equal(pbkdf2_sha512_step(&ctx, 128), CX_OK);
+        }
+        assert_int_equal(pbkdf2_sha512_final(&ctx, out, 64), CX_OK);
+        assert_memory_equal(out, expected, 64);
+
+        // resumed derivation from the packed indexes
+        assert_int_equal(bolos_ux_bip39_mnemonic_decode(mnemonic, mnemonic_len, bits, sizeof(bits)),
+                         1);
+        assert_int_equal(bolos_ux_bip39_entropy_to_seed_start(&ctx, bits, word_count), CX_OK);
+        while (ctx.rounds_left > 0) {
+            assert_int_equal(pbkdf2_sha512_step(&ctx, 128), CX_OK);
+        }
+        assert_int_equal(pbkdf2_sha512_final(&ctx, out, 64), CX_OK);
+        assert_memory_equal(out, expected, 64);
+    }
+
+    // no derivation for an invalid word count
+    assert_int_not_equal(bolos_ux_bip39_entropy_to_seed_start(&ctx, (const uint8_t *) "", 13),
+                         CX_OK);
+}
+
+static void test_bip39_entropy_to_seed(void **state) {
+    uint8_t expected[64], out[64];
+    uint8_t bits[33];
+
+    // the text rebuilt from the packed indexes is the one of the phrase, hashed first when it is
+    // longer than the HMAC block
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        const unsigned char *mnemonic = (const unsigned char *) vectors[v].mnemonic;
+        const size_t mnemonic_len = strlen(vectors[v].mnemonic);
+        const unsigned int word_count = hex_decode(vectors[v].entropy, bits) * 3 / 4;
+
+        bolos_ux_bip39_mnemonic_to_seed(mnemonic, mnemonic_len, expected);
+        assert_int_equal(bolos_ux_bip39_mnemonic_decode(mnemonic, mnemonic_len, bits, sizeof(bits)),
+                         1);
+        bolos_ux_bip39_entropy_to_seed(bits, word_count, out);
+        assert_memory_equal(out, expected, 64);
+    }
+}
+
+// French phrases, typed without their accents, and the seeds of their NFKD text (the 24-word one
+// being longer than the HMAC block)
+static const struct {
+    const char *entropy;
+    const char *mnemonic;
+    const char *seed;
+} french_vectors[] = {
+    {"7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f7f",
+     "implorer visage sonnette voyage veloce pourpre volaille tribunal implorer visage sonnette "
+     "voyelle",
+     "a7638456390ebf2cee5c7884cfa30865b9a262476f8bc4f85aa99fd305124efab8f68ed6adcc263117a65ac68cd1"
+     "baf44ce4e0409903bdea8d2ca65ce1d6a2d8"},
+    {"9e885d952ad362caeb4efe34a8e91bd2",
+     "monument depenser feroce entasser comedie ferveur optique sonnette codifier discuter dioxyde "
+     "nerveux",
+     "fdc2c01911906bae352c37668d5ff5ca7734ac8ddca35704488e3cdc0da8eb8bc5d1bcace093cc41b575d5591ffd"
+     "be1c261c2d0b511893256ea242dae4cd508f"},
+    {"f585c11aec520db57dd353c69554b21a89b20fb0650966fa0a9d6f74fd989d8f",
+     "vaillant chance dimanche secable bonus separer vecteur forcer raideur officier censurer "
+     "cohesion meuble agiter prison mutation filiere rincer novice solitude elargir renfort "
+     "gronder tornade",
+     "c0b98d650d39fbb29283cad045bdde49b8558433103722de2ef2323ab4b54a9dc682043e4e6458555761a9dfcb97"
+     "c1548da16b4aacb10cddecb5c666f934b32f"},
+};
+
+static void test_bip39_wordlist(void **state) {
+    (void) state;
+    uint8_t entropy[33], bits[33], expected[64], out[64];
+    unsigned char mnemonic[BIP39_MNEMONIC_MAX_LENGTH];
+
+    assert_int_equal(bolos_ux_bip39_wordlist_get(), BIP39_LANGUAGE_ENGLISH);
+    assert_int_equal(bolos_ux_bip39_wordlist_set(BIP39_LANGUAGE_COUNT), 0);
+    assert_int_equal(bolos_ux_bip39_wordlist_get(), BIP39_LANGUAGE_ENGLISH);
+
+    assert_int_equal(bolos_ux_bip39_wordlist_set(BIP39_LANGUAGE_FRENCH), 1);
+    for (size_t v = 0; v < sizeof(french_vectors) / sizeof(french_vectors[0]); v++) {
+        const size_t entropy_len = hex_decode(french_vectors[v].entropy, entropy);
+        const size_t mnemonic_len = strlen(french_vectors[v].mnemonic);
+
+        assert_int_equal(
+            bolos_ux_bip39_mnemonic_encode(entropy, entropy_len, mnemonic, sizeof(mnemonic)),
+            mnemonic_len);
+        assert_memory_equal(mnemonic, french_vectors[v].mnemonic, mnemonic_len);
+
+        // the accents are restored for the seed
+        hex_decode(french_vectors[v].seed, expected);
+        assert_int_equal(
+            bolos_ux_bip39_mnemonic_decode(mnemonic, mnemonic_len, bits, sizeof(bits)), 1);
+        bolos_ux_bip39_entropy_to_seed(bits, entropy_len * 3 / 4, out);
+        assert_memory_equal(out, expected, 64);
+    }
+    assert_int_equal(bolos_ux_bip39_get_word_idx_starting_with((const unsigned char *) "zool", 4),
+                     2047);
+
+    assert_int_equal(bolos_ux_bip39_wordlist_set(BIP39_LANGUAGE_ENGLISH), 1);
+    assert_int_equal(bolos_ux_bip39_get_word_idx_starting_with((const unsigned char *) "zoo", 3),
+                     2047);
+}
+
+// first Japanese vector of the reference implementation (python-mnemonic): the NFKD text of the
+// phrase, whose ideographic spaces become spaces, is the password of the seed (hashed first as it
+// is longer than the HMAC block) and the NFKD text of the passphrase follows "mnemonic" in the salt
+static void test_bip39_nfkd_vector(void **state) {
+    (void) state;
+    // NFKD text of the first word, written 11 times, and of the final one
+    static const char first_words[] =
+        "\xe3\x81\x82\xe3\x81\x84\xe3\x81\x93\xe3\x81\x8f\xe3\x81\x97\xe3\x82\x93";
+    static const char final_word[] =
+        "\xe3\x81\x82\xe3\x81\x8a\xe3\x81\x9d\xe3\x82\x99\xe3\x82\x89";
+    static const char salt[] =
+        "mnemonic"
+        "\xe3\x83\xa1\xe3\x83\xbc\xe3\x83\x88\xe3\x83\xab\xe3\x82\xab\xe3\x82\x99\xe3\x83\x8f"
+        "\xe3\x82\x99\xe3\x82\xa6\xe3\x82\x99\xe3\x82\xa1\xe3\x81\xaf\xe3\x82\x9a\xe3\x81\xaf"
+        "\xe3\x82\x99\xe3\x81\x8f\xe3\x82\x99\xe3\x82\x9d\xe3\x82\x99\xe3\x81\xa1\xe3\x81\xa1"
+        "\xe3\x82\x99\xe5\x8d\x81\xe4\xba\xba\xe5\x8d\x81\xe8\x89\xb2";
+    uint8_t expected[64], out[64];
+    uint8_t password[256];
+    size_t length = 0;
+
+    for (unsigned int i = 0; i < 11; i++) {
+        memcpy(password + length, first_words, strlen(first_words));
+        length += strlen(first_words);
+        password[length++] = ' ';
+    }
+    memcpy(password + length, final_word, strlen(final_word));
+    length += strlen(final_word);
+    assert_int_equal(length, 224);
+
+    hex_decode(
+        "a262d6fb6122ecf45be09c50492b31f92e9beb7d9a845987a02cefda57a15f9c467a17872029a9e92299b5cb"
+        "df306e3a0ee620245cbd508959b6cb7ca637bd55",
+        expected);
+    assert_int_equal(pbkdf2_sha512(password,
+                                   length,
+                                   (const uint8_t *) salt,
+                                   strlen(salt),
+                                   BIP39_PBKDF2_ROUNDS,
+                                   out,
+                                   sizeof(out)),
+                     CX_OK);
+    assert_memory_equal(out, expected, 64);
+}
+
+// informative only: cycles spent by the SDK function and the midstate one on a BIP39 seed
+static void test_pbkdf2_sha512_benchmark(void **state) {
+    uint8_t salt[] = "mnemonic";
+    uint8_t out[64];
+    const uint8_t *password = (const uint8_t *) vectors[0].mnemonic;
+    const size_t password_length = strlen(vectors[0].mnemonic);
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < 10; i++) {
+        cx_pbkdf2_sha512(password, password_length, salt, sizeof(salt) - 1, 2048, out, 64);
+    }
+    const clock_t sdk = clock() - start;
+
+    start = clock();
+    for (int i = 0; i < 10; i++) {
+        pbkdf2_sha512(password, password_length, salt, sizeof(salt) - 1, 2048, out, 64);
+    }
+    const clock_t midstate = clock() - start;
+
+    print_message("PBKDF2-HMAC-SHA512 x10: cx_pbkdf2_sha512 %ld clocks, pbkdf2_sha512 %ld clocks\n",
+                  (long) sdk,
+                  (long) midstate);
+}
+
 int main(void) {
     const struct CMUnitTest tests[] = {
-        cmocka_unit_test(test_bip39)
+        cmocka_unit_test(test_bip39),
+        cmocka_unit_test(test_bip39_mnemonic_check),
+        cmocka_unit_test(test_bip39_vectors),
+        cmocka_unit_test(test_bip39_final_word_candidates),
+        cmocka_unit_test(test_bip39_final_word_filter),
+        cmocka_unit_test(test_bip39_words_near),
+        cmocka_unit_test(test_bip39_near_word),
+        cmocka_unit_test(test_bip39_unique_word),
+        cmocka_unit_test(test_bits11),
+        cmocka_unit_test(test_pbkdf2_sha512),
+        cmocka_unit_test(test_bip39_seed_start),
+        cmocka_unit_test(test_bip39_entropy_to_seed),
+        cmocka_unit_test(test_bip39_wordlist),
+        cmocka_unit_test(test_bip39_nfkd_vector),
+        cmocka_unit_test(test_pbkdf2_sha512_benchmark)
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
@@ -0,0 +1,145 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+
+#include "testutils.h"
+#include "bip85.h"
+#include "bip39/common_bip39.h"
+
+// m/83696968' key and chain code of the BIP85 test vectors' master key
+// xprv9s21ZrQH143K2LBWUUQRFXhucrQqBpKdRRxNVq2zBqsx8HVqFk2uYo8kmbaLLHRdqtQpUm98uKfu3vca1LqdGhUtyoFnCNkfmXRyPXLjbKb
+static const uint8_t purpose_node[] = {
+    0x2b, 0xf4, 0xf4, 0x5f, 0x4a, 0xd1, 0xaa, 0x5e, 0x2d, 0x37, 0xb5, 0xcc, 0xec, 0xe5, 0x26, 0x29,
+    0x0b, 0x2c, 0x9d, 0xd4, 0x0a, 0x5a, 0x23, 0x1c, 0xdd, 0xa6, 0x72, 0xe8, 0x9a, 0x3c, 0xa0, 0xcb,
+    0x05, 0x4d, 0x2b, 0x0a, 0x84, 0xa5, 0x90, 0xc9, 0xf5, 0x7f, 0x1e, 0xbc, 0xfe, 0x53, 0x2b, 0xec,
+    0xcd, 0xb0, 0xd5, 0x97, 0xdc, 0x1e, 0x37, 0x6d, 0x5f, 0x12, 0xd6, 0xe6, 0xa5, 0x8c, 0x2f, 0x6f};
+
+static unsigned int derivations;
+
+cx_err_t os_derive_bip32_no_throw(cx_curve_t curve,
+                                  const uint32_t *path,
+                                  size_t path_length,
+                                  uint8_t *private_key,
+                                  uint8_t *chain_code) {
+    assert_int_equal(path_length, 1);
+    assert_int_equal(path[0], 0x80000000 | BIP85_PURPOSE);
+    memcpy(private_key, purpose_node, 32);
+    memcpy(chain_code, purpose_node + 32, 32);
+    derivations++;
+    return CX_OK;
+}
+
+// test case 1: m/83696968'/0'/0'
+static void test_bip85_entropy(void **state) {
+    const uint32_t path[] = {0};
+    const uint8_t expected[] = {
+        0xef, 0xec, 0xfb, 0xcc, 0xff, 0xea, 0x31, 0x32, 0x14, 0x23, 0x2d, 0x29, 0xe7, 0x15, 0x63,
+        0xd9, 0x41, 0x22, 0x9a, 0xfb, 0x43, 0x38, 0xc2, 0x1f, 0x95, 0x17, 0xc4, 0x1a, 0xaa, 0x0d,
+        0x16, 0xf0, 0x0b, 0x83, 0xd2, 0xa0, 0x9e, 0xf7, 0x47, 0xe7, 0xa6, 0x4e, 0x8e, 0x2b, 0xd5,
+        0xa1, 0x48, 0x69, 0xe6, 0x93, 0xda, 0x66, 0xce, 0x94, 0xac, 0x2d, 0xa5, 0x70, 0xab, 0x7e,
+        0xe4, 0x86, 0x18, 0xf7};
+    uint8_t entropy[BIP85_ENTROPY_LENGTH];
+
+    assert_true(bip85_entropy(path, 1, 0, entropy));
+    assert_memory_equal(entropy, expected, sizeof(expected));
+
+    assert_false(bip85_entropy(path, 1, BIP85_INDEX_MAX + 1, entropy));
+    assert_false(bip85_entropy(path, BIP85_APPLICATION_PATH_MAX_LENGTH + 1, 0, entropy));
+    bip85_node_clear();
+}
+
+static void test_bip85_bip39(void **state) {
+    const struct {
+        unsigned int word_count;
+        uint32_t index;
+        const char *mnemonic;
+    } vectors[] = {
+        {12, 0, "girl mad pet galaxy egg matter matrix prison refuse sense ordinary nose"},
+        {12, 1, "mystery car occur shallow stable order number feature else best trigger curious"},
+        {18,
+         0,
+         "near account window bike charge season chef number sketch tomorrow excuse sniff circle "
+         "vital hockey outdoor supply token"},
+        {24,
+         0,
+         "puppy ocean match cereal symbol another shed magic wrap hammer bulb intact gadget "
+         "divorce twin tonight reason outdoor destroy simple truth cigar social volcano"},
+    };
+    uint8_t entropy[32];
+    char mnemonic[BIP39_WORDLIST_WORD_LETTERS * 24 + 24];
+
+    derivations = 0;
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        assert_true(bip85_bip39_entropy(vectors[i].word_count, vectors[i].index, entropy));
+        const unsigned int length = bolos_ux_bip39_mnemonic_encode(entropy,
+                                                                   vectors[i].word_count * 4 / 3,
+                                                                   (unsigned char *) mnemonic,
+                                                                   sizeof(mnemonic));
+        assert_int_equal(length, strlen(vectors[i].mnemonic));
+        assert_memory_equal(mnemonic, vectors[i].mnemonic, length);
+    }
+    // m/83696968' is only derived by the OS once
+    assert_int_equal(derivations, 1);
+    assert_true(bip85_node_cached());
+
+    assert_false(bip85_bip39_entropy(13, 0, entropy));
+
+    bip85_node_clear();
+    assert_false(bip85_node_cached());
+    assert_true(bip85_bip39_entropy(12, 0, entropy));
+    assert_int_equal(derivations, 2);
+    bip85_node_clear();
+}
+
+static void test_bip85_text(void **state) {
+    const struct {
+        uint32_t application;
+        uint32_t length;
+        const char *text;
+    } vectors[] = {
+        {BIP85_APPLICATION_BIP39,
+         12,
+         "girl mad pet galaxy egg matter matrix prison refuse sense ordinary nose"},
+        {BIP85_APPLICATION_HEX,
+         64,
+         "492db4698cf3b73a5a24998aa3e9d7fa96275d85724a91e71aa2d645442f878555d078fd1f1f67e368976f041"
+         "37b1f7a0d19232136ca50c44614af72b5582a5c"},
+        {BIP85_APPLICATION_PWD_BASE64, 21, "dKLoepugzdVJvdL56ogNV"},
+        {BIP85_APPLICATION_PWD_BASE85, 12, "_s`{TW89)i4`"},
+        {BIP85_APPLICATION_XPRV,
+         0,
+         "xprv9s21ZrQH143K2srSbCSg4m4kLvPMzcWydgmKEnMmoZUurYuBuYG46c6P71UGXMzmriLzCCBvKQWBUv3vPB3m1"
+         "SATMhp3uEjXHJ42jFg7myX"},
+    };
+    char text[256];
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        assert_int_equal(
+            bip85_text(vectors[i].application, vectors[i].length, 0, text, sizeof(text)),
+            strlen(vectors[i].text));
+        assert_string_equal(text, vectors[i].text);
+    }
+
+    // the longest passwords, the base64 one being cut before its padding
+    assert_int_equal(bip85_text(BIP85_APPLICATION_PWD_BASE64, 86, 0, text, sizeof(text)), 86);
+    assert_int_equal(bip85_text(BIP85_APPLICATION_PWD_BASE85, 80, 0, text, sizeof(text)), 80);
+
+    // invalid lengths, and a text not fitting the buffer
+    assert_int_equal(bip85_text(BIP85_APPLICATION_HEX, 15, 0, text, sizeof(text)), 0);
+    assert_int_equal(bip85_text(BIP85_APPLICATION_PWD_BASE64, 87, 0, text, sizeof(text)), 0);
+    assert_int_equal(bip85_text(BIP85_APPLICATION_PWD_BASE85, 9, 0, text, sizeof(text)), 0);
+    assert_int_equal(bip85_text(128, 0, 0, text, sizeof(text)), 0);
+    assert_int_equal(bip85_text(BIP85_APPLICATION_XPRV, 0, 0, text, 111), 0);
+    assert_string_equal(text, "");
+    bip85_node_clear();
+}
+
+int main(void) {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_bip85_entropy),
+                                       cmocka_unit_test(test_bip85_bip39),
+                                       cmocka_unit_test(test_bip85_text)};
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,186 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+
+#include "testutils.h"
+#include "codex32/codex32.h"
+
+// BIP93 test vectors
+static const char secret_128[] = "ms10testsxxxxxxxxxxxxxxxxxxxxxxxxxx4nzvca9cmczlw";
+static const char share_a[] = "MS12NAMEA320ZYXWVUTSRQPNMLKJHGFEDCAXRPP870HKKQRM";
+static const char share_c[] = "MS12NAMECACDEFGHJKLMNPQRSTUVWXYZ023FTR2GDZMPY6PN";
+static const char secret_256[] =
+    "ms10leetsllhdmn9m42vcsamx24zrxgs3qrl7ahwvhw4fnzrhve25gvezzyqqtum9pgv99ycma";
+static const char secret_512[] =
+    "MS100C8VSM32ZXFGUHPCHTLUPZRY9X8GF2TVDW0S3JN54KHCE6MUA7LQPZYGSFJD6AN074RXVCEMLH8WU3TK925ACDEF"
+    "GHJKLMNPQRSTUVWXY06FHPV80UNDVARHRAK";
+
+// read the data part of the string as a share, every character but the last being accepted
+static codex32_char_status_t codex32_string_read(const char *string,
+                                                 size_t secret_length,
+                                                 codex32_share_t *shares,
+                                                 size_t share_count) {
+    codex32_reader_t reader;
+    codex32_char_status_t status = CODEX32_CHAR_ACCEPTED;
+    const size_t length = strlen(string);
+
+    assert_true(codex32_reader_start(&reader, secret_length));
+    assert_int_equal(reader.final_length, length - 3);
+    for (size_t i = 3; i < length && status == CODEX32_CHAR_ACCEPTED; i++) {
+        status = codex32_reader_char_add(&reader, string[i], shares, share_count);
+        assert_int_equal(reader.share.length,
+                         status <= CODEX32_SHARE_COMPLETE ? i - 2 : i - 3);
+    }
+    if (status == CODEX32_SHARE_COMPLETE) {
+        shares[share_count] = reader.share;
+    }
+    return status;
+}
+
+static void test_codex32_checksum(void **state __attribute__((unused))) {
+    const char *strings[] = {secret_128, share_a, share_c, secret_256, secret_512};
+
+    for (size_t n = 0; n < sizeof(strings) / sizeof(strings[0]); n++) {
+        const size_t length = strlen(strings[n]);
+        const bool long_checksum = length - 3 > CODEX32_SHORT_MAX_LENGTH;
+        codex32_residue_t residue;
+
+        codex32_checksum_init(&residue);
+        for (size_t i = 3; i < length; i++) {
+            const int8_t value = codex32_char_value(strings[n][i]);
+            assert_true(value >= 0);
+            codex32_checksum_update(&residue, value, long_checksum);
+        }
+        assert_true(codex32_checksum_verify(&residue, long_checksum));
+        // a substituted character is detected
+        codex32_checksum_init(&residue);
+        for (size_t i = 3; i < length; i++) {
+            const uint8_t value = codex32_char_value(strings[n][i]);
+            codex32_checksum_update(&residue, i == length / 2 ? value ^ 1 : value, long_checksum);
+        }
+        assert_false(codex32_checksum_verify(&residue, long_checksum));
+    }
+    assert_int_equal(codex32_char_value('q'), 0);
+    assert_int_equal(codex32_char_value('L'), 31);
+    assert_int_equal(codex32_char_value('s'), CODEX32_SECRET_INDEX);
+    assert_int_equal(codex32_char_value('1'), -1);
+    assert_int_equal(codex32_char_value('b'), -1);
+    assert_int_equal(codex32_char_value('\0'), -1);
+}
+
+static void test_codex32_secret(void **state __attribute__((unused))) {
+    const uint8_t expected_128[] = {0x31, 0x8c, 0x63, 0x18, 0xc6, 0x31, 0x8c, 0x63,
+                                    0x18, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xc6, 0x31};
+    const uint8_t expected_256[] = {0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa, 0x99, 0x88, 0x77, 0x66, 0x55,
+                                    0x44, 0x33, 0x22, 0x11, 0x00, 0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa,
+                                    0x99, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0x00};
+    const uint8_t expected_512[] = {
+        0xdc, 0x54, 0x23, 0x25, 0x1c, 0xb8, 0x71, 0x75, 0xff, 0x81, 0x10, 0xc8, 0x53,
+        0x1d, 0x09, 0x52, 0xd8, 0xd7, 0x3e, 0x11, 0x94, 0xe9, 0x5b, 0x5f, 0x19, 0xd6,
+        0xf9, 0xdf, 0x7c, 0x01, 0x11, 0x11, 0x04, 0xc9, 0xba, 0xec, 0xdf, 0xea, 0x8c,
+        0xcc, 0xc6, 0x77, 0xfb, 0x9d, 0xdc, 0x8a, 0xec, 0x55, 0x53, 0xb8, 0x6e, 0x52,
+        0x8b, 0xca, 0xdf, 0xdc, 0xc2, 0x01, 0xc1, 0x7c, 0x63, 0x8c, 0x47, 0xe9};
+    codex32_share_t shares[1];
+    uint8_t secret[CODEX32_MAX_SECRET_SIZE];
+
+    assert_int_equal(codex32_string_read(secret_128, 16, shares, 0), CODEX32_SHARE_COMPLETE);
+    assert_true(codex32_shares_complete(shares, 1));
+    assert_int_equal(codex32_combine(shares, 1, secret, sizeof(secret)), 16);
+    assert_memory_equal(secret, expected_128, 16);
+
+    assert_int_equal(codex32_string_read(secret_256, 32, shares, 0), CODEX32_SHARE_COMPLETE);
+    assert_int_equal(codex32_combine(shares, 1, secret, sizeof(secret)), 32);
+    assert_memory_equal(secret, expected_256, 32);
+
+    // long checksum
+    assert_int_equal(codex32_string_read(secret_512, 64, shares, 0), CODEX32_SHARE_COMPLETE);
+    assert_int_equal(codex32_combine(shares, 1, secret, sizeof(secret)), 64);
+    assert_memory_equal(secret, expected_512, 64);
+    assert_int_equal(codex32_combine(shares, 1, secret, 32), 0);
+}
+
+static void test_codex32_shares(void **state __attribute__((unused))) {
+    const uint8_t expected[] = {0xd1, 0x80, 0x8e, 0x09, 0x6b, 0x35, 0xb2, 0x09,
+                                0xca, 0x12, 0x13, 0x2b, 0x26, 0x46, 0x62, 0xa5};
+    codex32_share_t shares[2];
+    uint8_t secret[CODEX32_MAX_SECRET_SIZE];
+
+    assert_int_equal(codex32_string_read(share_a, 16, shares, 0), CODEX32_SHARE_COMPLETE);
+    assert_false(codex32_shares_complete(shares, 1));
+    assert_int_equal(codex32_string_read(share_c, 16, shares, 1), CODEX32_SHARE_COMPLETE);
+    assert_true(codex32_shares_complete(shares, 2));
+    assert_int_equal(codex32_combine(shares, 2, secret, sizeof(secret)), 16);
+    assert_memory_equal(secret, expected, sizeof(expected));
+    // the order of the shares does not matter
+    shares[1] = shares[0];
+    assert_int_equal(codex32_string_read(share_c, 16, shares, 0), CODEX32_SHARE_COMPLETE);
+    assert_int_equal(codex32_combine(shares, 2, secret, sizeof(secret)), 16);
+    assert_memory_equal(secret, expected, sizeof(expected));
+}
+
+static void test_codex32_reader_errors(void **state __attribute__((unused))) {
+    codex32_share_t shares[2];
+    codex32_reader_t reader;
+
+    assert_false(codex32_reader_start(&reader, 15));
+    assert_false(codex32_reader_start(&reader, 65));
+    assert_int_equal(codex32_string_read(share_a, 16, shares, 0), CODEX32_SHARE_COMPLETE);
+
+    // not bech32 characters, an invalid threshold, and an unshared secret of another index
+    assert_true(codex32_reader_start(&reader, 16));
+    assert_int_equal(codex32_reader_char_add(&reader, 'b', NULL, 0), CODEX32_CHAR_INVALID);
+    assert_int_equal(codex32_reader_char_add(&reader, '1', NULL, 0), CODEX32_CHAR_INVALID);
+    assert_int_equal(codex32_reader_char_add(&reader, 'x', NULL, 0), CODEX32_CHAR_INVALID_HEADER);
+    assert_int_equal(codex32_reader_char_add(&reader, '0', NULL, 0), CODEX32_CHAR_ACCEPTED);
+    for (size_t i = 0; i < 4; i++) {
+        assert_int_equal(codex32_reader_char_add(&reader, 'q', NULL, 0), CODEX32_CHAR_ACCEPTED);
+    }
+    assert_int_equal(codex32_reader_char_add(&reader, 'a', NULL, 0), CODEX32_CHAR_INVALID_HEADER);
+    assert_int_equal(reader.share.length, 5);
+
+    // another threshold, another identifier, the same index
+    assert_true(codex32_reader_start(&reader, 16));
+    assert_int_equal(codex32_reader_char_add(&reader, '3', shares, 1), CODEX32_CHAR_MISMATCH);
+    assert_int_equal(codex32_reader_char_add(&reader, '2', shares, 1), CODEX32_CHAR_ACCEPTED);
+    assert_int_equal(codex32_reader_char_add(&reader, 'n', shares, 1), CODEX32_CHAR_ACCEPTED);
+    assert_int_equal(codex32_reader_char_add(&reader, 'b', shares, 1), CODEX32_CHAR_INVALID);
+    assert_int_equal(codex32_reader_char_add(&reader, 'm', shares, 1), CODEX32_CHAR_MISMATCH);
+    assert_int_equal(codex32_reader_char_add(&reader, 'A', shares, 1), CODEX32_CHAR_ACCEPTED);
+    assert_int_equal(codex32_reader_char_add(&reader, 'm', shares, 1), CODEX32_CHAR_ACCEPTED);
+    assert_int_equal(codex32_reader_char_add(&reader, 'e', shares, 1), CODEX32_CHAR_ACCEPTED);
+    assert_int_equal(codex32_reader_char_add(&reader, 'a', shares, 1), CODEX32_CHAR_MISMATCH);
+
+    // a mistyped character fails the checksum, once removed the share is complete
+    assert_true(codex32_reader_start(&reader, 16));
+    for (size_t i = 3; i < strlen(share_c) - 1; i++) {
+        const char c = i == 20 ? 'q' : share_c[i];
+        assert_int_equal(codex32_reader_char_add(&reader, c, shares, 1), CODEX32_CHAR_ACCEPTED);
+    }
+    assert_int_equal(codex32_reader_char_add(&reader, 'n', shares, 1),
+                     CODEX32_CHAR_INVALID_CHECKSUM);
+    assert_int_equal(reader.share.length, strlen(share_c) - 4);
+    while (reader.share.length > 20 - 3) {
+        assert_true(codex32_reader_char_remove(&reader));
+    }
+    for (size_t i = 20; i < strlen(share_c) - 1; i++) {
+        assert_int_equal(codex32_reader_char_add(&reader, share_c[i], shares, 1),
+                         CODEX32_CHAR_ACCEPTED);
+    }
+    assert_int_equal(codex32_reader_char_add(&reader, 'n', shares, 1), CODEX32_SHARE_COMPLETE);
+    assert_int_equal(codex32_reader_char_add(&reader, 'n', shares, 1), CODEX32_CHAR_MISMATCH);
+    while (codex32_reader_char_remove(&reader)) {
+    }
+    assert_int_equal(reader.share.length, 0);
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_codex32_checksum),
+                                       cmocka_unit_test(test_codex32_secret),
+                                       cmocka_unit_test(test_codex32_shares),
+                                       cmocka_unit_test(test_codex32_reader_errors)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,60 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+
+#include "testutils.h"
+#include "bip39/common_bip39.h"
+#include "bip39/pbkdf2_sha512.h"
+
+// standard (version 0x01) seed from the Electrum test suite
+static const char mnemonic[] =
+    "cycle rocket west magnet parrot shuffle foot correct salt library feed song";
+
+static const uint8_t seed[] = {
+    0x00, 0x30, 0x2d, 0x7d, 0xb1, 0x62, 0xde, 0x47, 0xe6, 0xcd, 0x50, 0x74, 0x22, 0x1a, 0xee, 0x6b,
+    0xbc, 0xb6, 0xbe, 0x93, 0x98, 0x2a, 0xf9, 0x0c, 0x04, 0xd0, 0xe7, 0x71, 0x0d, 0xd2, 0x60, 0x13,
+    0xae, 0xb7, 0x84, 0x88, 0x50, 0xa5, 0x6a, 0x54, 0x6e, 0x79, 0x55, 0xb3, 0x60, 0xe5, 0x61, 0x13,
+    0x9d, 0x62, 0x80, 0x5f, 0x2d, 0x5d, 0x3c, 0x94, 0x08, 0x80, 0xb0, 0xdc, 0x91, 0xb6, 0x0b, 0x29};
+
+static void test_electrum_check(void **state) {
+    unsigned char buffer[sizeof(mnemonic)];
+
+    memcpy(buffer, mnemonic, sizeof(mnemonic));
+    assert_int_equal(bolos_ux_electrum_bip39_mnemonic_check(ELECTRUM_SEED_PREFIX_STANDARD,
+                                                            buffer,
+                                                            sizeof(mnemonic) - 1),
+                     1);
+    assert_int_equal(bolos_ux_electrum_bip39_mnemonic_check(0x02, buffer, sizeof(mnemonic) - 1),
+                     0);
+
+    // "song" -> "sing"
+    buffer[sizeof(mnemonic) - 4] = 'i';
+    assert_int_equal(bolos_ux_electrum_bip39_mnemonic_check(ELECTRUM_SEED_PREFIX_STANDARD,
+                                                            buffer,
+                                                            sizeof(mnemonic) - 1),
+                     0);
+}
+
+static void test_electrum_seed(void **state) {
+    pbkdf2_sha512_t ctx;
+    uint8_t out[64];
+
+    assert_int_equal(bolos_ux_electrum_mnemonic_to_seed_start(&ctx,
+                                                              (const unsigned char *) mnemonic,
+                                                              sizeof(mnemonic) - 1),
+                     CX_OK);
+    while (ctx.rounds_left > 0) {
+        assert_int_equal(pbkdf2_sha512_step(&ctx, 128), CX_OK);
+    }
+    assert_int_equal(pbkdf2_sha512_final(&ctx, out, 64), CX_OK);
+    assert_memory_equal(out, seed, 64);
+}
+
+int main(void) {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_electrum_check),
+                                       cmocka_unit_test(test_electrum_seed)};
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
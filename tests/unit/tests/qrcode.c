@@ -0,0 +1,159 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+
+#include "testutils.h"
+#include "qrcode/qrcode.h"
+
+// CompactSeedQR of the BIP39 test vectors "legal winner thank year wave sausage worth useful legal
+// winner thank yellow" (0x7f entropy bytes) and "letter advice cage absurd amount doctor acoustic
+// avoid letter advice cage absurd amount doctor acoustic avoid letter advice cage absurd amount
+// doctor acoustic bless" (0x80 entropy bytes), as output by a reference encoder with the masks
+// of lowest penalty
+static const char *compact_seedqr_12[] = {
+    "111111100101001111111",
+    "100000101000001000001",
+    "101110101010001011101",
+    "101110100100101011101",
+    "101110101111001011101",
+    "100000101111001000001",
+    "111111101010101111111",
+    "000000001000100000000",
+    "110100110010001110110",
+    "101001000010101010101",
+    "010111110111100101001",
+    "111011011101101011000",
+    "001011100101010101010",
+    "000000001000111000111",
+    "111111101110111110010",
+    "100000100110100010010",
+    "101110100011000111011",
+    "101110101011100011101",
+    "101110100011110111001",
+    "100000101100110000000",
+    "111111101110011100010",
+};
+
+static const char *compact_seedqr_24[] = {
+    "1111111000101010101111111",
+    "1000001001000100001000001",
+    "1011101011101110101011101",
+    "1011101001010101001011101",
+    "1011101000101010101011101",
+    "1000001001000100001000001",
+    "1111111010101010101111111",
+    "0000000010010001000000000",
+    "1110111110101010111000100",
+    "1010000101010101010111010",
+    "0101001010111011101010100",
+    "1010000101010001010101110",
+    "1100111100101010100010101",
+    "0001010010010101010111010",
+    "1010001101011011101010100",
+    "0110100010010001010101110",
+    "1010101111001010111110101",
+    "0000000010010101100011010",
+    "1111111011111010101010100",
+    "1000001011010001100011110",
+    "1011101011101011111110101",
+    "1011101001010101011101011",
+    "1011101010111010101000101",
+    "1000001010110001010101110",
+    "1111111011001010001010111",
+};
+
+// alphanumeric mode: single part UR of the ByteWords test vector (bytes 0x00 0x01 0x02 0x80 0xff)
+static const char *ur_bytes[] = {
+    "1111111010101011101111111",
+    "1000001001111000001000001",
+    "1011101011100110001011101",
+    "1011101011101010101011101",
+    "1011101010011111001011101",
+    "1000001000110101101000001",
+    "1111111010101010101111111",
+    "0000000000101011000000000",
+    "1111001010111100010011101",
+    "0011110110101101101100101",
+    "1101001111111100101111111",
+    "0001100011100001101110011",
+    "1100111001101011001001010",
+    "0001100001011011011011000",
+    "0111001100010101110101100",
+    "1001010100110010000000100",
+    "0010101111001010111111000",
+    "0000000010000010100011110",
+    "1111111000000110101011010",
+    "1000001000110111100010100",
+    "1011101001100111111111111",
+    "1011101010100000100100001",
+    "1011101010100011000111110",
+    "1000001011111111111000001",
+    "1111111010010000000010001",
+};
+
+static void assert_qrcode_equal(const qrcode_t *qrcode, const char **rows, size_t size) {
+    assert_int_equal(qrcode->size, size);
+    for (uint8_t y = 0; y < size; y++) {
+        for (uint8_t x = 0; x < size; x++) {
+            assert_int_equal(qrcode_module_get(qrcode, x, y), rows[y][x] == '1');
+        }
+    }
+}
+
+static void test_qrcode_compact_seedqr(void **state __attribute__((unused))) {
+    uint8_t entropy[32];
+    qrcode_t qrcode;
+
+    memset(entropy, 0x7f, 16);
+    assert_true(qrcode_encode_bytes(&qrcode, entropy, 16));
+    assert_int_equal(qrcode.version, 1);
+    assert_qrcode_equal(&qrcode, compact_seedqr_12, QRCODE_SIZE(1));
+
+    memset(entropy, 0x80, 32);
+    assert_true(qrcode_encode_bytes(&qrcode, entropy, 32));
+    assert_int_equal(qrcode.version, 2);
+    assert_qrcode_equal(&qrcode, compact_seedqr_24, QRCODE_SIZE(2));
+}
+
+static void test_qrcode_versions(void **state __attribute__((unused))) {
+    // byte mode capacities at the L level: 17, 32 and 53 bytes
+    const size_t lengths[] = {0, 17, 18, 24, 32, 33, 53};
+    const uint8_t versions[] = {1, 1, 2, 2, 2, 3, 3};
+    uint8_t data[54] = {0};
+    qrcode_t qrcode;
+
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        assert_true(qrcode_encode_bytes(&qrcode, data, lengths[i]));
+        assert_int_equal(qrcode.version, versions[i]);
+        assert_int_equal(qrcode.size, QRCODE_SIZE(versions[i]));
+    }
+    assert_false(qrcode_encode_bytes(&qrcode, data, sizeof(data)));
+}
+
+static void test_qrcode_alphanumeric(void **state __attribute__((unused))) {
+    const char text[] = "UR:BYTES/AEADAOLAZMJENDEOTI";
+    char long_text[QRCODE_ALPHANUMERIC_MAX_LENGTH + 1];
+    qrcode_t qrcode;
+
+    assert_true(qrcode_encode_alphanumeric(&qrcode, text, strlen(text)));
+    assert_int_equal(qrcode.version, 2);
+    assert_qrcode_equal(&qrcode, ur_bytes, QRCODE_SIZE(2));
+    // lower case letters are not part of the alphanumeric mode
+    assert_false(qrcode_encode_alphanumeric(&qrcode, "ur:bytes", 8));
+
+    memset(long_text, 'A', sizeof(long_text));
+    assert_true(qrcode_encode_alphanumeric(&qrcode, long_text, QRCODE_ALPHANUMERIC_MAX_LENGTH));
+    assert_int_equal(qrcode.version, QRCODE_MAX_VERSION);
+    assert_false(qrcode_encode_alphanumeric(&qrcode, long_text, sizeof(long_text)));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_qrcode_compact_seedqr),
+                                       cmocka_unit_test(test_qrcode_versions),
+                                       cmocka_unit_test(test_qrcode_alphanumeric)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
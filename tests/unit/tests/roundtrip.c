@@ -58,10 +58,14 @@
 #include <cmocka.h>
 #include <string.h>
 
+#include <lcx_hmac.h>
+#include <lcx_rng.h>
+
 #include "testutils.h"
 #include "constants.h"
 #include "bip39/common_bip39.h"
 #include "sskr/common_sskr.h"
+#include "slip39/common_slip39.h"
 
 const unsigned char bip39_mnemonic[] = "toe priority custom gauge jacket theme arrest bargain gloom wide ill fit eagle prepare capable fish limb cigar reform other priority speak rough imitate";
 
@@ -145,10 +149,199 @@ static void test_sskr_to_bip39(void **state) {
     assert_memory_equal(bip39_mnemonic, bip39_word_buffer, buf_len);
 }
 
+static void test_bip39_entropy(void **state) {
+    unsigned char entropy[BIP39_ENTROPY_MAX_LENGTH] = {0};
+    unsigned char bip39_word_buffer[sizeof(bip39_mnemonic)];
+    unsigned int word_number = 0;
+    unsigned int i = 0;
+
+    // pack the words as they would be selected, one index at a time
+    while (i < sizeof(bip39_mnemonic) - 1) {
+        unsigned int j = i;
+        while (j < sizeof(bip39_mnemonic) - 1 && bip39_mnemonic[j] != ' ') {
+            j++;
+        }
+        unsigned int index = bolos_ux_bip39_get_word_idx_starting_with(bip39_mnemonic + i, j - i);
+        bolos_ux_bip39_entropy_word_set(entropy, word_number, index);
+        assert_int_equal(bolos_ux_bip39_entropy_word_get(entropy, word_number), index);
+        word_number++;
+        i = j + 1;
+    }
+    assert_int_equal(word_number, BIP39_MNEMONIC_SIZE_24);
+    assert_memory_equal(entropy, bip39_hex, sizeof(bip39_hex));
+    assert_int_equal(bolos_ux_bip39_entropy_check(entropy, BIP39_MNEMONIC_SIZE_24), 1);
+
+    assert_int_equal(bolos_ux_bip39_entropy_to_mnemonic(entropy,
+                                                        BIP39_MNEMONIC_SIZE_24,
+                                                        bip39_word_buffer,
+                                                        sizeof(bip39_word_buffer)),
+                     sizeof(bip39_mnemonic) - 1);
+    assert_memory_equal(bip39_word_buffer, bip39_mnemonic, sizeof(bip39_mnemonic) - 1);
+    // no room for the last letter
+    assert_int_equal(bolos_ux_bip39_entropy_to_mnemonic(entropy,
+                                                        BIP39_MNEMONIC_SIZE_24,
+                                                        bip39_word_buffer,
+                                                        sizeof(bip39_word_buffer) - 2),
+                     0);
+
+    // overwriting a word clears its previous bits
+    bolos_ux_bip39_entropy_word_set(entropy, 5, 0);
+    assert_int_equal(bolos_ux_bip39_entropy_word_get(entropy, 5), 0);
+    assert_int_equal(bolos_ux_bip39_entropy_check(entropy, BIP39_MNEMONIC_SIZE_24), 0);
+    bolos_ux_bip39_entropy_checksum_set(entropy, BIP39_MNEMONIC_SIZE_24);
+    assert_int_equal(bolos_ux_bip39_entropy_check(entropy, BIP39_MNEMONIC_SIZE_24), 1);
+    assert_int_equal(bolos_ux_bip39_entropy_check(entropy, 13), 0);
+
+    assert_int_equal(bolos_ux_sskr_to_bip39_entropy_convert(sskr_hex,
+                                                            sizeof(sskr_hex),
+                                                            sskr_group_descriptor[0],
+                                                            entropy),
+                     BIP39_MNEMONIC_SIZE_24);
+    assert_memory_equal(entropy, bip39_hex, sizeof(bip39_hex));
+}
+
+// BIP32 master key (private key and chain code) of the wallet a SLIP-39 wallet restores from the
+// shares generated from the phrase, that of the 256-bit master secret bip39_hex
+const uint8_t slip39_master_key[] = {
+    0xf7, 0x1b, 0x38, 0xb3, 0x37, 0x55, 0x2b, 0x02, 0x04, 0x4a, 0x33, 0x05, 0x1a, 0x25, 0x4c, 0x25,
+    0xec, 0xbf, 0x33, 0xc0, 0xfe, 0xf8, 0xa9, 0x06, 0xc6, 0xd5, 0xd0, 0x21, 0x72, 0xd9, 0x9a, 0xb4,
+    0xab, 0x61, 0xf8, 0x22, 0xe5, 0x9d, 0x3c, 0x6b, 0x29, 0x27, 0x09, 0x3f, 0x01, 0x78, 0x0a, 0x46,
+    0xba, 0x5b, 0x1e, 0xa0, 0x69, 0xa5, 0x00, 0x72, 0xf3, 0x80, 0xa5, 0xda, 0xda, 0x87, 0x70, 0xec};
+
+static void bip32_master_key(const uint8_t *seed, size_t seed_length, uint8_t key[64]) {
+    const char bitcoin_seed[] = "Bitcoin seed";
+
+    cx_hmac_sha512(
+        (const uint8_t *) bitcoin_seed, strlen(bitcoin_seed), seed, seed_length, key, 64);
+}
+
+// SLIP-39 shares are generated from the entropy of the phrase as the application does, and then
+// restored as a SLIP-39 wallet would: the master secret is the entropy, which gives the phrase
+// back, but the wallet of the master secret is not the one of the phrase
+static void test_bip39_to_slip39(void **state) {
+    const slip39_group_descriptor_t group = {.threshold = 2, .count = 3};
+    const size_t word_count = SLIP39_WORDS(32);
+    slip39_share_t shares[3];
+    slip39_share_t read[2];
+    uint16_t words[SLIP39_MAX_WORDS];
+    uint8_t secret[32];
+    uint8_t seed[64];
+    uint8_t key[64];
+    unsigned char entropy[BIP39_ENTROPY_MAX_LENGTH] = {0};
+    unsigned char bip39_word_buffer[sizeof(bip39_mnemonic)];
+    slip39_cipher_t cipher;
+    slip39_reader_t reader;
+
+    assert_int_equal(
+        slip39_cipher_start(&cipher, false, bip39_hex, sizeof(secret), NULL, 0, 0x1234, true, 0),
+        CX_OK);
+    while (slip39_cipher_step(&cipher, 5000) < 100) {
+    }
+    assert_int_equal(slip39_cipher_final(&cipher, secret, sizeof(secret)), CX_OK);
+    assert_int_equal(
+        slip39_split(secret, sizeof(secret), 0x1234, true, 0, 1, &group, 1, shares, 3, cx_rng),
+        3);
+
+    // the 3rd and 1st shares, from their words
+    for (size_t i = 0; i < 2; i++) {
+        assert_int_equal(slip39_share_encode(&shares[2 - 2 * i], words, SLIP39_MAX_WORDS),
+                         word_count);
+        assert_true(slip39_reader_start(&reader, word_count));
+        for (size_t j = 0; j < word_count; j++) {
+            assert_int_not_equal(slip39_reader_word_add(&reader, words[j], read, i),
+                                 SLIP39_WORD_MISMATCH);
+        }
+        read[i] = reader.share;
+    }
+    assert_true(slip39_shares_complete(read, 2));
+    assert_int_equal(slip39_combine(read, 2, secret), sizeof(secret));
+    assert_int_equal(
+        slip39_cipher_start(&cipher, true, secret, sizeof(secret), NULL, 0, 0x1234, true, 0),
+        CX_OK);
+    while (slip39_cipher_step(&cipher, 5000) < 100) {
+    }
+    assert_int_equal(slip39_cipher_final(&cipher, secret, sizeof(secret)), CX_OK);
+
+    // the master secret is the entropy of the phrase, which the application recovers
+    assert_memory_equal(secret, bip39_hex, sizeof(secret));
+    memcpy(entropy, secret, sizeof(secret));
+    bolos_ux_bip39_entropy_checksum_set(entropy, BIP39_MNEMONIC_SIZE_24);
+    assert_int_equal(bolos_ux_bip39_entropy_to_mnemonic(entropy,
+                                                        BIP39_MNEMONIC_SIZE_24,
+                                                        bip39_word_buffer,
+                                                        sizeof(bip39_word_buffer)),
+                     sizeof(bip39_mnemonic) - 1);
+    assert_memory_equal(bip39_word_buffer, bip39_mnemonic, sizeof(bip39_mnemonic) - 1);
+
+    // a SLIP-39 wallet takes the master secret as the BIP32 seed, unlike the PBKDF2 of the phrase
+    bip32_master_key(secret, sizeof(secret), key);
+    assert_memory_equal(key, slip39_master_key, sizeof(key));
+    bolos_ux_bip39_mnemonic_to_seed(bip39_mnemonic, sizeof(bip39_mnemonic) - 1, seed);
+    bip32_master_key(seed, sizeof(seed), key);
+    assert_memory_not_equal(key, slip39_master_key, sizeof(key));
+}
+
+// the 27-word shares of the entropy of an 18-word phrase, a 192-bit master secret
+static void test_bip39_18_words_to_slip39(void **state) {
+    const slip39_group_descriptor_t group = {.threshold = 2, .count = 2};
+    const size_t word_count = SLIP39_WORDS(24);
+    slip39_share_t shares[2];
+    slip39_share_t read[2];
+    uint16_t words[SLIP39_MAX_WORDS];
+    uint8_t secret[24];
+    unsigned char entropy[BIP39_ENTROPY_MAX_LENGTH] = {0};
+    unsigned char bip39_word_buffer[sizeof(bip39_mnemonic)];
+    unsigned int length;
+    slip39_cipher_t cipher;
+    slip39_reader_t reader;
+
+    assert_int_equal(word_count, 27);
+    memcpy(entropy, bip39_hex, sizeof(secret));
+    bolos_ux_bip39_entropy_checksum_set(entropy, BIP39_MNEMONIC_SIZE_18);
+    length = bolos_ux_bip39_entropy_to_mnemonic(entropy,
+                                                BIP39_MNEMONIC_SIZE_18,
+                                                bip39_word_buffer,
+                                                sizeof(bip39_word_buffer));
+    assert_int_not_equal(length, 0);
+    assert_true(bolos_ux_bip39_mnemonic_check(bip39_word_buffer, length));
+
+    assert_int_equal(
+        slip39_cipher_start(&cipher, false, entropy, sizeof(secret), NULL, 0, 0x4321, true, 0),
+        CX_OK);
+    while (slip39_cipher_step(&cipher, 5000) < 100) {
+    }
+    assert_int_equal(slip39_cipher_final(&cipher, secret, sizeof(secret)), CX_OK);
+    assert_int_equal(
+        slip39_split(secret, sizeof(secret), 0x4321, true, 0, 1, &group, 1, shares, 2, cx_rng),
+        2);
+
+    for (size_t i = 0; i < 2; i++) {
+        assert_int_equal(slip39_share_encode(&shares[i], words, SLIP39_MAX_WORDS), word_count);
+        assert_true(slip39_reader_start(&reader, word_count));
+        for (size_t j = 0; j < word_count; j++) {
+            assert_int_not_equal(slip39_reader_word_add(&reader, words[j], read, i),
+                                 SLIP39_WORD_MISMATCH);
+        }
+        read[i] = reader.share;
+    }
+    assert_true(slip39_shares_complete(read, 2));
+    assert_int_equal(slip39_combine(read, 2, secret), sizeof(secret));
+    assert_int_equal(
+        slip39_cipher_start(&cipher, true, secret, sizeof(secret), NULL, 0, 0x4321, true, 0),
+        CX_OK);
+    while (slip39_cipher_step(&cipher, 5000) < 100) {
+    }
+    assert_int_equal(slip39_cipher_final(&cipher, secret, sizeof(secret)), CX_OK);
+    assert_memory_equal(secret, bip39_hex, sizeof(secret));
+}
+
 int main(void) {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_bip39_to_sskr),
-        cmocka_unit_test(test_sskr_to_bip39)
+        cmocka_unit_test(test_sskr_to_bip39),
+        cmocka_unit_test(test_bip39_entropy),
+        cmocka_unit_test(test_bip39_to_slip39),
+        cmocka_unit_test(test_bip39_18_words_to_slip39)
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
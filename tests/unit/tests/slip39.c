@@ -0,0 +1,261 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+
+#include <lcx_rng.h>
+
+#include "testutils.h"
+#include "slip39/common_slip39.h"
+
+static const uint8_t passphrase[] = "TREZOR";
+
+// split a phrase in word indexes, return the word count
+static size_t slip39_words_get(const char *phrase, uint16_t *words, size_t words_size) {
+    size_t count = 0;
+
+    while (*phrase != '\0') {
+        const char *end = strchr(phrase, ' ');
+        const size_t length = end == NULL ? strlen(phrase) : (size_t) (end - phrase);
+        assert_true(count < words_size);
+        words[count] = bolos_ux_slip39_get_word_idx_starting_with((const unsigned char *) phrase,
+                                                                 length);
+        assert_true(words[count] < SLIP39_WORDLIST_COUNT);
+        count++;
+        phrase += length + (end != NULL);
+    }
+    return count;
+}
+
+// read the phrase as a share, every word but the last being accepted
+static slip39_word_status_t slip39_phrase_read(const char *phrase,
+                                               slip39_share_t *shares,
+                                               size_t share_count) {
+    uint16_t words[SLIP39_MAX_WORDS];
+    slip39_reader_t reader;
+    slip39_word_status_t status = SLIP39_WORD_ACCEPTED;
+    const size_t count = slip39_words_get(phrase, words, SLIP39_MAX_WORDS);
+
+    assert_true(slip39_reader_start(&reader, count));
+    for (size_t i = 0; i < count && status == SLIP39_WORD_ACCEPTED; i++) {
+        status = slip39_reader_word_add(&reader, words[i], shares, share_count);
+        assert_int_equal(reader.word_count, status <= SLIP39_SHARE_COMPLETE ? i + 1 : i);
+    }
+    if (status == SLIP39_SHARE_COMPLETE) {
+        shares[share_count] = reader.share;
+    }
+    return status;
+}
+
+static void slip39_decrypt(const slip39_share_t *shares,
+                           size_t share_count,
+                           const uint8_t *expected,
+                           size_t expected_length) {
+    uint8_t secret[SSS_MAX_SECRET_SIZE];
+    slip39_cipher_t cipher;
+    unsigned int steps = 0;
+
+    assert_int_equal(slip39_combine(shares, share_count, secret), expected_length);
+    assert_int_equal(slip39_cipher_start(&cipher,
+                                         true,
+                                         secret,
+                                         expected_length,
+                                         passphrase,
+                                         sizeof(passphrase) - 1,
+                                         shares[0].identifier,
+                                         shares[0].extendable,
+                                         shares[0].iteration_exponent),
+                     CX_OK);
+    // the progress only increases
+    for (uint8_t progress = 0, previous = 0; progress < 100; steps++, previous = progress) {
+        progress = slip39_cipher_step(&cipher, 1000);
+        assert_true(progress >= previous);
+    }
+    assert_true(steps > SLIP39_ROUND_COUNT);
+    assert_int_equal(slip39_cipher_final(&cipher, secret, expected_length), CX_OK);
+    assert_memory_equal(secret, expected, expected_length);
+}
+
+// SLIP-39 test vector 1: a single 128-bit share
+static void test_slip39_single_share(void **state) {
+    const char *phrase =
+        "duckling enlarge academic academic agency result length solution fridge kidney coal piece "
+        "deal husband erode duke ajar critical decision keyboard";
+    const uint8_t expected[] = {0xbb, 0x54, 0xaa, 0xc4, 0xb8, 0x9d, 0xc8, 0x68,
+                                0xba, 0x37, 0xd9, 0xcc, 0x21, 0xb2, 0xce, 0xce};
+    slip39_share_t shares[1];
+    uint16_t words[SLIP39_MAX_WORDS];
+    uint16_t encoded[SLIP39_MAX_WORDS];
+
+    assert_int_equal(slip39_phrase_read(phrase, shares, 0), SLIP39_SHARE_COMPLETE);
+    assert_int_equal(shares[0].identifier, 7945);
+    assert_false(shares[0].extendable);
+    assert_int_equal(shares[0].iteration_exponent, 0);
+    assert_int_equal(shares[0].group_threshold, 1);
+    assert_int_equal(shares[0].member_threshold, 1);
+    assert_true(slip39_shares_complete(shares, 1));
+    slip39_decrypt(shares, 1, expected, sizeof(expected));
+
+    // the checksum computed a word at a time is the one of the whole share
+    assert_int_equal(slip39_words_get(phrase, words, SLIP39_MAX_WORDS), 20);
+    assert_int_equal(slip39_share_encode(&shares[0], encoded, SLIP39_MAX_WORDS), 20);
+    assert_memory_equal(encoded, words, 20 * sizeof(uint16_t));
+    assert_int_equal(slip39_share_encode(&shares[0], encoded, 19), 0);
+}
+
+// SLIP-39 test vector 4: 2 of the shares of a 128-bit secret, iteration exponent 2
+static void test_slip39_two_shares(void **state) {
+    const char *phrases[] = {
+        "shadow pistol academic always adequate wildlife fancy gross oasis cylinder mustang wrist "
+        "rescue view short owner flip making coding armed",
+        "shadow pistol academic acid actress prayer class unknown daughter sweater depict flip "
+        "twice unkind craft early superior advocate guest smoking",
+    };
+    const uint8_t expected[] = {0xb4, 0x3c, 0xeb, 0x7e, 0x57, 0xa0, 0xea, 0x87,
+                                0x66, 0x22, 0x16, 0x24, 0xd0, 0x1b, 0x08, 0x64};
+    slip39_share_t shares[2];
+    uint8_t secret[SSS_MAX_SECRET_SIZE];
+
+    assert_int_equal(slip39_phrase_read(phrases[0], shares, 0), SLIP39_SHARE_COMPLETE);
+    assert_false(slip39_shares_complete(shares, 1));
+    assert_int_equal(slip39_combine(shares, 1, secret), 0);
+
+    // the same share again
+    assert_int_equal(slip39_phrase_read(phrases[0], shares, 1), SLIP39_WORD_MISMATCH);
+    assert_int_equal(slip39_phrase_read(phrases[1], shares, 1), SLIP39_SHARE_COMPLETE);
+    assert_int_equal(shares[1].iteration_exponent, 2);
+    assert_true(slip39_shares_complete(shares, 2));
+    slip39_decrypt(shares, 2, expected, sizeof(expected));
+}
+
+static void test_slip39_reader_errors(void **state) {
+    const char *phrase =
+        "duckling enlarge academic academic agency result length solution fridge kidney coal piece "
+        "deal husband erode duke ajar critical decision keyboard";
+    uint16_t words[SLIP39_MAX_WORDS];
+    slip39_share_t shares[1];
+    slip39_reader_t reader;
+
+    assert_false(slip39_reader_start(&reader, 19));
+    assert_false(slip39_reader_start(&reader, 21));
+    assert_false(slip39_reader_start(&reader, 34));
+    assert_true(slip39_reader_start(&reader, 33));
+    assert_false(slip39_reader_word_remove(&reader));
+
+    assert_int_equal(slip39_words_get(phrase, words, SLIP39_MAX_WORDS), 20);
+    assert_true(slip39_reader_start(&reader, 20));
+    for (size_t i = 0; i < 19; i++) {
+        assert_int_equal(slip39_reader_word_add(&reader, words[i], NULL, 0),
+                         SLIP39_WORD_ACCEPTED);
+    }
+    // a wrong final word is rejected, and the right one then accepted
+    assert_int_equal(slip39_reader_word_add(&reader, words[19] ^ 1, NULL, 0),
+                     SLIP39_WORD_INVALID_CHECKSUM);
+    assert_int_equal(reader.word_count, 19);
+    assert_int_equal(slip39_reader_word_add(&reader, words[19], NULL, 0), SLIP39_SHARE_COMPLETE);
+    shares[0] = reader.share;
+
+    // the checksum of the remaining words is kept when removing words
+    for (size_t i = 0; i < 15; i++) {
+        assert_true(slip39_reader_word_remove(&reader));
+    }
+    for (size_t i = 5; i < 19; i++) {
+        assert_int_equal(slip39_reader_word_add(&reader, words[i], NULL, 0),
+                         SLIP39_WORD_ACCEPTED);
+    }
+    assert_int_equal(slip39_reader_word_add(&reader, words[19], NULL, 0), SLIP39_SHARE_COMPLETE);
+    assert_memory_equal(reader.share.value, shares[0].value, 16);
+
+    // the 2 padding bits of a 128-bit share
+    assert_true(slip39_reader_start(&reader, 20));
+    for (size_t i = 0; i < SLIP39_HEADER_WORDS; i++) {
+        slip39_reader_word_add(&reader, words[i], NULL, 0);
+    }
+    assert_int_equal(slip39_reader_word_add(&reader, 0x100, NULL, 0),
+                     SLIP39_WORD_INVALID_PADDING);
+    assert_int_equal(slip39_reader_word_add(&reader, 0xFF, NULL, 0), SLIP39_WORD_ACCEPTED);
+
+    // a group threshold of 2 for a single group
+    assert_true(slip39_reader_start(&reader, 20));
+    slip39_reader_word_add(&reader, words[0], NULL, 0);
+    slip39_reader_word_add(&reader, words[1], NULL, 0);
+    slip39_reader_word_add(&reader, 1 << 2, NULL, 0);
+    assert_int_equal(slip39_reader_word_add(&reader, words[3], NULL, 0),
+                     SLIP39_WORD_INVALID_HEADER);
+
+    // another identifier than the one of the previous shares
+    assert_true(slip39_reader_start(&reader, 20));
+    slip39_reader_word_add(&reader, words[0] ^ 1, shares, 1);
+    assert_int_equal(slip39_reader_word_add(&reader, words[1], shares, 1), SLIP39_WORD_MISMATCH);
+    assert_int_equal(reader.word_count, 1);
+}
+
+static void test_slip39_roundtrip(void **state) {
+    const uint8_t master_secret[32] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                       0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+                                       0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                       0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+    const slip39_group_descriptor_t groups[] = {{1, 1}, {2, 3}, {3, 5}};
+    const slip39_group_descriptor_t invalid[] = {{1, 2}};
+    uint8_t encrypted[32];
+    uint8_t secret[32];
+    slip39_share_t shares[9];
+    slip39_share_t read[5];
+    uint16_t words[SLIP39_MAX_WORDS];
+    slip39_cipher_t cipher;
+    slip39_reader_t reader;
+    size_t read_count = 0;
+
+    assert_int_equal(slip39_cipher_start(&cipher, false, master_secret, 32, NULL, 0, 42, true, 0),
+                     CX_OK);
+    while (slip39_cipher_step(&cipher, 5000) < 100) {
+    }
+    assert_int_equal(slip39_cipher_final(&cipher, encrypted, 32), CX_OK);
+    assert_memory_not_equal(encrypted, master_secret, 32);
+
+    assert_int_equal(slip39_split(encrypted, 32, 42, true, 0, 2, groups, 3, shares, 9, cx_rng), 9);
+    assert_int_equal(slip39_split(encrypted, 32, 42, true, 0, 2, groups, 3, shares, 8, cx_rng),
+                     SSS_ERROR_TOO_MANY_SHARES);
+    assert_int_equal(slip39_split(encrypted, 32, 42, true, 0, 1, invalid, 1, shares, 9, cx_rng),
+                     SSS_ERROR_INVALID_THRESHOLD);
+    assert_int_equal(slip39_split(encrypted, 32, 42, true, 0, 2, groups, 3, shares, 9, cx_rng), 9);
+
+    // the 2nd group and 2 members of the 3rd one do not reach the group threshold, the 3rd member
+    // of the 3rd group does
+    const size_t order[] = {1, 2, 4, 5, 8};
+    for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+        assert_int_equal(slip39_share_encode(&shares[order[i]], words, SLIP39_MAX_WORDS), 33);
+        assert_true(slip39_reader_start(&reader, 33));
+        for (size_t j = 0; j < 32; j++) {
+            assert_int_equal(slip39_reader_word_add(&reader, words[j], read, read_count),
+                             SLIP39_WORD_ACCEPTED);
+        }
+        assert_int_equal(slip39_reader_word_add(&reader, words[32], read, read_count),
+                         SLIP39_SHARE_COMPLETE);
+        read[read_count++] = reader.share;
+        assert_int_equal(slip39_shares_complete(read, read_count), i == 4);
+    }
+    assert_int_equal(slip39_combine(read, read_count, secret), 32);
+    assert_memory_equal(secret, encrypted, 32);
+
+    assert_int_equal(slip39_cipher_start(&cipher, true, secret, 32, NULL, 0, 42, true, 0), CX_OK);
+    while (slip39_cipher_step(&cipher, 5000) < 100) {
+    }
+    assert_int_equal(slip39_cipher_final(&cipher, secret, 32), CX_OK);
+    assert_memory_equal(secret, master_secret, 32);
+
+    // the context is zeroed once output
+    assert_int_equal(slip39_cipher_final(&cipher, secret, 32), CX_INVALID_PARAMETER);
+    assert_int_equal(slip39_cipher_start(&cipher, true, secret, 15, NULL, 0, 42, true, 0),
+                     CX_INVALID_PARAMETER);
+}
+
+int main(void) {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_slip39_single_share),
+                                       cmocka_unit_test(test_slip39_two_shares),
+                                       cmocka_unit_test(test_slip39_reader_errors),
+                                       cmocka_unit_test(test_slip39_roundtrip)};
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,220 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+
+#include "testutils.h"
+#include "sskr/seed_rom_variables.h"
+#include "ur/ur.h"
+
+// BCR-2020-012 test vector: CBOR byte string of the 256 bytes generated by the Xoshiro256** seeded
+// with "Wolf", split in 9 fragments
+static const uint8_t wolf_message[] = {
+    0x59, 0x01, 0x00, 0x91, 0x6e, 0xc6, 0x5c, 0xf7, 0x7c, 0xad, 0xf5, 0x5c,
+    0xd7, 0xf9, 0xcd, 0xa1, 0xa1, 0x03, 0x00, 0x26, 0xdd, 0xd4, 0x2e, 0x90,
+    0x5b, 0x77, 0xad, 0xc3, 0x6e, 0x4f, 0x2d, 0x3c, 0xcb, 0xa4, 0x4f, 0x7f,
+    0x04, 0xf2, 0xde, 0x44, 0xf4, 0x2d, 0x84, 0xc3, 0x74, 0xa0, 0xe1, 0x49,
+    0x13, 0x6f, 0x25, 0xb0, 0x18, 0x52, 0x54, 0x59, 0x61, 0xd5, 0x5f, 0x7f,
+    0x7a, 0x8c, 0xde, 0x6d, 0x0e, 0x2e, 0xc4, 0x3f, 0x3b, 0x2d, 0xcb, 0x64,
+    0x4a, 0x22, 0x09, 0xe8, 0xc9, 0xe3, 0x4a, 0xf5, 0xc4, 0x74, 0x79, 0x84,
+    0xa5, 0xe8, 0x73, 0xc9, 0xcf, 0x5f, 0x96, 0x5e, 0x25, 0xee, 0x29, 0x03,
+    0x9f, 0xdf, 0x8c, 0xa7, 0x4f, 0x1c, 0x76, 0x9f, 0xc0, 0x7e, 0xb7, 0xeb,
+    0xae, 0xc4, 0x6e, 0x06, 0x95, 0xae, 0xa6, 0xcb, 0xd6, 0x0b, 0x3e, 0xc4,
+    0xbb, 0xff, 0x1b, 0x9f, 0xfe, 0x8a, 0x9e, 0x72, 0x40, 0x12, 0x93, 0x77,
+    0xb9, 0xd3, 0x71, 0x1e, 0xd3, 0x8d, 0x41, 0x2f, 0xbb, 0x44, 0x42, 0x25,
+    0x6f, 0x1e, 0x6f, 0x59, 0x5e, 0x0f, 0xc5, 0x7f, 0xed, 0x45, 0x1f, 0xb0,
+    0xa0, 0x10, 0x1f, 0xb7, 0x6b, 0x1f, 0xb1, 0xe1, 0xb8, 0x8c, 0xfd, 0xfd,
+    0xaa, 0x94, 0x62, 0x94, 0xa4, 0x7d, 0xe8, 0xff, 0xf1, 0x73, 0xf0, 0x21,
+    0xc0, 0xe6, 0xf6, 0x5b, 0x05, 0xc0, 0xa4, 0x94, 0xe5, 0x07, 0x91, 0x27,
+    0x0a, 0x00, 0x50, 0xa7, 0x3a, 0xe6, 0x9b, 0x67, 0x25, 0x50, 0x5a, 0x2e,
+    0xc8, 0xa5, 0x79, 0x14, 0x57, 0xc9, 0x87, 0x6d, 0xd3, 0x4a, 0xad, 0xd1,
+    0x92, 0xa5, 0x3a, 0xa0, 0xdc, 0x66, 0xb5, 0x56, 0xc0, 0xc2, 0x15, 0xc7,
+    0xce, 0xb8, 0x24, 0x8b, 0x71, 0x7c, 0x22, 0x95, 0x1e, 0x65, 0x30, 0x5b,
+    0x56, 0xa3, 0x70, 0x6e, 0x3e, 0x86, 0xeb, 0x01, 0xc8, 0x03, 0xbb, 0xf9,
+    0x15, 0xd8, 0x0e, 0xdc, 0xd6, 0x4d, 0x4d,
+};
+static const char *wolf_parts[] = {
+    "UR:BYTES/1-9/LPADASCFADAXCYWENBPLJKHDCAHKADAEMEJTSWHHYLKEPMYKHHTSYTSNOYOYAXAEDSUTTYDMMHHPKTPMS"
+    "RJTDKGSLPGH",
+    "UR:BYTES/2-9/LPAOASCFADAXCYWENBPLJKHDCAGWDPFNSBOXGWLBAAWZUEFYWKDPLRSRJYNBVYGABWJLDAPFCSGMGHHKH"
+    "STLRDCXAEFZ",
+};
+// the fountain-coded frames following them: fragment 0, fragment 2, and fragments 2 and 6 mixed
+static const char *wolf_fountain_parts[] = {
+    "UR:BYTES/10-9/LPBKASCFADAXCYWENBPLJKHDCAHKADAEMEJTSWHHYLKEPMYKHHTSYTSNOYOYAXAEDSUTTYDMMHHPKTP"
+    "MSRJTWDKIPLZS",
+    "UR:BYTES/11-9/LPBDASCFADAXCYWENBPLJKHDCAHELBKNLKUEJNBADMSSFHFRDPSBIEGECPASVSSOVLGEYKSSJYKKLRO"
+    "NVSJKVETIIAPK",
+    "UR:BYTES/12-9/LPBNASCFADAXCYWENBPLJKHDCARLLALUZMDMGSTOSPEYIEFMWEJLWTPEDAMKTKSRVLCYGMZEMOVOVLL"
+    "ARODTMTBNPTRS",
+};
+
+static void test_ur_single_part(void **state __attribute__((unused))) {
+    // BCR-2020-012 ByteWords test vector
+    const uint8_t message[] = {0, 1, 2, 128, 255};
+    ur_encoder_t encoder;
+    char text[32];
+
+    assert_true(ur_encoder_start(&encoder, "bytes", message, sizeof(message), sizeof(text) - 1));
+    assert_int_equal(encoder.count, 1);
+    assert_int_equal(ur_encoder_part_get(&encoder, 1, text, sizeof(text)), 27);
+    assert_string_equal(text, "UR:BYTES/AEADAOLAZMJENDEOTI");
+    // the text does not fit
+    assert_int_equal(ur_encoder_part_get(&encoder, 1, text, 27), 0);
+    assert_int_equal(ur_encoder_part_get(&encoder, 2, text, sizeof(text)), 0);
+    assert_false(ur_encoder_start(&encoder, "bytes", message, sizeof(message), 26));
+}
+
+static void test_ur_multipart(void **state __attribute__((unused))) {
+    ur_encoder_t encoder;
+    char text[128];
+
+    assert_true(ur_encoder_start(&encoder,
+                                 "bytes",
+                                 wolf_message,
+                                 sizeof(wolf_message),
+                                 strlen(wolf_parts[0])));
+    assert_int_equal(encoder.count, 9);
+    assert_int_equal(encoder.fragment_length, 29);
+    for (uint16_t seq = 1; seq <= sizeof(wolf_parts) / sizeof(wolf_parts[0]); seq++) {
+        assert_int_equal(ur_encoder_part_get(&encoder, seq, text, sizeof(text)),
+                         strlen(wolf_parts[seq - 1]));
+        assert_string_equal(text, wolf_parts[seq - 1]);
+    }
+    // the last fragment is zero-padded, its frame being as long
+    assert_int_equal(ur_encoder_part_get(&encoder, 9, text, sizeof(text)), strlen(wolf_parts[0]));
+    assert_memory_equal(text, "UR:BYTES/9-9/", 13);
+}
+
+// bytes of the minimal ByteWords of a frame body, return their count
+static size_t ur_body_decode(const char *text, uint8_t *bytes) {
+    const char *body = strrchr(text, '/') + 1;
+    size_t length = 0;
+
+    for (; body[0] != '\0' && body[1] != '\0'; body += 2) {
+        for (unsigned int byte = 0; byte < 256; byte++) {
+            const unsigned char *word = SSKR_WORDLIST + byte * SSKR_BYTEWORD_LENGTH;
+
+            if (word[0] - 'a' + 'A' == body[0] &&
+                word[SSKR_BYTEWORD_LENGTH - 1] - 'a' + 'A' == body[1]) {
+                bytes[length++] = byte;
+                break;
+            }
+        }
+    }
+    return length;
+}
+
+static void test_ur_fountain_parts(void **state __attribute__((unused))) {
+    // offset of the fragment in the CBOR array of a frame of the Wolf message, seq being below 24
+    const size_t offset = 1 + 1 + 1 + 3 + 5 + 2;
+    uint8_t fragments[9][29];
+    uint8_t part[UR_PART_MAX_LENGTH + 4];
+    ur_encoder_t encoder;
+    char text[128];
+
+    // a character more than the systematic frames, so that fountain-coded ones up to 18 fit
+    assert_true(ur_encoder_start(&encoder,
+                                 "bytes",
+                                 wolf_message,
+                                 sizeof(wolf_message),
+                                 strlen(wolf_parts[0]) + 1));
+    assert_int_equal(encoder.count, 9);
+    assert_int_equal(encoder.cycle, 18);
+    assert_int_equal(ur_encoder_part_get(&encoder, 19, text, sizeof(text)), 0);
+
+    for (uint32_t seq = 1; seq <= encoder.cycle; seq++) {
+        const size_t text_length = ur_encoder_part_get(&encoder, seq, text, sizeof(text));
+        const size_t length = ur_body_decode(text, part);
+        uint8_t expected[29] = {0};
+
+        assert_int_equal(text_length, strlen(wolf_parts[0]) + (seq >= 10));
+        assert_int_equal(length, offset + sizeof(expected) + 4);
+        assert_int_equal(part[1], seq);
+        assert_int_equal(cx_crc32(part, length - 4),
+                         (uint32_t) part[length - 4] << 24 | part[length - 3] << 16 |
+                             part[length - 2] << 8 | part[length - 1]);
+        if (seq <= encoder.count) {
+            memcpy(fragments[seq - 1], part + offset, sizeof(fragments[0]));
+            continue;
+        }
+        // fountain-coded frames mix the systematic fragments
+        const uint32_t mixed = ur_fragments_choose(seq, encoder.count, encoder.checksum);
+        assert_int_not_equal(mixed, 0);
+        for (size_t i = 0; i < encoder.count; i++) {
+            for (size_t j = 0; (mixed >> i) & 1 && j < sizeof(expected); j++) {
+                expected[j] ^= fragments[i][j];
+            }
+        }
+        assert_memory_equal(part + offset, expected, sizeof(expected));
+        if (seq - encoder.count <= sizeof(wolf_fountain_parts) / sizeof(wolf_fountain_parts[0])) {
+            assert_string_equal(text, wolf_fountain_parts[seq - encoder.count - 1]);
+        }
+    }
+    // fragments 2 and 6
+    assert_int_equal(ur_fragments_choose(12, encoder.count, encoder.checksum), 0x44);
+}
+
+static void test_ur_xoshiro256(void **state __attribute__((unused))) {
+    // BCR-2020-012 test vectors: first outputs of the generator seeded with "Wolf" (modulo 100),
+    // and the fragments of the frames 11 to 24 of a 1024-byte message split in 11 fragments
+    const uint8_t wolf_outputs[] = {42, 81, 85, 8,  82, 84, 76, 73, 70, 88,
+                                    2,  74, 40, 48, 77, 54, 88, 7,  5,  88};
+    const uint32_t wolf_fragments[] = {0x400, 0x200, 0x764, 0x100, 0x022, 0x002, 0x535,
+                                       0x020, 0x004, 0x004, 0x6bb, 0x76f, 0x7b5, 0x028};
+    uint8_t message[1024];
+    ur_xoshiro256_t rng;
+
+    ur_xoshiro256_init(&rng, (const uint8_t *) "Wolf", 4);
+    for (size_t i = 0; i < sizeof(wolf_outputs); i++) {
+        assert_int_equal(ur_xoshiro256_next(&rng) % 100, wolf_outputs[i]);
+    }
+
+    // the message bytes are drawn as the reference implementation
+    ur_xoshiro256_init(&rng, (const uint8_t *) "Wolf", 4);
+    for (size_t i = 0; i < sizeof(message); i++) {
+        message[i] = (double) ur_xoshiro256_next(&rng) / 18446744073709551616.0 * 256;
+    }
+    const uint32_t checksum = cx_crc32(message, sizeof(message));
+    for (uint32_t seq = 1; seq <= 11; seq++) {
+        assert_int_equal(ur_fragments_choose(seq, 11, checksum), 1 << (seq - 1));
+    }
+    for (size_t i = 0; i < sizeof(wolf_fragments) / sizeof(wolf_fragments[0]); i++) {
+        assert_int_equal(ur_fragments_choose(11 + i, 11, checksum), wolf_fragments[i]);
+    }
+    assert_int_equal(ur_fragments_choose(12, UR_FOUNTAIN_MAX_COUNT + 1, checksum), 0);
+}
+
+static void test_ur_sskr_share(void **state __attribute__((unused))) {
+    // CBOR byte string of a 256-bit SSKR share, 5 bytes of metadata followed by the share value
+    uint8_t message[2 + 5 + 32] = {0x58, 0x25};
+    ur_encoder_t encoder;
+    char text[78];
+
+    for (size_t i = 2; i < sizeof(message); i++) {
+        message[i] = i;
+    }
+    // it does not fit in the 77 alphanumeric characters of a version 3 QR code
+    assert_true(ur_encoder_start(&encoder, "sskr", message, sizeof(message), sizeof(text) - 1));
+    assert_int_equal(encoder.count, 3);
+    assert_int_equal(encoder.fragment_length, 13);
+    assert_int_equal(encoder.cycle, 6);
+    for (uint32_t seq = 1; seq <= encoder.cycle; seq++) {
+        assert_int_equal(ur_encoder_part_get(&encoder, seq, text, sizeof(text)), 68);
+        assert_memory_equal(text, "UR:SSKR/", 8);
+        assert_int_equal(text[8], '0' + seq);
+        assert_memory_equal(text + 9, "-3/", 3);
+    }
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_ur_single_part),
+                                       cmocka_unit_test(test_ur_multipart),
+                                       cmocka_unit_test(test_ur_fountain_parts),
+                                       cmocka_unit_test(test_ur_xoshiro256),
+                                       cmocka_unit_test(test_ur_sskr_share)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -8,6 +8,7 @@
 #include "testutils.h"
 #include "bip39/common_bip39.h"
 #include "sskr/common_sskr.h"
+#include "wordlist.h"
 
 static void test_words_bip39(void **state) {
     unsigned char next_letters[27] = {0};
@@ -47,6 +48,98 @@ static void test_words_bip39(void **state) {
     assert_string_equal((const char *) next_letters, "eo");
 }
 
+// Check every one- and two-letter prefix, and every prefix of every word, against a plain
+// scan of the whole wordlist
+static void check_prefixes(unsigned int words_count,
+                           unsigned char words[][9],
+                           unsigned int no_match_idx,
+                           unsigned int (*get_idx)(const unsigned char *, const unsigned int),
+                           unsigned int (*get_count)(const unsigned char *, const unsigned int),
+                           unsigned int (*get_next_letters)(const unsigned char *,
+                                                            const unsigned int,
+                                                            unsigned char *)) {
+    unsigned char prefix[9];
+
+    for (unsigned int w = 0; w < words_count + 26 * 27; w++) {
+        unsigned int prefix_length;
+        if (w < 26 * 27) {
+            // "a".."z", then "aa".."zz"
+            prefix[0] = 'a' + (w < 26 ? w : (w - 26) / 26);
+            prefix[1] = 'a' + (w - 26) % 26;
+            prefix_length = w < 26 ? 1 : 2;
+        } else {
+            prefix_length = strlen((const char *) words[w - 26 * 27]);
+            memcpy(prefix, words[w - 26 * 27], prefix_length);
+        }
+        for (unsigned int len = 0; len <= prefix_length; len++) {
+            unsigned int expected_idx = no_match_idx, expected_count = 0;
+            unsigned char expected_letters[27] = {0}, next_letters[27] = {0};
+            unsigned int expected_letters_count = 0;
+            for (unsigned int i = 0; i < words_count; i++) {
+                if (strncmp((const char *) words[i], (const char *) prefix, len) == 0) {
+                    if (expected_count++ == 0) {
+                        expected_idx = i;
+                    }
+                    if (words[i][len] != 0 && (expected_letters_count == 0 ||
+                                               expected_letters[expected_letters_count - 1] !=
+                                                   words[i][len])) {
+                        expected_letters[expected_letters_count++] = words[i][len];
+                    }
+                }
+            }
+            if (len > 0) {
+                assert_int_equal(get_idx(prefix, len), expected_idx);
+            }
+            assert_int_equal(get_count(prefix, len), expected_count);
+            assert_int_equal(get_next_letters(prefix, len, next_letters), expected_letters_count);
+            assert_string_equal((const char *) next_letters, (const char *) expected_letters);
+        }
+    }
+}
+
+static void test_words_bip39_prefixes(void **state) {
+    unsigned char words[2048][9];
+
+    for (unsigned int i = 0; i < 2048; i++) {
+        assert_int_not_equal(bolos_ux_bip39_idx_strcpy(i, words[i]), 0);
+    }
+    check_prefixes(2048,
+                   words,
+                   2048,
+                   bolos_ux_bip39_get_word_idx_starting_with,
+                   bolos_ux_bip39_get_word_count_starting_with,
+                   bolos_ux_bip39_get_word_next_letters_starting_with);
+}
+
+static void test_words_sskr_prefixes(void **state) {
+    unsigned char words[256][9] = {0};
+
+    for (unsigned int i = 0; i < 256; i++) {
+        assert_int_equal(bolos_ux_sskr_idx_strcpy(i, words[i]), 4);
+    }
+    check_prefixes(256,
+                   words,
+                   256,
+                   bolos_ux_sskr_get_word_idx_starting_with,
+                   bolos_ux_sskr_get_word_count_starting_with,
+                   bolos_ux_sskr_get_word_next_letters_starting_with);
+}
+
+static void test_words_keyboard_mask(void **state) {
+    // "ab" may be followed by "ailosu"
+    const uint32_t letters = (1 << 0) | (1 << 8) | (1 << 11) | (1 << 14) | (1 << 18) | (1 << 20);
+    uint32_t expected = 1 << 28;
+    const char *kbd_letters = "qwertyuiopasdfghjklzxcvbnm";
+
+    for (int i = 0; i < 26; i++) {
+        if (strchr("ailosu", kbd_letters[i]) != NULL) {
+            expected |= 1 << i;
+        }
+    }
+    assert_int_equal(wordlist_keyboard_mask(letters), ~expected);
+    assert_int_equal(wordlist_keyboard_mask(0), ~(uint32_t) (1 << 28));
+}
+
 static void test_words_sskr(void **state) {
     unsigned char next_letters[27] = {0};
     size_t return_num = 0;
@@ -88,7 +181,10 @@ static void test_words_sskr(void **state) {
 int main(void) {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_words_bip39),
-        cmocka_unit_test(test_words_sskr)
+        cmocka_unit_test(test_words_bip39_prefixes),
+        cmocka_unit_test(test_words_sskr),
+        cmocka_unit_test(test_words_sskr_prefixes),
+        cmocka_unit_test(test_words_keyboard_mask)
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
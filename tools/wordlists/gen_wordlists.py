@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""Generate the flash tables of the wordlists used by the application.
+
+The tables of the BIP39, SLIP-39 and SSKR (ByteWords) wordlists are derived from the plain word
+lists of this directory and written in place in the seed_rom_variables.c files. The BIP39 lists
+other than the English one are NFKD text: their words are packed by their ASCII-folded letters,
+the combining marks dropped by the folding being listed apart. With --check, the
+tables are regenerated and compared with the committed ones instead, the script failing if they
+differ.
+
+Usage: gen_wordlists.py [--check]
+"""
+
+import argparse
+import sys
+import unicodedata
+from pathlib import Path
+
+TOOLS_DIR = Path(__file__).resolve().parent
+SRC_DIR = TOOLS_DIR.parent.parent / "src" / "common"
+
+LETTERS = "abcdefghijklmnopqrstuvwxyz"
+# see src/common/wordlist.h
+TRIE_LETTERS_BITS = 26
+TRIE_FIRST_CHILD_SHIFT = 52
+# see src/common/bip39/seed_rom_variables.c
+WORD_LETTERS = 8
+LETTER_BITS = 5
+STRIDE = WORD_LETTERS * LETTER_BITS // 8
+# see BIP39_WORDLIST_MARK in src/common/bip39/seed_rom_variables.h
+FIRST_MARK = 0x300
+LAST_MARK = 0x36F
+
+
+def read_words(name):
+    words = (TOOLS_DIR / name).read_text().split()
+    if words != sorted(words) or len(set(words)) != len(words):
+        sys.exit(f"{name}: the words must be sorted and unique")
+    if any(not word or any(letter not in LETTERS for letter in word) for word in words):
+        sys.exit(f"{name}: the words must be made of 'a'-'z' letters")
+    return words
+
+
+def read_nfkd_words(name):
+    """Folded words of an NFKD wordlist, and their marks as BIP39_WORDLIST_MARK values."""
+    text = (TOOLS_DIR / name).read_text(encoding="utf-8").split()
+    if any(unicodedata.normalize("NFKD", word) != word for word in text):
+        sys.exit(f"{name}: the words must be NFKD text")
+    words = []
+    marks = []
+    for index, word in enumerate(text):
+        folded = ""
+        for character in word:
+            if not unicodedata.combining(character):
+                folded += character
+            elif not folded or not FIRST_MARK <= ord(character) <= LAST_MARK:
+                sys.exit(f"{word}: unexpected combining mark U+{ord(character):04X}")
+            else:
+                marks.append((index << 16) | ((len(folded) - 1) << 8) |
+                             (ord(character) - FIRST_MARK))
+        words.append(folded)
+    # the folded words are the ones typed, looked up and sorted
+    if words != sorted(words) or len(set(words)) != len(words):
+        sys.exit(f"{name}: the folded words must be sorted and unique")
+    if any(not word or any(letter not in LETTERS for letter in word) for word in words):
+        sys.exit(f"{name}: the folded words must be made of 'a'-'z' letters")
+    return words, marks
+
+
+def trie(words):
+    """Nodes of the prefixes shared by at least two words, breadth first, the children of a
+    node being consecutive and sorted."""
+    nodes = []
+    queue = [""]
+    while queue:
+        prefix = queue.pop(0)
+        followers = [word[len(prefix)] for word in words
+                     if word.startswith(prefix) and len(word) > len(prefix)]
+        letters = sorted(set(followers))
+        branches = [letter for letter in letters
+                    if sum(word.startswith(prefix + letter) for word in words) > 1]
+        first_child = len(nodes) + len(queue) + 1 if branches else 0
+        node = first_child << TRIE_FIRST_CHILD_SHIFT
+        for letter in letters:
+            node |= 1 << LETTERS.index(letter)
+        for letter in branches:
+            node |= 1 << (TRIE_LETTERS_BITS + LETTERS.index(letter))
+        nodes.append(node)
+        queue.extend(prefix + letter for letter in branches)
+    return nodes
+
+
+def packed_word(word):
+    if len(word) > WORD_LETTERS:
+        sys.exit(f"{word}: more than {WORD_LETTERS} letters")
+    key = 0
+    for position in range(WORD_LETTERS):
+        code = LETTERS.index(word[position]) + 1 if position < len(word) else 0
+        key = (key << LETTER_BITS) | code
+    return key.to_bytes(STRIDE, "big")
+
+
+def prefix_index(words):
+    index = [sum(word < first + second for word in words)
+             for first in LETTERS for second in LETTERS]
+    return index + [len(words)]
+
+
+def array(declaration, lines):
+    """C array with its values in lines, laid out as clang-format does."""
+    body = ",\n".join("    " + line for line in lines)
+    return f"{declaration} = {{\n{body}}};"
+
+
+def values_per_line(values, count, width=0):
+    lines = []
+    for i in range(0, len(values), count):
+        cells = [f"{value},".ljust(width) for value in values[i:i + count]]
+        line = "".join(cells).rstrip() if width else " ".join(cells)
+        lines.append(line[:-1])
+    return lines
+
+
+def trie_table(name, words):
+    nodes = [f"0x{node:016X}ULL" for node in trie(words)]
+    return array(f"unsigned long long const {name}[]", values_per_line(nodes, 4))
+
+
+def prefix_index_table(name, words):
+    return array(f"unsigned short const {name}[]",
+                 values_per_line([str(value) for value in prefix_index(words)], 13, 7))
+
+
+def packed_words_table(name, words):
+    declaration = f"unsigned char const {name}[] = {{"
+    lines = []
+    for i, word in enumerate(words):
+        data = ", ".join(f"0x{byte:02X}" for byte in packed_word(word))
+        ending = "};" if i == len(words) - 1 else ","
+        lines.append(f"    {data}{ending}  // {word}")
+    return declaration + "\n" + "\n".join(lines)
+
+
+def marks_table(name, marks):
+    return array(f"unsigned int const {name}[]",
+                 values_per_line([f"0x{mark:08X}" for mark in marks], 6))
+
+
+def letters_table(name, words):
+    # the words are read at a fixed stride
+    if len({len(word) for word in words}) != 1:
+        sys.exit(f"{name}: the words must have the same length")
+    letters = [f"'{letter}'" for letter in "".join(words)]
+    return array(f"unsigned char const {name}[]", values_per_line(letters, 19))
+
+
+def tables():
+    bip39 = read_words("bip39_english.txt")
+    bip39_french, bip39_french_marks = read_nfkd_words("bip39_french.txt")
+    slip39 = read_words("slip39.txt")
+    bytewords = read_words("bytewords.txt")
+    return {
+        SRC_DIR / "bip39" / "seed_rom_variables.c": [
+            ("BIP39_WORDLIST", packed_words_table("BIP39_WORDLIST", bip39)),
+            ("BIP39_WORDLIST_PREFIX_INDEX",
+             prefix_index_table("BIP39_WORDLIST_PREFIX_INDEX", bip39)),
+            ("BIP39_TRIE", trie_table("BIP39_TRIE", bip39)),
+            ("BIP39_WORDLIST_FRENCH", packed_words_table("BIP39_WORDLIST_FRENCH", bip39_french)),
+            ("BIP39_WORDLIST_PREFIX_INDEX_FRENCH",
+             prefix_index_table("BIP39_WORDLIST_PREFIX_INDEX_FRENCH", bip39_french)),
+            ("BIP39_TRIE_FRENCH", trie_table("BIP39_TRIE_FRENCH", bip39_french)),
+            ("BIP39_WORDLIST_MARKS_FRENCH",
+             marks_table("BIP39_WORDLIST_MARKS_FRENCH", bip39_french_marks)),
+        ],
+        SRC_DIR / "slip39" / "seed_rom_variables.c": [
+            ("SLIP39_WORDLIST", packed_words_table("SLIP39_WORDLIST", slip39)),
+            ("SLIP39_TRIE", trie_table("SLIP39_TRIE", slip39)),
+        ],
+        SRC_DIR / "sskr" / "seed_rom_variables.c": [
+            ("SSKR_WORDLIST", letters_table("SSKR_WORDLIST", bytewords)),
+            ("SSKR_TRIE", trie_table("SSKR_TRIE", bytewords)),
+        ],
+    }
+
+
+def table_span(source, name):
+    """Start and end of the committed table, from its declaration to its closing line."""
+    start = source.find(f" {name}[] = {{")
+    if start < 0:
+        return None
+    start = source.rfind("\n", 0, start) + 1
+    end = source.index("};", start)
+    end = source.find("\n", end)
+    return start, len(source) if end < 0 else end
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check",
+                        action="store_true",
+                        help="compare the committed tables with the generated ones")
+    args = parser.parse_args()
+
+    stale = []
+    for path, generated in tables().items():
+        source = path.read_text()
+        updated = source
+        for name, table in generated:
+            span = table_span(updated, name)
+            if span is None:
+                sys.exit(f"{path}: {name} not found")
+            updated = updated[:span[0]] + table + updated[span[1]:]
+        if updated != source:
+            stale.append(path)
+            if not args.check:
+                path.write_text(updated)
+
+    for path in stale:
+        print(f"{path}: {'out of date' if args.check else 'updated'}")
+    return 1 if args.check and stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())